@@ -524,6 +524,73 @@ const char *
 CanalGetDriverInfo(void);
 #endif
 
+/*
+    Generation 3 - optional bulk transfer
+
+    Drivers are not required to export these. Callers look them up
+    at load time and fall back to the single message calls when they
+    are missing.
+*/
+
+/*!
+    Blocking receive of several messages on a CANAL channel.
+
+    Blocks until at least one message is available or the timeout
+    expires and then returns as many of the queued messages as fits
+    in the buffer without waiting for more.
+
+    @param handle - Handle to open physical CANAL channel.
+    @param pCanalMsgs - Array that will get received messages.
+    @param count - Number of messages pCanalMsgs can hold.
+    @param pReceived - Set to the number of messages received.
+    @param timeout - time-out in ms. 0 is forever.
+    @return zero on success (at least one message) or error-code on failure.
+*/
+#ifdef WIN32
+int EXPORT
+CanalBlockingReceiveBatch(CANALHANDLE handle,
+                          PCANALMSG pCanalMsgs,
+                          unsigned int count,
+                          unsigned int *pReceived,
+                          unsigned long timeout);
+#else
+int
+CanalBlockingReceiveBatch(CANALHANDLE handle,
+                          PCANALMSG pCanalMsgs,
+                          unsigned int count,
+                          unsigned int *pReceived,
+                          unsigned long timeout);
+#endif
+
+/*!
+    Send several messages on a CANAL channel.
+
+    Messages are sent in order. Sending stops at the first message
+    that can not be sent.
+
+    @param handle - Handle to open physical CANAL channel.
+    @param pCanalMsgs - Array with messages to send.
+    @param count - Number of messages in pCanalMsgs.
+    @param pSent - Set to the number of messages sent.
+    @param timeout - time-out in ms. 0 is forever.
+    @return zero if all messages was sent or error-code on failure.
+*/
+#ifdef WIN32
+int EXPORT
+CanalSendBatch(CANALHANDLE handle,
+               const PCANALMSG pCanalMsgs,
+               unsigned int count,
+               unsigned int *pSent,
+               unsigned long timeout);
+#else
+int
+CanalSendBatch(CANALHANDLE handle,
+               const PCANALMSG pCanalMsgs,
+               unsigned int count,
+               unsigned int *pSent,
+               unsigned long timeout);
+#endif
+
 /*     * * * * Constants * * * *    */
 
 /* CANAL Open i/f flags */
@@ -53,6 +53,9 @@ typedef const char * ( __stdcall * LPFNDLL_CANALGETVENDORSTRING) (  void );
 typedef int ( __stdcall * LPFNDLL_CANALBLOCKINGSEND) (  long handle, const PCANALMSG pCanalMsg, unsigned long timeout );
 typedef int ( __stdcall * LPFNDLL_CANALBLOCKINGRECEIVE) ( long handle,  PCANALMSG pCanalMsg, unsigned long timeout );
 typedef const char * ( __stdcall * LPFNDLL_CANALGETDRIVERINFO) ( void );
+// Generation 3 (optional)
+typedef int ( __stdcall * LPFNDLL_CANALBLOCKINGRECEIVEBATCH) ( long handle, PCANALMSG pCanalMsgs, unsigned int count, unsigned int *pReceived, unsigned long timeout );
+typedef int ( __stdcall * LPFNDLL_CANALSENDBATCH) ( long handle, const PCANALMSG pCanalMsgs, unsigned int count, unsigned int *pSent, unsigned long timeout );
 
 #else // UNIX
 
@@ -74,6 +77,9 @@ typedef const char *( *LPFNDLL_CANALGETVENDORSTRING ) (  void );
 typedef int ( *LPFNDLL_CANALBLOCKINGSEND ) (  long handle, const PCANALMSG pCanalMsg, unsigned long timeout );
 typedef int ( *LPFNDLL_CANALBLOCKINGRECEIVE ) ( long handle, PCANALMSG pCanalMsg, unsigned long timeout );
 typedef const char * ( *LPFNDLL_CANALGETDRIVERINFO) ( void );
+// Generation 3 (optional)
+typedef int ( *LPFNDLL_CANALBLOCKINGRECEIVEBATCH ) ( long handle, PCANALMSG pCanalMsgs, unsigned int count, unsigned int *pReceived, unsigned long timeout );
+typedef int ( *LPFNDLL_CANALSENDBATCH ) ( long handle, const PCANALMSG pCanalMsgs, unsigned int count, unsigned int *pSent, unsigned long timeout );
 
 #endif // WIN32
 
@@ -48,6 +48,8 @@
 #endif
 
 #include <canal-macro.h>
+#include <vscp-log.h>
+#include <vscp-metrics.h>
 #include <vscp.h>
 #include <vscpdatetime.h>
 #include <vscphelper.h>
@@ -67,6 +69,7 @@ using namespace kainjow::mustache;
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <list>
@@ -101,6 +104,7 @@ CClientItem::CClientItem()
   m_flags                      = 0;     // No flags
   m_status.channel_status      = 0;
   m_clientID                   = 0;
+  m_listOrder                  = 0;
   m_type                       = CLIENT_ITEM_INTERFACE_TYPE_NONE;
   m_bUDPReceiveChannel         = false;
   m_maxItemsInClientInputQueue = 0;
@@ -142,6 +146,10 @@ CClientItem::CClientItem()
 
   bAuthenticated = false;
   m_pUserItem    = NULL;
+
+  memset(m_sendPermCache, 0, sizeof(m_sendPermCache));
+  m_pSendPermCacheUser      = NULL;
+  m_sendPermCacheGeneration = 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -169,6 +177,40 @@ CClientItem::~CClientItem()
   pthread_mutex_destroy(&m_mutexClientInputQueue);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// isAllowedToSendEvent
+//
+
+bool
+CClientItem::isAllowedToSendEvent(uint16_t vscp_class, uint16_t vscp_type)
+{
+  if (NULL == m_pUserItem) {
+    return false;
+  }
+
+  // Drop cached decisions if user or permissions changed
+  if ((m_pUserItem != m_pSendPermCacheUser) ||
+      (m_pUserItem->getPermissionGeneration() != m_sendPermCacheGeneration)) {
+    memset(m_sendPermCache, 0, sizeof(m_sendPermCache));
+    m_pSendPermCacheUser      = m_pUserItem;
+    m_sendPermCacheGeneration = m_pUserItem->getPermissionGeneration();
+  }
+
+  uint32_t key = ((uint32_t) vscp_class << 16) | vscp_type;
+  size_t idx   = (vscp_class ^ vscp_type) & (CLIENT_ITEM_SEND_PERM_CACHE_SIZE - 1);
+
+  if (m_sendPermCache[idx].bValid && (key == m_sendPermCache[idx].key)) {
+    return m_sendPermCache[idx].bAllowed;
+  }
+
+  bool bAllowed                 = m_pUserItem->isUserAllowedToSendEvent(vscp_class, vscp_type);
+  m_sendPermCache[idx].bValid   = true;
+  m_sendPermCache[idx].bAllowed = bAllowed;
+  m_sendPermCache[idx].key      = key;
+
+  return bAllowed;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // CommandStartWith
 //
@@ -235,15 +277,15 @@ CClientItem::getAsString(void)
 // ----------------------------------------------------------------------------
 
 ///////////////////////////////////////////////////////////////////////////////
-// compareClientItems
+// guidKey
 //
-// Type of compare function for list sort operation (as in 'qsort')
+// Key used for the GUID index
 //
 
-static bool
-compareClientItems(const uint16_t element1, const uint16_t element2)
+static std::string
+guidKey(cguid &guid)
 {
-  return (element1 < element2);
+  return std::string((const char *) guid.getGUID(), 16);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -256,7 +298,13 @@ compareClientItems(const uint16_t element1, const uint16_t element2)
 
 CClientList::CClientList()
 {
-  pthread_mutex_init(&m_mutexItemList, NULL);
+  pthread_rwlock_init(&m_rwlockItemList, NULL);
+  pthread_mutex_init(&m_mutexGuidIndex, NULL);
+
+  m_nextListOrder = 0;
+
+  m_idBitmap.assign((CLIENT_LIST_MAX_ID + 1) / 64, 0);
+  m_idBitmap[0] |= 1; // Id zero is never used
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -266,7 +314,8 @@ CClientList::CClientList()
 CClientList::~CClientList()
 {
   removeAllClients();
-  pthread_mutex_destroy(&m_mutexItemList);
+  pthread_mutex_destroy(&m_mutexGuidIndex);
+  pthread_rwlock_destroy(&m_rwlockItemList);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -276,38 +325,30 @@ CClientList::~CClientList()
 bool
 CClientList::findFreeId(uint16_t *pid)
 {
-  std::list<uint16_t> sorterIdList;
-  std::deque<CClientItem *>::iterator it;
-
   // Check pointer
   if (NULL == pid) {
     return false;
   }
 
-  // Find next free id
-  for (it = m_itemList.begin(); it != m_itemList.end(); ++it) {
-    CClientItem *pItem = *it;
-    sorterIdList.push_back(pItem->m_clientID);
-  }
-
-  // Sort list on client id
-  sorterIdList.sort(compareClientItems);
+  // Lowest free id at or above *pid, skip full words
+  uint32_t id = *pid;
+  while (id <= CLIENT_LIST_MAX_ID) {
 
-  std::list<uint16_t>::iterator it_id;
-  for (it_id = sorterIdList.begin(); it_id != sorterIdList.end(); ++it_id) {
-    // As the list is sorted on id we have found an
-    // unused id if the id is higher than the counter
-    if (*pid < *it_id) {
-      break;
+    uint64_t word = m_idBitmap[id / 64];
+    if (~0ULL == word) {
+      id = (id / 64 + 1) * 64;
+      continue;
     }
 
-    (*pid)++;
-    if (0 == *pid) {
-      return false; // All client id's are in use
+    if (!(word & (1ULL << (id % 64)))) {
+      *pid = (uint16_t) id;
+      return true;
     }
+
+    id++;
   }
 
-  return true;
+  return false; // All client id's are in use
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -330,21 +371,23 @@ CClientList::addClient(CClientItem *pClientItem, uint32_t id)
     }
   }
 
-  // We try to assign requested id
-  std::deque<CClientItem *>::iterator it;
-  for (it = m_itemList.begin(); it != m_itemList.end(); ++it) {
-
-    CClientItem *pItem = *it;
-
-    // If id is already in use fail
-    if (pClientItem->m_clientID == pItem->m_clientID) {
-      return false;
-    }
+  // If id is already in use fail
+  uint16_t clientId = pClientItem->m_clientID;
+  if (m_idBitmap[clientId / 64] & (1ULL << (clientId % 64))) {
+    return false;
   }
 
   // Append to list
+  pClientItem->m_listOrder = m_nextListOrder++;
   m_itemList.push_back(pClientItem);
 
+  m_idBitmap[clientId / 64] |= (1ULL << (clientId % 64));
+  m_idIndex[clientId] = pClientItem;
+
+  pthread_mutex_lock(&m_mutexGuidIndex);
+  addToGuidIndex(pClientItem);
+  pthread_mutex_unlock(&m_mutexGuidIndex);
+
   return true;
 }
 
@@ -364,13 +407,12 @@ CClientList::addClient(CClientItem *pClientItem, cguid &guid)
     return false;
   }
 
-  // Set the guid
-  pClientItem->m_guid = guid;
-
   // Make sure nickname id is zero
-  pClientItem->m_guid.setNicknameID(0);
+  cguid newguid = guid;
+  newguid.setNicknameID(0);
 
-  return true;
+  // Set the guid
+  return setClientGUID(pClientItem, newguid);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -393,30 +435,60 @@ CClientList::removeClient(CClientItem *pClientItem)
   }
   pClientItem->m_clientInputQueue.clear();
 
-  // Take away the node
-  for (std::deque<CClientItem *>::iterator it = m_itemList.begin(); it != m_itemList.end(); ++it) {
+  // Must be in the list
+  std::unordered_map<uint16_t, CClientItem *>::iterator it_id = m_idIndex.find(pClientItem->m_clientID);
+  if ((it_id == m_idIndex.end()) || (it_id->second != pClientItem)) {
+    return false;
+  }
+
+  m_idIndex.erase(it_id);
+  m_idBitmap[pClientItem->m_clientID / 64] &= ~(1ULL << (pClientItem->m_clientID % 64));
+
+  pthread_mutex_lock(&m_mutexGuidIndex);
+  removeFromGuidIndex(pClientItem);
+  pthread_mutex_unlock(&m_mutexGuidIndex);
+
+  // Take away the node, search from the back as short lived clients
+  // are the most recently added
+  for (std::deque<CClientItem *>::reverse_iterator it = m_itemList.rbegin(); it != m_itemList.rend(); ++it) {
     if (*it == pClientItem) {
-      m_itemList.erase(it);
-      delete pClientItem;
-      return true;
+      m_itemList.erase(std::next(it).base());
+      break;
     }
   }
 
-  return false;
+  delete pClientItem;
+  return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// removeAllClients
+//
+
 bool
 CClientList::removeAllClients()
 {
-  pthread_mutex_lock(&m_mutexItemList);
+  pthread_rwlock_wrlock(&m_rwlockItemList);
+
   // Empty the client list
-  std::deque<CClientItem *>::iterator it;
-  for (it = m_itemList.begin(); it != m_itemList.end(); ++it) {
-    removeClient(*it);
-    delete *it;
+  while (!m_itemList.empty()) {
+    CClientItem *pItem = m_itemList.back();
+    if (!removeClient(pItem)) {
+      // Not indexed, just drop it
+      m_itemList.pop_back();
+      delete pItem;
+    }
   }
-  m_itemList.clear();
-  pthread_mutex_unlock(&m_mutexItemList);
+
+  m_idIndex.clear();
+  m_idBitmap.assign((CLIENT_LIST_MAX_ID + 1) / 64, 0);
+  m_idBitmap[0] |= 1;
+
+  pthread_mutex_lock(&m_mutexGuidIndex);
+  m_guidIndex.clear();
+  pthread_mutex_unlock(&m_mutexGuidIndex);
+
+  pthread_rwlock_unlock(&m_rwlockItemList);
 
   return true;
 }
@@ -428,19 +500,12 @@ CClientList::removeAllClients()
 CClientItem *
 CClientList::getClientFromId(uint16_t id)
 {
-  std::deque<CClientItem *>::iterator it;
-  CClientItem *returnItem = NULL;
-
-  for (it = m_itemList.begin(); it != m_itemList.end(); ++it) {
-
-    CClientItem *pItem = *it;
-    if (pItem->m_clientID == id) {
-      returnItem = pItem;
-      break;
-    }
+  std::unordered_map<uint16_t, CClientItem *>::iterator it = m_idIndex.find(id);
+  if (it == m_idIndex.end()) {
+    return NULL;
   }
 
-  return returnItem;
+  return it->second;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -468,21 +533,95 @@ CClientList::getClientFromOrdinal(uint16_t ordinal)
 CClientItem *
 CClientList::getClientFromGUID(cguid &guid)
 {
-  std::deque<CClientItem *>::iterator it;
   CClientItem *returnItem = NULL;
 
-  for (it = m_itemList.begin(); it != m_itemList.end(); ++it) {
+  pthread_mutex_lock(&m_mutexGuidIndex);
 
-    CClientItem *pItem = *it;
-    if (pItem->m_guid == guid) {
-      returnItem = pItem;
-      break;
-    }
+  std::unordered_map<std::string, std::vector<CClientItem *>>::iterator it = m_guidIndex.find(guidKey(guid));
+  if ((it != m_guidIndex.end()) && !it->second.empty()) {
+    returnItem = it->second.front();
   }
 
+  pthread_mutex_unlock(&m_mutexGuidIndex);
+
   return returnItem;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// setClientGUID
+//
+
+bool
+CClientList::setClientGUID(CClientItem *pClientItem, const cguid &guid)
+{
+  // Check pointer
+  if (NULL == pClientItem) {
+    return false;
+  }
+
+  pthread_mutex_lock(&m_mutexGuidIndex);
+
+  // Re-index only if the client is indexed (i.e. in the list)
+  bool bIndexed = removeFromGuidIndex(pClientItem);
+
+  pClientItem->m_guid = guid;
+
+  if (bIndexed) {
+    addToGuidIndex(pClientItem);
+  }
+
+  pthread_mutex_unlock(&m_mutexGuidIndex);
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// removeFromGuidIndex
+//
+
+bool
+CClientList::removeFromGuidIndex(CClientItem *pClientItem)
+{
+  std::unordered_map<std::string, std::vector<CClientItem *>>::iterator it =
+    m_guidIndex.find(guidKey(pClientItem->m_guid));
+  if (it == m_guidIndex.end()) {
+    return false;
+  }
+
+  std::vector<CClientItem *>::iterator it_item = std::find(it->second.begin(), it->second.end(), pClientItem);
+  if (it_item == it->second.end()) {
+    return false;
+  }
+
+  it->second.erase(it_item);
+
+  if (it->second.empty()) {
+    m_guidIndex.erase(it);
+  }
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// addToGuidIndex
+//
+// Clients normally get appended, a client that changes GUID is put back
+// at its place in the list.
+//
+
+void
+CClientList::addToGuidIndex(CClientItem *pClientItem)
+{
+  std::vector<CClientItem *> &items = m_guidIndex[guidKey(pClientItem->m_guid)];
+
+  std::vector<CClientItem *>::iterator it = items.end();
+  while ((it != items.begin()) && ((*(it - 1))->m_listOrder > pClientItem->m_listOrder)) {
+    --it;
+  }
+
+  items.insert(it, pClientItem);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // getAllInterfacesAsString
 //
@@ -492,7 +631,7 @@ CClientList::getAllClientsAsString(void)
 {
   std::string str;
 
-  pthread_mutex_lock(&m_mutexItemList);
+  pthread_rwlock_rdlock(&m_rwlockItemList);
 
   std::deque<CClientItem *>::iterator it;
   for (it = m_itemList.begin(); it != m_itemList.end(); ++it) {
@@ -501,7 +640,7 @@ CClientList::getAllClientsAsString(void)
     str += "\r\n";
   }
 
-  pthread_mutex_unlock(&m_mutexItemList);
+  pthread_rwlock_unlock(&m_rwlockItemList);
 
   return str;
 }
@@ -551,6 +690,7 @@ CClientList::sendEventToClient(CClientItem *pClientItem, const vscpEvent *pEvent
 
   // Check if filtered out - if so do nothing here
   if (!vscp_doLevel2Filter(pEvent, &pClientItem->m_filter)) {
+    VSCP_METRIC_COUNT("vscp_client_filter_reject_total", "Events filtered out by client filters");
     spdlog::debug("sendEventToClient - Filtered out");
     return false;
   }
@@ -563,6 +703,7 @@ CClientList::sendEventToClient(CClientItem *pClientItem, const vscpEvent *pEvent
     spdlog::info("sendEventToClient - overrun");
     // Overrun
     pClientItem->m_statistics.cntOverruns++;
+    VSCP_METRIC_COUNT("vscp_client_queue_overrun_total", "Events dropped on full client input queues");
     return false;
   }
 
@@ -581,6 +722,7 @@ CClientList::sendEventToClient(CClientItem *pClientItem, const vscpEvent *pEvent
     pthread_mutex_lock(&pClientItem->m_mutexClientInputQueue);
     pClientItem->m_clientInputQueue.push_back(pnewvscpEvent);
     pthread_mutex_unlock(&pClientItem->m_mutexClientInputQueue);
+    VSCP_METRIC_COUNT("vscp_client_queue_push_total", "Events added to client input queues");
 #ifdef WIN32
     ReleaseSemaphore(pClientItem->m_semClientInputQueue, 1, NULL);
 #else
@@ -606,16 +748,16 @@ CClientList::sendEventAllClients(const vscpEvent *pEvent, uint32_t excludeID)
     return false;
   }
 
-  pthread_mutex_lock(&m_mutexItemList);
+  pthread_rwlock_rdlock(&m_rwlockItemList);
   for (it = m_itemList.begin(); it != m_itemList.end(); ++it) {
     pClientItem = *it;
 
     if ((NULL != pClientItem) && (excludeID != pClientItem->m_clientID)) {
-      spdlog::debug("Send event to client [{}]", pClientItem->m_strDeviceName);
+      VSCP_LOG_DEBUG("Send event to client [{}]", pClientItem->m_strDeviceName);
       if (!sendEventToClient(pClientItem, pEvent)) {}
     }
   }
-  pthread_mutex_unlock(&m_mutexItemList);
+  pthread_rwlock_unlock(&m_rwlockItemList);
 
   return true;
 }
\ No newline at end of file
@@ -35,6 +35,9 @@
 #endif
 
 #include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <pthread.h>
 
@@ -82,6 +85,12 @@ enum {
 // UDP interface.
 #define CLIENT_ITEM_SPECIAL_ID_UDP 0xffffffff
 
+// Number of cached send permission decisions per client (power of two)
+#define CLIENT_ITEM_SEND_PERM_CACHE_SIZE 16
+
+// Client id's are 16-bit, zero is never used
+#define CLIENT_LIST_MAX_ID 0xffff
+
 /*!
     Client Item
 */
@@ -130,6 +139,16 @@ public:
   */
   std::string getAsString(void);
 
+  /*!
+      Check if the user of this client is allowed to send an event.
+      Decisions are cached per connection and the cache is dropped
+      when the user item or its permissions change.
+      @param vscp_class VSCP class to test.
+      @param vscp_type VSCP type to test.
+      @return true if the client is allowed to send the event.
+  */
+  bool isAllowedToSendEvent(uint16_t vscp_class, uint16_t vscp_type);
+
 public:
   // Input Queue (events to this client)
   std::deque<vscpEvent *> m_clientInputQueue;
@@ -153,6 +172,9 @@ public:
   // Client ID for this client item
   uint16_t m_clientID;
 
+  // Position in the client list, set by CClientList::addClient
+  uint64_t m_listOrder;
+
   // Flag for open/closed channel
   bool m_bOpen;
 
@@ -238,6 +260,17 @@ public:
   // pointer ti the user
   CUserItem *m_pUserItem;
 
+  // Cached send permission decisions, see isAllowedToSendEvent
+  struct {
+    bool bValid;
+    bool bAllowed;
+    uint32_t key; // (class << 16) | type
+  } m_sendPermCache[CLIENT_ITEM_SEND_PERM_CACHE_SIZE];
+
+  // User item and permission generation the cache is valid for
+  CUserItem *m_pSendPermCacheUser;
+  uint32_t m_sendPermCacheGeneration;
+
   // Read buffer
   std::string m_readBuffer;
 
@@ -263,9 +296,22 @@ public:
   /// Destructor
   virtual ~CClientList();
 
+  /*
+      Locking
+
+      m_rwlockItemList protects m_itemList and the id index. Take it
+      for writing around addClient/removeClient and for reading when
+      iterating m_itemList or looking up clients. Readers (event
+      fan-out, listings) run concurrently.
+
+      The GUID index has its own lock so setClientGUID can be called
+      with or without m_rwlockItemList held.
+  */
+
   /*!
       Find a free client id
-      pid Pointer to uint16_t that return free id.
+      pid Pointer to uint16_t that on entry holds the lowest id to
+        consider and on return the free id.
       @return True if id could be found
   */
   bool findFreeId(uint16_t *pid);
@@ -315,12 +361,23 @@ public:
   CClientItem *getClientFromOrdinal(uint16_t ordinal);
 
   /*!
-      Get Client from GUID
+      Get Client from GUID. If several clients have the GUID the one
+      first in the client list is returned.
       @param guid Guid for the client
       @return A pointer to a cientitem on success or NULL on failure.
   */
   CClientItem *getClientFromGUID(cguid &guid);
 
+  /*!
+      Set the GUID of a client in the list. The GUID of a listed
+      client must be changed with this method so the GUID index is
+      kept up to date.
+      @param pClientItem Client to set GUID for
+      @param guid New GUID
+      @return true on success.
+  */
+  bool setClientGUID(CClientItem *pClientItem, const cguid &guid);
+
   /*!
       Get current number of clients
 
@@ -363,8 +420,39 @@ public:
   // List with clients
   std::deque<CClientItem *> m_itemList;
 
-  // Mutex that protect the list
-  pthread_mutex_t m_mutexItemList;
+  // Reader/writer lock that protect the list
+  pthread_rwlock_t m_rwlockItemList;
+
+private:
+  /*!
+      Remove a client from the GUID index. m_mutexGuidIndex must be held.
+      @param pClientItem Client to remove
+      @return true if the client was indexed
+  */
+  bool removeFromGuidIndex(CClientItem *pClientItem);
+
+  /*!
+      Add a client to the GUID index keeping each GUID's clients in
+      list order. m_mutexGuidIndex must be held.
+      @param pClientItem Client to add
+  */
+  void addToGuidIndex(CClientItem *pClientItem);
+
+  // id -> client
+  std::unordered_map<uint16_t, CClientItem *> m_idIndex;
+
+  // Bitmap with client id's in use, one bit per id
+  std::vector<uint64_t> m_idBitmap;
+
+  // GUID (16 bytes as string) -> clients in list order. Clients may
+  // share GUID.
+  std::unordered_map<std::string, std::vector<CClientItem *>> m_guidIndex;
+
+  // m_listOrder for the next added client
+  uint64_t m_nextListOrder;
+
+  // Protects m_guidIndex
+  pthread_mutex_t m_mutexGuidIndex;
 };
 
 #endif // !defined(CLIENTLIST_H__B0190EE5_E0E8_497F_92A0_A8616296AF3E__INCLUDED_)
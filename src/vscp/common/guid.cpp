@@ -52,20 +52,131 @@
 #include "guid.h"
 #include "vscphelper.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define VSCP_GUID_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define VSCP_GUID_NEON
+#endif
+
 // Helper functions for GUID parsing (inline in implementation)
 namespace {
 
+// Hex digit value, 0xff for characters that are not hex digits
+const uint8_t hexValue[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+const char hexDigits[] = "0123456789ABCDEF";
+
+// Character class expected at each position of "FF:EE:...:00" and the
+// character after it. 1 = hex digit, 2 = colon. For the character after
+// the GUID only the hex digit bit is checked, it must be clear.
+alignas(16) const uint8_t strClass[VSCP_GUID_STRING_BUFFER_SIZE] = {
+    1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1,
+    1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1,
+    2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 0
+};
+
+alignas(16) const uint8_t strCare[VSCP_GUID_STRING_BUFFER_SIZE] = {
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1
+};
+
 inline bool isHexDigit(char c) {
-    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+    return 0xff != hexValue[(uint8_t)c];
 }
 
 inline uint8_t hexToVal(char c) {
-    if (c >= '0' && c <= '9') return c - '0';
-    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
-    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
-    return 0;
+    uint8_t val = hexValue[(uint8_t)c];
+    return (0xff == val) ? 0 : val;
+}
+
+#if defined(VSCP_GUID_SSE2)
+
+// Check 16 characters against the expected character classes and
+// store their nibble values
+inline bool checkChunk(const char *p, const uint8_t *pclass, const uint8_t *pcare, uint8_t *nib) {
+    __m128i c = _mm_loadu_si128((const __m128i *)p);
+
+    // Bytes >= 0x80 are negative and fail both range checks
+    __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                    _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i lc = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i isAlpha = _mm_and_si128(_mm_cmpgt_epi8(lc, _mm_set1_epi8('a' - 1)),
+                                    _mm_cmplt_epi8(lc, _mm_set1_epi8('f' + 1)));
+    __m128i isHex = _mm_or_si128(isDigit, isAlpha);
+    __m128i isColon = _mm_cmpeq_epi8(c, _mm_set1_epi8(':'));
+
+    __m128i cls = _mm_or_si128(_mm_and_si128(isHex, _mm_set1_epi8(1)),
+                               _mm_and_si128(isColon, _mm_set1_epi8(2)));
+    cls = _mm_and_si128(cls, _mm_load_si128((const __m128i *)pcare));
+    if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(cls, _mm_load_si128((const __m128i *)pclass)))) {
+        return false;
+    }
+
+    // Low nibble, plus nine for letters
+    __m128i val = _mm_add_epi8(_mm_and_si128(c, _mm_set1_epi8(0x0f)),
+                               _mm_and_si128(isAlpha, _mm_set1_epi8(9)));
+    _mm_storeu_si128((__m128i *)nib, val);
+    return true;
+}
+
+#elif defined(VSCP_GUID_NEON)
+
+inline bool checkChunk(const char *p, const uint8_t *pclass, const uint8_t *pcare, uint8_t *nib) {
+    uint8x16_t c = vld1q_u8((const uint8_t *)p);
+
+    uint8x16_t isDigit = vandq_u8(vcgeq_u8(c, vdupq_n_u8('0')), vcleq_u8(c, vdupq_n_u8('9')));
+    uint8x16_t lc = vorrq_u8(c, vdupq_n_u8(0x20));
+    uint8x16_t isAlpha = vandq_u8(vcgeq_u8(lc, vdupq_n_u8('a')), vcleq_u8(lc, vdupq_n_u8('f')));
+    uint8x16_t isHex = vorrq_u8(isDigit, isAlpha);
+    uint8x16_t isColon = vceqq_u8(c, vdupq_n_u8(':'));
+
+    uint8x16_t cls = vorrq_u8(vandq_u8(isHex, vdupq_n_u8(1)), vandq_u8(isColon, vdupq_n_u8(2)));
+    cls = vandq_u8(cls, vld1q_u8(pcare));
+    if (0xff != vminvq_u8(vceqq_u8(cls, vld1q_u8(pclass)))) {
+        return false;
+    }
+
+    uint8x16_t val = vaddq_u8(vandq_u8(c, vdupq_n_u8(0x0f)), vandq_u8(isAlpha, vdupq_n_u8(9)));
+    vst1q_u8(nib, val);
+    return true;
+}
+
+#else
+
+inline bool checkChunk(const char *p, const uint8_t *pclass, const uint8_t *pcare, uint8_t *nib) {
+    for (int i = 0; i < 16; i++) {
+        uint8_t val = hexValue[(uint8_t)p[i]];
+        uint8_t cls = (0xff != val) ? 1 : ((':' == p[i]) ? 2 : 0);
+        if ((cls & pcare[i]) != pclass[i]) {
+            return false;
+        }
+        nib[i] = val;
+    }
+    return true;
 }
 
+#endif
+
 inline int countHexDigits(const char *p) {
     int count = 0;
     while (isHexDigit(*p)) {
@@ -194,10 +305,60 @@ cguid::operator[](uint8_t pos)
 void
 cguid::getFromString(const std::string &strGUID)
 {
-    const char *p = strGUID.c_str();
+    getFromString(strGUID.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// parseString
+//
+
+bool
+cguid::parseString(uint8_t *pguid, const char *pszGUID)
+{
+    if ((NULL == pguid) || (NULL == pszGUID)) {
+        return false;
+    }
+
+    // The chunks below read the character after the GUID as well
+    if (strnlen(pszGUID, VSCP_GUID_STRING_LENGTH) < VSCP_GUID_STRING_LENGTH) {
+        return false;
+    }
+
+    uint8_t nib[VSCP_GUID_STRING_BUFFER_SIZE];
+    for (int i = 0; i < VSCP_GUID_STRING_BUFFER_SIZE; i += 16) {
+        if (!checkChunk(pszGUID + i, strClass + i, strCare + i, nib + i)) {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < 16; i++) {
+        pguid[i] = (uint8_t)((nib[3 * i] << 4) | nib[3 * i + 1]);
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getFromString
+//
+
+void
+cguid::getFromString(const char *pszGUID)
+{
+    const char *p = pszGUID;
     int guidIdx = 0;
     bool hasBraces = false;
 
+    if (NULL == p) {
+        clear();
+        return;
+    }
+
+    // Standard form is by far the most common
+    if (parseString(m_guid, p)) {
+        return;
+    }
+
     // Initialize GUID to zeros
     memset(m_guid, 0, 16);
 
@@ -235,13 +396,17 @@ cguid::getFromString(const std::string &strGUID)
                     tempBytes[tempCount++] = (uint8_t)parseHexValue(&p, 2);
                 } else if (hexLen <= 4) {
                     uint16_t val = (uint16_t)parseHexValue(&p, 4);
-                    tempBytes[tempCount++] = (val >> 8) & 0xFF;
-                    tempBytes[tempCount++] = val & 0xFF;
+                    if (tempCount + 2 <= 16) {
+                        tempBytes[tempCount++] = (val >> 8) & 0xFF;
+                        tempBytes[tempCount++] = val & 0xFF;
+                    } else {
+                        tempBytes[tempCount++] = val & 0xFF;
+                    }
                 } else {
                     int bytesToParse = (hexLen + 1) / 2;
                     if (bytesToParse > 4) bytesToParse = 4;
                     uint32_t val = (uint32_t)parseHexValue(&p, bytesToParse * 2);
-                    for (int i = bytesToParse - 1; i >= 0 && tempCount < 16; i--) {
+                    for (int i = bytesToParse - 1; i >= 0 && tempCount + 1 <= 16; i--) {
                         tempBytes[tempCount++] = (val >> (i * 8)) & 0xFF;
                     }
                 }
@@ -274,13 +439,17 @@ cguid::getFromString(const std::string &strGUID)
                 tempBytes[tempCount++] = (uint8_t)parseHexValue(&p, 2);
             } else if (hexLen <= 4) {
                 uint16_t val = (uint16_t)parseHexValue(&p, 4);
-                tempBytes[tempCount++] = (val >> 8) & 0xFF;
-                tempBytes[tempCount++] = val & 0xFF;
+                if (tempCount + 2 <= 16) {
+                    tempBytes[tempCount++] = (val >> 8) & 0xFF;
+                    tempBytes[tempCount++] = val & 0xFF;
+                } else {
+                    tempBytes[tempCount++] = val & 0xFF;
+                }
             } else {
                 int bytesToParse = (hexLen + 1) / 2;
                 if (bytesToParse > 4) bytesToParse = 4;
                 uint32_t val = (uint32_t)parseHexValue(&p, bytesToParse * 2);
-                for (int i = bytesToParse - 1; i >= 0 && tempCount < 16; i--) {
+                for (int i = bytesToParse - 1; i >= 0 && tempCount + 1 <= 16; i--) {
                     tempBytes[tempCount++] = (val >> (i * 8)) & 0xFF;
                 }
             }
@@ -340,42 +509,54 @@ cguid::getFromString(const std::string &strGUID)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// getFromString
+// getFromArray
 //
 
 void
-cguid::getFromString(const char *pszGUID)
+cguid::getFromArray(const uint8_t *pguid)
 {
-    std::string str;
-    str = std::string(pszGUID);
-    getFromString(str);
+    memcpy(m_guid, pguid, 16);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// getFromArray
+// toString
 //
 
 void
-cguid::getFromArray(const uint8_t *pguid)
+cguid::toString(std::string &strGUID)
 {
-    memcpy(m_guid, pguid, 16);
+    char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+    writeString(buf, m_guid);
+    strGUID.assign(buf, VSCP_GUID_STRING_LENGTH);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // toString
 //
 
+const char *
+cguid::toString(char *buf) const
+{
+    writeString(buf, m_guid);
+    return buf;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// writeString
+//
+
 void
-cguid::toString(std::string &strGUID)
+cguid::writeString(char *buf, const uint8_t *pguid)
 {
-    char buf[48];
-    snprintf(buf, sizeof(buf),
-             "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-             m_guid[0], m_guid[1], m_guid[2], m_guid[3],
-             m_guid[4], m_guid[5], m_guid[6], m_guid[7],
-             m_guid[8], m_guid[9], m_guid[10], m_guid[11],
-             m_guid[12], m_guid[13], m_guid[14], m_guid[15]);
-    strGUID = buf;
+    char *p = buf;
+    for (int i = 0; i < 16; i++) {
+        *p++ = hexDigits[pguid[i] >> 4];
+        *p++ = hexDigits[pguid[i] & 0x0f];
+        *p++ = ':';
+    }
+
+    // Last colon becomes the terminating zero
+    buf[VSCP_GUID_STRING_LENGTH] = '\0';
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -421,9 +602,8 @@ cguid::toStringCompact(std::string &strGUID)
         if (i > ffCount) {
             strGUID += ":";
         }
-        char buf[4];
-        snprintf(buf, sizeof(buf), "%02X", m_guid[i]);
-        strGUID += buf;
+        strGUID += hexDigits[m_guid[i] >> 4];
+        strGUID += hexDigits[m_guid[i] & 0x0f];
     }
 }
 
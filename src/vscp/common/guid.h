@@ -43,6 +43,13 @@
 
 #include <vscp.h>
 
+// Length of a GUID on standard string form "FF:EE:...:00"
+#define VSCP_GUID_STRING_LENGTH 47
+
+// Buffer size needed for a GUID on standard string form, including
+// the terminating zero
+#define VSCP_GUID_STRING_BUFFER_SIZE (VSCP_GUID_STRING_LENGTH + 1)
+
 // GUID
 class cguid
 {
@@ -107,6 +114,21 @@ class cguid
     */
     void getFromString(const char *pszGUID);
 
+    /*!
+        Parse a GUID on standard string form "FF:EE:...:00" (upper or
+        lower case hex, two digits per byte) without allocating. This is
+        the fast path used by getFromString. Anything else, including a
+        hex digit directly after the last byte, is rejected and must go
+        through getFromString.
+        @param pguid Pointer to 16 byte array that will get the GUID.
+                Left untouched on failure.
+        @param pszGUID Zero terminated string. At least
+                VSCP_GUID_STRING_BUFFER_SIZE bytes are read unless the
+                terminating zero comes first.
+        @return true if the string was on standard form and parsed.
+    */
+    static bool parseString(uint8_t *pguid, const char *pszGUID);
+
     /*!
         Set GUID from array
         @param pguid Pointer to array that holds 16 GUID bytes on
@@ -127,6 +149,21 @@ class cguid
     */
     std::string toString(void);
 
+    /*!
+        GUID to string without allocating
+        @param buf Buffer of at least VSCP_GUID_STRING_BUFFER_SIZE bytes
+        @return Pointer to buf
+    */
+    const char *toString(char *buf) const;
+
+    /*!
+        Write a GUID on standard string form "FF:EE:...:00"
+        @param buf Buffer of at least VSCP_GUID_STRING_BUFFER_SIZE bytes
+                that will get the zero terminated string.
+        @param pguid Pointer to 16 byte GUID
+    */
+    static void writeString(char *buf, const uint8_t *pguid);
+
     /*!
         GUID to string in compact form using :: for leading 0xFF bytes
         @param strGUID String that will receive GUID
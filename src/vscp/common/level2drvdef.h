@@ -39,6 +39,9 @@ typedef int ( __stdcall * LPFNDLL_VSCPWRITE ) ( long handle, const vscpEvent *pE
 typedef int ( __stdcall * LPFNDLL_VSCPREAD ) ( long handle, vscpEvent *pEvent, unsigned long timeout );
 typedef unsigned long ( __stdcall * LPFNDLL_VSCPGETVERSION ) (  void );
 typedef const char *( __stdcall * LPFNDLL_VSCPGETVENDORSTRING ) ( void );
+// Optional. pdata of each received event is allocated by the driver (new[])
+// and released by the caller
+typedef int ( __stdcall * LPFNDLL_VSCPREADBATCH ) ( long handle, vscpEvent *pEvents, unsigned int count, unsigned int *pReceived, unsigned long timeout );
 
 #else
 
@@ -48,6 +51,9 @@ typedef int ( *LPFNDLL_VSCPWRITE ) ( long handle, const vscpEvent *pEvent, unsig
 typedef int ( *LPFNDLL_VSCPREAD ) ( long handle, vscpEvent *pEvent, unsigned long timeout );
 typedef unsigned long ( *LPFNDLL_VSCPGETVERSION ) (  void );
 typedef const char *( *LPFNDLL_VSCPGETVENDORSTRING ) ( void );
+// Optional. pdata of each received event is allocated by the driver (new[])
+// and released by the caller
+typedef int ( *LPFNDLL_VSCPREADBATCH ) ( long handle, vscpEvent *pEvents, unsigned int count, unsigned int *pReceived, unsigned long timeout );
 
 #endif
 
@@ -68,9 +68,9 @@ MulticastObj::~MulticastObj()
 {
     if (NULL != m_pClientItem) {
         // Add the client to the Client List
-        pthread_mutex_lock(&m_pObj->m_clientList.m_mutexItemList);
+        pthread_rwlock_wrlock(&m_pObj->m_clientList.m_rwlockItemList);
         m_pObj->removeClient(m_pClientItem);
-        pthread_mutex_unlock(&m_pObj->m_clientList.m_mutexItemList);
+        pthread_rwlock_unlock(&m_pObj->m_clientList.m_rwlockItemList);
     }
 }
 
@@ -570,16 +570,16 @@ multicastClientThread(void *pData)
        m_pClientItem->m_pUserItem = NULL;  // No user defined
 
        // Add the client to the Client List
-       pthread_mutex_lock(&m_pObj->m_clientList.m_mutexItemList);
+       pthread_rwlock_wrlock(&m_pObj->m_clientList.m_rwlockItemList);
        if ( !m_pObj->addClient( m_pClientItem, CLIENT_ID_MULTICAST_SRV ) ) {
            // Failed to add client
            delete m_pClientItem;
            m_pClientItem = NULL;
-           pthread_mutex_unlock(&m_pObj->m_clientList.m_mutexItemList);
+           pthread_rwlock_unlock(&m_pObj->m_clientList.m_rwlockItemList);
            syslog( LOG_ERR, ("Multicat client: Failed to add client. Terminating
        thread.") ); return NULL;
        }
-       pthread_mutex_unlock(&m_pObj->m_clientList.m_mutexItemList);
+       pthread_rwlock_unlock(&m_pObj->m_clientList.m_rwlockItemList);
 
        // Set receive filter
        memcpy( &m_pClientItem->m_filter, &m_pChannel->m_rxFilter,
@@ -587,7 +587,7 @@ multicastClientThread(void *pData)
 
        // Set GUID for channel
        if ( !m_pChannel->m_guid.isNULL() ) {
-           m_pClientItem->m_guid = m_pChannel->m_guid;
+           m_pObj->m_clientList.setClientGUID(m_pClientItem, m_pChannel->m_guid);
        }
 
        while ( !TestDestroy() && !m_bQuit ) {
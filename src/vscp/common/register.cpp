@@ -31,6 +31,8 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <set>
@@ -513,149 +515,475 @@ vscp_scanForDevices(CVscpClient &client,
                     std::set<uint16_t> &found,
                     std::function<void(int)> statusCallback,
                     uint32_t timeout)
+{
+  CVscpNodeScanner scanner(client, guidIf);
+
+  // Classic behaviour: listen for the full timeout
+  scanner.setAdaptive(false);
+
+  return scanner.scanFast(found, timeout, statusCallback);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  vscp_scanSlowForDevices
+//
+
+int
+vscp_scanSlowForDevices(CVscpClient &client,
+                        cguid &guidIf,
+                        std::set<uint16_t> &search_nodes,
+                        std::set<uint16_t> &found_nodes,
+                        std::function<void(int)> statusCallback,
+                        uint32_t delay,
+                        uint32_t timeout)
+{
+  CVscpNodeScanner scanner(client, guidIf);
+
+  // Classic behaviour: send all probes, wait timeout for answers
+  scanner.setAdaptive(false);
+  scanner.setWindow(0);
+  scanner.setRetries(0);
+
+  return scanner.scanSlow(search_nodes, found_nodes, delay, timeout, statusCallback);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  vscp_scanSlowForDevices
+//
+
+int
+vscp_scanSlowForDevices(CVscpClient &client,
+                        cguid &guid,
+                        uint8_t start_node,
+                        uint8_t end_node,
+                        std::set<uint16_t> &found_nodes,
+                        std::function<void(int)> statusCallback,
+                        uint32_t delay,
+                        uint32_t timeout)
+{
+  std::set<uint16_t> search_nodes;
+
+  for (int i = start_node; i <= end_node; i++) {
+    search_nodes.insert(i);
+  }
+
+  return vscp_scanSlowForDevices(client, guid, search_nodes, found_nodes, statusCallback, delay, timeout);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//                            CVscpNodeScanner
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// CTor
+//
+
+CVscpNodeScanner::CVscpNodeScanner(CVscpClient &client, cguid &guidIf)
+  : m_client(client)
+{
+  m_guidIf          = guidIf;
+  m_window          = SCANNER_DEFAULT_WINDOW;
+  m_retries         = SCANNER_DEFAULT_RETRIES;
+  m_bAdaptive       = true;
+  m_minProbeTimeout = SCANNER_DEFAULT_MIN_TIMEOUT;
+  m_bCancel         = false;
+  m_bRttValid       = false;
+  m_srtt            = 0;
+  m_rttvar          = 0;
+
+  m_bCallbackMode    = false;
+  m_bSavedActiveEv   = false;
+  m_bSavedActiveEx   = false;
+  m_savedCallbackObj = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DTor
+//
+
+CVscpNodeScanner::~CVscpNodeScanner()
+{
+  detach();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// attach
+//
+
+void
+CVscpNodeScanner::attach(void)
+{
+  m_bCancel = false;
+
+  // The base class setters are used as several clients refuse their own
+  // while connected. Callbacks are called from copies so replacing them
+  // on a live client is safe. The lock makes save and install one step.
+  std::lock_guard<std::recursive_mutex> lock(m_client.m_mutexCallback);
+
+  void *pobj;
+  m_client.getCallbacks(m_savedCallbackEv, m_savedCallbackEx, &pobj);
+
+  // Clients without an installed callback queue events for receiveBlocking
+  if (!m_savedCallbackEv && !m_savedCallbackEx) {
+    m_bCallbackMode = false;
+    return;
+  }
+
+  m_bCallbackMode    = true;
+  m_queue            = std::make_shared<scanQueue>();
+  m_bSavedActiveEv   = (bool) m_savedCallbackEv;
+  m_bSavedActiveEx   = (bool) m_savedCallbackEx;
+  m_savedCallbackObj = pobj;
+
+  std::shared_ptr<scanQueue> queue = m_queue;
+
+  auto push = [queue](const vscpEventEx &ex) {
+    if ((VSCP_CLASS1_PROTOCOL != ex.vscp_class) && (VSCP_CLASS2_LEVEL1_PROTOCOL != ex.vscp_class)) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->events.size() < SCANNER_MAX_QUEUE) {
+      queue->events.push_back(ex);
+    }
+    queue->cv.notify_one();
+  };
+
+  // Hook the callback the client actually calls and chain to the
+  // application callback
+  if (m_bSavedActiveEv) {
+    auto saved = m_savedCallbackEv;
+    m_client.CVscpClient::setCallbackEv(
+      [push, saved](vscpEvent &ev, void *pobj) {
+        vscpEventEx ex;
+        if (vscp_convertEventToEventEx(&ex, &ev)) {
+          push(ex);
+        }
+        saved(ev, pobj);
+      },
+      m_savedCallbackObj);
+  }
+  else {
+    auto saved = m_savedCallbackEx;
+    m_client.CVscpClient::setCallbackEx(
+      [push, saved](vscpEventEx &ex, void *pobj) {
+        push(ex);
+        saved(ex, pobj);
+      },
+      m_savedCallbackObj);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// detach
+//
+
+void
+CVscpNodeScanner::detach(void)
+{
+  if (!m_bCallbackMode) {
+    return;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(m_client.m_mutexCallback);
+
+  if (m_bSavedActiveEv) {
+    m_client.CVscpClient::setCallbackEv(m_savedCallbackEv, m_savedCallbackObj);
+  }
+  else {
+    m_client.CVscpClient::setCallbackEx(m_savedCallbackEx, m_savedCallbackObj);
+  }
+  m_client.setCallbackEvActive(m_bSavedActiveEv);
+  m_client.setCallbackExActive(m_bSavedActiveEx);
+
+  m_bCallbackMode = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// waitEvent
+//
+
+int
+CVscpNodeScanner::waitEvent(vscpEventEx &ex, uint32_t wait)
+{
+  if (m_bCallbackMode) {
+    std::unique_lock<std::mutex> lock(m_queue->mutex);
+    if (!m_queue->cv.wait_for(lock, std::chrono::milliseconds(wait), [this] {
+          return !m_queue->events.empty();
+        })) {
+      return VSCP_ERROR_TIMEOUT;
+    }
+    ex = m_queue->events.front();
+    m_queue->events.pop_front();
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  uint32_t start = vscp_getMsTimeStamp();
+  int rv         = m_client.receiveBlocking(ex, (long) wait);
+  if ((VSCP_ERROR_SUCCESS == rv) || (VSCP_ERROR_TIMEOUT == rv)) {
+    return rv;
+  }
+
+  // Some clients can't block. Don't spin on them.
+  if ((vscp_getMsTimeStamp() - start) < 1) {
+#ifdef WIN32
+    win_usleep(1000);
+#else
+    usleep(1000);
+#endif
+  }
+
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// updateRtt
+//
+
+void
+CVscpNodeScanner::updateRtt(uint32_t rtt)
+{
+  if (!m_bRttValid) {
+    m_bRttValid = true;
+    m_srtt      = rtt;
+    m_rttvar    = rtt / 2;
+    return;
+  }
+
+  uint32_t delta = (m_srtt > rtt) ? (m_srtt - rtt) : (rtt - m_srtt);
+  m_rttvar       = (3 * m_rttvar + delta) / 4;
+  m_srtt         = (7 * m_srtt + rtt) / 8;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getProbeTimeout
+//
+
+uint32_t
+CVscpNodeScanner::getProbeTimeout(uint32_t maxTimeout)
+{
+  // No samples yet or not adaptive - use the full timeout
+  if (!m_bAdaptive || !m_bRttValid) {
+    return maxTimeout;
+  }
+
+  uint32_t rto = m_srtt + std::max<uint32_t>(1, 4 * m_rttvar);
+  if (rto < m_minProbeTimeout) {
+    rto = m_minProbeTimeout;
+  }
+  if (rto > maxTimeout) {
+    rto = maxTimeout;
+  }
+
+  return rto;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// reportFound
+//
+
+void
+CVscpNodeScanner::reportFound(uint16_t nodeid, uint32_t rtt)
+{
+  if (nullptr != m_foundCallback) {
+    m_foundCallback(nodeid, rtt);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// scanFast
+//
+
+int
+CVscpNodeScanner::scanFast(std::set<uint16_t> &found, uint32_t timeout, std::function<void(int)> statusCallback)
 {
   int rv         = VSCP_ERROR_SUCCESS;
-  uint8_t offset = guidIf.isNULL() ? 0 : 16;
+  uint8_t offset = m_guidIf.isNULL() ? 0 : 16;
   vscpEventEx ex;
 
   memset(&ex, 0, sizeof(vscpEventEx));
-  ex.vscp_class = VSCP_CLASS1_PROTOCOL + (guidIf.isNULL() ? 0 : 512);
+  ex.vscp_class = VSCP_CLASS1_PROTOCOL + (m_guidIf.isNULL() ? 0 : 512);
   ex.vscp_type  = VSCP_TYPE_PROTOCOL_WHO_IS_THERE;
 
   memset(ex.GUID, 0, 16); // Use GUID of interface
   ex.sizeData         = 1 + offset;
   ex.data[0 + offset] = 0xff; // all devices
 
-  if (!guidIf.isNULL()) {
-    memcpy(ex.data + offset, guidIf.getGUID(), 16); // Use GUID of interface
+  if (!m_guidIf.isNULL()) {
+    memcpy(ex.data, m_guidIf.getGUID(), 16); // Use GUID of interface
   }
 
   // Clear input queue
-  if (VSCP_ERROR_SUCCESS != (rv = client.clear())) {
+  if (VSCP_ERROR_SUCCESS != (rv = m_client.clear())) {
     return rv;
   }
 
-  if (VSCP_ERROR_SUCCESS != (rv = client.send(ex))) {
+  attach();
+
+  if (VSCP_ERROR_SUCCESS != (rv = m_client.send(ex))) {
+    detach();
     return rv;
   }
 
   uint32_t startTime    = vscp_getMsTimeStamp();
-  uint32_t callbackTime = vscp_getMsTimeStamp();
+  uint32_t callbackTime = startTime;
+  uint32_t lastFound    = 0;
+  bool bFound           = false;
 
-  while (true) {
+  while (!m_bCancel) {
 
-    uint16_t cnt;
-
-    client.getcount(&cnt);
-    if (cnt) {
-      rv = client.receive(ex);
+    uint32_t now     = vscp_getMsTimeStamp();
+    uint32_t elapsed = now - startTime;
+    if (elapsed >= timeout) {
+      break;
     }
-    if (VSCP_ERROR_SUCCESS == rv) {
-      if (ex.vscp_class == VSCP_CLASS1_PROTOCOL && ex.vscp_type == VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE) {
-        found.insert(ex.GUID[15] + (ex.GUID[14] << 8));
+
+    uint32_t wait = timeout - elapsed;
+
+    // With adaptive timeouts we are done when the bus has been
+    // quiet for a probe timeout after the last new node
+    if (m_bAdaptive && bFound) {
+      uint32_t quiet = getProbeTimeout(timeout);
+      if ((now - lastFound) >= quiet) {
+        break;
       }
+      wait = std::min(wait, quiet - (now - lastFound));
     }
 
-    // Check timeout
-    if ((vscp_getMsTimeStamp() - startTime) > timeout) {
-      rv = VSCP_ERROR_TIMEOUT;
-      break;
+    if (nullptr != statusCallback) {
+      wait = std::min(wait, (uint32_t) SCANNER_STATUS_INTERVAL);
+    }
+
+    if (VSCP_ERROR_SUCCESS == waitEvent(ex, wait)) {
+      if (((VSCP_CLASS1_PROTOCOL == ex.vscp_class) || (VSCP_CLASS2_LEVEL1_PROTOCOL == ex.vscp_class)) &&
+          (VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE == ex.vscp_type)) {
+        uint16_t nodeid = ex.GUID[15] + (ex.GUID[14] << 8);
+        if (found.insert(nodeid).second) {
+          uint32_t rtt = vscp_getMsTimeStamp() - startTime;
+          updateRtt(rtt);
+          reportFound(nodeid, rtt);
+          lastFound = vscp_getMsTimeStamp();
+          bFound    = true;
+        }
+      }
     }
 
     /*!
       if a callback is defined call it every half second
-      and report presentage of operation complete
+      and report number of found nodes
     */
     if (nullptr != statusCallback) {
-      if ((vscp_getMsTimeStamp() - callbackTime) > 500) {
-        statusCallback((int)found.size());
+      if ((vscp_getMsTimeStamp() - callbackTime) >= SCANNER_STATUS_INTERVAL) {
+        statusCallback((int) found.size());
         callbackTime = vscp_getMsTimeStamp();
       }
     }
-
-#ifdef WIN32
-    win_usleep(100);
-#else
-    usleep(100);
-#endif
   }
+
+  detach();
   return VSCP_ERROR_SUCCESS;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-//  vscp_scanSlowForDevices
+// scanSlow
 //
 
 int
-vscp_scanSlowForDevices(CVscpClient &client,
-                        cguid &guidIf,
-                        std::set<uint16_t> &search_nodes,
-                        std::set<uint16_t> &found_nodes,
-                        std::function<void(int)> statusCallback,
-                        uint32_t delay,
-                        uint32_t timeout)
+CVscpNodeScanner::scanSlow(const std::set<uint16_t> &search_nodes,
+                           std::set<uint16_t> &found_nodes,
+                           uint32_t delay,
+                           uint32_t timeout,
+                           std::function<void(int)> statusCallback)
 {
-  uint8_t offset = guidIf.isNULL() ? 0 : 16;
   int rv         = VSCP_ERROR_SUCCESS;
+  uint8_t offset = m_guidIf.isNULL() ? 0 : 16;
   vscpEventEx ex;
-  //CVscpClient::connType conntype = client.getType();
+  vscpEventEx probe;
 
-  memset(&ex, 0, sizeof(vscpEventEx));
-  ex.vscp_class = VSCP_CLASS1_PROTOCOL + (guidIf.isNULL() ? 0 : 512);
-  ex.vscp_type  = VSCP_TYPE_PROTOCOL_READ_REGISTER;
+  // Probe send time and number of sends
+  struct probeState {
+    uint32_t sent;
+    uint8_t tries;
+  };
+
+  std::deque<uint16_t> pending(search_nodes.begin(), search_nodes.end());
+  std::map<uint16_t, probeState> inflight;
+  std::map<uint16_t, uint8_t> tries;
+  size_t resolved = 0;
 
-  if (!guidIf.isNULL()) {
-    memcpy(ex.data, guidIf.getGUID(), 16);
+  if (search_nodes.empty()) {
+    return VSCP_ERROR_SUCCESS;
   }
 
-  memset(ex.GUID, 0, 16); // Use GUID of interface
-  ex.sizeData = 2 + offset;
+  memset(&probe, 0, sizeof(vscpEventEx));
+  probe.vscp_class = VSCP_CLASS1_PROTOCOL + (m_guidIf.isNULL() ? 0 : 512);
+  probe.vscp_type  = VSCP_TYPE_PROTOCOL_READ_REGISTER;
+
+  if (!m_guidIf.isNULL()) {
+    memcpy(probe.data, m_guidIf.getGUID(), 16);
+  }
+
+  memset(probe.GUID, 0, 16); // Use GUID of interface
+  probe.sizeData = 2 + offset;
 
   // Clear input queue
-  if (VSCP_ERROR_SUCCESS != (rv = client.clear())) {
+  if (VSCP_ERROR_SUCCESS != (rv = m_client.clear())) {
     return rv;
   }
 
-  // Send reads (First byte of GUID)
-  for (auto const &idx : search_nodes) {
+  attach();
 
-    ex.data[0 + offset] = (uint8_t)idx;  // nodeid
-    ex.data[1 + offset] = 0xd0; // register: First byte of GUID
+  uint32_t callbackTime = vscp_getMsTimeStamp();
 
-    rv = client.send(ex);
-    if (VSCP_ERROR_SUCCESS != rv) {
-      return rv;
-    }
+  while (!m_bCancel) {
 
-#ifdef WIN32
-    win_usleep(delay);
-#else
-    usleep(delay);
-#endif
-  }
+    // Fill the probe window
+    while (!pending.empty() && (!m_window || (inflight.size() < m_window))) {
 
-  uint32_t startTime    = vscp_getMsTimeStamp();
-  uint32_t callbackTime = vscp_getMsTimeStamp();
+      uint16_t idx = pending.front();
+      pending.pop_front();
 
-  while (true) {
+      probe.data[0 + offset] = (uint8_t) idx; // nodeid
+      probe.data[1 + offset] = 0xd0;          // register: First byte of GUID
+
+      if (VSCP_ERROR_SUCCESS != (rv = m_client.send(probe))) {
+        detach();
+        return rv;
+      }
 
-    uint16_t cnt;
+      inflight[idx] = { vscp_getMsTimeStamp(), ++tries[idx] };
 
-    rv = client.getcount(&cnt);
+      if (delay) {
+#ifdef WIN32
+        win_usleep(delay);
+#else
+        usleep(delay);
+#endif
+      }
+    }
 
-    if (cnt) {
-      // printf("cnt %d\n", (int) cnt);
-      rv = client.receive(ex);
-      if (VSCP_ERROR_SUCCESS == rv) {
-        if ((ex.vscp_class == VSCP_CLASS1_PROTOCOL) && (ex.vscp_type == VSCP_TYPE_PROTOCOL_RW_RESPONSE)) {
-          // printf("found %d:%d\n", ex.GUID[14], ex.GUID[15]);
-          found_nodes.insert(ex.GUID[15] + (ex.GUID[14] << 8));
+    // Expire probes that has not been answered
+    uint32_t now  = vscp_getMsTimeStamp();
+    uint32_t rto  = getProbeTimeout(timeout);
+    uint32_t wait = rto;
+    for (auto it = inflight.begin(); it != inflight.end();) {
+      uint32_t age = now - it->second.sent;
+      if (age >= rto) {
+        if (it->second.tries <= m_retries) {
+          pending.push_front(it->first);
         }
-        else if ((ex.vscp_class == VSCP_CLASS2_LEVEL1_PROTOCOL) && (ex.vscp_type == VSCP_TYPE_PROTOCOL_RW_RESPONSE)) {
-          // printf("xfound %d:%d\n", ex.GUID[14], ex.GUID[15]);
-          found_nodes.insert(ex.GUID[15] + (ex.GUID[14] << 8));
+        else {
+          resolved++;
         }
+        it = inflight.erase(it);
       }
+      else {
+        wait = std::min(wait, rto - age);
+        ++it;
+      }
+    }
+
+    if (inflight.empty() && pending.empty()) {
+      break;
     }
 
     // If all nodes found we are done
@@ -663,9 +991,40 @@ vscp_scanSlowForDevices(CVscpClient &client,
       break;
     }
 
-    if ((vscp_getMsTimeStamp() - startTime) > timeout) {
-      // This is no timout we are just done with slow scan
-      break;
+    // Retries go out directly
+    if (!pending.empty() && (!m_window || (inflight.size() < m_window))) {
+      continue;
+    }
+
+    if (nullptr != statusCallback) {
+      wait = std::min(wait, (uint32_t) SCANNER_STATUS_INTERVAL);
+    }
+
+    if (VSCP_ERROR_SUCCESS == waitEvent(ex, wait)) {
+      if (((VSCP_CLASS1_PROTOCOL == ex.vscp_class) || (VSCP_CLASS2_LEVEL1_PROTOCOL == ex.vscp_class)) &&
+          (VSCP_TYPE_PROTOCOL_RW_RESPONSE == ex.vscp_type)) {
+
+        uint16_t nodeid = ex.GUID[15] + (ex.GUID[14] << 8);
+        auto it         = inflight.find(nodeid);
+        if (inflight.end() == it) {
+          it = inflight.find(ex.GUID[15]);
+        }
+
+        uint32_t rtt = 0;
+        if (inflight.end() != it) {
+          rtt = vscp_getMsTimeStamp() - it->second.sent;
+          // Only samples from first sends are unambiguous (Karn)
+          if (1 == it->second.tries) {
+            updateRtt(rtt);
+          }
+          inflight.erase(it);
+          resolved++;
+        }
+
+        if (found_nodes.insert(nodeid).second) {
+          reportFound(nodeid, rtt);
+        }
+      }
     }
 
     /*!
@@ -673,45 +1032,17 @@ vscp_scanSlowForDevices(CVscpClient &client,
       and report presentage of operation complete
     */
     if (nullptr != statusCallback) {
-      if ((vscp_getMsTimeStamp() - callbackTime) > 500) {
-        statusCallback((100 * (int)found_nodes.size()) / (int)search_nodes.size());
+      if ((vscp_getMsTimeStamp() - callbackTime) >= SCANNER_STATUS_INTERVAL) {
+        statusCallback((int) ((100 * resolved) / search_nodes.size()));
         callbackTime = vscp_getMsTimeStamp();
       }
     }
-
-#ifdef WIN32
-    win_usleep(100);
-#else
-    usleep(100);
-#endif
   }
 
+  detach();
   return VSCP_ERROR_SUCCESS;
 }
 
-///////////////////////////////////////////////////////////////////////////////
-//  vscp_scanSlowForDevices
-//
-
-int
-vscp_scanSlowForDevices(CVscpClient &client,
-                        cguid &guid,
-                        uint8_t start_node,
-                        uint8_t end_node,
-                        std::set<uint16_t> &found_nodes,
-                        std::function<void(int)> statusCallback,
-                        uint32_t delay,
-                        uint32_t timeout)
-{
-  std::set<uint16_t> search_nodes;
-
-  for (int i = start_node; i <= end_node; i++) {
-    search_nodes.insert(i);
-  }
-
-  return vscp_scanSlowForDevices(client, guid, search_nodes, found_nodes, statusCallback, delay, timeout);
-}
-
 // ----------------------------------------------------------------------------
 
 template<typename T>
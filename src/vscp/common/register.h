@@ -28,7 +28,13 @@
 #ifndef _VSCP_REGISTER_H_
 #define _VSCP_REGISTER_H_
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 
 #include <canal.h>
@@ -45,6 +51,12 @@
 #define REGISTER_DEFAULT_TIMEOUT 2000
 #define REGISTER_DEFAULT_DELAY   10000
 
+#define SCANNER_DEFAULT_WINDOW        16   // Outstanding probes in a windowed slow scan
+#define SCANNER_DEFAULT_RETRIES       1    // Resends of a probe that timed out
+#define SCANNER_DEFAULT_MIN_TIMEOUT   50   // Lower limit for adaptive probe timeout (ms)
+#define SCANNER_STATUS_INTERVAL       500  // Status callback interval (ms)
+#define SCANNER_MAX_QUEUE             1024 // Max events buffered in callback mode
+
 class CRegisterPage;
 class CUserRegisters;
 class CStandardRegisters;
@@ -224,6 +236,182 @@ vscp_scanSlowForDevices(CVscpClient &client,
                         uint32_t delay                          = REGISTER_DEFAULT_DELAY,
                         uint32_t timeout                        = REGISTER_DEFAULT_TIMEOUT);
 
+/*!
+    \class CVscpNodeScanner
+    \brief Event driven node discovery
+
+    Discover nodes on a bus without polling the client. The scanner
+    waits in receiveBlocking() when the client queues incoming events
+    and hooks into the installed callback (setCallbackEv/setCallbackEx)
+    when the client delivers events that way. In the latter case the
+    application callback is still called for every event.
+
+    The slow scan keeps a window of outstanding read register probes
+    and uses a per-probe timeout derived from the observed round trip
+    times (RFC 6298 style smoothing). Found nodes are reported one by
+    one through the found callback as they answer.
+*/
+
+class CVscpNodeScanner {
+
+public:
+  /*!
+    Constructor
+    @param client VSCP client over which the communication is carried out.
+    @param guidIf GUID of the interface to search on. If zero no interface
+                is used.
+  */
+  CVscpNodeScanner(CVscpClient &client, cguid &guidIf);
+  ~CVscpNodeScanner();
+
+  /*!
+    Set number of probes that can be outstanding in a slow scan.
+    @param window Max number of unanswered probes. Zero means that all
+                  probes are sent at once (the classic slow scan).
+  */
+  void setWindow(uint16_t window) { m_window = window; };
+
+  /*!
+    Get the probe window
+    @return Max number of unanswered probes.
+  */
+  uint16_t getWindow(void) { return m_window; };
+
+  /*!
+    Set number of times a probe that timed out is resent
+    @param retries Number of resends.
+  */
+  void setRetries(uint8_t retries) { m_retries = retries; };
+
+  /*!
+    Enable/disable adaptive timeouts. When disabled the full timeout given
+    to the scan methods is used for every probe and the fast scan always
+    runs until the timeout has elapsed.
+    @param b Set to true (default) to enable.
+  */
+  void setAdaptive(bool b = true) { m_bAdaptive = b; };
+
+  /*!
+    Set lower limit for the adaptive probe timeout
+    @param timeout Timeout in milliseconds.
+  */
+  void setMinProbeTimeout(uint32_t timeout) { m_minProbeTimeout = timeout; };
+
+  /*!
+    Set callback that is called for each new node found.
+    @param callback Callback void f(uint16_t nodeid, uint32_t rtt) where
+                    rtt is the round trip time in milliseconds.
+  */
+  void setFoundCallback(std::function<void(uint16_t nodeid, uint32_t rtt)> callback) { m_foundCallback = callback; };
+
+  /*!
+    Get smoothed round trip time
+    @return Smoothed round trip time in milliseconds. Zero if
+            no response has been seen yet.
+  */
+  uint32_t getSmoothedRtt(void) { return m_srtt; };
+
+  /*!
+    Get current probe timeout
+    @param maxTimeout Upper limit for the probe timeout in milliseconds.
+    @return Probe timeout in milliseconds.
+  */
+  uint32_t getProbeTimeout(uint32_t maxTimeout);
+
+  /*!
+    Abort an ongoing scan. Safe to call from another thread.
+  */
+  void cancel(void) { m_bCancel = true; };
+
+  /*!
+    Do a fast scan using who is there protocol functionality
+    @param found A set that get nodeid's for found nodes.
+    @param timeout Max time in milliseconds for the scan. With adaptive
+            timeouts the scan ends earlier when no new node has answered
+            for a while.
+    @param statusCallback Optional callback that return status information
+            with found devices (not percentage) void f(int)
+    @return VSCP_ERROR_SUCCESS on success.
+  */
+  int scanFast(std::set<uint16_t> &found,
+               uint32_t timeout                        = REGISTER_DEFAULT_TIMEOUT,
+               std::function<void(int)> statusCallback = nullptr);
+
+  /*!
+    Do a slow scan using read register (first byte of GUID)
+    @param search_nodes A set that contains all nodes to search
+    @param found_nodes A set that get nodeid's for found nodes.
+    @param delay Delay in micro seconds between probes.
+    @param timeout Max time in milliseconds to wait for a probe
+            response.
+    @param statusCallback Optional callback that return status information
+            in percent void f(int)
+    @return VSCP_ERROR_SUCCESS on success.
+  */
+  int scanSlow(const std::set<uint16_t> &search_nodes,
+               std::set<uint16_t> &found_nodes,
+               uint32_t delay                          = REGISTER_DEFAULT_DELAY,
+               uint32_t timeout                        = REGISTER_DEFAULT_TIMEOUT,
+               std::function<void(int)> statusCallback = nullptr);
+
+private:
+  /*!
+    Events delivered by the client callback. Shared with the
+    installed callback so it stays valid if the client calls
+    it after the scan has ended.
+  */
+  struct scanQueue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<vscpEventEx> events;
+  };
+
+  /// Start listening for events
+  void attach(void);
+
+  /// Stop listening for events and restore client callbacks
+  void detach(void);
+
+  /*!
+    Wait for a protocol event
+    @param ex Event that get the result.
+    @param wait Max time to wait in milliseconds.
+    @return VSCP_ERROR_SUCCESS if an event was received.
+  */
+  int waitEvent(vscpEventEx &ex, uint32_t wait);
+
+  /// Feed a new round trip time sample
+  void updateRtt(uint32_t rtt);
+
+  /// Report a new node
+  void reportFound(uint16_t nodeid, uint32_t rtt);
+
+  CVscpClient &m_client;
+  cguid m_guidIf;
+
+  uint16_t m_window;
+  uint8_t m_retries;
+  bool m_bAdaptive;
+  uint32_t m_minProbeTimeout;
+  std::atomic<bool> m_bCancel;
+
+  // Smoothed round trip time and variance (ms)
+  bool m_bRttValid;
+  uint32_t m_srtt;
+  uint32_t m_rttvar;
+
+  std::function<void(uint16_t nodeid, uint32_t rtt)> m_foundCallback;
+
+  // Callback mode state
+  bool m_bCallbackMode;
+  std::shared_ptr<scanQueue> m_queue;
+  std::function<void(vscpEvent &ev, void *pobj)> m_savedCallbackEv;
+  std::function<void(vscpEventEx &ex, void *pobj)> m_savedCallbackEx;
+  bool m_bSavedActiveEv;
+  bool m_bSavedActiveEx;
+  void *m_savedCallbackObj;
+};
+
 /*!
   Get device information on HTML format
   @param mdf Initialized MDF object
@@ -57,6 +57,8 @@
 #include <version.h>
 #include <vscp.h>
 #include <vscp_debug.h>
+#include <vscp-metrics.h>
+#include <vscp-syslog.h>
 #include <vscpdatetime.h>
 #include <vscphelper.h>
 
@@ -143,7 +145,7 @@ tcpipListenThread(void* pData)
 
     tcpipListenThreadObj* pListenObj = (tcpipListenThreadObj*)pData;
     if (NULL == pListenObj) {
-        syslog(
+        VSCP_SYSLOG(
           LOG_ERR,
           "TCP/IP client is missing client object data. Terinating thread.");
         return NULL;
@@ -158,8 +160,8 @@ tcpipListenThread(void* pData)
 
     bool bSecureEndpoints = tcpipHasSecureEndpoint(pListenObj->m_strListeningPort);
     if (bSecureEndpoints && !pObj->m_tcpip_ssl_certificate.length()) {
-        syslog(LOG_ERR,
-               "[TCP/IP srv thread] Secure listening endpoint configured but no TLS certificate configured.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "[TCP/IP srv thread] Secure listening endpoint configured but no TLS certificate configured.");
         return NULL;
     }
 
@@ -201,7 +203,7 @@ tcpipListenThread(void* pData)
     // Init. SSL subsystem (only needed when one or more secure sockets are used)
     if (bSecureEndpoints) {
         if (0 == stcp_init_ssl(pListenObj->m_srvctx.ssl_ctx, &opts)) {
-            syslog(LOG_ERR, "[TCP/IP srv thread] Failed to init. ssl.\n");
+            VSCP_SYSLOG(LOG_ERR, "[TCP/IP srv thread] Failed to init. ssl.\n");
             return NULL;
         }
         pListenObj->m_bTlsInitialized = true;
@@ -212,11 +214,12 @@ tcpipListenThread(void* pData)
     // Bind to selected interface
     if (0 == stcp_listening(&pListenObj->m_srvctx,
                             pListenObj->m_strListeningPort.c_str())) {
-        syslog(LOG_ERR, "[TCP/IP srv thread] Failed to init listening socket.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "[TCP/IP srv thread] Failed to init listening socket.");
         return NULL;
     }
 
-    syslog(LOG_DEBUG, "[TCP/IP srv listen thread] Started.");
+    VSCP_SYSLOG(LOG_DEBUG, "[TCP/IP srv listen thread] Started.");
 
     while (!pListenObj->m_nStopTcpIpSrv) {
 
@@ -245,9 +248,10 @@ tcpipListenThread(void* pData)
 
                     conn = stcp_new_connection(); // Init connection
                     if (NULL == conn) {
-                        syslog(LOG_ERR,
-                               "[TCP/IP srv] -- Memory problem when creating "
-                               "conn object.");
+                        VSCP_SYSLOG(
+                          LOG_ERR,
+                          "[TCP/IP srv] -- Memory problem when creating "
+                          "conn object.");
                         continue;
                     }
 
@@ -259,7 +263,8 @@ tcpipListenThread(void* pData)
                                     &(conn->client))) {
 
                         stcp_init_client_connection(conn, &opts);
-                        syslog(LOG_DEBUG, "[TCP/IP srv] -- Connection accept.");
+                        VSCP_SYSLOG(LOG_DEBUG,
+                                    "[TCP/IP srv] -- Connection accept.");
 
 #ifdef WITH_WRAP
                         /* Use tcpd / libwrap to determine whether a connection
@@ -274,10 +279,10 @@ tcpipListenThread(void* pData)
                         if (!hosts_access(&wrap_req)) {
                             // Access is denied
                             if (!stcp_socket_get_address(conn, address, 1024)) {
-                                syslog(LOG_ERR,
-                                       "Client connection from %s "
-                                       "denied access by tcpd.",
-                                       address);
+                                VSCP_SYSLOG(LOG_ERR,
+                                            "Client connection from %s "
+                                            "denied access by tcpd.",
+                                            address);
                             }
                             stcp_close_connection(conn);
                             conn = NULL;
@@ -289,9 +294,9 @@ tcpipListenThread(void* pData)
                         tcpipClientObj* pClientObj =
                           new tcpipClientObj(pListenObj);
                         if (NULL == pClientObj) {
-                            syslog(LOG_ERR,
-                                   "[TCP/IP srv] -- Memory problem when "
-                                   "creating client thread.");
+                            VSCP_SYSLOG(LOG_ERR,
+                                        "[TCP/IP srv] -- Memory problem when "
+                                        "creating client thread.");
                             stcp_close_connection(conn);
                             conn = NULL;
                             continue;
@@ -300,7 +305,7 @@ tcpipListenThread(void* pData)
                         pClientObj->m_conn    = conn;
                         pClientObj->m_pParent = pListenObj;
 
-                        syslog(
+                        VSCP_SYSLOG(
                           LOG_DEBUG,
                           "Controlobject: Starting client tcp/ip thread...");
 
@@ -309,9 +314,9 @@ tcpipListenThread(void* pData)
                                            NULL,
                                            tcpipClientThread,
                                            pClientObj))) {
-                            syslog(LOG_ERR,
-                                   "[TCP/IP srv] -- Failed to run client "
-                                   "tcp/ip client thread. error=%d", err);
+                            VSCP_SYSLOG(LOG_ERR,
+                                        "[TCP/IP srv] -- Failed to run client "
+                                        "tcp/ip client thread. error=%d", err);
                             delete pClientObj;
                             stcp_close_connection(conn);
                             conn = NULL;
@@ -340,7 +345,7 @@ tcpipListenThread(void* pData)
 
     } // While
 
-    syslog(LOG_DEBUG, "[TCP/IP srv listen thread] Preparing Exit.");
+    VSCP_SYSLOG(LOG_DEBUG, "[TCP/IP srv listen thread] Preparing Exit.");
 
     // Wait for clients to terminate
     int loopCnt = 0;
@@ -389,7 +394,7 @@ tcpipListenThread(void* pData)
         pListenObj->m_bTlsInitialized = false;
     }
 
-    syslog(LOG_DEBUG, "[TCP/IP srv listen thread] Exit.");
+    VSCP_SYSLOG(LOG_DEBUG, "[TCP/IP srv listen thread] Exit.");
 
     return NULL;
 }
@@ -505,14 +510,15 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
     }
 
     if (NULL == m_pObj) {
-        syslog(LOG_ERR,
-               "[TCP/IP srv] ERROR: Control object pointer is NULL in command "
-               "handler.");
+        VSCP_SYSLOG(
+          LOG_ERR,
+          "[TCP/IP srv] ERROR: Control object pointer is NULL in command "
+          "handler.");
         return VSCP_TCPIP_RV_CLOSE; // Close connection
     }
 
     if (NULL == m_pClientItem) {
-        syslog(
+        VSCP_SYSLOG(
           LOG_ERR,
           "[TCP/IP srv] ERROR: ClientItem pointer is NULL in command handler.");
         return VSCP_TCPIP_RV_CLOSE; // Close connection
@@ -547,8 +553,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
                 m_pClientItem->m_timeRcvLoop = time(NULL);
                 handleClientRcvLoop();
             } catch (...) {
-                syslog(LOG_ERR,
-                       "TCPIP: Exception occurred handleClientRcvLoop");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientRcvLoop");
             }
         }
     }
@@ -570,7 +576,7 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientUser();
         } catch (...) {
-            syslog(LOG_ERR, "TCPIP: Exception occurred handleClientUser");
+            VSCP_SYSLOG(LOG_ERR, "TCPIP: Exception occurred handleClientUser");
         }
     }
 
@@ -582,16 +588,17 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
 
         try {
             if (!handleClientPassword()) {
-                syslog(LOG_ERR,
-                       "[TCP/IP srv] Command: Password. Not authorized.");
+                VSCP_SYSLOG(LOG_ERR,
+                            "[TCP/IP srv] Command: Password. Not authorized.");
                 return VSCP_TCPIP_RV_CLOSE; // Close connection
             }
         } catch (...) {
-            syslog(LOG_ERR, "TCPIP: Exception occurred handleClientPassword");
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientPassword");
         }
 
         if (__VSCP_DEBUG_TCP) {
-            syslog(LOG_DEBUG, "[TCP/IP srv] Command: Password. PASS");
+            VSCP_SYSLOG(LOG_DEBUG, "[TCP/IP srv] Command: Password. PASS");
         }
 
     }
@@ -604,7 +611,7 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleChallenge();
         } catch (...) {
-            syslog(LOG_ERR, "TCPIP: Exception occurred handleChallange");
+            VSCP_SYSLOG(LOG_ERR, "TCPIP: Exception occurred handleChallange");
         }
     }
 
@@ -616,7 +623,7 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
              m_pClientItem->CommandStartsWith("exit")) {
 
         if (__VSCP_DEBUG_TCP) {
-            syslog(LOG_INFO, "[TCP/IP srv] Command: Close.");
+            VSCP_SYSLOG(LOG_INFO, "[TCP/IP srv] Command: Close.");
         }
 
         write(MSG_GOODBY, strlen(MSG_GOODBY));
@@ -632,8 +639,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientShutdown();
             } catch (...) {
-                syslog(LOG_ERR,
-                       "TCPIP: Exception occurred handleClientShutdown");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientShutdown");
             }
         }
     }
@@ -647,7 +654,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientSend();
             } catch (...) {
-                syslog(LOG_ERR, "TCPIP: Exception occurred handleClientSend");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientSend");
             }
         }
     }
@@ -662,8 +670,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientReceive();
             } catch (...) {
-                syslog(LOG_ERR,
-                       "TCPIP: Exception occurred handleClientReceive");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientReceive");
             }
         }
     }
@@ -678,8 +686,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientDataAvailable();
         } catch (...) {
-            syslog(LOG_ERR,
-                   "TCPIP: Exception occurred handleClientDataAvailable");
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientDataAvailable");
         }
     }
 
@@ -693,8 +701,9 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientClearInputQueue();
         } catch (...) {
-            syslog(LOG_ERR,
-                   "TCPIP: Exception occurred handleClientClearInputQueue");
+            VSCP_SYSLOG(
+              LOG_ERR,
+              "TCPIP: Exception occurred handleClientClearInputQueue");
         }
     }
 
@@ -706,8 +715,21 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientGetStatistics();
         } catch (...) {
-            syslog(LOG_ERR,
-                   "TCPIP: Exception occurred handleClientGetStatistics");
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientGetStatistics");
+        }
+    }
+
+    //*********************************************************************
+    //                            Get Metrics
+    //*********************************************************************
+
+    else if (m_pClientItem->CommandStartsWith(("metrics"))) {
+        try {
+            handleClientGetMetrics();
+        } catch (...) {
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientGetMetrics");
         }
     }
 
@@ -719,7 +741,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientGetStatus();
         } catch (...) {
-            syslog(LOG_ERR, "TCPIP: Exception occurred handleClientGetStatus");
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientGetStatus");
         }
     }
 
@@ -732,8 +755,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientGetChannelID();
         } catch (...) {
-            syslog(LOG_ERR,
-                   "TCPIP: Exception occurred handleClientGetChannelID");
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientGetChannelID");
         }
     }
 
@@ -747,8 +770,9 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientSetChannelGUID();
             } catch (...) {
-                syslog(LOG_ERR,
-                       "TCPIP: Exception occurred handleClientSetChannelGUID");
+                VSCP_SYSLOG(
+                  LOG_ERR,
+                  "TCPIP: Exception occurred handleClientSetChannelGUID");
             }
         }
     }
@@ -762,8 +786,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientGetChannelGUID();
         } catch (...) {
-            syslog(LOG_ERR,
-                   "TCPIP: Exception occurred handleClientGetChannelGUID");
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientGetChannelGUID");
         }
     }
 
@@ -776,7 +800,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientGetVersion();
         } catch (...) {
-            syslog(LOG_ERR, "TCPIP: Exception occurred handleClientGetVersion");
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientGetVersion");
         }
     }
 
@@ -790,8 +815,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientSetFilter();
             } catch (...) {
-                syslog(LOG_ERR,
-                       "TCPIP: Exception occurred handleClientSetFilter");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientSetFilter");
             }
         }
     }
@@ -806,8 +831,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientSetMask();
             } catch (...) {
-                syslog(LOG_ERR,
-                       "TCPIP: Exception occurred handleClientSetMask");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientSetMask");
             }
         }
     }
@@ -820,7 +845,7 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientHelp();
         } catch (...) {
-            syslog(LOG_ERR, "TCPIP: Exception occurred handleClientHelp");
+            VSCP_SYSLOG(LOG_ERR, "TCPIP: Exception occurred handleClientHelp");
         }
     }
 
@@ -833,8 +858,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientRestart();
             } catch (...) {
-                syslog(LOG_ERR,
-                       "TCPIP: Exception occurred handleClientRestart");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientRestart");
             }
         }
     }
@@ -849,8 +874,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientInterface();
             } catch (...) {
-                syslog(LOG_ERR,
-                       "TCPIP: Exception occurred handleClientInterface");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientInterface");
             }
         }
     }
@@ -864,7 +889,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
             try {
                 handleClientTest();
             } catch (...) {
-                syslog(LOG_ERR, "TCPIP: Exception occurred handleClientTest");
+                VSCP_SYSLOG(LOG_ERR,
+                            "TCPIP: Exception occurred handleClientTest");
             }
         }
     }
@@ -878,8 +904,9 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientCapabilityRequest();
         } catch (...) {
-            syslog(LOG_ERR,
-                   "TCPIP: Exception occurred handleClientCapabilityRequest");
+            VSCP_SYSLOG(
+              LOG_ERR,
+              "TCPIP: Exception occurred handleClientCapabilityRequest");
         }
     }
 
@@ -891,8 +918,8 @@ tcpipClientObj::CommandHandler(std::string& strCommand)
         try {
             handleClientMeasurement();
         } catch (...) {
-            syslog(LOG_ERR,
-                   "TCPIP: Exception occurred handleClientMeasurement");
+            VSCP_SYSLOG(LOG_ERR,
+                        "TCPIP: Exception occurred handleClientMeasurement");
         }
     }
 
@@ -1392,6 +1419,7 @@ void
 tcpipClientObj::handleClientSend(void)
 {
     vscpEvent event;
+    VSCP_METRIC_TIMER("vscp_tcpip_send_ns", "Time to decode and dispatch an event sent by a tcp/ip client");
 
     // Must be connected
     if (STCP_CONN_STATE_CONNECTED != m_conn->conn_state)
@@ -1579,7 +1607,7 @@ tcpipClientObj::handleClientSend(void)
           event.vscp_class,
           event.vscp_type);
 
-        syslog(LOG_ERR, "%s", strErr.c_str());
+        VSCP_SYSLOG(LOG_ERR, "%s", strErr.c_str());
 
         write(MSG_MOT_ALLOWED_TO_SEND_EVENT,
               strlen(MSG_MOT_ALLOWED_TO_SEND_EVENT));
@@ -1603,7 +1631,7 @@ tcpipClientObj::handleClientSend(void)
           event.vscp_class,
           event.vscp_type);
 
-        syslog(LOG_ERR, "%s", strErr.c_str());
+        VSCP_SYSLOG(LOG_ERR, "%s", strErr.c_str());
 
         write(MSG_MOT_ALLOWED_TO_SEND_EVENT,
               strlen(MSG_MOT_ALLOWED_TO_SEND_EVENT));
@@ -1627,7 +1655,7 @@ tcpipClientObj::handleClientSend(void)
           event.vscp_class,
           event.vscp_type);
 
-        syslog(LOG_ERR, "%s", strErr.c_str());
+        VSCP_SYSLOG(LOG_ERR, "%s", strErr.c_str());
 
         write(MSG_MOT_ALLOWED_TO_SEND_EVENT,
               strlen(MSG_MOT_ALLOWED_TO_SEND_EVENT));
@@ -1651,7 +1679,7 @@ tcpipClientObj::handleClientSend(void)
           event.vscp_class,
           event.vscp_type);
 
-        syslog(LOG_ERR, "%s", strErr.c_str());
+        VSCP_SYSLOG(LOG_ERR, "%s", strErr.c_str());
 
         write(MSG_MOT_ALLOWED_TO_SEND_EVENT,
               strlen(MSG_MOT_ALLOWED_TO_SEND_EVENT));
@@ -1665,7 +1693,7 @@ tcpipClientObj::handleClientSend(void)
     }
 
     // Check if this user is allowed to send this event
-    if (!m_pClientItem->m_pUserItem->isUserAllowedToSendEvent(
+    if (!m_pClientItem->isAllowedToSendEvent(
           event.vscp_class,
           event.vscp_type)) {
 
@@ -1676,7 +1704,7 @@ tcpipClientObj::handleClientSend(void)
           event.vscp_class,
           event.vscp_type);
 
-        syslog(LOG_ERR, "%s", strErr.c_str());
+        VSCP_SYSLOG(LOG_ERR, "%s", strErr.c_str());
 
         write(MSG_MOT_ALLOWED_TO_SEND_EVENT,
               strlen(MSG_MOT_ALLOWED_TO_SEND_EVENT));
@@ -1769,8 +1797,12 @@ tcpipClientObj::sendOneEventFromQueue(bool bStatusMsg)
             m_pClientItem->m_clientInputQueue.pop_front();
         }
         pthread_mutex_unlock(&m_pClientItem->m_mutexClientInputQueue);
+        VSCP_METRIC_COUNT("vscp_client_queue_pop_total", "Events taken from client input queues");
 
-        vscp_convertEventToString(strOut, pqueueEvent);
+        {
+            VSCP_METRIC_TIMER("vscp_tcpip_encode_ns", "Time to encode an event for a tcp/ip client");
+            vscp_convertEventToString(strOut, pqueueEvent);
+        }
         strOut += ("\r\n");
         write(strOut.c_str(), strlen(strOut.c_str()));
 
@@ -1877,6 +1909,37 @@ tcpipClientObj::handleClientGetStatistics(void)
     write(outbuf, strlen(outbuf));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// handleClientGetMetrics
+//
+// One metric per line on the Prometheus text format
+//
+
+void
+tcpipClientObj::handleClientGetMetrics(void)
+{
+    // Must be connected
+    if (STCP_CONN_STATE_CONNECTED != m_conn->conn_state)
+        return;
+
+    // Must be accredited to do this
+    if (!m_pClientItem->bAuthenticated) {
+        write(MSG_NOT_ACCREDITED, strlen(MSG_NOT_ACCREDITED));
+        return;
+    }
+
+    std::string metrics = vscpMetrics::getInstance().getAsPrometheus();
+    std::string str;
+    for (size_t i = 0; i < metrics.length(); i++) {
+        if ('\n' == metrics[i]) {
+            str += '\r';
+        }
+        str += metrics[i];
+    }
+    str += MSG_OK;
+    write(str.c_str(), str.length());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // handleClientGetStatus
 //
@@ -1953,7 +2016,9 @@ tcpipClientObj::handleClientSetChannelGUID(void)
 
     vscp_trim(m_pClientItem->m_currentCommand);
 
-    m_pClientItem->m_guid.getFromString(m_pClientItem->m_currentCommand);
+    cguid guid;
+    guid.getFromString(m_pClientItem->m_currentCommand);
+    m_pObj->m_clientList.setClientGUID(m_pClientItem, guid);
     write(MSG_OK, strlen(MSG_OK));
 }
 
@@ -2207,7 +2272,7 @@ tcpipClientObj::handleClientPassword(void)
           (const char*)m_pClientItem->m_UserName.c_str(),
           (const char*)strPassword.c_str());
 
-        syslog(LOG_ERR, "%s", strErr.c_str());
+        VSCP_SYSLOG(LOG_ERR, "%s", strErr.c_str());
         write(MSG_PASSWORD_ERROR, strlen(MSG_PASSWORD_ERROR));
         return false;
     }
@@ -2232,7 +2297,7 @@ tcpipClientObj::handleClientPassword(void)
           vscp_str_format(("[TCP/IP srv] Host [%s] not allowed to connect.\n"),
                           (const char*)remoteaddr.c_str());
 
-        syslog(LOG_ERR, "%s", strErr.c_str());
+        VSCP_SYSLOG(LOG_ERR, "%s", strErr.c_str());
         write(MSG_INVALID_REMOTE_ERROR, strlen(MSG_INVALID_REMOTE_ERROR));
         return false;
     }
@@ -2247,7 +2312,7 @@ tcpipClientObj::handleClientPassword(void)
       (const char*)remoteaddr.c_str(),
       (const char*)m_pClientItem->m_UserName.c_str());
 
-    syslog(LOG_ERR, "%s", strErr.c_str());
+    VSCP_SYSLOG(LOG_ERR, "%s", strErr.c_str());
 
     m_pClientItem->bAuthenticated = true;
     write(MSG_OK, strlen(MSG_OK));
@@ -2339,7 +2404,7 @@ tcpipClientObj::handleClientShutdown(void)
     if (STCP_CONN_STATE_CONNECTED != m_conn->conn_state)
         return;
 
-    syslog(LOG_INFO, "tcp/ip client requested shutdown!!!");
+    VSCP_SYSLOG(LOG_INFO, "tcp/ip client requested shutdown!!!");
 
     if (!m_pClientItem->bAuthenticated) {
         write(MSG_OK, strlen(MSG_OK));
@@ -2404,7 +2469,7 @@ tcpipClientObj::handleClientInterface_List(void)
     std::string strBuf;
 
     // Display Interface List
-    pthread_mutex_lock(&m_pObj->m_clientList.m_mutexItemList);
+    pthread_rwlock_rdlock(&m_pObj->m_clientList.m_rwlockItemList);
 
     std::deque<CClientItem*>::iterator it;
     for (it = m_pObj->m_clientList.m_itemList.begin();
@@ -2428,7 +2493,7 @@ tcpipClientObj::handleClientInterface_List(void)
 
     write(MSG_OK, strlen(MSG_OK));
 
-    pthread_mutex_unlock(&m_pObj->m_clientList.m_mutexItemList);
+    pthread_rwlock_unlock(&m_pObj->m_clientList.m_rwlockItemList);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2517,6 +2582,7 @@ tcpipClientObj::handleClientHelp(void)
                "queue.\r\n";
         str += "CLRA/CLRALL       - Clear input queue.\r\n";
         str += "STAT              - Get statistical information.\r\n";
+        str += "METRICS           - Get runtime metrics.\r\n";
         str += "INFO              - Get status info.\r\n";
         str += "CHID              - Get channel id.\r\n";
         str += "SGID/SETGUID      - Set GUID for channel.\r\n";
@@ -2597,6 +2663,11 @@ tcpipClientObj::handleClientHelp(void)
     } else if (m_pClientItem->CommandStartsWith(("stat"))) {
         std::string str = "'STAT' - Get statistical information.\r\n";
         write((const char*)str.c_str(), str.length());
+    } else if (m_pClientItem->CommandStartsWith(("metrics"))) {
+        std::string str = "'METRICS' - Get runtime metrics, one per line "
+                          "on the Prometheus text format. Collection must "
+                          "be enabled in the configuration.\r\n";
+        write((const char*)str.c_str(), str.length());
     } else if (m_pClientItem->CommandStartsWith("info")) {
         std::string str = "'INFO' - Get status information.\r\n";
         write((const char*)str.c_str(), str.length());
@@ -2678,26 +2749,26 @@ tcpipClientThread(void* pData)
 {
     tcpipClientObj* ptcpipobj = (tcpipClientObj*)pData;
     if (NULL == ptcpipobj) {
-        syslog(LOG_ERR,
-               "[TCP/IP srv client thread] Error, "
-               "Client thread object not initialized.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "[TCP/IP srv client thread] Error, "
+                    "Client thread object not initialized.");
         return NULL;
     }
 
     if (NULL == ptcpipobj->m_pParent) {
-        syslog(LOG_ERR,
-               "[TCP/IP srv client thread] Error, "
-               "Control object not initialized.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "[TCP/IP srv client thread] Error, "
+                    "Control object not initialized.");
         return NULL;
     }
 
-    syslog(LOG_DEBUG, "[TCP/IP srv client thread] Thread started.");
+    VSCP_SYSLOG(LOG_DEBUG, "[TCP/IP srv client thread] Thread started.");
 
     ptcpipobj->m_pClientItem = new CClientItem();
     if (NULL == ptcpipobj->m_pClientItem) {
-        syslog(LOG_ERR,
-               "[TCP/IP srv client thread] Memory error, "
-               "Cant allocate client structure.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "[TCP/IP srv client thread] Memory error, "
+                    "Cant allocate client structure.");
         return NULL;
     }
 
@@ -2714,17 +2785,17 @@ tcpipClientThread(void* pData)
     ptcpipobj->m_pClientItem->m_clientActivity = time(NULL);
 
     // Add the client to the Client List
-    pthread_mutex_lock(&ptcpipobj->m_pObj->m_clientList.m_mutexItemList);
+    pthread_rwlock_wrlock(&ptcpipobj->m_pObj->m_clientList.m_rwlockItemList);
     if (!ptcpipobj->m_pObj->addClient(ptcpipobj->m_pClientItem)) {
         // Failed to add client
         delete ptcpipobj->m_pClientItem;
         ptcpipobj->m_pClientItem = NULL;
-        pthread_mutex_unlock(&ptcpipobj->m_pObj->m_clientList.m_mutexItemList);
-        syslog(LOG_ERR,
-               "TCP/IP server: Failed to add client. Terminating thread.");
+        pthread_rwlock_unlock(&ptcpipobj->m_pObj->m_clientList.m_rwlockItemList);
+        VSCP_SYSLOG(LOG_ERR,
+                    "TCP/IP server: Failed to add client. Terminating thread.");
         return NULL;
     }
-    pthread_mutex_unlock(&ptcpipobj->m_pObj->m_clientList.m_mutexItemList);
+    pthread_rwlock_unlock(&ptcpipobj->m_pObj->m_clientList.m_rwlockItemList);
 
     // Clear the filter (Allow everything )
     vscp_clearVSCPFilter(&ptcpipobj->m_pClientItem->m_filter);
@@ -2739,7 +2810,7 @@ tcpipClientThread(void* pData)
     str += std::string(MSG_OK);
     ptcpipobj->write((const char*)str.c_str(), str.length());
 
-    syslog(LOG_DEBUG, "[TCP/IP srv] Ready to serve client.");
+    VSCP_SYSLOG(LOG_DEBUG, "[TCP/IP srv] Ready to serve client.");
 
     // Enter command loop
     char buf[8192];
@@ -2749,12 +2820,17 @@ tcpipClientThread(void* pData)
         // Check for client inactivity
         if ((time(NULL) - ptcpipobj->m_pClientItem->m_clientActivity) >
             TCPIPSRV_INACTIVITY_TIMOUT) {
-            syslog(
+            VSCP_SYSLOG(
               LOG_INFO,
               "[TCP/IP srv client thread] Client closed due to inactivity.");
             break;
         }
 
+        // Commands pipelined by the client may already be buffered.
+        // They are handled before waiting for more data.
+        bool bBuffered = (ptcpipobj->m_strResponse.npos !=
+                          ptcpipobj->m_strResponse.find('\n'));
+
         // * * * Receiveloop * * *
         if (ptcpipobj->m_bReceiveLoop) {
 
@@ -2773,7 +2849,7 @@ tcpipClientThread(void* pData)
                 ptcpipobj->write("+OK\r\n", 5);
             }
 
-        } else {
+        } else if (!bBuffered) {
 
             // Set poll
             fd.fd      = ptcpipobj->m_conn->client.sock;
@@ -2797,11 +2873,14 @@ tcpipClientThread(void* pData)
         // Read possible data from client
         //      If in receive loop we know we have delay
         //      in event waiting above.
-        memset(buf, 0, sizeof(buf));
-        int nRead = stcp_read(ptcpipobj->m_conn,
+        int nRead = 0;
+        if (!bBuffered) {
+            memset(buf, 0, sizeof(buf));
+            nRead = stcp_read(ptcpipobj->m_conn,
                               buf,
                               sizeof(buf),
                               (ptcpipobj->m_bReceiveLoop) ? 0 : 0);
+        }
 
         if (0 == nRead) {
             ; // Nothing more to read - Check for command and continue -> below
@@ -2922,9 +3001,9 @@ tcpipClientThread(void* pData)
     ptcpipobj->m_pClientItem->m_bOpen = false;
 
     // Remove the client from the Client List
-    pthread_mutex_lock(&ptcpipobj->m_pObj->m_clientList.m_mutexItemList);
+    pthread_rwlock_wrlock(&ptcpipobj->m_pObj->m_clientList.m_rwlockItemList);
     ptcpipobj->m_pObj->removeClient(ptcpipobj->m_pClientItem);
-    pthread_mutex_unlock(&ptcpipobj->m_pObj->m_clientList.m_mutexItemList);
+    pthread_rwlock_unlock(&ptcpipobj->m_pObj->m_clientList.m_rwlockItemList);
 
     ptcpipobj->m_pClientItem = NULL;
     ptcpipobj->m_pParent     = NULL;
@@ -2933,7 +3012,7 @@ tcpipClientThread(void* pData)
     delete ptcpipobj;
 
     if (__VSCP_DEBUG_TCP) {
-        syslog(LOG_INFO, "[TCP/IP srv client thread] Exit.");
+        VSCP_SYSLOG(LOG_INFO, "[TCP/IP srv client thread] Exit.");
     }
 
     return NULL;
@@ -280,6 +280,11 @@ class tcpipClientObj
     */
     void handleClientGetStatistics(void);
 
+    /*!
+        Client get metrics
+    */
+    void handleClientGetMetrics(void);
+
     /*!
         Client get status
     */
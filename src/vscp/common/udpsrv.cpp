@@ -40,6 +40,7 @@
 #include <version.h>
 #include <vscp.h>
 #include <vscp-aes.h>
+#include <vscp-syslog.h>
 #include <vscphelper.h>
 
 #include <string>
@@ -118,7 +119,7 @@ udpRemoteClient::init(CControlObject* pobj,
     m_clientAddress.sin_port   = htons(m_remotePort);
 
     if (0 == inet_aton(m_remoteAddress.c_str(), &m_clientAddress.sin_addr)) {
-        syslog(LOG_ERR, "UDP remote client: inet_aton() failed.");
+        VSCP_SYSLOG(LOG_ERR, "UDP remote client: inet_aton() failed.");
         close(m_sockfd);
         return VSCP_ERROR_ERROR;
     }
@@ -137,8 +138,8 @@ udpRemoteClient::startWorkerThread(void)
                        NULL,
                        udpClientWorkerThread,
                        this)) {
-        syslog(LOG_ERR,
-               "Controlobject: Unable to start the UDP server thread.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "Controlobject: Unable to start the UDP server thread.");
         return false;
     }
 
@@ -305,10 +306,10 @@ udpSrvObj::receiveFrame(int sockfd, CClientItem* pClientItem)
     // Null frame
     if (0 == rcvlen) {
         // Packet to short
-        syslog(LOG_ERR,
-               "UDP receive server: The peer has performed an orderly "
-               "shutdown, UDP frame have invalid length = %d",
-               (int)rcvlen);
+        VSCP_SYSLOG(LOG_ERR,
+                    "UDP receive server: The peer has performed an orderly "
+                    "shutdown, UDP frame have invalid length = %d",
+                    (int)rcvlen);
         if (m_bAck) {
             replyNackFrame(
               &from,
@@ -321,9 +322,9 @@ udpSrvObj::receiveFrame(int sockfd, CClientItem* pClientItem)
     // Error
     if (-1 == rcvlen) {
         // Packet to short
-        syslog(LOG_ERR,
-               "UDP receive server: Error when receiving UDP frame = %d",
-               errno);
+        VSCP_SYSLOG(LOG_ERR,
+                    "UDP receive server: Error when receiving UDP frame = %d",
+                    errno);
         if (m_bAck) {
             replyNackFrame(
               &from,
@@ -338,9 +339,9 @@ udpSrvObj::receiveFrame(int sockfd, CClientItem* pClientItem)
     if (rcvlen < (1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + 2)) {
 
         // Packet to short
-        syslog(LOG_ERR,
-               "UDP receive server: UDP frame have invalid length = %d",
-               (int)rcvlen);
+        VSCP_SYSLOG(LOG_ERR,
+                    "UDP receive server: UDP frame have invalid length = %d",
+                    (int)rcvlen);
         if (m_bAck) {
             replyNackFrame(
               &from,
@@ -354,9 +355,9 @@ udpSrvObj::receiveFrame(int sockfd, CClientItem* pClientItem)
     // frames must be encrypted
     if (!m_bAllowUnsecure && !GET_VSCP_MULTICAST_PACKET_ENCRYPTION(
                                rcvbuf[VSCP_BINARY_PACKET_FRAME0_POS_PKTTYPE])) {
-        syslog(LOG_ERR,
-               "UDP receive server: UDP frame must be encrypted (or"
-               "m_bAllowUnsecure set to 'true') to be accepted.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "UDP receive server: UDP frame must be encrypted (or"
+                    "m_bAllowUnsecure set to 'true') to be accepted.");
         if (m_bAck) {
             replyNackFrame(
               (struct sockaddr*)&from,
@@ -372,7 +373,8 @@ udpSrvObj::receiveFrame(int sockfd, CClientItem* pClientItem)
                            m_pCtrlObj->getSystemKey(NULL),
                            NULL,    // Will be copied from the last 16-bytes
                            GET_VSCP_MULTICAST_PACKET_ENCRYPTION(rcvbuf[0]))) {
-        syslog(LOG_ERR, "UDP receive server: Decryption of UDP frame failed");
+        VSCP_SYSLOG(LOG_ERR,
+                    "UDP receive server: Decryption of UDP frame failed");
         if (m_bAck) {
             replyNackFrame(
               (struct sockaddr*)&from,
@@ -527,12 +529,12 @@ udpSrvWorkerThread(void* pData)
 
     udpSrvObj* pObj = (udpSrvObj*)pData;
     if (NULL == pObj) {
-        syslog(LOG_ERR, "UDP RX Client: No thread worker object defined.");
+        VSCP_SYSLOG(LOG_ERR, "UDP RX Client: No thread worker object defined.");
         return NULL;
     }
 
     if (NULL == pObj->m_pCtrlObj) {
-        syslog(LOG_ERR, "UDP RX Client: No control object defined.");
+        VSCP_SYSLOG(LOG_ERR, "UDP RX Client: No control object defined.");
         return NULL;
     }
 
@@ -541,7 +543,7 @@ udpSrvWorkerThread(void* pData)
 
     // Creating socket file descriptor
     if ((sockfd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
-        syslog(LOG_ERR, "UDP RX Client: Socket could not be created.");
+        VSCP_SYSLOG(LOG_ERR, "UDP RX Client: Socket could not be created.");
         return NULL;
     }
 
@@ -551,12 +553,12 @@ udpSrvWorkerThread(void* pData)
     if (bind(sockfd,
              (const struct sockaddr*)&pObj->m_servaddr,
              sizeof(pObj->m_servaddr)) < 0) {
-        syslog(LOG_ERR, "UDP RX Client: Unable to bind to server port.");
+        VSCP_SYSLOG(LOG_ERR, "UDP RX Client: Unable to bind to server port.");
         close(sockfd);
         return NULL;
     }
 
-    syslog(
+    VSCP_SYSLOG(
       LOG_ERR,
       "UDP RX Client: Bind to interface. [%s]",
       get_ip_str((struct sockaddr*)&pObj->m_servaddr, rcvbuf, sizeof(rcvbuf)));
@@ -565,9 +567,9 @@ udpSrvWorkerThread(void* pData)
     // clients
     pObj->m_pClientItem = new CClientItem;
     if (NULL == pObj->m_pClientItem) {
-        syslog(LOG_ERR,
-               "[UDP RX Client] Unable to allocate memory for client - "
-               "terminating.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "[UDP RX Client] Unable to allocate memory for client - "
+                    "terminating.");
         close(sockfd);
         return NULL;
     }
@@ -595,9 +597,9 @@ udpSrvWorkerThread(void* pData)
 
             delete pObj->m_pClientItem;
 
-            syslog(LOG_ERR,
-                   "[UDP RX Client] User [%s] NOT allowed to connect.",
-                   (const char*)pObj->m_user.c_str());
+            VSCP_SYSLOG(LOG_ERR,
+                        "[UDP RX Client] User [%s] NOT allowed to connect.",
+                        (const char*)pObj->m_user.c_str());
             close(sockfd);
             return NULL;
         }
@@ -614,8 +616,8 @@ udpSrvWorkerThread(void* pData)
         delete pObj->m_pClientItem;
         pObj->m_pClientItem = NULL;
         pthread_mutex_lock(&pObj->m_pCtrlObj->m_mutex_clientList);
-        syslog(LOG_ERR,
-               "UDP server: Failed to add client. Terminating thread.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "UDP server: Failed to add client. Terminating thread.");
         close(sockfd);
         return NULL;
     }
@@ -628,10 +630,10 @@ udpSrvWorkerThread(void* pData)
 
     // Set GUID for channel
     if (!pObj->m_guid.isNULL()) {
-        pObj->m_pClientItem->m_guid = pObj->m_guid;
+        pObj->m_pCtrlObj->m_clientList.setClientGUID(pObj->m_pClientItem, pObj->m_guid);
     }
 
-    syslog(LOG_ERR, "UDP RX Client: Thread started.");
+    VSCP_SYSLOG(LOG_ERR, "UDP RX Client: Thread started.");
 
     struct pollfd poll_set;
     poll_set.events  = POLLIN;
@@ -663,7 +665,7 @@ udpSrvWorkerThread(void* pData)
         pthread_mutex_unlock(&pObj->m_pCtrlObj->m_mutex_clientList);
     }
 
-    syslog(LOG_ERR, "UDP RX ClientThread: Quit.");
+    VSCP_SYSLOG(LOG_ERR, "UDP RX ClientThread: Quit.");
 
     return NULL;
 }
@@ -682,12 +684,12 @@ udpClientWorkerThread(void* pData)
 
     udpRemoteClient* pObj = (udpRemoteClient*)pData;
     if (NULL == pObj) {
-        syslog(LOG_ERR, "UDP TX Client: No thread worker object defined.");
+        VSCP_SYSLOG(LOG_ERR, "UDP TX Client: No thread worker object defined.");
         return NULL;
     }
 
     if (NULL == pObj->m_pCtrlObj) {
-        syslog(LOG_ERR, "UDP TX Client: No control object defined.");
+        VSCP_SYSLOG(LOG_ERR, "UDP TX Client: No control object defined.");
         return NULL;
     }
 
@@ -707,9 +709,9 @@ udpClientWorkerThread(void* pData)
     // clients
     pObj->m_pClientItem = new CClientItem;
     if (NULL == pObj->m_pClientItem) {
-        syslog(LOG_ERR,
-               "[UDP RX Client] Unable to allocate memory for client - "
-               "terminating.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "[UDP RX Client] Unable to allocate memory for client - "
+                    "terminating.");
         close(pObj->m_sockfd);
         return NULL;
     }
@@ -740,9 +742,9 @@ udpClientWorkerThread(void* pData)
 
             delete pObj->m_pClientItem;
 
-            syslog(LOG_ERR,
-                   "[UDP RX Client] User [%s] NOT allowed to connect.",
-                   (const char*)pObj->m_user.c_str());
+            VSCP_SYSLOG(LOG_ERR,
+                        "[UDP RX Client] User [%s] NOT allowed to connect.",
+                        (const char*)pObj->m_user.c_str());
             close(pObj->m_sockfd);
             return NULL;
         }
@@ -759,8 +761,8 @@ udpClientWorkerThread(void* pData)
         delete pObj->m_pClientItem;
         pObj->m_pClientItem = NULL;
         pthread_mutex_lock(&pObj->m_pCtrlObj->m_mutex_clientList);
-        syslog(LOG_ERR,
-               "UDP server: Failed to add client. Terminating thread.");
+        VSCP_SYSLOG(LOG_ERR,
+                    "UDP server: Failed to add client. Terminating thread.");
         close(pObj->m_sockfd);
         return NULL;
     }
@@ -773,10 +775,10 @@ udpClientWorkerThread(void* pData)
 
     // Set GUID for channel
     if (!pObj->m_guid.isNULL()) {
-        pObj->m_pClientItem->m_guid = pObj->m_guid;
+        pObj->m_pCtrlObj->m_clientList.setClientGUID(pObj->m_pClientItem, pObj->m_guid);
     }
 
-    syslog(LOG_ERR, "UDP RX Client: Thread started.");
+    VSCP_SYSLOG(LOG_ERR, "UDP RX Client: Thread started.");
 
     // Run run run...
     while (!pObj->m_bQuit) {
@@ -790,7 +792,7 @@ udpClientWorkerThread(void* pData)
         pthread_mutex_unlock(&pObj->m_pCtrlObj->m_mutex_clientList);
     }
 
-    syslog(LOG_ERR, "UDP RX ClientThread: Quit.");
+    VSCP_SYSLOG(LOG_ERR, "UDP RX ClientThread: Quit.");
 
     return NULL;
 }
@@ -62,6 +62,10 @@
 #include <vscp.h>
 #include <vscphelper.h>
 
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
 #include <nlohmann/json.hpp> // Needs C++11  -std=c++11
 #include <mustache.hpp>
 
@@ -104,6 +108,10 @@ CUserItem::CUserItem(void)
   // No user rights
   m_userRights = 0x00000000;
 
+  // No "*:*" entry
+  m_bAllowAllEvents      = false;
+  m_permissionGeneration = 0;
+
   m_pdata                      = NULL;
 }
 
@@ -137,6 +145,27 @@ CUserItem::setPasswordHash(const std::string &md5hash)
   m_password = md5hash;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// getPasswordHashType
+//
+
+int
+CUserItem::getPasswordHashType(void)
+{
+  // salt;hash
+  if (((2 * VSCP_PASSWORD_SALT_SIZE + 1 + 2 * VSCP_PASSWORD_HASH_SIZE) == m_password.length()) &&
+      (';' == m_password[2 * VSCP_PASSWORD_SALT_SIZE])) {
+    return VSCP_PASSWORD_HASH_TYPE_PBKDF2;
+  }
+
+  // md5 hex digest
+  if ((32 == m_password.length()) && (std::string::npos == m_password.find_first_not_of("0123456789abcdefABCDEF"))) {
+    return VSCP_PASSWORD_HASH_TYPE_MD5;
+  }
+
+  return VSCP_PASSWORD_HASH_TYPE_UNKNOWN;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // setPasswordFromClearText
 //
@@ -144,11 +173,10 @@ CUserItem::setPasswordHash(const std::string &md5hash)
 void
 CUserItem::setPasswordFromClearText(const std::string &strPassword)
 {
-  char pw[33];
-  memset(pw, 0, 33); // Clear password
-  std::string combined = m_user + ":" + strPassword;
-  vscp_md5(pw, (const unsigned char *) combined.c_str(), combined.length());
-  m_password = pw;
+  if (!vscp_makePasswordHash(m_password, strPassword)) {
+    spdlog::error("userlist: [setPasswordFromClearText] Failed to hash password for user '{}'.", m_user);
+    m_password.clear();
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -158,11 +186,27 @@ CUserItem::setPasswordFromClearText(const std::string &strPassword)
 bool
 CUserItem::validateUser(const std::string &password)
 {
-  char pw[33];
-  memset(pw, 0, 33); // Clear password
-  std::string combined = m_user + ":" + password;
-  vscp_md5(pw, (const unsigned char *) combined.c_str(), combined.length());
-  return (0 == strcmp(pw, m_password.c_str()));
+  switch (getPasswordHashType()) {
+
+    case VSCP_PASSWORD_HASH_TYPE_PBKDF2:
+      return vscp_isPasswordValid(m_password, password);
+
+    case VSCP_PASSWORD_HASH_TYPE_MD5: {
+      char pw[33];
+      uint8_t hash[16];
+      uint8_t storedHash[16];
+      memset(pw, 0, 33); // Clear password
+      std::string combined = m_user + ":" + password;
+      vscp_md5(pw, (const unsigned char *) combined.c_str(), combined.length());
+      vscp_hexStr2ByteArray(hash, sizeof(hash), pw);
+      vscp_hexStr2ByteArray(storedHash, sizeof(storedHash), m_password.c_str());
+      return (0 == CRYPTO_memcmp(hash, storedHash, sizeof(hash)));
+    }
+
+    default:
+      spdlog::error("userlist: [validateUser] Unknown password hash format for user '{}'.", m_user);
+      return false;
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -501,6 +545,7 @@ CUserItem::addUserRightsFromString(const std::string &strRights)
     }
   }
 
+  m_permissionGeneration++;
   return true;
 }
 
@@ -512,6 +557,7 @@ bool
 CUserItem::setUserRightsFromString(const std::string &strRights)
 {
   m_userRights = 0;
+  m_permissionGeneration++;
   return addUserRightsFromString(strRights);
 }
 
@@ -559,6 +605,7 @@ CUserItem::setAllowedEvent(size_t n, const std::string &strEvent)
   // need to extract the values or wildcards
   if ("*:*" == str) {
     m_listAllowedEvents[n] = str;
+    compileAllowedEvents();
     return true;
   }
 
@@ -568,6 +615,7 @@ CUserItem::setAllowedEvent(size_t n, const std::string &strEvent)
     vscp_type              = vscp_readStringValue(str);
     str                    = vscp_str_format("*:%04X", vscp_type);
     m_listAllowedEvents[n] = str;
+    compileAllowedEvents();
     return true;
   }
 
@@ -577,6 +625,7 @@ CUserItem::setAllowedEvent(size_t n, const std::string &strEvent)
     vscp_class             = vscp_readStringValue(str);
     str                    = vscp_str_format("%04X:*", vscp_class);
     m_listAllowedEvents[n] = str;
+    compileAllowedEvents();
     return true;
   }
 
@@ -588,6 +637,7 @@ CUserItem::setAllowedEvent(size_t n, const std::string &strEvent)
     vscp_type              = vscp_readStringValue(str);
     str                    = vscp_str_format("%04X:%04X", vscp_class, vscp_type);
     m_listAllowedEvents[n] = str;
+    compileAllowedEvents();
     return true;
   }
 
@@ -611,6 +661,7 @@ CUserItem::addAllowedEvent(const std::string &strEvent)
   // need to extract the values or wildcards
   if ("*:*" == str) {
     m_listAllowedEvents.push_back(str);
+    compileAllowedEvent(str);
     return true;
   }
 
@@ -620,6 +671,7 @@ CUserItem::addAllowedEvent(const std::string &strEvent)
     vscp_type = vscp_readStringValue(str);
     str       = vscp_str_format("*:%04X", vscp_type);
     m_listAllowedEvents.push_back(str);
+    compileAllowedEvent(str);
     return true;
   }
 
@@ -629,6 +681,7 @@ CUserItem::addAllowedEvent(const std::string &strEvent)
     vscp_class = vscp_readStringValue(str);
     str        = vscp_str_format("%04X:*", vscp_class);
     m_listAllowedEvents.push_back(str);
+    compileAllowedEvent(str);
     return true;
   }
 
@@ -640,6 +693,7 @@ CUserItem::addAllowedEvent(const std::string &strEvent)
     vscp_type = vscp_readStringValue(str);
     str       = vscp_str_format("%04X:%04X", vscp_class, vscp_type);
     m_listAllowedEvents.push_back(str);
+    compileAllowedEvent(str);
     return true;
   }
 
@@ -659,7 +713,7 @@ CUserItem::setAllowedEventsFromString(const std::string &strEvents, bool bClear)
   if (strEvents.length()) {
 
     if (bClear) {
-      m_listAllowedEvents.clear();
+      clearAllowedEventList();
     }
 
     std::deque<std::string> tokens;
@@ -841,6 +895,58 @@ CUserItem::isAllowedToConnect(uint32_t remote_ip)
   return ('+' == allowed) ? 1 : 0;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// compileAllowedEvent
+//
+
+void
+CUserItem::compileAllowedEvent(const std::string &strEvent)
+{
+  size_t pos = strEvent.find(':');
+  if (std::string::npos == pos) {
+    return;
+  }
+
+  std::string strClass = strEvent.substr(0, pos);
+  std::string strType  = strEvent.substr(pos + 1);
+
+  if ("*" == strClass) {
+    // "*:type" is stored but has never granted anything on its own,
+    // only "*:*" does.
+    if ("*" == strType) {
+      m_bAllowAllEvents = true;
+    }
+  }
+  else if ("*" == strType) {
+    m_setAllowedClasses.insert((uint16_t) strtoul(strClass.c_str(), NULL, 16));
+  }
+  else {
+    uint32_t vscp_class = (uint16_t) strtoul(strClass.c_str(), NULL, 16);
+    uint32_t vscp_type  = (uint16_t) strtoul(strType.c_str(), NULL, 16);
+    m_setAllowedEvents.insert((vscp_class << 16) | vscp_type);
+  }
+
+  m_permissionGeneration++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// compileAllowedEvents
+//
+
+void
+CUserItem::compileAllowedEvents(void)
+{
+  m_setAllowedClasses.clear();
+  m_setAllowedEvents.clear();
+  m_bAllowAllEvents = false;
+
+  for (size_t i = 0; i < m_listAllowedEvents.size(); i++) {
+    compileAllowedEvent(m_listAllowedEvents[i]);
+  }
+
+  m_permissionGeneration++;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // isUserAllowedToSendEvent
 //
@@ -848,9 +954,6 @@ CUserItem::isAllowedToConnect(uint32_t remote_ip)
 bool
 CUserItem::isUserAllowedToSendEvent(const uint32_t vscp_class, const uint32_t vscp_type)
 {
-  unsigned int i;
-  std::string str;
-
   // User must be allowed to send events
   if (!(VSCP_USER_RIGHT_ALLOW_SEND_EVENT & m_userRights)) {
     spdlog::error("userlist: [isUserAllowedToSendEvent] User not allowed to send events.");
@@ -881,28 +984,25 @@ CUserItem::isUserAllowedToSendEvent(const uint32_t vscp_class, const uint32_t vs
     return false;
   }
 
-  // If empty all events allowed
-  if (m_listAllowedEvents.empty())
+  // If empty all events allowed, same for "*:*"
+  if (m_bAllowAllEvents || m_listAllowedEvents.empty()) {
     return true;
+  }
 
-  // test wildcard *.*
-  str = "*:*";
-  for (i = 0; i < m_listAllowedEvents.size(); i++) {
-    if (m_listAllowedEvents[i] == str)
-      return true;
+  // Allowed list only holds 16-bit class/type
+  if ((vscp_class > 0xffff) || (vscp_type > 0xffff)) {
+    spdlog::debug("userlist: [isUserAllowedToSendEvent] Not allowed to send event.");
+    return false;
   }
 
-  // test wildcard class.*
-  str = vscp_str_format("%04X:*", vscp_class);
-  for (i = 0; i < m_listAllowedEvents.size(); i++) {
-    if (m_listAllowedEvents[i] == str)
-      return true;
+  // class:*
+  if (m_setAllowedClasses.count((uint16_t) vscp_class)) {
+    return true;
   }
 
-  str = vscp_str_format("%04X:%04X", vscp_class, vscp_type);
-  for (i = 0; i < m_listAllowedEvents.size(); i++) {
-    if (m_listAllowedEvents[i] == str)
-      return true;
+  // class:type
+  if (m_setAllowedEvents.count((vscp_class << 16) | vscp_type)) {
+    return true;
   }
 
   spdlog::debug("userlist: [isUserAllowedToSendEvent] Not allowed to send event.");
@@ -922,6 +1022,16 @@ CUserItem::isUserAllowedToSendEvent(const uint32_t vscp_class, const uint32_t vs
 CUserList::CUserList()
 {
   m_cntUsers = 0;
+
+  m_maxCredentialCache = VSCP_USERLIST_CREDENTIAL_CACHE_SIZE;
+  m_credentialCacheTtl = VSCP_USERLIST_CREDENTIAL_CACHE_TTL;
+  pthread_mutex_init(&m_mutexCredentialCache, NULL);
+
+  // Without a key the cache can't be used
+  if (!vscp_getSalt(m_credentialCacheKey, sizeof(m_credentialCacheKey))) {
+    spdlog::warn("userlist: Failed to generate credential cache key, cache disabled.");
+    m_maxCredentialCache = 0;
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -941,6 +1051,10 @@ CUserList::~CUserList(void)
 
   m_grouphashmap.clear();
 
+  clearCredentialCache();
+  pthread_mutex_destroy(&m_mutexCredentialCache);
+  OPENSSL_cleanse(m_credentialCacheKey, sizeof(m_credentialCacheKey));
+
   {
     for (std::map<std::string, CUserItem *>::iterator it = m_userhashmap.begin(); it != m_userhashmap.end(); ++it) {
       CUserItem *pItem = it->second;
@@ -1234,6 +1348,10 @@ CUserList::deleteUser(const std::string &user)
   // Remove also from internal table
   m_userhashmap.erase(user);
 
+  pthread_mutex_lock(&m_mutexCredentialCache);
+  m_credentialCache.erase(user);
+  pthread_mutex_unlock(&m_mutexCredentialCache);
+
   return true;
 }
 
@@ -1293,9 +1411,14 @@ CUserList::getUser(const long userid)
 CUserItem *
 CUserList::validateUser(const std::string &user, const std::string &password)
 {
-  CUserItem *pUserItem;
+  CUserItem *pUserItem = NULL;
+
+  // Don't use operator[] here, it would add a map entry for every unknown user
+  std::map<std::string, CUserItem *>::iterator it = m_userhashmap.find(user);
+  if (it != m_userhashmap.end()) {
+    pUserItem = it->second;
+  }
 
-  pUserItem = m_userhashmap[user];
   if (NULL == pUserItem) {
     spdlog::error("userlist: "
                   "validateUser: Failed to validate user '{}' - "
@@ -1304,7 +1427,10 @@ CUserList::validateUser(const std::string &user, const std::string &password)
     return NULL;
   }
 
-  std::string combined = pUserItem->getUserName() + ":" + password;
+  if (isCredentialCached(pUserItem, password)) {
+    return pUserItem;
+  }
+
   if (!pUserItem->validateUser(password)) {
     spdlog::error("userlist :"
                   "validateUser: Failed to validate user '{}' - "
@@ -1313,9 +1439,141 @@ CUserList::validateUser(const std::string &user, const std::string &password)
     return NULL;
   }
 
+  addCredentialToCache(pUserItem, password);
+
   return pUserItem;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// setCredentialCache
+//
+
+void
+CUserList::setCredentialCache(size_t maxItems, uint32_t ttl)
+{
+  pthread_mutex_lock(&m_mutexCredentialCache);
+  m_credentialCache.clear();
+  m_maxCredentialCache = maxItems;
+  m_credentialCacheTtl = ttl;
+  pthread_mutex_unlock(&m_mutexCredentialCache);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// clearCredentialCache
+//
+
+void
+CUserList::clearCredentialCache(void)
+{
+  pthread_mutex_lock(&m_mutexCredentialCache);
+  m_credentialCache.clear();
+  pthread_mutex_unlock(&m_mutexCredentialCache);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getCredentialMac
+//
+
+bool
+CUserList::getCredentialMac(uint8_t *mac, const std::string &user, const std::string &password)
+{
+  unsigned int len = 0;
+  std::string str  = user;
+  str += '\0';
+  str += password;
+
+  bool rv = (NULL != HMAC(EVP_sha256(),
+                          m_credentialCacheKey,
+                          sizeof(m_credentialCacheKey),
+                          (const unsigned char *) str.c_str(),
+                          str.length(),
+                          mac,
+                          &len)) &&
+            (32 == len);
+
+  OPENSSL_cleanse(&str[0], str.length());
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// isCredentialCached
+//
+
+bool
+CUserList::isCredentialCached(CUserItem *pUserItem, const std::string &password)
+{
+  uint8_t mac[32];
+
+  if (!m_maxCredentialCache) {
+    return false;
+  }
+
+  if (!getCredentialMac(mac, pUserItem->getUserName(), password)) {
+    return false;
+  }
+
+  bool rv = false;
+  pthread_mutex_lock(&m_mutexCredentialCache);
+
+  std::map<std::string, credentialCacheItem>::iterator it = m_credentialCache.find(pUserItem->getUserName());
+  if (it != m_credentialCache.end()) {
+    if ((std::chrono::steady_clock::now() >= it->second.expires) ||
+        (it->second.passwordHash != pUserItem->getPasswordHash())) {
+      // Expired or password changed
+      m_credentialCache.erase(it);
+    }
+    else {
+      rv = (0 == CRYPTO_memcmp(mac, it->second.mac, sizeof(mac)));
+    }
+  }
+
+  pthread_mutex_unlock(&m_mutexCredentialCache);
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// addCredentialToCache
+//
+
+void
+CUserList::addCredentialToCache(CUserItem *pUserItem, const std::string &password)
+{
+  credentialCacheItem item;
+
+  if (!m_maxCredentialCache) {
+    return;
+  }
+
+  if (!getCredentialMac(item.mac, pUserItem->getUserName(), password)) {
+    return;
+  }
+
+  item.passwordHash = pUserItem->getPasswordHash();
+  item.expires      = std::chrono::steady_clock::now() + std::chrono::seconds(m_credentialCacheTtl);
+
+  pthread_mutex_lock(&m_mutexCredentialCache);
+
+  // Make room by dropping the entry closest to expiry
+  if ((m_credentialCache.size() >= m_maxCredentialCache) &&
+      (m_credentialCache.end() == m_credentialCache.find(pUserItem->getUserName()))) {
+    std::map<std::string, credentialCacheItem>::iterator oldest = m_credentialCache.begin();
+    for (std::map<std::string, credentialCacheItem>::iterator it = m_credentialCache.begin();
+         it != m_credentialCache.end();
+         ++it) {
+      if (it->second.expires < oldest->second.expires) {
+        oldest = it;
+      }
+    }
+    if (oldest != m_credentialCache.end()) {
+      m_credentialCache.erase(oldest);
+    }
+  }
+
+  m_credentialCache[pUserItem->getUserName()] = item;
+
+  pthread_mutex_unlock(&m_mutexCredentialCache);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // getUserAsString
 //
@@ -46,8 +46,12 @@
 #include <vscp.h>
 #include <vscphelper.h>
 
+#include <pthread.h>
+
+#include <chrono>
 #include <iostream>
 #include <map>
+#include <unordered_set>
 
 // clang-format off
 
@@ -172,6 +176,15 @@
 
 #define USER_ID_ADMIN                   0x00 // The one and only admin user
 
+// Stored password hash formats, told apart by their form
+#define VSCP_PASSWORD_HASH_TYPE_UNKNOWN 0
+#define VSCP_PASSWORD_HASH_TYPE_MD5     1   // md5("user:password") as 32 hex digits (legacy)
+#define VSCP_PASSWORD_HASH_TYPE_PBKDF2  2   // "salt;hash" PBKDF2-HMAC-SHA256
+
+// Verified credential cache defaults
+#define VSCP_USERLIST_CREDENTIAL_CACHE_SIZE  256  // Max cached users (0 disables)
+#define VSCP_USERLIST_CREDENTIAL_CACHE_TTL   300  // Seconds a verification is trusted
+
 // clang-format on
 
 // ----------------------------------------------------------------------------
@@ -235,6 +248,8 @@ public:
       First check "*.*"
       Next check "class:type"
       Next check "class:*"
+      The allowed event list is compiled into lookup sets when it is
+      changed so this check is O(1) and does not allocate.
       @param vscp_class VSCP class to test.
       @param vscp_type VSCP type to test.
       @return true if the client is allowed to send event.
@@ -302,22 +317,31 @@ public:
 
   /*!
       Set (already) hashed password. Typically used
-      when loading user data from file. The hash should
-      be done over "user:password"
+      when loading user data from file. The hash can be
+      on the form "salt;hash" (PBKDF2-HMAC-SHA256, as generated
+      by vscp-mkpasswd) or a legacy md5 hash over "user:password".
       @param pmd5hash Reference to string containing hashed password on hex format.
   */
   void setPasswordHash(const std::string &md5hash);
 
+  /*!
+      Get the format of the stored password hash
+      @return One of the VSCP_PASSWORD_HASH_TYPE_* values
+  */
+  int getPasswordHashType(void);
+
   /*!
       Set clear text password
-      The password is stored hashed with md5 over "username:password"
+      The password is stored hashed with PBKDF2-HMAC-SHA256 on
+      the form "salt;hash"
       @param password Clear text password to set
       @return true on success, false on failure.
   */
   void setPasswordFromClearText(const std::string &strPassword);
 
   /*!
-      Validate user password
+      Validate user password against the stored hash. Both PBKDF2
+      and legacy md5 hashes are accepted and compared in constant time.
       @param password Clear text password to validate
       @return true if user is a valid user
   */
@@ -334,7 +358,11 @@ public:
   // User rights
   uint64_t getUserRights(void) { return m_userRights; };
 
-  void setUserRights(const uint64_t rights) { m_userRights = rights; };
+  void setUserRights(const uint64_t rights)
+  {
+    m_userRights = rights;
+    m_permissionGeneration++;
+  };
   std::string getUserRightsAsString(void);
 
   // --------------------------------
@@ -344,7 +372,11 @@ public:
   /*!
       Clear the allowed event list
   */
-  void clearAllowedEventList(void) { m_listAllowedEvents.clear(); };
+  void clearAllowedEventList(void)
+  {
+    m_listAllowedEvents.clear();
+    compileAllowedEvents();
+  };
 
   /*!
       Set allowed event
@@ -392,6 +424,14 @@ public:
   */
   size_t getAllowedEventsCount(void) { return m_listAllowedEvents.size(); };
 
+  /*!
+      Get permission generation. The value is changed every time the
+      user rights or the allowed event list is changed and can be used
+      to invalidate cached permission decisions.
+      @return Current permission generation
+  */
+  uint32_t getPermissionGeneration(void) { return m_permissionGeneration; };
+
   // -----------------------
   // * * * Remote list * * *
   // -----------------------
@@ -550,6 +590,20 @@ protected:
   */
   std::deque<std::string> m_listAllowedEvents;
 
+  /*!
+      Compiled form of m_listAllowedEvents used on the send path.
+      m_bAllowAllEvents is set if the list holds "*:*",
+      m_setAllowedClasses holds classes from "class:*" entries and
+      m_setAllowedEvents holds (class << 16) | type for "class:type"
+      entries.
+  */
+  bool m_bAllowAllEvents;
+  std::unordered_set<uint16_t> m_setAllowedClasses;
+  std::unordered_set<uint32_t> m_setAllowedEvents;
+
+  /// Changed when rights or allowed events change
+  uint32_t m_permissionGeneration;
+
   /*!
       This list holds ip-addresses for remote
       computers that are allowed to connect to this
@@ -566,6 +620,19 @@ protected:
       Pointer to arbitrary user data object
   */ 
   void *m_pdata; 
+
+private:
+  /*!
+      Add one allowed event on standard form ("*:*", "%04X:*",
+      "*:%04X" or "%04X:%04X") to the compiled lookup sets.
+      @param strEvent Allowed event on standard form
+  */
+  void compileAllowedEvent(const std::string &strEvent);
+
+  /*!
+      Rebuild the compiled lookup sets from m_listAllowedEvents
+  */
+  void compileAllowedEvents(void);
 };
 
 // ----------------------------------------------------------------------------
@@ -654,12 +721,27 @@ public:
 
   /*!
       Validate a username/password pair
+      Successful verifications are remembered in a bounded cache for
+      a limited time so repeated logins do not pay the KDF cost.
       @param user Username to test.
       @param password Password to test
       @return Pointer to useritem if valid, NULL if not.
   */
   CUserItem *validateUser(const std::string &user, const std::string &password);
 
+  /*!
+      Configure the verified credential cache. Existing entries
+      are dropped.
+      @param maxItems Max number of cached users. Zero disables the cache.
+      @param ttl Number of seconds a verification is trusted.
+  */
+  void setCredentialCache(size_t maxItems, uint32_t ttl);
+
+  /*!
+      Drop all cached credential verifications
+  */
+  void clearCredentialCache(void);
+
   /*!
    * Get number of users on the system
    * @return number of users.
@@ -723,8 +805,55 @@ protected:
   std::map<std::string, CGroupItem *> m_grouphashmap;
 
 private:
+  /*!
+      Calculate the cache MAC for a username/password pair
+      @param mac Buffer (32 bytes) that will get the MAC
+      @param user Username
+      @param password Clear text password
+      @return true on success
+  */
+  bool getCredentialMac(uint8_t *mac, const std::string &user, const std::string &password);
+
+  /*!
+      Check if a verified username/password pair is cached
+      @param pUserItem User to check
+      @param password Clear text password
+      @return true if cached and still valid
+  */
+  bool isCredentialCached(CUserItem *pUserItem, const std::string &password);
+
+  /*!
+      Remember a verified username/password pair
+      @param pUserItem Verified user
+      @param password Clear text password
+  */
+  void addCredentialToCache(CUserItem *pUserItem, const std::string &password);
+
   // Counter for user id's
   unsigned short m_cntUsers;
+
+  /*!
+      Verified credential cache. Only a keyed MAC over the
+      credentials is stored, never the password. The stored hash
+      is kept so a changed password invalidates the entry.
+  */
+  struct credentialCacheItem {
+    uint8_t mac[32];
+    std::string passwordHash;
+    std::chrono::steady_clock::time_point expires;
+  };
+
+  std::map<std::string, credentialCacheItem> m_credentialCache;
+  pthread_mutex_t m_mutexCredentialCache;
+
+  /// Random per process key for the credential MAC
+  uint8_t m_credentialCacheKey[32];
+
+  /// Max number of cached users (zero disables the cache)
+  size_t m_maxCredentialCache;
+
+  /// Seconds a verification is trusted
+  uint32_t m_credentialCacheTtl;
 };
 
 #endif
@@ -43,9 +43,16 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <set>
 #include <sstream>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+//                            CBootDevice_VSCP
+///////////////////////////////////////////////////////////////////////////////
 
 ///////////////////////////////////////////////////////////////////////////////
 // CTORS
@@ -101,9 +108,10 @@ CBootDevice_VSCP::~CBootDevice_VSCP(void)
 void
 CBootDevice_VSCP::init(void)
 {
-  m_pAddr     = 0;
-  m_numBlocks = 0;
-  m_blockSize = 0;
+  m_pAddr       = 0;
+  m_numBlocks   = 0;
+  m_blockSize   = 0;
+  m_chunkWindow = BOOT_DEFAULT_CHUNK_WINDOW;
   crcInit();
 }
 
@@ -423,11 +431,11 @@ CBootDevice_VSCP::programBlock(uint32_t block)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// writeChunk
+// sendChunk
 //
 
 int
-CBootDevice_VSCP::writeChunk(const uint8_t *paddr, uint16_t size)
+CBootDevice_VSCP::sendChunk(const uint8_t *paddr, uint16_t size)
 {
   int rv;
   vscpEventEx ex;
@@ -438,9 +446,6 @@ CBootDevice_VSCP::writeChunk(const uint8_t *paddr, uint16_t size)
   ex.timestamp  = vscp_makeTimeStamp();
   vscp_setEventExDateTimeBlockToNow(&ex);
 
-  cguid node_guid;
-  m_stdRegs.getGUID(node_guid);
-
   // Check size
   if (size > m_chunkSize) {
     return VSCP_ERROR_SIZE;
@@ -457,6 +462,26 @@ CBootDevice_VSCP::writeChunk(const uint8_t *paddr, uint16_t size)
     return rv;
   }
 
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// writeChunk
+//
+
+int
+CBootDevice_VSCP::writeChunk(const uint8_t *paddr, uint16_t size)
+{
+  int rv;
+  vscpEventEx ex;
+
+  cguid node_guid;
+  m_stdRegs.getGUID(node_guid);
+
+  if (VSCP_ERROR_SUCCESS != (rv = sendChunk(paddr, size))) {
+    return rv;
+  }
+
   // Wait for response on start block transfer event
   if (VSCP_ERROR_SUCCESS !=
       (rv = checkResponse(ex, node_guid, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_NACK))) {
@@ -478,8 +503,11 @@ int
 CBootDevice_VSCP::writeBlock(uint32_t block, const uint8_t *paddr)
 {
   int rv = VSCP_ERROR_SUCCESS;
-  cguid guid;
   uint32_t nChunks = 1;
+  uint32_t sent    = 0; // Chunks sent
+  uint32_t acked   = 0; // Chunks acknowledged
+  bool bCrc        = false;
+  uint16_t crc_block = 0;
   vscpEventEx ex;
 
   cguid node_guid;
@@ -493,29 +521,70 @@ CBootDevice_VSCP::writeBlock(uint32_t block, const uint8_t *paddr)
     }
   }
 
-  for (uint32_t chunk = 0; chunk < nChunks; chunk++) {
+  while (acked < nChunks) {
 
-    spdlog::debug("VSCP bootloader: memory chunk on remote device. chunk={0} {1:X} ", chunk, chunk * m_chunkSize);
+    // Keep up to a window of chunks on the wire
+    while ((sent < nChunks) && ((sent - acked) < m_chunkWindow)) {
+
+      spdlog::debug("VSCP bootloader: memory chunk on remote device. chunk={0} {1:X} ", sent, sent * m_chunkSize);
+      if (nullptr != m_statusCallback) {
+        m_statusCallback(-1, "");
+      }
+
+      if (VSCP_ERROR_SUCCESS != (rv = sendChunk(paddr + (sent * m_chunkSize), m_chunkSize))) {
+        break;
+      }
+      sent++;
+    }
+
+    if (VSCP_ERROR_SUCCESS != rv) {
+      break;
+    }
+
+    // Calculate the block CRC once the first window has been handed
+    // to the client, while the device works on it, instead of before
+    // the first chunk is sent
+    if (!bCrc) {
+      crc_block = crcFast(paddr, m_blockSize);
+      bCrc      = true;
+    }
+
+    // Collect the ACK for the oldest chunk in the window
+    if (VSCP_ERROR_SUCCESS !=
+        (rv = checkResponse(ex, node_guid, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_NACK))) {
+      spdlog::error("VSCP bootloader: Negative response from block chunk send {0}", rv);
+      break;
+    }
+    acked++;
+  }
+
+  if (VSCP_ERROR_SUCCESS != rv) {
+
+    spdlog::error("VSCP bootloader: Failed to write chunk {0}/{1} to remote device rv={2}.", acked, nChunks, rv);
     if (nullptr != m_statusCallback) {
       m_statusCallback(
-        -1 /*(100 * chunk) / nChunks*/,
-        // vscp_str_format("VSCP bootloader: Loading memory chunk on remote device. chunk = %d.", chunk).c_str()
-        "");
+        (100 * acked) / nChunks,
+        vscp_str_format("VSCP bootloader: Failed to write chunk %u/%u to remote device rv=%d.", acked, nChunks, rv)
+          .c_str());
     }
 
-    if (VSCP_ERROR_SUCCESS != (rv = writeChunk(paddr + (chunk * m_chunkSize), m_chunkSize))) {
-      spdlog::error("VSCP bootloader: Failed to write chunk to remote device. rv={}", rv);
-      if (nullptr != m_statusCallback) {
-        m_statusCallback(
-          (100 * chunk) / nChunks,
-          vscp_str_format("VSCP bootloader: Failed to write chunk %lu/%lu to remote device rv=%d.", chunk, nChunks, rv)
-            .c_str());
-        spdlog::error("VSCP bootloader: Failed to write chunk {0}/{1} to remote device rv={2}.", chunk, nChunks, rv);
+    /*
+      Chunks have no sequence number so the block is resent from
+      the start. Drain responses for chunks still in transit so they
+      are not taken for responses to the resent block.
+    */
+    while (++acked < sent) {
+      if (VSCP_ERROR_TIMEOUT == checkResponse(ex,
+                                              node_guid,
+                                              VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK,
+                                              VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_NACK,
+                                              1)) {
+        break;
       }
-      break;
     }
 
-  } // for
+    return rv;
+  }
 
   // Wait for data block ACK/NACK response
   if (VSCP_ERROR_SUCCESS !=
@@ -524,10 +593,10 @@ CBootDevice_VSCP::writeBlock(uint32_t block, const uint8_t *paddr)
     if (nullptr != m_statusCallback) {
       m_statusCallback(-1, "VSCP bootloader: NACK received for data block");
     }
+    return rv;
   }
 
   // Check that the crc is equal
-  uint16_t crc_block    = crcFast(paddr, m_blockSize);
   uint16_t crc_packet   = construct_unsigned16(ex.data[0], ex.data[1]);
   uint32_t block_packet = construct_unsigned32(ex.data[2], ex.data[3], ex.data[4], ex.data[5]);
 
@@ -789,6 +858,53 @@ CBootDevice_VSCP::deviceLoad(std::function<void(int, const char *)> /*statusCall
   return rv;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// deviceLoadParallel
+//
+
+int
+CBootDevice_VSCP::deviceLoadParallel(std::list<CBootDevice_VSCP *> &devices, uint16_t window)
+{
+  int rv = VSCP_ERROR_SUCCESS;
+
+  if (devices.empty()) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  // Unaddressed block traffic would reach every device on a shared client
+  std::set<CVscpClient *> clients;
+  for (auto pdev : devices) {
+    if ((nullptr == pdev) || (nullptr == pdev->m_pclient) || !clients.insert(pdev->m_pclient).second) {
+      return VSCP_ERROR_PARAMETER;
+    }
+    pdev->setChunkWindow(window);
+  }
+
+  std::list<std::thread> threads;
+  std::list<int> results;
+
+  for (auto pdev : devices) {
+    results.push_back(VSCP_ERROR_SUCCESS);
+    int *prv = &results.back();
+    threads.emplace_back([pdev, prv]() {
+      *prv = pdev->deviceLoad();
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (auto result : results) {
+    if (VSCP_ERROR_SUCCESS != result) {
+      rv = result;
+      break;
+    }
+  }
+
+  return rv;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // deviceReboot
 //
@@ -812,25 +928,21 @@ CBootDevice_VSCP::checkResponse(vscpEventEx &ex,
                                 uint32_t timeout)
 {
   int rv = VSCP_ERROR_TIMEOUT;
-  time_t tstart, tnow;
 
-  // Get start time
-  time(&tstart);
+  // Timeout is in seconds
+  uint32_t tstart = vscp_getMsTimeStamp();
 
   while (true) {
 
     // Test for timeout
-    time(&tnow);
-    if ((unsigned long) (tnow - tstart) > timeout) {
+    uint32_t elapsed = vscp_getMsTimeStamp() - tstart;
+    if (elapsed >= timeout * 1000) {
       spdlog::debug("VSCP Bootloader: Timeout.");
       rv = VSCP_ERROR_TIMEOUT;
       break;
     }
 
-    uint16_t cnt;
-    if ((VSCP_ERROR_SUCCESS == m_pclient->getcount(&cnt)) && cnt) {
-
-      rv = m_pclient->receive(ex);
+    if (VSCP_ERROR_SUCCESS == m_pclient->receiveBlocking(ex, (long) (timeout * 1000 - elapsed))) {
 
       cguid evguid(ex.GUID);
 
@@ -889,7 +1001,7 @@ CBootDevice_VSCP::checkResponse(vscpEventEx &ex,
           if (nullptr != m_statusCallback) {
             m_statusCallback(-1, "VSCP bootloader: Check response: Level I NACK received");
           }
-          rv = VSCP_ERROR_SUCCESS;
+          rv = VSCP_ERROR_NACK;
           break;
         }
       }
@@ -29,6 +29,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <list>
+#include <string>
+
 #include "vscp.h"
 
 /* This macro construct a signed integer from two unsigned chars in a safe way */
@@ -162,6 +165,12 @@ public:
   // Default timeout for response
   static const uint8_t BOOT_COMMAND_RESPONSE_TIMEOUT = 5;
 
+  // Default number of chunks that can be unacknowledged
+  static const uint16_t BOOT_DEFAULT_CHUNK_WINDOW = 1;
+
+  // Max number of chunks that can be unacknowledged
+  static const uint16_t BOOT_MAX_CHUNK_WINDOW = 64;
+
   // Number of memory types
   static const uint8_t NUMBER_OF_MEMORY_TYPES = 10;
 
@@ -241,6 +250,16 @@ public:
   */
   int programBlock(uint32_t block);
 
+  /*!
+     Send a chunk without waiting for the chunk ACK
+     @param paddr Pointer to first byte of 8-byte block to write
+       to remote device
+     @param size Number of data bytes to send. Must be less than the
+       max event data (8/512)
+     @return VSCP_ERROR_SUCCESS on success.
+ */
+  int sendChunk(const uint8_t *paddr, uint16_t size);
+
   /*!
      Write a sector
      @param paddr Pointer to first byte of 8-byte block to write
@@ -253,11 +272,49 @@ public:
 
   /*!
     Write a firmware flock to the device
+
+    With a chunk window larger than one, chunks are sent back to back
+    and the chunk ACK's are collected in order as they arrive. Chunks
+    carry no sequence number so a NACK or a lost ACK fails the block
+    and it is resent from the start.
+
     @param paddr Address to beginning of data to write
     @return VSCP_ERROR_SUCCESS on success.
   */
   int writeBlock(uint32_t block, const uint8_t *paddr);
 
+  /*!
+    Set number of chunks that can be sent before the ACK for the
+    first of them has been received.
+    @param window Number of unacknowledged chunks. 1 (default) is
+      stop-and-wait.
+  */
+  void setChunkWindow(uint16_t window)
+  {
+    // No std::min here, it would need an out of class definition of the limit
+    m_chunkWindow = !window ? 1 : ((window > BOOT_MAX_CHUNK_WINDOW) ? BOOT_MAX_CHUNK_WINDOW : window);
+  };
+
+  /*!
+    Get number of chunks that can be unacknowledged
+    @return Chunk window
+  */
+  uint16_t getChunkWindow(void) { return m_chunkWindow; };
+
+  /*!
+    Load firmware into several devices in parallel. START_BLOCK, BLOCK_DATA
+    and PROGRAM_BLOCK_DATA carry no node address so every node in boot mode
+    on a segment takes them. Each device must therefore have a client of
+    its own, talking to a segment where it is the only node in boot mode.
+    All devices must have been put in boot mode with deviceInit().
+    @param devices List with devices to load.
+    @param window Chunk window used for all devices.
+    @return VSCP_ERROR_SUCCESS if all devices was loaded. VSCP_ERROR_PARAMETER
+      if two devices share a client. Otherwise the error code from the first
+      device that failed.
+  */
+  static int deviceLoadParallel(std::list<CBootDevice_VSCP *> &devices, uint16_t window = BOOT_DEFAULT_CHUNK_WINDOW);
+
   /*!
     Check response event
     @param ex Event that is the result of the response
@@ -277,6 +334,9 @@ private:
   /// Current set page in register space on remote device
   uint32_t m_page;
 
+  /// Number of chunks that can be unacknowledged
+  uint16_t m_chunkWindow;
+
   /// Our GUID
   cguid m_ourguid;
 
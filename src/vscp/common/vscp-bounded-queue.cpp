@@ -0,0 +1,225 @@
+// vscp-bounded-queue.cpp
+//
+// Bounded multi producer single consumer queue.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include <time.h>
+
+#include <cstddef>
+#include <new>
+
+#include "vscp-bounded-queue.h"
+
+// Items start this far into a slot and slots are a multiple of it
+#define BOUNDED_QUEUE_ALIGN alignof(std::max_align_t)
+
+///////////////////////////////////////////////////////////////////////////////
+// CTor
+//
+
+vscpBoundedQueue::vscpBoundedQueue(void)
+{
+  m_pbuf       = NULL;
+  m_queueSize  = 0;
+  m_itemSize   = 0;
+  m_slotSize   = 0;
+  m_enqueuePos = 0;
+  m_dequeuePos = 0;
+  m_bWaiting   = false;
+
+  sem_init(&m_sem, 0, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DTor
+//
+
+vscpBoundedQueue::~vscpBoundedQueue(void)
+{
+  release();
+  sem_destroy(&m_sem);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init
+//
+
+bool
+vscpBoundedQueue::init(size_t queueSize, size_t itemSize)
+{
+  size_t size = 2;
+  while (size < queueSize) {
+    size <<= 1;
+  }
+
+  if (NULL == m_pbuf) {
+    m_queueSize = size;
+    m_itemSize  = itemSize;
+    m_slotSize  = BOUNDED_QUEUE_ALIGN + ((itemSize + BOUNDED_QUEUE_ALIGN - 1) & ~(BOUNDED_QUEUE_ALIGN - 1));
+    m_pbuf      = (uint8_t *) new std::max_align_t[m_queueSize * m_slotSize / sizeof(std::max_align_t)];
+    for (size_t i = 0; i < m_queueSize; i++) {
+      new (seq(i)) std::atomic<size_t>(i);
+    }
+  }
+  else if ((size != m_queueSize) || (itemSize != m_itemSize)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < m_queueSize; i++) {
+    seq(i)->store(i, std::memory_order_relaxed);
+  }
+  m_enqueuePos = 0;
+  m_dequeuePos = 0;
+  m_bWaiting   = false;
+
+  // Forget wake ups meant for an earlier consumer
+  while (0 == sem_trywait(&m_sem))
+    ;
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// release
+//
+
+void
+vscpBoundedQueue::release(void)
+{
+  delete[] (std::max_align_t *) m_pbuf;
+  m_pbuf      = NULL;
+  m_queueSize = 0;
+  m_itemSize  = 0;
+  m_slotSize  = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// reserve
+//
+
+void *
+vscpBoundedQueue::reserve(size_t *ppos)
+{
+  size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+  for (;;) {
+    size_t s      = seq(pos)->load(std::memory_order_acquire);
+    intptr_t diff = (intptr_t) s - (intptr_t) pos;
+    if (0 == diff) {
+      if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    else if (diff < 0) {
+      return NULL;
+    }
+    else {
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+
+  *ppos = pos;
+  return (uint8_t *) seq(pos) + BOUNDED_QUEUE_ALIGN;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// commit
+//
+
+void
+vscpBoundedQueue::commit(size_t pos)
+{
+  seq(pos)->store(pos + 1, std::memory_order_release);
+
+  // Wake the consumer only if it is sleeping
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_bWaiting.load(std::memory_order_relaxed) && m_bWaiting.exchange(false)) {
+    sem_post(&m_sem);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// front
+//
+
+void *
+vscpBoundedQueue::front(void)
+{
+  if (seq(m_dequeuePos)->load(std::memory_order_acquire) != m_dequeuePos + 1) {
+    return NULL;
+  }
+
+  return (uint8_t *) seq(m_dequeuePos) + BOUNDED_QUEUE_ALIGN;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// pop
+//
+
+void
+vscpBoundedQueue::pop(void)
+{
+  seq(m_dequeuePos)->store(m_dequeuePos + m_queueSize, std::memory_order_release);
+  m_dequeuePos++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// wait
+//
+
+void
+vscpBoundedQueue::wait(uint32_t timeout)
+{
+  // Check the queue again after telling producers we sleep so a
+  // wake up is not missed
+  m_bWaiting.store(true);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (NULL != front()) {
+    m_bWaiting.store(false);
+    return;
+  }
+
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  ts.tv_sec += timeout / 1000;
+  ts.tv_nsec += (timeout % 1000) * 1000000L;
+  if (ts.tv_nsec >= 1000000000L) {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000L;
+  }
+  sem_timedwait(&m_sem, &ts);
+  m_bWaiting.store(false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// wake
+//
+
+void
+vscpBoundedQueue::wake(void)
+{
+  sem_post(&m_sem);
+}
@@ -0,0 +1,142 @@
+// vscp-bounded-queue.h
+//
+// Bounded multi producer single consumer queue.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#if !defined(VSCP_BOUNDED_QUEUE_H__INCLUDED_)
+#define VSCP_BOUNDED_QUEUE_H__INCLUDED_
+
+#include <semaphore.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+/*!
+  @class vscpBoundedQueue
+  Bounded multi producer single consumer queue of fixed size items.
+
+  Producers never block and never take a lock. An item is written in
+  place between reserve() and commit(). If the queue is full reserve()
+  returns NULL and the caller decides what to do with the item.
+
+  The consumer thread reads items in place with front()/pop() and
+  sleeps in wait() when the queue is empty. A producer only posts the
+  semaphore when the consumer is sleeping.
+*/
+
+class vscpBoundedQueue {
+
+public:
+  vscpBoundedQueue(void);
+  ~vscpBoundedQueue(void);
+
+  /*!
+    Set up the queue. Slots are allocated on the first call and kept
+    until release() so producers that raced a restart still write to
+    valid memory. Must not be called while the consumer runs.
+    @param queueSize Number of items. Rounded up to a power of two.
+    @param itemSize Size of an item in bytes.
+    @return true on success, false if the queue is already set up
+            with another size.
+  */
+  bool init(size_t queueSize, size_t itemSize);
+
+  // Free the slots. No producer or consumer may use the queue.
+  void release(void);
+
+  // True if init() has been called
+  bool isInit(void) const { return (NULL != m_pbuf); };
+
+  // Number of items the queue can hold
+  size_t getSize(void) const { return m_queueSize; };
+
+  /*!
+    Reserve a slot for an item
+    @param ppos Set to the position to give to commit().
+    @return Pointer to the item or NULL if the queue is full.
+  */
+  void *reserve(size_t *ppos);
+
+  /*!
+    Hand a reserved item to the consumer and wake it if it sleeps
+    @param pos Position from reserve().
+  */
+  void commit(size_t pos);
+
+  /*!
+    Next item for the consumer
+    @return Pointer to the item or NULL if the queue is empty.
+  */
+  void *front(void);
+
+  // Give the item from front() back to the producers
+  void pop(void);
+
+  /*!
+    Sleep until a producer commits an item, wake() is called or the
+    timeout expires. Returns at once if an item is waiting.
+    @param timeout Max time to sleep in milliseconds.
+  */
+  void wait(uint32_t timeout);
+
+  // Wake the consumer
+  void wake(void);
+
+  // Number of items reserved since init()
+  size_t getEnqueuePos(void) const { return m_enqueuePos.load(); };
+
+  // Number of items popped since init(), consumer thread only
+  size_t getDequeuePos(void) const { return m_dequeuePos; };
+
+private:
+  // Sequence of the slot at pos
+  std::atomic<size_t> *seq(size_t pos) const
+  {
+    return (std::atomic<size_t> *) (m_pbuf + (pos & (m_queueSize - 1)) * m_slotSize);
+  };
+
+private:
+  /*
+    A slot is an atomic sequence followed by the item. The slot at
+    position pos is free for a producer when its sequence is pos and
+    holds an item for the consumer when it is pos + 1.
+  */
+  uint8_t *m_pbuf;
+  size_t m_queueSize;
+  size_t m_itemSize;
+  size_t m_slotSize;
+
+  std::atomic<size_t> m_enqueuePos;
+  size_t m_dequeuePos;
+
+  // The consumer waits on the semaphore when the queue is empty
+  sem_t m_sem;
+  std::atomic<bool> m_bWaiting;
+};
+
+#endif // VSCP_BOUNDED_QUEUE_H__INCLUDED_
@@ -66,6 +66,7 @@ CVscpClient::~CVscpClient()
 int
 CVscpClient::setCallbackEv(std::function<void(vscpEvent &ev, void *pobj)> callback, void *pData)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_mutexCallback);
   m_callbackev     = callback;
   m_callbackObject = pData;
   m_bActiveCallbackEv = true;
@@ -80,6 +81,7 @@ CVscpClient::setCallbackEv(std::function<void(vscpEvent &ev, void *pobj)> callba
 int
 CVscpClient::setCallbackEx(std::function<void(vscpEventEx &ex, void *pobj)> callback, void *pData)
 {
+  std::lock_guard<std::recursive_mutex> lock(m_mutexCallback);
   m_callbackex     = callback;
   m_callbackObject = pData;
   m_bActiveCallbackEx = true;
@@ -87,3 +89,31 @@ CVscpClient::setCallbackEx(std::function<void(vscpEventEx &ex, void *pobj)> call
   return VSCP_ERROR_SUCCESS;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// getCallbacks
+//
+
+void
+CVscpClient::getCallbacks(std::function<void(vscpEvent &ev, void *pobj)> &callbackev,
+                          std::function<void(vscpEventEx &ex, void *pobj)> &callbackex,
+                          void **ppobj)
+{
+  std::lock_guard<std::recursive_mutex> lock(m_mutexCallback);
+
+  if (m_bActiveCallbackEv) {
+    callbackev = m_callbackev;
+  }
+  else {
+    callbackev = nullptr;
+  }
+
+  if (m_bActiveCallbackEx) {
+    callbackex = m_callbackex;
+  }
+  else {
+    callbackex = nullptr;
+  }
+
+  *ppobj = m_callbackObject;
+}
+
@@ -33,6 +33,7 @@
 
 #include <deque>
 #include <list>
+#include <mutex>
 #include <string>
 
 // for convenience
@@ -70,6 +71,7 @@ public:
       - MQTT - VSCP over MQTT.
       - UDP - VSCP over UDP.
       - MULTICAST - VSCP multicast protocol.
+      - SHM - VSCP over shared memory to a server on the same host.
       - REST - VSCP REST interface.
       - RAWCAN - Handle standard CAN and CANFD.
       - RAWMQTT - Handle standard MQTT.
@@ -85,6 +87,7 @@ public:
     MQTT,
     UDP,
     MULTICAST,
+    SHM,
   } connType;
 
   /*!
@@ -227,6 +230,18 @@ public:
   */
   virtual int setCallbackEx(std::function<void(vscpEventEx &ex, void *pobj)> callback, void *pData = nullptr);
 
+  /*!
+      Get copies of the active callbacks. The receive paths call the
+      copies without holding m_mutexCallback, so a callback may itself
+      replace callbacks or disconnect the client.
+      @param callbackev Set to the ev callback, empty if not active.
+      @param callbackex Set to the ex callback, empty if not active.
+      @param ppobj Set to the callback object.
+  */
+  void getCallbacks(std::function<void(vscpEvent &ev, void *pobj)> &callbackev,
+                    std::function<void(vscpEventEx &ex, void *pobj)> &callbackex,
+                    void **ppobj);
+
   /*!
       Getter/setters for connection timeout
       Time is in milliseconds
@@ -257,13 +272,21 @@ public:
     Activate or deactivate Ev callback
     @param b Set to true (default) to activate.
   */
-  void setCallbackEvActive(bool b = true) { m_bActiveCallbackEv = b; };
+  void setCallbackEvActive(bool b = true)
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_mutexCallback);
+    m_bActiveCallbackEv = b;
+  };
 
   /*!
     Activate or deactivate Ex callback
     @param b Set to true (default) to activate.
   */
-  void setCallbackExActive(bool b = true) { m_bActiveCallbackEx = b; };
+  void setCallbackExActive(bool b = true)
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_mutexCallback);
+    m_bActiveCallbackEx = b;
+  };
 
   /*!
       Return a JSON representation of connection
@@ -313,7 +336,11 @@ public:
     @param Pointer to object to set
   */
 
-  void setCallbackObj(void *pobj) { m_callbackObject = pobj; };
+  void setCallbackObj(void *pobj)
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_mutexCallback);
+    m_callbackObject = pobj;
+  };
 
   /*!
     Return Callback object
@@ -332,6 +359,12 @@ public:
   */
   std::function<void(vscpEventEx &ex, void *pobj)> m_callbackex;
 
+  /*!
+      Protects the callbacks, their active flags and the callback
+      object. Never held while a callback is called.
+  */
+  std::recursive_mutex m_mutexCallback;
+
 protected:
   /// Type of connection object
   connType m_type = CVscpClient::connType::NONE;
@@ -331,6 +331,27 @@ vscpClientCanal::send(canalMsg &msg)
   return m_canalif.CanalSend(&msg);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// send
+//
+
+int
+vscpClientCanal::send(canalMsg *pmsgs, uint32_t count, uint32_t *psent)
+{
+  uint32_t nSent = 0;
+
+  if (nullptr == pmsgs) {
+    return VSCP_ERROR_INVALID_POINTER;
+  }
+
+  int rv = m_canalif.CanalSendBatch(pmsgs, count, &nSent, CANAL_CLIENT_SEND_TIMEOUT);
+  if (nullptr != psent) {
+    *psent = nSent;
+  }
+
+  return rv;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // receive
 //
@@ -657,7 +678,11 @@ win_usleep(__int64 usec)
 static void *
 workerThread(void *pObj)
 {
-  canalMsg msg;
+  canalMsg msgs[CANAL_CLIENT_RECEIVE_BATCH];
+  uint32_t cnt;
+  std::function<void(vscpEvent &ev, void *pobj)> callbackev;
+  std::function<void(vscpEventEx &ex, void *pobj)> callbackex;
+  void *pobj;
   uint8_t guid[]           = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
   vscpClientCanal *pClient = (vscpClientCanal *) pObj;
   VscpCanalDeviceIf *pif   = (VscpCanalDeviceIf *) &(pClient->m_canalif);
@@ -667,37 +692,39 @@ workerThread(void *pObj)
     return NULL;
   }
 
-  while (pClient->m_bRun) {
+  spdlog::trace("CANAL CLIENT: workertread start.");
 
-    spdlog::trace("CANAL CLIENT: workertread start.");
+  while (pClient->m_bRun) {
 
-    // Check if there are events to fetch
-    // int cnt;
-    // if ((cnt = pClient->m_canalif.CanalDataAvailable())) {
+    // Get what the driver has, wait at most 100 ms for the first one
+    if (CANAL_ERROR_SUCCESS != pif->CanalBlockingReceiveBatch(msgs, CANAL_CLIENT_RECEIVE_BATCH, &cnt, 100)) {
+      continue;
+    }
 
-    // while (cnt) {
+    spdlog::trace("CANAL CLIENT: workthread. {} events received", cnt);
 
-    if (CANAL_ERROR_SUCCESS == pClient->m_canalif.CanalBlockingReceive(&msg, 100)) {
+    pClient->getCallbacks(callbackev, callbackex, &pobj);
 
-      spdlog::trace("CANAL CLIENT: workthread. Event received");
+    pthread_mutex_lock(&pClient->m_mutexif);
 
-      pthread_mutex_lock(&pClient->m_mutexif);
+    for (uint32_t i = 0; i < cnt; i++) {
 
-      if (pClient->isCallbackEvActive()) {
+      if (callbackev) {
         vscpEvent ev;
-        if (vscp_convertCanalToEvent(&ev, &msg, guid)) {
+        if (vscp_convertCanalToEvent(&ev, &msgs[i], guid)) {
           if (vscp_doLevel2Filter(&ev, &pClient->m_filterIn)) {
             spdlog::trace("CANAL CLIENT: workthread. Event sent to ev callback");
-            pClient->m_callbackev(ev, pClient->getCallbackObj());
+            callbackev(ev, pobj);
           }
+          delete[] ev.pdata;
         }
       }
-      else if (pClient->isCallbackExActive()) {
+      else if (callbackex) {
         vscpEventEx ex;
-        if (vscp_convertCanalToEventEx(&ex, &msg, guid)) {
+        if (vscp_convertCanalToEventEx(&ex, &msgs[i], guid)) {
           if (vscp_doLevel2FilterEx(&ex, &pClient->m_filterIn)) {
             spdlog::trace("CANAL CLIENT: workthread. Event sent to ex callback");
-            pClient->m_callbackex(ex, pClient->getCallbackObj());
+            callbackex(ex, pobj);
           }
         }
       }
@@ -708,37 +735,29 @@ workerThread(void *pObj)
         vscpEvent *pev = new vscpEvent;
         if (nullptr == pev) {
           spdlog::critical("CANAL CLIENT: Memory problem.");
+          pthread_mutex_unlock(&pClient->m_mutexif);
           return NULL;
         }
-        if (vscp_convertCanalToEvent(pev, &msg, guid)) {
-          if (vscp_doLevel2Filter(pev, &pClient->m_filterIn)) {
-            pthread_mutex_lock(&pClient->m_mutexReceiveQueue);
-            pClient->m_receiveQueue.push_back(pev);
+        if (vscp_convertCanalToEvent(pev, &msgs[i], guid) && vscp_doLevel2Filter(pev, &pClient->m_filterIn)) {
+          pthread_mutex_lock(&pClient->m_mutexReceiveQueue);
+          pClient->m_receiveQueue.push_back(pev);
 #ifdef WIN32
-            ReleaseSemaphore(pClient->m_semReceiveQueue, 1, NULL);
+          ReleaseSemaphore(pClient->m_semReceiveQueue, 1, NULL);
 #else
-            sem_post(&pClient->m_semReceiveQueue);
+          sem_post(&pClient->m_semReceiveQueue);
 #endif
-            pthread_mutex_unlock(&pClient->m_mutexReceiveQueue);
-          }
+          pthread_mutex_unlock(&pClient->m_mutexReceiveQueue);
         }
         else {
           vscp_deleteEvent(pev);
         }
       }
 
-      pthread_mutex_unlock(&pClient->m_mutexif);
+    } // for
+
+    pthread_mutex_unlock(&pClient->m_mutexif);
 
-    } // message received
   } // while
-    // cnt--;
-  //}
-
-  // #ifndef WIN32
-  //     usleep(200);
-  // #else
-  //     win_usleep(200);
-  // #endif
 
   spdlog::trace("CANAL CLIENT: workthread end.");
 
@@ -33,6 +33,12 @@
 
 #include <pthread.h>
 
+// Max number of messages fetched from the driver in one call
+#define CANAL_CLIENT_RECEIVE_BATCH 32
+
+// Timeout for each message when sending several at once (ms)
+#define CANAL_CLIENT_SEND_TIMEOUT 300
+
 // When a callback is set and connect is called this object is shared
 // with a worker thread that
 
@@ -96,6 +102,16 @@ public:
 */
   virtual int send(canalMsg &msg);
 
+  /*!
+    Send several CAN(AL) messages to remote host. One driver call is used
+    if the driver has CanalSendBatch.
+    @param pmsgs Array with messages to send.
+    @param count Number of messages to send.
+    @param psent Set to number of messages sent if not NULL.
+    @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  int send(canalMsg *pmsgs, uint32_t count, uint32_t *psent = nullptr);
+
   /*!
       Receive VSCP event from remote host
       @return Return VSCP_ERROR_SUCCESS of OK and error code else.
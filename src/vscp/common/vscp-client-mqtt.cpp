@@ -47,6 +47,8 @@
 #endif
 
 #include <guid.h>
+#include <vscp-log.h>
+#include <vscp-metrics.h>
 #include <vscphelper.h>
 
 #include <deque>
@@ -156,6 +158,9 @@ mqtt_on_connect(struct mosquitto *mosq, void *pData, int rv)
   vscpClientMqtt *pClient = reinterpret_cast<vscpClientMqtt *>(pData);
   pClient->m_bConnected   = true;
 
+  // The broker may have lost state
+  pClient->restartCoalesce();
+
   if (nullptr != pClient) {
     pClient->sendWillPayload();
     pClient->doSubscribe();
@@ -189,6 +194,9 @@ mqtt_on_connect_flags(struct mosquitto *mosq, void *pData, int rv, int flags)
   vscpClientMqtt *pClient = reinterpret_cast<vscpClientMqtt *>(pData);
   pClient->m_bConnected   = true;
 
+  // The broker may have lost state
+  pClient->restartCoalesce();
+
   spdlog::info("VSCP MQTT CLIENT: v3.11 connect: rv={0:X} flags={1:X} {2}", rv, flags, mosquitto_strerror(rv));
 
   if (nullptr != pClient) {
@@ -222,6 +230,9 @@ mqtt_on_connect_v5(struct mosquitto *mosq, void *pData, int rv, int flags, const
   vscpClientMqtt *pClient = reinterpret_cast<vscpClientMqtt *>(pData);
   pClient->m_bConnected   = true;
 
+  // The broker may have lost state
+  pClient->restartCoalesce();
+
   spdlog::info("VSCP MQTT CLIENT: MQTT v5 connect: rv={0:X} flags={1:X} {2}", rv, flags, mosquitto_strerror(rv));
 
   if (nullptr != pClient->m_parentCallbackConnect) {
@@ -304,7 +315,7 @@ mqtt_on_publish(struct mosquitto *mosq, void *pData, int mid)
   }
 
   vscpClientMqtt *pClient = reinterpret_cast<vscpClientMqtt *>(pData);
-  spdlog::debug("MQTT publish: MQTT v3.11 publish: mid={0:X}", mid);
+  VSCP_LOG_DEBUG("MQTT publish: MQTT v3.11 publish: mid={0:X}", mid);
 
   if (nullptr != pClient->m_parentCallbackPublish) {
     pClient->m_parentCallbackPublish(mosq, pClient->m_pParent, mid);
@@ -330,7 +341,7 @@ mqtt_on_publish_v5(struct mosquitto *mosq, void *pData, int mid, int reason_code
   }
 
   vscpClientMqtt *pClient = reinterpret_cast<vscpClientMqtt *>(pData);
-  spdlog::debug("MQTT publish: MQTT v5 publish: mid={0:X} reason-code={1:X}", mid, reason_code);
+  VSCP_LOG_DEBUG("MQTT publish: MQTT v5 publish: mid={0:X} reason-code={1:X}", mid, reason_code);
 
   if (nullptr != pClient->m_parentCallbackPublish) {
     pClient->m_parentCallbackPublish(mosq, pClient->m_pParent, mid);
@@ -362,15 +373,18 @@ mqtt_on_message(struct mosquitto *mosq, void *pData, const struct mosquitto_mess
 
   vscpClientMqtt *pClient = reinterpret_cast<vscpClientMqtt *>(pData);
 
-  std::string payload((const char *) pMsg->payload, pMsg->payloadlen);
-  spdlog::debug("VSCP MQTT CLIENT: MQTT v3 Message trace: Topic = {0} - Payload: {1}", pMsg->topic, payload);
+  VSCP_LOG_DEBUG("VSCP MQTT CLIENT: MQTT v3 Message trace: Topic = {0} - Payload: {1}",
+                 pMsg->topic,
+                 std::string((const char *) pMsg->payload, pMsg->payloadlen));
 
   if (nullptr != pClient->m_parentCallbackMessage) {
     pClient->m_parentCallbackMessage(mosq, pClient->m_pParent, pMsg);
   }
 
   if (!pClient->handleMessage(pMsg)) {
-    spdlog::debug("VSCP MQTT CLIENT: MQTT v3 Message parse failure: Topic = {0} - Payload: {1}", pMsg->topic, payload);
+    VSCP_LOG_DEBUG("VSCP MQTT CLIENT: MQTT v3 Message parse failure: Topic = {0} - Payload: {1}",
+                   pMsg->topic,
+                   std::string((const char *) pMsg->payload, pMsg->payloadlen));
   }
 }
 
@@ -400,8 +414,9 @@ mqtt_on_message_v5(struct mosquitto *mosq,
     return;
   }
 
-  std::string payload((const char *) pMsg->payload, pMsg->payloadlen);
-  spdlog::trace("VSCP MQTT CLIENT: MQTT v5 Message trace: Topic = {0} - Payload: {1}", pMsg->topic, payload);
+  VSCP_LOG_TRACE("VSCP MQTT CLIENT: MQTT v5 Message trace: Topic = {0} - Payload: {1}",
+                 pMsg->topic,
+                 std::string((const char *) pMsg->payload, pMsg->payloadlen));
 
   vscpClientMqtt *pClient = reinterpret_cast<vscpClientMqtt *>(pData);
 
@@ -410,7 +425,9 @@ mqtt_on_message_v5(struct mosquitto *mosq,
   }
 
   if (!pClient->handleMessage(pMsg)) {
-    spdlog::error("VSCP MQTT CLIENT: MQTT v5 Message parse failure: Topic = {0} - Payload: {1}", pMsg->topic, payload);
+    spdlog::error("VSCP MQTT CLIENT: MQTT v5 Message parse failure: Topic = {0} - Payload: {1}",
+                  pMsg->topic,
+                  std::string((const char *) pMsg->payload, pMsg->payloadlen));
   }
 }
 #endif
@@ -662,8 +679,7 @@ vscpClientMqtt::vscpClientMqtt(void)
   m_bEscapesPubTopics = true;
 
   // No token maps defined
-  m_pmap_class = nullptr;
-  m_pmap_type  = nullptr;
+  m_ptokens = nullptr;
 
   // delay=2, delay_max=10, exponential_backoff=False Delays would be: 2, 4, 6, 8, 10, 10, ...
   m_reconnect_delay               = 2;
@@ -746,6 +762,35 @@ vscpClientMqtt::~vscpClientMqtt()
   m_mqtt_publishTopicList.clear();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// setTokenMaps
+//
+
+void
+vscpClientMqtt::setTokenMaps(std::map<uint16_t, std::string> *pmap_class, std::map<uint32_t, std::string> *pmap_type)
+{
+  if ((nullptr == pmap_class) && (nullptr == pmap_type)) {
+    m_ptokens = nullptr;
+    return;
+  }
+
+  m_mapTokens = vscpTokenTable();
+
+  if (nullptr != pmap_class) {
+    for (auto const &item : *pmap_class) {
+      m_mapTokens.addClassToken(item.first, item.second);
+    }
+  }
+
+  if (nullptr != pmap_type) {
+    for (auto const &item : *pmap_type) {
+      m_mapTokens.addTypeToken((uint16_t) (item.first >> 16), (uint16_t) (item.first & 0xffff), item.second);
+    }
+  }
+
+  setTokenTable(&m_mapTokens);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // getConfigAsJson
 //
@@ -962,6 +1007,44 @@ vscpClientMqtt::initFromJson(const std::string &config)
       spdlog::debug("VSCP MQTT CLIENT: json mqtt init: 'bjsonmeasurementblock' Set to {}.", m_bJsonMeasurementAdd);
     }
 
+    // Measurement deduplication and rate limiting
+    if (j.contains("coalesce") && j["coalesce"].is_object()) {
+
+      json jj = j["coalesce"];
+
+      double deadband      = VSCP_COALESCE_DEFAULT_DEADBAND;
+      uint64_t window      = VSCP_COALESCE_DEFAULT_WINDOW;
+      uint64_t minInterval = VSCP_COALESCE_DEFAULT_MIN_INTERVAL;
+      size_t maxKeys       = VSCP_COALESCE_DEFAULT_MAX_KEYS;
+
+      if (jj.contains("deadband") && jj["deadband"].is_number()) {
+        deadband = jj["deadband"].get<double>();
+        spdlog::debug("VSCP MQTT CLIENT: json mqtt init: 'coalesce deadband' Set to {}.", deadband);
+      }
+
+      if (jj.contains("window") && jj["window"].is_number_unsigned()) {
+        window = jj["window"].get<uint64_t>();
+        spdlog::debug("VSCP MQTT CLIENT: json mqtt init: 'coalesce window' Set to {}.", window);
+      }
+
+      if (jj.contains("min-interval") && jj["min-interval"].is_number_unsigned()) {
+        minInterval = jj["min-interval"].get<uint64_t>();
+        spdlog::debug("VSCP MQTT CLIENT: json mqtt init: 'coalesce min-interval' Set to {}.", minInterval);
+      }
+
+      if (jj.contains("max-keys") && jj["max-keys"].is_number_unsigned()) {
+        maxKeys = jj["max-keys"].get<size_t>();
+        spdlog::debug("VSCP MQTT CLIENT: json mqtt init: 'coalesce max-keys' Set to {}.", maxKeys);
+      }
+
+      m_coalesce.setOptions(deadband, window, minInterval, maxKeys);
+
+      if (jj.contains("enable") && jj["enable"].is_boolean()) {
+        m_coalesce.enable(jj["enable"].get<bool>());
+        spdlog::debug("VSCP MQTT CLIENT: json mqtt init: 'coalesce enable' Set to {}.", m_coalesce.isEnabled());
+      }
+    }
+
     // Reconnect
     if (j.contains("reconnect") && j["reconnect"].is_object()) {
 
@@ -1511,10 +1594,13 @@ vscpClientMqtt::writeEventDefaultsFromTopic(vscpEventEx &ex, const char *pTopic)
 bool
 vscpClientMqtt::handleMessage(const struct mosquitto_message *pmsg)
 {
+  VSCP_METRIC_TIMER("vscp_mqtt_receive_ns", "Time to decode and deliver a received MQTT message");
   enumMqttMsgFormat format = autofmt;
   vscpEvent ev;
   vscpEventEx ex;
 
+  memset(&ev, 0, sizeof(ev));
+
   // Check pointers
   if (nullptr == pmsg) {
     spdlog::error("VSCP MQTT CLIENT: handleMessage: No message to handle.");
@@ -1570,7 +1656,7 @@ vscpClientMqtt::handleMessage(const struct mosquitto_message *pmsg)
       size_t n      = std::count(s.begin(), s.end(), ',');
       if (n < 6) {
         // This is not a VSCP event on string format
-        spdlog::trace("VSCP MQTT CLIENT: Payload is not a VSCP event.");
+        VSCP_LOG_TRACE("VSCP MQTT CLIENT: Payload is not a VSCP event.");
         return false;
       }
       format = strfmt;
@@ -1583,202 +1669,87 @@ vscpClientMqtt::handleMessage(const struct mosquitto_message *pmsg)
   std::string payload((const char *) pmsg->payload, pmsg->payloadlen);
 
   if (jsonfmt == format) {
-
     if (!vscp_convertJSONToEvent(&ev, payload)) {
-      spdlog::trace("VSCP MQTT CLIENT: JSON->Event conversion failed. Payload is not VSCP event.");
+      VSCP_LOG_TRACE("VSCP MQTT CLIENT: JSON->Event conversion failed. Payload is not VSCP event.");
       return false;
     }
-
-    if (!vscp_convertEventToEventEx(&ex, &ev)) {
-      spdlog::trace("VSCP MQTT CLIENT: JSON->EventEx conversion failed. Payload is not VSCP event.");
-      return false;
-    }
-
-    writeEventDefaultsFromTopic(ex, pmsg->topic);
-
-    // If callback is defined send event
-    if (isCallbackEvActive()) {
-      m_callbackev(ev, getCallbackObj());
-    }
-    else if (isCallbackExActive()) {
-      m_callbackex(ex, getCallbackObj());
-    }
-    else {
-      // Put event in input queue
-      vscpEvent *pEvent = new vscpEvent;
-      if (nullptr == pEvent) {
-        spdlog::critical("VSCP MQTT CLIENT: Memory problem.");
-        return false;
-      }
-
-      pEvent->pdata = nullptr;
-
-      if (!vscp_copyEvent(pEvent, &ev)) {
-        delete pEvent;
-        return 0;
-      }
-
-      // Save event in incoming queue
-      if (m_receiveQueue.size() < MQTT_MAX_INQUEUE_SIZE) {
-        pthread_mutex_lock(&m_mutexReceiveQueue);
-        m_receiveQueue.push_back(pEvent);
-#ifdef WIN32
-        ReleaseSemaphore(m_semReceiveQueue, 1, NULL);
-#else
-        sem_post(&m_semReceiveQueue);
-#endif
-        pthread_mutex_unlock(&m_mutexReceiveQueue);
-      }
-    }
   }
   else if (xmlfmt == format) {
     if (!vscp_convertXMLToEvent(&ev, payload)) {
-      spdlog::trace("VSCP MQTT CLIENT: XML->Event conversion failed. Payload is not VSCP event.");
+      VSCP_LOG_TRACE("VSCP MQTT CLIENT: XML->Event conversion failed. Payload is not VSCP event.");
       return false;
     }
-
-    if (!vscp_convertEventToEventEx(&ex, &ev)) {
-      spdlog::trace("VSCP MQTT CLIENT: XML->EventEx conversion failed. Payload is not VSCP event.");
-      return false;
-    }
-
-    writeEventDefaultsFromTopic(ex, pmsg->topic);
-
-    // If callback is defined send event
-    if (isCallbackEvActive()) {
-      m_callbackev(ev, getCallbackObj());
-    }
-    else if (isCallbackExActive()) {
-      m_callbackex(ex, getCallbackObj());
-    }
-    else {
-      // Put event in input queue
-      vscpEvent *pEvent = new vscpEvent;
-      if (nullptr == pEvent) {
-        spdlog::critical("VSCP MQTT CLIENT: Memory problem.");
-        return false;
-      }
-      pEvent->pdata = nullptr;
-
-      if (!vscp_copyEvent(pEvent, &ev)) {
-        spdlog::critical("VSCP MQTT CLIENT: Memory problem.");
-        delete pEvent;
-        return false;
-      }
-
-      // Save event in incoming queue
-      if (m_receiveQueue.size() < MQTT_MAX_INQUEUE_SIZE) {
-        pthread_mutex_lock(&m_mutexReceiveQueue);
-        m_receiveQueue.push_back(pEvent);
-#ifdef WIN32
-        ReleaseSemaphore(m_semReceiveQueue, 1, NULL);
-#else
-        sem_post(&m_semReceiveQueue);
-#endif
-        pthread_mutex_unlock(&m_mutexReceiveQueue);
-      }
-    }
   }
   else if (strfmt == format) {
     if (!vscp_convertStringToEvent(&ev, payload)) {
-      spdlog::trace("VSCP MQTT CLIENT: str->Event conversion failed. Payload is not VSCP event.");
+      VSCP_LOG_TRACE("VSCP MQTT CLIENT: str->Event conversion failed. Payload is not VSCP event.");
       return false;
     }
-
-    if (!vscp_convertEventToEventEx(&ex, &ev)) {
-      spdlog::trace("VSCP MQTT CLIENT: str->EventEx conversion failed. Payload is not VSCP event.");
-      return false;
-    }
-
-    writeEventDefaultsFromTopic(ex, pmsg->topic);
-
-    // If callback is defined send event
-    if (isCallbackEvActive()) {
-      m_callbackev(ev, getCallbackObj());
-    }
-    else if (isCallbackExActive()) {
-      m_callbackex(ex, getCallbackObj());
-    }
-    else {
-      // Put event in input queue
-      vscpEvent *pEvent = new vscpEvent;
-      if (nullptr == pEvent) {
-        spdlog::critical("VSCP MQTT CLIENT: Memory problem.");
-        return false;
-      }
-      pEvent->pdata = nullptr;
-
-      if (!vscp_copyEvent(pEvent, &ev)) {
-        delete pEvent;
-        spdlog::critical("VSCP MQTT CLIENT: Memory problem.");
-        return false;
-      }
-
-      // Save event in incoming queue
-      if (m_receiveQueue.size() < MQTT_MAX_INQUEUE_SIZE) {
-        pthread_mutex_lock(&m_mutexReceiveQueue);
-        m_receiveQueue.push_back(pEvent);
-#ifdef WIN32
-        ReleaseSemaphore(m_semReceiveQueue, 1, NULL);
-#else
-        sem_post(&m_semReceiveQueue);
-#endif
-        pthread_mutex_unlock(&m_mutexReceiveQueue);
-      }
-    }
   }
   else if (binfmt == format) {
-
     // Binary frame starts offset one in payload (after zero marker byte)
     if (!vscp_getEventFromFrame(&ev, (const uint8_t *) pmsg->payload + 1, pmsg->payloadlen)) {
-      spdlog::trace("VSCP MQTT CLIENT: bin->Event conversion failed. Payload is not VSCP event.");
+      VSCP_LOG_TRACE("VSCP MQTT CLIENT: bin->Event conversion failed. Payload is not VSCP event.");
       return false;
     }
+  }
+  else {
+    return true;
+  }
 
+  // If callback is defined send event
+  std::function<void(vscpEvent &ev, void *pobj)> callbackev;
+  std::function<void(vscpEventEx &ex, void *pobj)> callbackex;
+  void *pobj;
+  getCallbacks(callbackev, callbackex, &pobj);
+
+  if (callbackev) {
+    callbackev(ev, pobj);
+  }
+  else if (callbackex) {
+
+    // Only the ex callback needs the converted copy
     if (!vscp_convertEventToEventEx(&ex, &ev)) {
-      spdlog::trace("VSCP MQTT CLIENT: bin->EventEx conversion failed. Payload is not VSCP event.");
+      VSCP_LOG_TRACE("VSCP MQTT CLIENT: Event->EventEx conversion failed. Payload is not VSCP event.");
+      delete[] ev.pdata;
       return false;
     }
 
     writeEventDefaultsFromTopic(ex, pmsg->topic);
-
-    // If callback is defined send event
-    if (isCallbackEvActive()) {
-      m_callbackev(ev, getCallbackObj());
-    }
-    else if (isCallbackExActive()) {
-      m_callbackex(ex, getCallbackObj());
+    callbackex(ex, pobj);
+  }
+  else {
+    // Put event in input queue. The decoded data is handed
+    // over as is so no extra copy is needed.
+    vscpEvent *pEvent = new vscpEvent;
+    if (nullptr == pEvent) {
+      spdlog::critical("VSCP MQTT CLIENT: Memory problem.");
+      delete[] ev.pdata;
+      return false;
     }
-    else {
-      // Put event in input queue
-      vscpEvent *pEvent = new vscpEvent;
-      if (nullptr == pEvent) {
-        spdlog::critical("VSCP MQTT CLIENT: Memory problem.");
-        return false;
-      }
 
-      pEvent->pdata = nullptr;
+    *pEvent  = ev;
+    ev.pdata = nullptr;
 
-      if (!vscp_copyEvent(pEvent, &ev)) {
-        spdlog::critical("VSCP MQTT CLIENT: Memory problem.");
-        delete pEvent;
-        return false;
-      }
-
-      // Save event in incoming queue
-      if (m_receiveQueue.size() < MQTT_MAX_INQUEUE_SIZE) {
-        pthread_mutex_lock(&m_mutexReceiveQueue);
-        m_receiveQueue.push_back(pEvent);
+    // Save event in incoming queue
+    pthread_mutex_lock(&m_mutexReceiveQueue);
+    if (m_receiveQueue.size() < MQTT_MAX_INQUEUE_SIZE) {
+      m_receiveQueue.push_back(pEvent);
 #ifdef WIN32
-        ReleaseSemaphore(m_semReceiveQueue, 1, NULL);
+      ReleaseSemaphore(m_semReceiveQueue, 1, NULL);
 #else
-        sem_post(&m_semReceiveQueue);
+      sem_post(&m_semReceiveQueue);
 #endif
-        pthread_mutex_unlock(&m_mutexReceiveQueue);
-      }
     }
+    else {
+      vscp_deleteEvent_v2(&pEvent);
+    }
+    pthread_mutex_unlock(&m_mutexReceiveQueue);
   }
 
+  // Callbacks copy what they need
+  delete[] ev.pdata;
+
   return true;
 }
 
@@ -2132,7 +2103,7 @@ vscpClientMqtt::connect(void)
     return VSCP_ERROR_ERROR;
   }
 
-  spdlog::trace("VSCP MQTT CLIENT: Waiting for connection to be established.");
+  VSCP_LOG_TRACE("VSCP MQTT CLIENT: Waiting for connection to be established.");
   uint32_t now = vscp_getMsTimeStamp();
   while (!m_bConnected) {
     // Wait for connection to be established m_timeoutConnection
@@ -2310,6 +2281,60 @@ vscpClientMqtt::isConnected(void)
 int
 vscpClientMqtt::send(vscpEvent &ev)
 {
+  if (m_coalesce.isEnabled()) {
+    uint64_t now = vscpCoalesce::getTime();
+
+    // Held back measurements that are due go out first
+    if (m_coalesce.isDue(now)) {
+      flushCoalesced();
+    }
+
+    if (!m_coalesce.check(vscp_event_view(ev), now)) {
+      return VSCP_ERROR_SUCCESS;
+    }
+  }
+
+  return sendToTopics(ev);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// flushCoalesced
+//
+
+size_t
+vscpClientMqtt::flushCoalesced(bool bAll)
+{
+  vscpCoalesceHandler fn = [this](vscpEvent &ev) {
+    sendToTopics(ev);
+  };
+
+  return bAll ? m_coalesce.flushAll(fn) : m_coalesce.flush(fn);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// restartCoalesce
+//
+
+size_t
+vscpClientMqtt::restartCoalesce(void)
+{
+  // Held back measurements are the last state, they go out first
+  size_t cnt = flushCoalesced(true);
+
+  // Publish the next value of each measurement
+  m_coalesce.clear();
+
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendToTopics
+//
+
+int
+vscpClientMqtt::sendToTopics(vscpEvent &ev)
+{
+  VSCP_METRIC_TIMER("vscp_mqtt_publish_ns", "Time to encode and publish an event on all MQTT publish topics");
   std::string str;
   uint8_t payload[1024];
   size_t lenPayload = 0;
@@ -2487,12 +2512,15 @@ vscpClientMqtt::send(vscpEvent &ev)
       data.set("xclass", vscp_str_format("%02x", ev.vscp_class));
       data.set("xtype", vscp_str_format("%02x", ev.vscp_type));
 
-      if (nullptr != m_pmap_class) {
-        data.set("class-token", (*m_pmap_class)[ev.vscp_class]);
+      if (nullptr != m_ptokens) {
+        data.set("class-token", m_ptokens->getClassToken(ev.vscp_class));
+        data.set("type-token", m_ptokens->getTypeToken(ev.vscp_class, ev.vscp_type));
       }
-
-      if (nullptr != m_pmap_type) {
-        data.set("type-token", (*m_pmap_type)[((ev.vscp_class << 16) + ev.vscp_type)]);
+      else {
+        const char *pClassToken = vscp_getBuiltinClassToken(ev.vscp_class);
+        const char *pTypeToken  = vscp_getBuiltinTypeToken(ev.vscp_class, ev.vscp_type);
+        data.set("class-token", (nullptr != pClassToken) ? pClassToken : "");
+        data.set("type-token", (nullptr != pTypeToken) ? pTypeToken : "");
       }
 
       data.set("head", vscp_str_format("%d", ev.head));
@@ -2562,15 +2590,15 @@ vscpClientMqtt::send(vscpEvent &ev)
       strTopic = subtemplate.render(data);
     }
 
-    spdlog::trace("VSCP MQTT CLIENT: sendEvent: Publish send ev: Topic: {0} qos={1} retain={2}",
-                  strTopic,
-                  ppublish->getQos(),
-                  ppublish->getRetain());
+    VSCP_LOG_TRACE("VSCP MQTT CLIENT: sendEvent: Publish send ev: Topic: {0} qos={1} retain={2}",
+                   strTopic,
+                   ppublish->getQos(),
+                   ppublish->getRetain());
 
-    spdlog::trace("MQTT send; len={0} QOS={1} retain={2}\n",
-                  (int) lenPayload,
-                  ppublish->getQos(),
-                  (ppublish->getRetain() ? "true" : "false"));
+    VSCP_LOG_TRACE("MQTT send; len={0} QOS={1} retain={2}\n",
+                   (int) lenPayload,
+                   ppublish->getQos(),
+                   (ppublish->getRetain() ? "true" : "false"));
 
     if (MOSQ_ERR_SUCCESS != (rv = mosquitto_publish(m_mosq,
                                                     NULL, // msg id
@@ -2597,6 +2625,19 @@ vscpClientMqtt::send(vscpEvent &ev)
 int
 vscpClientMqtt::send(vscpEventEx &ex)
 {
+  if (m_coalesce.isEnabled()) {
+    uint64_t now = vscpCoalesce::getTime();
+
+    if (m_coalesce.isDue(now)) {
+      flushCoalesced();
+    }
+
+    if (!m_coalesce.check(vscp_event_view(ex), now)) {
+      return VSCP_ERROR_SUCCESS;
+    }
+  }
+
+  VSCP_METRIC_TIMER("vscp_mqtt_publish_ns", "Time to encode and publish an event on all MQTT publish topics");
   std::string str;
   uint8_t payload[1024];
   size_t lenPayload = 0;
@@ -2765,12 +2806,15 @@ vscpClientMqtt::send(vscpEventEx &ex)
       data.set("xclass", vscp_str_format("%02x", ex.vscp_class));
       data.set("xtype", vscp_str_format("%02x", ex.vscp_type));
 
-      if (nullptr != m_pmap_class) {
-        data.set("class-token", (*m_pmap_class)[ex.vscp_class]);
+      if (nullptr != m_ptokens) {
+        data.set("class-token", m_ptokens->getClassToken(ex.vscp_class));
+        data.set("type-token", m_ptokens->getTypeToken(ex.vscp_class, ex.vscp_type));
       }
-
-      if (nullptr != m_pmap_type) {
-        data.set("type-token", (*m_pmap_type)[((ex.vscp_class << 16) + ex.vscp_type)]);
+      else {
+        const char *pClassToken = vscp_getBuiltinClassToken(ex.vscp_class);
+        const char *pTypeToken  = vscp_getBuiltinTypeToken(ex.vscp_class, ex.vscp_type);
+        data.set("class-token", (nullptr != pClassToken) ? pClassToken : "");
+        data.set("type-token", (nullptr != pTypeToken) ? pTypeToken : "");
       }
 
       data.set("head", vscp_str_format("%d", ex.head));
@@ -2833,11 +2877,11 @@ vscpClientMqtt::send(vscpEventEx &ex)
       strTopic = subtemplate.render(data);
     }
 
-    spdlog::trace("VSCP MQTT CLIENT: sendEvent: Publish send ex: Topic: {0} qos={1} retain={2}",
-                  strTopic,
-                  /*(unsigned char *)payload,*/
-                  ppublish->getQos(),
-                  ppublish->getRetain());
+    VSCP_LOG_TRACE("VSCP MQTT CLIENT: sendEvent: Publish send ex: Topic: {0} qos={1} retain={2}",
+                   strTopic,
+                   /*(unsigned char *)payload,*/
+                   ppublish->getQos(),
+                   ppublish->getRetain());
 
     if (MOSQ_ERR_SUCCESS != (rv = mosquitto_publish(m_mosq,
                                                     NULL, // msg id
@@ -119,6 +119,13 @@
         }
       ],
       "bescape-pub-topics": true,
+      "coalesce": {
+        "enable": false,
+        "deadband": 0.0,
+        "window": 60000,
+        "min-interval": 0,
+        "max-keys": 4096
+      },
       "publish": [
         {
           "topic": "publish/topic/A",
@@ -147,6 +154,9 @@ host - If starts with stcp:\\ secure connection is expected. If no prefix or tcp
 port - is host contains server port then a separate define of port is not needed.
 mqtt-options/tcp-nodelay is true by default disabling nigles algorithm.
 mqtt-options/protocol-version can be set to 310/311/500
+coalesce - Suppress measurement events with an unchanged value (within
+        deadband) for window ms and publish each measurement at most
+        every min-interval ms. See vscpCoalesce.
 */
 
 #if !defined(VSCPCLIENTMQTT_H__INCLUDED_)
@@ -156,6 +166,8 @@ mqtt-options/protocol-version can be set to 310/311/500
 #include <guid.h>
 #include <vscp.h>
 #include <vscphelper.h>
+#include <vscp-coalesce.h>
+#include <vscp-token.h>
 
 #include <mosquitto.h>
 #include <pthread.h>
@@ -404,6 +416,23 @@ public:
   */
   virtual int send(canalMsg &msg);
 
+  /*!
+      Publish measurement events held back by the minimum interval
+      that are due. Should be called periodically when coalescing
+      is enabled, send() only does it when there is traffic.
+      @param bAll Publish all held back events, due or not.
+      @return Number of events published.
+  */
+  size_t flushCoalesced(bool bAll = false);
+
+  /*!
+      Called when connected to the broker, which may have lost state.
+      Held back measurement events are published and tracked values
+      are forgotten so the next value of each measurement is published.
+      @return Number of held back events published.
+  */
+  size_t restartCoalesce(void);
+
   /*!
       Receive VSCP event from remote host
       @return Return VSCP_ERROR_SUCCESS of OK and error code else.
@@ -638,16 +667,29 @@ public:
   struct mosquitto *getMqttHandle(void) { return m_mosq; };
 
   /*!
-    SetTokenMaps
-    Store pointers to maps that are used to get token from
+    setTokenTable
+    Store pointer to the table that is used to get token from
     VSCP class or VSCP type codes. The tokens are used in
-    the send routines to escape MQTT topics
+    the send routines to escape MQTT topics. If not set the
+    built in tokens are used. The table is only read.
+    @param ptokens Pointer to token table or nullptr
   */
-  void setTokenMaps(std::map<uint16_t, std::string> *pmap_class, std::map<uint32_t, std::string> *pmap_type)
-  {
-    m_pmap_class = pmap_class;
-    m_pmap_type  = pmap_type;
-  }
+  void setTokenTable(const vscpTokenTable *ptokens) { m_ptokens = ptokens; }
+
+  // Token table in use, nullptr if the built in tokens are used
+  const vscpTokenTable *getTokenTable(void) const { return m_ptokens; }
+
+  /*!
+    setTokenMaps
+    Kept for existing callers, use setTokenTable instead. The
+    tokens in the maps are copied to a table owned by the client
+    where they override the built in tokens, so later changes to
+    the maps are not seen. Call before connect.
+    @param pmap_class Class tokens or nullptr
+    @param pmap_type Type tokens with key (vscp_class << 16) + vscp_type
+            or nullptr. With both nullptr the built in tokens are used.
+  */
+  void setTokenMaps(std::map<uint16_t, std::string> *pmap_class, std::map<uint32_t, std::string> *pmap_type);
 
   /*!
     Define user escape.
@@ -728,6 +770,14 @@ public:
   */
   int doSubscribe(void);
 
+private:
+  /*!
+    Publish an event on all publish topics
+    @param ev VSCP event
+    @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  int sendToTopics(vscpEvent &ev);
+
 public:
   // Timeout in milliseconds for host connection.
   uint32_t m_timeoutConnection;
@@ -754,6 +804,12 @@ public:
   */
   bool m_bJsonMeasurementAdd;
 
+  /*!
+    Deduplication and rate limiting of published
+    measurement events. Disabled by default.
+  */
+  vscpCoalesce m_coalesce;
+
   /*!
     Use topic for defaults.
 
@@ -852,17 +908,14 @@ private:
   std::map<std::string, std::string> m_mapUserEscapes;
 
   /*!
-    Pointer to map that maps a VSCP class code to it's string
-    token. This is used in send to escape MQTT topics.
+    Pointer to table that maps VSCP class and type codes to
+    their string tokens. This is used in send to escape MQTT
+    topics. Built in tokens are used if nullptr.
   */
-  std::map<uint16_t, std::string> *m_pmap_class;
+  const vscpTokenTable *m_ptokens;
 
-  /*!
-    Pointer to map that maps a VSCP type code to it's string
-    token. This is used in send to escape MQTT topics.
-    key: vscp_class << 16 + vscp_type
-  */
-  std::map<uint32_t, std::string> *m_pmap_type;
+  // Table filled by setTokenMaps
+  vscpTokenTable m_mapTokens;
 
   /*!
       Specific interface to bind to.
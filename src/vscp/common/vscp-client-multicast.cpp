@@ -976,19 +976,24 @@ workerThread(vscpClientMulticast *pClient)
 
           if (vscp_doLevel2Filter(&ev, &pClient->m_filter)) {
 
-            if (pClient->isCallbackEvActive()) {
-              pClient->m_callbackev(ev, pClient->getCallbackObj());
+            std::function<void(vscpEvent &ev, void *pobj)> callbackev;
+            std::function<void(vscpEventEx &ex, void *pobj)> callbackex;
+            void *pobj;
+            pClient->getCallbacks(callbackev, callbackex, &pobj);
+
+            if (callbackev) {
+              callbackev(ev, pobj);
             }
 
-            if (pClient->isCallbackExActive()) {
+            if (callbackex) {
               vscpEventEx ex;
               if (vscp_convertEventToEventEx(&ex, &ev)) {
-                pClient->m_callbackex(ex, pClient->getCallbackObj());
+                callbackex(ex, pobj);
               }
             }
 
             // Add to input queue only if no callback set
-            if (!pClient->isCallbackEvActive() || !pClient->isCallbackExActive()) {
+            if (!callbackev || !callbackex) {
               pthread_mutex_lock(&pClient->m_mutexReceiveQueue);
               pClient->m_receiveQueue.push_back(&ev);
 #ifdef WIN32
@@ -0,0 +1,845 @@
+// vscp_client_shm.cpp
+//
+// Shared memory client communication classes.
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version
+// 2 of the License, or (at your option) any later version.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// Copyright:  (C) 2007-2026
+// Ake Hedman, the VSCP project, <info@vscp.org>
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file see the file COPYING.  If not, write to
+// the Free Software Foundation, 59 Temple Place - Suite 330,
+// Boston, MA 02111-1307, USA.
+//
+
+// !!! Only Linux  !!!
+#ifndef WIN32
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include <nlohmann/json.hpp> // Needs C++11  -std=c++11
+
+#include <spdlog/spdlog.h>
+
+#include "vscp-client-shm.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// C-tor
+//
+
+vscpClientShm::vscpClientShm()
+{
+  m_type              = CVscpClient::connType::SHM;
+  m_path              = VSCP_SHM_DEFAULT_PATH;
+  m_queueSize         = VSCP_SHM_DEFAULT_QUEUE_SIZE;
+  m_connectionTimeout = SHM_CLIENT_DEFAULT_CONNECTION_TIMEOUT;
+  m_responseTimeout   = SHM_CLIENT_DEFAULT_RESPONSE_TIMEOUT;
+  m_sock              = -1;
+  m_bConnected        = false;
+  m_bRun              = false;
+  m_threadWork        = 0;
+  m_cntSendFail       = 0;
+
+  vscp_clearVSCPFilter(&m_filter); // Accept all events
+
+  pthread_mutex_init(&m_mutexSend, NULL);
+  pthread_mutex_init(&m_mutexReceive, NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// D-tor
+//
+
+vscpClientShm::~vscpClientShm()
+{
+  disconnect();
+
+  pthread_mutex_destroy(&m_mutexSend);
+  pthread_mutex_destroy(&m_mutexReceive);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init
+//
+
+int
+vscpClientShm::init(const std::string &path, uint32_t queueSize)
+{
+  m_path      = path;
+  m_queueSize = queueSize;
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getConfigAsJson
+//
+
+std::string
+vscpClientShm::getConfigAsJson(void)
+{
+  json j;
+  std::string str;
+
+  j["path"]               = m_path;
+  j["queue-size"]         = m_queueSize;
+  j["connection-timeout"] = m_connectionTimeout;
+  j["response-timeout"]   = m_responseTimeout;
+
+  vscp_writeFilterToString(str, &m_filter);
+  j["filter"]["in-filter"] = str;
+  vscp_writeMaskToString(str, &m_filter);
+  j["filter"]["in-mask"] = str;
+
+  return j.dump();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// initFromJson
+//
+
+bool
+vscpClientShm::initFromJson(const std::string &config)
+{
+  try {
+
+    m_j_config = json::parse(config);
+
+    // Server socket
+    if (m_j_config.contains("path")) {
+      m_path = m_j_config["path"].get<std::string>();
+      spdlog::debug("SHM client: json init: path set to {}.", m_path);
+    }
+
+    // Events in each ring
+    if (m_j_config.contains("queue-size")) {
+      m_queueSize = m_j_config["queue-size"].get<uint32_t>();
+      spdlog::debug("SHM client: json init: queue-size set to {}.", m_queueSize);
+    }
+
+    // Connection timeout
+    if (m_j_config.contains("connection-timeout")) {
+      setConnectionTimeout(m_j_config["connection-timeout"].get<uint32_t>());
+      spdlog::debug("SHM client: json init: connection-timeout set to {}.", m_connectionTimeout);
+    }
+
+    // Response timeout
+    if (m_j_config.contains("response-timeout")) {
+      setResponseTimeout(m_j_config["response-timeout"].get<uint32_t>());
+      spdlog::debug("SHM client: json init: response-timeout set to {}.", m_responseTimeout);
+    }
+
+    // Filter
+    if (m_j_config.contains("filter") && m_j_config["filter"].is_object()) {
+
+      json j = m_j_config["filter"];
+
+      if (j.contains("in-filter")) {
+        std::string str = j["in-filter"].get<std::string>();
+        if (!vscp_readFilterFromString(&m_filter, str)) {
+          spdlog::error("SHM client: Failed to read 'in-filter'.");
+        }
+      }
+
+      if (j.contains("in-mask")) {
+        std::string str = j["in-mask"].get<std::string>();
+        if (!vscp_readMaskFromString(&m_filter, str)) {
+          spdlog::error("SHM client: Failed to read 'in-mask'.");
+        }
+      }
+    }
+  }
+  catch (const std::exception &ex) {
+    spdlog::error("SHM client: json init: Failed to parse json: {}", ex.what());
+    return false;
+  }
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// connect
+//
+
+int
+vscpClientShm::connect(void)
+{
+  struct sockaddr_un addr;
+  vscp_shm_msg msg;
+
+  // We are already connected we are done
+  if (isConnected()) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  // Clean up after a server that went away
+  disconnect();
+
+  if (m_path.empty() || (m_path.length() >= sizeof(addr.sun_path))) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, m_path.c_str(), sizeof(addr.sun_path) - 1);
+
+  if (-1 == (m_sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0))) {
+    return VSCP_ERROR_SOCKET;
+  }
+
+  if (-1 == ::connect(m_sock, (struct sockaddr *) &addr, sizeof(addr))) {
+    spdlog::error("SHM client: Failed to connect to {}. errno={}", m_path, errno);
+    closeChannel();
+    return VSCP_ERROR_CONNECTION;
+  }
+
+  // Ask for a channel
+  memset(&msg, 0, sizeof(msg));
+  memcpy(msg.magic, VSCP_SHM_MAGIC, sizeof(msg.magic));
+  msg.version   = VSCP_SHM_VERSION;
+  msg.cmd       = VSCP_SHM_CMD_HELLO;
+  msg.queueSize = m_queueSize;
+  if (-1 == ::send(m_sock, &msg, sizeof(msg), MSG_NOSIGNAL)) {
+    closeChannel();
+    return VSCP_ERROR_COMMUNICATION;
+  }
+
+  struct pollfd pfd;
+  pfd.fd     = m_sock;
+  pfd.events = POLLIN;
+  if (1 != poll(&pfd, 1, (int) m_connectionTimeout)) {
+    closeChannel();
+    return VSCP_ERROR_TIMEOUT;
+  }
+
+  // The reply carries the segment and the doorbells
+  struct iovec iov;
+  iov.iov_base = &msg;
+  iov.iov_len  = sizeof(msg);
+
+  union {
+    char buf[CMSG_SPACE(3 * sizeof(int))];
+    struct cmsghdr align;
+  } ctrl;
+
+  struct msghdr mh;
+  memset(&mh, 0, sizeof(mh));
+  mh.msg_iov        = &iov;
+  mh.msg_iovlen     = 1;
+  mh.msg_control    = ctrl.buf;
+  mh.msg_controllen = sizeof(ctrl.buf);
+
+  ssize_t n = recvmsg(m_sock, &mh, MSG_CMSG_CLOEXEC);
+
+  int fds[3]  = { -1, -1, -1 };
+  size_t nfds = 0;
+  for (struct cmsghdr *pcmsg = CMSG_FIRSTHDR(&mh); nullptr != pcmsg; pcmsg = CMSG_NXTHDR(&mh, pcmsg)) {
+    if ((SOL_SOCKET == pcmsg->cmsg_level) && (SCM_RIGHTS == pcmsg->cmsg_type)) {
+      nfds = (pcmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+      memcpy(fds, CMSG_DATA(pcmsg), std::min(nfds, (size_t) 3) * sizeof(int));
+    }
+  }
+
+  int rv = VSCP_ERROR_SUCCESS;
+  if (((size_t) n != sizeof(msg)) || memcmp(msg.magic, VSCP_SHM_MAGIC, sizeof(msg.magic)) ||
+      (VSCP_SHM_VERSION != msg.version) || (VSCP_SHM_CMD_HELLO != msg.cmd) || (mh.msg_flags & MSG_CTRUNC)) {
+    rv = VSCP_ERROR_INVALID_FRAME;
+  }
+  else if (VSCP_ERROR_SUCCESS != msg.result) {
+    rv = msg.result;
+  }
+  else if (3 != nfds) {
+    rv = VSCP_ERROR_INVALID_FRAME;
+  }
+
+  if (VSCP_ERROR_SUCCESS != rv) {
+    for (int i = 0; i < 3; i++) {
+      if (-1 != fds[i]) {
+        ::close(fds[i]);
+      }
+    }
+    spdlog::error("SHM client: Server at {} refused channel. rv={}", m_path, rv);
+    closeChannel();
+    return rv;
+  }
+
+  if (VSCP_ERROR_SUCCESS != (rv = m_channel.attach(fds[0], fds[1], fds[2], msg.size))) {
+    spdlog::error("SHM client: Invalid channel from server at {}. rv={}", m_path, rv);
+    closeChannel();
+    return rv;
+  }
+
+  if (VSCP_ERROR_SUCCESS != (rv = sendFilter())) {
+    closeChannel();
+    return rv;
+  }
+
+  m_bConnected = true;
+  m_bRun       = true;
+  if (pthread_create(&m_threadWork, NULL, workerThread, this)) {
+    spdlog::critical("SHM client: Failed to start worker thread");
+    m_threadWork = 0;
+    m_bRun       = false;
+    m_bConnected = false;
+    closeChannel();
+    return VSCP_ERROR_ERROR;
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// disconnect
+//
+
+int
+vscpClientShm::disconnect(void)
+{
+  m_bRun = false;
+  if (m_threadWork) {
+    pthread_join(m_threadWork, NULL);
+    m_threadWork = 0;
+  }
+
+  closeChannel();
+  m_bConnected = false;
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// closeChannel
+//
+
+void
+vscpClientShm::closeChannel(void)
+{
+  pthread_mutex_lock(&m_mutexSend);
+  pthread_mutex_lock(&m_mutexReceive);
+
+  m_channel.close();
+  if (-1 != m_sock) {
+    ::close(m_sock);
+    m_sock = -1;
+  }
+
+  pthread_mutex_unlock(&m_mutexReceive);
+  pthread_mutex_unlock(&m_mutexSend);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// isConnected
+//
+
+bool
+vscpClientShm::isConnected(void)
+{
+  return m_bConnected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendWait
+//
+
+template<typename T>
+int
+vscpClientShm::sendWait(const T &e)
+{
+  if (!m_bConnected) {
+    return VSCP_ERROR_NOT_CONNECTED;
+  }
+
+  pthread_mutex_lock(&m_mutexSend);
+
+  int rv = m_channel.put(e);
+  if (VSCP_ERROR_FIFO_FULL == rv) {
+
+    // Give the server a moment to catch up
+    std::chrono::steady_clock::time_point deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeout);
+    while ((VSCP_ERROR_FIFO_FULL == rv) && m_bConnected && (std::chrono::steady_clock::now() < deadline)) {
+      usleep(100);
+      rv = m_channel.put(e);
+    }
+  }
+
+  pthread_mutex_unlock(&m_mutexSend);
+
+  if (VSCP_ERROR_SUCCESS != rv) {
+    m_cntSendFail++;
+  }
+
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// send
+//
+
+int
+vscpClientShm::send(vscpEvent &ev)
+{
+  return sendWait(ev);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// send
+//
+
+int
+vscpClientShm::send(vscpEventEx &ex)
+{
+  return sendWait(ex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// send
+//
+
+int
+vscpClientShm::send(canalMsg &msg)
+{
+  vscpEventEx ex;
+
+  uint8_t guid[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+  if (!vscp_convertCanalToEventEx(&ex, &msg, guid)) {
+    return VSCP_ERROR_INVALID_FRAME;
+  }
+
+  return send(ex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// receive
+//
+
+int
+vscpClientShm::receive(vscpEvent &ev)
+{
+  pthread_mutex_lock(&m_mutexReceive);
+  int rv = m_channel.get(ev);
+  pthread_mutex_unlock(&m_mutexReceive);
+
+  if (VSCP_ERROR_INVALID_FRAME == rv) {
+    spdlog::error("SHM client: Corrupt event from server at {}.", m_path);
+  }
+  else if ((VSCP_ERROR_NOT_OPEN == rv) || ((VSCP_ERROR_FIFO_EMPTY == rv) && !m_bConnected)) {
+    rv = VSCP_ERROR_NOT_CONNECTED;
+  }
+
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// receive
+//
+
+int
+vscpClientShm::receive(vscpEventEx &ex)
+{
+  int rv;
+  vscpEvent ev;
+
+  if (VSCP_ERROR_SUCCESS != (rv = receive(ev))) {
+    return rv;
+  }
+
+  rv = vscp_convertEventToEventEx(&ex, &ev) ? VSCP_ERROR_SUCCESS : VSCP_ERROR_ERROR;
+  if (nullptr != ev.pdata) {
+    delete[] ev.pdata;
+  }
+
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// receive
+//
+
+int
+vscpClientShm::receive(canalMsg &msg)
+{
+  int rv;
+  vscpEvent ev;
+
+  if (VSCP_ERROR_SUCCESS != (rv = receive(ev))) {
+    return rv;
+  }
+
+  rv = vscp_convertEventToCanal(&msg, &ev) ? VSCP_ERROR_SUCCESS : VSCP_ERROR_INVALID_FRAME;
+  if (nullptr != ev.pdata) {
+    delete[] ev.pdata;
+  }
+
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// receiveBlocking
+//
+
+int
+vscpClientShm::receiveBlocking(vscpEvent &ev, long timeout)
+{
+  std::chrono::steady_clock::time_point deadline =
+    std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+  while (true) {
+
+    int rv = receive(ev);
+    if (VSCP_ERROR_FIFO_EMPTY != rv) {
+      return rv;
+    }
+
+    long remaining = (long) std::chrono::duration_cast<std::chrono::milliseconds>(
+                       deadline - std::chrono::steady_clock::now())
+                       .count();
+    if (remaining <= 0) {
+      return VSCP_ERROR_TIMEOUT;
+    }
+
+    // Sleep on the doorbell until the server has written something. A
+    // doorbell left from an earlier wait just takes us around again.
+    pthread_mutex_lock(&m_mutexReceive);
+    bool bWait = m_channel.arm();
+    int fd     = m_channel.getDoorbell();
+    pthread_mutex_unlock(&m_mutexReceive);
+
+    if (bWait) {
+      struct pollfd pfd;
+      pfd.fd     = fd;
+      pfd.events = POLLIN;
+      if (1 == poll(&pfd, 1, (int) remaining)) {
+        pthread_mutex_lock(&m_mutexReceive);
+        m_channel.clearDoorbell();
+        pthread_mutex_unlock(&m_mutexReceive);
+      }
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// receiveBlocking
+//
+
+int
+vscpClientShm::receiveBlocking(vscpEventEx &ex, long timeout)
+{
+  int rv;
+  vscpEvent ev;
+
+  if (VSCP_ERROR_SUCCESS != (rv = receiveBlocking(ev, timeout))) {
+    return rv;
+  }
+
+  rv = vscp_convertEventToEventEx(&ex, &ev) ? VSCP_ERROR_SUCCESS : VSCP_ERROR_ERROR;
+  if (nullptr != ev.pdata) {
+    delete[] ev.pdata;
+  }
+
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// receiveBlocking
+//
+
+int
+vscpClientShm::receiveBlocking(canalMsg &msg, long timeout)
+{
+  int rv;
+  vscpEvent ev;
+
+  if (VSCP_ERROR_SUCCESS != (rv = receiveBlocking(ev, timeout))) {
+    return rv;
+  }
+
+  rv = vscp_convertEventToCanal(&msg, &ev) ? VSCP_ERROR_SUCCESS : VSCP_ERROR_INVALID_FRAME;
+  if (nullptr != ev.pdata) {
+    delete[] ev.pdata;
+  }
+
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// setfilter
+//
+
+int
+vscpClientShm::setfilter(vscpEventFilter &filter)
+{
+  memcpy(&m_filter, &filter, sizeof(vscpEventFilter));
+
+  // Sent when connecting if not connected now
+  if (!m_bConnected) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  return sendFilter();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendFilter
+//
+
+int
+vscpClientShm::sendFilter(void)
+{
+  vscp_shm_msg msg;
+
+  memset(&msg, 0, sizeof(msg));
+  memcpy(msg.magic, VSCP_SHM_MAGIC, sizeof(msg.magic));
+  msg.version = VSCP_SHM_VERSION;
+  msg.cmd     = VSCP_SHM_CMD_FILTER;
+  memcpy(&msg.filter, &m_filter, sizeof(vscpEventFilter));
+
+  if (-1 == ::send(m_sock, &msg, sizeof(msg), MSG_NOSIGNAL)) {
+    return VSCP_ERROR_COMMUNICATION;
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getcount
+//
+
+int
+vscpClientShm::getcount(uint16_t *pcount)
+{
+  if (nullptr == pcount) {
+    return VSCP_ERROR_INVALID_POINTER;
+  }
+
+  pthread_mutex_lock(&m_mutexReceive);
+  uint32_t cnt = m_channel.getCount();
+  pthread_mutex_unlock(&m_mutexReceive);
+
+  *pcount = (cnt > 0xffff) ? 0xffff : (uint16_t) cnt;
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// clear
+//
+
+int
+vscpClientShm::clear(void)
+{
+  pthread_mutex_lock(&m_mutexReceive);
+  m_channel.flush();
+  pthread_mutex_unlock(&m_mutexReceive);
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getversion
+//
+
+int
+vscpClientShm::getversion(uint8_t *pmajor, uint8_t *pminor, uint8_t *prelease, uint8_t *pbuild)
+{
+  if ((nullptr == pmajor) || (nullptr == pminor) || (nullptr == prelease) || (nullptr == pbuild)) {
+    return VSCP_ERROR_INVALID_POINTER;
+  }
+
+  *pmajor   = VSCP_MAJOR_SHM_CLIENT_VERSION;
+  *pminor   = VSCP_MINOR_SHM_CLIENT_VERSION;
+  *prelease = VSCP_RELEASE_SHM_CLIENT_VERSION;
+  *pbuild   = VSCP_BUILD_SHM_CLIENT_VERSION;
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getinterfaces
+//
+
+int
+vscpClientShm::getinterfaces(std::deque<std::string> & /*iflist*/)
+{
+  // No interfaces available
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getwcyd
+//
+
+int
+vscpClientShm::getwcyd(uint64_t &wcyd)
+{
+  wcyd = VSCP_SERVER_CAPABILITY_NONE; // No capabilities
+  return VSCP_ERROR_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// setConnectionTimeout
+//
+
+void
+vscpClientShm::setConnectionTimeout(uint32_t timeout)
+{
+  m_connectionTimeout = timeout;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// getConnectionTimeout
+//
+
+uint32_t
+vscpClientShm::getConnectionTimeout(void)
+{
+  return m_connectionTimeout;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// setResponseTimeout
+//
+
+void
+vscpClientShm::setResponseTimeout(uint32_t timeout)
+{
+  m_responseTimeout = timeout;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// getResponseTimeout
+//
+
+uint32_t
+vscpClientShm::getResponseTimeout(void)
+{
+  return m_responseTimeout;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendToCallbacks
+//
+
+void
+vscpClientShm::sendToCallbacks(vscpEvent &ev)
+{
+  std::function<void(vscpEvent &ev, void *pobj)> callbackev;
+  std::function<void(vscpEventEx &ex, void *pobj)> callbackex;
+  void *pobj;
+  getCallbacks(callbackev, callbackex, &pobj);
+
+  if (callbackev) {
+    callbackev(ev, pobj);
+  }
+
+  if (callbackex) {
+    vscpEventEx ex;
+    vscp_convertEventToEventEx(&ex, &ev);
+    callbackex(ex, pobj);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+//                          Workerthread
+//////////////////////////////////////////////////////////////////////
+
+void *
+vscpClientShm::workerThread(void *pData)
+{
+  vscp_shm_msg msg;
+  vscpEvent ev;
+
+  vscpClientShm *pClient = (vscpClientShm *) pData;
+  if (nullptr == pClient) {
+    spdlog::error("SHM client: No object data object supplied for worker thread");
+    return NULL;
+  }
+
+  while (pClient->m_bRun) {
+
+    struct pollfd pfd[2];
+    nfds_t nfds = 1;
+
+    // The socket only tells us the server is gone
+    pfd[0].fd      = pClient->m_sock;
+    pfd[0].events  = POLLIN;
+    pfd[0].revents = 0;
+
+    // With a callback we are the reader of the receive ring
+    if (pClient->isCallbackEvActive() || pClient->isCallbackExActive()) {
+
+      int rv;
+      pthread_mutex_lock(&pClient->m_mutexReceive);
+      while (VSCP_ERROR_SUCCESS == (rv = pClient->m_channel.get(ev))) {
+        pClient->sendToCallbacks(ev);
+        if (nullptr != ev.pdata) {
+          delete[] ev.pdata;
+        }
+      }
+      bool bWait = (VSCP_ERROR_FIFO_EMPTY == rv) && pClient->m_channel.arm();
+      pthread_mutex_unlock(&pClient->m_mutexReceive);
+
+      if (VSCP_ERROR_INVALID_FRAME == rv) {
+        spdlog::error("SHM client: Corrupt event from server at {}. Disconnecting.", pClient->m_path);
+        break;
+      }
+
+      if (!bWait) {
+        continue;
+      }
+
+      pfd[1].fd      = pClient->m_channel.getDoorbell();
+      pfd[1].events  = POLLIN;
+      pfd[1].revents = 0;
+      nfds           = 2;
+    }
+
+    if (-1 == poll(pfd, nfds, SHM_CLIENT_WAIT_TIMEOUT)) {
+      if (EINTR == errno) {
+        continue;
+      }
+      break;
+    }
+
+    if (pfd[0].revents) {
+      // Nothing is expected from the server, zero is a hang up
+      ssize_t n = recv(pClient->m_sock, &msg, sizeof(msg), MSG_DONTWAIT);
+      if ((0 == n) || (pfd[0].revents & (POLLHUP | POLLERR))) {
+        spdlog::error("SHM client: Server at {} is gone.", pClient->m_path);
+        break;
+      }
+    }
+
+    if ((2 == nfds) && (pfd[1].revents & POLLIN)) {
+      pthread_mutex_lock(&pClient->m_mutexReceive);
+      pClient->m_channel.clearDoorbell();
+      pthread_mutex_unlock(&pClient->m_mutexReceive);
+    }
+  }
+
+  pClient->m_bConnected = false;
+
+  return NULL;
+}
+
+#endif // not windows
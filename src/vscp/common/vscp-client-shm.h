@@ -0,0 +1,303 @@
+// vscp_client_shm.h
+//
+// Shared memory client communication classes.
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version
+// 2 of the License, or (at your option) any later version.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// Copyright:  (C) 2007-2026
+// Ake Hedman, the VSCP project, <info@vscp.org>
+//
+// This file is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this file see the file COPYING.  If not, write to
+// the Free Software Foundation, 59 Temple Place - Suite 330,
+// Boston, MA 02111-1307, USA.
+//
+
+// !!! Only Linux  !!!
+#ifndef WIN32
+
+#if !defined(VSCPCLIENTSHM_H__INCLUDED_)
+#define VSCPCLIENTSHM_H__INCLUDED_
+
+#include <pthread.h>
+#include <semaphore.h>
+
+#include <atomic>
+#include <string>
+
+#include <vscp-client-base.h>
+#include <vscp-shm.h>
+#include <vscp.h>
+
+#include <nlohmann/json.hpp>
+
+// https://github.com/nlohmann/json
+using json = nlohmann::json;
+
+// Default time to wait for room in the send ring (ms)
+#define SHM_CLIENT_DEFAULT_RESPONSE_TIMEOUT 200
+
+// Default time to wait for the server to set up the channel (ms)
+#define SHM_CLIENT_DEFAULT_CONNECTION_TIMEOUT 3000
+
+// Worker checks for termination this often (ms)
+#define SHM_CLIENT_WAIT_TIMEOUT 100
+
+/*!
+  @class vscpClientShm
+  Exchange events with a server on the same host (vscpd) through a
+  shared memory channel.
+
+  Events are written to and read from rings in memory shared with the
+  server, so an event moves without being copied through the kernel.
+  The receive ring is the receive queue. Without a callback receive()
+  reads straight from it and events the client does not pick up in
+  time are dropped by the server. With a callback the worker thread
+  reads the ring and hands events to the callback.
+
+  The client notices when the server goes away and isConnected()
+  then returns false.
+*/
+
+class vscpClientShm : public CVscpClient {
+
+public:
+  vscpClientShm();
+  virtual ~vscpClientShm();
+
+  static const uint8_t VSCP_MAJOR_SHM_CLIENT_VERSION   = 1;
+  static const uint8_t VSCP_MINOR_SHM_CLIENT_VERSION   = 0;
+  static const uint8_t VSCP_RELEASE_SHM_CLIENT_VERSION = 0;
+  static const uint8_t VSCP_BUILD_SHM_CLIENT_VERSION   = 0;
+
+  /*!
+    Set up the client
+    @param path Path to the server socket.
+    @param queueSize Events in each ring. The server may give less.
+    @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  int init(const std::string &path, uint32_t queueSize = VSCP_SHM_DEFAULT_QUEUE_SIZE);
+
+  /*!
+      Connect to the server
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int connect(void);
+
+  /*!
+      Disconnect from the server
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int disconnect(void);
+
+  /*!
+      Check if connected.
+      @return true if connected, false otherwise.
+  */
+  virtual bool isConnected(void);
+
+  /*!
+      Send VSCP event to the server. Waits up to the response timeout
+      for room in the send ring.
+      @return Return VSCP_ERROR_SUCCESS of OK, VSCP_ERROR_FIFO_FULL if
+              there was no room, error code else.
+  */
+  virtual int send(vscpEvent &ev);
+
+  /*!
+      Send VSCP event ex to the server.
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int send(vscpEventEx &ex);
+
+  /*!
+      Send VSCP CAN(AL) message to the server.
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int send(canalMsg &msg);
+
+  /*!
+      Receive VSCP event from the server
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int receive(vscpEvent &ev);
+
+  /*!
+      Receive VSCP event ex from the server
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int receive(vscpEventEx &ex);
+
+  /*!
+      Receive CAN(AL) message from the server
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int receive(canalMsg &msg);
+
+  /*!
+      Blocking receive of VSCP event from the server
+      @param ev VSCP event that will get the result.
+      @param timeout Timeout in milliseconds. Default is 100 ms.
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int receiveBlocking(vscpEvent &ev, long timeout = 100);
+
+  /*!
+      Blocking receive of VSCP event ex from the server
+      @param ex VSCP event ex that will get the result.
+      @param timeout Timeout in milliseconds. Default is 100 ms.
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int receiveBlocking(vscpEventEx &ex, long timeout = 100);
+
+  /*!
+      Blocking receive of CAN(AL) message from the server
+      @param msg CANAL message that will get the result.
+      @param timeout Timeout in milliseconds. Default is 100 ms.
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int receiveBlocking(canalMsg &msg, long timeout = 100);
+
+  /*!
+      Set filter for events from the server. The filter is applied
+      by the server so filtered events never enter the ring.
+      @param filter VSCP Filter to set.
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int setfilter(vscpEventFilter &filter);
+
+  /*!
+      Get number of events waiting to be received
+      @param pcount Pointer to an unsigned integer that get the count of events.
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int getcount(uint16_t *pcount);
+
+  /*!
+      Clear the input queue
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int clear(void);
+
+  /*!
+      Get version from interface
+      @param pmajor Pointer to uint8_t that get major version of interface.
+      @param pminor Pointer to uint8_t that get minor version of interface.
+      @param prelease Pointer to uint8_t that get release version of interface.
+      @param pbuild Pointer to uint8_t that get build version of interface.
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int getversion(uint8_t *pmajor, uint8_t *pminor, uint8_t *prelease, uint8_t *pbuild);
+
+  /*!
+      Get interfaces
+      @param iflist Get a list of available interfaces
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int getinterfaces(std::deque<std::string> &iflist);
+
+  /*!
+      Get capabilities (wcyd) from remote interface
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  virtual int getwcyd(uint64_t &wcyd);
+
+  /*!
+      Return a JSON representation of connection
+      @return JSON representation as string
+  */
+  virtual std::string getConfigAsJson(void);
+
+  /*!
+      Set member variables from JSON representation of connection
+      @param config JSON representation as string
+      @return True on success, false on failure.
+  */
+  virtual bool initFromJson(const std::string &config);
+
+  /*!
+      Getter/setters for connection timeout
+      Time is in milliseconds
+  */
+  virtual void setConnectionTimeout(uint32_t timeout);
+  virtual uint32_t getConnectionTimeout(void);
+
+  /*!
+      Getter/setters for response timeout
+      Time is in milliseconds
+  */
+  virtual void setResponseTimeout(uint32_t timeout);
+  virtual uint32_t getResponseTimeout(void);
+
+  /// Number of events that could not be sent
+  uint64_t getSendFailCount(void) const { return m_cntSendFail.load(); };
+
+private:
+  // Worker thread
+  static void *workerThread(void *pData);
+
+  // Put an event or event ex in the send ring, wait for room
+  template<typename T> int sendWait(const T &e);
+
+  // Hand an event to the callbacks
+  void sendToCallbacks(vscpEvent &ev);
+
+  // Send a filter to the server
+  int sendFilter(void);
+
+  // Close channel and socket
+  void closeChannel(void);
+
+private:
+  // JSON configuration
+  json m_j_config;
+
+  // Path to the server socket
+  std::string m_path;
+
+  // Events in each ring asked for
+  uint32_t m_queueSize;
+
+  // Timeouts (ms)
+  uint32_t m_connectionTimeout;
+  uint32_t m_responseTimeout;
+
+  // Socket to the server, a hang up means it is gone
+  int m_sock;
+
+  // The channel
+  vscpShmChannel m_channel;
+
+  // Serializes senders, the send ring has one producer
+  pthread_mutex_t m_mutexSend;
+
+  // Serializes receivers, the receive ring has one consumer
+  pthread_mutex_t m_mutexReceive;
+
+  // Filter for events from the server
+  vscpEventFilter m_filter;
+
+  std::atomic<bool> m_bConnected;
+
+  /// Worker thread runs as long as this is true
+  std::atomic<bool> m_bRun;
+
+  pthread_t m_threadWork;
+
+  // Statistics
+  std::atomic<uint64_t> m_cntSendFail;
+};
+
+#endif
+
+#endif // not windows
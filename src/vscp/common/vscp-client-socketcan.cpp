@@ -51,7 +51,8 @@
 #include <time.h>
 
 #include <linux/can/raw.h>
-#include <linux/sockios.h> // For SIOCGSTAMP
+#include <linux/errqueue.h>   // For scm_timestamping
+#include <linux/net_tstamp.h> // For SO_TIMESTAMPING flags
 
 #include <expat.h>
 
@@ -116,6 +117,97 @@ canal_len2dlc(unsigned char len)
   return canal_tbllen2dlc[len];
 }
 
+///////////////////////////////////////////////////////////////////////////////
+//                          CSocketCanEventRing
+///////////////////////////////////////////////////////////////////////////////
+
+CSocketCanEventRing::CSocketCanEventRing(uint32_t size)
+{
+  // Round up to a power of two
+  uint32_t n = 1;
+  while (n < size) {
+    n <<= 1;
+  }
+
+  m_slots.resize(n);
+  m_mask = n - 1;
+  m_head.store(0);
+  m_tail.store(0);
+  m_overruns.store(0);
+
+  for (uint32_t i = 0; i < n; i++) {
+    memset(&m_slots[i].ev, 0, sizeof(vscpEvent));
+    m_slots[i].ev.pdata = m_slots[i].data;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// reserve
+//
+
+vscpEvent *
+CSocketCanEventRing::reserve(void)
+{
+  uint32_t head = m_head.load(std::memory_order_relaxed);
+  if ((head - m_tail.load(std::memory_order_acquire)) > m_mask) {
+    m_overruns.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  slot &s = m_slots[head & m_mask];
+  memset(&s.ev, 0, sizeof(vscpEvent));
+  s.ev.pdata = s.data;
+  return &s.ev;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// commit
+//
+
+void
+CSocketCanEventRing::commit(void)
+{
+  m_head.fetch_add(1, std::memory_order_release);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// front
+//
+
+vscpEvent *
+CSocketCanEventRing::front(void)
+{
+  uint32_t tail = m_tail.load(std::memory_order_relaxed);
+  if (tail == m_head.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+
+  return &m_slots[tail & m_mask].ev;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// pop
+//
+
+void
+CSocketCanEventRing::pop(void)
+{
+  uint32_t tail = m_tail.load(std::memory_order_relaxed);
+  if (tail != m_head.load(std::memory_order_acquire)) {
+    m_tail.store(tail + 1, std::memory_order_release);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// clear
+//
+
+void
+CSocketCanEventRing::clear(void)
+{
+  m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // C-tor
 //
@@ -161,13 +253,6 @@ vscpClientSocketCan::~vscpClientSocketCan()
 
   pthread_mutex_destroy(&m_mutexSendQueue);
   pthread_mutex_destroy(&m_mutexReceiveQueue);
-
-  // Clear the input queue (if needed)
-  while (m_receiveList.size()) {
-    vscpEvent *pev = m_receiveList.front();
-    m_receiveList.pop_front();
-    vscp_deleteEvent(pev);
-  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -183,6 +268,9 @@ vscpClientSocketCan::init(const std::string &interface,
   m_interface = interface;
   m_guid.getFromString(guid);
   m_flags = flags;
+  if (m_flags & FLAG_FD_MODE) {
+    m_mode = CANFD_MTU;
+  }
   setResponseTimeout(DEAULT_RESPONSE_TIMEOUT); // Response timeout 3 ms
   return VSCP_ERROR_SUCCESS;
 }
@@ -373,6 +461,31 @@ vscpClientSocketCan::isConnected(void)
   return m_bConnected;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// canalToFrame
+//
+
+size_t
+vscpClientSocketCan::canalToFrame(struct canfd_frame *pframe, const canalMsg *pmsg, bool bFD)
+{
+  memset(pframe, 0, sizeof(struct canfd_frame)); // init CAN FD frame, e.g. LEN = 0
+
+  // convert CanFrame to canfd_frame
+  pframe->can_id = pmsg->id;
+  pframe->can_id |= CAN_EFF_FLAG;
+  pframe->len   = (pmsg->sizeData > 8) ? 8 : pmsg->sizeData;
+  pframe->flags = pmsg->flags;
+  memcpy(pframe->data, pmsg->data, pframe->len);
+
+  if (bFD) {
+    // Ensure discrete CAN FD length values 0..8, 12, 16, 20, 24, 32, 64
+    pframe->len = canal_dlc2len(canal_tbllen2dlc[pframe->len]);
+    return CANFD_MTU;
+  }
+
+  return CAN_MTU;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // send
 //
@@ -389,30 +502,7 @@ vscpClientSocketCan::send(vscpEvent &ev)
     return VSCP_ERROR_PARAMETER;
   }
 
-  struct canfd_frame frame;
-  memset(&frame, 0, sizeof(frame)); // init CAN FD frame, e.g. LEN = 0
-
-  // convert CanFrame to canfd_frame
-  frame.can_id = canalMsg.id;
-  frame.can_id |= CAN_EFF_FLAG;
-  frame.len   = canalMsg.sizeData;
-  frame.flags = canalMsg.flags;
-  memcpy(frame.data, canalMsg.data, canalMsg.sizeData);
-
-  if (m_flags & FLAG_FD_MODE) {
-    // Ensure discrete CAN FD length values 0..8, 12, 16, 20, 24, 32, 64
-    frame.len = canal_dlc2len(canal_tbllen2dlc[frame.len]);
-  }
-
-  // send the frame
-  pthread_mutex_lock(&m_mutexSocket);
-  if (-1 == write(m_socket, &frame, sizeof(struct can_frame))) {
-    pthread_mutex_unlock(&m_mutexSocket);
-    return VSCP_ERROR_WRITE_ERROR;
-  }
-  pthread_mutex_unlock(&m_mutexSocket);
-
-  return VSCP_ERROR_SUCCESS;
+  return send(canalMsg);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -431,28 +521,27 @@ vscpClientSocketCan::send(vscpEventEx &ex)
     return VSCP_ERROR_PARAMETER;
   }
 
-  struct canfd_frame frame;
-  memset(&frame, 0, sizeof(frame)); // init CAN FD frame, e.g. LEN = 0
+  return send(canalMsg);
+}
 
-  // convert CanFrame to canfd_frame
-  frame.can_id = canalMsg.id;
-  frame.can_id |= CAN_EFF_FLAG;
-  frame.len   = canalMsg.sizeData;
-  frame.flags = canalMsg.flags;
-  memcpy(frame.data, canalMsg.data, canalMsg.sizeData);
+///////////////////////////////////////////////////////////////////////////////
+// send
+//
 
-  if (m_flags & FLAG_FD_MODE) {
-    // ensure discrete CAN FD length values 0..8, 12, 16, 20, 24, 32, 64
-    frame.len = canal_dlc2len(canal_tbllen2dlc[frame.len]);
+int
+vscpClientSocketCan::send(canalMsg &msg)
+{
+  if (m_socket <= 0) {
+    return VSCP_ERROR_WRITE_ERROR;
   }
 
+  struct canfd_frame frame;
+  size_t size = canalToFrame(&frame, &msg, (CANFD_MTU == m_mode));
+
   // send the frame
-  pthread_mutex_lock(&m_mutexSocket);
-  if (-1 == write(m_socket, &frame, sizeof(struct can_frame))) {
-    pthread_mutex_unlock(&m_mutexSocket);
+  if (-1 == write(m_socket, &frame, size)) {
     return VSCP_ERROR_WRITE_ERROR;
   }
-  pthread_mutex_unlock(&m_mutexSocket);
 
   return VSCP_ERROR_SUCCESS;
 }
@@ -462,34 +551,56 @@ vscpClientSocketCan::send(vscpEventEx &ex)
 //
 
 int
-vscpClientSocketCan::send(canalMsg &msg)
+vscpClientSocketCan::send(const canalMsg *pmsgs, uint32_t count, uint32_t *psent)
 {
+  struct canfd_frame frames[SOCKETCAN_SEND_BATCH];
+  struct iovec iov[SOCKETCAN_SEND_BATCH];
+  struct mmsghdr msgs[SOCKETCAN_SEND_BATCH];
+  uint32_t nSent = 0;
+
+  if (nullptr != psent) {
+    *psent = 0;
+  }
+
+  if (nullptr == pmsgs) {
+    return VSCP_ERROR_INVALID_POINTER;
+  }
+
   if (m_socket <= 0) {
     return VSCP_ERROR_WRITE_ERROR;
   }
 
-  struct canfd_frame frame;
-  memset(&frame, 0, sizeof(frame)); // init CAN FD frame, e.g. LEN = 0
+  bool bFD = (CANFD_MTU == m_mode);
 
-  // convert CanFrame to canfd_frame
-  frame.can_id = msg.id;
-  frame.can_id |= CAN_EFF_FLAG;
-  frame.len   = msg.sizeData;
-  frame.flags = msg.flags;
-  memcpy(frame.data, msg.data, msg.sizeData);
+  while (nSent < count) {
 
-  if (m_flags & FLAG_FD_MODE) {
-    // ensure discrete CAN FD length values 0..8, 12, 16, 20, 24, 32, 64
-    frame.len = canal_dlc2len(canal_tbllen2dlc[frame.len]);
+    uint32_t n = count - nSent;
+    if (n > SOCKETCAN_SEND_BATCH) {
+      n = SOCKETCAN_SEND_BATCH;
+    }
+
+    memset(msgs, 0, n * sizeof(struct mmsghdr));
+    for (uint32_t i = 0; i < n; i++) {
+      iov[i].iov_base            = &frames[i];
+      iov[i].iov_len             = canalToFrame(&frames[i], pmsgs + nSent + i, bFD);
+      msgs[i].msg_hdr.msg_iov    = &iov[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int rv = sendmmsg(m_socket, msgs, n, 0);
+    if (rv <= 0) {
+      if (nullptr != psent) {
+        *psent = nSent;
+      }
+      return VSCP_ERROR_WRITE_ERROR;
+    }
+
+    nSent += (uint32_t) rv;
   }
 
-  // send the frame
-  pthread_mutex_lock(&m_mutexSocket);
-  if (-1 == write(m_socket, &frame, sizeof(struct can_frame))) {
-    pthread_mutex_unlock(&m_mutexSocket);
-    return VSCP_ERROR_WRITE_ERROR;
+  if (nullptr != psent) {
+    *psent = nSent;
   }
-  pthread_mutex_unlock(&m_mutexSocket);
 
   return VSCP_ERROR_SUCCESS;
 }
@@ -503,21 +614,17 @@ vscpClientSocketCan::receive(vscpEvent &ev)
 {
   int rv = VSCP_ERROR_SUCCESS;
 
-  // Check if there are any events waiting
-  if (!m_receiveList.size()) {
-    return VSCP_ERROR_FIFO_EMPTY;
-  }
-
   pthread_mutex_lock(&m_mutexReceiveQueue);
-  vscpEvent *pev = m_receiveList.front();
+  vscpEvent *pev = m_receiveRing.front();
   if (nullptr == pev) {
     pthread_mutex_unlock(&m_mutexReceiveQueue);
-    return VSCP_ERROR_INVALID_POINTER;
+    return VSCP_ERROR_FIFO_EMPTY;
   }
-  vscp_copyEvent(&ev, pev);
-  m_receiveList.pop_front();
+  if (!vscp_copyEvent(&ev, pev)) {
+    rv = VSCP_ERROR_MEMORY;
+  }
+  m_receiveRing.pop();
   pthread_mutex_unlock(&m_mutexReceiveQueue);
-  vscp_deleteEvent(pev);
 
   return rv;
 }
@@ -529,14 +636,21 @@ vscpClientSocketCan::receive(vscpEvent &ev)
 int
 vscpClientSocketCan::receive(vscpEventEx &ex)
 {
-  int rv;
-  vscpEvent ev;
+  int rv = VSCP_ERROR_SUCCESS;
 
-  if (VSCP_ERROR_SUCCESS != (rv = receive(ev))) {
-    return rv;
+  pthread_mutex_lock(&m_mutexReceiveQueue);
+  vscpEvent *pev = m_receiveRing.front();
+  if (nullptr == pev) {
+    pthread_mutex_unlock(&m_mutexReceiveQueue);
+    return VSCP_ERROR_FIFO_EMPTY;
+  }
+  if (!vscp_convertEventToEventEx(&ex, pev)) {
+    rv = VSCP_ERROR_ERROR;
   }
+  m_receiveRing.pop();
+  pthread_mutex_unlock(&m_mutexReceiveQueue);
 
-  return (vscp_convertEventToEventEx(&ex, &ev) ? VSCP_ERROR_SUCCESS : VSCP_ERROR_ERROR);
+  return rv;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -548,23 +662,16 @@ vscpClientSocketCan::receive(canalMsg &msg)
 {
   int rv = VSCP_ERROR_SUCCESS;
 
-  // Check if there are any events waiting
-  if (!m_receiveList.size()) {
-    return VSCP_ERROR_FIFO_EMPTY;
-  }
-
   pthread_mutex_lock(&m_mutexReceiveQueue);
-  vscpEvent *pev = m_receiveList.front();
+  vscpEvent *pev = m_receiveRing.front();
   if (nullptr == pev) {
     pthread_mutex_unlock(&m_mutexReceiveQueue);
-    return VSCP_ERROR_INVALID_POINTER;
+    return VSCP_ERROR_FIFO_EMPTY;
   }
 
   vscp_convertEventToCanal(&msg, pev, 1);
-  m_receiveList.pop_front();
+  m_receiveRing.pop();
   pthread_mutex_unlock(&m_mutexReceiveQueue);
-  vscp_deleteEvent(pev);
-  pev = nullptr;
 
   return rv;
 }
@@ -631,21 +738,73 @@ vscpClientSocketCan::receiveBlocking(canalMsg &msg, long timeout)
 //
 
 int
-vscpClientSocketCan::setfilter(vscpEventFilter & /*filter*/)
+vscpClientSocketCan::setfilter(vscpEventFilter &filter)
 {
-  int rv = VSCP_ERROR_SUCCESS;
+  pthread_mutex_lock(&m_mutexSocket);
 
-  // uint32_t _filter = ((unsigned long) filter.filter_priority << 26) | ((unsigned long) filter.filter_class << 16) |
-  //                    ((unsigned long) filter.filter_type << 8) | filter.filter_GUID[0];
-  // if ( CANAL_ERROR_SUCCESS == (rv = m_canalif.CanalSetFilter(_filter))) {
-  //     return rv;
-  // }
+  memcpy(&m_filterIn, &filter, sizeof(vscpEventFilter));
 
-  // uint32_t _mask = ((unsigned long) filter.mask_priority << 26) | ((unsigned long) filter.mask_class << 16) |
-  //                  ((unsigned long) filter.mask_type << 8) | filter.mask_GUID[0];
-  // m_canalif.CanalSetMask(_mask);
+  // Let the kernel drop what it can. Anything it lets
+  // through is still checked against m_filterIn.
+  applySocketFilter();
 
-  return rv;
+  pthread_mutex_unlock(&m_mutexSocket);
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// filterToCanFilter
+//
+// VSCP CAN id layout
+//   bits 26-28  priority
+//   bit  25     hard coded
+//   bits 16-24  class
+//   bits 8-15   type
+//   bits 0-7    nickname (LSB of GUID)
+//
+
+void
+vscpClientSocketCan::filterToCanFilter(struct can_filter *pcf, const vscpEventFilter &filter)
+{
+  uint32_t id = vscp_getCANALidFromData(filter.filter_priority & 0x07,
+                                        filter.filter_class & 0x1ff,
+                                        filter.filter_type & 0xff);
+  uint32_t mask =
+    vscp_getCANALidFromData(filter.mask_priority & 0x07, filter.mask_class & 0x1ff, filter.mask_type & 0xff);
+
+  id |= filter.filter_GUID[VSCP_GUID_LSB];
+  mask |= filter.mask_GUID[VSCP_GUID_LSB];
+
+  // Only extended frames carry VSCP events
+  pcf->can_id   = CAN_EFF_FLAG | (id & mask);
+  pcf->can_mask = CAN_EFF_FLAG | mask;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// applySocketFilter
+//
+
+int
+vscpClientSocketCan::applySocketFilter(void)
+{
+  struct can_filter cf;
+
+  // Installed when the socket is opened
+  if (m_socket <= 0) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  filterToCanFilter(&cf, m_filterIn);
+
+  if (setsockopt(m_socket, SOL_CAN_RAW, CAN_RAW_FILTER, &cf, sizeof(cf)) < 0) {
+    spdlog::warn("SOCKETCAN client: Failed to set kernel filter for {0} (errno={1}). Filtering in user space only.",
+                 m_interface,
+                 errno);
+    return VSCP_ERROR_ERROR;
+  }
+
+  return VSCP_ERROR_SUCCESS;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -655,7 +814,12 @@ vscpClientSocketCan::setfilter(vscpEventFilter & /*filter*/)
 int
 vscpClientSocketCan::getcount(uint16_t *pcount)
 {
-  *pcount = m_receiveList.size();
+  if (nullptr == pcount) {
+    return VSCP_ERROR_INVALID_POINTER;
+  }
+
+  size_t cnt = m_receiveRing.size();
+  *pcount    = (cnt > 0xffff) ? 0xffff : (uint16_t) cnt;
   return VSCP_ERROR_SUCCESS;
 }
 
@@ -666,6 +830,13 @@ vscpClientSocketCan::getcount(uint16_t *pcount)
 int
 vscpClientSocketCan::clear()
 {
+  pthread_mutex_lock(&m_mutexReceiveQueue);
+  m_receiveRing.clear();
+  while (0 == sem_trywait(&m_semReceiveQueue)) {
+    ;
+  }
+  pthread_mutex_unlock(&m_mutexReceiveQueue);
+
   return VSCP_ERROR_SUCCESS;
 }
 
@@ -753,14 +924,19 @@ vscpClientSocketCan::getResponseTimeout(void)
 void
 vscpClientSocketCan::sendToCallbacks(vscpEvent *pev)
 {
-  if (isCallbackEvActive()) {
-    m_callbackev(*pev, getCallbackObj());
+  std::function<void(vscpEvent &ev, void *pobj)> callbackev;
+  std::function<void(vscpEventEx &ex, void *pobj)> callbackex;
+  void *pobj;
+  getCallbacks(callbackev, callbackex, &pobj);
+
+  if (callbackev) {
+    callbackev(*pev, pobj);
   }
 
-  if (isCallbackExActive()) {
+  if (callbackex) {
     vscpEventEx ex;
     vscp_convertEventToEventEx(&ex, pev);
-    m_callbackex(ex, getCallbackObj());
+    callbackex(ex, pobj);
   }
 }
 
@@ -797,6 +973,94 @@ vscpClientSocketCan::setCallbackEx(std::function<void(vscpEventEx &ex, void *pob
   return VSCP_ERROR_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// frameToEvent
+//
+
+bool
+vscpClientSocketCan::frameToEvent(vscpEvent *pev, const struct canfd_frame *pframe, size_t size, uint32_t timestamp)
+{
+  uint8_t len;
+
+  if (CAN_MTU == size) {
+    len = (pframe->len > CAN_MAX_DLEN) ? CAN_MAX_DLEN : pframe->len;
+  }
+  else if (CANFD_MTU == size) {
+    len = (pframe->len > CANFD_MAX_DLEN) ? CANFD_MAX_DLEN : pframe->len;
+  }
+  else {
+    return false; // Not a CAN frame
+  }
+
+  // Must be extended frame
+  if (!(pframe->can_id & CAN_EFF_FLAG)) {
+    return false;
+  }
+
+  // Mask of control bits
+  uint32_t id = pframe->can_id & CAN_EFF_MASK;
+
+  // Priority and hard coded bit
+  pev->head = vscp_getHeadFromCANALid(id);
+
+  pev->timestamp = timestamp;
+
+  // GUID will be set to GUID of interface
+  // by driver interface with LSB set to nickname
+  pev->GUID[VSCP_GUID_LSB] = id & 0xff;
+
+  // Set VSCP class
+  pev->vscp_class = vscp_getVscpClassFromCANALid(id);
+
+  // Set VSCP type
+  pev->vscp_type = vscp_getVscpTypeFromCANALid(id);
+
+  // Copy data if any. This can lead to level I frames having to
+  // much data. Later code will handel this case.
+  pev->sizeData = len;
+  if (len) {
+    memcpy(pev->pdata, pframe->data, len);
+  }
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getFrameTimestamp
+//
+// Timestamp (microseconds) from the control messages of a received frame.
+// A raw hardware timestamp is preferred over the software one.
+//
+
+static uint32_t
+getFrameTimestamp(struct msghdr *pmsg)
+{
+  struct cmsghdr *cmsg;
+
+  for (cmsg = CMSG_FIRSTHDR(pmsg); nullptr != cmsg; cmsg = CMSG_NXTHDR(pmsg, cmsg)) {
+
+    if (SOL_SOCKET != cmsg->cmsg_level) {
+      continue;
+    }
+
+    if (SO_TIMESTAMPING == cmsg->cmsg_type) {
+      struct scm_timestamping *pts = (struct scm_timestamping *) CMSG_DATA(cmsg);
+      const struct timespec *ts    = &pts->ts[0];
+      if (pts->ts[2].tv_sec || pts->ts[2].tv_nsec) {
+        ts = &pts->ts[2];
+      }
+      return (uint32_t) (ts->tv_sec * 1000000L + ts->tv_nsec / 1000);
+    }
+
+    if (SO_TIMESTAMP == cmsg->cmsg_type) {
+      struct timeval *tv = (struct timeval *) CMSG_DATA(cmsg);
+      return (uint32_t) (tv->tv_sec * 1000000L + tv->tv_usec);
+    }
+  }
+
+  return vscp_makeTimeStamp();
+}
+
 //////////////////////////////////////////////////////////////////////
 //                     Workerthread - Read
 //////////////////////////////////////////////////////////////////////
@@ -805,14 +1069,21 @@ void *
 workerThread(void *pData)
 {
   int mtu, enable_canfd = 1;
-  fd_set rdfs;
-  // struct timeval tv;
   struct sockaddr_can addr;
   struct ifreq ifr;
-  // struct cmsghdr *cmsg;
-  struct canfd_frame frame;
-  // char ctrlmsg[CMSG_SPACE(sizeof(struct timeval)) + CMSG_SPACE(sizeof(__u32))];
-  // const int canfd_on = 1;
+
+  // Receive buffers, set up once and reused for every call
+  struct canfd_frame frames[SOCKETCAN_RECV_BATCH];
+  struct iovec iov[SOCKETCAN_RECV_BATCH];
+  struct mmsghdr msgs[SOCKETCAN_RECV_BATCH];
+  char ctrlmsg[SOCKETCAN_RECV_BATCH][CMSG_SPACE(sizeof(struct scm_timestamping))];
+
+  // Event used when delivering to callbacks
+  uint8_t evdata[SOCKETCAN_MAX_DATA];
+  vscpEvent evcb;
+
+  // Receive filter, copied for each batch
+  vscpEventFilter filterIn;
 
   vscpClientSocketCan *pClient = (vscpClientSocketCan *) pData;
   if (NULL == pClient) {
@@ -820,6 +1091,16 @@ workerThread(void *pData)
     return NULL;
   }
 
+  memset(msgs, 0, sizeof(msgs));
+  for (int i = 0; i < SOCKETCAN_RECV_BATCH; i++) {
+    iov[i].iov_base                = &frames[i];
+    iov[i].iov_len                 = sizeof(struct canfd_frame);
+    msgs[i].msg_hdr.msg_iov        = &iov[i];
+    msgs[i].msg_hdr.msg_iovlen     = 1;
+    msgs[i].msg_hdr.msg_control    = ctrlmsg[i];
+    msgs[i].msg_hdr.msg_controllen = sizeof(ctrlmsg[i]);
+  }
+
   while (pClient->m_bRun) {
 
     pthread_mutex_lock(&pClient->m_mutexSocket);
@@ -832,6 +1113,7 @@ workerThread(void *pData)
         continue; // Try again
       }
 
+      pthread_mutex_unlock(&pClient->m_mutexSocket);
       spdlog::error("SOCKETCAN client: wrkthread socketcan client: Error while opening socket. Terminating!");
       break;
     }
@@ -845,8 +1127,6 @@ workerThread(void *pData)
       return NULL;
     }
 
-    // ioctl(pClient->m_socket, SIOCGIFINDEX, &ifr);
-
     addr.can_family  = AF_CAN;
     addr.can_ifindex = ifr.ifr_ifindex;
 
@@ -854,9 +1134,6 @@ workerThread(void *pData)
       spdlog::debug("SOCKETCAN client: using interface name '{}'.", ifr.ifr_name);
     }
 
-    // try to switch the socket into CAN FD mode
-    // setsockopt(pClient->m_socket, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &canfd_on, sizeof(canfd_on));
-
     if (CANFD_MTU == pClient->m_mode) {
 
       // check if the frame fits into the CAN netdevice
@@ -885,19 +1162,35 @@ workerThread(void *pData)
       }
     }
 
+    // Timestamps are delivered with each frame. Use hardware
+    // timestamps if the adapter has them, software otherwise.
+    int tsflags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE | SOF_TIMESTAMPING_RX_SOFTWARE |
+                  SOF_TIMESTAMPING_SOFTWARE;
+    if (setsockopt(pClient->m_socket, SOL_SOCKET, SO_TIMESTAMPING, &tsflags, sizeof(tsflags))) {
+      int on = 1;
+      setsockopt(pClient->m_socket, SOL_SOCKET, SO_TIMESTAMP, &on, sizeof(on));
+    }
+
+    // Only wake up for frames that can pass the receive filter
+    pClient->applySocketFilter();
+
     // Mark as connected
     pClient->setConnected(true);
 
     pthread_mutex_unlock(&pClient->m_mutexSocket);
 
+    // Wake up now and then to check for termination
     struct timeval tv;
-    tv.tv_sec  = 0;
-    tv.tv_usec = pClient->getResponseTimeout() * 1000; // Not init'ing this can cause strange errors
+    tv.tv_sec  = SOCKETCAN_RECV_TIMEOUT / 1000;
+    tv.tv_usec = (SOCKETCAN_RECV_TIMEOUT % 1000) * 1000;
     setsockopt(pClient->m_socket, SOL_SOCKET, SO_RCVTIMEO, (const char *) &tv, sizeof(struct timeval));
 
     if (bind(pClient->m_socket, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
       spdlog::error("SOCKETCAN client: workthread socketcan client: Error in socket bind. Terminating!");
+      pthread_mutex_lock(&pClient->m_mutexSocket);
       close(pClient->m_socket);
+      pClient->m_socket = 0;
+      pthread_mutex_unlock(&pClient->m_mutexSocket);
       sleep(2);
       // continue;
       return NULL;
@@ -906,176 +1199,84 @@ workerThread(void *pData)
     bool bInnerLoop = true;
     while (pClient->m_bRun && bInnerLoop) {
 
-      FD_ZERO(&rdfs);
-      FD_SET(pClient->m_socket, &rdfs);
-
-      tv.tv_sec  = 0;
-      tv.tv_usec = 5000; // 5ms timeout
+      for (int i = 0; i < SOCKETCAN_RECV_BATCH; i++) {
+        msgs[i].msg_hdr.msg_controllen = sizeof(ctrlmsg[i]);
+        msgs[i].msg_hdr.msg_flags      = 0;
+      }
 
-      int ret;
-      if ((ret = select(pClient->m_socket + 1, &rdfs, NULL, NULL, &tv)) < 0) {
-        // Error
+      // Block for the first frame, then take what else is queued
+      int cnt = recvmmsg(pClient->m_socket, msgs, SOCKETCAN_RECV_BATCH, MSG_WAITFORONE, NULL);
+      if (cnt < 0) {
+        if ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno)) {
+          continue; // Timeout
+        }
         if (ENETDOWN == errno) {
           // We try to get contact with the net
           // again if it goes down
-          bInnerLoop = false;
+          sleep(2);
         }
         else {
-          pClient->m_bRun = false;
+          spdlog::error("SOCKETCAN client: Receive error {}. Reopening socket.", errno);
+          sleep(1);
         }
+        bInnerLoop = false;
         continue;
       }
 
-      if (ret) {
-
-        // There is data to read
-
-        pthread_mutex_lock(&pClient->m_mutexSocket);
-
-        ret = read(pClient->m_socket, &frame, sizeof(struct can_frame));
-        if (ret < 0) {
-          pthread_mutex_unlock(&pClient->m_mutexSocket);
-          if (ENETDOWN == errno) {
-            // We try to get contact with the net
-            // again if it goes down
-            bInnerLoop = false;
-            sleep(2);
-          }
-          else {
-            pClient->m_bRun = true;
-          }
-          continue;
-        }
-
-        pthread_mutex_unlock(&pClient->m_mutexSocket);
+      // setfilter() may change the filter while we work
+      pthread_mutex_lock(&pClient->m_mutexSocket);
+      memcpy(&filterIn, &pClient->m_filterIn, sizeof(vscpEventFilter));
+      pthread_mutex_unlock(&pClient->m_mutexSocket);
 
-        // Must be extended frame
-        if (!(frame.can_id & CAN_EFF_FLAG)) {
-          continue;
-        }
+      bool bCallback   = pClient->isCallbackEvActive() || pClient->isCallbackExActive();
+      uint32_t nQueued = 0;
 
-        // Mask of control bits
-        frame.can_id &= CAN_EFF_MASK;
+      for (int i = 0; i < cnt; i++) {
 
-        vscpEvent *pEvent = new vscpEvent();
-        if (nullptr != pEvent) {
+        uint32_t timestamp = getFrameTimestamp(&msgs[i].msg_hdr);
 
-          // Get timetstamp
-          struct timeval tv;
-          ioctl(pClient->m_socket, SIOCGSTAMP, &tv);
-          pEvent->timestamp = tv.tv_sec * 1000000L + tv.tv_usec;
+        if (bCallback) {
 
-          // This can lead to level I frames having to
-          // much data. Later code will handel this case.
-          pEvent->pdata = new uint8_t[frame.len];
-          if (nullptr == pEvent->pdata) {
-            delete pEvent;
+          memset(&evcb, 0, sizeof(vscpEvent));
+          evcb.pdata = evdata;
+          if (!vscpClientSocketCan::frameToEvent(&evcb, &frames[i], msgs[i].msg_len, timestamp)) {
             continue;
           }
 
-          // GUID will be set to GUID of interface
-          // by driver interface with LSB set to nickname
-          // memcpy(pEvent->GUID, pClient->m_guid.getGUID(), 16);
-          pEvent->GUID[VSCP_GUID_LSB] = frame.can_id & 0xff;
-
-          // Set VSCP class
-          pEvent->vscp_class = vscp_getVscpClassFromCANALid(frame.can_id);
-
-          // Set VSCP type
-          pEvent->vscp_type = vscp_getVscpTypeFromCANALid(frame.can_id);
+          if (vscp_doLevel2Filter(&evcb, &filterIn)) {
+            pClient->sendToCallbacks(&evcb);
+          }
+        }
+        else {
 
-          // Copy data if any
-          pEvent->sizeData = frame.len;
-          if (frame.len) {
-            memcpy(pEvent->pdata, frame.data, frame.len);
+          // Add to input queue only if no callback set
+          vscpEvent *pev = pClient->m_receiveRing.reserve();
+          if (nullptr == pev) {
+            continue; // Full, counted as overrun
           }
 
-          if (vscp_doLevel2Filter(pEvent, &pClient->m_filterIn)) {
-
-            if (pClient->isCallbackEvActive()) {
-              pClient->m_callbackev(*pEvent, pClient->getCallbackObj());
-            }
-
-            if (pClient->isCallbackExActive()) {
-              vscpEventEx ex;
-              if (vscp_convertEventToEventEx(&ex, pEvent)) {
-                pClient->m_callbackex(ex, pClient->getCallbackObj());
-              }
-            }
-
-            // printf("Socketcan event: %X:%X\n", pEvent->vscp_class, pEvent->vscp_type);
-
-            // Add to input queue only if no callback set
-            if (!pClient->isCallbackEvActive() || !pClient->isCallbackExActive()) {
-              // std::cout << "add to receive queue" << std::endl;
-              pthread_mutex_lock(&pClient->m_mutexReceiveQueue);
-              pClient->m_receiveList.push_back(pEvent);
-#ifdef WIN32
-              ReleaseSemaphore(pClient->m_semReceiveQueue, 1, NULL);
-#else
-              sem_post(&pClient->m_semReceiveQueue);
-#endif
-              pthread_mutex_unlock(&pClient->m_mutexReceiveQueue);
-            }
+          if (!vscpClientSocketCan::frameToEvent(pev, &frames[i], msgs[i].msg_len, timestamp)) {
+            continue;
           }
-          else {
-            vscp_deleteEvent(pEvent);
+
+          if (vscp_doLevel2Filter(pev, &filterIn)) {
+            pClient->m_receiveRing.commit();
+            nQueued++;
           }
         }
       }
-      // else {
-
-      //   // Check if there is event(s) to send
-      //   if (pClient->m_sendList.size()) {
-
-      //     // Yes there are data to send
-      //     // So send it out on the CAN bus
-
-      //     pthread_mutex_lock(&pClient->m_mutexSendQueue);
-      //     vscpEvent *pEvent = pClient->m_sendList.front();
-      //     pClient->m_sendList.pop_front();
-      //     pthread_mutex_unlock(&pClient->m_mutexSendQueue);
-
-      //     if (NULL == pEvent) {
-      //       continue;
-      //     }
-
-      //     // Class must be a Level I class or a Level II
-      //     // mirror class
-      //     if (pEvent->vscp_class < 512) {
-      //       frame.can_id = vscp_getCANALidFromEvent(pEvent);
-      //       frame.can_id |= CAN_EFF_FLAG; // Always extended
-      //       if (0 != pEvent->sizeData) {
-      //         frame.len = (pEvent->sizeData > 8 ? 8 : pEvent->sizeData);
-      //         memcpy(frame.data, pEvent->pdata, frame.len);
-      //       }
-      //     }
-      //     else if (pEvent->vscp_class < 1024) {
-      //       pEvent->vscp_class -= 512;
-      //       frame.can_id = vscp_getCANALidFromEvent(pEvent);
-      //       frame.can_id |= CAN_EFF_FLAG; // Always extended
-      //       if (0 != pEvent->sizeData) {
-      //         frame.len = ((pEvent->sizeData - 16) > 8 ? 8 : pEvent->sizeData - 16);
-      //         memcpy(frame.data, pEvent->pdata + 16, frame.len);
-      //       }
-      //     }
-
-      //     // Remove the event
-      //     pthread_mutex_lock(&pClient->m_mutexSendQueue);
-      //     vscp_deleteEvent(pEvent);
-      //     pthread_mutex_unlock(&pClient->m_mutexSendQueue);
-
-      //     // Write the data
-      //     int nbytes = write(pClient->m_socket, &frame, sizeof(struct can_frame));
-
-      //   } // event to send
-
-      // } // No data to read
+
+      while (nQueued--) {
+        sem_post(&pClient->m_semReceiveQueue);
+      }
 
     } // Inner loop
 
     // Close the socket
+    pthread_mutex_lock(&pClient->m_mutexSocket);
     close(pClient->m_socket);
+    pClient->m_socket = 0;
+    pthread_mutex_unlock(&pClient->m_mutexSocket);
 
   } // Outer loop
 
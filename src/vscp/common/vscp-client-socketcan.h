@@ -31,8 +31,10 @@
 
 #define _POSIX
 
+#include <atomic>
 #include <list>
 #include <string>
+#include <vector>
 
 #include <pthread.h>
 #include <stdio.h>
@@ -42,6 +44,9 @@
 #endif
 #include <time.h>
 #include <unistd.h>
+#ifndef WIN32
+#include <linux/can.h>
+#endif
 
 #include <canal-macro.h>
 #include <canal.h>
@@ -65,6 +70,83 @@ using json = nlohmann::json;
 
 const uint16_t MAX_ITEMS_IN_QUEUE = 32000;
 
+// Number of received events that can be queued (power of two)
+#define SOCKETCAN_RING_SIZE 4096
+
+// Max number of frames read/written with one system call
+#define SOCKETCAN_RECV_BATCH 32
+#define SOCKETCAN_SEND_BATCH 32
+
+// Receive timeout. Worker checks for termination this often (ms)
+#define SOCKETCAN_RECV_TIMEOUT 100
+
+// Max data for a CAN FD frame
+#define SOCKETCAN_MAX_DATA 64
+
+// ----------------------------------------------------------------------------
+
+/*!
+  Fixed size ring of preallocated events used as receive queue.
+  One producer (the worker thread) and one consumer at a time (consumers
+  are serialized by the client receive queue mutex). When the ring is
+  full new events are dropped and counted as overruns.
+*/
+
+class CSocketCanEventRing {
+
+public:
+  CSocketCanEventRing(uint32_t size = SOCKETCAN_RING_SIZE);
+
+  /*!
+    Get the next free slot to fill in. The slot is not visible
+    to the consumer until commit is called.
+    @return Pointer to event with pdata pointing to a SOCKETCAN_MAX_DATA
+    byte buffer or nullptr if the ring is full.
+  */
+  vscpEvent *reserve(void);
+
+  /// Make the slot returned by reserve visible to the consumer
+  void commit(void);
+
+  /*!
+    Get oldest event in ring
+    @return Pointer to event or nullptr if the ring is empty
+  */
+  vscpEvent *front(void);
+
+  /// Remove oldest event
+  void pop(void);
+
+  /// Remove all events
+  void clear(void);
+
+  /// Number of events in ring
+  size_t size(void) const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire); };
+
+  /// True if no events in ring
+  bool empty(void) const { return (0 == size()); };
+
+  /// Number of events dropped because the ring was full
+  uint32_t getOverruns(void) const { return m_overruns.load(std::memory_order_relaxed); };
+
+private:
+  struct slot {
+    vscpEvent ev;
+    uint8_t data[SOCKETCAN_MAX_DATA];
+  };
+
+  std::vector<slot> m_slots;
+  uint32_t m_mask;
+
+  // Written by producer only
+  std::atomic<uint32_t> m_head;
+
+  // Written by consumer only
+  std::atomic<uint32_t> m_tail;
+
+  std::atomic<uint32_t> m_overruns;
+};
+
 // ----------------------------------------------------------------------------
 
 // When a callback is set and connect is called this object is shared
@@ -142,6 +224,17 @@ public:
   */
   virtual int send(canalMsg &msg);
 
+  /*!
+    Send several CAN(AL) messages to remote host using sendmmsg.
+    Messages are sent in order. Sending stops at the first message that
+    can not be written.
+    @param pmsgs Array with messages to send.
+    @param count Number of messages to send.
+    @param psent Set to number of messages sent if not NULL.
+    @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  int send(const canalMsg *pmsgs, uint32_t count, uint32_t *psent = nullptr);
+
   /*!
       Receive VSCP event from remote host
       @return Return VSCP_ERROR_SUCCESS of OK and error code else.
@@ -232,6 +325,47 @@ public:
 
   void sendToCallbacks(vscpEvent *pev);
 
+#ifndef WIN32
+  /*!
+    Fill in a VSCP event from a received socketcan frame
+    @param pev Event to fill in. pdata must point to a buffer that
+      can hold SOCKETCAN_MAX_DATA bytes.
+    @param pframe Received frame.
+    @param size Number of bytes received. CAN_MTU for a classic
+      frame, CANFD_MTU for a FD frame.
+    @param timestamp Event timestamp in microseconds.
+    @return true if the frame was converted, false if it is not a VSCP frame
+  */
+  static bool frameToEvent(vscpEvent *pev, const struct canfd_frame *pframe, size_t size, uint32_t timestamp);
+
+  /*!
+    Fill in a socketcan frame from a CANAL message
+    @param pframe Frame to fill in.
+    @param pmsg CANAL message to send.
+    @param bFD True if the socket is in FD mode.
+    @return Number of bytes to write for the frame (CAN_MTU or CANFD_MTU)
+  */
+  static size_t canalToFrame(struct canfd_frame *pframe, const canalMsg *pmsg, bool bFD);
+
+  /*!
+    Translate a VSCP filter into a kernel CAN_RAW filter on the
+    VSCP CAN id (priority, class, type, nickname). Only the parts of
+    the filter that live in the id are translated, the rest is still
+    checked in user space.
+    @param pcf Kernel filter to fill in.
+    @param filter VSCP filter to translate.
+  */
+  static void filterToCanFilter(struct can_filter *pcf, const vscpEventFilter &filter);
+
+  /*!
+    Install the receive filter on the open socket.
+    Must be called with m_mutexSocket held.
+    @return VSCP_ERROR_SUCCESS on success, VSCP_ERROR_ERROR if
+      the kernel refused the filter.
+  */
+  int applySocketFilter(void);
+#endif
+
   /*!
       Set (and enable) receive callback for events
       @return Return VSCP_ERROR_SUCCESS of OK and error code else.
@@ -319,9 +453,8 @@ public:
 
   // ------------------------------------------------------------------------
 
-  // Event lists
-  // std::list<vscpEvent *> m_sendList;
-  std::list<vscpEvent *> m_receiveList;
+  // Received events, used when no callback is set
+  CSocketCanEventRing m_receiveRing;
 
   /*!
     Event object to indicate that there is an event in the
@@ -48,6 +48,9 @@ vscpClientTcp::vscpClientTcp()
 {
   m_type          = CVscpClient::connType::TCPIP;
   m_pworkerthread = nullptr;
+  m_bRun          = false;
+  m_fdWakeup[0]   = -1;
+  m_fdWakeup[1]   = -1;
 
   // Default connect parameters
   m_strHostname = "tcp://localhost:9598";
@@ -96,7 +99,7 @@ vscpClientTcp::~vscpClientTcp()
   while (m_receiveList.size()) {
     vscpEvent *pev = m_receiveList.front();
     m_receiveList.pop_front();
-    vscp_deleteEvent(pev);
+    m_eventPool.put(pev);
   }
 }
 
@@ -360,10 +363,16 @@ vscpClientTcp::connect(void)
       return rv;
     }
 
+#ifndef WIN32
+    // Used to wake up the receive thread on disconnect
+    if (-1 == pipe(m_fdWakeup)) {
+      m_fdWakeup[0] = m_fdWakeup[1] = -1;
+    }
+#endif
+
     // Create receive worker thread
     m_bRun          = true;
     m_pworkerthread = new std::thread(workerThread, this);
-    m_bRun          = true;
   }
 
   return VSCP_ERROR_SUCCESS;
@@ -391,10 +400,27 @@ vscpClientTcp::disconnect(void)
 
     if (nullptr != m_pworkerthread) {
       m_bRun = false;
+#ifndef WIN32
+      if (-1 != m_fdWakeup[1]) {
+        char c   = 0;
+        ssize_t n = write(m_fdWakeup[1], &c, 1);
+        (void) n;
+      }
+#endif
       m_pworkerthread->join();
+      delete m_pworkerthread;
       m_pworkerthread = nullptr;
     }
 
+#ifndef WIN32
+    for (int i = 0; i < 2; i++) {
+      if (-1 != m_fdWakeup[i]) {
+        close(m_fdWakeup[i]);
+        m_fdWakeup[i] = -1;
+      }
+    }
+#endif
+
     // Close receive connection
     if (VSCP_ERROR_SUCCESS != (rv = m_tcpReceive.doCmdClose())) {
       m_tcp.doCmdClose();
@@ -476,6 +502,70 @@ vscpClientTcp::send(canalMsg &msg)
   return m_tcp.doCmdSendEx(&ex);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// sendBatch
+//
+
+int
+vscpClientTcp::sendBatch(const vscpEvent *const *ppev, size_t count, size_t *pcntFailed)
+{
+  if (m_bPolling) {
+    pthread_mutex_lock(&m_mutexTcpIpObject);
+    int rv = m_tcp.doCmdSendBatch(ppev, count, pcntFailed);
+    pthread_mutex_unlock(&m_mutexTcpIpObject);
+    return rv;
+  }
+  return m_tcp.doCmdSendBatch(ppev, count, pcntFailed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendBatch
+//
+
+int
+vscpClientTcp::sendBatch(const vscpEventEx *pex, size_t count, size_t *pcntFailed)
+{
+  if (m_bPolling) {
+    pthread_mutex_lock(&m_mutexTcpIpObject);
+    int rv = m_tcp.doCmdSendBatchEx(pex, count, pcntFailed);
+    pthread_mutex_unlock(&m_mutexTcpIpObject);
+    return rv;
+  }
+  return m_tcp.doCmdSendBatchEx(pex, count, pcntFailed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendAsync
+//
+
+int
+vscpClientTcp::sendAsync(vscpEventEx &ex, std::function<void(int rv)> cb)
+{
+  if (m_bPolling) {
+    pthread_mutex_lock(&m_mutexTcpIpObject);
+    int rv = m_tcp.doCmdSendAsyncEx(&ex, cb);
+    pthread_mutex_unlock(&m_mutexTcpIpObject);
+    return rv;
+  }
+  return m_tcp.doCmdSendAsyncEx(&ex, cb);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendFlush
+//
+
+int
+vscpClientTcp::sendFlush(void)
+{
+  if (m_bPolling) {
+    pthread_mutex_lock(&m_mutexTcpIpObject);
+    int rv = m_tcp.doCmdSendFlush();
+    pthread_mutex_unlock(&m_mutexTcpIpObject);
+    return rv;
+  }
+  return m_tcp.doCmdSendFlush();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // receive
 //
@@ -483,7 +573,27 @@ vscpClientTcp::send(canalMsg &msg)
 int
 vscpClientTcp::receive(vscpEvent &ev)
 {
-  return m_tcp.doCmdReceive(&ev);
+  if (m_bPolling) {
+    return m_tcp.doCmdReceive(&ev);
+  }
+
+  int rv = VSCP_ERROR_SUCCESS;
+
+  pthread_mutex_lock(&m_mutexReceiveQueue);
+  if (m_receiveList.empty()) {
+    pthread_mutex_unlock(&m_mutexReceiveQueue);
+    return VSCP_ERROR_FIFO_EMPTY;
+  }
+  vscpEvent *pev = m_receiveList.front();
+  m_receiveList.pop_front();
+  pthread_mutex_unlock(&m_mutexReceiveQueue);
+
+  if (!vscp_copyEvent(&ev, pev)) {
+    rv = VSCP_ERROR_MEMORY;
+  }
+  m_eventPool.put(pev);
+
+  return rv;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -493,7 +603,27 @@ vscpClientTcp::receive(vscpEvent &ev)
 int
 vscpClientTcp::receive(vscpEventEx &ex)
 {
-  return m_tcp.doCmdReceiveEx(&ex);
+  if (m_bPolling) {
+    return m_tcp.doCmdReceiveEx(&ex);
+  }
+
+  int rv = VSCP_ERROR_SUCCESS;
+
+  pthread_mutex_lock(&m_mutexReceiveQueue);
+  if (m_receiveList.empty()) {
+    pthread_mutex_unlock(&m_mutexReceiveQueue);
+    return VSCP_ERROR_FIFO_EMPTY;
+  }
+  vscpEvent *pev = m_receiveList.front();
+  m_receiveList.pop_front();
+  pthread_mutex_unlock(&m_mutexReceiveQueue);
+
+  if (!vscp_convertEventToEventEx(&ex, pev)) {
+    rv = VSCP_ERROR_ERROR;
+  }
+  m_eventPool.put(pev);
+
+  return rv;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -506,7 +636,7 @@ vscpClientTcp::receive(canalMsg &msg)
   int rv;
   vscpEventEx ex;
 
-  if (VSCP_ERROR_SUCCESS != (rv = m_tcp.doCmdReceiveEx(&ex))) {
+  if (VSCP_ERROR_SUCCESS != (rv = receive(ex))) {
     return rv;
   }
 
@@ -585,9 +715,11 @@ vscpClientTcp::setfilter(vscpEventFilter &filter)
     return m_tcp.doCmdFilter(&filter);
   }
   else {
-    pthread_mutex_lock(&m_mutexTcpIpObject);
-    return m_tcpReceive.doCmdFilter(&filter);
-    pthread_mutex_unlock(&m_mutexTcpIpObject);
+    // The receive connection is in the receive loop, filter locally
+    pthread_mutex_lock(&m_mutexReceiveQueue);
+    m_filterIn = filter;
+    pthread_mutex_unlock(&m_mutexReceiveQueue);
+    return VSCP_ERROR_SUCCESS;
   }
 }
 
@@ -693,29 +825,32 @@ vscpClientTcp::getResponseTimeout(void)
 void
 vscpClientTcp::sendToCallbacks(vscpEvent *pev)
 {
-  if (isCallbackEvActive()) {
-    m_callbackev(*pev, m_callbackObject);
+  std::function<void(vscpEvent &ev, void *pobj)> callbackev;
+  std::function<void(vscpEventEx &ex, void *pobj)> callbackex;
+  void *pobj;
+  getCallbacks(callbackev, callbackex, &pobj);
+
+  if (callbackev) {
+    callbackev(*pev, pobj);
   }
 
-  if (isCallbackExActive()) {
+  if (callbackex) {
     vscpEventEx ex;
     vscp_convertEventToEventEx(&ex, pev);
-    m_callbackex(ex, m_callbackObject);
+    callbackex(ex, pobj);
   }
 }
 
 // ----------------------------------------------------------------------------
 //                            Receive worker thread
+// Sleeps in poll on the receive connection and the wake up pipe. Events
+// are decoded straight from the receive ring into pooled events. The
+// send side lock (m_mutexTcpIpObject) is never taken here.
 // ----------------------------------------------------------------------------
 
 void
 workerThread(vscpClientTcp *pClient)
 {
-  vscpEvent ev;
-
-  ev.sizeData = 0;
-  ev.pdata    = NULL;
-
   // Check pointer
   if (nullptr == pClient) {
     return;
@@ -725,47 +860,42 @@ workerThread(vscpClientTcp *pClient)
 
   m_pifReceive->doCmdEnterReceiveLoop();
 
-  while (pClient->m_bRun) {
-
-    pthread_mutex_lock(&pClient->m_mutexTcpIpObject);
-
-    if (VSCP_ERROR_SUCCESS == m_pifReceive->doCmdBlockingReceive(&ev)) {
+  auto handler = [pClient](vscpEvent *pev) {
+    pthread_mutex_lock(&pClient->m_mutexReceiveQueue);
+    bool bAccept = vscp_doLevel2Filter(pev, &pClient->m_filterIn);
+    pthread_mutex_unlock(&pClient->m_mutexReceiveQueue);
 
-      if (vscp_doLevel2Filter(&ev, &pClient->m_filterIn)) {
-
-        if (pClient->isCallbackEvActive()) {
-          pClient->m_callbackev(ev, pClient->getCallbackObj());
-        }
-
-        if (pClient->isCallbackExActive()) {
-          vscpEventEx ex;
-          if (vscp_convertEventToEventEx(&ex, &ev)) {
-            pClient->m_callbackex(ex, pClient->getCallbackObj());
-          }
-        }
+    if (!bAccept) {
+      pClient->m_eventPool.put(pev);
+      return;
+    }
 
-        // Add to input queue only if no callback set
-        if (!pClient->isCallbackEvActive() || !pClient->isCallbackExActive()) {
-          pthread_mutex_lock(&pClient->m_mutexReceiveQueue);
-          pClient->m_receiveList.push_back(&ev);
+    // Add to input queue only if no callback set
+    if (!pClient->isCallbackEvActive() && !pClient->isCallbackExActive()) {
+      pthread_mutex_lock(&pClient->m_mutexReceiveQueue);
+      pClient->m_receiveList.push_back(pev);
 #ifdef WIN32
-          ReleaseSemaphore(pClient->m_semReceiveQueue, 1, NULL);
+      ReleaseSemaphore(pClient->m_semReceiveQueue, 1, NULL);
 #else
-          sem_post(&pClient->m_semReceiveQueue);
+      sem_post(&pClient->m_semReceiveQueue);
 #endif
-          pthread_mutex_unlock(&pClient->m_mutexReceiveQueue);
-        }
-      }
-      vscp_deleteEvent(&ev);
+      pthread_mutex_unlock(&pClient->m_mutexReceiveQueue);
+      return;
     }
 
+    pClient->sendToCallbacks(pev);
+    pClient->m_eventPool.put(pev);
+  };
+
+  while (pClient->m_bRun) {
+
+    int rv = m_pifReceive->doCmdReceiveLoopRead(pClient->m_eventPool, handler, 1000, pClient->m_fdWakeup[0]);
+
     // Terminate if we are not connected
-    if (!m_pifReceive->isConnected()) {
+    if ((VSCP_ERROR_CONNECTION == rv) || (VSCP_ERROR_STOPPED == rv) || (VSCP_ERROR_PARAMETER == rv)) {
       pClient->m_bRun = false;
     }
-
-    pthread_mutex_unlock(&pClient->m_mutexTcpIpObject);
-} // workerThread loop
+  } // workerThread loop
 }
 
 // ----------------------------------------------------------------------------
@@ -801,10 +931,16 @@ pollWorkerThread(vscpClientTcp *pClient)
 
         // Also push to receive queue for callers using blocking receive
         if (!pClient->isCallbackEvActive() && !pClient->isCallbackExActive()) {
-          vscpEvent *pnew = new vscpEvent;
-          pnew->sizeData  = 0;
-          pnew->pdata     = nullptr;
-          vscp_copyEvent(pnew, &ev);
+          vscpEvent *pnew = pClient->m_eventPool.get();
+          uint8_t *pdata  = pnew->pdata;
+          *pnew           = ev;
+          pnew->pdata     = pdata;
+          if (pnew->sizeData > VSCP_MAX_DATA) {
+            pnew->sizeData = VSCP_MAX_DATA;
+          }
+          if ((nullptr != ev.pdata) && pnew->sizeData) {
+            memcpy(pdata, ev.pdata, pnew->sizeData);
+          }
           pthread_mutex_lock(&pClient->m_mutexReceiveQueue);
           pClient->m_receiveList.push_back(pnew);
 #ifdef WIN32
@@ -98,9 +98,54 @@ public:
 */
   virtual int send(canalMsg &msg);
 
+  /*!
+      Send a number of VSCP events to remote host pipelined. Commands
+      are written back to back without waiting for each response.
+      @param ppev Array of pointers to events
+      @param count Number of events
+      @param pcntFailed If not NULL gets the number of events that
+              were rejected or not confirmed.
+      @return Return VSCP_ERROR_SUCCESS if all events were confirmed,
+              VSCP_ERROR_ERROR if one or more were rejected, else error
+              code.
+  */
+  int sendBatch(const vscpEvent *const *ppev, size_t count, size_t *pcntFailed = NULL);
+
+  /*!
+      Send a number of VSCP ex events to remote host pipelined,
+      see above.
+      @param pex Array of events
+  */
+  int sendBatch(const vscpEventEx *pex, size_t count, size_t *pcntFailed = NULL);
+
+  /*!
+      Send VSCP event to remote host without waiting for the response.
+      @param ex Event to send
+      @param cb Called with the result when the response arrives,
+              see VscpRemoteTcpIf::doCmdSendAsync. Can be empty.
+      @return Return VSCP_ERROR_SUCCESS if the event was written and error
+              code else.
+  */
+  int sendAsync(vscpEventEx &ex, std::function<void(int rv)> cb = nullptr);
+
+  /*!
+      Wait for responses to all events sent with sendAsync
+      @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+  */
+  int sendFlush(void);
+
+  /*!
+      Set max number of pipelined events waiting for a response
+      @param window Window size
+  */
+  void setSendWindow(size_t window) { m_tcp.setSendWindow(window); };
+
   /*!
       Receive VSCP event from remote host
+      In normal (non polling) mode the event is taken from the queue
+      filled by the receive thread when no callback is set.
       @return Return VSCP_ERROR_SUCCESS of OK and error code else.
+              VSCP_ERROR_FIFO_EMPTY if the queue is empty.
   */
   virtual int receive(vscpEvent &ev);
 
@@ -323,7 +368,16 @@ public:
   // std::list<vscpEvent *> m_sendList;
   std::list<vscpEvent *> m_receiveList;
 
-  /// Mutex to protect receive tcp/ip object
+  /// Received events are taken from and returned to this pool
+  vscpEventPool m_eventPool;
+
+  /*!
+    Pipe that wakes up the receive worker thread when
+    disconnecting. -1 when not open.
+  */
+  int m_fdWakeup[2];
+
+  /// Mutex to protect the tcp/ip object in polling mode
   pthread_mutex_t m_mutexTcpIpObject;
 
   /// Mutex to protect receive queue
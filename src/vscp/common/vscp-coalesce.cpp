@@ -0,0 +1,381 @@
+// vscp-coalesce.cpp
+//
+// Deduplication and rate limiting of measurement events before publish.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include <math.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include <vscp-metrics.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include "vscp-coalesce.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// newEventFromView
+//
+// Owned copy of a viewed event, freed with vscp_deleteEvent_v2
+//
+
+static vscpEvent *
+newEventFromView(const vscp_event_view &ev)
+{
+  vscpEvent *pev = new vscpEvent;
+  memset(pev, 0, sizeof(vscpEvent));
+
+  pev->head         = ev.head;
+  pev->obid         = ev.obid;
+  pev->year         = ev.year;
+  pev->month        = ev.month;
+  pev->timestamp_ns = ev.timestamp_ns;
+  pev->vscp_class   = ev.vscp_class;
+  pev->vscp_type    = ev.vscp_type;
+  memcpy(pev->GUID, ev.GUID, 16);
+
+  if (ev.sizeData && (NULL != ev.pdata)) {
+    pev->sizeData = ev.sizeData;
+    pev->pdata    = new uint8_t[ev.sizeData];
+    memcpy(pev->pdata, ev.pdata, ev.sizeData);
+  }
+
+  return pev;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// keyHash
+//
+// FNV-1a over the key
+//
+
+size_t
+vscpCoalesce::keyHash::operator()(const key &k) const
+{
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(&k);
+  uint64_t hash    = 14695981039346656037ULL;
+  for (size_t i = 0; i < sizeof(key); i++) {
+    hash ^= p[i];
+    hash *= 1099511628211ULL;
+  }
+  return (size_t) hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CTor
+//
+
+vscpCoalesce::vscpCoalesce(void)
+{
+  m_bEnable      = false;
+  m_deadband     = VSCP_COALESCE_DEFAULT_DEADBAND;
+  m_window       = VSCP_COALESCE_DEFAULT_WINDOW;
+  m_minInterval  = VSCP_COALESCE_DEFAULT_MIN_INTERVAL;
+  m_maxKeys      = VSCP_COALESCE_DEFAULT_MAX_KEYS;
+  m_nextDue      = 0;
+  m_cntPending   = 0;
+  m_cntPublish   = 0;
+  m_cntUnchanged = 0;
+  m_cntRateLimit = 0;
+  m_cntFlush     = 0;
+  m_cntUntracked = 0;
+  pthread_mutex_init(&m_mutex, NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DTor
+//
+
+vscpCoalesce::~vscpCoalesce(void)
+{
+  clear();
+  pthread_mutex_destroy(&m_mutex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// setOptions
+//
+
+void
+vscpCoalesce::setOptions(double deadband, uint64_t window, uint64_t minInterval, size_t maxKeys)
+{
+  clear();
+
+  pthread_mutex_lock(&m_mutex);
+  m_deadband    = (deadband > 0) ? deadband : 0;
+  m_window      = window;
+  m_minInterval = minInterval;
+  m_maxKeys     = maxKeys ? maxKeys : VSCP_COALESCE_DEFAULT_MAX_KEYS;
+  pthread_mutex_unlock(&m_mutex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getTime
+//
+
+uint64_t
+vscpCoalesce::getTime(void)
+{
+  return (uint64_t) std::chrono::duration_cast<std::chrono::milliseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// dropPending
+//
+
+void
+vscpCoalesce::dropPending(entry &e)
+{
+  if (NULL != e.pPending) {
+    vscp_deleteEvent_v2(&e.pPending);
+    e.pPending = NULL;
+    m_cntPending--;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// check
+//
+
+bool
+vscpCoalesce::check(const vscp_event_view &ev, uint64_t now)
+{
+  double value;
+  key k;
+
+  if (!m_bEnable) {
+    return true;
+  }
+
+  if (!vscp_isMeasurement(ev) || !vscp_getMeasurementAsDouble(&value, ev)) {
+    return true;
+  }
+
+  // Padding is part of the compare and the hash
+  memset(&k, 0, sizeof(key));
+  memcpy(k.GUID, ev.GUID, 16);
+  k.vscp_class  = ev.vscp_class;
+  k.vscp_type   = ev.vscp_type;
+  k.sensorindex = (uint8_t) vscp_getMeasurementSensorIndex(ev);
+  k.zone        = (uint8_t) vscp_getMeasurementZone(ev);
+  k.subzone     = (uint8_t) vscp_getMeasurementSubZone(ev);
+  uint8_t unit  = (uint8_t) vscp_getMeasurementUnit(ev);
+
+  pthread_mutex_lock(&m_mutex);
+
+  std::unordered_map<key, entry, keyHash>::iterator it = m_table.find(k);
+
+  // First value for a key is always published
+  if (it == m_table.end()) {
+
+    if (m_table.size() >= m_maxKeys) {
+      pthread_mutex_unlock(&m_mutex);
+      m_cntUntracked++;
+      return true;
+    }
+
+    entry &e       = m_table[k];
+    e.value        = value;
+    e.tsPublish    = now;
+    e.pendingValue = 0;
+    e.pPending     = NULL;
+    e.unit         = unit;
+    e.pendingUnit  = 0;
+
+    pthread_mutex_unlock(&m_mutex);
+    m_cntPublish++;
+    return true;
+  }
+
+  entry &e     = it->second;
+  uint64_t age = (now > e.tsPublish) ? (now - e.tsPublish) : 0;
+
+  // NaN is never within the deadband
+  bool bChanged = (unit != e.unit) || !(fabs(value - e.value) <= m_deadband);
+
+  if (!bChanged) {
+
+    // Back at the published value, a held back change is stale
+    dropPending(e);
+
+    if (!m_window || (age < m_window)) {
+      pthread_mutex_unlock(&m_mutex);
+      m_cntUnchanged++;
+      VSCP_METRIC_COUNT("vscp_coalesce_unchanged_total", "Measurement events suppressed as unchanged");
+      return false;
+    }
+  }
+
+  // Hold back the latest event until the interval has passed
+  if (m_minInterval && (age < m_minInterval)) {
+
+    uint64_t due = e.tsPublish + m_minInterval;
+
+    if (NULL != e.pPending) {
+      vscp_deleteEvent_v2(&e.pPending);
+    }
+    else if (0 == m_cntPending++) {
+      m_nextDue = due;
+    }
+
+    if (due < m_nextDue) {
+      m_nextDue = due;
+    }
+
+    e.pPending     = newEventFromView(ev);
+    e.pendingValue = value;
+    e.pendingUnit  = unit;
+
+    pthread_mutex_unlock(&m_mutex);
+    m_cntRateLimit++;
+    VSCP_METRIC_COUNT("vscp_coalesce_rate_limit_total", "Measurement events held back by the minimum interval");
+    return false;
+  }
+
+  dropPending(e);
+  e.value     = value;
+  e.unit      = unit;
+  e.tsPublish = now;
+
+  pthread_mutex_unlock(&m_mutex);
+  m_cntPublish++;
+  return true;
+}
+
+bool
+vscpCoalesce::check(const vscpEvent &ev)
+{
+  if (!m_bEnable) {
+    return true;
+  }
+  return check(vscp_event_view(ev), getTime());
+}
+
+bool
+vscpCoalesce::check(const vscpEventEx &ex)
+{
+  if (!m_bEnable) {
+    return true;
+  }
+  return check(vscp_event_view(ex), getTime());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// flush
+//
+
+size_t
+vscpCoalesce::flush(vscpCoalesceHandler fn, uint64_t now, bool bAll)
+{
+  std::vector<vscpEvent *> due;
+
+  if (!m_cntPending) {
+    return 0;
+  }
+
+  pthread_mutex_lock(&m_mutex);
+
+  uint64_t nextDue = UINT64_MAX;
+
+  for (std::unordered_map<key, entry, keyHash>::iterator it = m_table.begin(); it != m_table.end(); ++it) {
+
+    entry &e = it->second;
+    if (NULL == e.pPending) {
+      continue;
+    }
+
+    if (bAll || (now >= (e.tsPublish + m_minInterval))) {
+      e.value     = e.pendingValue;
+      e.unit      = e.pendingUnit;
+      e.tsPublish = now;
+      due.push_back(e.pPending);
+      e.pPending = NULL;
+      m_cntPending--;
+    }
+    else if ((e.tsPublish + m_minInterval) < nextDue) {
+      nextDue = e.tsPublish + m_minInterval;
+    }
+  }
+
+  m_nextDue = nextDue;
+
+  pthread_mutex_unlock(&m_mutex);
+
+  for (size_t i = 0; i < due.size(); i++) {
+    if (fn) {
+      fn(*due[i]);
+    }
+    vscp_deleteEvent_v2(&due[i]);
+  }
+
+  m_cntFlush += due.size();
+  if (due.size()) {
+    VSCP_METRIC_ADD("vscp_coalesce_flush_total", "Held back measurement events published", due.size());
+  }
+
+  return due.size();
+}
+
+size_t
+vscpCoalesce::flush(vscpCoalesceHandler fn)
+{
+  return flush(fn, getTime());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// clear
+//
+
+void
+vscpCoalesce::clear(void)
+{
+  pthread_mutex_lock(&m_mutex);
+  for (std::unordered_map<key, entry, keyHash>::iterator it = m_table.begin(); it != m_table.end(); ++it) {
+    dropPending(it->second);
+  }
+  m_table.clear();
+  pthread_mutex_unlock(&m_mutex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getKeyCount
+//
+
+size_t
+vscpCoalesce::getKeyCount(void)
+{
+  pthread_mutex_lock(&m_mutex);
+  size_t cnt = m_table.size();
+  pthread_mutex_unlock(&m_mutex);
+  return cnt;
+}
@@ -0,0 +1,238 @@
+// vscp-coalesce.h
+//
+// Deduplication and rate limiting of measurement events before publish.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(VSCP_COALESCE_H__INCLUDED_)
+#define VSCP_COALESCE_H__INCLUDED_
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+
+#include <vscp.h>
+
+struct vscp_event_view;
+
+// Defaults
+#define VSCP_COALESCE_DEFAULT_DEADBAND     0.0   // Any change is a change
+#define VSCP_COALESCE_DEFAULT_WINDOW       60000 // ms an unchanged value is held back
+#define VSCP_COALESCE_DEFAULT_MIN_INTERVAL 0     // ms between publishes of a key, zero for no limit
+#define VSCP_COALESCE_DEFAULT_MAX_KEYS     4096  // Keys tracked, events for other keys pass
+
+/*!
+  Handler for held back events that are due. The event is only valid
+  during the call.
+*/
+typedef std::function<void(vscpEvent &ev)> vscpCoalesceHandler;
+
+/*!
+  @class vscpCoalesce
+  Decides if a measurement event should be published.
+
+  Measurement events are keyed on GUID, class, type, sensor index,
+  zone and subzone. For each key the last published value is kept.
+  An event whose value is within the deadband of the last published
+  value and with the same unit is suppressed until the window has
+  passed since the last publish. Then it is published again so
+  subscribers that missed the state get it.
+
+  With a minimum interval changed values for a key are not published
+  more often than that. The latest held back event is published by
+  flush() when the interval has passed, so the last state is never
+  lost. A later event with the published value cancels it.
+
+  Events that are not measurements always pass. When max keys are
+  tracked events for new keys pass and are counted as untracked.
+
+  check() and flush() can be called from any thread.
+*/
+
+class vscpCoalesce {
+
+public:
+  vscpCoalesce(void);
+  ~vscpCoalesce(void);
+
+  /*!
+    Set options. Tracked keys are cleared.
+    @param deadband A value that differs this much or less from the
+            last published value is unchanged.
+    @param window ms an unchanged value is suppressed. Zero to
+            suppress unchanged values for ever.
+    @param minInterval Minimum ms between publishes of a key. Zero
+            for no limit.
+    @param maxKeys Max number of keys to track.
+  */
+  void setOptions(double deadband      = VSCP_COALESCE_DEFAULT_DEADBAND,
+                  uint64_t window      = VSCP_COALESCE_DEFAULT_WINDOW,
+                  uint64_t minInterval = VSCP_COALESCE_DEFAULT_MIN_INTERVAL,
+                  size_t maxKeys       = VSCP_COALESCE_DEFAULT_MAX_KEYS);
+
+  /// Enable/disable. When disabled all events pass.
+  void enable(bool bEnable = true) { m_bEnable = bEnable; };
+
+  /// Check if enabled
+  bool isEnabled(void) const { return m_bEnable; };
+
+  /*!
+    Check if an event should be published
+    @param ev Event
+    @param now Time in ms, monotonic
+    @return true if the event should be published, false if it is
+            suppressed or held back.
+  */
+  bool check(const vscp_event_view &ev, uint64_t now);
+
+  /*!
+    Check an event at the current time, see above
+  */
+  bool check(const vscpEvent &ev);
+  bool check(const vscpEventEx &ex);
+
+  /*!
+    Hand held back events that are due to a handler. The handler
+    is called without any lock held.
+    @param fn Handler
+    @param now Time in ms, monotonic
+    @param bAll Hand over all held back events, due or not
+    @return Number of events handed to the handler.
+  */
+  size_t flush(vscpCoalesceHandler fn, uint64_t now, bool bAll = false);
+
+  /*!
+    Flush at the current time, see above
+  */
+  size_t flush(vscpCoalesceHandler fn);
+
+  /*!
+    Hand all held back events to a handler, ignoring the minimum
+    interval. Use before clear() so the last state is not lost.
+    @param fn Handler
+    @return Number of events handed to the handler.
+  */
+  size_t flushAll(vscpCoalesceHandler fn) { return flush(fn, getTime(), true); };
+
+  /*!
+    Check if there are held back events that may be due. Cheap, can
+    be called for every event.
+    @param now Time in ms, monotonic
+    @return true if flush() should be called.
+  */
+  bool isDue(uint64_t now) const { return m_cntPending && (now >= m_nextDue); };
+
+  /*!
+    Forget all tracked keys and held back events. The next event for
+    each key is published.
+  */
+  void clear(void);
+
+  /// Current time in ms, monotonic
+  static uint64_t getTime(void);
+
+  /// Number of tracked keys
+  size_t getKeyCount(void);
+
+  /// Number of held back events
+  size_t getPendingCount(void) const { return m_cntPending; };
+
+  /// Number of measurement events published
+  uint64_t getPublishCount(void) const { return m_cntPublish; };
+
+  /// Number of events suppressed because the value was unchanged
+  uint64_t getUnchangedCount(void) const { return m_cntUnchanged; };
+
+  /// Number of events held back by the minimum interval
+  uint64_t getRateLimitCount(void) const { return m_cntRateLimit; };
+
+  /// Number of held back events published by flush
+  uint64_t getFlushCount(void) const { return m_cntFlush; };
+
+  /// Number of events passed because max keys were tracked
+  uint64_t getUntrackedCount(void) const { return m_cntUntracked; };
+
+private:
+  struct key {
+    uint8_t GUID[16];
+    uint16_t vscp_class;
+    uint16_t vscp_type;
+    uint8_t sensorindex;
+    uint8_t zone;
+    uint8_t subzone;
+
+    bool operator==(const key &other) const { return (0 == memcmp(this, &other, sizeof(key))); };
+  };
+
+  struct keyHash {
+    size_t operator()(const key &k) const;
+  };
+
+  struct entry {
+    double value;        // Last published value
+    uint64_t tsPublish;  // When it was published (ms)
+    double pendingValue; // Value of the held back event
+    vscpEvent *pPending; // Held back event or NULL
+    uint8_t unit;        // Unit of the last published value
+    uint8_t pendingUnit; // Unit of the held back event
+  };
+
+  // Drop a held back event, called with the mutex held
+  void dropPending(entry &e);
+
+private:
+  // Protects the table
+  pthread_mutex_t m_mutex;
+
+  std::atomic<bool> m_bEnable;
+
+  // Options
+  double m_deadband;
+  uint64_t m_window;
+  uint64_t m_minInterval;
+  size_t m_maxKeys;
+
+  // Last values
+  std::unordered_map<key, entry, keyHash> m_table;
+
+  // Earliest time a held back event is due (ms)
+  std::atomic<uint64_t> m_nextDue;
+
+  // Statistics
+  std::atomic<size_t> m_cntPending;
+  std::atomic<uint64_t> m_cntPublish;
+  std::atomic<uint64_t> m_cntUnchanged;
+  std::atomic<uint64_t> m_cntRateLimit;
+  std::atomic<uint64_t> m_cntFlush;
+  std::atomic<uint64_t> m_cntUntracked;
+};
+
+#endif // VSCP_COALESCE_H__INCLUDED_
@@ -0,0 +1,226 @@
+// vscp-eventbus.cpp
+//
+// In-process publish/subscribe event bus.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <vscp-metrics.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include "vscp-eventbus.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// CTor
+//
+
+vscpEventBus::vscpEventBus(void)
+{
+  m_lastId      = 0;
+  m_cntPublish  = 0;
+  m_cntDelivery = 0;
+  pthread_rwlock_init(&m_rwlock, NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DTor
+//
+
+vscpEventBus::~vscpEventBus(void)
+{
+  for (std::map<int, subscriber *>::iterator it = m_subscribers.begin(); it != m_subscribers.end(); ++it) {
+    delete it->second;
+  }
+  m_subscribers.clear();
+  pthread_rwlock_destroy(&m_rwlock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// subscribe
+//
+
+int
+vscpEventBus::subscribe(const std::string &name, const vscpEventFilter *pFilter, vscpEventBusHandler fn)
+{
+  if (!fn) {
+    return -1;
+  }
+
+  subscriber *psub = new subscriber;
+  psub->name       = name;
+  psub->fn         = fn;
+  psub->bFilter    = (NULL != pFilter);
+  if (NULL != pFilter) {
+    psub->filter = *pFilter;
+  }
+  else {
+    vscp_clearVSCPFilter(&psub->filter);
+  }
+
+  pthread_rwlock_wrlock(&m_rwlock);
+
+  psub->id                = ++m_lastId;
+  m_subscribers[psub->id] = psub;
+
+  if (psub->bFilter && (0xffff == psub->filter.mask_class)) {
+    m_byClass[psub->filter.filter_class].push_back(psub);
+  }
+  else {
+    m_anyClass.push_back(psub);
+  }
+
+  pthread_rwlock_unlock(&m_rwlock);
+
+  return psub->id;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// unsubscribe
+//
+
+bool
+vscpEventBus::unsubscribe(int id)
+{
+  pthread_rwlock_wrlock(&m_rwlock);
+
+  std::map<int, subscriber *>::iterator it = m_subscribers.find(id);
+  if (it == m_subscribers.end()) {
+    pthread_rwlock_unlock(&m_rwlock);
+    return false;
+  }
+
+  subscriber *psub = it->second;
+  m_subscribers.erase(it);
+
+  std::vector<subscriber *> *plist = &m_anyClass;
+  if (psub->bFilter && (0xffff == psub->filter.mask_class)) {
+    plist = &m_byClass[psub->filter.filter_class];
+  }
+  plist->erase(std::remove(plist->begin(), plist->end(), psub), plist->end());
+  if (plist->empty() && (plist != &m_anyClass)) {
+    m_byClass.erase(psub->filter.filter_class);
+  }
+
+  pthread_rwlock_unlock(&m_rwlock);
+
+  delete psub;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// deliver
+//
+
+size_t
+vscpEventBus::deliver(const std::vector<subscriber *> &list, const vscpEvent &ev, int idSource)
+{
+  size_t cnt = 0;
+
+  for (size_t i = 0; i < list.size(); i++) {
+    subscriber *psub = list[i];
+    if (psub->id == idSource) {
+      continue;
+    }
+    if (psub->bFilter && !vscp_doLevel2Filter(&ev, &psub->filter)) {
+      VSCP_METRIC_COUNT("vscp_eventbus_filter_reject_total", "Events filtered out by bus subscribers");
+      continue;
+    }
+    psub->fn(ev);
+    cnt++;
+  }
+
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// publish
+//
+
+size_t
+vscpEventBus::publish(const vscpEvent &ev, int idSource)
+{
+  size_t cnt = 0;
+  VSCP_METRIC_TIMER("vscp_eventbus_publish_ns", "Time to deliver an event to all bus subscribers");
+
+  pthread_rwlock_rdlock(&m_rwlock);
+
+  std::unordered_map<uint16_t, std::vector<subscriber *>>::const_iterator it = m_byClass.find(ev.vscp_class);
+  if (it != m_byClass.end()) {
+    cnt += deliver(it->second, ev, idSource);
+  }
+
+  cnt += deliver(m_anyClass, ev, idSource);
+
+  pthread_rwlock_unlock(&m_rwlock);
+
+  m_cntPublish++;
+  m_cntDelivery += cnt;
+
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// publish
+//
+
+size_t
+vscpEventBus::publish(const vscpEventEx &ex, int idSource)
+{
+  // Event header pointing to the data of the ex
+  vscpEvent ev;
+  ev.crc          = ex.crc;
+  ev.obid         = ex.obid;
+  ev.timestamp_ns = ex.timestamp_ns; // Also the date/time fields
+  ev.year         = ex.year;
+  ev.month        = ex.month;
+  ev.head         = ex.head;
+  ev.vscp_class   = ex.vscp_class;
+  ev.vscp_type    = ex.vscp_type;
+  ev.sizeData     = ex.sizeData;
+  ev.pdata        = ex.sizeData ? const_cast<uint8_t *>(ex.data) : NULL;
+  memcpy(ev.GUID, ex.GUID, 16);
+
+  return publish(ev, idSource);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getSubscriberCount
+//
+
+size_t
+vscpEventBus::getSubscriberCount(void)
+{
+  pthread_rwlock_rdlock(&m_rwlock);
+  size_t cnt = m_subscribers.size();
+  pthread_rwlock_unlock(&m_rwlock);
+  return cnt;
+}
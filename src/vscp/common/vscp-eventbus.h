@@ -0,0 +1,148 @@
+// vscp-eventbus.h
+//
+// In-process publish/subscribe event bus.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#if !defined(VSCP_EVENTBUS_H__INCLUDED_)
+#define VSCP_EVENTBUS_H__INCLUDED_
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <vscp.h>
+
+/*!
+  Event bus handler. The event is only valid during the call.
+*/
+typedef std::function<void(const vscpEvent &ev)> vscpEventBusHandler;
+
+/*!
+  @class vscpEventBus
+  Delivers events between components in one process.
+
+  Events are handed to the handlers of all subscribers whose filter
+  accepts them, directly in the publishing thread and without copying
+  or serializing the event. Subscribers whose filter selects a single
+  class are indexed on that class so they are not checked for other
+  events.
+
+  publish() can be called from any thread and from several threads at
+  the same time. Handlers must not block for long and must not call
+  subscribe() or unsubscribe(). A handler that needs the event later
+  has to copy it.
+*/
+
+class vscpEventBus {
+
+public:
+  vscpEventBus(void);
+  ~vscpEventBus(void);
+
+  /*!
+    Add a subscriber
+    @param name Subscriber name, used in log output.
+    @param pFilter Filter for events to deliver. NULL for all events.
+    @param fn Handler
+    @return Subscriber id (> 0) or -1 on failure.
+  */
+  int subscribe(const std::string &name, const vscpEventFilter *pFilter, vscpEventBusHandler fn);
+
+  /*!
+    Remove a subscriber
+    @param id Subscriber id as returned from subscribe
+    @return true if the subscriber was found and removed.
+  */
+  bool unsubscribe(int id);
+
+  /*!
+    Publish an event
+    @param ev Event to publish
+    @param idSource Id of the subscriber publishing the event. It does
+            not get its own events back. Zero for none.
+    @return Number of subscribers the event was delivered to.
+  */
+  size_t publish(const vscpEvent &ev, int idSource = 0);
+
+  /*!
+    Publish an event ex, see above. The data is not copied.
+  */
+  size_t publish(const vscpEventEx &ex, int idSource = 0);
+
+  /*!
+    Get number of subscribers
+    @return Number of subscribers
+  */
+  size_t getSubscriberCount(void);
+
+  /// Number of events published
+  uint64_t getPublishCount(void) const { return m_cntPublish; };
+
+  /// Number of deliveries to subscribers
+  uint64_t getDeliveryCount(void) const { return m_cntDelivery; };
+
+private:
+  struct subscriber {
+    int id;
+    std::string name;
+    bool bFilter; // False if all events are accepted
+    vscpEventFilter filter;
+    vscpEventBusHandler fn;
+  };
+
+  // Deliver to the subscribers in list
+  size_t deliver(const std::vector<subscriber *> &list, const vscpEvent &ev, int idSource);
+
+private:
+  // Protects the subscriber lists
+  pthread_rwlock_t m_rwlock;
+
+  // Last subscriber id handed out
+  int m_lastId;
+
+  // id -> subscriber
+  std::map<int, subscriber *> m_subscribers;
+
+  // Subscribers selecting a single class, keyed on class
+  std::unordered_map<uint16_t, std::vector<subscriber *>> m_byClass;
+
+  // All other subscribers
+  std::vector<subscriber *> m_anyClass;
+
+  std::atomic<uint64_t> m_cntPublish;
+  std::atomic<uint64_t> m_cntDelivery;
+};
+
+#endif // VSCP_EVENTBUS_H__INCLUDED_
@@ -0,0 +1,877 @@
+// vscp-journal.cpp
+//
+// Binary event journal recorder and replayer.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <vscp-client-base.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include "vscp-journal.h"
+
+// Records are padded to this
+#define JOURNAL_ALIGN(n) (((n) + 7) & ~((size_t) 7))
+
+// Max time the writer thread sleeps without checking for sync (ms)
+#define JOURNAL_WRITER_IDLE_WAIT 100
+
+///////////////////////////////////////////////////////////////////////////////
+// journalTime
+//
+// Wall clock time in ns since epoch
+//
+
+static uint64_t
+journalTime(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// journalMonotonic
+//
+// Monotonic time in ns
+//
+
+static uint64_t
+journalMonotonic(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// journalPath
+//
+
+static std::string
+journalPath(const std::string &dir, const std::string &name, uint64_t seq, const char *ext)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), "-%08llu.%s", (unsigned long long) seq, ext);
+  return dir + "/" + name + buf;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// journalSegments
+//
+// Sequence numbers of the segments of a journal, sorted
+//
+
+static bool
+journalSegments(const std::string &dir, const std::string &name, std::vector<uint64_t> &segments)
+{
+  DIR *pdir = opendir(dir.c_str());
+  if (NULL == pdir) {
+    return false;
+  }
+
+  std::string prefix = name + "-";
+  struct dirent *pent;
+  while (NULL != (pent = readdir(pdir))) {
+
+    // name-nnnnnnnn.vjr
+    size_t len = strlen(pent->d_name);
+    if ((len != prefix.length() + 12) || (0 != strncmp(pent->d_name, prefix.c_str(), prefix.length())) ||
+        (0 != strcmp(pent->d_name + len - 4, ".vjr"))) {
+      continue;
+    }
+
+    char *pend;
+    unsigned long long seq = strtoull(pent->d_name + prefix.length(), &pend, 10);
+    if (pend == pent->d_name + len - 4) {
+      segments.push_back(seq);
+    }
+  }
+
+  closedir(pdir);
+  std::sort(segments.begin(), segments.end());
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+//                               vscpJournalWriter
+//-----------------------------------------------------------------------------
+
+///////////////////////////////////////////////////////////////////////////////
+// CTor
+//
+
+vscpJournalWriter::vscpJournalWriter(void)
+{
+  m_segmentSize   = VSCP_JOURNAL_DEFAULT_SEGMENT_SIZE;
+  m_queueSize     = VSCP_JOURNAL_DEFAULT_QUEUE_SIZE;
+  m_syncInterval  = VSCP_JOURNAL_DEFAULT_SYNC_INTERVAL;
+  m_indexInterval = VSCP_JOURNAL_DEFAULT_INDEX_INTERVAL;
+
+  m_bOpen       = false;
+  m_bQuit       = false;
+  m_syncRequest = 0;
+  m_syncDone    = 0;
+
+  m_seq        = 0;
+  m_fdSegment  = -1;
+  m_fdIndex    = -1;
+  m_pmap       = NULL;
+  m_pos        = 0;
+  m_posSynced  = 0;
+  m_posIndexed = 0;
+  m_cntSegment = 0;
+
+  m_cntWrite = 0;
+  m_cntDrop  = 0;
+
+  pthread_mutex_init(&m_mutexSync, NULL);
+  pthread_cond_init(&m_condSync, NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DTor
+//
+
+vscpJournalWriter::~vscpJournalWriter(void)
+{
+  close();
+
+  pthread_mutex_destroy(&m_mutexSync);
+  pthread_cond_destroy(&m_condSync);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// setOptions
+//
+
+void
+vscpJournalWriter::setOptions(size_t segmentSize, size_t queueSize, uint32_t syncInterval, size_t indexInterval)
+{
+  if (m_bOpen) {
+    return;
+  }
+
+  // A segment must hold at least one record of max size
+  m_segmentSize = std::max(segmentSize,
+                           (size_t) (VSCP_JOURNAL_HEADER_SIZE + 2 * VSCP_JOURNAL_RECORD_HEADER_SIZE +
+                                     JOURNAL_ALIGN(VSCP_JOURNAL_MAX_FRAME)));
+
+  m_queueSize = queueSize;
+
+  m_syncInterval  = syncInterval;
+  m_indexInterval = indexInterval;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// open
+//
+
+int
+vscpJournalWriter::open(const std::string &dir, const std::string &name)
+{
+  if (m_bOpen) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  std::vector<uint64_t> segments;
+  if (!journalSegments(dir, name, segments)) {
+    return VSCP_ERROR_INVALID_PATH;
+  }
+
+  m_dir  = dir;
+  m_name = name;
+  m_seq  = segments.empty() ? 0 : segments.back();
+
+  m_queue.init(m_queueSize, sizeof(record));
+  m_syncRequest = 0;
+  m_syncDone    = 0;
+
+  if (!openSegment()) {
+    m_queue.release();
+    return VSCP_ERROR_WRITE_ERROR;
+  }
+
+  m_bQuit = false;
+  if (pthread_create(&m_writerThread, NULL, writerThread, this)) {
+    closeSegment();
+    m_queue.release();
+    return VSCP_ERROR_ERROR;
+  }
+
+  m_bOpen = true;
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// close
+//
+
+void
+vscpJournalWriter::close(void)
+{
+  if (!m_bOpen) {
+    return;
+  }
+
+  m_bOpen = false;
+  m_bQuit = true;
+  m_queue.wake();
+  pthread_join(m_writerThread, NULL);
+
+  closeSegment();
+
+  m_queue.release();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// write
+//
+
+int
+vscpJournalWriter::write(const vscpEvent &ev)
+{
+  return enqueue(vscp_event_view(ev));
+}
+
+int
+vscpJournalWriter::write(const vscpEventEx &ex)
+{
+  return enqueue(vscp_event_view(ex));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// enqueue
+//
+
+int
+vscpJournalWriter::enqueue(const vscp_event_view &ev)
+{
+  if (!m_bOpen) {
+    return VSCP_ERROR_NOT_OPEN;
+  }
+
+  // Checked here as a slot can not be given back once taken
+  if ((ev.sizeData > VSCP_MAX_DATA) || (ev.sizeData && (NULL == ev.pdata))) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  uint64_t time = journalTime();
+
+  size_t pos;
+  record *prec = (record *) m_queue.reserve(&pos);
+  if (NULL == prec) {
+    m_cntDrop++;
+    return VSCP_ERROR_FIFO_FULL;
+  }
+
+  vscp_writeEventToFrame(prec->frame, sizeof(prec->frame), VSCP_ENCRYPTION_NONE, ev);
+  prec->size = (uint32_t) vscp_getFrameSizeFromEvent(ev);
+  prec->time = time;
+  m_queue.commit(pos);
+
+  m_cntWrite++;
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sync
+//
+
+int
+vscpJournalWriter::sync(void)
+{
+  if (!m_bOpen) {
+    return VSCP_ERROR_NOT_OPEN;
+  }
+
+  uint64_t target = m_queue.getEnqueuePos();
+
+  pthread_mutex_lock(&m_mutexSync);
+  if (target > m_syncRequest) {
+    m_syncRequest = target;
+  }
+  pthread_mutex_unlock(&m_mutexSync);
+
+  m_queue.wake();
+
+  pthread_mutex_lock(&m_mutexSync);
+  while (m_syncDone < target) {
+    pthread_cond_wait(&m_condSync, &m_mutexSync);
+  }
+  pthread_mutex_unlock(&m_mutexSync);
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// drain
+//
+
+size_t
+vscpJournalWriter::drain(void)
+{
+  size_t cnt = 0;
+
+  record *prec;
+  while (NULL != (prec = (record *) m_queue.front())) {
+    if (!append(prec->frame, prec->size, prec->time)) {
+      m_cntDrop++;
+    }
+    m_queue.pop();
+    cnt++;
+  }
+
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// writerThread
+//
+
+void *
+vscpJournalWriter::writerThread(void *pData)
+{
+  vscpJournalWriter *pObj = (vscpJournalWriter *) pData;
+  uint64_t lastSync       = journalMonotonic();
+
+  for (;;) {
+
+    size_t cnt = pObj->drain();
+
+    // Periodic sync
+    uint64_t now = journalMonotonic();
+    if (pObj->m_syncInterval && ((now - lastSync) >= (uint64_t) pObj->m_syncInterval * 1000000)) {
+      pObj->syncSegment();
+      lastSync = now;
+    }
+
+    // Sync requested by sync()
+    pthread_mutex_lock(&pObj->m_mutexSync);
+    if ((pObj->m_syncRequest > pObj->m_syncDone) && (pObj->m_queue.getDequeuePos() >= pObj->m_syncRequest)) {
+      pObj->syncSegment();
+      pObj->m_syncDone = pObj->m_queue.getDequeuePos();
+      pthread_cond_broadcast(&pObj->m_condSync);
+    }
+    pthread_mutex_unlock(&pObj->m_mutexSync);
+
+    if (cnt) {
+      continue;
+    }
+
+    if (pObj->m_bQuit) {
+      pObj->drain();
+      break;
+    }
+
+    // Sleep until a producer or sync() wakes us up
+    pObj->m_queue.wait(JOURNAL_WRITER_IDLE_WAIT);
+  }
+
+  return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// append
+//
+
+bool
+vscpJournalWriter::append(const uint8_t *frame, uint32_t size, uint64_t time)
+{
+  size_t recSize = VSCP_JOURNAL_RECORD_HEADER_SIZE + JOURNAL_ALIGN(size);
+
+  // Leave room for the end marker
+  if ((NULL == m_pmap) || (m_pos + recSize + VSCP_JOURNAL_RECORD_HEADER_SIZE > m_segmentSize)) {
+    closeSegment();
+    if (!openSegment()) {
+      return false;
+    }
+  }
+
+  // First record in a segment is always indexed
+  if ((VSCP_JOURNAL_HEADER_SIZE == m_pos) || (m_pos - m_posIndexed >= m_indexInterval)) {
+    uint64_t entry[2] = { time, (uint64_t) m_pos };
+    if (sizeof(entry) == ::write(m_fdIndex, entry, sizeof(entry))) {
+      m_posIndexed = m_pos;
+    }
+  }
+
+  uint8_t *p = m_pmap + m_pos;
+  memcpy(p + 8, &time, sizeof(time));
+  memcpy(p + VSCP_JOURNAL_RECORD_HEADER_SIZE, frame, size);
+
+  // Size last so a reader of a live segment never sees half a record
+  __atomic_store_n((uint32_t *) p, size, __ATOMIC_RELEASE);
+
+  m_pos += recSize;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// openSegment
+//
+
+bool
+vscpJournalWriter::openSegment(void)
+{
+  uint64_t seq = m_seq + 1;
+
+  std::string path = journalPath(m_dir, m_name, seq, "vjr");
+  int fd           = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (-1 == fd) {
+    return false;
+  }
+
+  if (-1 == ftruncate(fd, (off_t) m_segmentSize)) {
+    ::close(fd);
+    return false;
+  }
+
+  void *pmap = mmap(NULL, m_segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (MAP_FAILED == pmap) {
+    ::close(fd);
+    return false;
+  }
+
+  path        = journalPath(m_dir, m_name, seq, "vjx");
+  int fdIndex = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+  if (-1 == fdIndex) {
+    munmap(pmap, m_segmentSize);
+    ::close(fd);
+    return false;
+  }
+
+  m_seq        = seq;
+  m_fdSegment  = fd;
+  m_fdIndex    = fdIndex;
+  m_pmap       = (uint8_t *) pmap;
+  m_pos        = VSCP_JOURNAL_HEADER_SIZE;
+  m_posSynced  = 0;
+  m_posIndexed = VSCP_JOURNAL_HEADER_SIZE;
+  m_cntSegment++;
+
+  // Header
+  uint32_t version    = VSCP_JOURNAL_VERSION;
+  uint32_t headerSize = VSCP_JOURNAL_HEADER_SIZE;
+  uint64_t created    = journalTime();
+  memcpy(m_pmap, VSCP_JOURNAL_MAGIC, 8);
+  memcpy(m_pmap + 8, &version, sizeof(version));
+  memcpy(m_pmap + 12, &headerSize, sizeof(headerSize));
+  memcpy(m_pmap + 16, &m_seq, sizeof(m_seq));
+  memcpy(m_pmap + 24, &created, sizeof(created));
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// closeSegment
+//
+
+void
+vscpJournalWriter::closeSegment(void)
+{
+  if (NULL == m_pmap) {
+    return;
+  }
+
+  syncSegment();
+  munmap(m_pmap, m_segmentSize);
+  m_pmap = NULL;
+
+  // Keep an end marker so readers that have the full size mapped
+  // still find the end within the file
+  if (-1 == ftruncate(m_fdSegment, (off_t) (m_pos + VSCP_JOURNAL_RECORD_HEADER_SIZE))) {
+    ;
+  }
+
+  ::close(m_fdSegment);
+  ::close(m_fdIndex);
+  m_fdSegment = -1;
+  m_fdIndex   = -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// syncSegment
+//
+
+void
+vscpJournalWriter::syncSegment(void)
+{
+  if ((NULL == m_pmap) || (m_pos <= m_posSynced)) {
+    return;
+  }
+
+  // msync wants a page aligned start
+  size_t start = m_posSynced & ~((size_t) sysconf(_SC_PAGESIZE) - 1);
+  msync(m_pmap + start, m_pos - start, MS_SYNC);
+  fdatasync(m_fdIndex);
+  m_posSynced = m_pos;
+}
+
+//-----------------------------------------------------------------------------
+//                               vscpJournalReader
+//-----------------------------------------------------------------------------
+
+///////////////////////////////////////////////////////////////////////////////
+// CTor
+//
+
+vscpJournalReader::vscpJournalReader(void)
+{
+  m_idxSegment = 0;
+  m_fdSegment  = -1;
+  m_pmap       = NULL;
+  m_size       = 0;
+  m_pos        = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DTor
+//
+
+vscpJournalReader::~vscpJournalReader(void)
+{
+  close();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// open
+//
+
+int
+vscpJournalReader::open(const std::string &dir, const std::string &name)
+{
+  close();
+
+  if (!journalSegments(dir, name, m_segments)) {
+    return VSCP_ERROR_INVALID_PATH;
+  }
+
+  if (m_segments.empty()) {
+    return VSCP_ERROR_MISSING;
+  }
+
+  m_dir  = dir;
+  m_name = name;
+
+  if (!openSegment(0)) {
+    return VSCP_ERROR_READ_ERROR;
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// close
+//
+
+void
+vscpJournalReader::close(void)
+{
+  closeSegment();
+  m_segments.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// openSegment
+//
+
+bool
+vscpJournalReader::openSegment(size_t idx)
+{
+  closeSegment();
+
+  if (idx >= m_segments.size()) {
+    return false;
+  }
+
+  m_idxSegment = idx;
+
+  std::string path = journalPath(m_dir, m_name, m_segments[idx], "vjr");
+  int fd           = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (-1 == fd) {
+    return false;
+  }
+
+  struct stat st;
+  if ((-1 == fstat(fd, &st)) || (st.st_size < VSCP_JOURNAL_HEADER_SIZE)) {
+    ::close(fd);
+    return false;
+  }
+
+  void *pmap = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  if (MAP_FAILED == pmap) {
+    ::close(fd);
+    return false;
+  }
+
+  uint32_t version;
+  memcpy(&version, (uint8_t *) pmap + 8, sizeof(version));
+  if ((0 != memcmp(pmap, VSCP_JOURNAL_MAGIC, 8)) || (VSCP_JOURNAL_VERSION != version)) {
+    munmap(pmap, (size_t) st.st_size);
+    ::close(fd);
+    return false;
+  }
+
+  m_fdSegment = fd;
+  m_pmap      = (const uint8_t *) pmap;
+  m_size      = (size_t) st.st_size;
+  m_pos       = VSCP_JOURNAL_HEADER_SIZE;
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// closeSegment
+//
+
+void
+vscpJournalReader::closeSegment(void)
+{
+  if (NULL != m_pmap) {
+    munmap((void *) m_pmap, m_size);
+    m_pmap = NULL;
+  }
+
+  if (-1 != m_fdSegment) {
+    ::close(m_fdSegment);
+    m_fdSegment = -1;
+  }
+
+  m_size = 0;
+  m_pos  = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getSegmentStartTime
+//
+
+uint64_t
+vscpJournalReader::getSegmentStartTime(size_t idx)
+{
+  uint64_t entry[2] = { 0, 0 };
+
+  std::string path = journalPath(m_dir, m_name, m_segments[idx], "vjx");
+  int fd           = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (-1 != fd) {
+    if (sizeof(entry) != ::read(fd, entry, sizeof(entry))) {
+      entry[0] = 0;
+    }
+    ::close(fd);
+  }
+
+  return entry[0];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// seek
+//
+
+int
+vscpJournalReader::seek(uint64_t time)
+{
+  if (m_segments.empty()) {
+    return VSCP_ERROR_NOT_OPEN;
+  }
+
+  // Last segment starting at or before the time
+  size_t idx = 0;
+  for (size_t i = m_segments.size(); i > 0; i--) {
+    uint64_t start = getSegmentStartTime(i - 1);
+    if (start && (start <= time)) {
+      idx = i - 1;
+      break;
+    }
+  }
+
+  if (!openSegment(idx)) {
+    return VSCP_ERROR_READ_ERROR;
+  }
+
+  // Closest index entry at or before the time
+  std::string path = journalPath(m_dir, m_name, m_segments[idx], "vjx");
+  int fd           = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (-1 != fd) {
+    uint64_t entry[2];
+    while (sizeof(entry) == ::read(fd, entry, sizeof(entry))) {
+      if (entry[0] > time) {
+        break;
+      }
+      if ((entry[1] >= VSCP_JOURNAL_HEADER_SIZE) && (entry[1] + VSCP_JOURNAL_RECORD_HEADER_SIZE <= m_size)) {
+        m_pos = (size_t) entry[1];
+      }
+    }
+    ::close(fd);
+  }
+
+  // Scan forward
+  for (;;) {
+
+    while (m_pos + VSCP_JOURNAL_RECORD_HEADER_SIZE <= m_size) {
+
+      uint32_t size = __atomic_load_n((const uint32_t *) (m_pmap + m_pos), __ATOMIC_ACQUIRE);
+      if (0 == size) {
+        break;
+      }
+
+      uint64_t t;
+      memcpy(&t, m_pmap + m_pos + 8, sizeof(t));
+      if (t >= time) {
+        return VSCP_ERROR_SUCCESS;
+      }
+
+      m_pos += VSCP_JOURNAL_RECORD_HEADER_SIZE + JOURNAL_ALIGN(size);
+    }
+
+    if (!openSegment(m_idxSegment + 1)) {
+      return VSCP_ERROR_MISSING;
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// read
+//
+
+int
+vscpJournalReader::read(vscpEvent &ev, uint64_t *ptime)
+{
+  for (;;) {
+
+    if ((NULL != m_pmap) && (m_pos + VSCP_JOURNAL_RECORD_HEADER_SIZE <= m_size)) {
+
+      uint32_t size = __atomic_load_n((const uint32_t *) (m_pmap + m_pos), __ATOMIC_ACQUIRE);
+      if (size) {
+
+        const uint8_t *p = m_pmap + m_pos;
+
+        // Damaged, skip the rest of the segment
+        if ((size > VSCP_JOURNAL_MAX_FRAME) || (m_pos + VSCP_JOURNAL_RECORD_HEADER_SIZE + size > m_size)) {
+          m_pos = m_size;
+          return VSCP_ERROR_INVALID_FRAME;
+        }
+
+        m_pos += VSCP_JOURNAL_RECORD_HEADER_SIZE + JOURNAL_ALIGN(size);
+
+        memset(&ev, 0, sizeof(ev));
+        if (!vscp_getEventFromFrame(&ev, p + VSCP_JOURNAL_RECORD_HEADER_SIZE, size)) {
+          return VSCP_ERROR_INVALID_FRAME;
+        }
+
+        if (NULL != ptime) {
+          memcpy(ptime, p + 8, sizeof(uint64_t));
+        }
+
+        return VSCP_ERROR_SUCCESS;
+      }
+    }
+
+    // End of segment
+    if (m_idxSegment + 1 >= m_segments.size()) {
+      return VSCP_ERROR_FIFO_EMPTY;
+    }
+
+    if (!openSegment(m_idxSegment + 1)) {
+      return VSCP_ERROR_READ_ERROR;
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// replay
+//
+
+long
+vscpJournalReader::replay(CVscpClient &client, double speed, uint64_t endTime, volatile bool *pbQuit)
+{
+  long cnt       = 0;
+  uint64_t first = 0; // Record time of first event
+  uint64_t start = 0; // Monotonic time first event was sent
+
+  vscpEvent ev;
+  uint64_t time;
+
+  while ((NULL == pbQuit) || !*pbQuit) {
+
+    int rv = read(ev, &time);
+    if (VSCP_ERROR_INVALID_FRAME == rv) {
+      continue;
+    }
+    else if (VSCP_ERROR_SUCCESS != rv) {
+      break;
+    }
+
+    if (endTime && (time > endTime)) {
+      delete[] ev.pdata;
+      break;
+    }
+
+    if (speed > 0) {
+      if (0 == cnt) {
+        first = time;
+        start = journalMonotonic();
+      }
+      else if (time > first) {
+
+        // Wait for the due time in short steps so quit is seen
+        uint64_t due = start + (uint64_t) ((double) (time - first) / speed);
+        uint64_t now;
+        while (((now = journalMonotonic()) < due) && ((NULL == pbQuit) || !*pbQuit)) {
+          uint64_t wait = std::min(due - now, (uint64_t) JOURNAL_WRITER_IDLE_WAIT * 1000000);
+          struct timespec ts;
+          ts.tv_sec  = (time_t) (wait / 1000000000);
+          ts.tv_nsec = (long) (wait % 1000000000);
+          nanosleep(&ts, NULL);
+        }
+      }
+    }
+
+    rv = client.send(ev);
+    delete[] ev.pdata;
+    if (VSCP_ERROR_SUCCESS != rv) {
+      return -1;
+    }
+
+    cnt++;
+  }
+
+  return cnt;
+}
@@ -0,0 +1,337 @@
+// vscp-journal.h
+//
+// Binary event journal recorder and replayer.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(VSCP_JOURNAL_H__INCLUDED_)
+#define VSCP_JOURNAL_H__INCLUDED_
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <vscp-bounded-queue.h>
+#include <vscp.h>
+
+class CVscpClient;
+struct vscp_event_view;
+
+// Segment file header magic
+#define VSCP_JOURNAL_MAGIC "VSCPJRNL"
+
+// Segment file format version
+#define VSCP_JOURNAL_VERSION 1
+
+// Size of the segment file header
+#define VSCP_JOURNAL_HEADER_SIZE 64
+
+// Size of the header in front of each record
+#define VSCP_JOURNAL_RECORD_HEADER_SIZE 16
+
+// Largest binary frame for an event (type + header + data + crc)
+#define VSCP_JOURNAL_MAX_FRAME (1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + VSCP_MAX_DATA + 2)
+
+// Defaults
+#define VSCP_JOURNAL_DEFAULT_SEGMENT_SIZE   (64 * 1024 * 1024) // Bytes per segment file
+#define VSCP_JOURNAL_DEFAULT_QUEUE_SIZE     4096               // Events in writer queue (power of two)
+#define VSCP_JOURNAL_DEFAULT_SYNC_INTERVAL  1000               // ms between syncs to disk
+#define VSCP_JOURNAL_DEFAULT_INDEX_INTERVAL (64 * 1024)        // Bytes between index entries
+
+/*
+  Journal files
+
+  A journal is a set of segment files <dir>/<name>-<seq>.vjr where seq
+  is an eight digit sequence number. Each segment has a sparse time
+  index in <dir>/<name>-<seq>.vjx.
+
+  Segment file
+
+    0   "VSCPJRNL"
+    8   uint32_t version
+    12  uint32_t header size
+    16  uint64_t sequence number
+    24  uint64_t creation time (ns since epoch)
+    32  reserved
+    64  records
+
+  Record
+
+    0   uint32_t frame size, zero marks the end of the segment
+    4   uint32_t reserved
+    8   uint64_t record time (ns since epoch)
+    16  event on binary frame format (vscp_writeEventToFrame)
+        padded to a multiple of eight bytes
+
+  Index entry
+
+    0   uint64_t record time (ns since epoch)
+    8   uint64_t offset of record in segment
+
+  All values are in host byte order. Segments are allocated to full size
+  when created and trimmed after an empty record header when closed, so
+  a segment left by a crash also ends at the first zero frame size.
+*/
+
+/*!
+  @class vscpJournalWriter
+  Appends events to a segment rotated binary journal.
+
+  write() never blocks and never takes a lock. Events are encoded in
+  the calling thread into a bounded multi producer queue. A writer
+  thread copies them to a memory mapped segment file, adds index
+  entries, rotates segments and syncs them to disk on the configured
+  interval. If the queue is full the event is dropped and counted.
+*/
+
+class vscpJournalWriter {
+
+public:
+  vscpJournalWriter(void);
+  ~vscpJournalWriter(void);
+
+  /*!
+    Set writer options. Must be called before open.
+    @param segmentSize Max size of a segment file in bytes.
+    @param queueSize Number of events that can wait for the writer
+            thread. Rounded up to a power of two.
+    @param syncInterval Milliseconds between syncs to disk. Zero
+            leaves syncing to the operating system.
+    @param indexInterval Bytes of records between index entries.
+  */
+  void setOptions(size_t segmentSize,
+                  size_t queueSize      = VSCP_JOURNAL_DEFAULT_QUEUE_SIZE,
+                  uint32_t syncInterval = VSCP_JOURNAL_DEFAULT_SYNC_INTERVAL,
+                  size_t indexInterval  = VSCP_JOURNAL_DEFAULT_INDEX_INTERVAL);
+
+  /*!
+    Open a journal and start the writer thread. Recording continues
+    in a new segment after the last existing one.
+    @param dir Folder for the segment files. Must exist.
+    @param name Base name of the segment files.
+    @return VSCP_ERROR_SUCCESS on success, error code on failure.
+  */
+  int open(const std::string &dir, const std::string &name);
+
+  /*!
+    Write what is queued, stop the writer thread and close the
+    journal. No other thread may be in write() at the same time.
+  */
+  void close(void);
+
+  /*!
+    Queue an event for the journal. Lock free and safe to call
+    from any number of threads.
+    @param ev Event to record
+    @return VSCP_ERROR_SUCCESS if queued, VSCP_ERROR_FIFO_FULL if
+            the event was dropped, VSCP_ERROR_NOT_OPEN if the journal
+            is not open, VSCP_ERROR_PARAMETER if the event is invalid.
+  */
+  int write(const vscpEvent &ev);
+
+  /*!
+    Queue an event ex for the journal.
+    @param ex Event ex to record
+    @return Same as write(const vscpEvent &)
+  */
+  int write(const vscpEventEx &ex);
+
+  /*!
+    Make sure everything queued so far is on disk.
+    @return VSCP_ERROR_SUCCESS on success, error code on failure.
+  */
+  int sync(void);
+
+  bool isOpen(void) const { return m_bOpen; };
+
+  // Statistics
+  uint64_t getWriteCount(void) const { return m_cntWrite.load(); };
+  uint64_t getDropCount(void) const { return m_cntDrop.load(); };
+  uint32_t getSegmentCount(void) const { return m_cntSegment; };
+
+private:
+  // Encode and queue an event
+  int enqueue(const vscp_event_view &ev);
+
+  // Writer thread
+  static void *writerThread(void *pData);
+
+  // Move queued records to the segment, returns number moved
+  size_t drain(void);
+
+  // Append one record to the current segment
+  bool append(const uint8_t *frame, uint32_t size, uint64_t time);
+
+  // Start a new segment
+  bool openSegment(void);
+
+  // Trim, sync and close the current segment
+  void closeSegment(void);
+
+  // Sync written part of the segment and the index to disk
+  void syncSegment(void);
+
+private:
+  struct record {
+    uint32_t size;
+    uint64_t time;
+    uint8_t frame[VSCP_JOURNAL_MAX_FRAME];
+  };
+
+  // Options
+  size_t m_segmentSize;
+  size_t m_queueSize;
+  uint32_t m_syncInterval;
+  size_t m_indexInterval;
+
+  std::string m_dir;
+  std::string m_name;
+  std::atomic<bool> m_bOpen;
+  volatile bool m_bQuit;
+
+  // Records waiting for the writer thread
+  vscpBoundedQueue m_queue;
+
+  pthread_t m_writerThread;
+
+  // Sync requests from sync()
+  pthread_mutex_t m_mutexSync;
+  pthread_cond_t m_condSync;
+  uint64_t m_syncRequest;
+  uint64_t m_syncDone;
+
+  // Current segment, owned by the writer thread
+  uint64_t m_seq;
+  int m_fdSegment;
+  int m_fdIndex;
+  uint8_t *m_pmap;
+  size_t m_pos;
+  size_t m_posSynced;
+  size_t m_posIndexed;
+  uint32_t m_cntSegment;
+
+  // Statistics
+  std::atomic<uint64_t> m_cntWrite;
+  std::atomic<uint64_t> m_cntDrop;
+};
+
+/*!
+  @class vscpJournalReader
+  Reads events from a journal written by vscpJournalWriter and
+  replays them to a client.
+
+  Segments are memory mapped one at a time. Seeking uses the sparse
+  index and then scans forward. A segment that is still being
+  written is read up to the last complete record.
+*/
+
+class vscpJournalReader {
+
+public:
+  vscpJournalReader(void);
+  ~vscpJournalReader(void);
+
+  /*!
+    Open a journal for reading. Positioned at the first event.
+    @param dir Folder with the segment files.
+    @param name Base name of the segment files.
+    @return VSCP_ERROR_SUCCESS on success, VSCP_ERROR_MISSING if
+            there are no segments, error code on failure.
+  */
+  int open(const std::string &dir, const std::string &name);
+
+  /*!
+    Close the journal
+  */
+  void close(void);
+
+  /*!
+    Position at the first event recorded at or after a time.
+    @param time Time in ns since epoch.
+    @return VSCP_ERROR_SUCCESS on success, VSCP_ERROR_MISSING if no
+            event is recorded at or after the time.
+  */
+  int seek(uint64_t time);
+
+  /*!
+    Read the next event.
+    @param ev Event that gets the content. ev.pdata is allocated
+            with new[] when there is data and must be deleted by
+            the caller.
+    @param ptime Set to the time the event was recorded (ns since
+            epoch) if not NULL.
+    @return VSCP_ERROR_SUCCESS on success, VSCP_ERROR_FIFO_EMPTY at
+            the end of the journal, VSCP_ERROR_INVALID_FRAME if a
+            record is damaged.
+  */
+  int read(vscpEvent &ev, uint64_t *ptime = NULL);
+
+  /*!
+    Send events from the current position to a client with the
+    same spacing in time as when they were recorded.
+    @param client Client to send the events to. Must be connected.
+    @param speed Replay speed. 1.0 is original timing, 10.0 is ten
+            times faster. Zero sends as fast as possible.
+    @param endTime Stop at events recorded after this time (ns since
+            epoch). Zero replays to the end.
+    @param pbQuit Replay stops when this is set, may be NULL.
+    @return Number of events sent, or -1 if the client failed.
+  */
+  long replay(CVscpClient &client, double speed = 1.0, uint64_t endTime = 0, volatile bool *pbQuit = NULL);
+
+  // Number of segments in the journal
+  size_t getSegmentCount(void) const { return m_segments.size(); };
+
+private:
+  // Map a segment, positioned at the first record
+  bool openSegment(size_t idx);
+
+  // Unmap the current segment
+  void closeSegment(void);
+
+  // First record time of a segment, zero if empty
+  uint64_t getSegmentStartTime(size_t idx);
+
+private:
+  std::string m_dir;
+  std::string m_name;
+
+  // Sequence numbers of the segments, sorted
+  std::vector<uint64_t> m_segments;
+
+  // Current segment
+  size_t m_idxSegment;
+  int m_fdSegment;
+  const uint8_t *m_pmap;
+  size_t m_size;
+  size_t m_pos;
+};
+
+#endif // VSCP_JOURNAL_H__INCLUDED_
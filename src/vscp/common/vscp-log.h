@@ -0,0 +1,109 @@
+// vscp-log.h
+//
+// Log macros with compile time level gating.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(VSCP_LOG_H__INCLUDED_)
+#define VSCP_LOG_H__INCLUDED_
+
+// Log levels, same values as spdlog::level
+#define VSCP_LOG_LEVEL_TRACE    0
+#define VSCP_LOG_LEVEL_DEBUG    1
+#define VSCP_LOG_LEVEL_INFO     2
+#define VSCP_LOG_LEVEL_WARN     3
+#define VSCP_LOG_LEVEL_ERROR    4
+#define VSCP_LOG_LEVEL_CRITICAL 5
+#define VSCP_LOG_LEVEL_OFF      6
+
+// Lowest level compiled in. Log statements below it are removed
+// together with their arguments.
+#ifndef VSCP_LOG_ACTIVE_LEVEL
+#define VSCP_LOG_ACTIVE_LEVEL VSCP_LOG_LEVEL_TRACE
+#endif
+
+/*
+  Log macros. Arguments are only evaluated if the message is logged.
+
+    VSCP_LOG_TRACE(fmt, ...) ... VSCP_LOG_CRITICAL(fmt, ...)
+
+  They log through the spdlog default logger with {} style format.
+  The file must include spdlog. See vscp-syslog.h for syslog.
+
+  A level below VSCP_LOG_ACTIVE_LEVEL costs nothing. A level that is
+  compiled in but below the runtime level costs one check.
+*/
+
+#define VSCP_LOG_SPDLOG(lvl, ...)                                                                                      \
+  do {                                                                                                                 \
+    spdlog::logger *_vscp_logger = spdlog::default_logger_raw();                                                       \
+    if (_vscp_logger->should_log((spdlog::level::level_enum) (lvl))) {                                                 \
+      _vscp_logger->log((spdlog::level::level_enum) (lvl), __VA_ARGS__);                                               \
+    }                                                                                                                  \
+  } while (0)
+
+#define VSCP_LOG_NOTHING()                                                                                             \
+  do {                                                                                                                 \
+  } while (0)
+
+#if VSCP_LOG_ACTIVE_LEVEL <= VSCP_LOG_LEVEL_TRACE
+#define VSCP_LOG_TRACE(...) VSCP_LOG_SPDLOG(VSCP_LOG_LEVEL_TRACE, __VA_ARGS__)
+#else
+#define VSCP_LOG_TRACE(...) VSCP_LOG_NOTHING()
+#endif
+
+#if VSCP_LOG_ACTIVE_LEVEL <= VSCP_LOG_LEVEL_DEBUG
+#define VSCP_LOG_DEBUG(...) VSCP_LOG_SPDLOG(VSCP_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define VSCP_LOG_DEBUG(...) VSCP_LOG_NOTHING()
+#endif
+
+#if VSCP_LOG_ACTIVE_LEVEL <= VSCP_LOG_LEVEL_INFO
+#define VSCP_LOG_INFO(...) VSCP_LOG_SPDLOG(VSCP_LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define VSCP_LOG_INFO(...) VSCP_LOG_NOTHING()
+#endif
+
+#if VSCP_LOG_ACTIVE_LEVEL <= VSCP_LOG_LEVEL_WARN
+#define VSCP_LOG_WARN(...) VSCP_LOG_SPDLOG(VSCP_LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define VSCP_LOG_WARN(...) VSCP_LOG_NOTHING()
+#endif
+
+#if VSCP_LOG_ACTIVE_LEVEL <= VSCP_LOG_LEVEL_ERROR
+#define VSCP_LOG_ERROR(...) VSCP_LOG_SPDLOG(VSCP_LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define VSCP_LOG_ERROR(...) VSCP_LOG_NOTHING()
+#endif
+
+#if VSCP_LOG_ACTIVE_LEVEL <= VSCP_LOG_LEVEL_CRITICAL
+#define VSCP_LOG_CRITICAL(...) VSCP_LOG_SPDLOG(VSCP_LOG_LEVEL_CRITICAL, __VA_ARGS__)
+#else
+#define VSCP_LOG_CRITICAL(...) VSCP_LOG_NOTHING()
+#endif
+
+#endif // VSCP_LOG_H__INCLUDED_
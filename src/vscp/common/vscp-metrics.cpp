@@ -0,0 +1,469 @@
+// vscp-metrics.cpp
+//
+// Runtime metrics, sharded counters and latency histograms.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+#include <malloc.h>
+#endif
+
+#include <algorithm>
+#include <new>
+
+#include <nlohmann/json.hpp>
+
+#include "vscp-metrics.h"
+
+using json = nlohmann::json;
+
+std::atomic<bool> vscpMetrics::m_bEnabled(false);
+
+// Quantiles exported for histograms
+static const double metricsQuantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+
+///////////////////////////////////////////////////////////////////////////////
+// Aligned storage for counters and histograms
+//
+// Their shards are cache line aligned, which plain new does not
+// guarantee before C++17.
+//
+
+template<typename T>
+static T *
+newAligned(const std::string &name, const std::string &help)
+{
+  void *p = NULL;
+#ifdef WIN32
+  p = _aligned_malloc(sizeof(T), alignof(T));
+#else
+  if (0 != posix_memalign(&p, alignof(T), sizeof(T))) {
+    p = NULL;
+  }
+#endif
+  if (NULL == p) {
+    throw std::bad_alloc();
+  }
+
+  return new (p) T(name, help);
+}
+
+template<typename T>
+static void
+deleteAligned(T *p)
+{
+  p->~T();
+#ifdef WIN32
+  _aligned_free(p);
+#else
+  free(p);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscpMetricCounter
+//
+
+vscpMetricCounter::vscpMetricCounter(const std::string &name, const std::string &help)
+{
+  m_name = name;
+  m_help = help;
+  reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getShard
+//
+// Threads get shards round robin in the order they first use a metric
+//
+
+size_t
+vscpMetricCounter::getShard(void)
+{
+  static std::atomic<size_t> next(0);
+  static thread_local size_t shard = next.fetch_add(1, std::memory_order_relaxed) % VSCP_METRICS_SHARDS;
+  return shard;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// get
+//
+
+uint64_t
+vscpMetricCounter::get(void) const
+{
+  uint64_t sum = 0;
+  for (int i = 0; i < VSCP_METRICS_SHARDS; i++) {
+    sum += m_shards[i].m_value.load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// reset
+//
+
+void
+vscpMetricCounter::reset(void)
+{
+  for (int i = 0; i < VSCP_METRICS_SHARDS; i++) {
+    m_shards[i].m_value.store(0, std::memory_order_relaxed);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscpMetricHistogram
+//
+
+vscpMetricHistogram::vscpMetricHistogram(const std::string &name, const std::string &help)
+{
+  m_name = name;
+  m_help = help;
+  reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getBucket
+//
+// Values below VSCP_METRICS_SUB_BUCKETS have a bucket each. Above that
+// each power of two is split in VSCP_METRICS_SUB_BUCKETS linear buckets.
+//
+
+size_t
+vscpMetricHistogram::getBucket(uint64_t value)
+{
+  if (value < VSCP_METRICS_SUB_BUCKETS) {
+    return (size_t) value;
+  }
+
+#if defined(__GNUC__)
+  int msb = 63 - __builtin_clzll(value);
+#else
+  int msb = VSCP_METRICS_SUB_BUCKET_BITS;
+  while (value >> (msb + 1)) {
+    msb++;
+  }
+#endif
+  int shift  = msb - VSCP_METRICS_SUB_BUCKET_BITS;
+  size_t sub = (size_t) (value >> shift) & (VSCP_METRICS_SUB_BUCKETS - 1);
+  return ((size_t) (shift + 1) << VSCP_METRICS_SUB_BUCKET_BITS) + sub;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getBucketMax
+//
+
+uint64_t
+vscpMetricHistogram::getBucketMax(size_t idx)
+{
+  if (idx < VSCP_METRICS_SUB_BUCKETS) {
+    return idx;
+  }
+
+  int shift    = (int) (idx >> VSCP_METRICS_SUB_BUCKET_BITS) - 1;
+  uint64_t sub = idx & (VSCP_METRICS_SUB_BUCKETS - 1);
+  uint64_t min = (VSCP_METRICS_SUB_BUCKETS + sub) << shift;
+  return min + ((1ULL << shift) - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// record
+//
+
+void
+vscpMetricHistogram::record(uint64_t value)
+{
+  shard &s = m_shards[vscpMetricCounter::getShard()];
+  s.m_count.fetch_add(1, std::memory_order_relaxed);
+  s.m_sum.fetch_add(value, std::memory_order_relaxed);
+  m_buckets[getBucket(value)].fetch_add(1, std::memory_order_relaxed);
+
+  uint64_t max = m_max.load(std::memory_order_relaxed);
+  while ((value > max) && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    ;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getCount
+//
+
+uint64_t
+vscpMetricHistogram::getCount(void) const
+{
+  uint64_t cnt = 0;
+  for (int i = 0; i < VSCP_METRICS_SHARDS; i++) {
+    cnt += m_shards[i].m_count.load(std::memory_order_relaxed);
+  }
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getSum
+//
+
+uint64_t
+vscpMetricHistogram::getSum(void) const
+{
+  uint64_t sum = 0;
+  for (int i = 0; i < VSCP_METRICS_SHARDS; i++) {
+    sum += m_shards[i].m_sum.load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getPercentile
+//
+
+uint64_t
+vscpMetricHistogram::getPercentile(double p) const
+{
+  // Count from the buckets so it matches what is summed below
+  uint64_t cnt = 0;
+  for (size_t i = 0; i < VSCP_METRICS_BUCKETS; i++) {
+    cnt += m_buckets[i].load(std::memory_order_relaxed);
+  }
+
+  if (!cnt) {
+    return 0;
+  }
+
+  if (p < 0) {
+    p = 0;
+  }
+  else if (p > 1) {
+    p = 1;
+  }
+
+  uint64_t rank = (uint64_t) (p * cnt + 0.5);
+  if (!rank) {
+    rank = 1;
+  }
+
+  uint64_t sum = 0;
+  for (size_t i = 0; i < VSCP_METRICS_BUCKETS; i++) {
+    sum += m_buckets[i].load(std::memory_order_relaxed);
+    if (sum >= rank) {
+      return std::min(getBucketMax(i), getMax());
+    }
+  }
+
+  return getMax();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// reset
+//
+
+void
+vscpMetricHistogram::reset(void)
+{
+  for (int i = 0; i < VSCP_METRICS_SHARDS; i++) {
+    m_shards[i].m_count.store(0, std::memory_order_relaxed);
+    m_shards[i].m_sum.store(0, std::memory_order_relaxed);
+  }
+  for (size_t i = 0; i < VSCP_METRICS_BUCKETS; i++) {
+    m_buckets[i].store(0, std::memory_order_relaxed);
+  }
+  m_max.store(0, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscpMetrics
+//
+
+vscpMetrics::vscpMetrics(void)
+{
+  pthread_mutex_init(&m_mutex, NULL);
+}
+
+vscpMetrics::~vscpMetrics(void)
+{
+  for (auto it = m_counters.begin(); it != m_counters.end(); ++it) {
+    deleteAligned(it->second);
+  }
+
+  for (auto it = m_histograms.begin(); it != m_histograms.end(); ++it) {
+    deleteAligned(it->second);
+  }
+
+  pthread_mutex_destroy(&m_mutex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getInstance
+//
+// Never deleted so metrics can be used from static destructors
+//
+
+vscpMetrics &
+vscpMetrics::getInstance(void)
+{
+  static vscpMetrics *pmetrics = new vscpMetrics;
+  return *pmetrics;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getCounter
+//
+
+vscpMetricCounter &
+vscpMetrics::getCounter(const std::string &name, const std::string &help)
+{
+  pthread_mutex_lock(&m_mutex);
+  vscpMetricCounter *pcounter = m_counters[name];
+  if (NULL == pcounter) {
+    pcounter = m_counters[name] = newAligned<vscpMetricCounter>(name, help);
+  }
+  pthread_mutex_unlock(&m_mutex);
+
+  return *pcounter;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getHistogram
+//
+
+vscpMetricHistogram &
+vscpMetrics::getHistogram(const std::string &name, const std::string &help)
+{
+  pthread_mutex_lock(&m_mutex);
+  vscpMetricHistogram *phistogram = m_histograms[name];
+  if (NULL == phistogram) {
+    phistogram = m_histograms[name] = newAligned<vscpMetricHistogram>(name, help);
+  }
+  pthread_mutex_unlock(&m_mutex);
+
+  return *phistogram;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getAsPrometheus
+//
+
+std::string
+vscpMetrics::getAsPrometheus(void)
+{
+  std::string str;
+  char buf[256];
+
+  pthread_mutex_lock(&m_mutex);
+
+  for (auto it = m_counters.begin(); it != m_counters.end(); ++it) {
+    vscpMetricCounter *pcounter = it->second;
+    if (pcounter->getHelp().length()) {
+      str += "# HELP " + pcounter->getName() + " " + pcounter->getHelp() + "\n";
+    }
+    str += "# TYPE " + pcounter->getName() + " counter\n";
+    snprintf(buf, sizeof(buf), " %llu\n", (unsigned long long) pcounter->get());
+    str += pcounter->getName() + buf;
+  }
+
+  for (auto it = m_histograms.begin(); it != m_histograms.end(); ++it) {
+    vscpMetricHistogram *phistogram = it->second;
+    if (phistogram->getHelp().length()) {
+      str += "# HELP " + phistogram->getName() + " " + phistogram->getHelp() + "\n";
+    }
+    str += "# TYPE " + phistogram->getName() + " summary\n";
+    for (size_t i = 0; i < sizeof(metricsQuantiles) / sizeof(metricsQuantiles[0]); i++) {
+      snprintf(buf,
+               sizeof(buf),
+               "{quantile=\"%g\"} %llu\n",
+               metricsQuantiles[i],
+               (unsigned long long) phistogram->getPercentile(metricsQuantiles[i]));
+      str += phistogram->getName() + buf;
+    }
+    snprintf(buf, sizeof(buf), "_sum %llu\n", (unsigned long long) phistogram->getSum());
+    str += phistogram->getName() + buf;
+    snprintf(buf, sizeof(buf), "_count %llu\n", (unsigned long long) phistogram->getCount());
+    str += phistogram->getName() + buf;
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+
+  return str;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getAsJSON
+//
+
+std::string
+vscpMetrics::getAsJSON(void)
+{
+  json j;
+  j["counters"]   = json::object();
+  j["histograms"] = json::object();
+
+  pthread_mutex_lock(&m_mutex);
+
+  for (auto it = m_counters.begin(); it != m_counters.end(); ++it) {
+    j["counters"][it->first] = it->second->get();
+  }
+
+  for (auto it = m_histograms.begin(); it != m_histograms.end(); ++it) {
+    vscpMetricHistogram *phistogram = it->second;
+    json jh;
+    jh["count"] = phistogram->getCount();
+    jh["sum"]   = phistogram->getSum();
+    jh["max"]   = phistogram->getMax();
+    jh["p50"]   = phistogram->getPercentile(0.5);
+    jh["p90"]   = phistogram->getPercentile(0.9);
+    jh["p99"]   = phistogram->getPercentile(0.99);
+    jh["p999"]  = phistogram->getPercentile(0.999);
+    j["histograms"][it->first] = jh;
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+
+  return j.dump();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// reset
+//
+
+void
+vscpMetrics::reset(void)
+{
+  pthread_mutex_lock(&m_mutex);
+
+  for (auto it = m_counters.begin(); it != m_counters.end(); ++it) {
+    it->second->reset();
+  }
+
+  for (auto it = m_histograms.begin(); it != m_histograms.end(); ++it) {
+    it->second->reset();
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+}
@@ -0,0 +1,304 @@
+// vscp-metrics.h
+//
+// Runtime metrics, sharded counters and latency histograms.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(VSCP_METRICS_H__INCLUDED_)
+#define VSCP_METRICS_H__INCLUDED_
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+
+// Number of shards per counter, threads are spread over them
+#define VSCP_METRICS_SHARDS 16
+
+// Histogram sub buckets per power of two as bits. Three bits gives
+// eight sub buckets and at most 12.5% error on a recorded value.
+#define VSCP_METRICS_SUB_BUCKET_BITS 3
+#define VSCP_METRICS_SUB_BUCKETS     (1 << VSCP_METRICS_SUB_BUCKET_BITS)
+#define VSCP_METRICS_BUCKETS         ((64 - VSCP_METRICS_SUB_BUCKET_BITS + 1) << VSCP_METRICS_SUB_BUCKET_BITS)
+
+/*!
+  @class vscpMetricCounter
+  Monotonic counter. Each thread adds to its own cache line sized
+  shard so busy threads do not contend, the shards are summed when
+  the counter is read.
+*/
+
+class vscpMetricCounter {
+
+public:
+  vscpMetricCounter(const std::string &name, const std::string &help);
+
+  /*!
+    Add to the counter
+    @param n Value to add
+  */
+  void add(uint64_t n = 1) { m_shards[getShard()].m_value.fetch_add(n, std::memory_order_relaxed); };
+
+  // Current value, sum of all shards
+  uint64_t get(void) const;
+
+  // Set to zero
+  void reset(void);
+
+  const std::string &getName(void) const { return m_name; };
+  const std::string &getHelp(void) const { return m_help; };
+
+  // Shard for the calling thread
+  static size_t getShard(void);
+
+private:
+  struct alignas(64) shard {
+    std::atomic<uint64_t> m_value;
+  };
+
+  std::string m_name;
+  std::string m_help;
+  shard m_shards[VSCP_METRICS_SHARDS];
+};
+
+/*!
+  @class vscpMetricHistogram
+  Latency histogram with log linear buckets (HDR style). Values from
+  zero up to 2^64 are recorded with a fixed relative error and a
+  fixed amount of memory. Recording is a few relaxed atomic adds.
+*/
+
+class vscpMetricHistogram {
+
+public:
+  vscpMetricHistogram(const std::string &name, const std::string &help);
+
+  /*!
+    Record a value
+    @param value Value to record, normally a time in ns
+  */
+  void record(uint64_t value);
+
+  // Number of recorded values
+  uint64_t getCount(void) const;
+
+  // Sum of recorded values
+  uint64_t getSum(void) const;
+
+  // Largest recorded value
+  uint64_t getMax(void) const { return m_max.load(std::memory_order_relaxed); };
+
+  /*!
+    Get a percentile
+    @param p Percentile as 0.0 - 1.0
+    @return Upper bound of the bucket that holds the percentile,
+            zero if nothing is recorded.
+  */
+  uint64_t getPercentile(double p) const;
+
+  // Set to zero
+  void reset(void);
+
+  const std::string &getName(void) const { return m_name; };
+  const std::string &getHelp(void) const { return m_help; };
+
+  // Bucket for a value and the largest value in a bucket
+  static size_t getBucket(uint64_t value);
+  static uint64_t getBucketMax(size_t idx);
+
+private:
+  struct alignas(64) shard {
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_sum;
+  };
+
+  std::string m_name;
+  std::string m_help;
+  shard m_shards[VSCP_METRICS_SHARDS];
+  std::atomic<uint64_t> m_max;
+  std::atomic<uint64_t> m_buckets[VSCP_METRICS_BUCKETS];
+};
+
+/*!
+  @class vscpMetrics
+  Process wide registry of counters and histograms.
+
+  Metrics are created on first use and live as long as the process.
+  Collection is off until enabled. Instrumentation should go through
+  the VSCP_METRIC_ macros below, which cost a relaxed load and a
+  branch when collection is off, and nothing at all when built with
+  VSCP_METRICS_DISABLE.
+
+  Names should follow the Prometheus conventions, for example
+  vscp_client_queue_push_total for a counter and
+  vscp_mqtt_publish_ns for a histogram.
+*/
+
+class vscpMetrics {
+
+public:
+  // The registry
+  static vscpMetrics &getInstance(void);
+
+  // True if collection is on
+  static bool isEnabled(void) { return m_bEnabled.load(std::memory_order_relaxed); };
+
+  // Turn collection on/off
+  static void enable(bool bEnable = true) { m_bEnabled.store(bEnable, std::memory_order_relaxed); };
+
+  /*!
+    Get a counter, it is created if it does not exist
+    @param name Metric name
+    @param help Description of the metric
+    @return Reference to the counter, valid for the process life time
+  */
+  vscpMetricCounter &getCounter(const std::string &name, const std::string &help = "");
+
+  /*!
+    Get a histogram, it is created if it does not exist
+    @param name Metric name
+    @param help Description of the metric
+    @return Reference to the histogram, valid for the process life time
+  */
+  vscpMetricHistogram &getHistogram(const std::string &name, const std::string &help = "");
+
+  /*!
+    Get all metrics on the Prometheus text exposition format.
+    Histograms are exported as summaries with the 0.5, 0.9, 0.99 and
+    0.999 quantiles.
+    @return Metrics as text
+  */
+  std::string getAsPrometheus(void);
+
+  /*!
+    Get all metrics as a JSON object
+    @return Metrics as JSON
+  */
+  std::string getAsJSON(void);
+
+  // Set all metrics to zero
+  void reset(void);
+
+  // Monotonic time in ns for timing
+  static uint64_t now(void)
+  {
+    return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+  };
+
+private:
+  vscpMetrics(void);
+  ~vscpMetrics(void);
+
+  static std::atomic<bool> m_bEnabled;
+
+  // Protects the maps, not the metrics
+  pthread_mutex_t m_mutex;
+
+  std::map<std::string, vscpMetricCounter *> m_counters;
+  std::map<std::string, vscpMetricHistogram *> m_histograms;
+};
+
+/*!
+  @class vscpMetricTimer
+  Records the time from construction to destruction in a histogram.
+  Does nothing if the histogram is NULL.
+*/
+
+class vscpMetricTimer {
+
+public:
+  vscpMetricTimer(vscpMetricHistogram *phistogram)
+  {
+    m_phistogram = phistogram;
+    m_start      = (NULL != phistogram) ? vscpMetrics::now() : 0;
+  };
+
+  ~vscpMetricTimer()
+  {
+    if (NULL != m_phistogram) {
+      m_phistogram->record(vscpMetrics::now() - m_start);
+    }
+  };
+
+private:
+  vscpMetricHistogram *m_phistogram;
+  uint64_t m_start;
+};
+
+/*
+  Instrumentation macros. The metric is looked up once per call site.
+
+    VSCP_METRIC_COUNT(name, help)        Add one to a counter
+    VSCP_METRIC_ADD(name, help, n)       Add n to a counter
+    VSCP_METRIC_RECORD(name, help, v)    Record a value in a histogram
+    VSCP_METRIC_TIMER(name, help)        Time the rest of the scope, once per scope
+*/
+
+#ifndef VSCP_METRICS_DISABLE
+
+#define VSCP_METRIC_ADD(name, help, n)                                                                                 \
+  do {                                                                                                                 \
+    if (vscpMetrics::isEnabled()) {                                                                                    \
+      static vscpMetricCounter &_vscp_metric = vscpMetrics::getInstance().getCounter(name, help);                      \
+      _vscp_metric.add(n);                                                                                             \
+    }                                                                                                                  \
+  } while (0)
+
+#define VSCP_METRIC_RECORD(name, help, v)                                                                              \
+  do {                                                                                                                 \
+    if (vscpMetrics::isEnabled()) {                                                                                    \
+      static vscpMetricHistogram &_vscp_metric = vscpMetrics::getInstance().getHistogram(name, help);                  \
+      _vscp_metric.record(v);                                                                                          \
+    }                                                                                                                  \
+  } while (0)
+
+#define VSCP_METRIC_TIMER(name, help)                                                                                  \
+  static vscpMetricHistogram &_vscp_metric_histogram = vscpMetrics::getInstance().getHistogram(name, help);            \
+  vscpMetricTimer _vscp_metric_timer(vscpMetrics::isEnabled() ? &_vscp_metric_histogram : NULL)
+
+#else
+
+#define VSCP_METRIC_ADD(name, help, n)                                                                                 \
+  do {                                                                                                                 \
+  } while (0)
+#define VSCP_METRIC_RECORD(name, help, v)                                                                              \
+  do {                                                                                                                 \
+  } while (0)
+#define VSCP_METRIC_TIMER(name, help)                                                                                  \
+  do {                                                                                                                 \
+  } while (0)
+
+#endif
+
+#define VSCP_METRIC_COUNT(name, help) VSCP_METRIC_ADD(name, help, 1)
+
+#endif // VSCP_METRICS_H__INCLUDED_
@@ -0,0 +1,342 @@
+// vscp-scheduler.cpp
+//
+// Periodic task scheduler for daemon main loops.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <vscp.h>
+
+#include "vscp-scheduler.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// CTor
+//
+
+vscpScheduler::vscpScheduler(void)
+{
+  m_epollfd       = -1;
+  m_timerfd       = -1;
+  m_wakeupfd      = -1;
+  m_lastId        = 0;
+  m_armedDeadline = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DTor
+//
+
+vscpScheduler::~vscpScheduler(void)
+{
+  if (-1 != m_wakeupfd) {
+    close(m_wakeupfd);
+  }
+
+  if (-1 != m_timerfd) {
+    close(m_timerfd);
+  }
+
+  if (-1 != m_epollfd) {
+    close(m_epollfd);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// init
+//
+
+int
+vscpScheduler::init(void)
+{
+  if (-1 != m_epollfd) {
+    return VSCP_ERROR_SUCCESS; // Already initialized
+  }
+
+  if (-1 == (m_epollfd = epoll_create1(EPOLL_CLOEXEC))) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  if (-1 == (m_timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC))) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  if (-1 == (m_wakeupfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events  = EPOLLIN;
+  ev.data.fd = m_timerfd;
+  if (-1 == epoll_ctl(m_epollfd, EPOLL_CTL_ADD, m_timerfd, &ev)) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  ev.data.fd = m_wakeupfd;
+  if (-1 == epoll_ctl(m_epollfd, EPOLL_CTL_ADD, m_wakeupfd, &ev)) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// now
+//
+
+uint64_t
+vscpScheduler::now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// addTask
+//
+
+int
+vscpScheduler::addTask(const std::string &name, uint64_t interval, std::function<void(void)> fn, uint64_t delay)
+{
+  if (!fn) {
+    return -1;
+  }
+
+  int id = ++m_lastId;
+
+  task t;
+  t.name     = name;
+  t.interval = interval;
+  t.deadline = now() + delay;
+  t.fn       = fn;
+
+  m_queue.insert(std::make_pair(t.deadline, id));
+  m_tasks[id] = t;
+
+  armTimer();
+  return id;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// removeTask
+//
+
+bool
+vscpScheduler::removeTask(int id)
+{
+  std::map<int, task>::iterator it = m_tasks.find(id);
+  if (it == m_tasks.end()) {
+    return false;
+  }
+
+  m_queue.erase(std::make_pair(it->second.deadline, id));
+  m_tasks.erase(it);
+
+  armTimer();
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// addFd
+//
+
+int
+vscpScheduler::addFd(int fd, std::function<void(void)> fn)
+{
+  if ((-1 == m_epollfd) || (fd < 0) || !fn) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events  = EPOLLIN;
+  ev.data.fd = fd;
+  if (-1 == epoll_ctl(m_epollfd, EPOLL_CTL_ADD, fd, &ev)) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  m_fds[fd] = fn;
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// removeFd
+//
+
+bool
+vscpScheduler::removeFd(int fd)
+{
+  if (!m_fds.erase(fd)) {
+    return false;
+  }
+
+  epoll_ctl(m_epollfd, EPOLL_CTL_DEL, fd, NULL);
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// wakeup
+//
+
+void
+vscpScheduler::wakeup(void)
+{
+  if (-1 != m_wakeupfd) {
+    uint64_t one = 1;
+    ssize_t rv   = write(m_wakeupfd, &one, sizeof(one));
+    (void) rv;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// armTimer
+//
+
+void
+vscpScheduler::armTimer(void)
+{
+  if (-1 == m_timerfd) {
+    return;
+  }
+
+  uint64_t deadline = m_queue.empty() ? 0 : m_queue.begin()->first;
+  if (deadline == m_armedDeadline) {
+    return;
+  }
+
+  // Zero disarms, so a deadline at time zero is moved one us
+  struct itimerspec its;
+  memset(&its, 0, sizeof(its));
+  if (!m_queue.empty()) {
+    if (0 == deadline) {
+      deadline = 1;
+    }
+    its.it_value.tv_sec  = (time_t) (deadline / 1000000);
+    its.it_value.tv_nsec = (long) (deadline % 1000000) * 1000;
+  }
+
+  if (0 == timerfd_settime(m_timerfd, TFD_TIMER_ABSTIME, &its, NULL)) {
+    m_armedDeadline = deadline;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// runDueTasks
+//
+
+void
+vscpScheduler::runDueTasks(void)
+{
+  uint64_t t = now();
+
+  while (!m_queue.empty() && (m_queue.begin()->first <= t)) {
+
+    int id = m_queue.begin()->second;
+    m_queue.erase(m_queue.begin());
+
+    std::map<int, task>::iterator it = m_tasks.find(id);
+    if (it == m_tasks.end()) {
+      continue;
+    }
+
+    // The handler may remove the task, so keep a copy
+    std::function<void(void)> fn = it->second.fn;
+
+    if (0 == it->second.interval) {
+      m_tasks.erase(it);
+    }
+    else {
+      // Keep the rate, but do not try to catch up on missed runs
+      it->second.deadline += it->second.interval;
+      if (it->second.deadline <= t) {
+        it->second.deadline = t + it->second.interval;
+      }
+      m_queue.insert(std::make_pair(it->second.deadline, id));
+    }
+
+    fn();
+  }
+
+  armTimer();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// runOnce
+//
+
+int
+vscpScheduler::runOnce(int timeout)
+{
+  if (-1 == m_epollfd) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  struct epoll_event events[VSCP_SCHEDULER_MAX_EVENTS];
+  int n = epoll_wait(m_epollfd, events, VSCP_SCHEDULER_MAX_EVENTS, timeout);
+  if (n < 0) {
+    return (EINTR == errno) ? VSCP_ERROR_TIMEOUT : VSCP_ERROR_ERROR;
+  }
+
+  bool bHandled = false;
+  for (int i = 0; i < n; i++) {
+
+    int fd = events[i].data.fd;
+    uint64_t cnt;
+
+    if (fd == m_timerfd) {
+      if (read(m_timerfd, &cnt, sizeof(cnt)) > 0) {
+        m_armedDeadline = 0; // Expired
+      }
+      bHandled = true;
+      runDueTasks();
+    }
+    else if (fd == m_wakeupfd) {
+      if (read(m_wakeupfd, &cnt, sizeof(cnt)) < 0) {
+        ;
+      }
+    }
+    else {
+      // The handler may remove the descriptor, so keep a copy
+      std::map<int, std::function<void(void)>>::iterator it = m_fds.find(fd);
+      if (it != m_fds.end()) {
+        std::function<void(void)> fn = it->second;
+        bHandled                     = true;
+        fn();
+      }
+    }
+  }
+
+  return bHandled ? VSCP_ERROR_SUCCESS : VSCP_ERROR_TIMEOUT;
+}
@@ -0,0 +1,164 @@
+// vscp-scheduler.h
+//
+// Periodic task scheduler for daemon main loops.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(VSCP_SCHEDULER_H__INCLUDED_)
+#define VSCP_SCHEDULER_H__INCLUDED_
+
+#include <stdint.h>
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+
+// Max number of epoll events handled in one wait
+#define VSCP_SCHEDULER_MAX_EVENTS 16
+
+/*!
+  @class vscpScheduler
+  Runs periodic tasks and file descriptor handlers from one thread.
+
+  The thread sleeps in epoll_wait until the earliest task deadline
+  (a timerfd armed on CLOCK_MONOTONIC), a registered descriptor gets
+  readable or wakeup() is called. There are no wake ups when nothing
+  is due.
+
+  Tasks and descriptors are added, removed and run from the thread
+  calling runOnce(). Handlers may add or remove tasks, including
+  their own. wakeup() can be called from any thread and from
+  signal handlers. Linux only.
+*/
+
+class vscpScheduler {
+
+public:
+  vscpScheduler(void);
+  ~vscpScheduler(void);
+
+  /*!
+    Create the epoll set, timer and wake up descriptors.
+    @return VSCP_ERROR_SUCCESS on success, VSCP_ERROR_ERROR on failure.
+  */
+  int init(void);
+
+  /*!
+    Add a task
+    @param name Task name, used in log output.
+    @param interval Interval in microseconds. Zero for a one shot task
+            that is removed after it has run.
+    @param fn Task handler
+    @param delay Microseconds until the task runs the first time.
+    @return Task id (> 0) or -1 on failure.
+  */
+  int addTask(const std::string &name, uint64_t interval, std::function<void(void)> fn, uint64_t delay = 0);
+
+  /*!
+    Remove a task
+    @param id Task id as returned from addTask
+    @return true if the task was found and removed.
+  */
+  bool removeTask(int id);
+
+  /*!
+    Get number of tasks
+    @return Number of registered tasks
+  */
+  size_t getTaskCount(void) const { return m_tasks.size(); };
+
+  /*!
+    Watch a file descriptor. The handler is called when the
+    descriptor is readable.
+    @param fd Descriptor to watch
+    @param fn Handler
+    @return VSCP_ERROR_SUCCESS on success, VSCP_ERROR_ERROR on failure.
+  */
+  int addFd(int fd, std::function<void(void)> fn);
+
+  /*!
+    Stop watching a file descriptor
+    @param fd Descriptor to stop watching
+    @return true if the descriptor was found and removed.
+  */
+  bool removeFd(int fd);
+
+  /*!
+    Wait for and run due tasks and ready descriptors once.
+    @param timeout Max time to wait in milliseconds, -1 waits until
+            something happens.
+    @return VSCP_ERROR_SUCCESS if something was handled,
+            VSCP_ERROR_TIMEOUT if the wait timed out or was woken
+            up, VSCP_ERROR_ERROR on failure.
+  */
+  int runOnce(int timeout = -1);
+
+  /*!
+    Make a thread blocked in runOnce return. Async signal safe.
+  */
+  void wakeup(void);
+
+private:
+  // Monotonic time in microseconds
+  static uint64_t now(void);
+
+  // Arm the timer for the earliest deadline
+  void armTimer(void);
+
+  // Run all tasks that are due
+  void runDueTasks(void);
+
+private:
+  struct task {
+    std::string name;
+    uint64_t interval;  // us, zero for one shot
+    uint64_t deadline;  // us, monotonic
+    std::function<void(void)> fn;
+  };
+
+  int m_epollfd;
+  int m_timerfd;
+  int m_wakeupfd;
+
+  // Last task id handed out
+  int m_lastId;
+
+  // id -> task
+  std::map<int, task> m_tasks;
+
+  // Tasks ordered on (deadline, id)
+  std::set<std::pair<uint64_t, int>> m_queue;
+
+  // Deadline the timer is armed for, zero if disarmed
+  uint64_t m_armedDeadline;
+
+  // fd -> handler
+  std::map<int, std::function<void(void)>> m_fds;
+};
+
+#endif // VSCP_SCHEDULER_H__INCLUDED_
@@ -0,0 +1,1016 @@
+// vscp-shm.cpp
+//
+// Shared memory event channel for processes on the same host.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <new>
+
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include "spdlog/spdlog.h"
+
+#include "vscp-shm.h"
+
+// The rings are shared between processes (uint32_t is an unsigned int
+// on all supported platforms)
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared memory rings need lock free atomics");
+static_assert(sizeof(uint32_t) == sizeof(unsigned int), "Shared memory ring indexes must be unsigned int");
+
+// Segment parts are aligned to this
+#define SHM_ALIGN(n) (((n) + 63) & ~((uint64_t) 63))
+
+// Smallest frame that can hold an event
+#define SHM_MIN_FRAME (1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + 2)
+
+// Max time the service thread sleeps without looking at all rings (ms)
+#define SHM_SERVICE_IDLE_WAIT 100
+
+// Max epoll events handled per wakeup
+#define SHM_MAX_EVENTS 32
+
+// What an epoll event is for, low byte of the event data. The
+// rest is the client id.
+#define SHM_FD_LISTEN   1
+#define SHM_FD_QUIT     2
+#define SHM_FD_SOCKET   3
+#define SHM_FD_DOORBELL 4
+
+#define SHM_TAG(id, kind) (((uint64_t) (id) << 8) | (kind))
+
+///////////////////////////////////////////////////////////////////////////////
+// vscpShmChannel
+//
+
+vscpShmChannel::vscpShmChannel(void)
+{
+  m_fdSegment     = -1;
+  m_fdDoorbell[0] = -1;
+  m_fdDoorbell[1] = -1;
+  m_pmap          = nullptr;
+  m_size          = 0;
+  m_queueSize     = 0;
+  m_pring[0]      = nullptr;
+  m_pring[1]      = nullptr;
+  m_pslots[0]     = nullptr;
+  m_pslots[1]     = nullptr;
+  m_rx            = RING_TO_SERVER;
+  m_tx            = RING_TO_CLIENT;
+  m_head          = 0;
+  m_tail          = 0;
+}
+
+vscpShmChannel::~vscpShmChannel(void)
+{
+  close();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// create
+//
+
+int
+vscpShmChannel::create(uint32_t queueSize)
+{
+  close();
+
+  // Power of two, at least two slots
+  uint32_t size = 2;
+  while ((size < queueSize) && (size < VSCP_SHM_MAX_QUEUE_SIZE)) {
+    size <<= 1;
+  }
+
+  uint64_t offsetRing0  = SHM_ALIGN(sizeof(vscp_shm_header));
+  uint64_t offsetSlots0 = SHM_ALIGN(offsetRing0 + sizeof(vscp_shm_ring));
+  uint64_t offsetRing1  = SHM_ALIGN(offsetSlots0 + (uint64_t) size * VSCP_SHM_SLOT_SIZE);
+  uint64_t offsetSlots1 = SHM_ALIGN(offsetRing1 + sizeof(vscp_shm_ring));
+  uint64_t total        = offsetSlots1 + (uint64_t) size * VSCP_SHM_SLOT_SIZE;
+
+  if (-1 == (m_fdSegment = memfd_create("vscp-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING))) {
+    return VSCP_ERROR_ERRNO;
+  }
+
+  // Sealed so the client can not shrink the segment under us
+  if ((-1 == ftruncate(m_fdSegment, (off_t) total)) ||
+      (-1 == fcntl(m_fdSegment, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL))) {
+    close();
+    return VSCP_ERROR_ERRNO;
+  }
+
+  void *p = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, m_fdSegment, 0);
+  if (MAP_FAILED == p) {
+    close();
+    return VSCP_ERROR_MEMORY;
+  }
+
+  m_pmap = (uint8_t *) p;
+  m_size = total;
+
+  vscp_shm_header *phdr = (vscp_shm_header *) m_pmap;
+  memcpy(phdr->magic, VSCP_SHM_MAGIC, sizeof(phdr->magic));
+  phdr->version        = VSCP_SHM_VERSION;
+  phdr->queueSize      = size;
+  phdr->slotSize       = VSCP_SHM_SLOT_SIZE;
+  phdr->reserved       = 0;
+  phdr->offsetRing[0]  = offsetRing0;
+  phdr->offsetRing[1]  = offsetRing1;
+  phdr->offsetSlots[0] = offsetSlots0;
+  phdr->offsetSlots[1] = offsetSlots1;
+
+  // The memfd is zero filled, which is an empty ring
+  new (m_pmap + offsetRing0) vscp_shm_ring();
+  new (m_pmap + offsetRing1) vscp_shm_ring();
+
+  for (int i = 0; i < 2; i++) {
+    if (-1 == (m_fdDoorbell[i] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))) {
+      close();
+      return VSCP_ERROR_ERRNO;
+    }
+  }
+
+  setup(RING_TO_SERVER, RING_TO_CLIENT);
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// attach
+//
+
+int
+vscpShmChannel::attach(int fdSegment, int fdToServer, int fdToClient, uint64_t size)
+{
+  struct stat st;
+
+  close();
+
+  m_fdSegment                  = fdSegment;
+  m_fdDoorbell[RING_TO_SERVER] = fdToServer;
+  m_fdDoorbell[RING_TO_CLIENT] = fdToClient;
+
+  if ((fdSegment < 0) || (fdToServer < 0) || (fdToClient < 0)) {
+    close();
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  // Must be the sealed segment we were told about
+  int seals = fcntl(fdSegment, F_GET_SEALS);
+  if ((-1 == fstat(fdSegment, &st)) || ((uint64_t) st.st_size != size) || (size < sizeof(vscp_shm_header)) ||
+      (-1 == seals) || !(seals & F_SEAL_SHRINK)) {
+    close();
+    return VSCP_ERROR_INVALID_FRAME;
+  }
+
+  void *p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fdSegment, 0);
+  if (MAP_FAILED == p) {
+    close();
+    return VSCP_ERROR_MEMORY;
+  }
+
+  m_pmap = (uint8_t *) p;
+  m_size = size;
+
+  vscp_shm_header *phdr = (vscp_shm_header *) m_pmap;
+  uint32_t queueSize    = phdr->queueSize;
+  if (memcmp(phdr->magic, VSCP_SHM_MAGIC, sizeof(phdr->magic)) || (VSCP_SHM_VERSION != phdr->version) ||
+      (VSCP_SHM_SLOT_SIZE != phdr->slotSize) || (queueSize < 2) || (queueSize > VSCP_SHM_MAX_QUEUE_SIZE) ||
+      (queueSize & (queueSize - 1))) {
+    close();
+    return VSCP_ERROR_INVALID_FRAME;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if ((phdr->offsetRing[i] & 63) || (phdr->offsetSlots[i] & 63) ||
+        (phdr->offsetRing[i] + sizeof(vscp_shm_ring) > size) ||
+        (phdr->offsetSlots[i] + (uint64_t) queueSize * VSCP_SHM_SLOT_SIZE > size)) {
+      close();
+      return VSCP_ERROR_INVALID_FRAME;
+    }
+  }
+
+  setup(RING_TO_CLIENT, RING_TO_SERVER);
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// setup
+//
+// Layout is read once. Later changes to the header by the other
+// end are never looked at.
+//
+
+void
+vscpShmChannel::setup(int rx, int tx)
+{
+  vscp_shm_header *phdr = (vscp_shm_header *) m_pmap;
+
+  m_queueSize = phdr->queueSize;
+  for (int i = 0; i < 2; i++) {
+    m_pring[i]  = (vscp_shm_ring *) (m_pmap + phdr->offsetRing[i]);
+    m_pslots[i] = m_pmap + phdr->offsetSlots[i];
+  }
+
+  m_rx   = rx;
+  m_tx   = tx;
+  m_head = m_pring[tx]->head.load(std::memory_order_acquire);
+  m_tail = m_pring[rx]->tail.load(std::memory_order_acquire);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// close
+//
+
+void
+vscpShmChannel::close(void)
+{
+  if (nullptr != m_pmap) {
+    munmap(m_pmap, m_size);
+    m_pmap = nullptr;
+  }
+
+  if (-1 != m_fdSegment) {
+    ::close(m_fdSegment);
+    m_fdSegment = -1;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (-1 != m_fdDoorbell[i]) {
+      ::close(m_fdDoorbell[i]);
+      m_fdDoorbell[i] = -1;
+    }
+    m_pring[i]  = nullptr;
+    m_pslots[i] = nullptr;
+  }
+
+  m_size      = 0;
+  m_queueSize = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// put
+//
+
+int
+vscpShmChannel::put(const vscpEvent &ev)
+{
+  return enqueue(vscp_event_view(ev));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// put
+//
+
+int
+vscpShmChannel::put(const vscpEventEx &ex)
+{
+  return enqueue(vscp_event_view(ex));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// enqueue
+//
+
+int
+vscpShmChannel::enqueue(const vscp_event_view &ev)
+{
+  if (nullptr == m_pmap) {
+    return VSCP_ERROR_NOT_OPEN;
+  }
+
+  if ((ev.sizeData > VSCP_MAX_DATA) || (ev.sizeData && (nullptr == ev.pdata))) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  // Our own copy of head, the one in the segment is only written
+  vscp_shm_ring *pring = m_pring[m_tx];
+  uint32_t tail        = pring->tail.load(std::memory_order_acquire);
+  if ((uint32_t) (m_head - tail) >= m_queueSize) {
+    return VSCP_ERROR_FIFO_FULL;
+  }
+
+  uint8_t *pslot = m_pslots[m_tx] + (size_t) (m_head & (m_queueSize - 1)) * VSCP_SHM_SLOT_SIZE;
+  if (!vscp_writeEventToFrame(pslot + 8, VSCP_SHM_MAX_FRAME, VSCP_ENCRYPTION_NONE, ev)) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  uint32_t size = (uint32_t) vscp_getFrameSizeFromEvent(ev);
+  memcpy(pslot, &size, sizeof(size));
+
+  m_head++;
+  pring->head.store(m_head, std::memory_order_release);
+
+  // Pairs with the fence in arm(). Either the consumer sees the new
+  // head or we see that it is waiting.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (pring->waiting.load(std::memory_order_relaxed)) {
+    pring->waiting.store(0, std::memory_order_relaxed);
+    eventfd_write(m_fdDoorbell[m_tx], 1);
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// get
+//
+
+int
+vscpShmChannel::get(vscpEvent &ev)
+{
+  uint8_t frame[VSCP_SHM_MAX_FRAME];
+  uint32_t size;
+
+  if (nullptr == m_pmap) {
+    return VSCP_ERROR_NOT_OPEN;
+  }
+
+  vscp_shm_ring *pring = m_pring[m_rx];
+  uint32_t head        = pring->head.load(std::memory_order_acquire);
+  if (head == m_tail) {
+    return VSCP_ERROR_FIFO_EMPTY;
+  }
+
+  if ((uint32_t) (head - m_tail) > m_queueSize) {
+    return VSCP_ERROR_INVALID_FRAME;
+  }
+
+  // Copy out before checking so the other end can not change
+  // the frame after it has been checked
+  const uint8_t *pslot = m_pslots[m_rx] + (size_t) (m_tail & (m_queueSize - 1)) * VSCP_SHM_SLOT_SIZE;
+  memcpy(&size, pslot, sizeof(size));
+  if ((size < SHM_MIN_FRAME) || (size > VSCP_SHM_MAX_FRAME)) {
+    return VSCP_ERROR_INVALID_FRAME;
+  }
+  memcpy(frame, pslot + 8, size);
+
+  m_tail++;
+  pring->tail.store(m_tail, std::memory_order_release);
+
+  memset(&ev, 0, sizeof(vscpEvent));
+  if (!vscp_getEventFromFrame(&ev, frame, size)) {
+    return VSCP_ERROR_INVALID_FRAME;
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// arm
+//
+
+bool
+vscpShmChannel::arm(void)
+{
+  if (nullptr == m_pmap) {
+    return true;
+  }
+
+  vscp_shm_ring *pring = m_pring[m_rx];
+  pring->waiting.store(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (pring->head.load(std::memory_order_acquire) != m_tail) {
+    pring->waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// clearDoorbell
+//
+
+void
+vscpShmChannel::clearDoorbell(void)
+{
+  eventfd_t val;
+  if (-1 != m_fdDoorbell[m_rx]) {
+    eventfd_read(m_fdDoorbell[m_rx], &val);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// wakeup
+//
+
+void
+vscpShmChannel::wakeup(void)
+{
+  if (-1 != m_fdDoorbell[m_rx]) {
+    eventfd_write(m_fdDoorbell[m_rx], 1);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getCount
+//
+
+uint32_t
+vscpShmChannel::getCount(void) const
+{
+  if (nullptr == m_pmap) {
+    return 0;
+  }
+
+  uint32_t cnt = m_pring[m_rx]->head.load(std::memory_order_acquire) - m_tail;
+  return (cnt > m_queueSize) ? 0 : cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// flush
+//
+
+void
+vscpShmChannel::flush(void)
+{
+  if (nullptr == m_pmap) {
+    return;
+  }
+
+  uint32_t head = m_pring[m_rx]->head.load(std::memory_order_acquire);
+  if ((uint32_t) (head - m_tail) <= m_queueSize) {
+    m_tail = head;
+    m_pring[m_rx]->tail.store(m_tail, std::memory_order_release);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscpShmServer
+//
+
+vscpShmServer::vscpShmServer(void)
+{
+  m_queueSize     = VSCP_SHM_DEFAULT_QUEUE_SIZE;
+  m_maxClients    = VSCP_SHM_DEFAULT_MAX_CLIENTS;
+  m_sock          = -1;
+  m_fdEpoll       = -1;
+  m_fdQuit        = -1;
+  m_bRunning      = false;
+  m_serviceThread = 0;
+  m_lastId        = 0;
+  m_cntReceive    = 0;
+  m_cntSend       = 0;
+  m_cntDrop       = 0;
+
+  pthread_mutex_init(&m_mutexClients, NULL);
+}
+
+vscpShmServer::~vscpShmServer(void)
+{
+  stop();
+  pthread_mutex_destroy(&m_mutexClients);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// setOptions
+//
+
+void
+vscpShmServer::setOptions(uint32_t queueSize, size_t maxClients)
+{
+  m_queueSize  = queueSize ? queueSize : VSCP_SHM_DEFAULT_QUEUE_SIZE;
+  m_maxClients = maxClients ? maxClients : VSCP_SHM_DEFAULT_MAX_CLIENTS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// start
+//
+
+int
+vscpShmServer::start(const std::string &path, eventHandler fn)
+{
+  struct sockaddr_un addr;
+  struct stat st;
+
+  if (m_bRunning) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  if (path.empty() || (path.length() >= sizeof(addr.sun_path))) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+  if (-1 == (m_sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC | SOCK_NONBLOCK, 0))) {
+    return VSCP_ERROR_SOCKET;
+  }
+
+  // Remove a socket left behind, but not one that is in use
+  if ((0 == lstat(path.c_str(), &st)) && S_ISSOCK(st.st_mode)) {
+    int sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if ((-1 != sock) && (0 == connect(sock, (struct sockaddr *) &addr, sizeof(addr)))) {
+      ::close(sock);
+      ::close(m_sock);
+      m_sock = -1;
+      return VSCP_ERROR_ALREADY_DEFINED;
+    }
+    if (-1 != sock) {
+      ::close(sock);
+    }
+    unlink(path.c_str());
+  }
+
+  if ((-1 == bind(m_sock, (struct sockaddr *) &addr, sizeof(addr))) || (-1 == listen(m_sock, 16))) {
+    ::close(m_sock);
+    m_sock = -1;
+    return VSCP_ERROR_SOCKET;
+  }
+
+  m_path    = path;
+  m_fnEvent = fn;
+
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+
+  if ((-1 == (m_fdEpoll = epoll_create1(EPOLL_CLOEXEC))) ||
+      (-1 == (m_fdQuit = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)))) {
+    stop();
+    return VSCP_ERROR_ERRNO;
+  }
+
+  ev.events   = EPOLLIN;
+  ev.data.u64 = SHM_TAG(0, SHM_FD_LISTEN);
+  epoll_ctl(m_fdEpoll, EPOLL_CTL_ADD, m_sock, &ev);
+
+  ev.events   = EPOLLIN;
+  ev.data.u64 = SHM_TAG(0, SHM_FD_QUIT);
+  epoll_ctl(m_fdEpoll, EPOLL_CTL_ADD, m_fdQuit, &ev);
+
+  m_bRunning = true;
+  if (pthread_create(&m_serviceThread, NULL, serviceThread, this)) {
+    m_bRunning = false;
+    stop();
+    return VSCP_ERROR_ERROR;
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// stop
+//
+
+void
+vscpShmServer::stop(void)
+{
+  if (m_bRunning) {
+    eventfd_write(m_fdQuit, 1);
+    pthread_join(m_serviceThread, NULL);
+    m_bRunning = false;
+  }
+
+  // Service thread is gone, nobody else removes clients
+  while (!m_clients.empty()) {
+    dropClient(m_clients.begin()->second);
+  }
+
+  if (-1 != m_fdEpoll) {
+    ::close(m_fdEpoll);
+    m_fdEpoll = -1;
+  }
+
+  if (-1 != m_fdQuit) {
+    ::close(m_fdQuit);
+    m_fdQuit = -1;
+  }
+
+  if (-1 != m_sock) {
+    ::close(m_sock);
+    m_sock = -1;
+    unlink(m_path.c_str());
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// send
+//
+
+int
+vscpShmServer::send(uint32_t id, const vscpEvent &ev)
+{
+  int rv = VSCP_ERROR_SUCCESS;
+
+  pthread_mutex_lock(&m_mutexClients);
+
+  std::map<uint32_t, client *>::iterator it = m_clients.find(id);
+  if (m_clients.end() == it) {
+    pthread_mutex_unlock(&m_mutexClients);
+    return VSCP_ERROR_UNKNOWN_ITEM;
+  }
+
+  client *pClient = it->second;
+  if (pClient->bReady && vscp_doLevel2Filter(&ev, &pClient->filter)) {
+    rv = pClient->channel.put(ev);
+    if (VSCP_ERROR_SUCCESS == rv) {
+      m_cntSend++;
+    }
+    else if (VSCP_ERROR_FIFO_FULL == rv) {
+      m_cntDrop++;
+    }
+  }
+
+  pthread_mutex_unlock(&m_mutexClients);
+
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendAll
+//
+
+size_t
+vscpShmServer::sendAll(const vscpEvent &ev, uint32_t idExclude)
+{
+  size_t cnt = 0;
+
+  pthread_mutex_lock(&m_mutexClients);
+
+  for (std::map<uint32_t, client *>::iterator it = m_clients.begin(); it != m_clients.end(); ++it) {
+
+    client *pClient = it->second;
+    if ((idExclude == pClient->id) || !pClient->bReady || !vscp_doLevel2Filter(&ev, &pClient->filter)) {
+      continue;
+    }
+
+    int rv = pClient->channel.put(ev);
+    if (VSCP_ERROR_SUCCESS == rv) {
+      cnt++;
+    }
+    else if (VSCP_ERROR_FIFO_FULL == rv) {
+      m_cntDrop++;
+    }
+  }
+
+  pthread_mutex_unlock(&m_mutexClients);
+
+  m_cntSend += cnt;
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getClientCount
+//
+
+size_t
+vscpShmServer::getClientCount(void)
+{
+  size_t cnt = 0;
+
+  pthread_mutex_lock(&m_mutexClients);
+  for (std::map<uint32_t, client *>::iterator it = m_clients.begin(); it != m_clients.end(); ++it) {
+    if (it->second->bReady) {
+      cnt++;
+    }
+  }
+  pthread_mutex_unlock(&m_mutexClients);
+
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// acceptClient
+//
+
+void
+vscpShmServer::acceptClient(void)
+{
+  int sock;
+
+  while (-1 != (sock = accept4(m_sock, NULL, NULL, SOCK_CLOEXEC | SOCK_NONBLOCK))) {
+
+    if (m_clients.size() >= m_maxClients) {
+      spdlog::warn("shm: Max number of clients ({}) connected. Connection refused.", m_maxClients);
+      ::close(sock);
+      continue;
+    }
+
+    client *pClient = new client;
+    pClient->sock   = sock;
+    pClient->bReady = false;
+    vscp_clearVSCPFilter(&pClient->filter);
+
+    // Id zero means no client
+    if (0 == ++m_lastId) {
+      m_lastId++;
+    }
+    pClient->id = m_lastId;
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events   = EPOLLIN | EPOLLRDHUP;
+    ev.data.u64 = SHM_TAG(pClient->id, SHM_FD_SOCKET);
+    if (-1 == epoll_ctl(m_fdEpoll, EPOLL_CTL_ADD, sock, &ev)) {
+      ::close(sock);
+      delete pClient;
+      continue;
+    }
+
+    pthread_mutex_lock(&m_mutexClients);
+    m_clients[pClient->id] = pClient;
+    pthread_mutex_unlock(&m_mutexClients);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// handleMessage
+//
+
+bool
+vscpShmServer::handleMessage(client *pClient)
+{
+  vscp_shm_msg msg;
+
+  ssize_t n = recv(pClient->sock, &msg, sizeof(msg), MSG_DONTWAIT);
+  if (n < 0) {
+    return ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno));
+  }
+
+  // Zero is the client hanging up
+  if ((size_t) n != sizeof(msg) || memcmp(msg.magic, VSCP_SHM_MAGIC, sizeof(msg.magic)) ||
+      (VSCP_SHM_VERSION != msg.version)) {
+    if (n) {
+      spdlog::warn("shm: Invalid control message from client {}.", pClient->id);
+    }
+    return false;
+  }
+
+  switch (msg.cmd) {
+
+    case VSCP_SHM_CMD_HELLO: {
+
+      if (pClient->bReady) {
+        return false;
+      }
+
+      uint32_t queueSize = m_queueSize;
+      if (msg.queueSize && (msg.queueSize < queueSize)) {
+        queueSize = msg.queueSize;
+      }
+
+      vscp_shm_msg reply;
+      memset(&reply, 0, sizeof(reply));
+      memcpy(reply.magic, VSCP_SHM_MAGIC, sizeof(reply.magic));
+      reply.version = VSCP_SHM_VERSION;
+      reply.cmd     = VSCP_SHM_CMD_HELLO;
+      reply.result  = pClient->channel.create(queueSize);
+
+      struct iovec iov;
+      iov.iov_base = &reply;
+      iov.iov_len  = sizeof(reply);
+
+      struct msghdr mh;
+      memset(&mh, 0, sizeof(mh));
+      mh.msg_iov    = &iov;
+      mh.msg_iovlen = 1;
+
+      union {
+        char buf[CMSG_SPACE(3 * sizeof(int))];
+        struct cmsghdr align;
+      } ctrl;
+
+      if (VSCP_ERROR_SUCCESS == reply.result) {
+
+        reply.queueSize = pClient->channel.getQueueSize();
+        reply.size      = pClient->channel.getSize();
+
+        int fds[3] = { pClient->channel.getSegment(),
+                       pClient->channel.getDoorbellToServer(),
+                       pClient->channel.getDoorbellToClient() };
+
+        memset(&ctrl, 0, sizeof(ctrl));
+        mh.msg_control    = ctrl.buf;
+        mh.msg_controllen = sizeof(ctrl.buf);
+
+        struct cmsghdr *pcmsg = CMSG_FIRSTHDR(&mh);
+        pcmsg->cmsg_level     = SOL_SOCKET;
+        pcmsg->cmsg_type      = SCM_RIGHTS;
+        pcmsg->cmsg_len       = CMSG_LEN(sizeof(fds));
+        memcpy(CMSG_DATA(pcmsg), fds, sizeof(fds));
+      }
+      else {
+        spdlog::error("shm: Failed to create channel for client {}. rv={}", pClient->id, reply.result);
+      }
+
+      if ((-1 == sendmsg(pClient->sock, &mh, MSG_NOSIGNAL)) || (VSCP_ERROR_SUCCESS != reply.result)) {
+        return false;
+      }
+
+      struct epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events   = EPOLLIN;
+      ev.data.u64 = SHM_TAG(pClient->id, SHM_FD_DOORBELL);
+      if (-1 == epoll_ctl(m_fdEpoll, EPOLL_CTL_ADD, pClient->channel.getDoorbell(), &ev)) {
+        return false;
+      }
+
+      // Ring the doorbell for the first event
+      pClient->channel.arm();
+
+      pthread_mutex_lock(&m_mutexClients);
+      pClient->bReady = true;
+      pthread_mutex_unlock(&m_mutexClients);
+
+      spdlog::debug("shm: Client {} connected. queue-size={}", pClient->id, pClient->channel.getQueueSize());
+    } break;
+
+    case VSCP_SHM_CMD_FILTER:
+      pthread_mutex_lock(&m_mutexClients);
+      memcpy(&pClient->filter, &msg.filter, sizeof(vscpEventFilter));
+      pthread_mutex_unlock(&m_mutexClients);
+      break;
+
+    default:
+      spdlog::warn("shm: Unknown control message {} from client {}.", msg.cmd, pClient->id);
+      return false;
+  }
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// drain
+//
+
+bool
+vscpShmServer::drain(client *pClient)
+{
+  vscpEvent ev;
+
+  if (!pClient->bReady) {
+    return true;
+  }
+
+  // At most a ring full, then the other clients get their turn
+  for (uint32_t i = 0; i < pClient->channel.getQueueSize(); i++) {
+
+    int rv = pClient->channel.get(ev);
+    if (VSCP_ERROR_FIFO_EMPTY == rv) {
+      if (pClient->channel.arm()) {
+        return true;
+      }
+      continue;
+    }
+
+    if (VSCP_ERROR_SUCCESS != rv) {
+      spdlog::error("shm: Corrupt ring from client {}. Disconnecting.", pClient->id);
+      return false;
+    }
+
+    m_cntReceive++;
+    if (m_fnEvent) {
+      m_fnEvent(pClient->id, ev);
+    }
+
+    if (nullptr != ev.pdata) {
+      delete[] ev.pdata;
+    }
+  }
+
+  // More to do, come back after the others
+  pClient->channel.wakeup();
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// dropClient
+//
+
+void
+vscpShmServer::dropClient(client *pClient)
+{
+  epoll_ctl(m_fdEpoll, EPOLL_CTL_DEL, pClient->sock, NULL);
+  if (pClient->bReady) {
+    epoll_ctl(m_fdEpoll, EPOLL_CTL_DEL, pClient->channel.getDoorbell(), NULL);
+    spdlog::debug("shm: Client {} disconnected.", pClient->id);
+  }
+
+  pthread_mutex_lock(&m_mutexClients);
+  m_clients.erase(pClient->id);
+  pthread_mutex_unlock(&m_mutexClients);
+
+  ::close(pClient->sock);
+  delete pClient;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// serviceThread
+//
+// Only this thread adds and removes clients, so it can use a client
+// without holding the lock.
+//
+
+void *
+vscpShmServer::serviceThread(void *pData)
+{
+  vscpShmServer *pObj = (vscpShmServer *) pData;
+  struct epoll_event events[SHM_MAX_EVENTS];
+
+  while (true) {
+
+    int n = epoll_wait(pObj->m_fdEpoll, events, SHM_MAX_EVENTS, SHM_SERVICE_IDLE_WAIT);
+    if (-1 == n) {
+      if (EINTR == errno) {
+        continue;
+      }
+      spdlog::error("shm: Service thread failed to wait. errno={}", errno);
+      break;
+    }
+
+    // A client that forgets to ring the doorbell is still served
+    if (0 == n) {
+      std::map<uint32_t, client *>::iterator it = pObj->m_clients.begin();
+      while (it != pObj->m_clients.end()) {
+        client *pClient = (it++)->second;
+        if (!pObj->drain(pClient)) {
+          pObj->dropClient(pClient);
+        }
+      }
+      continue;
+    }
+
+    for (int i = 0; i < n; i++) {
+
+      uint32_t kind = events[i].data.u64 & 0xff;
+      uint32_t id   = (uint32_t) (events[i].data.u64 >> 8);
+
+      if (SHM_FD_QUIT == kind) {
+        return NULL;
+      }
+
+      if (SHM_FD_LISTEN == kind) {
+        pObj->acceptClient();
+        continue;
+      }
+
+      // May have been dropped earlier in this round
+      std::map<uint32_t, client *>::iterator it = pObj->m_clients.find(id);
+      if (pObj->m_clients.end() == it) {
+        continue;
+      }
+
+      client *pClient = it->second;
+
+      if (SHM_FD_DOORBELL == kind) {
+        pClient->channel.clearDoorbell();
+        if (!pObj->drain(pClient)) {
+          pObj->dropClient(pClient);
+        }
+      }
+      else if (SHM_FD_SOCKET == kind) {
+
+        bool bOk = true;
+        if (events[i].events & EPOLLIN) {
+          bOk = pObj->handleMessage(pClient);
+        }
+
+        if (!bOk || (events[i].events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR))) {
+          // Events sent before the client went away are delivered
+          pObj->drain(pClient);
+          pObj->dropClient(pClient);
+        }
+      }
+    }
+  }
+
+  return NULL;
+}
@@ -0,0 +1,382 @@
+// vscp-shm.h
+//
+// Shared memory event channel for processes on the same host.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(VSCP_SHM_H__INCLUDED_)
+#define VSCP_SHM_H__INCLUDED_
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <string>
+
+#include <vscp.h>
+
+struct vscp_event_view;
+
+// Segment header magic
+#define VSCP_SHM_MAGIC "VSCPSHM1"
+
+// Segment and control message format version
+#define VSCP_SHM_VERSION 1
+
+// Largest binary frame for an event (type + header + data + crc)
+#define VSCP_SHM_MAX_FRAME (1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + VSCP_MAX_DATA + 2)
+
+// Size of a ring slot (frame size + frame), a multiple of a cache line
+#define VSCP_SHM_SLOT_SIZE ((8 + VSCP_SHM_MAX_FRAME + 63) & ~63)
+
+// Defaults
+#define VSCP_SHM_DEFAULT_PATH        "/var/run/vscpd-shm.sock" // Socket clients connect to
+#define VSCP_SHM_DEFAULT_QUEUE_SIZE  1024                      // Events in each ring (power of two)
+#define VSCP_SHM_MAX_QUEUE_SIZE      65536                     // Largest ring a client can ask for
+#define VSCP_SHM_DEFAULT_MAX_CLIENTS 16                        // Clients connected at the same time
+
+// Control messages on the socket
+#define VSCP_SHM_CMD_HELLO  1 // Client asks for a channel, server replies with the descriptors
+#define VSCP_SHM_CMD_FILTER 2 // Client sets the filter for events sent to it
+
+/*
+  Shared memory channel
+
+  A client connects to a Unix domain seqpacket socket and sends a
+  hello. The server creates a sealed memfd segment with two single
+  producer single consumer rings and two eventfd doorbells, and passes
+  the three descriptors back with SCM_RIGHTS. Nothing is created in the
+  file system except the socket, and the segment goes away with the
+  last process that has it mapped.
+
+  Segment
+
+    0   header (vscp_shm_header)
+        ring 0 client -> server (vscp_shm_ring + slots)
+        ring 1 server -> client (vscp_shm_ring + slots)
+
+  Slot
+
+    0   uint32_t frame size
+    4   uint32_t reserved
+    8   event on binary frame format (vscp_writeEventToFrame)
+
+  The socket stays open for as long as the channel is used. When either
+  side exits, crashes or is killed the other side sees the socket hang
+  up and drops the channel. A process only ever reads what the peer
+  wrote through a private copy and checks it, so a peer that scribbles
+  over the segment can corrupt its own events but not crash the other
+  side. All values are in host byte order.
+
+  Doorbells
+
+  The producer rings the doorbell only if the consumer has said it is
+  about to sleep, so a busy channel moves events without system calls.
+*/
+
+// Control message, same layout in both directions
+struct vscp_shm_msg {
+  char magic[8];          // VSCP_SHM_MAGIC
+  uint32_t version;       // VSCP_SHM_VERSION
+  uint32_t cmd;           // VSCP_SHM_CMD_xxx
+  int32_t result;         // Reply, VSCP_ERROR_SUCCESS or error code
+  uint32_t queueSize;     // Events in each ring
+  uint64_t size;          // Segment size (reply to hello)
+  vscpEventFilter filter; // VSCP_SHM_CMD_FILTER
+};
+
+// Ring control block, fields on their own cache lines
+struct vscp_shm_ring {
+  alignas(64) std::atomic<uint32_t> head;    // Next slot to write, producer only
+  alignas(64) std::atomic<uint32_t> tail;    // Next slot to read, consumer only
+  alignas(64) std::atomic<uint32_t> waiting; // Set by the consumer before it sleeps
+};
+
+// Segment header
+struct vscp_shm_header {
+  char magic[8];           // VSCP_SHM_MAGIC
+  uint32_t version;        // VSCP_SHM_VERSION
+  uint32_t queueSize;      // Events in each ring
+  uint32_t slotSize;       // VSCP_SHM_SLOT_SIZE
+  uint32_t reserved;       //
+  uint64_t offsetRing[2];  // Ring control blocks
+  uint64_t offsetSlots[2]; // First slot of each ring
+};
+
+/*!
+  @class vscpShmChannel
+  One end of a shared memory channel.
+
+  put() and get() never block and never make a system call unless the
+  other end is waiting for events. One thread at a time may call put()
+  and one thread at a time may call get().
+*/
+
+class vscpShmChannel {
+
+public:
+  // Ring index
+  enum { RING_TO_SERVER = 0, RING_TO_CLIENT = 1 };
+
+  vscpShmChannel(void);
+  ~vscpShmChannel(void);
+
+  /*!
+    Create a new segment and doorbells. Used by the server.
+    @param queueSize Events in each ring. Rounded up to a power of two.
+    @return VSCP_ERROR_SUCCESS on success, error code on failure.
+  */
+  int create(uint32_t queueSize);
+
+  /*!
+    Map a segment created by the server. Used by the client. The
+    channel owns the descriptors after the call, also on failure.
+    @param fdSegment Segment memfd.
+    @param fdToServer Doorbell for the client -> server ring.
+    @param fdToClient Doorbell for the server -> client ring.
+    @param size Segment size reported by the server.
+    @return VSCP_ERROR_SUCCESS on success, error code on failure.
+  */
+  int attach(int fdSegment, int fdToServer, int fdToClient, uint64_t size);
+
+  /// Unmap the segment and close the descriptors
+  void close(void);
+
+  /*!
+    Write an event to the ring towards the other end
+    @param ev Event to send
+    @return VSCP_ERROR_SUCCESS on success, VSCP_ERROR_FIFO_FULL if
+            there is no room, VSCP_ERROR_PARAMETER if the event is
+            invalid.
+  */
+  int put(const vscpEvent &ev);
+
+  /*!
+    Write an event ex to the ring towards the other end
+    @param ex Event ex to send
+    @return Same as put(const vscpEvent &)
+  */
+  int put(const vscpEventEx &ex);
+
+  /*!
+    Read an event from the ring from the other end
+    @param ev Event that gets the content. ev.pdata is allocated with
+            new[] when there is data and must be deleted by the caller.
+    @return VSCP_ERROR_SUCCESS on success, VSCP_ERROR_FIFO_EMPTY if
+            there is nothing to read, VSCP_ERROR_INVALID_FRAME if the
+            other end has corrupted the ring.
+  */
+  int get(vscpEvent &ev);
+
+  /*!
+    Tell the other end to ring the doorbell for the next event. Must
+    be called before waiting on the receive doorbell.
+    @return true if it is safe to wait, false if there are events to
+            read.
+  */
+  bool arm(void);
+
+  /// Reset the receive doorbell
+  void clearDoorbell(void);
+
+  /// Ring the receive doorbell, makes a waiter come back to get()
+  void wakeup(void);
+
+  /// Number of events waiting to be read
+  uint32_t getCount(void) const;
+
+  /// Throw away all events waiting to be read
+  void flush(void);
+
+  /// Descriptor to wait on for received events
+  int getDoorbell(void) const { return m_fdDoorbell[m_rx]; };
+
+  int getSegment(void) const { return m_fdSegment; };
+  int getDoorbellToServer(void) const { return m_fdDoorbell[RING_TO_SERVER]; };
+  int getDoorbellToClient(void) const { return m_fdDoorbell[RING_TO_CLIENT]; };
+  uint64_t getSize(void) const { return m_size; };
+  uint32_t getQueueSize(void) const { return m_queueSize; };
+
+  bool isOpen(void) const { return (nullptr != m_pmap); };
+
+private:
+  // Encode an event into the next slot
+  int enqueue(const vscp_event_view &ev);
+
+  // Set up ring pointers, rx/tx are the rings this end reads/writes
+  void setup(int rx, int tx);
+
+private:
+  int m_fdSegment;
+  int m_fdDoorbell[2];
+
+  uint8_t *m_pmap;
+  uint64_t m_size;
+  uint32_t m_queueSize;
+
+  // Rings in the segment
+  vscp_shm_ring *m_pring[2];
+  uint8_t *m_pslots[2];
+
+  // Ring this end reads and ring it writes
+  int m_rx;
+  int m_tx;
+
+  // Private copies of our positions. The copies in the segment are
+  // only written, the other end may have changed them.
+  uint32_t m_head;
+  uint32_t m_tail;
+};
+
+/*!
+  @class vscpShmServer
+  Accepts shared memory clients on a Unix domain socket.
+
+  A service thread waits on the socket and on all doorbells with epoll,
+  sets up new channels, drops channels whose client has gone away and
+  hands received events to the event handler. Events are sent to
+  clients with send() and sendAll(), which never wait. If a client
+  does not keep up its events are dropped and counted.
+*/
+
+class vscpShmServer {
+
+public:
+  /*!
+    Event handler, called in the service thread for every event from a
+    client. The event is only valid during the call.
+  */
+  typedef std::function<void(uint32_t id, vscpEvent &ev)> eventHandler;
+
+  vscpShmServer(void);
+  ~vscpShmServer(void);
+
+  /*!
+    Set server options. Must be called before start.
+    @param queueSize Largest ring a client gets. Rounded up to a power
+            of two.
+    @param maxClients Max number of clients connected at the same time.
+  */
+  void setOptions(uint32_t queueSize = VSCP_SHM_DEFAULT_QUEUE_SIZE, size_t maxClients = VSCP_SHM_DEFAULT_MAX_CLIENTS);
+
+  /*!
+    Listen for clients and start the service thread
+    @param path Path of the socket. A socket left there by a process
+            that is gone is removed.
+    @param fn Handler for events from clients.
+    @return VSCP_ERROR_SUCCESS on success, error code on failure.
+  */
+  int start(const std::string &path, eventHandler fn);
+
+  /// Stop the service thread, drop all clients and remove the socket
+  void stop(void);
+
+  bool isRunning(void) const { return m_bRunning; };
+
+  /*!
+    Send an event to one client. The client filter is applied.
+    @param id Client id
+    @param ev Event to send
+    @return VSCP_ERROR_SUCCESS if sent or filtered out,
+            VSCP_ERROR_FIFO_FULL if dropped, VSCP_ERROR_UNKNOWN_ITEM
+            if there is no such client.
+  */
+  int send(uint32_t id, const vscpEvent &ev);
+
+  /*!
+    Send an event to all clients whose filter accepts it
+    @param ev Event to send
+    @param idExclude Client that should not get the event, zero for none.
+    @return Number of clients the event was sent to.
+  */
+  size_t sendAll(const vscpEvent &ev, uint32_t idExclude = 0);
+
+  /// Number of connected clients
+  size_t getClientCount(void);
+
+  // Statistics
+  uint64_t getReceiveCount(void) const { return m_cntReceive.load(); };
+  uint64_t getSendCount(void) const { return m_cntSend.load(); };
+  uint64_t getDropCount(void) const { return m_cntDrop.load(); };
+
+private:
+  struct client {
+    uint32_t id;
+    int sock;
+    bool bReady; // Hello handled, channel set up
+    vscpEventFilter filter;
+    vscpShmChannel channel;
+  };
+
+  // Service thread
+  static void *serviceThread(void *pData);
+
+  // Accept a client on the listen socket
+  void acceptClient(void);
+
+  // Handle a control message, false if the client should be dropped
+  bool handleMessage(client *pClient);
+
+  // Hand received events to the handler, false on a corrupt ring
+  bool drain(client *pClient);
+
+  // Remove a client and free its channel
+  void dropClient(client *pClient);
+
+private:
+  // Options
+  uint32_t m_queueSize;
+  size_t m_maxClients;
+
+  std::string m_path;
+  eventHandler m_fnEvent;
+
+  int m_sock;
+  int m_fdEpoll;
+  int m_fdQuit;
+
+  std::atomic<bool> m_bRunning;
+  pthread_t m_serviceThread;
+
+  // Protects the client map and the client filters
+  pthread_mutex_t m_mutexClients;
+
+  // Last client id handed out
+  uint32_t m_lastId;
+
+  // id -> client
+  std::map<uint32_t, client *> m_clients;
+
+  // Statistics
+  std::atomic<uint64_t> m_cntReceive;
+  std::atomic<uint64_t> m_cntSend;
+  std::atomic<uint64_t> m_cntDrop;
+};
+
+#endif // VSCP_SHM_H__INCLUDED_
@@ -0,0 +1,212 @@
+// vscp-syslog.cpp
+//
+// Asynchronous bounded syslog writer.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <vscp.h>
+
+#include "vscp-syslog.h"
+
+// Max time the writer thread sleeps without checking for quit (ms)
+#define SYSLOG_WRITER_IDLE_WAIT 100
+
+// Everything is logged until the level is set
+std::atomic<int> vscpSyslog::m_level(VSCP_LOG_LEVEL_TRACE);
+
+///////////////////////////////////////////////////////////////////////////////
+// getInstance
+//
+// Never deleted so logging works from static destructors
+//
+
+vscpSyslog &
+vscpSyslog::getInstance(void)
+{
+  static vscpSyslog *psyslog = new vscpSyslog;
+  return *psyslog;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CTor
+//
+
+vscpSyslog::vscpSyslog(void)
+{
+  m_bRunning        = false;
+  m_bQuit           = false;
+  m_cntDropReported = 0;
+
+  m_cntWrite = 0;
+  m_cntDrop  = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DTor
+//
+
+vscpSyslog::~vscpSyslog(void)
+{
+  stop();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// start
+//
+
+int
+vscpSyslog::start(size_t queueSize)
+{
+  if (m_bRunning) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  // The queue is kept when the writer stops, a thread that saw the
+  // writer running may still be putting a message in it. It keeps the
+  // size it got the first time.
+  if (!m_queue.init(m_queue.isInit() ? m_queue.getSize() : queueSize, sizeof(message))) {
+    return VSCP_ERROR_ERROR;
+  }
+  m_cntDropReported = m_cntDrop;
+
+  m_bQuit = false;
+  if (pthread_create(&m_writerThread, NULL, writerThread, this)) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  m_bRunning = true;
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// stop
+//
+
+void
+vscpSyslog::stop(void)
+{
+  if (!m_bRunning) {
+    return;
+  }
+
+  m_bRunning = false;
+  m_bQuit    = true;
+  m_queue.wake();
+  pthread_join(m_writerThread, NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// write
+//
+
+bool
+vscpSyslog::write(int priority, const char *fmt, ...)
+{
+  va_list ap;
+
+  if (!m_bRunning) {
+    va_start(ap, fmt);
+    vsyslog(priority, fmt, ap);
+    va_end(ap);
+    m_cntWrite++;
+    return true;
+  }
+
+  size_t pos;
+  message *pmsg = (message *) m_queue.reserve(&pos);
+  if (NULL == pmsg) {
+    m_cntDrop++;
+    return false;
+  }
+
+  va_start(ap, fmt);
+  vsnprintf(pmsg->msg, sizeof(pmsg->msg), fmt, ap);
+  va_end(ap);
+  pmsg->priority = priority;
+  m_queue.commit(pos);
+
+  m_cntWrite++;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// drain
+//
+
+size_t
+vscpSyslog::drain(void)
+{
+  size_t cnt = 0;
+
+  message *pmsg;
+  while (NULL != (pmsg = (message *) m_queue.front())) {
+    syslog(pmsg->priority, "%s", pmsg->msg);
+    m_queue.pop();
+    cnt++;
+  }
+
+  uint64_t cntDrop = m_cntDrop.load();
+  if (cntDrop != m_cntDropReported) {
+    syslog(LOG_WARNING,
+           "vscp syslog: %llu messages dropped, queue full.",
+           (unsigned long long) (cntDrop - m_cntDropReported));
+    m_cntDropReported = cntDrop;
+  }
+
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// writerThread
+//
+
+void *
+vscpSyslog::writerThread(void *pData)
+{
+  vscpSyslog *pObj = (vscpSyslog *) pData;
+
+  for (;;) {
+
+    if (pObj->drain()) {
+      continue;
+    }
+
+    if (pObj->m_bQuit) {
+      pObj->drain();
+      break;
+    }
+
+    // Sleep until a producer wakes us up
+    pObj->m_queue.wait(SYSLOG_WRITER_IDLE_WAIT);
+  }
+
+  return NULL;
+}
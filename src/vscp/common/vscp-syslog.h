@@ -0,0 +1,169 @@
+// vscp-syslog.h
+//
+// Asynchronous bounded syslog writer.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(VSCP_SYSLOG_H__INCLUDED_)
+#define VSCP_SYSLOG_H__INCLUDED_
+
+#include <pthread.h>
+#include <stdint.h>
+#include <syslog.h>
+
+#include <atomic>
+
+#include <vscp-bounded-queue.h>
+#include <vscp-log.h>
+
+// Max length of a syslog message, longer messages are truncated
+#define VSCP_SYSLOG_MAX_MESSAGE 512
+
+// Default number of messages that can wait for the writer thread
+#define VSCP_SYSLOG_DEFAULT_QUEUE_SIZE 1024
+
+/*!
+  @class vscpSyslog
+  Asynchronous syslog writer.
+
+  Messages are formatted in the calling thread into a bounded multi
+  producer queue and a writer thread hands them to syslog. Nothing
+  blocks the caller. If the queue is full the message is dropped and
+  counted, and the writer reports the number of dropped messages the
+  next time it runs.
+
+  Until start() is called, and after stop(), messages go straight to
+  syslog so the macros can be used before the daemon is up and in
+  tools that never start the writer.
+*/
+
+class vscpSyslog {
+
+public:
+  // The writer
+  static vscpSyslog &getInstance(void);
+
+  /*!
+    Start the writer thread
+    @param queueSize Number of messages that can wait for the writer
+            thread. Rounded up to a power of two.
+    @return VSCP_ERROR_SUCCESS on success, error code on failure.
+  */
+  int start(size_t queueSize = VSCP_SYSLOG_DEFAULT_QUEUE_SIZE);
+
+  /*!
+    Write what is queued and stop the writer thread. Messages from
+    threads that log while the writer stops may be lost.
+  */
+  void stop(void);
+
+  /*!
+    Log a message
+    @param priority Syslog priority (LOG_ERR, LOG_DEBUG, ...)
+    @param fmt printf style format string
+    @return true if the message was logged or queued, false if it
+            was dropped.
+  */
+  bool write(int priority, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+  // Runtime level, messages below it are skipped before formatting
+  static void setLevel(int level) { m_level.store(level, std::memory_order_relaxed); };
+  static int getLevel(void) { return m_level.load(std::memory_order_relaxed); };
+
+  // True if a message on this level should be logged
+  static bool shouldLog(int level) { return (level >= m_level.load(std::memory_order_relaxed)); };
+
+  // Log level for a syslog priority
+  static constexpr int getLevelFromPriority(int priority)
+  {
+    return (LOG_PRI(priority) >= LOG_DEBUG)     ? VSCP_LOG_LEVEL_DEBUG
+           : (LOG_PRI(priority) >= LOG_NOTICE)  ? VSCP_LOG_LEVEL_INFO
+           : (LOG_PRI(priority) >= LOG_WARNING) ? VSCP_LOG_LEVEL_WARN
+           : (LOG_PRI(priority) >= LOG_ERR)     ? VSCP_LOG_LEVEL_ERROR
+                                                : VSCP_LOG_LEVEL_CRITICAL;
+  };
+
+  bool isRunning(void) const { return m_bRunning; };
+
+  // Statistics
+  uint64_t getWriteCount(void) const { return m_cntWrite.load(); };
+  uint64_t getDropCount(void) const { return m_cntDrop.load(); };
+
+private:
+  vscpSyslog(void);
+  ~vscpSyslog(void);
+
+  // Writer thread
+  static void *writerThread(void *pData);
+
+  // Hand queued messages to syslog, returns number written
+  size_t drain(void);
+
+private:
+  struct message {
+    int priority;
+    char msg[VSCP_SYSLOG_MAX_MESSAGE];
+  };
+
+  static std::atomic<int> m_level;
+
+  std::atomic<bool> m_bRunning;
+  std::atomic<bool> m_bQuit;
+
+  // Messages waiting for the writer thread
+  vscpBoundedQueue m_queue;
+
+  pthread_t m_writerThread;
+
+  // Drops already reported by the writer thread
+  uint64_t m_cntDropReported;
+
+  // Statistics
+  std::atomic<uint64_t> m_cntWrite;
+  std::atomic<uint64_t> m_cntDrop;
+};
+
+/*
+  Log macro. Arguments are only evaluated if the message is logged.
+
+    VSCP_SYSLOG(priority, fmt, ...)   printf style format
+
+  A priority below VSCP_LOG_ACTIVE_LEVEL costs nothing. One that is
+  compiled in but below the runtime level costs one check.
+*/
+
+// The priority is a constant at nearly all call sites so the compile
+// time test is folded away
+#define VSCP_SYSLOG(priority, ...)                                                                                     \
+  do {                                                                                                                 \
+    if ((vscpSyslog::getLevelFromPriority(priority) >= VSCP_LOG_ACTIVE_LEVEL) &&                                       \
+        vscpSyslog::shouldLog(vscpSyslog::getLevelFromPriority(priority))) {                                           \
+      vscpSyslog::getInstance().write(priority, __VA_ARGS__);                                                          \
+    }                                                                                                                  \
+  } while (0)
+
+#endif // VSCP_SYSLOG_H__INCLUDED_
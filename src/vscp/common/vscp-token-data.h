@@ -0,0 +1,2330 @@
+/*
+            !!!!!!!!!!!!!!!!!!!!  W A R N I N G  !!!!!!!!!!!!!!!!!!!!
+                           This file is auto-generated
+                   by tools/gen-token-table.py from vscp_events.sqlite3
+*/
+
+#ifndef VSCP_TOKEN_DATA_H
+#define VSCP_TOKEN_DATA_H
+
+// Sorted on vscp_class
+static constexpr vscp_class_token_entry vscp_class_tokens[] = {
+  { 0, "CLASS1.PROTOCOL" },
+  { 1, "CLASS1.ALARM" },
+  { 2, "CLASS1.SECURITY" },
+  { 10, "CLASS1.MEASUREMENT" },
+  { 11, "CLASS1.MEASUREMENTX1" },
+  { 12, "CLASS1.MEASUREMENTX2" },
+  { 13, "CLASS1.MEASUREMENTX3" },
+  { 14, "CLASS1.MEASUREMENTX4" },
+  { 15, "CLASS1.DATA" },
+  { 20, "CLASS1.INFORMATION" },
+  { 30, "CLASS1.CONTROL" },
+  { 40, "CLASS1.MULTIMEDIA" },
+  { 50, "CLASS1.AOL" },
+  { 60, "CLASS1.MEASUREMENT64" },
+  { 61, "CLASS1.MEASUREMENT64X1" },
+  { 62, "CLASS1.MEASUREMENT64X2" },
+  { 63, "CLASS1.MEASUREMENT64X3" },
+  { 64, "CLASS1.MEASUREMENT64X4" },
+  { 65, "CLASS1.MEASUREZONE" },
+  { 66, "CLASS1.MEASUREZONEX1" },
+  { 67, "CLASS1.MEASUREZONEX2" },
+  { 68, "CLASS1.MEASUREZONEX3" },
+  { 69, "CLASS1.MEASUREZONEX4" },
+  { 70, "CLASS1.MEASUREMENT32" },
+  { 71, "CLASS1.MEASUREMENT32X1" },
+  { 72, "CLASS1.MEASUREMENT32X2" },
+  { 73, "CLASS1.MEASUREMENT32X3" },
+  { 74, "CLASS1.MEASUREMENT32X4" },
+  { 85, "CLASS1.SETVALUEZONE" },
+  { 86, "CLASS1.SETVALUEZONEX1" },
+  { 87, "CLASS1.SETVALUEZONEX2" },
+  { 88, "CLASS1.SETVALUEZONEX3" },
+  { 89, "CLASS1.SETVALUEZONEX4" },
+  { 90, "CLASS1.WEATHER" },
+  { 95, "CLASS1.WEATHER_FORECAST" },
+  { 100, "CLASS1.PHONE" },
+  { 102, "CLASS1.DISPLAY" },
+  { 110, "CLASS1.IR" },
+  { 120, "CLASS1.CONFIGURATION" },
+  { 206, "CLASS1.GNSS" },
+  { 212, "CLASS1.WIRELESS" },
+  { 506, "CLASS1.DIAGNOSTIC" },
+  { 508, "CLASS1.ERROR" },
+  { 509, "CLASS1.LOG" },
+  { 510, "CLASS1.LABORATORY" },
+  { 511, "CLASS1.LOCAL" },
+  { 512, "CLASS2.LEVEL1.PROTOCOL" },
+  { 513, "CLASS2.LEVEL1.ALARM" },
+  { 514, "CLASS2.LEVEL1.SECURITY" },
+  { 522, "CLASS2.LEVEL1.MEASUREMENT" },
+  { 523, "CLASS2.LEVEL1.MEASUREMENTX1" },
+  { 524, "CLASS2.LEVEL1.MEASUREMENTX2" },
+  { 525, "CLASS2.LEVEL1.MEASUREMENTX3" },
+  { 526, "CLASS2.LEVEL1.MEASUREMENTX4" },
+  { 527, "CLASS2.LEVEL1.DATA" },
+  { 532, "CLASS2.LEVEL1.INFORMATION1" },
+  { 542, "CLASS2.LEVEL1.CONTROL" },
+  { 552, "CLASS2.LEVEL1.MULTIMEDIA" },
+  { 562, "CLASS2.LEVEL1.AOL" },
+  { 572, "CLASS2.LEVEL1.MEASUREMENT64" },
+  { 573, "CLASS2.LEVEL1.MEASUREMENT64X1" },
+  { 574, "CLASS2.LEVEL1.MEASUREMENT64X2" },
+  { 575, "CLASS2.LEVEL1.MEASUREMENT64X3" },
+  { 576, "CLASS2.LEVEL1.MEASUREMENT64X4" },
+  { 577, "CLASS2.LEVEL1.MEASUREZONE" },
+  { 578, "CLASS2.LEVEL1.MEASUREZONEX1" },
+  { 579, "CLASS2.LEVEL1.MEASUREZONEX2" },
+  { 580, "CLASS2.LEVEL1.MEASUREZONEX3" },
+  { 581, "CLASS2.LEVEL1.MEASUREZONEX4" },
+  { 582, "CLASS2.LEVEL1.MEASUREMENT32" },
+  { 583, "CLASS2.LEVEL1.MEASUREMENT32X1" },
+  { 584, "CLASS2.LEVEL1.MEASUREMENT32X2" },
+  { 585, "CLASS2.LEVEL1.MEASUREMENT32X3" },
+  { 586, "CLASS2.LEVEL1.MEASUREMENT32X4" },
+  { 597, "CLASS2.LEVEL1.SETVALUEZONE" },
+  { 598, "CLASS2.LEVEL1.SETVALUEZONEX1" },
+  { 599, "CLASS2.LEVEL1.SETVALUEZONEX2" },
+  { 600, "CLASS2.LEVEL1.SETVALUEZONEX3" },
+  { 601, "CLASS2.LEVEL1.SETVALUEZONEX4" },
+  { 602, "CLASS2.LEVEL1.WEATHER" },
+  { 607, "CLASS2.LEVEL1.WEATHERFORECAST" },
+  { 612, "CLASS2.LEVEL1.PHONE" },
+  { 614, "CLASS2.LEVEL1.DISPLAY" },
+  { 622, "CLASS2.LEVEL1.IR" },
+  { 718, "CLASS2.LEVEL1.GNSS" },
+  { 724, "CLASS2.LEVEL1.WIRELESS" },
+  { 1018, "CLASS2.LEVEL1.DIAGNOSTIC" },
+  { 1020, "CLASS2.LEVEL1.ERROR" },
+  { 1021, "CLASS2.LEVEL1.LOG" },
+  { 1022, "CLASS2.LEVEL1.LABORATORY" },
+  { 1023, "CLASS2.LEVEL1.LOCAL" },
+  { 1024, "CLASS2.PROTOCOL" },
+  { 1025, "CLASS2.CONTROL" },
+  { 1026, "CLASS2.INFORMATION" },
+  { 1027, "CLASS2.TEXT2SPEECH" },
+  { 1028, "CLASS2.HLO" },
+  { 1029, "CLASS2.CUSTOM" },
+  { 1030, "CLASS2.DISPLAY" },
+  { 1034, "CLASS2.SECURITY" },
+  { 1040, "CLASS2.MEASUREMENT_STR" },
+  { 1060, "CLASS2.MEASUREMENT_FLOAT" },
+  { 65535, "CLASS2.VSCPD" },
+};
+
+// Index into vscp_class_tokens sorted on token
+static constexpr uint16_t vscp_class_token_index[] = {
+  1, 12, 38, 10, 8, 41, 36, 42, 39, 9, 37, 44,
+  45, 43, 3, 23, 24, 25, 26, 27, 13, 14, 15, 16,
+  17, 4, 5, 6, 7, 18, 19, 20, 21, 22, 11, 35,
+  0, 2, 28, 29, 30, 31, 32, 33, 34, 40, 92, 96,
+  97, 95, 93, 47, 58, 56, 54, 86, 82, 87, 84, 55,
+  83, 89, 90, 88, 49, 69, 70, 71, 72, 73, 59, 60,
+  61, 62, 63, 50, 51, 52, 53, 64, 65, 66, 67, 68,
+  57, 81, 46, 48, 74, 75, 76, 77, 78, 79, 80, 85,
+  100, 99, 91, 98, 94, 101,
+};
+
+// Sorted on (vscp_class << 16) | vscp_type
+static constexpr vscp_type_token_entry vscp_type_tokens[] = {
+  { 0x00000000, "VSCP_TYPE_PROTOCOL_GENERAL" },
+  { 0x00000001, "VSCP_TYPE_PROTOCOL_SEGCTRL_HEARTBEAT" },
+  { 0x00000002, "VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE" },
+  { 0x00000003, "VSCP_TYPE_PROTOCOL_PROBE_ACK" },
+  { 0x00000004, "VSCP_TYPE_PROTOCOL_RESERVED4" },
+  { 0x00000005, "VSCP_TYPE_PROTOCOL_RESERVED5" },
+  { 0x00000006, "VSCP_TYPE_PROTOCOL_SET_NICKNAME" },
+  { 0x00000007, "VSCP_TYPE_PROTOCOL_NICKNAME_ACCEPTED" },
+  { 0x00000008, "VSCP_TYPE_PROTOCOL_DROP_NICKNAME" },
+  { 0x00000009, "VSCP_TYPE_PROTOCOL_READ_REGISTER" },
+  { 0x0000000A, "VSCP_TYPE_PROTOCOL_RW_RESPONSE" },
+  { 0x0000000B, "VSCP_TYPE_PROTOCOL_WRITE_REGISTER" },
+  { 0x0000000C, "VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER" },
+  { 0x0000000D, "VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER" },
+  { 0x0000000E, "VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER" },
+  { 0x0000000F, "VSCP_TYPE_PROTOCOL_START_BLOCK" },
+  { 0x00000010, "VSCP_TYPE_PROTOCOL_BLOCK_DATA" },
+  { 0x00000011, "VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK" },
+  { 0x00000012, "VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK" },
+  { 0x00000013, "VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA" },
+  { 0x00000014, "VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK" },
+  { 0x00000015, "VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK" },
+  { 0x00000016, "VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE" },
+  { 0x00000017, "VSCP_TYPE_PROTOCOL_RESET_DEVICE" },
+  { 0x00000018, "VSCP_TYPE_PROTOCOL_PAGE_READ" },
+  { 0x00000019, "VSCP_TYPE_PROTOCOL_PAGE_WRITE" },
+  { 0x0000001A, "VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE" },
+  { 0x0000001B, "VSCP_TYPE_PROTOCOL_HIGH_END_SERVER_PROBE" },
+  { 0x0000001C, "VSCP_TYPE_PROTOCOL_HIGH_END_SERVER_RESPONSE" },
+  { 0x0000001D, "VSCP_TYPE_PROTOCOL_INCREMENT_REGISTER" },
+  { 0x0000001E, "VSCP_TYPE_PROTOCOL_DECREMENT_REGISTER" },
+  { 0x0000001F, "VSCP_TYPE_PROTOCOL_WHO_IS_THERE" },
+  { 0x00000020, "VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE" },
+  { 0x00000021, "VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO" },
+  { 0x00000022, "VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO_RESPONSE" },
+  { 0x00000023, "VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF" },
+  { 0x00000024, "VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE" },
+  { 0x00000025, "VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ" },
+  { 0x00000026, "VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_WRITE" },
+  { 0x00000027, "VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE" },
+  { 0x00000028, "VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST" },
+  { 0x00000029, "VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE" },
+  { 0x00000030, "VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_ACK" },
+  { 0x00000031, "VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_NACK" },
+  { 0x00000032, "VSCP_TYPE_PROTOCOL_START_BLOCK_ACK" },
+  { 0x00000033, "VSCP_TYPE_PROTOCOL_START_BLOCK_NACK" },
+  { 0x00010000, "VSCP_TYPE_ALARM_GENERAL" },
+  { 0x00010001, "VSCP_TYPE_ALARM_WARNING" },
+  { 0x00010002, "VSCP_TYPE_ALARM_ALARM" },
+  { 0x00010003, "VSCP_TYPE_ALARM_SOUND" },
+  { 0x00010004, "VSCP_TYPE_ALARM_LIGHT" },
+  { 0x00010005, "VSCP_TYPE_ALARM_POWER" },
+  { 0x00010006, "VSCP_TYPE_ALARM_EMERGENCY_STOP" },
+  { 0x00010007, "VSCP_TYPE_ALARM_EMERGENCY_PAUSE" },
+  { 0x00010008, "VSCP_TYPE_ALARM_EMERGENCY_RESET" },
+  { 0x00010009, "VSCP_TYPE_ALARM_EMERGENCY_RESUME" },
+  { 0x0001000A, "VSCP_TYPE_ALARM_ARM" },
+  { 0x0001000B, "VSCP_TYPE_ALARM_DISARM" },
+  { 0x0001000C, "VSCP_TYPE_ALARM_WATCHDOG" },
+  { 0x0001000D, "VSCP_TYPE_ALARM_RESET" },
+  { 0x00020000, "VSCP_TYPE_SECURITY_GENERAL" },
+  { 0x00020001, "VSCP_TYPE_SECURITY_MOTION" },
+  { 0x00020002, "VSCP_TYPE_SECURITY_GLASS_BREAK" },
+  { 0x00020003, "VSCP_TYPE_SECURITY_BEAM_BREAK" },
+  { 0x00020004, "VSCP_TYPE_SECURITY_SENSOR_TAMPER" },
+  { 0x00020005, "VSCP_TYPE_SECURITY_SHOCK_SENSOR" },
+  { 0x00020006, "VSCP_TYPE_SECURITY_SMOKE_SENSOR" },
+  { 0x00020007, "VSCP_TYPE_SECURITY_HEAT_SENSOR" },
+  { 0x00020008, "VSCP_TYPE_SECURITY_PANIC_SWITCH" },
+  { 0x00020009, "VSCP_TYPE_SECURITY_DOOR_OPEN" },
+  { 0x0002000A, "VSCP_TYPE_SECURITY_WINDOW_OPEN" },
+  { 0x0002000B, "VSCP_TYPE_SECURITY_CO_SENSOR" },
+  { 0x0002000C, "VSCP_TYPE_SECURITY_FROST_DETECTED" },
+  { 0x0002000D, "VSCP_TYPE_SECURITY_FLAME_DETECTED" },
+  { 0x0002000E, "VSCP_TYPE_SECURITY_OXYGEN_LOW" },
+  { 0x0002000F, "VSCP_TYPE_SECURITY_WEIGHT_DETECTED" },
+  { 0x00020010, "VSCP_TYPE_SECURITY_WATER_DETECTED" },
+  { 0x00020011, "VSCP_TYPE_SECURITY_CONDENSATION_DETECTED" },
+  { 0x00020012, "VSCP_TYPE_SECURITY_SOUND_DETECTED" },
+  { 0x00020013, "VSCP_TYPE_SECURITY_HARMFUL_SOUND_LEVEL" },
+  { 0x00020014, "VSCP_TYPE_SECURITY_TAMPER" },
+  { 0x00020015, "VSCP_TYPE_SECURITY_AUTHENTICATED" },
+  { 0x00020016, "VSCP_TYPE_SECURITY_UNAUTHENTICATED" },
+  { 0x00020017, "VSCP_TYPE_SECURITY_AUTHORIZED" },
+  { 0x00020018, "VSCP_TYPE_SECURITY_UNAUTHORIZED" },
+  { 0x00020019, "VSCP_TYPE_SECURITY_ID_CHECK" },
+  { 0x0002001A, "VSCP_TYPE_SECURITY_PIN_OK" },
+  { 0x0002001B, "VSCP_TYPE_SECURITY_PIN_FAIL" },
+  { 0x0002001C, "VSCP_TYPE_SECURITY_PIN_WARNING" },
+  { 0x0002001D, "VSCP_TYPE_SECURITY_PIN_ERROR" },
+  { 0x0002001E, "VSCP_TYPE_SECURITY_PASSWORD_OK" },
+  { 0x0002001F, "VSCP_TYPE_SECURITY_PASSWORD_FAIL" },
+  { 0x00020020, "VSCP_TYPE_SECURITY_PASSWORD_WARNING" },
+  { 0x00020021, "VSCP_TYPE_SECURITY_PASSWORD_ERROR" },
+  { 0x00020022, "VSCP_TYPE_SECURITY_GAS_SENSOR" },
+  { 0x00020023, "VSCP_TYPE_SECURITY_IN_MOTION_DETECTED" },
+  { 0x00020024, "VSCP_TYPE_SECURITY_NOT_IN_MOTION_DETECTED" },
+  { 0x00020025, "VSCP_TYPE_SECURITY_VIBRATION_DETECTED" },
+  { 0x000A0000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x000A0001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x000A0002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x000A0003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x000A0004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x000A0005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x000A0006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x000A0007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x000A0008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x000A0009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x000A000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x000A000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x000A000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x000A000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x000A000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x000A000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x000A0010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x000A0011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x000A0012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x000A0013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x000A0014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x000A0015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x000A0016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x000A0017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x000A0018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x000A0019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x000A001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x000A001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x000A001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x000A001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x000A001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x000A001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x000A0020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x000A0021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x000A0022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x000A0023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x000A0024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x000A0025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x000A0026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x000A0027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x000A0028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x000A0029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x000A002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x000A002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x000A002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x000A002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x000A002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x000A002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x000A0030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x000A0031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x000A0032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x000A0033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x000A0034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x000A0035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x000A0036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x000A0037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x000A0038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x000A0039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x000A003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x000A003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x000A003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x000A003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x000A003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x000A003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x000A0040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x000A0041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x000B0000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x000C0000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x000D0000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x000E0000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x000F0000, "VSCP_TYPE_DATA_GENERAL" },
+  { 0x000F0001, "VSCP_TYPE_DATA_IO" },
+  { 0x000F0002, "VSCP_TYPE_DATA_AD" },
+  { 0x000F0003, "VSCP_TYPE_DATA_DA" },
+  { 0x000F0004, "VSCP_TYPE_DATA_RELATIVE_STRENGTH" },
+  { 0x000F0005, "VSCP_TYPE_DATA_SIGNAL_LEVEL" },
+  { 0x000F0006, "VSCP_TYPE_DATA_SIGNAL_QUALITY" },
+  { 0x00140000, "VSCP_TYPE_INFORMATION_GENERAL" },
+  { 0x00140001, "VSCP_TYPE_INFORMATION_BUTTON" },
+  { 0x00140002, "VSCP_TYPE_INFORMATION_MOUSE" },
+  { 0x00140003, "VSCP_TYPE_INFORMATION_ON" },
+  { 0x00140004, "VSCP_TYPE_INFORMATION_OFF" },
+  { 0x00140005, "VSCP_TYPE_INFORMATION_ALIVE" },
+  { 0x00140006, "VSCP_TYPE_INFORMATION_TERMINATING" },
+  { 0x00140007, "VSCP_TYPE_INFORMATION_OPENED" },
+  { 0x00140008, "VSCP_TYPE_INFORMATION_CLOSED" },
+  { 0x00140009, "VSCP_TYPE_INFORMATION_NODE_HEARTBEAT" },
+  { 0x0014000A, "VSCP_TYPE_INFORMATION_BELOW_LIMIT" },
+  { 0x0014000B, "VSCP_TYPE_INFORMATION_ABOVE_LIMIT" },
+  { 0x0014000C, "VSCP_TYPE_INFORMATION_PULSE" },
+  { 0x0014000D, "VSCP_TYPE_INFORMATION_ERROR" },
+  { 0x0014000E, "VSCP_TYPE_INFORMATION_RESUMED" },
+  { 0x0014000F, "VSCP_TYPE_INFORMATION_PAUSED" },
+  { 0x00140010, "VSCP_TYPE_INFORMATION_SLEEP" },
+  { 0x00140011, "VSCP_TYPE_INFORMATION_GOOD_MORNING" },
+  { 0x00140012, "VSCP_TYPE_INFORMATION_GOOD_DAY" },
+  { 0x00140013, "VSCP_TYPE_INFORMATION_GOOD_AFTERNOON" },
+  { 0x00140014, "VSCP_TYPE_INFORMATION_GOOD_EVENING" },
+  { 0x00140015, "VSCP_TYPE_INFORMATION_GOOD_NIGHT" },
+  { 0x00140016, "VSCP_TYPE_INFORMATION_SEE_YOU_SOON" },
+  { 0x00140017, "VSCP_TYPE_INFORMATION_GOODBYE" },
+  { 0x00140018, "VSCP_TYPE_INFORMATION_STOP" },
+  { 0x00140019, "VSCP_TYPE_INFORMATION_START" },
+  { 0x0014001A, "VSCP_TYPE_INFORMATION_RESET_COMPLETED" },
+  { 0x0014001B, "VSCP_TYPE_INFORMATION_INTERRUPTED" },
+  { 0x0014001C, "VSCP_TYPE_INFORMATION_PREPARING_TO_SLEEP" },
+  { 0x0014001D, "VSCP_TYPE_INFORMATION_WOKEN_UP" },
+  { 0x0014001E, "VSCP_TYPE_INFORMATION_DUSK" },
+  { 0x0014001F, "VSCP_TYPE_INFORMATION_DAWN" },
+  { 0x00140020, "VSCP_TYPE_INFORMATION_ACTIVE" },
+  { 0x00140021, "VSCP_TYPE_INFORMATION_INACTIVE" },
+  { 0x00140022, "VSCP_TYPE_INFORMATION_BUSY" },
+  { 0x00140023, "VSCP_TYPE_INFORMATION_IDLE" },
+  { 0x00140024, "VSCP_TYPE_INFORMATION_STREAM_DATA" },
+  { 0x00140025, "VSCP_TYPE_INFORMATION_TOKEN_ACTIVITY" },
+  { 0x00140026, "VSCP_TYPE_INFORMATION_STREAM_DATA_WITH_ZONE" },
+  { 0x00140027, "VSCP_TYPE_INFORMATION_CONFIRM" },
+  { 0x00140028, "VSCP_TYPE_INFORMATION_LEVEL_CHANGED" },
+  { 0x00140029, "VSCP_TYPE_INFORMATION_WARNING" },
+  { 0x0014002A, "VSCP_TYPE_INFORMATION_STATE" },
+  { 0x0014002B, "VSCP_TYPE_INFORMATION_ACTION_TRIGGER" },
+  { 0x0014002C, "VSCP_TYPE_INFORMATION_SUNRISE" },
+  { 0x0014002D, "VSCP_TYPE_INFORMATION_SUNSET" },
+  { 0x0014002E, "VSCP_TYPE_INFORMATION_START_OF_RECORD" },
+  { 0x0014002F, "VSCP_TYPE_INFORMATION_END_OF_RECORD" },
+  { 0x00140030, "VSCP_TYPE_INFORMATION_PRESET_ACTIVE" },
+  { 0x00140031, "VSCP_TYPE_INFORMATION_DETECT" },
+  { 0x00140032, "VSCP_TYPE_INFORMATION_OVERFLOW" },
+  { 0x00140033, "VSCP_TYPE_INFORMATION_BIG_LEVEL_CHANGED" },
+  { 0x00140034, "VSCP_TYPE_INFORMATION_SUNRISE_TWILIGHT_START" },
+  { 0x00140035, "VSCP_TYPE_INFORMATION_SUNSET_TWILIGHT_START" },
+  { 0x00140036, "VSCP_TYPE_INFORMATION_NAUTICAL_SUNRISE_TWILIGHT_START" },
+  { 0x00140037, "VSCP_TYPE_INFORMATION_NAUTICAL_SUNSET_TWILIGHT_START" },
+  { 0x00140038, "VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNRISE_TWILIGHT_START" },
+  { 0x00140039, "VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNSET_TWILIGHT_START" },
+  { 0x0014003A, "VSCP_TYPE_INFORMATION_CALCULATED_NOON" },
+  { 0x0014003B, "VSCP_TYPE_INFORMATION_SHUTTER_UP" },
+  { 0x0014003C, "VSCP_TYPE_INFORMATION_SHUTTER_DOWN" },
+  { 0x0014003D, "VSCP_TYPE_INFORMATION_SHUTTER_LEFT" },
+  { 0x0014003E, "VSCP_TYPE_INFORMATION_SHUTTER_RIGHT" },
+  { 0x0014003F, "VSCP_TYPE_INFORMATION_SHUTTER_END_TOP" },
+  { 0x00140040, "VSCP_TYPE_INFORMATION_SHUTTER_END_BOTTOM" },
+  { 0x00140041, "VSCP_TYPE_INFORMATION_SHUTTER_END_MIDDLE" },
+  { 0x00140042, "VSCP_TYPE_INFORMATION_SHUTTER_END_PRESET" },
+  { 0x00140043, "VSCP_TYPE_INFORMATION_SHUTTER_END_LEFT" },
+  { 0x00140044, "VSCP_TYPE_INFORMATION_SHUTTER_END_RIGHT" },
+  { 0x00140045, "VSCP_TYPE_INFORMATION_LONG_CLICK" },
+  { 0x00140046, "VSCP_TYPE_INFORMATION_SINGLE_CLICK" },
+  { 0x00140047, "VSCP_TYPE_INFORMATION_DOUBLE_CLICK" },
+  { 0x00140048, "VSCP_TYPE_INFORMATION_DATE" },
+  { 0x00140049, "VSCP_TYPE_INFORMATION_TIME" },
+  { 0x0014004A, "VSCP_TYPE_INFORMATION_WEEKDAY" },
+  { 0x0014004B, "VSCP_TYPE_INFORMATION_LOCK" },
+  { 0x0014004C, "VSCP_TYPE_INFORMATION_UNLOCK" },
+  { 0x0014004D, "VSCP_TYPE_INFORMATION_DATETIME" },
+  { 0x0014004E, "VSCP_TYPE_INFORMATION_RISING" },
+  { 0x0014004F, "VSCP_TYPE_INFORMATION_FALLING" },
+  { 0x00140050, "VSCP_TYPE_INFORMATION_UPDATED" },
+  { 0x00140051, "VSCP_TYPE_INFORMATION_CONNECT" },
+  { 0x00140052, "VSCP_TYPE_INFORMATION_DISCONNECT" },
+  { 0x00140053, "VSCP_TYPE_INFORMATION_RECONNECT" },
+  { 0x00140054, "VSCP_TYPE_INFORMATION_ENTER" },
+  { 0x00140055, "VSCP_TYPE_INFORMATION_EXIT" },
+  { 0x00140056, "VSCP_TYPE_INFORMATION_INCREMENTED" },
+  { 0x00140057, "VSCP_TYPE_INFORMATION_DECREMENTED" },
+  { 0x00140058, "VSCP_TYPE_INFORMATION_PROXIMITY_DETECTED" },
+  { 0x001E0000, "VSCP_TYPE_CONTROL_GENERAL" },
+  { 0x001E0001, "VSCP_TYPE_CONTROL_MUTE" },
+  { 0x001E0002, "VSCP_TYPE_CONTROL_ALL_LAMPS" },
+  { 0x001E0003, "VSCP_TYPE_CONTROL_OPEN" },
+  { 0x001E0004, "VSCP_TYPE_CONTROL_CLOSE" },
+  { 0x001E0005, "VSCP_TYPE_CONTROL_TURNON" },
+  { 0x001E0006, "VSCP_TYPE_CONTROL_TURNOFF" },
+  { 0x001E0007, "VSCP_TYPE_CONTROL_START" },
+  { 0x001E0008, "VSCP_TYPE_CONTROL_STOP" },
+  { 0x001E0009, "VSCP_TYPE_CONTROL_RESET" },
+  { 0x001E000A, "VSCP_TYPE_CONTROL_INTERRUPT" },
+  { 0x001E000B, "VSCP_TYPE_CONTROL_SLEEP" },
+  { 0x001E000C, "VSCP_TYPE_CONTROL_WAKEUP" },
+  { 0x001E000D, "VSCP_TYPE_CONTROL_RESUME" },
+  { 0x001E000E, "VSCP_TYPE_CONTROL_PAUSE" },
+  { 0x001E000F, "VSCP_TYPE_CONTROL_ACTIVATE" },
+  { 0x001E0010, "VSCP_TYPE_CONTROL_DEACTIVATE" },
+  { 0x001E0011, "VSCP_TYPE_CONTROL_RESERVED17" },
+  { 0x001E0012, "VSCP_TYPE_CONTROL_RESERVED18" },
+  { 0x001E0013, "VSCP_TYPE_CONTROL_RESERVED19" },
+  { 0x001E0014, "VSCP_TYPE_CONTROL_DIM_LAMPS" },
+  { 0x001E0015, "VSCP_TYPE_CONTROL_CHANGE_CHANNEL" },
+  { 0x001E0016, "VSCP_TYPE_CONTROL_CHANGE_LEVEL" },
+  { 0x001E0017, "VSCP_TYPE_CONTROL_RELATIVE_CHANGE_LEVEL" },
+  { 0x001E0018, "VSCP_TYPE_CONTROL_MEASUREMENT_REQUEST" },
+  { 0x001E0019, "VSCP_TYPE_CONTROL_STREAM_DATA" },
+  { 0x001E001A, "VSCP_TYPE_CONTROL_SYNC" },
+  { 0x001E001B, "VSCP_TYPE_CONTROL_ZONED_STREAM_DATA" },
+  { 0x001E001C, "VSCP_TYPE_CONTROL_SET_PRESET" },
+  { 0x001E001D, "VSCP_TYPE_CONTROL_TOGGLE_STATE" },
+  { 0x001E001E, "VSCP_TYPE_CONTROL_TIMED_PULSE_ON" },
+  { 0x001E001F, "VSCP_TYPE_CONTROL_TIMED_PULSE_OFF" },
+  { 0x001E0020, "VSCP_TYPE_CONTROL_SET_COUNTRY_LANGUAGE" },
+  { 0x001E0021, "VSCP_TYPE_CONTROL_BIG_CHANGE_LEVEL" },
+  { 0x001E0022, "VSCP_TYPE_CONTROL_SHUTTER_UP" },
+  { 0x001E0023, "VSCP_TYPE_CONTROL_SHUTTER_DOWN" },
+  { 0x001E0024, "VSCP_TYPE_CONTROL_SHUTTER_LEFT" },
+  { 0x001E0025, "VSCP_TYPE_CONTROL_SHUTTER_RIGHT" },
+  { 0x001E0026, "VSCP_TYPE_CONTROL_SHUTTER_MIDDLE" },
+  { 0x001E0027, "VSCP_TYPE_CONTROL_SHUTTER_PRESET" },
+  { 0x001E0028, "VSCP_TYPE_CONTROL_ALL_LAMPS_ON" },
+  { 0x001E0029, "VSCP_TYPE_CONTROL_ALL_LAMPS_OFF" },
+  { 0x001E002A, "VSCP_TYPE_CONTROL_LOCK" },
+  { 0x001E002B, "VSCP_TYPE_CONTROL_UNLOCK" },
+  { 0x001E002C, "VSCP_TYPE_CONTROL_PWM" },
+  { 0x001E002D, "VSCP_TYPE_CONTROL_TOKEN_LOCK" },
+  { 0x001E002E, "VSCP_TYPE_CONTROL_TOKEN_UNLOCK" },
+  { 0x001E002F, "VSCP_TYPE_CONTROL_SET_SECURITY_LEVEL" },
+  { 0x001E0030, "VSCP_TYPE_CONTROL_SET_SECURITY_PIN" },
+  { 0x001E0031, "VSCP_TYPE_CONTROL_SET_SECURITY_PASSWORD" },
+  { 0x001E0032, "VSCP_TYPE_CONTROL_SET_SECURITY_TOKEN" },
+  { 0x001E0033, "VSCP_TYPE_CONTROL_REQUEST_SECURITY_TOKEN" },
+  { 0x001E0034, "VSCP_TYPE_CONTROL_INCREMENT" },
+  { 0x001E0035, "VSCP_TYPE_CONTROL_DECREMENT" },
+  { 0x00280000, "VSCP_TYPE_MULTIMEDIA_GENERAL" },
+  { 0x00280001, "VSCP_TYPE_MULTIMEDIA_PLAYBACK" },
+  { 0x00280002, "VSCP_TYPE_MULTIMEDIA_NAVIGATOR_KEY_ENG" },
+  { 0x00280003, "VSCP_TYPE_MULTIMEDIA_ADJUST_CONTRAST" },
+  { 0x00280004, "VSCP_TYPE_MULTIMEDIA_ADJUST_FOCUS" },
+  { 0x00280005, "VSCP_TYPE_MULTIMEDIA_ADJUST_TINT" },
+  { 0x00280006, "VSCP_TYPE_MULTIMEDIA_ADJUST_COLOUR_BALANCE" },
+  { 0x00280007, "VSCP_TYPE_MULTIMEDIA_ADJUST_BRIGHTNESS" },
+  { 0x00280008, "VSCP_TYPE_MULTIMEDIA_ADJUST_HUE" },
+  { 0x00280009, "VSCP_TYPE_MULTIMEDIA_ADJUST_BASS" },
+  { 0x0028000A, "VSCP_TYPE_MULTIMEDIA_ADJUST_TREBLE" },
+  { 0x0028000B, "VSCP_TYPE_MULTIMEDIA_ADJUST_MASTER_VOLUME" },
+  { 0x0028000C, "VSCP_TYPE_MULTIMEDIA_ADJUST_FRONT_VOLUME" },
+  { 0x0028000D, "VSCP_TYPE_MULTIMEDIA_ADJUST_CENTRE_VOLUME" },
+  { 0x0028000E, "VSCP_TYPE_MULTIMEDIA_ADJUST_REAR_VOLUME" },
+  { 0x0028000F, "VSCP_TYPE_MULTIMEDIA_ADJUST_SIDE_VOLUME" },
+  { 0x00280010, "VSCP_TYPE_MULTIMEDIA_RESERVED16" },
+  { 0x00280011, "VSCP_TYPE_MULTIMEDIA_RESERVED17" },
+  { 0x00280012, "VSCP_TYPE_MULTIMEDIA_RESERVED18" },
+  { 0x00280013, "VSCP_TYPE_MULTIMEDIA_RESERVED19" },
+  { 0x00280014, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_DISK" },
+  { 0x00280015, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_TRACK" },
+  { 0x00280016, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_ALBUM" },
+  { 0x00280017, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_CHANNEL" },
+  { 0x00280018, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_PAGE" },
+  { 0x00280019, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_CHAPTER" },
+  { 0x0028001A, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_SCREEN_FORMAT" },
+  { 0x0028001B, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_INPUT_SOURCE" },
+  { 0x0028001C, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_OUTPUT" },
+  { 0x0028001D, "VSCP_TYPE_MULTIMEDIA_RECORD" },
+  { 0x0028001E, "VSCP_TYPE_MULTIMEDIA_SET_RECORDING_VOLUME" },
+  { 0x00280028, "VSCP_TYPE_MULTIMEDIA_TIVO_FUNCTION" },
+  { 0x00280032, "VSCP_TYPE_MULTIMEDIA_GET_CURRENT_TITLE" },
+  { 0x00280033, "VSCP_TYPE_MULTIMEDIA_SET_POSITION" },
+  { 0x00280034, "VSCP_TYPE_MULTIMEDIA_GET_MEDIA_INFO" },
+  { 0x00280035, "VSCP_TYPE_MULTIMEDIA_REMOVE_ITEM" },
+  { 0x00280036, "VSCP_TYPE_MULTIMEDIA_REMOVE_ALL_ITEMS" },
+  { 0x00280037, "VSCP_TYPE_MULTIMEDIA_SAVE_ALBUM" },
+  { 0x0028003C, "VSCP_TYPE_MULTIMEDIA_CONTROL" },
+  { 0x0028003D, "VSCP_TYPE_MULTIMEDIA_CONTROL_RESPONSE" },
+  { 0x00320000, "VSCP_TYPE_AOL_GENERAL" },
+  { 0x00320001, "VSCP_TYPE_AOL_UNPLUGGED_POWER" },
+  { 0x00320002, "VSCP_TYPE_AOL_UNPLUGGED_LAN" },
+  { 0x00320003, "VSCP_TYPE_AOL_CHASSIS_INTRUSION" },
+  { 0x00320004, "VSCP_TYPE_AOL_PROCESSOR_REMOVAL" },
+  { 0x00320005, "VSCP_TYPE_AOL_ENVIRONMENT_ERROR" },
+  { 0x00320006, "VSCP_TYPE_AOL_HIGH_TEMPERATURE" },
+  { 0x00320007, "VSCP_TYPE_AOL_FAN_SPEED" },
+  { 0x00320008, "VSCP_TYPE_AOL_VOLTAGE_FLUCTUATIONS" },
+  { 0x00320009, "VSCP_TYPE_AOL_OS_ERROR" },
+  { 0x0032000A, "VSCP_TYPE_AOL_POWER_ON_ERROR" },
+  { 0x0032000B, "VSCP_TYPE_AOL_SYSTEM_HUNG" },
+  { 0x0032000C, "VSCP_TYPE_AOL_COMPONENT_FAILURE" },
+  { 0x0032000D, "VSCP_TYPE_AOL_REBOOT_UPON_FAILURE" },
+  { 0x0032000E, "VSCP_TYPE_AOL_REPAIR_OPERATING_SYSTEM" },
+  { 0x0032000F, "VSCP_TYPE_AOL_UPDATE_BIOS_IMAGE" },
+  { 0x00320010, "VSCP_TYPE_AOL_UPDATE_DIAGNOSTIC_PROCEDURE" },
+  { 0x003C0000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x003C0001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x003C0002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x003C0003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x003C0004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x003C0005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x003C0006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x003C0007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x003C0008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x003C0009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x003C000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x003C000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x003C000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x003C000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x003C000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x003C000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x003C0010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x003C0011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x003C0012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x003C0013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x003C0014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x003C0015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x003C0016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x003C0017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x003C0018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x003C0019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x003C001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x003C001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x003C001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x003C001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x003C001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x003C001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x003C0020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x003C0021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x003C0022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x003C0023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x003C0024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x003C0025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x003C0026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x003C0027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x003C0028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x003C0029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x003C002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x003C002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x003C002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x003C002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x003C002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x003C002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x003C0030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x003C0031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x003C0032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x003C0033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x003C0034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x003C0035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x003C0036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x003C0037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x003C0038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x003C0039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x003C003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x003C003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x003C003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x003C003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x003C003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x003C003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x003C0040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x003C0041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x003D0000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x003E0000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x003F0000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x00400000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x00410000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x00410001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x00410002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x00410003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x00410004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x00410005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x00410006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x00410007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x00410008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x00410009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x0041000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x0041000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x0041000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x0041000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x0041000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x0041000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x00410010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x00410011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x00410012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x00410013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x00410014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x00410015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x00410016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x00410017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x00410018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x00410019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x0041001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x0041001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x0041001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x0041001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x0041001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x0041001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x00410020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x00410021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x00410022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x00410023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x00410024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x00410025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x00410026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x00410027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x00410028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x00410029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x0041002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x0041002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x0041002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x0041002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x0041002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x0041002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x00410030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x00410031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x00410032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x00410033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x00410034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x00410035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x00410036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x00410037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x00410038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x00410039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x0041003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x0041003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x0041003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x0041003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x0041003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x0041003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x00410040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x00410041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x00420000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x00430000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x00440000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x00450000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x00460000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x00460001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x00460002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x00460003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x00460004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x00460005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x00460006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x00460007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x00460008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x00460009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x0046000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x0046000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x0046000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x0046000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x0046000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x0046000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x00460010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x00460011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x00460012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x00460013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x00460014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x00460015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x00460016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x00460017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x00460018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x00460019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x0046001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x0046001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x0046001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x0046001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x0046001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x0046001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x00460020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x00460021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x00460022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x00460023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x00460024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x00460025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x00460026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x00460027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x00460028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x00460029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x0046002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x0046002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x0046002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x0046002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x0046002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x0046002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x00460030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x00460031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x00460032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x00460033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x00460034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x00460035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x00460036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x00460037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x00460038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x00460039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x0046003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x0046003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x0046003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x0046003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x0046003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x0046003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x00460040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x00460041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x00470000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x00480000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x00490000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x004A0000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x00550000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x00550001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x00550002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x00550003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x00550004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x00550005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x00550006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x00550007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x00550008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x00550009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x0055000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x0055000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x0055000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x0055000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x0055000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x0055000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x00550010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x00550011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x00550012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x00550013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x00550014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x00550015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x00550016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x00550017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x00550018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x00550019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x0055001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x0055001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x0055001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x0055001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x0055001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x0055001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x00550020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x00550021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x00550022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x00550023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x00550024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x00550025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x00550026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x00550027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x00550028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x00550029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x0055002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x0055002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x0055002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x0055002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x0055002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x0055002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x00550030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x00550031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x00550032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x00550033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x00550034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x00550035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x00550036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x00550037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x00550038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x00550039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x0055003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x0055003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x0055003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x0055003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x0055003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x0055003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x00550040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x00550041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x00560000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x00570000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x00580000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x00590000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x005A0000, "VSCP_TYPE_WEATHER_GENERAL" },
+  { 0x005A0001, "VSCP_TYPE_WEATHER_SEASONS_WINTER" },
+  { 0x005A0002, "VSCP_TYPE_WEATHER_SEASONS_SPRING" },
+  { 0x005A0003, "VSCP_TYPE_WEATHER_SEASONS_SUMMER" },
+  { 0x005A0004, "VSCP_TYPE_WEATHER_SEASONS_AUTUMN" },
+  { 0x005A0005, "VSCP_TYPE_WEATHER_WIND_NONE" },
+  { 0x005A0006, "VSCP_TYPE_WEATHER_WIND_LOW" },
+  { 0x005A0007, "VSCP_TYPE_WEATHER_WIND_MEDIUM" },
+  { 0x005A0008, "VSCP_TYPE_WEATHER_WIND_HIGH" },
+  { 0x005A0009, "VSCP_TYPE_WEATHER_WIND_VERY_HIGH" },
+  { 0x005A000A, "VSCP_TYPE_WEATHER_AIR_FOGGY" },
+  { 0x005A000B, "VSCP_TYPE_WEATHER_AIR_FREEZING" },
+  { 0x005A000C, "VSCP_TYPE_WEATHER_AIR_VERY_COLD" },
+  { 0x005A000D, "VSCP_TYPE_WEATHER_AIR_COLD" },
+  { 0x005A000E, "VSCP_TYPE_WEATHER_AIR_NORMAL" },
+  { 0x005A000F, "VSCP_TYPE_WEATHER_AIR_HOT" },
+  { 0x005A0010, "VSCP_TYPE_WEATHER_AIR_VERY_HOT" },
+  { 0x005A0011, "VSCP_TYPE_WEATHER_AIR_POLLUTION_LOW" },
+  { 0x005A0012, "VSCP_TYPE_WEATHER_AIR_POLLUTION_MEDIUM" },
+  { 0x005A0013, "VSCP_TYPE_WEATHER_AIR_POLLUTION_HIGH" },
+  { 0x005A0014, "VSCP_TYPE_WEATHER_AIR_HUMID" },
+  { 0x005A0015, "VSCP_TYPE_WEATHER_AIR_DRY" },
+  { 0x005A0016, "VSCP_TYPE_WEATHER_SOIL_HUMID" },
+  { 0x005A0017, "VSCP_TYPE_WEATHER_SOIL_DRY" },
+  { 0x005A0018, "VSCP_TYPE_WEATHER_RAIN_NONE" },
+  { 0x005A0019, "VSCP_TYPE_WEATHER_RAIN_LIGHT" },
+  { 0x005A001A, "VSCP_TYPE_WEATHER_RAIN_HEAVY" },
+  { 0x005A001B, "VSCP_TYPE_WEATHER_RAIN_VERY_HEAVY" },
+  { 0x005A001C, "VSCP_TYPE_WEATHER_SUN_NONE" },
+  { 0x005A001D, "VSCP_TYPE_WEATHER_SUN_LIGHT" },
+  { 0x005A001E, "VSCP_TYPE_WEATHER_SUN_HEAVY" },
+  { 0x005A001F, "VSCP_TYPE_WEATHER_SNOW_NONE" },
+  { 0x005A0020, "VSCP_TYPE_WEATHER_SNOW_LIGHT" },
+  { 0x005A0021, "VSCP_TYPE_WEATHER_SNOW_HEAVY" },
+  { 0x005A0022, "VSCP_TYPE_WEATHER_DEW_POINT" },
+  { 0x005A0023, "VSCP_TYPE_WEATHER_STORM" },
+  { 0x005A0024, "VSCP_TYPE_WEATHER_FLOOD" },
+  { 0x005A0025, "VSCP_TYPE_WEATHER_EARTHQUAKE" },
+  { 0x005A0026, "VSCP_TYPE_WEATHER_NUCLEAR_DISASTER" },
+  { 0x005A0027, "VSCP_TYPE_WEATHER_FIRE" },
+  { 0x005A0028, "VSCP_TYPE_WEATHER_LIGHTNING" },
+  { 0x005A0029, "VSCP_TYPE_WEATHER_UV_RADIATION_LOW" },
+  { 0x005A002A, "VSCP_TYPE_WEATHER_UV_RADIATION_MEDIUM" },
+  { 0x005A002B, "VSCP_TYPE_WEATHER_UV_RADIATION_NORMAL" },
+  { 0x005A002C, "VSCP_TYPE_WEATHER_UV_RADIATION_HIGH" },
+  { 0x005A002D, "VSCP_TYPE_WEATHER_UV_RADIATION_VERY_HIGH" },
+  { 0x005A002E, "VSCP_TYPE_WEATHER_WARNING_LEVEL1" },
+  { 0x005A002F, "VSCP_TYPE_WEATHER_WARNING_LEVEL2" },
+  { 0x005A0030, "VSCP_TYPE_WEATHER_WARNING_LEVEL3" },
+  { 0x005A0031, "VSCP_TYPE_WEATHER_WARNING_LEVEL4" },
+  { 0x005A0032, "VSCP_TYPE_WEATHER_WARNING_LEVEL5" },
+  { 0x005A0033, "VSCP_TYPE_WEATHER_ARMAGEDON" },
+  { 0x005A0034, "VSCP_TYPE_WEATHER_UV_INDEX" },
+  { 0x005F0000, "VSCP_TYPE_WEATHER_GENERAL" },
+  { 0x005F0001, "VSCP_TYPE_WEATHER_SEASONS_WINTER" },
+  { 0x005F0002, "VSCP_TYPE_WEATHER_SEASONS_SPRING" },
+  { 0x005F0003, "VSCP_TYPE_WEATHER_SEASONS_SUMMER" },
+  { 0x005F0004, "VSCP_TYPE_WEATHER_SEASONS_AUTUMN" },
+  { 0x005F0005, "VSCP_TYPE_WEATHER_WIND_NONE" },
+  { 0x005F0006, "VSCP_TYPE_WEATHER_WIND_LOW" },
+  { 0x005F0007, "VSCP_TYPE_WEATHER_WIND_MEDIUM" },
+  { 0x005F0008, "VSCP_TYPE_WEATHER_WIND_HIGH" },
+  { 0x005F0009, "VSCP_TYPE_WEATHER_WIND_VERY_HIGH" },
+  { 0x005F000A, "VSCP_TYPE_WEATHER_AIR_FOGGY" },
+  { 0x005F000B, "VSCP_TYPE_WEATHER_AIR_FREEZING" },
+  { 0x005F000C, "VSCP_TYPE_WEATHER_AIR_VERY_COLD" },
+  { 0x005F000D, "VSCP_TYPE_WEATHER_AIR_COLD" },
+  { 0x005F000E, "VSCP_TYPE_WEATHER_AIR_NORMAL" },
+  { 0x005F000F, "VSCP_TYPE_WEATHER_AIR_HOT" },
+  { 0x005F0010, "VSCP_TYPE_WEATHER_AIR_VERY_HOT" },
+  { 0x005F0011, "VSCP_TYPE_WEATHER_AIR_POLLUTION_LOW" },
+  { 0x005F0012, "VSCP_TYPE_WEATHER_AIR_POLLUTION_MEDIUM" },
+  { 0x005F0013, "VSCP_TYPE_WEATHER_AIR_POLLUTION_HIGH" },
+  { 0x005F0014, "VSCP_TYPE_WEATHER_AIR_HUMID" },
+  { 0x005F0015, "VSCP_TYPE_WEATHER_AIR_DRY" },
+  { 0x005F0016, "VSCP_TYPE_WEATHER_SOIL_HUMID" },
+  { 0x005F0017, "VSCP_TYPE_WEATHER_SOIL_DRY" },
+  { 0x005F0018, "VSCP_TYPE_WEATHER_RAIN_NONE" },
+  { 0x005F0019, "VSCP_TYPE_WEATHER_RAIN_LIGHT" },
+  { 0x005F001A, "VSCP_TYPE_WEATHER_RAIN_HEAVY" },
+  { 0x005F001B, "VSCP_TYPE_WEATHER_RAIN_VERY_HEAVY" },
+  { 0x005F001C, "VSCP_TYPE_WEATHER_SUN_NONE" },
+  { 0x005F001D, "VSCP_TYPE_WEATHER_SUN_LIGHT" },
+  { 0x005F001E, "VSCP_TYPE_WEATHER_SUN_HEAVY" },
+  { 0x005F001F, "VSCP_TYPE_WEATHER_SNOW_NONE" },
+  { 0x005F0020, "VSCP_TYPE_WEATHER_SNOW_LIGHT" },
+  { 0x005F0021, "VSCP_TYPE_WEATHER_SNOW_HEAVY" },
+  { 0x005F0022, "VSCP_TYPE_WEATHER_DEW_POINT" },
+  { 0x005F0023, "VSCP_TYPE_WEATHER_STORM" },
+  { 0x005F0024, "VSCP_TYPE_WEATHER_FLOOD" },
+  { 0x005F0025, "VSCP_TYPE_WEATHER_EARTHQUAKE" },
+  { 0x005F0026, "VSCP_TYPE_WEATHER_NUCLEAR_DISASTER" },
+  { 0x005F0027, "VSCP_TYPE_WEATHER_FIRE" },
+  { 0x005F0028, "VSCP_TYPE_WEATHER_LIGHTNING" },
+  { 0x005F0029, "VSCP_TYPE_WEATHER_UV_RADIATION_LOW" },
+  { 0x005F002A, "VSCP_TYPE_WEATHER_UV_RADIATION_MEDIUM" },
+  { 0x005F002B, "VSCP_TYPE_WEATHER_UV_RADIATION_NORMAL" },
+  { 0x005F002C, "VSCP_TYPE_WEATHER_UV_RADIATION_HIGH" },
+  { 0x005F002D, "VSCP_TYPE_WEATHER_UV_RADIATION_VERY_HIGH" },
+  { 0x005F002E, "VSCP_TYPE_WEATHER_WARNING_LEVEL1" },
+  { 0x005F002F, "VSCP_TYPE_WEATHER_WARNING_LEVEL2" },
+  { 0x005F0030, "VSCP_TYPE_WEATHER_WARNING_LEVEL3" },
+  { 0x005F0031, "VSCP_TYPE_WEATHER_WARNING_LEVEL4" },
+  { 0x005F0032, "VSCP_TYPE_WEATHER_WARNING_LEVEL5" },
+  { 0x005F0033, "VSCP_TYPE_WEATHER_ARMAGEDON" },
+  { 0x005F0034, "VSCP_TYPE_WEATHER_UV_INDEX" },
+  { 0x00640000, "VSCP_TYPE_PHONE_GENERAL" },
+  { 0x00640001, "VSCP_TYPE_PHONE_INCOMING_CALL" },
+  { 0x00640002, "VSCP_TYPE_PHONE_OUTGOING_CALL" },
+  { 0x00640003, "VSCP_TYPE_PHONE_RING" },
+  { 0x00640004, "VSCP_TYPE_PHONE_ANSWER" },
+  { 0x00640005, "VSCP_TYPE_PHONE_HANGUP" },
+  { 0x00640006, "VSCP_TYPE_PHONE_GIVEUP" },
+  { 0x00640007, "VSCP_TYPE_PHONE_TRANSFER" },
+  { 0x00640008, "VSCP_TYPE_PHONE_DATABASE_INFO" },
+  { 0x00660000, "VSCP_TYPE_DISPLAY_GENERAL" },
+  { 0x00660001, "VSCP_TYPE_DISPLAY_CLEAR_DISPLAY" },
+  { 0x00660002, "VSCP_TYPE_DISPLAY_POSITION_CURSOR" },
+  { 0x00660003, "VSCP_TYPE_DISPLAY_WRITE_DISPLAY" },
+  { 0x00660004, "VSCP_TYPE_DISPLAY_WRITE_DISPLAY_BUFFER" },
+  { 0x00660005, "VSCP_TYPE_DISPLAY_SHOW_DISPLAY_BUFFER" },
+  { 0x00660006, "VSCP_TYPE_DISPLAY_SET_DISPLAY_BUFFER_PARAM" },
+  { 0x00660020, "VSCP_TYPE_DISPLAY_SHOW_TEXT" },
+  { 0x00660030, "VSCP_TYPE_DISPLAY_SHOW_LED" },
+  { 0x00660031, "VSCP_TYPE_DISPLAY_SHOW_LED_COLOR" },
+  { 0x006E0000, "VSCP_TYPE_REMOTE_GENERAL" },
+  { 0x006E0001, "VSCP_TYPE_REMOTE_RC5" },
+  { 0x006E0003, "VSCP_TYPE_REMOTE_SONY12" },
+  { 0x006E0020, "VSCP_TYPE_REMOTE_LIRC" },
+  { 0x006E0030, "VSCP_TYPE_REMOTE_VSCP" },
+  { 0x006E0031, "VSCP_TYPE_REMOTE_MAPITO" },
+  { 0x00780000, "VSCP_TYPE_CONFIGURATION_GENERAL" },
+  { 0x00780001, "VSCP_TYPE_CONFIGURATION_LOAD" },
+  { 0x00780002, "VSCP_TYPE_CONFIGURATION_LOAD_ACK" },
+  { 0x00780003, "VSCP_TYPE_CONFIGURATION_LOAD_NACK" },
+  { 0x00780004, "VSCP_TYPE_CONFIGURATION_SAVE" },
+  { 0x00780005, "VSCP_TYPE_CONFIGURATION_SAVE_ACK" },
+  { 0x00780006, "VSCP_TYPE_CONFIGURATION_SAVE_NACK" },
+  { 0x00780007, "VSCP_TYPE_CONFIGURATION_COMMIT" },
+  { 0x00780008, "VSCP_TYPE_CONFIGURATION_COMMIT_ACK" },
+  { 0x00780009, "VSCP_TYPE_CONFIGURATION_COMMIT_NACK" },
+  { 0x0078000A, "VSCP_TYPE_CONFIGURATION_RELOAD" },
+  { 0x0078000B, "VSCP_TYPE_CONFIGURATION_REALOD_ACK" },
+  { 0x0078000C, "VSCP_TYPE_CONFIGURATION_RELOAD_NACK" },
+  { 0x0078000D, "VSCP_TYPE_CONFIGURATION_RESTORE" },
+  { 0x0078000E, "VSCP_TYPE_CONFIGURATION_RESTORE_ACK" },
+  { 0x0078000F, "VSCP_TYPE_CONFIGURATION_RESTORE_NACK" },
+  { 0x0078001E, "VSCP_TYPE_CONFIGURATION_SET_PARAMETER" },
+  { 0x0078001F, "VSCP_TYPE_CONFIGURATION_SET_PARAMETER_DEFAULT" },
+  { 0x00780020, "VSCP_TYPE_CONFIGURATION_SET_PARAMETER_ACK" },
+  { 0x00780021, "VSCP_TYPE_CONFIGURATION_SET_PARAMETER_NACK" },
+  { 0x00CE0000, "VSCP_TYPE_GNSS_GENERAL" },
+  { 0x00CE0001, "VSCP_TYPE_GNSS_POSITION" },
+  { 0x00CE0002, "VSCP_TYPE_GNSS_SATELLITES" },
+  { 0x00D40000, "VSCP_TYPE_WIRELESS_GENERAL" },
+  { 0x00D40001, "VSCP_TYPE_WIRELESS_GSM_CELL" },
+  { 0x01FA0000, "VSCP_TYPE_DIAGNOSTIC_GENERAL" },
+  { 0x01FA0001, "VSCP_TYPE_DIAGNOSTIC_OVERVOLTAGE" },
+  { 0x01FA0002, "VSCP_TYPE_DIAGNOSTIC_UNDERVOLTAGE" },
+  { 0x01FA0003, "VSCP_TYPE_DIAGNOSTIC_VBUS_LOW" },
+  { 0x01FA0004, "VSCP_TYPE_DIAGNOSTIC_BATTERY_LOW" },
+  { 0x01FA0005, "VSCP_TYPE_DIAGNOSTIC_BATTERY_FULL" },
+  { 0x01FA0006, "VSCP_TYPE_DIAGNOSTIC_BATTERY_ERROR" },
+  { 0x01FA0007, "VSCP_TYPE_DIAGNOSTIC_BATTERY_OK" },
+  { 0x01FA0008, "VSCP_TYPE_DIAGNOSTIC_OVERCURRENT" },
+  { 0x01FA0009, "VSCP_TYPE_DIAGNOSTIC_CIRCUIT_ERROR" },
+  { 0x01FA000A, "VSCP_TYPE_DIAGNOSTIC_SHORT_CIRCUIT" },
+  { 0x01FA000B, "VSCP_TYPE_DIAGNOSTIC_OPEN_CIRCUIT" },
+  { 0x01FA000C, "VSCP_TYPE_DIAGNOSTIC_MOIST" },
+  { 0x01FA000D, "VSCP_TYPE_DIAGNOSTIC_WIRE_FAIL" },
+  { 0x01FA000E, "VSCP_TYPE_DIAGNOSTIC_WIRELESS_FAIL" },
+  { 0x01FA000F, "VSCP_TYPE_DIAGNOSTIC_IR_FAIL" },
+  { 0x01FA0010, "VSCP_TYPE_DIAGNOSTIC_1WIRE_FAIL" },
+  { 0x01FA0011, "VSCP_TYPE_DIAGNOSTIC_RS222_FAIL" },
+  { 0x01FA0012, "VSCP_TYPE_DIAGNOSTIC_RS232_FAIL" },
+  { 0x01FA0013, "VSCP_TYPE_DIAGNOSTIC_RS423_FAIL" },
+  { 0x01FA0014, "VSCP_TYPE_DIAGNOSTIC_RS485_FAIL" },
+  { 0x01FA0015, "VSCP_TYPE_DIAGNOSTIC_CAN_FAIL" },
+  { 0x01FA0016, "VSCP_TYPE_DIAGNOSTIC_LAN_FAIL" },
+  { 0x01FA0017, "VSCP_TYPE_DIAGNOSTIC_USB_FAIL" },
+  { 0x01FA0018, "VSCP_TYPE_DIAGNOSTIC_WIFI_FAIL" },
+  { 0x01FA0019, "VSCP_TYPE_DIAGNOSTIC_NFC_RFID_FAIL" },
+  { 0x01FA001A, "VSCP_TYPE_DIAGNOSTIC_LOW_SIGNAL" },
+  { 0x01FA001B, "VSCP_TYPE_DIAGNOSTIC_HIGH_SIGNAL" },
+  { 0x01FA001C, "VSCP_TYPE_DIAGNOSTIC_ADC_FAIL" },
+  { 0x01FA001D, "VSCP_TYPE_DIAGNOSTIC_ALU_FAIL" },
+  { 0x01FA001E, "VSCP_TYPE_DIAGNOSTIC_ASSERT" },
+  { 0x01FA001F, "VSCP_TYPE_DIAGNOSTIC_DAC_FAIL" },
+  { 0x01FA0020, "VSCP_TYPE_DIAGNOSTIC_DMA_FAIL" },
+  { 0x01FA0021, "VSCP_TYPE_DIAGNOSTIC_ETH_FAIL" },
+  { 0x01FA0022, "VSCP_TYPE_DIAGNOSTIC_EXCEPTION" },
+  { 0x01FA0023, "VSCP_TYPE_DIAGNOSTIC_FPU_FAIL" },
+  { 0x01FA0024, "VSCP_TYPE_DIAGNOSTIC_GPIO_FAIL" },
+  { 0x01FA0025, "VSCP_TYPE_DIAGNOSTIC_I2C_FAIL" },
+  { 0x01FA0026, "VSCP_TYPE_DIAGNOSTIC_I2S_FAIL" },
+  { 0x01FA0027, "VSCP_TYPE_DIAGNOSTIC_INVALID_CONFIG" },
+  { 0x01FA0028, "VSCP_TYPE_DIAGNOSTIC_MMU_FAIL" },
+  { 0x01FA0029, "VSCP_TYPE_DIAGNOSTIC_NMI" },
+  { 0x01FA002A, "VSCP_TYPE_DIAGNOSTIC_OVERHEAT" },
+  { 0x01FA002B, "VSCP_TYPE_DIAGNOSTIC_PLL_FAIL" },
+  { 0x01FA002C, "VSCP_TYPE_DIAGNOSTIC_POR_FAIL" },
+  { 0x01FA002D, "VSCP_TYPE_DIAGNOSTIC_PWM_FAIL" },
+  { 0x01FA002E, "VSCP_TYPE_DIAGNOSTIC_RAM_FAIL" },
+  { 0x01FA002F, "VSCP_TYPE_DIAGNOSTIC_ROM_FAIL" },
+  { 0x01FA0030, "VSCP_TYPE_DIAGNOSTIC_SPI_FAIL" },
+  { 0x01FA0031, "VSCP_TYPE_DIAGNOSTIC_STACK_FAIL" },
+  { 0x01FA0032, "VSCP_TYPE_DIAGNOSTIC_LIN_FAIL" },
+  { 0x01FA0033, "VSCP_TYPE_DIAGNOSTIC_UART_FAIL" },
+  { 0x01FA0034, "VSCP_TYPE_DIAGNOSTIC_UNHANDLED_INT" },
+  { 0x01FA0035, "VSCP_TYPE_DIAGNOSTIC_MEMORY_FAIL" },
+  { 0x01FA0036, "VSCP_TYPE_DIAGNOSTIC_VARIABLE_RANGE" },
+  { 0x01FA0037, "VSCP_TYPE_DIAGNOSTIC_WDT" },
+  { 0x01FA0038, "VSCP_TYPE_DIAGNOSTIC_EEPROM_FAIL" },
+  { 0x01FA0039, "VSCP_TYPE_DIAGNOSTIC_ENCRYPTION_FAIL" },
+  { 0x01FA003A, "VSCP_TYPE_DIAGNOSTIC_BAD_USER_INPUT" },
+  { 0x01FA003B, "VSCP_TYPE_DIAGNOSTIC_DECRYPTION_FAIL" },
+  { 0x01FA003C, "VSCP_TYPE_DIAGNOSTIC_NOISE" },
+  { 0x01FA003D, "VSCP_TYPE_DIAGNOSTIC_BOOTLOADER_FAIL" },
+  { 0x01FA003E, "VSCP_TYPE_DIAGNOSTIC_PROGRAMFLOW_FAIL" },
+  { 0x01FA003F, "VSCP_TYPE_DIAGNOSTIC_RTC_FAIL" },
+  { 0x01FA0040, "VSCP_TYPE_DIAGNOSTIC_SYSTEM_TEST_FAIL" },
+  { 0x01FA0041, "VSCP_TYPE_DIAGNOSTIC_SENSOR_FAIL" },
+  { 0x01FA0042, "VSCP_TYPE_DIAGNOSTIC_SAFESTATE" },
+  { 0x01FA0043, "VSCP_TYPE_DIAGNOSTIC_SIGNAL_IMPLAUSIBLE" },
+  { 0x01FA0044, "VSCP_TYPE_DIAGNOSTIC_STORAGE_FAIL" },
+  { 0x01FA0045, "VSCP_TYPE_DIAGNOSTIC_SELFTEST_FAIL" },
+  { 0x01FA0046, "VSCP_TYPE_DIAGNOSTIC_ESD_EMC_EMI" },
+  { 0x01FA0047, "VSCP_TYPE_DIAGNOSTIC_TIMEOUT" },
+  { 0x01FA0048, "VSCP_TYPE_DIAGNOSTIC_LCD_FAIL" },
+  { 0x01FA0049, "VSCP_TYPE_DIAGNOSTIC_TOUCHPANEL_FAIL" },
+  { 0x01FA004A, "VSCP_TYPE_DIAGNOSTIC_NOLOAD" },
+  { 0x01FA004B, "VSCP_TYPE_DIAGNOSTIC_COOLING_FAIL" },
+  { 0x01FA004C, "VSCP_TYPE_DIAGNOSTIC_HEATING_FAIL" },
+  { 0x01FA004D, "VSCP_TYPE_DIAGNOSTIC_TX_FAIL" },
+  { 0x01FA004E, "VSCP_TYPE_DIAGNOSTIC_RX_FAIL" },
+  { 0x01FA004F, "VSCP_TYPE_DIAGNOSTIC_EXT_IC_FAIL" },
+  { 0x01FA0050, "VSCP_TYPE_DIAGNOSTIC_CHARGING_ON" },
+  { 0x01FA0051, "VSCP_TYPE_DIAGNOSTIC_CHARGING_OFF" },
+  { 0x01FC0000, "VSCP_TYPE_ERROR_SUCCESS" },
+  { 0x01FC0001, "VSCP_TYPE_ERROR_ERROR" },
+  { 0x01FC0007, "VSCP_TYPE_ERROR_CHANNEL" },
+  { 0x01FC0008, "VSCP_TYPE_ERROR_FIFO_EMPTY" },
+  { 0x01FC0009, "VSCP_TYPE_ERROR_FIFO_FULL" },
+  { 0x01FC000A, "VSCP_TYPE_ERROR_FIFO_SIZE" },
+  { 0x01FC000B, "VSCP_TYPE_ERROR_FIFO_WAIT" },
+  { 0x01FC000C, "VSCP_TYPE_ERROR_GENERIC" },
+  { 0x01FC000D, "VSCP_TYPE_ERROR_HARDWARE" },
+  { 0x01FC000E, "VSCP_TYPE_ERROR_INIT_FAIL" },
+  { 0x01FC000F, "VSCP_TYPE_ERROR_INIT_MISSING" },
+  { 0x01FC0010, "VSCP_TYPE_ERROR_INIT_READY" },
+  { 0x01FC0011, "VSCP_TYPE_ERROR_NOT_SUPPORTED" },
+  { 0x01FC0012, "VSCP_TYPE_ERROR_OVERRUN" },
+  { 0x01FC0013, "VSCP_TYPE_ERROR_RCV_EMPTY" },
+  { 0x01FC0014, "VSCP_TYPE_ERROR_REGISTER" },
+  { 0x01FC0015, "VSCP_TYPE_ERROR_TRM_FULL" },
+  { 0x01FC001C, "VSCP_TYPE_ERROR_LIBRARY" },
+  { 0x01FC001D, "VSCP_TYPE_ERROR_PROCADDRESS" },
+  { 0x01FC001E, "VSCP_TYPE_ERROR_ONLY_ONE_INSTANCE" },
+  { 0x01FC001F, "VSCP_TYPE_ERROR_SUB_DRIVER" },
+  { 0x01FC0020, "VSCP_TYPE_ERROR_TIMEOUT" },
+  { 0x01FC0021, "VSCP_TYPE_ERROR_NOT_OPEN" },
+  { 0x01FC0022, "VSCP_TYPE_ERROR_PARAMETER" },
+  { 0x01FC0023, "VSCP_TYPE_ERROR_MEMORY" },
+  { 0x01FC0024, "VSCP_TYPE_ERROR_INTERNAL" },
+  { 0x01FC0025, "VSCP_TYPE_ERROR_COMMUNICATION" },
+  { 0x01FC0026, "VSCP_TYPE_ERROR_USER" },
+  { 0x01FC0027, "VSCP_TYPE_ERROR_PASSWORD" },
+  { 0x01FC0028, "VSCP_TYPE_ERROR_CONNECTION" },
+  { 0x01FC0029, "VSCP_TYPE_ERROR_INVALID_HANDLE" },
+  { 0x01FC002A, "VSCP_TYPE_ERROR_OPERATION_FAILED" },
+  { 0x01FC002B, "VSCP_TYPE_ERROR_BUFFER_SMALL" },
+  { 0x01FC002C, "VSCP_TYPE_ERROR_ITEM_UNKNOWN" },
+  { 0x01FC002D, "VSCP_TYPE_ERROR_NAME_USED" },
+  { 0x01FC002E, "VSCP_TYPE_ERROR_DATA_WRITE" },
+  { 0x01FC002F, "VSCP_TYPE_ERROR_ABORTED" },
+  { 0x01FC0030, "VSCP_TYPE_ERROR_INVALID_POINTER" },
+  { 0x01FD0000, "VSCP_TYPE_LOG_GENERAL" },
+  { 0x01FD0001, "VSCP_TYPE_LOG_MESSAGE" },
+  { 0x01FD0002, "VSCP_TYPE_LOG_START" },
+  { 0x01FD0003, "VSCP_TYPE_LOG_STOP" },
+  { 0x01FD0004, "VSCP_TYPE_LOG_LEVEL" },
+  { 0x01FE0000, "VSCP_TYPE_LABORATORY_GENERAL" },
+  { 0x01FF0000, "VSCP_TYPE_LOCAL_GENERAL" },
+  { 0x02000000, "VSCP_TYPE_PROTOCOL_GENERAL" },
+  { 0x02000001, "VSCP_TYPE_PROTOCOL_SEGCTRL_HEARTBEAT" },
+  { 0x02000002, "VSCP_TYPE_PROTOCOL_NEW_NODE_ONLINE" },
+  { 0x02000003, "VSCP_TYPE_PROTOCOL_PROBE_ACK" },
+  { 0x02000004, "VSCP_TYPE_PROTOCOL_RESERVED4" },
+  { 0x02000005, "VSCP_TYPE_PROTOCOL_RESERVED5" },
+  { 0x02000006, "VSCP_TYPE_PROTOCOL_SET_NICKNAME" },
+  { 0x02000007, "VSCP_TYPE_PROTOCOL_NICKNAME_ACCEPTED" },
+  { 0x02000008, "VSCP_TYPE_PROTOCOL_DROP_NICKNAME" },
+  { 0x02000009, "VSCP_TYPE_PROTOCOL_READ_REGISTER" },
+  { 0x0200000A, "VSCP_TYPE_PROTOCOL_RW_RESPONSE" },
+  { 0x0200000B, "VSCP_TYPE_PROTOCOL_WRITE_REGISTER" },
+  { 0x0200000C, "VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER" },
+  { 0x0200000D, "VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER" },
+  { 0x0200000E, "VSCP_TYPE_PROTOCOL_NACK_BOOT_LOADER" },
+  { 0x0200000F, "VSCP_TYPE_PROTOCOL_START_BLOCK" },
+  { 0x02000010, "VSCP_TYPE_PROTOCOL_BLOCK_DATA" },
+  { 0x02000011, "VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK" },
+  { 0x02000012, "VSCP_TYPE_PROTOCOL_BLOCK_DATA_NACK" },
+  { 0x02000013, "VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA" },
+  { 0x02000014, "VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK" },
+  { 0x02000015, "VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_NACK" },
+  { 0x02000016, "VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE" },
+  { 0x02000017, "VSCP_TYPE_PROTOCOL_RESET_DEVICE" },
+  { 0x02000018, "VSCP_TYPE_PROTOCOL_PAGE_READ" },
+  { 0x02000019, "VSCP_TYPE_PROTOCOL_PAGE_WRITE" },
+  { 0x0200001A, "VSCP_TYPE_PROTOCOL_RW_PAGE_RESPONSE" },
+  { 0x0200001B, "VSCP_TYPE_PROTOCOL_HIGH_END_SERVER_PROBE" },
+  { 0x0200001C, "VSCP_TYPE_PROTOCOL_HIGH_END_SERVER_RESPONSE" },
+  { 0x0200001D, "VSCP_TYPE_PROTOCOL_INCREMENT_REGISTER" },
+  { 0x0200001E, "VSCP_TYPE_PROTOCOL_DECREMENT_REGISTER" },
+  { 0x0200001F, "VSCP_TYPE_PROTOCOL_WHO_IS_THERE" },
+  { 0x02000020, "VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE" },
+  { 0x02000021, "VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO" },
+  { 0x02000022, "VSCP_TYPE_PROTOCOL_GET_MATRIX_INFO_RESPONSE" },
+  { 0x02000023, "VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF" },
+  { 0x02000024, "VSCP_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE" },
+  { 0x02000025, "VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ" },
+  { 0x02000026, "VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_WRITE" },
+  { 0x02000027, "VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE" },
+  { 0x02000028, "VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST" },
+  { 0x02000029, "VSCP_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE" },
+  { 0x02000030, "VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_ACK" },
+  { 0x02000031, "VSCP_TYPE_PROTOCOL_ACTIVATE_NEW_IMAGE_NACK" },
+  { 0x02000032, "VSCP_TYPE_PROTOCOL_START_BLOCK_ACK" },
+  { 0x02000033, "VSCP_TYPE_PROTOCOL_START_BLOCK_NACK" },
+  { 0x02010000, "VSCP_TYPE_ALARM_GENERAL" },
+  { 0x02010001, "VSCP_TYPE_ALARM_WARNING" },
+  { 0x02010002, "VSCP_TYPE_ALARM_ALARM" },
+  { 0x02010003, "VSCP_TYPE_ALARM_SOUND" },
+  { 0x02010004, "VSCP_TYPE_ALARM_LIGHT" },
+  { 0x02010005, "VSCP_TYPE_ALARM_POWER" },
+  { 0x02010006, "VSCP_TYPE_ALARM_EMERGENCY_STOP" },
+  { 0x02010007, "VSCP_TYPE_ALARM_EMERGENCY_PAUSE" },
+  { 0x02010008, "VSCP_TYPE_ALARM_EMERGENCY_RESET" },
+  { 0x02010009, "VSCP_TYPE_ALARM_EMERGENCY_RESUME" },
+  { 0x0201000A, "VSCP_TYPE_ALARM_ARM" },
+  { 0x0201000B, "VSCP_TYPE_ALARM_DISARM" },
+  { 0x0201000C, "VSCP_TYPE_ALARM_WATCHDOG" },
+  { 0x0201000D, "VSCP_TYPE_ALARM_RESET" },
+  { 0x02020000, "VSCP_TYPE_SECURITY_GENERAL" },
+  { 0x02020001, "VSCP_TYPE_SECURITY_MOTION" },
+  { 0x02020002, "VSCP_TYPE_SECURITY_GLASS_BREAK" },
+  { 0x02020003, "VSCP_TYPE_SECURITY_BEAM_BREAK" },
+  { 0x02020004, "VSCP_TYPE_SECURITY_SENSOR_TAMPER" },
+  { 0x02020005, "VSCP_TYPE_SECURITY_SHOCK_SENSOR" },
+  { 0x02020006, "VSCP_TYPE_SECURITY_SMOKE_SENSOR" },
+  { 0x02020007, "VSCP_TYPE_SECURITY_HEAT_SENSOR" },
+  { 0x02020008, "VSCP_TYPE_SECURITY_PANIC_SWITCH" },
+  { 0x02020009, "VSCP_TYPE_SECURITY_DOOR_OPEN" },
+  { 0x0202000A, "VSCP_TYPE_SECURITY_WINDOW_OPEN" },
+  { 0x0202000B, "VSCP_TYPE_SECURITY_CO_SENSOR" },
+  { 0x0202000C, "VSCP_TYPE_SECURITY_FROST_DETECTED" },
+  { 0x0202000D, "VSCP_TYPE_SECURITY_FLAME_DETECTED" },
+  { 0x0202000E, "VSCP_TYPE_SECURITY_OXYGEN_LOW" },
+  { 0x0202000F, "VSCP_TYPE_SECURITY_WEIGHT_DETECTED" },
+  { 0x02020010, "VSCP_TYPE_SECURITY_WATER_DETECTED" },
+  { 0x02020011, "VSCP_TYPE_SECURITY_CONDENSATION_DETECTED" },
+  { 0x02020012, "VSCP_TYPE_SECURITY_SOUND_DETECTED" },
+  { 0x02020013, "VSCP_TYPE_SECURITY_HARMFUL_SOUND_LEVEL" },
+  { 0x02020014, "VSCP_TYPE_SECURITY_TAMPER" },
+  { 0x02020015, "VSCP_TYPE_SECURITY_AUTHENTICATED" },
+  { 0x02020016, "VSCP_TYPE_SECURITY_UNAUTHENTICATED" },
+  { 0x02020017, "VSCP_TYPE_SECURITY_AUTHORIZED" },
+  { 0x02020018, "VSCP_TYPE_SECURITY_UNAUTHORIZED" },
+  { 0x02020019, "VSCP_TYPE_SECURITY_ID_CHECK" },
+  { 0x0202001A, "VSCP_TYPE_SECURITY_PIN_OK" },
+  { 0x0202001B, "VSCP_TYPE_SECURITY_PIN_FAIL" },
+  { 0x0202001C, "VSCP_TYPE_SECURITY_PIN_WARNING" },
+  { 0x0202001D, "VSCP_TYPE_SECURITY_PIN_ERROR" },
+  { 0x0202001E, "VSCP_TYPE_SECURITY_PASSWORD_OK" },
+  { 0x0202001F, "VSCP_TYPE_SECURITY_PASSWORD_FAIL" },
+  { 0x02020020, "VSCP_TYPE_SECURITY_PASSWORD_WARNING" },
+  { 0x02020021, "VSCP_TYPE_SECURITY_PASSWORD_ERROR" },
+  { 0x02020022, "VSCP_TYPE_SECURITY_GAS_SENSOR" },
+  { 0x02020023, "VSCP_TYPE_SECURITY_IN_MOTION_DETECTED" },
+  { 0x02020024, "VSCP_TYPE_SECURITY_NOT_IN_MOTION_DETECTED" },
+  { 0x02020025, "VSCP_TYPE_SECURITY_VIBRATION_DETECTED" },
+  { 0x020A0000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x020A0001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x020A0002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x020A0003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x020A0004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x020A0005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x020A0006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x020A0007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x020A0008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x020A0009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x020A000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x020A000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x020A000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x020A000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x020A000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x020A000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x020A0010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x020A0011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x020A0012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x020A0013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x020A0014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x020A0015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x020A0016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x020A0017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x020A0018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x020A0019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x020A001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x020A001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x020A001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x020A001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x020A001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x020A001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x020A0020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x020A0021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x020A0022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x020A0023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x020A0024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x020A0025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x020A0026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x020A0027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x020A0028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x020A0029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x020A002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x020A002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x020A002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x020A002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x020A002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x020A002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x020A0030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x020A0031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x020A0032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x020A0033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x020A0034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x020A0035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x020A0036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x020A0037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x020A0038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x020A0039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x020A003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x020A003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x020A003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x020A003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x020A003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x020A003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x020A0040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x020A0041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x020B0000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x020C0000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x020D0000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x020E0000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x020F0000, "VSCP_TYPE_DATA_GENERAL" },
+  { 0x020F0001, "VSCP_TYPE_DATA_IO" },
+  { 0x020F0002, "VSCP_TYPE_DATA_AD" },
+  { 0x020F0003, "VSCP_TYPE_DATA_DA" },
+  { 0x020F0004, "VSCP_TYPE_DATA_RELATIVE_STRENGTH" },
+  { 0x020F0005, "VSCP_TYPE_DATA_SIGNAL_LEVEL" },
+  { 0x020F0006, "VSCP_TYPE_DATA_SIGNAL_QUALITY" },
+  { 0x02140000, "VSCP_TYPE_INFORMATION_GENERAL" },
+  { 0x02140001, "VSCP_TYPE_INFORMATION_BUTTON" },
+  { 0x02140002, "VSCP_TYPE_INFORMATION_MOUSE" },
+  { 0x02140003, "VSCP_TYPE_INFORMATION_ON" },
+  { 0x02140004, "VSCP_TYPE_INFORMATION_OFF" },
+  { 0x02140005, "VSCP_TYPE_INFORMATION_ALIVE" },
+  { 0x02140006, "VSCP_TYPE_INFORMATION_TERMINATING" },
+  { 0x02140007, "VSCP_TYPE_INFORMATION_OPENED" },
+  { 0x02140008, "VSCP_TYPE_INFORMATION_CLOSED" },
+  { 0x02140009, "VSCP_TYPE_INFORMATION_NODE_HEARTBEAT" },
+  { 0x0214000A, "VSCP_TYPE_INFORMATION_BELOW_LIMIT" },
+  { 0x0214000B, "VSCP_TYPE_INFORMATION_ABOVE_LIMIT" },
+  { 0x0214000C, "VSCP_TYPE_INFORMATION_PULSE" },
+  { 0x0214000D, "VSCP_TYPE_INFORMATION_ERROR" },
+  { 0x0214000E, "VSCP_TYPE_INFORMATION_RESUMED" },
+  { 0x0214000F, "VSCP_TYPE_INFORMATION_PAUSED" },
+  { 0x02140010, "VSCP_TYPE_INFORMATION_SLEEP" },
+  { 0x02140011, "VSCP_TYPE_INFORMATION_GOOD_MORNING" },
+  { 0x02140012, "VSCP_TYPE_INFORMATION_GOOD_DAY" },
+  { 0x02140013, "VSCP_TYPE_INFORMATION_GOOD_AFTERNOON" },
+  { 0x02140014, "VSCP_TYPE_INFORMATION_GOOD_EVENING" },
+  { 0x02140015, "VSCP_TYPE_INFORMATION_GOOD_NIGHT" },
+  { 0x02140016, "VSCP_TYPE_INFORMATION_SEE_YOU_SOON" },
+  { 0x02140017, "VSCP_TYPE_INFORMATION_GOODBYE" },
+  { 0x02140018, "VSCP_TYPE_INFORMATION_STOP" },
+  { 0x02140019, "VSCP_TYPE_INFORMATION_START" },
+  { 0x0214001A, "VSCP_TYPE_INFORMATION_RESET_COMPLETED" },
+  { 0x0214001B, "VSCP_TYPE_INFORMATION_INTERRUPTED" },
+  { 0x0214001C, "VSCP_TYPE_INFORMATION_PREPARING_TO_SLEEP" },
+  { 0x0214001D, "VSCP_TYPE_INFORMATION_WOKEN_UP" },
+  { 0x0214001E, "VSCP_TYPE_INFORMATION_DUSK" },
+  { 0x0214001F, "VSCP_TYPE_INFORMATION_DAWN" },
+  { 0x02140020, "VSCP_TYPE_INFORMATION_ACTIVE" },
+  { 0x02140021, "VSCP_TYPE_INFORMATION_INACTIVE" },
+  { 0x02140022, "VSCP_TYPE_INFORMATION_BUSY" },
+  { 0x02140023, "VSCP_TYPE_INFORMATION_IDLE" },
+  { 0x02140024, "VSCP_TYPE_INFORMATION_STREAM_DATA" },
+  { 0x02140025, "VSCP_TYPE_INFORMATION_TOKEN_ACTIVITY" },
+  { 0x02140026, "VSCP_TYPE_INFORMATION_STREAM_DATA_WITH_ZONE" },
+  { 0x02140027, "VSCP_TYPE_INFORMATION_CONFIRM" },
+  { 0x02140028, "VSCP_TYPE_INFORMATION_LEVEL_CHANGED" },
+  { 0x02140029, "VSCP_TYPE_INFORMATION_WARNING" },
+  { 0x0214002A, "VSCP_TYPE_INFORMATION_STATE" },
+  { 0x0214002B, "VSCP_TYPE_INFORMATION_ACTION_TRIGGER" },
+  { 0x0214002C, "VSCP_TYPE_INFORMATION_SUNRISE" },
+  { 0x0214002D, "VSCP_TYPE_INFORMATION_SUNSET" },
+  { 0x0214002E, "VSCP_TYPE_INFORMATION_START_OF_RECORD" },
+  { 0x0214002F, "VSCP_TYPE_INFORMATION_END_OF_RECORD" },
+  { 0x02140030, "VSCP_TYPE_INFORMATION_PRESET_ACTIVE" },
+  { 0x02140031, "VSCP_TYPE_INFORMATION_DETECT" },
+  { 0x02140032, "VSCP_TYPE_INFORMATION_OVERFLOW" },
+  { 0x02140033, "VSCP_TYPE_INFORMATION_BIG_LEVEL_CHANGED" },
+  { 0x02140034, "VSCP_TYPE_INFORMATION_SUNRISE_TWILIGHT_START" },
+  { 0x02140035, "VSCP_TYPE_INFORMATION_SUNSET_TWILIGHT_START" },
+  { 0x02140036, "VSCP_TYPE_INFORMATION_NAUTICAL_SUNRISE_TWILIGHT_START" },
+  { 0x02140037, "VSCP_TYPE_INFORMATION_NAUTICAL_SUNSET_TWILIGHT_START" },
+  { 0x02140038, "VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNRISE_TWILIGHT_START" },
+  { 0x02140039, "VSCP_TYPE_INFORMATION_ASTRONOMICAL_SUNSET_TWILIGHT_START" },
+  { 0x0214003A, "VSCP_TYPE_INFORMATION_CALCULATED_NOON" },
+  { 0x0214003B, "VSCP_TYPE_INFORMATION_SHUTTER_UP" },
+  { 0x0214003C, "VSCP_TYPE_INFORMATION_SHUTTER_DOWN" },
+  { 0x0214003D, "VSCP_TYPE_INFORMATION_SHUTTER_LEFT" },
+  { 0x0214003E, "VSCP_TYPE_INFORMATION_SHUTTER_RIGHT" },
+  { 0x0214003F, "VSCP_TYPE_INFORMATION_SHUTTER_END_TOP" },
+  { 0x02140040, "VSCP_TYPE_INFORMATION_SHUTTER_END_BOTTOM" },
+  { 0x02140041, "VSCP_TYPE_INFORMATION_SHUTTER_END_MIDDLE" },
+  { 0x02140042, "VSCP_TYPE_INFORMATION_SHUTTER_END_PRESET" },
+  { 0x02140043, "VSCP_TYPE_INFORMATION_SHUTTER_END_LEFT" },
+  { 0x02140044, "VSCP_TYPE_INFORMATION_SHUTTER_END_RIGHT" },
+  { 0x02140045, "VSCP_TYPE_INFORMATION_LONG_CLICK" },
+  { 0x02140046, "VSCP_TYPE_INFORMATION_SINGLE_CLICK" },
+  { 0x02140047, "VSCP_TYPE_INFORMATION_DOUBLE_CLICK" },
+  { 0x02140048, "VSCP_TYPE_INFORMATION_DATE" },
+  { 0x02140049, "VSCP_TYPE_INFORMATION_TIME" },
+  { 0x0214004A, "VSCP_TYPE_INFORMATION_WEEKDAY" },
+  { 0x0214004B, "VSCP_TYPE_INFORMATION_LOCK" },
+  { 0x0214004C, "VSCP_TYPE_INFORMATION_UNLOCK" },
+  { 0x0214004D, "VSCP_TYPE_INFORMATION_DATETIME" },
+  { 0x0214004E, "VSCP_TYPE_INFORMATION_RISING" },
+  { 0x0214004F, "VSCP_TYPE_INFORMATION_FALLING" },
+  { 0x02140050, "VSCP_TYPE_INFORMATION_UPDATED" },
+  { 0x02140051, "VSCP_TYPE_INFORMATION_CONNECT" },
+  { 0x02140052, "VSCP_TYPE_INFORMATION_DISCONNECT" },
+  { 0x02140053, "VSCP_TYPE_INFORMATION_RECONNECT" },
+  { 0x02140054, "VSCP_TYPE_INFORMATION_ENTER" },
+  { 0x02140055, "VSCP_TYPE_INFORMATION_EXIT" },
+  { 0x02140056, "VSCP_TYPE_INFORMATION_INCREMENTED" },
+  { 0x02140057, "VSCP_TYPE_INFORMATION_DECREMENTED" },
+  { 0x02140058, "VSCP_TYPE_INFORMATION_PROXIMITY_DETECTED" },
+  { 0x021E0000, "VSCP_TYPE_CONTROL_GENERAL" },
+  { 0x021E0001, "VSCP_TYPE_CONTROL_MUTE" },
+  { 0x021E0002, "VSCP_TYPE_CONTROL_ALL_LAMPS" },
+  { 0x021E0003, "VSCP_TYPE_CONTROL_OPEN" },
+  { 0x021E0004, "VSCP_TYPE_CONTROL_CLOSE" },
+  { 0x021E0005, "VSCP_TYPE_CONTROL_TURNON" },
+  { 0x021E0006, "VSCP_TYPE_CONTROL_TURNOFF" },
+  { 0x021E0007, "VSCP_TYPE_CONTROL_START" },
+  { 0x021E0008, "VSCP_TYPE_CONTROL_STOP" },
+  { 0x021E0009, "VSCP_TYPE_CONTROL_RESET" },
+  { 0x021E000A, "VSCP_TYPE_CONTROL_INTERRUPT" },
+  { 0x021E000B, "VSCP_TYPE_CONTROL_SLEEP" },
+  { 0x021E000C, "VSCP_TYPE_CONTROL_WAKEUP" },
+  { 0x021E000D, "VSCP_TYPE_CONTROL_RESUME" },
+  { 0x021E000E, "VSCP_TYPE_CONTROL_PAUSE" },
+  { 0x021E000F, "VSCP_TYPE_CONTROL_ACTIVATE" },
+  { 0x021E0010, "VSCP_TYPE_CONTROL_DEACTIVATE" },
+  { 0x021E0011, "VSCP_TYPE_CONTROL_RESERVED17" },
+  { 0x021E0012, "VSCP_TYPE_CONTROL_RESERVED18" },
+  { 0x021E0013, "VSCP_TYPE_CONTROL_RESERVED19" },
+  { 0x021E0014, "VSCP_TYPE_CONTROL_DIM_LAMPS" },
+  { 0x021E0015, "VSCP_TYPE_CONTROL_CHANGE_CHANNEL" },
+  { 0x021E0016, "VSCP_TYPE_CONTROL_CHANGE_LEVEL" },
+  { 0x021E0017, "VSCP_TYPE_CONTROL_RELATIVE_CHANGE_LEVEL" },
+  { 0x021E0018, "VSCP_TYPE_CONTROL_MEASUREMENT_REQUEST" },
+  { 0x021E0019, "VSCP_TYPE_CONTROL_STREAM_DATA" },
+  { 0x021E001A, "VSCP_TYPE_CONTROL_SYNC" },
+  { 0x021E001B, "VSCP_TYPE_CONTROL_ZONED_STREAM_DATA" },
+  { 0x021E001C, "VSCP_TYPE_CONTROL_SET_PRESET" },
+  { 0x021E001D, "VSCP_TYPE_CONTROL_TOGGLE_STATE" },
+  { 0x021E001E, "VSCP_TYPE_CONTROL_TIMED_PULSE_ON" },
+  { 0x021E001F, "VSCP_TYPE_CONTROL_TIMED_PULSE_OFF" },
+  { 0x021E0020, "VSCP_TYPE_CONTROL_SET_COUNTRY_LANGUAGE" },
+  { 0x021E0021, "VSCP_TYPE_CONTROL_BIG_CHANGE_LEVEL" },
+  { 0x021E0022, "VSCP_TYPE_CONTROL_SHUTTER_UP" },
+  { 0x021E0023, "VSCP_TYPE_CONTROL_SHUTTER_DOWN" },
+  { 0x021E0024, "VSCP_TYPE_CONTROL_SHUTTER_LEFT" },
+  { 0x021E0025, "VSCP_TYPE_CONTROL_SHUTTER_RIGHT" },
+  { 0x021E0026, "VSCP_TYPE_CONTROL_SHUTTER_MIDDLE" },
+  { 0x021E0027, "VSCP_TYPE_CONTROL_SHUTTER_PRESET" },
+  { 0x021E0028, "VSCP_TYPE_CONTROL_ALL_LAMPS_ON" },
+  { 0x021E0029, "VSCP_TYPE_CONTROL_ALL_LAMPS_OFF" },
+  { 0x021E002A, "VSCP_TYPE_CONTROL_LOCK" },
+  { 0x021E002B, "VSCP_TYPE_CONTROL_UNLOCK" },
+  { 0x021E002C, "VSCP_TYPE_CONTROL_PWM" },
+  { 0x021E002D, "VSCP_TYPE_CONTROL_TOKEN_LOCK" },
+  { 0x021E002E, "VSCP_TYPE_CONTROL_TOKEN_UNLOCK" },
+  { 0x021E002F, "VSCP_TYPE_CONTROL_SET_SECURITY_LEVEL" },
+  { 0x021E0030, "VSCP_TYPE_CONTROL_SET_SECURITY_PIN" },
+  { 0x021E0031, "VSCP_TYPE_CONTROL_SET_SECURITY_PASSWORD" },
+  { 0x021E0032, "VSCP_TYPE_CONTROL_SET_SECURITY_TOKEN" },
+  { 0x021E0033, "VSCP_TYPE_CONTROL_REQUEST_SECURITY_TOKEN" },
+  { 0x021E0034, "VSCP_TYPE_CONTROL_INCREMENT" },
+  { 0x021E0035, "VSCP_TYPE_CONTROL_DECREMENT" },
+  { 0x02280000, "VSCP_TYPE_MULTIMEDIA_GENERAL" },
+  { 0x02280001, "VSCP_TYPE_MULTIMEDIA_PLAYBACK" },
+  { 0x02280002, "VSCP_TYPE_MULTIMEDIA_NAVIGATOR_KEY_ENG" },
+  { 0x02280003, "VSCP_TYPE_MULTIMEDIA_ADJUST_CONTRAST" },
+  { 0x02280004, "VSCP_TYPE_MULTIMEDIA_ADJUST_FOCUS" },
+  { 0x02280005, "VSCP_TYPE_MULTIMEDIA_ADJUST_TINT" },
+  { 0x02280006, "VSCP_TYPE_MULTIMEDIA_ADJUST_COLOUR_BALANCE" },
+  { 0x02280007, "VSCP_TYPE_MULTIMEDIA_ADJUST_BRIGHTNESS" },
+  { 0x02280008, "VSCP_TYPE_MULTIMEDIA_ADJUST_HUE" },
+  { 0x02280009, "VSCP_TYPE_MULTIMEDIA_ADJUST_BASS" },
+  { 0x0228000A, "VSCP_TYPE_MULTIMEDIA_ADJUST_TREBLE" },
+  { 0x0228000B, "VSCP_TYPE_MULTIMEDIA_ADJUST_MASTER_VOLUME" },
+  { 0x0228000C, "VSCP_TYPE_MULTIMEDIA_ADJUST_FRONT_VOLUME" },
+  { 0x0228000D, "VSCP_TYPE_MULTIMEDIA_ADJUST_CENTRE_VOLUME" },
+  { 0x0228000E, "VSCP_TYPE_MULTIMEDIA_ADJUST_REAR_VOLUME" },
+  { 0x0228000F, "VSCP_TYPE_MULTIMEDIA_ADJUST_SIDE_VOLUME" },
+  { 0x02280010, "VSCP_TYPE_MULTIMEDIA_RESERVED16" },
+  { 0x02280011, "VSCP_TYPE_MULTIMEDIA_RESERVED17" },
+  { 0x02280012, "VSCP_TYPE_MULTIMEDIA_RESERVED18" },
+  { 0x02280013, "VSCP_TYPE_MULTIMEDIA_RESERVED19" },
+  { 0x02280014, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_DISK" },
+  { 0x02280015, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_TRACK" },
+  { 0x02280016, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_ALBUM" },
+  { 0x02280017, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_CHANNEL" },
+  { 0x02280018, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_PAGE" },
+  { 0x02280019, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_CHAPTER" },
+  { 0x0228001A, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_SCREEN_FORMAT" },
+  { 0x0228001B, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_INPUT_SOURCE" },
+  { 0x0228001C, "VSCP_TYPE_MULTIMEDIA_ADJUST_SELECT_OUTPUT" },
+  { 0x0228001D, "VSCP_TYPE_MULTIMEDIA_RECORD" },
+  { 0x0228001E, "VSCP_TYPE_MULTIMEDIA_SET_RECORDING_VOLUME" },
+  { 0x02280028, "VSCP_TYPE_MULTIMEDIA_TIVO_FUNCTION" },
+  { 0x02280032, "VSCP_TYPE_MULTIMEDIA_GET_CURRENT_TITLE" },
+  { 0x02280033, "VSCP_TYPE_MULTIMEDIA_SET_POSITION" },
+  { 0x02280034, "VSCP_TYPE_MULTIMEDIA_GET_MEDIA_INFO" },
+  { 0x02280035, "VSCP_TYPE_MULTIMEDIA_REMOVE_ITEM" },
+  { 0x02280036, "VSCP_TYPE_MULTIMEDIA_REMOVE_ALL_ITEMS" },
+  { 0x02280037, "VSCP_TYPE_MULTIMEDIA_SAVE_ALBUM" },
+  { 0x0228003C, "VSCP_TYPE_MULTIMEDIA_CONTROL" },
+  { 0x0228003D, "VSCP_TYPE_MULTIMEDIA_CONTROL_RESPONSE" },
+  { 0x02320000, "VSCP_TYPE_AOL_GENERAL" },
+  { 0x02320001, "VSCP_TYPE_AOL_UNPLUGGED_POWER" },
+  { 0x02320002, "VSCP_TYPE_AOL_UNPLUGGED_LAN" },
+  { 0x02320003, "VSCP_TYPE_AOL_CHASSIS_INTRUSION" },
+  { 0x02320004, "VSCP_TYPE_AOL_PROCESSOR_REMOVAL" },
+  { 0x02320005, "VSCP_TYPE_AOL_ENVIRONMENT_ERROR" },
+  { 0x02320006, "VSCP_TYPE_AOL_HIGH_TEMPERATURE" },
+  { 0x02320007, "VSCP_TYPE_AOL_FAN_SPEED" },
+  { 0x02320008, "VSCP_TYPE_AOL_VOLTAGE_FLUCTUATIONS" },
+  { 0x02320009, "VSCP_TYPE_AOL_OS_ERROR" },
+  { 0x0232000A, "VSCP_TYPE_AOL_POWER_ON_ERROR" },
+  { 0x0232000B, "VSCP_TYPE_AOL_SYSTEM_HUNG" },
+  { 0x0232000C, "VSCP_TYPE_AOL_COMPONENT_FAILURE" },
+  { 0x0232000D, "VSCP_TYPE_AOL_REBOOT_UPON_FAILURE" },
+  { 0x0232000E, "VSCP_TYPE_AOL_REPAIR_OPERATING_SYSTEM" },
+  { 0x0232000F, "VSCP_TYPE_AOL_UPDATE_BIOS_IMAGE" },
+  { 0x02320010, "VSCP_TYPE_AOL_UPDATE_DIAGNOSTIC_PROCEDURE" },
+  { 0x023C0000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x023C0001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x023C0002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x023C0003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x023C0004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x023C0005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x023C0006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x023C0007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x023C0008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x023C0009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x023C000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x023C000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x023C000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x023C000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x023C000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x023C000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x023C0010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x023C0011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x023C0012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x023C0013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x023C0014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x023C0015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x023C0016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x023C0017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x023C0018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x023C0019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x023C001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x023C001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x023C001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x023C001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x023C001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x023C001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x023C0020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x023C0021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x023C0022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x023C0023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x023C0024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x023C0025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x023C0026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x023C0027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x023C0028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x023C0029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x023C002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x023C002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x023C002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x023C002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x023C002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x023C002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x023C0030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x023C0031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x023C0032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x023C0033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x023C0034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x023C0035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x023C0036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x023C0037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x023C0038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x023C0039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x023C003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x023C003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x023C003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x023C003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x023C003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x023C003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x023C0040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x023C0041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x023D0000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x023E0000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x023F0000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x02400000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x02410000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x02410001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x02410002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x02410003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x02410004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x02410005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x02410006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x02410007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x02410008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x02410009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x0241000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x0241000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x0241000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x0241000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x0241000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x0241000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x02410010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x02410011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x02410012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x02410013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x02410014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x02410015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x02410016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x02410017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x02410018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x02410019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x0241001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x0241001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x0241001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x0241001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x0241001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x0241001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x02410020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x02410021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x02410022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x02410023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x02410024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x02410025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x02410026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x02410027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x02410028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x02410029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x0241002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x0241002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x0241002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x0241002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x0241002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x0241002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x02410030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x02410031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x02410032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x02410033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x02410034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x02410035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x02410036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x02410037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x02410038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x02410039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x0241003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x0241003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x0241003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x0241003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x0241003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x0241003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x02410040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x02410041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x02420000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x02430000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x02440000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x02450000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x02460000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x02460001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x02460002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x02460003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x02460004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x02460005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x02460006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x02460007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x02460008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x02460009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x0246000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x0246000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x0246000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x0246000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x0246000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x0246000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x02460010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x02460011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x02460012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x02460013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x02460014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x02460015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x02460016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x02460017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x02460018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x02460019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x0246001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x0246001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x0246001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x0246001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x0246001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x0246001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x02460020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x02460021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x02460022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x02460023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x02460024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x02460025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x02460026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x02460027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x02460028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x02460029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x0246002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x0246002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x0246002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x0246002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x0246002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x0246002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x02460030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x02460031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x02460032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x02460033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x02460034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x02460035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x02460036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x02460037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x02460038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x02460039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x0246003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x0246003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x0246003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x0246003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x0246003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x0246003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x02460040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x02460041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x02470000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x02480000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x02490000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x024A0000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x02550000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x02550001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x02550002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x02550003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x02550004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x02550005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x02550006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x02550007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x02550008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x02550009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x0255000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x0255000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x0255000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x0255000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x0255000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x0255000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x02550010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x02550011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x02550012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x02550013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x02550014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x02550015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x02550016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x02550017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x02550018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x02550019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x0255001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x0255001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x0255001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x0255001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x0255001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x0255001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x02550020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x02550021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x02550022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x02550023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x02550024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x02550025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x02550026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x02550027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x02550028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x02550029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x0255002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x0255002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x0255002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x0255002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x0255002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x0255002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x02550030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x02550031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x02550032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x02550033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x02550034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x02550035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x02550036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x02550037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x02550038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x02550039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x0255003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x0255003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x0255003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x0255003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x0255003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x0255003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x02550040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x02550041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x02560000, "VSCP_TYPE_MEASUREMENTX1_GENERAL" },
+  { 0x02570000, "VSCP_TYPE_MEASUREMENTX2_GENERAL" },
+  { 0x02580000, "VSCP_TYPE_MEASUREMENTX3_GENERAL" },
+  { 0x02590000, "VSCP_TYPE_MEASUREMENTX4_GENERAL" },
+  { 0x025A0000, "VSCP_TYPE_WEATHER_GENERAL" },
+  { 0x025A0001, "VSCP_TYPE_WEATHER_SEASONS_WINTER" },
+  { 0x025A0002, "VSCP_TYPE_WEATHER_SEASONS_SPRING" },
+  { 0x025A0003, "VSCP_TYPE_WEATHER_SEASONS_SUMMER" },
+  { 0x025A0004, "VSCP_TYPE_WEATHER_SEASONS_AUTUMN" },
+  { 0x025A0005, "VSCP_TYPE_WEATHER_WIND_NONE" },
+  { 0x025A0006, "VSCP_TYPE_WEATHER_WIND_LOW" },
+  { 0x025A0007, "VSCP_TYPE_WEATHER_WIND_MEDIUM" },
+  { 0x025A0008, "VSCP_TYPE_WEATHER_WIND_HIGH" },
+  { 0x025A0009, "VSCP_TYPE_WEATHER_WIND_VERY_HIGH" },
+  { 0x025A000A, "VSCP_TYPE_WEATHER_AIR_FOGGY" },
+  { 0x025A000B, "VSCP_TYPE_WEATHER_AIR_FREEZING" },
+  { 0x025A000C, "VSCP_TYPE_WEATHER_AIR_VERY_COLD" },
+  { 0x025A000D, "VSCP_TYPE_WEATHER_AIR_COLD" },
+  { 0x025A000E, "VSCP_TYPE_WEATHER_AIR_NORMAL" },
+  { 0x025A000F, "VSCP_TYPE_WEATHER_AIR_HOT" },
+  { 0x025A0010, "VSCP_TYPE_WEATHER_AIR_VERY_HOT" },
+  { 0x025A0011, "VSCP_TYPE_WEATHER_AIR_POLLUTION_LOW" },
+  { 0x025A0012, "VSCP_TYPE_WEATHER_AIR_POLLUTION_MEDIUM" },
+  { 0x025A0013, "VSCP_TYPE_WEATHER_AIR_POLLUTION_HIGH" },
+  { 0x025A0014, "VSCP_TYPE_WEATHER_AIR_HUMID" },
+  { 0x025A0015, "VSCP_TYPE_WEATHER_AIR_DRY" },
+  { 0x025A0016, "VSCP_TYPE_WEATHER_SOIL_HUMID" },
+  { 0x025A0017, "VSCP_TYPE_WEATHER_SOIL_DRY" },
+  { 0x025A0018, "VSCP_TYPE_WEATHER_RAIN_NONE" },
+  { 0x025A0019, "VSCP_TYPE_WEATHER_RAIN_LIGHT" },
+  { 0x025A001A, "VSCP_TYPE_WEATHER_RAIN_HEAVY" },
+  { 0x025A001B, "VSCP_TYPE_WEATHER_RAIN_VERY_HEAVY" },
+  { 0x025A001C, "VSCP_TYPE_WEATHER_SUN_NONE" },
+  { 0x025A001D, "VSCP_TYPE_WEATHER_SUN_LIGHT" },
+  { 0x025A001E, "VSCP_TYPE_WEATHER_SUN_HEAVY" },
+  { 0x025A001F, "VSCP_TYPE_WEATHER_SNOW_NONE" },
+  { 0x025A0020, "VSCP_TYPE_WEATHER_SNOW_LIGHT" },
+  { 0x025A0021, "VSCP_TYPE_WEATHER_SNOW_HEAVY" },
+  { 0x025A0022, "VSCP_TYPE_WEATHER_DEW_POINT" },
+  { 0x025A0023, "VSCP_TYPE_WEATHER_STORM" },
+  { 0x025A0024, "VSCP_TYPE_WEATHER_FLOOD" },
+  { 0x025A0025, "VSCP_TYPE_WEATHER_EARTHQUAKE" },
+  { 0x025A0026, "VSCP_TYPE_WEATHER_NUCLEAR_DISASTER" },
+  { 0x025A0027, "VSCP_TYPE_WEATHER_FIRE" },
+  { 0x025A0028, "VSCP_TYPE_WEATHER_LIGHTNING" },
+  { 0x025A0029, "VSCP_TYPE_WEATHER_UV_RADIATION_LOW" },
+  { 0x025A002A, "VSCP_TYPE_WEATHER_UV_RADIATION_MEDIUM" },
+  { 0x025A002B, "VSCP_TYPE_WEATHER_UV_RADIATION_NORMAL" },
+  { 0x025A002C, "VSCP_TYPE_WEATHER_UV_RADIATION_HIGH" },
+  { 0x025A002D, "VSCP_TYPE_WEATHER_UV_RADIATION_VERY_HIGH" },
+  { 0x025A002E, "VSCP_TYPE_WEATHER_WARNING_LEVEL1" },
+  { 0x025A002F, "VSCP_TYPE_WEATHER_WARNING_LEVEL2" },
+  { 0x025A0030, "VSCP_TYPE_WEATHER_WARNING_LEVEL3" },
+  { 0x025A0031, "VSCP_TYPE_WEATHER_WARNING_LEVEL4" },
+  { 0x025A0032, "VSCP_TYPE_WEATHER_WARNING_LEVEL5" },
+  { 0x025A0033, "VSCP_TYPE_WEATHER_ARMAGEDON" },
+  { 0x025A0034, "VSCP_TYPE_WEATHER_UV_INDEX" },
+  { 0x025F0000, "VSCP_TYPE_WEATHER_GENERAL" },
+  { 0x025F0001, "VSCP_TYPE_WEATHER_SEASONS_WINTER" },
+  { 0x025F0002, "VSCP_TYPE_WEATHER_SEASONS_SPRING" },
+  { 0x025F0003, "VSCP_TYPE_WEATHER_SEASONS_SUMMER" },
+  { 0x025F0004, "VSCP_TYPE_WEATHER_SEASONS_AUTUMN" },
+  { 0x025F0005, "VSCP_TYPE_WEATHER_WIND_NONE" },
+  { 0x025F0006, "VSCP_TYPE_WEATHER_WIND_LOW" },
+  { 0x025F0007, "VSCP_TYPE_WEATHER_WIND_MEDIUM" },
+  { 0x025F0008, "VSCP_TYPE_WEATHER_WIND_HIGH" },
+  { 0x025F0009, "VSCP_TYPE_WEATHER_WIND_VERY_HIGH" },
+  { 0x025F000A, "VSCP_TYPE_WEATHER_AIR_FOGGY" },
+  { 0x025F000B, "VSCP_TYPE_WEATHER_AIR_FREEZING" },
+  { 0x025F000C, "VSCP_TYPE_WEATHER_AIR_VERY_COLD" },
+  { 0x025F000D, "VSCP_TYPE_WEATHER_AIR_COLD" },
+  { 0x025F000E, "VSCP_TYPE_WEATHER_AIR_NORMAL" },
+  { 0x025F000F, "VSCP_TYPE_WEATHER_AIR_HOT" },
+  { 0x025F0010, "VSCP_TYPE_WEATHER_AIR_VERY_HOT" },
+  { 0x025F0011, "VSCP_TYPE_WEATHER_AIR_POLLUTION_LOW" },
+  { 0x025F0012, "VSCP_TYPE_WEATHER_AIR_POLLUTION_MEDIUM" },
+  { 0x025F0013, "VSCP_TYPE_WEATHER_AIR_POLLUTION_HIGH" },
+  { 0x025F0014, "VSCP_TYPE_WEATHER_AIR_HUMID" },
+  { 0x025F0015, "VSCP_TYPE_WEATHER_AIR_DRY" },
+  { 0x025F0016, "VSCP_TYPE_WEATHER_SOIL_HUMID" },
+  { 0x025F0017, "VSCP_TYPE_WEATHER_SOIL_DRY" },
+  { 0x025F0018, "VSCP_TYPE_WEATHER_RAIN_NONE" },
+  { 0x025F0019, "VSCP_TYPE_WEATHER_RAIN_LIGHT" },
+  { 0x025F001A, "VSCP_TYPE_WEATHER_RAIN_HEAVY" },
+  { 0x025F001B, "VSCP_TYPE_WEATHER_RAIN_VERY_HEAVY" },
+  { 0x025F001C, "VSCP_TYPE_WEATHER_SUN_NONE" },
+  { 0x025F001D, "VSCP_TYPE_WEATHER_SUN_LIGHT" },
+  { 0x025F001E, "VSCP_TYPE_WEATHER_SUN_HEAVY" },
+  { 0x025F001F, "VSCP_TYPE_WEATHER_SNOW_NONE" },
+  { 0x025F0020, "VSCP_TYPE_WEATHER_SNOW_LIGHT" },
+  { 0x025F0021, "VSCP_TYPE_WEATHER_SNOW_HEAVY" },
+  { 0x025F0022, "VSCP_TYPE_WEATHER_DEW_POINT" },
+  { 0x025F0023, "VSCP_TYPE_WEATHER_STORM" },
+  { 0x025F0024, "VSCP_TYPE_WEATHER_FLOOD" },
+  { 0x025F0025, "VSCP_TYPE_WEATHER_EARTHQUAKE" },
+  { 0x025F0026, "VSCP_TYPE_WEATHER_NUCLEAR_DISASTER" },
+  { 0x025F0027, "VSCP_TYPE_WEATHER_FIRE" },
+  { 0x025F0028, "VSCP_TYPE_WEATHER_LIGHTNING" },
+  { 0x025F0029, "VSCP_TYPE_WEATHER_UV_RADIATION_LOW" },
+  { 0x025F002A, "VSCP_TYPE_WEATHER_UV_RADIATION_MEDIUM" },
+  { 0x025F002B, "VSCP_TYPE_WEATHER_UV_RADIATION_NORMAL" },
+  { 0x025F002C, "VSCP_TYPE_WEATHER_UV_RADIATION_HIGH" },
+  { 0x025F002D, "VSCP_TYPE_WEATHER_UV_RADIATION_VERY_HIGH" },
+  { 0x025F002E, "VSCP_TYPE_WEATHER_WARNING_LEVEL1" },
+  { 0x025F002F, "VSCP_TYPE_WEATHER_WARNING_LEVEL2" },
+  { 0x025F0030, "VSCP_TYPE_WEATHER_WARNING_LEVEL3" },
+  { 0x025F0031, "VSCP_TYPE_WEATHER_WARNING_LEVEL4" },
+  { 0x025F0032, "VSCP_TYPE_WEATHER_WARNING_LEVEL5" },
+  { 0x025F0033, "VSCP_TYPE_WEATHER_ARMAGEDON" },
+  { 0x025F0034, "VSCP_TYPE_WEATHER_UV_INDEX" },
+  { 0x02640000, "VSCP_TYPE_PHONE_GENERAL" },
+  { 0x02640001, "VSCP_TYPE_PHONE_INCOMING_CALL" },
+  { 0x02640002, "VSCP_TYPE_PHONE_OUTGOING_CALL" },
+  { 0x02640003, "VSCP_TYPE_PHONE_RING" },
+  { 0x02640004, "VSCP_TYPE_PHONE_ANSWER" },
+  { 0x02640005, "VSCP_TYPE_PHONE_HANGUP" },
+  { 0x02640006, "VSCP_TYPE_PHONE_GIVEUP" },
+  { 0x02640007, "VSCP_TYPE_PHONE_TRANSFER" },
+  { 0x02640008, "VSCP_TYPE_PHONE_DATABASE_INFO" },
+  { 0x02660000, "VSCP_TYPE_DISPLAY_GENERAL" },
+  { 0x02660001, "VSCP_TYPE_DISPLAY_CLEAR_DISPLAY" },
+  { 0x02660002, "VSCP_TYPE_DISPLAY_POSITION_CURSOR" },
+  { 0x02660003, "VSCP_TYPE_DISPLAY_WRITE_DISPLAY" },
+  { 0x02660004, "VSCP_TYPE_DISPLAY_WRITE_DISPLAY_BUFFER" },
+  { 0x02660005, "VSCP_TYPE_DISPLAY_SHOW_DISPLAY_BUFFER" },
+  { 0x02660006, "VSCP_TYPE_DISPLAY_SET_DISPLAY_BUFFER_PARAM" },
+  { 0x02660020, "VSCP_TYPE_DISPLAY_SHOW_TEXT" },
+  { 0x02660030, "VSCP_TYPE_DISPLAY_SHOW_LED" },
+  { 0x02660031, "VSCP_TYPE_DISPLAY_SHOW_LED_COLOR" },
+  { 0x026E0000, "VSCP_TYPE_REMOTE_GENERAL" },
+  { 0x026E0001, "VSCP_TYPE_REMOTE_RC5" },
+  { 0x026E0003, "VSCP_TYPE_REMOTE_SONY12" },
+  { 0x026E0020, "VSCP_TYPE_REMOTE_LIRC" },
+  { 0x026E0030, "VSCP_TYPE_REMOTE_VSCP" },
+  { 0x026E0031, "VSCP_TYPE_REMOTE_MAPITO" },
+  { 0x02CE0000, "VSCP_TYPE_GNSS_GENERAL" },
+  { 0x02CE0001, "VSCP_TYPE_GNSS_POSITION" },
+  { 0x02CE0002, "VSCP_TYPE_GNSS_SATELLITES" },
+  { 0x02D40000, "VSCP_TYPE_WIRELESS_GENERAL" },
+  { 0x02D40001, "VSCP_TYPE_WIRELESS_GSM_CELL" },
+  { 0x03FA0000, "VSCP_TYPE_DIAGNOSTIC_GENERAL" },
+  { 0x03FA0001, "VSCP_TYPE_DIAGNOSTIC_OVERVOLTAGE" },
+  { 0x03FA0002, "VSCP_TYPE_DIAGNOSTIC_UNDERVOLTAGE" },
+  { 0x03FA0003, "VSCP_TYPE_DIAGNOSTIC_VBUS_LOW" },
+  { 0x03FA0004, "VSCP_TYPE_DIAGNOSTIC_BATTERY_LOW" },
+  { 0x03FA0005, "VSCP_TYPE_DIAGNOSTIC_BATTERY_FULL" },
+  { 0x03FA0006, "VSCP_TYPE_DIAGNOSTIC_BATTERY_ERROR" },
+  { 0x03FA0007, "VSCP_TYPE_DIAGNOSTIC_BATTERY_OK" },
+  { 0x03FA0008, "VSCP_TYPE_DIAGNOSTIC_OVERCURRENT" },
+  { 0x03FA0009, "VSCP_TYPE_DIAGNOSTIC_CIRCUIT_ERROR" },
+  { 0x03FA000A, "VSCP_TYPE_DIAGNOSTIC_SHORT_CIRCUIT" },
+  { 0x03FA000B, "VSCP_TYPE_DIAGNOSTIC_OPEN_CIRCUIT" },
+  { 0x03FA000C, "VSCP_TYPE_DIAGNOSTIC_MOIST" },
+  { 0x03FA000D, "VSCP_TYPE_DIAGNOSTIC_WIRE_FAIL" },
+  { 0x03FA000E, "VSCP_TYPE_DIAGNOSTIC_WIRELESS_FAIL" },
+  { 0x03FA000F, "VSCP_TYPE_DIAGNOSTIC_IR_FAIL" },
+  { 0x03FA0010, "VSCP_TYPE_DIAGNOSTIC_1WIRE_FAIL" },
+  { 0x03FA0011, "VSCP_TYPE_DIAGNOSTIC_RS222_FAIL" },
+  { 0x03FA0012, "VSCP_TYPE_DIAGNOSTIC_RS232_FAIL" },
+  { 0x03FA0013, "VSCP_TYPE_DIAGNOSTIC_RS423_FAIL" },
+  { 0x03FA0014, "VSCP_TYPE_DIAGNOSTIC_RS485_FAIL" },
+  { 0x03FA0015, "VSCP_TYPE_DIAGNOSTIC_CAN_FAIL" },
+  { 0x03FA0016, "VSCP_TYPE_DIAGNOSTIC_LAN_FAIL" },
+  { 0x03FA0017, "VSCP_TYPE_DIAGNOSTIC_USB_FAIL" },
+  { 0x03FA0018, "VSCP_TYPE_DIAGNOSTIC_WIFI_FAIL" },
+  { 0x03FA0019, "VSCP_TYPE_DIAGNOSTIC_NFC_RFID_FAIL" },
+  { 0x03FA001A, "VSCP_TYPE_DIAGNOSTIC_LOW_SIGNAL" },
+  { 0x03FA001B, "VSCP_TYPE_DIAGNOSTIC_HIGH_SIGNAL" },
+  { 0x03FA001C, "VSCP_TYPE_DIAGNOSTIC_ADC_FAIL" },
+  { 0x03FA001D, "VSCP_TYPE_DIAGNOSTIC_ALU_FAIL" },
+  { 0x03FA001E, "VSCP_TYPE_DIAGNOSTIC_ASSERT" },
+  { 0x03FA001F, "VSCP_TYPE_DIAGNOSTIC_DAC_FAIL" },
+  { 0x03FA0020, "VSCP_TYPE_DIAGNOSTIC_DMA_FAIL" },
+  { 0x03FA0021, "VSCP_TYPE_DIAGNOSTIC_ETH_FAIL" },
+  { 0x03FA0022, "VSCP_TYPE_DIAGNOSTIC_EXCEPTION" },
+  { 0x03FA0023, "VSCP_TYPE_DIAGNOSTIC_FPU_FAIL" },
+  { 0x03FA0024, "VSCP_TYPE_DIAGNOSTIC_GPIO_FAIL" },
+  { 0x03FA0025, "VSCP_TYPE_DIAGNOSTIC_I2C_FAIL" },
+  { 0x03FA0026, "VSCP_TYPE_DIAGNOSTIC_I2S_FAIL" },
+  { 0x03FA0027, "VSCP_TYPE_DIAGNOSTIC_INVALID_CONFIG" },
+  { 0x03FA0028, "VSCP_TYPE_DIAGNOSTIC_MMU_FAIL" },
+  { 0x03FA0029, "VSCP_TYPE_DIAGNOSTIC_NMI" },
+  { 0x03FA002A, "VSCP_TYPE_DIAGNOSTIC_OVERHEAT" },
+  { 0x03FA002B, "VSCP_TYPE_DIAGNOSTIC_PLL_FAIL" },
+  { 0x03FA002C, "VSCP_TYPE_DIAGNOSTIC_POR_FAIL" },
+  { 0x03FA002D, "VSCP_TYPE_DIAGNOSTIC_PWM_FAIL" },
+  { 0x03FA002E, "VSCP_TYPE_DIAGNOSTIC_RAM_FAIL" },
+  { 0x03FA002F, "VSCP_TYPE_DIAGNOSTIC_ROM_FAIL" },
+  { 0x03FA0030, "VSCP_TYPE_DIAGNOSTIC_SPI_FAIL" },
+  { 0x03FA0031, "VSCP_TYPE_DIAGNOSTIC_STACK_FAIL" },
+  { 0x03FA0032, "VSCP_TYPE_DIAGNOSTIC_LIN_FAIL" },
+  { 0x03FA0033, "VSCP_TYPE_DIAGNOSTIC_UART_FAIL" },
+  { 0x03FA0034, "VSCP_TYPE_DIAGNOSTIC_UNHANDLED_INT" },
+  { 0x03FA0035, "VSCP_TYPE_DIAGNOSTIC_MEMORY_FAIL" },
+  { 0x03FA0036, "VSCP_TYPE_DIAGNOSTIC_VARIABLE_RANGE" },
+  { 0x03FA0037, "VSCP_TYPE_DIAGNOSTIC_WDT" },
+  { 0x03FA0038, "VSCP_TYPE_DIAGNOSTIC_EEPROM_FAIL" },
+  { 0x03FA0039, "VSCP_TYPE_DIAGNOSTIC_ENCRYPTION_FAIL" },
+  { 0x03FA003A, "VSCP_TYPE_DIAGNOSTIC_BAD_USER_INPUT" },
+  { 0x03FA003B, "VSCP_TYPE_DIAGNOSTIC_DECRYPTION_FAIL" },
+  { 0x03FA003C, "VSCP_TYPE_DIAGNOSTIC_NOISE" },
+  { 0x03FA003D, "VSCP_TYPE_DIAGNOSTIC_BOOTLOADER_FAIL" },
+  { 0x03FA003E, "VSCP_TYPE_DIAGNOSTIC_PROGRAMFLOW_FAIL" },
+  { 0x03FA003F, "VSCP_TYPE_DIAGNOSTIC_RTC_FAIL" },
+  { 0x03FA0040, "VSCP_TYPE_DIAGNOSTIC_SYSTEM_TEST_FAIL" },
+  { 0x03FA0041, "VSCP_TYPE_DIAGNOSTIC_SENSOR_FAIL" },
+  { 0x03FA0042, "VSCP_TYPE_DIAGNOSTIC_SAFESTATE" },
+  { 0x03FA0043, "VSCP_TYPE_DIAGNOSTIC_SIGNAL_IMPLAUSIBLE" },
+  { 0x03FA0044, "VSCP_TYPE_DIAGNOSTIC_STORAGE_FAIL" },
+  { 0x03FA0045, "VSCP_TYPE_DIAGNOSTIC_SELFTEST_FAIL" },
+  { 0x03FA0046, "VSCP_TYPE_DIAGNOSTIC_ESD_EMC_EMI" },
+  { 0x03FA0047, "VSCP_TYPE_DIAGNOSTIC_TIMEOUT" },
+  { 0x03FA0048, "VSCP_TYPE_DIAGNOSTIC_LCD_FAIL" },
+  { 0x03FA0049, "VSCP_TYPE_DIAGNOSTIC_TOUCHPANEL_FAIL" },
+  { 0x03FA004A, "VSCP_TYPE_DIAGNOSTIC_NOLOAD" },
+  { 0x03FA004B, "VSCP_TYPE_DIAGNOSTIC_COOLING_FAIL" },
+  { 0x03FA004C, "VSCP_TYPE_DIAGNOSTIC_HEATING_FAIL" },
+  { 0x03FA004D, "VSCP_TYPE_DIAGNOSTIC_TX_FAIL" },
+  { 0x03FA004E, "VSCP_TYPE_DIAGNOSTIC_RX_FAIL" },
+  { 0x03FA004F, "VSCP_TYPE_DIAGNOSTIC_EXT_IC_FAIL" },
+  { 0x03FA0050, "VSCP_TYPE_DIAGNOSTIC_CHARGING_ON" },
+  { 0x03FA0051, "VSCP_TYPE_DIAGNOSTIC_CHARGING_OFF" },
+  { 0x03FC0000, "VSCP_TYPE_ERROR_SUCCESS" },
+  { 0x03FC0001, "VSCP_TYPE_ERROR_ERROR" },
+  { 0x03FC0007, "VSCP_TYPE_ERROR_CHANNEL" },
+  { 0x03FC0008, "VSCP_TYPE_ERROR_FIFO_EMPTY" },
+  { 0x03FC0009, "VSCP_TYPE_ERROR_FIFO_FULL" },
+  { 0x03FC000A, "VSCP_TYPE_ERROR_FIFO_SIZE" },
+  { 0x03FC000B, "VSCP_TYPE_ERROR_FIFO_WAIT" },
+  { 0x03FC000C, "VSCP_TYPE_ERROR_GENERIC" },
+  { 0x03FC000D, "VSCP_TYPE_ERROR_HARDWARE" },
+  { 0x03FC000E, "VSCP_TYPE_ERROR_INIT_FAIL" },
+  { 0x03FC000F, "VSCP_TYPE_ERROR_INIT_MISSING" },
+  { 0x03FC0010, "VSCP_TYPE_ERROR_INIT_READY" },
+  { 0x03FC0011, "VSCP_TYPE_ERROR_NOT_SUPPORTED" },
+  { 0x03FC0012, "VSCP_TYPE_ERROR_OVERRUN" },
+  { 0x03FC0013, "VSCP_TYPE_ERROR_RCV_EMPTY" },
+  { 0x03FC0014, "VSCP_TYPE_ERROR_REGISTER" },
+  { 0x03FC0015, "VSCP_TYPE_ERROR_TRM_FULL" },
+  { 0x03FC001C, "VSCP_TYPE_ERROR_LIBRARY" },
+  { 0x03FC001D, "VSCP_TYPE_ERROR_PROCADDRESS" },
+  { 0x03FC001E, "VSCP_TYPE_ERROR_ONLY_ONE_INSTANCE" },
+  { 0x03FC001F, "VSCP_TYPE_ERROR_SUB_DRIVER" },
+  { 0x03FC0020, "VSCP_TYPE_ERROR_TIMEOUT" },
+  { 0x03FC0021, "VSCP_TYPE_ERROR_NOT_OPEN" },
+  { 0x03FC0022, "VSCP_TYPE_ERROR_PARAMETER" },
+  { 0x03FC0023, "VSCP_TYPE_ERROR_MEMORY" },
+  { 0x03FC0024, "VSCP_TYPE_ERROR_INTERNAL" },
+  { 0x03FC0025, "VSCP_TYPE_ERROR_COMMUNICATION" },
+  { 0x03FC0026, "VSCP_TYPE_ERROR_USER" },
+  { 0x03FC0027, "VSCP_TYPE_ERROR_PASSWORD" },
+  { 0x03FC0028, "VSCP_TYPE_ERROR_CONNECTION" },
+  { 0x03FC0029, "VSCP_TYPE_ERROR_INVALID_HANDLE" },
+  { 0x03FC002A, "VSCP_TYPE_ERROR_OPERATION_FAILED" },
+  { 0x03FC002B, "VSCP_TYPE_ERROR_BUFFER_SMALL" },
+  { 0x03FC002C, "VSCP_TYPE_ERROR_ITEM_UNKNOWN" },
+  { 0x03FC002D, "VSCP_TYPE_ERROR_NAME_USED" },
+  { 0x03FC002E, "VSCP_TYPE_ERROR_DATA_WRITE" },
+  { 0x03FC002F, "VSCP_TYPE_ERROR_ABORTED" },
+  { 0x03FC0030, "VSCP_TYPE_ERROR_INVALID_POINTER" },
+  { 0x03FD0000, "VSCP_TYPE_LOG_GENERAL" },
+  { 0x03FD0001, "VSCP_TYPE_LOG_MESSAGE" },
+  { 0x03FD0002, "VSCP_TYPE_LOG_START" },
+  { 0x03FD0003, "VSCP_TYPE_LOG_STOP" },
+  { 0x03FD0004, "VSCP_TYPE_LOG_LEVEL" },
+  { 0x03FE0000, "VSCP_TYPE_LABORATORY_GENERAL" },
+  { 0x03FF0000, "VSCP_TYPE_LOCAL_GENERAL" },
+  { 0x04000000, "VSCP2_TYPE_PROTOCOL_GENERAL" },
+  { 0x04000001, "VSCP2_TYPE_PROTOCOL_READ_REGISTER" },
+  { 0x04000002, "VSCP2_TYPE_PROTOCOL_WRITE_REGISTER" },
+  { 0x04000003, "VSCP2_TYPE_PROTOCOL_READ_WRITE_RESPONSE" },
+  { 0x04000014, "VSCP2_TYPE_PROTOCOL_HIGH_END_SERVER_CAPS" },
+  { 0x04000020, "VSCP2_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE" },
+  { 0x04000022, "VSCP2_TYPE_PROTOCOL_GET_MATRIX_INFO_RESPONSE" },
+  { 0x04000024, "VSCP2_TYPE_PROTOCOL_GET_EMBEDDED_MDF_RESPONSE" },
+  { 0x04000029, "VSCP2_TYPE_PROTOCOL_GET_EVENT_INTEREST_RESPONSE" },
+  { 0x04010000, "VSCP2_TYPE_CONTROL_GENERAL" },
+  { 0x04020000, "VSCP2_TYPE_INFORMATION_GENERAL" },
+  { 0x04020001, "VSCP2_TYPE_INFORMATION_TOKEN_ACTIVITY" },
+  { 0x04020002, "VSCP2_TYPE_INFORMATION_HEART_BEAT" },
+  { 0x04020003, "VSCP2_TYPE_INFORMATION_PROXY_HEART_BEAT" },
+  { 0x04020004, "VSCP2_TYPE_INFORMATION_CHANNEL_ANNOUNCE" },
+  { 0x04030000, "VSCP2_TYPE_TEXT2SPEECH_GENERAL" },
+  { 0x04030001, "VSCP2_TYPE_TEXT2SPEECH_TALK" },
+  { 0x04040000, "VSCP2_TYPE_HLO_GENERAL" },
+  { 0x04040001, "VSCP2_TYPE_HLO_COMMAND" },
+  { 0x04040002, "VSCP2_TYPE_HLO_RESPONSE" },
+  { 0x04050000, "VSCP2_TYPE_CUSTOM_GENERAL" },
+  { 0x04060000, "VSCP2_TYPE_DISPLAY_GENERAL" },
+  { 0x040A0000, "VSCP2_TYPE_SECURITY_GENERAL" },
+  { 0x040A0001, "VSCP2_TYPE_SECURITY_SETKEY" },
+  { 0x04100000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x04100001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x04100002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x04100003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x04100004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x04100005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x04100006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x04100007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x04100008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x04100009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x0410000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x0410000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x0410000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x0410000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x0410000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x0410000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x04100010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x04100011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x04100012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x04100013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x04100014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x04100015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x04100016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x04100017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x04100018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x04100019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x0410001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x0410001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x0410001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x0410001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x0410001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x0410001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x04100020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x04100021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x04100022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x04100023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x04100024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x04100025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x04100026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x04100027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x04100028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x04100029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x0410002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x0410002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x0410002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x0410002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x0410002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x0410002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x04100030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x04100031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x04100032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x04100033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x04100034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x04100035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x04100036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x04100037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x04100038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x04100039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x0410003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x0410003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x0410003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x0410003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x0410003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x0410003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x04100040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x04100041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0x04240000, "VSCP_TYPE_MEASUREMENT_GENERAL" },
+  { 0x04240001, "VSCP_TYPE_MEASUREMENT_COUNT" },
+  { 0x04240002, "VSCP_TYPE_MEASUREMENT_LENGTH" },
+  { 0x04240003, "VSCP_TYPE_MEASUREMENT_MASS" },
+  { 0x04240004, "VSCP_TYPE_MEASUREMENT_TIME" },
+  { 0x04240005, "VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT" },
+  { 0x04240006, "VSCP_TYPE_MEASUREMENT_TEMPERATURE" },
+  { 0x04240007, "VSCP_TYPE_MEASUREMENT_AMOUNT_OF_SUBSTANCE" },
+  { 0x04240008, "VSCP_TYPE_MEASUREMENT_INTENSITY_OF_LIGHT" },
+  { 0x04240009, "VSCP_TYPE_MEASUREMENT_FREQUENCY" },
+  { 0x0424000A, "VSCP_TYPE_MEASUREMENT_RADIOACTIVITY" },
+  { 0x0424000B, "VSCP_TYPE_MEASUREMENT_FORCE" },
+  { 0x0424000C, "VSCP_TYPE_MEASUREMENT_PRESSURE" },
+  { 0x0424000D, "VSCP_TYPE_MEASUREMENT_ENERGY" },
+  { 0x0424000E, "VSCP_TYPE_MEASUREMENT_POWER" },
+  { 0x0424000F, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CHARGE" },
+  { 0x04240010, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_POTENTIAL" },
+  { 0x04240011, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CAPACITANCE" },
+  { 0x04240012, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_RESISTANCE" },
+  { 0x04240013, "VSCP_TYPE_MEASUREMENT_ELECTRICAL_CONDUCTANCE" },
+  { 0x04240014, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FIELD_STRENGTH" },
+  { 0x04240015, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX" },
+  { 0x04240016, "VSCP_TYPE_MEASUREMENT_MAGNETIC_FLUX_DENSITY" },
+  { 0x04240017, "VSCP_TYPE_MEASUREMENT_INDUCTANCE" },
+  { 0x04240018, "VSCP_TYPE_MEASUREMENT_FLUX_OF_LIGHT" },
+  { 0x04240019, "VSCP_TYPE_MEASUREMENT_ILLUMINANCE" },
+  { 0x0424001A, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_ABSORBED" },
+  { 0x0424001B, "VSCP_TYPE_MEASUREMENT_CATALYTIC_ACITIVITY" },
+  { 0x0424001C, "VSCP_TYPE_MEASUREMENT_VOLUME" },
+  { 0x0424001D, "VSCP_TYPE_MEASUREMENT_SOUND_INTENSITY" },
+  { 0x0424001E, "VSCP_TYPE_MEASUREMENT_ANGLE" },
+  { 0x0424001F, "VSCP_TYPE_MEASUREMENT_POSITION" },
+  { 0x04240020, "VSCP_TYPE_MEASUREMENT_SPEED" },
+  { 0x04240021, "VSCP_TYPE_MEASUREMENT_ACCELERATION" },
+  { 0x04240022, "VSCP_TYPE_MEASUREMENT_TENSION" },
+  { 0x04240023, "VSCP_TYPE_MEASUREMENT_HUMIDITY" },
+  { 0x04240024, "VSCP_TYPE_MEASUREMENT_FLOW" },
+  { 0x04240025, "VSCP_TYPE_MEASUREMENT_THERMAL_RESISTANCE" },
+  { 0x04240026, "VSCP_TYPE_MEASUREMENT_REFRACTIVE_POWER" },
+  { 0x04240027, "VSCP_TYPE_MEASUREMENT_DYNAMIC_VISCOSITY" },
+  { 0x04240028, "VSCP_TYPE_MEASUREMENT_SOUND_IMPEDANCE" },
+  { 0x04240029, "VSCP_TYPE_MEASUREMENT_SOUND_RESISTANCE" },
+  { 0x0424002A, "VSCP_TYPE_MEASUREMENT_ELECTRIC_ELASTANCE" },
+  { 0x0424002B, "VSCP_TYPE_MEASUREMENT_LUMINOUS_ENERGY" },
+  { 0x0424002C, "VSCP_TYPE_MEASUREMENT_LUMINANCE" },
+  { 0x0424002D, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MOLAR" },
+  { 0x0424002E, "VSCP_TYPE_MEASUREMENT_CHEMICAL_CONCENTRATION_MASS" },
+  { 0x0424002F, "VSCP_TYPE_MEASUREMENT_DOSE_EQVIVALENT" },
+  { 0x04240030, "VSCP_TYPE_MEASUREMENT_RESERVED48" },
+  { 0x04240031, "VSCP_TYPE_MEASUREMENT_DEWPOINT" },
+  { 0x04240032, "VSCP_TYPE_MEASUREMENT_RELATIVE_LEVEL" },
+  { 0x04240033, "VSCP_TYPE_MEASUREMENT_ALTITUDE" },
+  { 0x04240034, "VSCP_TYPE_MEASUREMENT_AREA" },
+  { 0x04240035, "VSCP_TYPE_MEASUREMENT_RADIANT_INTENSITY" },
+  { 0x04240036, "VSCP_TYPE_MEASUREMENT_RADIANCE" },
+  { 0x04240037, "VSCP_TYPE_MEASUREMENT_IRRADIANCE" },
+  { 0x04240038, "VSCP_TYPE_MEASUREMENT_SPECTRAL_RADIANCE" },
+  { 0x04240039, "VSCP_TYPE_MEASUREMENT_SPECTRAL_IRRADIANCE" },
+  { 0x0424003A, "VSCP_TYPE_MEASUREMENT_SOUND_PRESSURE" },
+  { 0x0424003B, "VSCP_TYPE_MEASUREMENT_SOUND_DENSITY" },
+  { 0x0424003C, "VSCP_TYPE_MEASUREMENT_SOUND_LEVEL" },
+  { 0x0424003D, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EQ" },
+  { 0x0424003E, "VSCP_TYPE_MEASUREMENT_RADIATION_DOSE_EXPOSURE" },
+  { 0x0424003F, "VSCP_TYPE_MEASUREMENT_POWER_FACTOR" },
+  { 0x04240040, "VSCP_TYPE_MEASUREMENT_REACTIVE_POWER" },
+  { 0x04240041, "VSCP_TYPE_MEASUREMENT_REACTIVE_ENERGY" },
+  { 0xFFFF0000, "VSCP2_TYPE_VSCPD_GENERAL" },
+  { 0xFFFF0001, "VSCP2_TYPE_VSCPD_LOOP" },
+  { 0xFFFF0003, "VSCP2_TYPE_VSCPD_PAUSE" },
+  { 0xFFFF0004, "VSCP2_TYPE_VSCPD_ACTIVATE" },
+  { 0xFFFF0005, "VSCP2_TYPE_VSCPD_STARTING_UP" },
+  { 0xFFFF0006, "VSCP2_TYPE_VSCPD_SHUTTING_DOWN" },
+  { 0xFFFF0007, "VSCP2_TYPE_VSCPD_DRV3_START" },
+  { 0xFFFF0008, "VSCP2_TYPE_VSCPD_DRV3_STOP" },
+  { 0xFFFF0009, "VSCP2_TYPE_VSCPD_DRV3_PAUSE" },
+  { 0xFFFF000A, "VSCP2_TYPE_VSCPD_DRV3_RESUME" },
+  { 0xFFFF000B, "VSCP2_TYPE_VSCPD_DRV3_RESTART" },
+  { 0xFFFF000C, "VSCP2_TYPE_VSCPD_DRV3_CONFIG" },
+};
+
+// Index into vscp_type_tokens sorted on token (and id for equal tokens)
+static constexpr uint16_t vscp_type_token_index[] = {
+  1865, 1876, 1877, 1874, 1873, 1875, 1870, 1866, 1868, 1869, 1867, 1856,
+  1863, 1864, 1862, 1860, 1857, 1859, 1861, 1858, 1878, 1879, 1871, 1872,
+  2015, 2023, 2020, 2022, 2021, 2018, 2019, 2012, 2013, 2014, 2017, 2016,
+  48, 986, 56, 994, 57, 995, 53, 991, 54, 992, 55, 993,
+  52, 990, 46, 984, 50, 988, 51, 989, 59, 997, 49, 987,
+  47, 985, 58, 996, 361, 1299, 370, 1308, 363, 1301, 365, 1303,
+  358, 1296, 364, 1302, 367, 1305, 368, 1306, 362, 1300, 371, 1309,
+  372, 1310, 369, 1307, 360, 1298, 359, 1297, 373, 1311, 374, 1312,
+  366, 1304, 793, 794, 795, 786, 787, 788, 789, 797, 796, 798,
+  799, 800, 801, 790, 791, 792, 802, 804, 803, 805, 279, 1217,
+  266, 1204, 305, 1243, 304, 1242, 297, 1235, 285, 1223, 286, 1224,
+  268, 1206, 280, 1218, 317, 1255, 284, 1222, 264, 1202, 316, 1254,
+  274, 1212, 306, 1244, 288, 1226, 265, 1203, 267, 1205, 278, 1216,
+  308, 1246, 287, 1225, 315, 1253, 281, 1219, 282, 1220, 283, 1221,
+  273, 1211, 277, 1215, 296, 1234, 292, 1230, 311, 1249, 313, 1251,
+  312, 1250, 314, 1252, 299, 1237, 300, 1238, 302, 1240, 303, 1241,
+  301, 1239, 298, 1236, 275, 1213, 271, 1209, 272, 1210, 289, 1227,
+  290, 1228, 295, 1233, 294, 1232, 293, 1231, 309, 1247, 310, 1248,
+  270, 1208, 269, 1207, 307, 1245, 276, 1214, 291, 1229, 170, 1108,
+  171, 1109, 168, 1106, 169, 1107, 172, 1110, 173, 1111, 174, 1112,
+  827, 1745, 839, 1757, 840, 1758, 841, 1759, 869, 1787, 817, 1735,
+  816, 1734, 815, 1733, 818, 1736, 872, 1790, 832, 1750, 892, 1810,
+  891, 1809, 820, 1738, 886, 1804, 842, 1760, 870, 1788, 843, 1761,
+  867, 1785, 868, 1786, 881, 1799, 844, 1762, 845, 1763, 890, 1808,
+  846, 1764, 811, 1729, 847, 1765, 887, 1805, 838, 1756, 848, 1766,
+  849, 1767, 850, 1768, 826, 1744, 833, 1751, 883, 1801, 861, 1779,
+  837, 1755, 864, 1782, 851, 1769, 823, 1741, 836, 1754, 852, 1770,
+  871, 1789, 885, 1803, 822, 1740, 819, 1737, 853, 1771, 812, 1730,
+  854, 1772, 855, 1773, 873, 1791, 856, 1774, 857, 1775, 858, 1776,
+  828, 1746, 829, 1747, 830, 1748, 831, 1749, 874, 1792, 889, 1807,
+  877, 1795, 880, 1798, 876, 1794, 821, 1739, 878, 1796, 859, 1777,
+  860, 1778, 879, 1797, 875, 1793, 882, 1800, 884, 1802, 888, 1806,
+  862, 1780, 813, 1731, 863, 1781, 834, 1752, 865, 1783, 814, 1732,
+  866, 1784, 835, 1753, 825, 1743, 824, 1742, 771, 1709, 770, 1708,
+  772, 1710, 776, 1714, 775, 1713, 778, 1716, 779, 1717, 777, 1715,
+  773, 1711, 774, 1712, 929, 1847, 925, 1843, 895, 1813, 919, 1837,
+  922, 1840, 928, 1846, 894, 1812, 896, 1814, 897, 1815, 898, 1816,
+  899, 1817, 900, 1818, 901, 1819, 902, 1820, 903, 1821, 904, 1822,
+  918, 1836, 923, 1841, 930, 1848, 926, 1844, 910, 1828, 917, 1835,
+  927, 1845, 915, 1833, 905, 1823, 912, 1830, 924, 1842, 906, 1824,
+  916, 1834, 921, 1839, 911, 1829, 907, 1825, 908, 1826, 913, 1831,
+  893, 1811, 914, 1832, 909, 1827, 920, 1838, 806, 1724, 807, 1725,
+  808, 1726, 186, 1124, 218, 1156, 207, 1145, 180, 1118, 231, 1169,
+  232, 1170, 185, 1123, 226, 1164, 209, 1147, 176, 1114, 233, 1171,
+  183, 1121, 214, 1152, 256, 1194, 247, 1185, 252, 1190, 206, 1144,
+  262, 1200, 224, 1162, 257, 1195, 246, 1184, 205, 1143, 222, 1160,
+  259, 1197, 188, 1126, 260, 1198, 254, 1192, 175, 1113, 198, 1136,
+  194, 1132, 193, 1131, 195, 1133, 192, 1130, 196, 1134, 210, 1148,
+  208, 1146, 261, 1199, 202, 1140, 215, 1153, 250, 1188, 244, 1182,
+  177, 1115, 229, 1167, 230, 1168, 184, 1122, 179, 1117, 178, 1116,
+  182, 1120, 225, 1163, 190, 1128, 203, 1141, 223, 1161, 263, 1201,
+  187, 1125, 258, 1196, 201, 1139, 189, 1127, 253, 1191, 197, 1135,
+  235, 1173, 239, 1177, 242, 1180, 240, 1178, 241, 1179, 243, 1181,
+  238, 1176, 236, 1174, 237, 1175, 234, 1172, 245, 1183, 191, 1129,
+  200, 1138, 221, 1159, 217, 1155, 199, 1137, 211, 1149, 213, 1151,
+  219, 1157, 227, 1165, 220, 1158, 228, 1166, 181, 1119, 248, 1186,
+  212, 1150, 251, 1189, 255, 1193, 216, 1154, 249, 1187, 204, 1142,
+  936, 1854, 937, 1855, 931, 1849, 935, 1853, 932, 1850, 933, 1851,
+  934, 1852, 164, 441, 511, 581, 651, 1102, 1379, 1449, 1519, 1589,
+  165, 442, 512, 582, 652, 1103, 1380, 1450, 1520, 1590, 166, 443,
+  513, 583, 653, 1104, 1381, 1451, 1521, 1591, 167, 444, 514, 584,
+  654, 1105, 1382, 1452, 1522, 1592, 131, 408, 478, 548, 618, 1069,
+  1346, 1416, 1486, 1556, 1913, 1979, 149, 426, 496, 566, 636, 1087,
+  1364, 1434, 1504, 1574, 1931, 1997, 105, 382, 452, 522, 592, 1043,
+  1320, 1390, 1460, 1530, 1887, 1953, 128, 405, 475, 545, 615, 1066,
+  1343, 1413, 1483, 1553, 1910, 1976, 150, 427, 497, 567, 637, 1088,
+  1365, 1435, 1505, 1575, 1932, 1998, 125, 402, 472, 542, 612, 1063,
+  1340, 1410, 1480, 1550, 1907, 1973, 144, 421, 491, 561, 631, 1082,
+  1359, 1429, 1499, 1569, 1926, 1992, 143, 420, 490, 560, 630, 1081,
+  1358, 1428, 1498, 1568, 1925, 1991, 99, 376, 446, 516, 586, 1037,
+  1314, 1384, 1454, 1524, 1881, 1947, 147, 424, 494, 564, 634, 1085,
+  1362, 1432, 1502, 1572, 1929, 1995, 145, 422, 492, 562, 632, 1083,
+  1360, 1430, 1500, 1570, 1927, 1993, 137, 414, 484, 554, 624, 1075,
+  1352, 1422, 1492, 1562, 1919, 1985, 115, 392, 462, 532, 602, 1053,
+  1330, 1400, 1470, 1540, 1897, 1963, 113, 390, 460, 530, 600, 1051,
+  1328, 1398, 1468, 1538, 1895, 1961, 117, 394, 464, 534, 604, 1055,
+  1332, 1402, 1472, 1542, 1899, 1965, 114, 391, 461, 531, 601, 1052,
+  1329, 1399, 1469, 1539, 1896, 1962, 116, 393, 463, 533, 603, 1054,
+  1331, 1401, 1471, 1541, 1898, 1964, 103, 380, 450, 520, 590, 1041,
+  1318, 1388, 1458, 1528, 1885, 1951, 140, 417, 487, 557, 627, 1078,
+  1355, 1425, 1495, 1565, 1922, 1988, 111, 388, 458, 528, 598, 1049,
+  1326, 1396, 1466, 1536, 1893, 1959, 134, 411, 481, 551, 621, 1072,
+  1349, 1419, 1489, 1559, 1916, 1982, 122, 399, 469, 539, 609, 1060,
+  1337, 1407, 1477, 1547, 1904, 1970, 109, 386, 456, 526, 596, 1047,
+  1324, 1394, 1464, 1534, 1891, 1957, 107, 384, 454, 524, 594, 1045,
+  1322, 1392, 1462, 1532, 1889, 1955, 98, 375, 445, 515, 585, 1036,
+  1313, 1383, 1453, 1523, 1880, 1946, 133, 410, 480, 550, 620, 1071,
+  1348, 1418, 1488, 1558, 1915, 1981, 123, 400, 470, 540, 610, 1061,
+  1338, 1408, 1478, 1548, 1905, 1971, 121, 398, 468, 538, 608, 1059,
+  1336, 1406, 1476, 1546, 1903, 1969, 106, 383, 453, 523, 593, 1044,
+  1321, 1391, 1461, 1531, 1888, 1954, 153, 430, 500, 570, 640, 1091,
+  1368, 1438, 1508, 1578, 1935, 2001, 100, 377, 447, 517, 587, 1038,
+  1315, 1385, 1455, 1525, 1882, 1948, 142, 419, 489, 559, 629, 1080,
+  1357, 1427, 1497, 1567, 1924, 1990, 141, 418, 488, 558, 628, 1079,
+  1356, 1426, 1496, 1566, 1923, 1989, 118, 395, 465, 535, 605, 1056,
+  1333, 1403, 1473, 1543, 1900, 1966, 119, 396, 466, 536, 606, 1057,
+  1334, 1404, 1474, 1544, 1901, 1967, 120, 397, 467, 537, 607, 1058,
+  1335, 1405, 1475, 1545, 1902, 1968, 101, 378, 448, 518, 588, 1039,
+  1316, 1386, 1456, 1526, 1883, 1949, 129, 406, 476, 546, 616, 1067,
+  1344, 1414, 1484, 1554, 1911, 1977, 112, 389, 459, 529, 599, 1050,
+  1327, 1397, 1467, 1537, 1894, 1960, 161, 438, 508, 578, 648, 1099,
+  1376, 1446, 1516, 1586, 1943, 2009, 110, 387, 457, 527, 597, 1048,
+  1325, 1395, 1465, 1535, 1892, 1958, 152, 429, 499, 569, 639, 1090,
+  1367, 1437, 1507, 1577, 1934, 2000, 151, 428, 498, 568, 638, 1089,
+  1366, 1436, 1506, 1576, 1933, 1999, 124, 401, 471, 541, 611, 1062,
+  1339, 1409, 1479, 1549, 1906, 1972, 159, 436, 506, 576, 646, 1097,
+  1374, 1444, 1514, 1584, 1941, 2007, 160, 437, 507, 577, 647, 1098,
+  1375, 1445, 1515, 1585, 1942, 2008, 108, 385, 455, 525, 595, 1046,
+  1323, 1393, 1463, 1533, 1890, 1956, 163, 440, 510, 580, 650, 1101,
+  1378, 1448, 1518, 1588, 1945, 2011, 162, 439, 509, 579, 649, 1100,
+  1377, 1447, 1517, 1587, 1944, 2010, 136, 413, 483, 553, 623, 1074,
+  1351, 1421, 1491, 1561, 1918, 1984, 148, 425, 495, 565, 635, 1086,
+  1363, 1433, 1503, 1573, 1930, 1996, 146, 423, 493, 563, 633, 1084,
+  1361, 1431, 1501, 1571, 1928, 1994, 157, 434, 504, 574, 644, 1095,
+  1372, 1442, 1512, 1582, 1939, 2005, 138, 415, 485, 555, 625, 1076,
+  1353, 1423, 1493, 1563, 1920, 1986, 127, 404, 474, 544, 614, 1065,
+  1342, 1412, 1482, 1552, 1909, 1975, 158, 435, 505, 575, 645, 1096,
+  1373, 1443, 1513, 1583, 1940, 2006, 156, 433, 503, 573, 643, 1094,
+  1371, 1441, 1511, 1581, 1938, 2004, 139, 416, 486, 556, 626, 1077,
+  1354, 1424, 1494, 1564, 1921, 1987, 155, 432, 502, 572, 642, 1093,
+  1370, 1440, 1510, 1580, 1937, 2003, 154, 431, 501, 571, 641, 1092,
+  1369, 1439, 1509, 1579, 1936, 2002, 130, 407, 477, 547, 617, 1068,
+  1345, 1415, 1485, 1555, 1912, 1978, 104, 381, 451, 521, 591, 1042,
+  1319, 1389, 1459, 1529, 1886, 1952, 132, 409, 479, 549, 619, 1070,
+  1347, 1417, 1487, 1557, 1914, 1980, 135, 412, 482, 552, 622, 1073,
+  1350, 1420, 1490, 1560, 1917, 1983, 102, 379, 449, 519, 589, 1040,
+  1317, 1387, 1457, 1527, 1884, 1950, 126, 403, 473, 543, 613, 1064,
+  1341, 1411, 1481, 1551, 1908, 1974, 327, 1265, 325, 1263, 331, 1269,
+  324, 1262, 321, 1259, 322, 1260, 330, 1268, 326, 1264, 329, 1267,
+  332, 1270, 340, 1278, 341, 1279, 343, 1281, 338, 1276, 345, 1283,
+  346, 1284, 342, 1280, 344, 1282, 339, 1277, 333, 1271, 323, 1261,
+  328, 1266, 356, 1294, 357, 1295, 318, 1256, 350, 1288, 352, 1290,
+  320, 1258, 319, 1257, 347, 1285, 354, 1292, 353, 1291, 334, 1272,
+  335, 1273, 336, 1274, 337, 1275, 355, 1293, 351, 1289, 348, 1286,
+  349, 1287, 765, 1703, 769, 1707, 761, 1699, 767, 1705, 766, 1704,
+  762, 1700, 763, 1701, 764, 1702, 768, 1706, 13, 951, 22, 960,
+  42, 980, 43, 981, 16, 954, 17, 955, 18, 956, 30, 968,
+  8, 946, 12, 950, 37, 975, 39, 977, 38, 976, 0, 938,
+  35, 973, 36, 974, 40, 978, 41, 979, 33, 971, 34, 972,
+  27, 965, 28, 966, 29, 967, 14, 952, 2, 940, 7, 945,
+  24, 962, 25, 963, 3, 941, 19, 957, 20, 958, 21, 959,
+  9, 947, 4, 942, 5, 943, 23, 961, 26, 964, 10, 948,
+  1, 939, 6, 944, 15, 953, 44, 982, 45, 983, 31, 969,
+  32, 970, 11, 949, 780, 1718, 783, 1721, 785, 1723, 781, 1719,
+  782, 1720, 784, 1722, 81, 1019, 83, 1021, 63, 1001, 77, 1015,
+  71, 1009, 69, 1007, 73, 1011, 72, 1010, 94, 1032, 60, 998,
+  62, 1000, 79, 1017, 67, 1005, 85, 1023, 95, 1033, 61, 999,
+  96, 1034, 74, 1012, 68, 1006, 93, 1031, 91, 1029, 90, 1028,
+  92, 1030, 89, 1027, 87, 1025, 86, 1024, 88, 1026, 64, 1002,
+  65, 1003, 66, 1004, 78, 1016, 80, 1018, 82, 1020, 84, 1022,
+  97, 1035, 76, 1014, 75, 1013, 70, 1008, 668, 721, 1606, 1659,
+  676, 729, 1614, 1667, 665, 718, 1603, 1656, 666, 719, 1604, 1657,
+  670, 723, 1608, 1661, 675, 728, 1613, 1666, 669, 722, 1607, 1660,
+  674, 727, 1612, 1665, 672, 725, 1610, 1663, 673, 726, 1611, 1664,
+  667, 720, 1605, 1658, 671, 724, 1609, 1662, 706, 759, 1644, 1697,
+  689, 742, 1627, 1680, 692, 745, 1630, 1683, 694, 747, 1632, 1685,
+  691, 744, 1629, 1682, 655, 708, 1593, 1646, 695, 748, 1633, 1686,
+  693, 746, 1631, 1684, 681, 734, 1619, 1672, 680, 733, 1618, 1671,
+  679, 732, 1617, 1670, 682, 735, 1620, 1673, 659, 712, 1597, 1650,
+  657, 710, 1595, 1648, 658, 711, 1596, 1649, 656, 709, 1594, 1647,
+  688, 741, 1626, 1679, 687, 740, 1625, 1678, 686, 739, 1624, 1677,
+  678, 731, 1616, 1669, 677, 730, 1615, 1668, 690, 743, 1628, 1681,
+  685, 738, 1623, 1676, 684, 737, 1622, 1675, 683, 736, 1621, 1674,
+  707, 760, 1645, 1698, 699, 752, 1637, 1690, 696, 749, 1634, 1687,
+  697, 750, 1635, 1688, 698, 751, 1636, 1689, 700, 753, 1638, 1691,
+  701, 754, 1639, 1692, 702, 755, 1640, 1693, 703, 756, 1641, 1694,
+  704, 757, 1642, 1695, 705, 758, 1643, 1696, 663, 716, 1601, 1654,
+  661, 714, 1599, 1652, 662, 715, 1600, 1653, 660, 713, 1598, 1651,
+  664, 717, 1602, 1655, 809, 1727, 810, 1728,
+};
+
+#endif // VSCP_TOKEN_DATA_H
@@ -0,0 +1,275 @@
+// vscp-token.cpp
+//
+// VSCP class and type token lookup.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "vscp-token.h"
+
+#include "vscp-token-data.h"
+
+#define VSCP_CLASS_TOKEN_COUNT (sizeof(vscp_class_tokens) / sizeof(vscp_class_tokens[0]))
+#define VSCP_TYPE_TOKEN_COUNT  (sizeof(vscp_type_tokens) / sizeof(vscp_type_tokens[0]))
+
+static_assert(sizeof(vscp_class_token_index) / sizeof(vscp_class_token_index[0]) == VSCP_CLASS_TOKEN_COUNT,
+              "Class token index does not match class token table");
+static_assert(sizeof(vscp_type_token_index) / sizeof(vscp_type_token_index[0]) == VSCP_TYPE_TOKEN_COUNT,
+              "Type token index does not match type token table");
+
+///////////////////////////////////////////////////////////////////////////////
+// vscp_getBuiltinClassToken
+//
+
+const char *
+vscp_getBuiltinClassToken(uint16_t vscp_class)
+{
+  const vscp_class_token_entry *begin = vscp_class_tokens;
+  const vscp_class_token_entry *end   = vscp_class_tokens + VSCP_CLASS_TOKEN_COUNT;
+
+  const vscp_class_token_entry *it =
+    std::lower_bound(begin, end, vscp_class, [](const vscp_class_token_entry &e, uint16_t cls) {
+      return e.vscp_class < cls;
+    });
+
+  if ((it == end) || (it->vscp_class != vscp_class)) {
+    return NULL;
+  }
+
+  return it->token;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscp_getBuiltinTypeToken
+//
+
+const char *
+vscp_getBuiltinTypeToken(uint16_t vscp_class, uint16_t vscp_type)
+{
+  uint32_t id                               = ((uint32_t) vscp_class << 16) | vscp_type;
+  const vscp_type_token_entry *begin = vscp_type_tokens;
+  const vscp_type_token_entry *end   = vscp_type_tokens + VSCP_TYPE_TOKEN_COUNT;
+
+  const vscp_type_token_entry *it =
+    std::lower_bound(begin, end, id, [](const vscp_type_token_entry &e, uint32_t id) {
+      return e.id < id;
+    });
+
+  if ((it == end) || (it->id != id)) {
+    return NULL;
+  }
+
+  return it->token;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscp_getBuiltinClassFromToken
+//
+
+bool
+vscp_getBuiltinClassFromToken(uint16_t *pvscp_class, const char *token)
+{
+  if ((NULL == pvscp_class) || (NULL == token)) {
+    return false;
+  }
+
+  const uint16_t *begin = vscp_class_token_index;
+  const uint16_t *end   = vscp_class_token_index + VSCP_CLASS_TOKEN_COUNT;
+
+  const uint16_t *it = std::lower_bound(begin, end, token, [](uint16_t idx, const char *token) {
+    return strcmp(vscp_class_tokens[idx].token, token) < 0;
+  });
+
+  if ((it == end) || (0 != strcmp(vscp_class_tokens[*it].token, token))) {
+    return false;
+  }
+
+  *pvscp_class = vscp_class_tokens[*it].vscp_class;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscp_getBuiltinTypeFromToken
+//
+
+bool
+vscp_getBuiltinTypeFromToken(uint16_t *pvscp_class, uint16_t *pvscp_type, const char *token)
+{
+  if ((NULL == pvscp_class) || (NULL == pvscp_type) || (NULL == token)) {
+    return false;
+  }
+
+  const uint16_t *begin = vscp_type_token_index;
+  const uint16_t *end   = vscp_type_token_index + VSCP_TYPE_TOKEN_COUNT;
+
+  // Entries with equal tokens are sorted on id so the first match
+  // is the lowest class using the token
+  const uint16_t *it = std::lower_bound(begin, end, token, [](uint16_t idx, const char *token) {
+    return strcmp(vscp_type_tokens[idx].token, token) < 0;
+  });
+
+  for (; (it != end) && (0 == strcmp(vscp_type_tokens[*it].token, token)); ++it) {
+    uint32_t id = vscp_type_tokens[*it].id;
+    if ((0xffff == *pvscp_class) || ((id >> 16) == *pvscp_class)) {
+      *pvscp_class = (uint16_t) (id >> 16);
+      *pvscp_type  = (uint16_t) (id & 0xffff);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// addClassToken
+//
+
+void
+vscpTokenTable::addClassToken(uint16_t vscp_class, const std::string &token)
+{
+  std::unordered_map<uint16_t, std::string>::iterator it = m_class_id2Token.find(vscp_class);
+  if (it != m_class_id2Token.end()) {
+    m_class_token2Id.erase(it->second);
+  }
+
+  m_class_id2Token[vscp_class] = token;
+  m_class_token2Id[token]      = vscp_class;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// addTypeToken
+//
+
+void
+vscpTokenTable::addTypeToken(uint16_t vscp_class, uint16_t vscp_type, const std::string &token)
+{
+  uint32_t id = ((uint32_t) vscp_class << 16) | vscp_type;
+
+  std::unordered_map<uint32_t, std::string>::iterator it = m_type_id2Token.find(id);
+  if (it != m_type_id2Token.end()) {
+    auto range = m_type_token2Id.equal_range(it->second);
+    for (auto itr = range.first; itr != range.second; ++itr) {
+      if (itr->second == id) {
+        m_type_token2Id.erase(itr);
+        break;
+      }
+    }
+  }
+
+  m_type_id2Token[id] = token;
+  m_type_token2Id.insert(std::make_pair(token, id));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getClassToken
+//
+
+std::string
+vscpTokenTable::getClassToken(uint16_t vscp_class) const
+{
+  std::unordered_map<uint16_t, std::string>::const_iterator it = m_class_id2Token.find(vscp_class);
+  if (it != m_class_id2Token.end()) {
+    return it->second;
+  }
+
+  const char *p = vscp_getBuiltinClassToken(vscp_class);
+  return (NULL == p) ? std::string() : std::string(p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getTypeToken
+//
+
+std::string
+vscpTokenTable::getTypeToken(uint16_t vscp_class, uint16_t vscp_type) const
+{
+  std::unordered_map<uint32_t, std::string>::const_iterator it =
+    m_type_id2Token.find(((uint32_t) vscp_class << 16) | vscp_type);
+  if (it != m_type_id2Token.end()) {
+    return it->second;
+  }
+
+  const char *p = vscp_getBuiltinTypeToken(vscp_class, vscp_type);
+  return (NULL == p) ? std::string() : std::string(p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getClassFromToken
+//
+
+bool
+vscpTokenTable::getClassFromToken(uint16_t *pvscp_class, const std::string &token) const
+{
+  if (NULL == pvscp_class) {
+    return false;
+  }
+
+  std::unordered_map<std::string, uint16_t>::const_iterator it = m_class_token2Id.find(token);
+  if (it != m_class_token2Id.end()) {
+    *pvscp_class = it->second;
+    return true;
+  }
+
+  return vscp_getBuiltinClassFromToken(pvscp_class, token.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getTypeFromToken
+//
+
+bool
+vscpTokenTable::getTypeFromToken(uint16_t *pvscp_class, uint16_t *pvscp_type, const std::string &token) const
+{
+  if ((NULL == pvscp_class) || (NULL == pvscp_type)) {
+    return false;
+  }
+
+  // Lowest matching id among the overrides
+  bool bFound = false;
+  uint32_t found;
+  auto range = m_type_token2Id.equal_range(token);
+  for (auto it = range.first; it != range.second; ++it) {
+    if ((0xffff != *pvscp_class) && ((it->second >> 16) != *pvscp_class)) {
+      continue;
+    }
+    if (!bFound || (it->second < found)) {
+      found  = it->second;
+      bFound = true;
+    }
+  }
+
+  if (bFound) {
+    *pvscp_class = (uint16_t) (found >> 16);
+    *pvscp_type  = (uint16_t) (found & 0xffff);
+    return true;
+  }
+
+  return vscp_getBuiltinTypeFromToken(pvscp_class, pvscp_type, token.c_str());
+}
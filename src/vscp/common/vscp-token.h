@@ -0,0 +1,180 @@
+// vscp-token.h
+//
+// VSCP class and type token lookup.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(VSCP_TOKEN_H__INCLUDED_)
+#define VSCP_TOKEN_H__INCLUDED_
+
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+
+// Entries in the built in token tables (vscp-token-data.h)
+struct vscp_class_token_entry {
+  uint16_t vscp_class;
+  const char *token;
+};
+
+struct vscp_type_token_entry {
+  uint32_t id; // (vscp_class << 16) | vscp_type
+  const char *token;
+};
+
+/*!
+  @fn vscp_getBuiltinClassToken
+  Get the token for a VSCP class from the built in table, for example
+  "CLASS1.MEASUREMENT".
+
+  @param vscp_class VSCP class
+  @return Pointer to token or NULL if the class is unknown.
+*/
+const char *
+vscp_getBuiltinClassToken(uint16_t vscp_class);
+
+/*!
+  @fn vscp_getBuiltinTypeToken
+  Get the token for a VSCP type from the built in table, for example
+  "VSCP_TYPE_MEASUREMENT_TEMPERATURE".
+
+  @param vscp_class VSCP class
+  @param vscp_type VSCP type
+  @return Pointer to token or NULL if the class/type is unknown.
+*/
+const char *
+vscp_getBuiltinTypeToken(uint16_t vscp_class, uint16_t vscp_type);
+
+/*!
+  @fn vscp_getBuiltinClassFromToken
+  Get VSCP class from token using the built in table.
+
+  @param pvscp_class Pointer to variable that will get the class.
+  @param token Class token
+  @return true if the token is known.
+*/
+bool
+vscp_getBuiltinClassFromToken(uint16_t *pvscp_class, const char *token);
+
+/*!
+  @fn vscp_getBuiltinTypeFromToken
+  Get VSCP class and type from a type token using the built in table.
+  The same type token is used in several classes (measurements for
+  example). If pvscp_class points to a class with the value
+  0xffff the lowest class using the token is returned, otherwise
+  only a type in the given class is returned.
+
+  @param pvscp_class Pointer to class. In: class or 0xffff, out: class.
+  @param pvscp_type Pointer to variable that will get the type.
+  @param token Type token
+  @return true if the token is known.
+*/
+bool
+vscp_getBuiltinTypeFromToken(uint16_t *pvscp_class, uint16_t *pvscp_type, const char *token);
+
+/*!
+  @class vscpTokenTable
+  VSCP class/type token dictionary.
+
+  Lookups go to the built in tables generated from the class & type
+  definitions (tools/gen-token-table.py). Tokens loaded from a class &
+  type database can be added as overrides. Overrides must be added
+  before the table is shared between threads, after that all lookups
+  are read only and need no locking.
+*/
+
+class vscpTokenTable {
+
+public:
+  vscpTokenTable(void) {};
+  ~vscpTokenTable(void) {};
+
+  /*!
+    Add (or replace) a class token
+    @param vscp_class VSCP class
+    @param token Class token
+  */
+  void addClassToken(uint16_t vscp_class, const std::string &token);
+
+  /*!
+    Add (or replace) a type token
+    @param vscp_class VSCP class
+    @param vscp_type VSCP type
+    @param token Type token
+  */
+  void addTypeToken(uint16_t vscp_class, uint16_t vscp_type, const std::string &token);
+
+  /*!
+    Get class token
+    @param vscp_class VSCP class
+    @return Class token or empty string if unknown.
+  */
+  std::string getClassToken(uint16_t vscp_class) const;
+
+  /*!
+    Get type token
+    @param vscp_class VSCP class
+    @param vscp_type VSCP type
+    @return Type token or empty string if unknown.
+  */
+  std::string getTypeToken(uint16_t vscp_class, uint16_t vscp_type) const;
+
+  /*!
+    Get class from class token
+    @param pvscp_class Pointer to variable that will get the class.
+    @param token Class token
+    @return true if the token is known.
+  */
+  bool getClassFromToken(uint16_t *pvscp_class, const std::string &token) const;
+
+  /*!
+    Get class and type from type token, see vscp_getBuiltinTypeFromToken
+    @param pvscp_class Pointer to class. In: class or 0xffff, out: class.
+    @param pvscp_type Pointer to variable that will get the type.
+    @param token Type token
+    @return true if the token is known.
+  */
+  bool getTypeFromToken(uint16_t *pvscp_class, uint16_t *pvscp_type, const std::string &token) const;
+
+  /*!
+    Get number of override entries
+    @return Number of class and type tokens added
+  */
+  size_t getOverrideCount(void) const { return m_class_id2Token.size() + m_type_id2Token.size(); };
+
+private:
+  // Overrides
+  std::unordered_map<uint16_t, std::string> m_class_id2Token;
+  std::unordered_map<std::string, uint16_t> m_class_token2Id;
+
+  // key: (vscp_class << 16) | vscp_type
+  std::unordered_map<uint32_t, std::string> m_type_id2Token;
+  std::unordered_multimap<std::string, uint32_t> m_type_token2Id;
+};
+
+#endif // VSCP_TOKEN_H__INCLUDED_
@@ -29,7 +29,9 @@
 #include <pch.h>
 #endif
 
+#include <chrono>
 #include <string>
+#include <thread>
 #include <dlfcn.h>
 #include <stdlib.h>
 
@@ -50,6 +52,9 @@
 
 #define XML_BUFF_SIZE 0xffff
 
+// Poll interval (ms) for drivers without a blocking receive
+#define CANAL_RECEIVE_POLL_INTERVAL 5
+
 // for convenience
 using json = nlohmann::json;
 
@@ -68,6 +73,12 @@ VscpCanalDeviceIf::VscpCanalDeviceIf()
     m_bAsync      = false;
     m_hdll        = NULL;
     m_bGenerationOne = false;   // We guess it is a generation two CANAL driver
+
+    m_proc_CanalBlockingSend         = NULL;
+    m_proc_CanalBlockingReceive      = NULL;
+    m_proc_CanalGetdriverInfo        = NULL;
+    m_proc_CanalBlockingReceiveBatch = NULL;
+    m_proc_CanalSendBatch            = NULL;
 }
 
 VscpCanalDeviceIf::~VscpCanalDeviceIf()
@@ -376,6 +387,28 @@ VscpCanalDeviceIf::init()
         m_bGenerationOne = true;
     }
 
+    // ******************************
+    //     Generation 3 Methods
+    // ******************************
+
+    // Optional, single message calls are used if not exported
+
+    // * * * * CANAL BLOCKING RECEIVE BATCH * * * *
+    m_proc_CanalBlockingReceiveBatch =
+      (LPFNDLL_CANALBLOCKINGRECEIVEBATCH)dlsym(m_hdll, "CanalBlockingReceiveBatch");
+    dlsym_error = dlerror();
+    if (dlsym_error) {
+        m_proc_CanalBlockingReceiveBatch = NULL;
+    }
+
+    // * * * * CANAL SEND BATCH * * * *
+    m_proc_CanalSendBatch =
+      (LPFNDLL_CANALSENDBATCH)dlsym(m_hdll, "CanalSendBatch");
+    dlsym_error = dlerror();
+    if (dlsym_error) {
+        m_proc_CanalSendBatch = NULL;
+    }
+
     return CANAL_ERROR_SUCCESS;
 }
 
@@ -1035,6 +1068,137 @@ VscpCanalDeviceIf::CanalBlockingReceive(std::string &strObj,
     return CANAL_ERROR_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// CanalBlockingReceiveBatch
+//
+
+int
+VscpCanalDeviceIf::CanalBlockingReceiveBatch(canalMsg *pmsgs,
+                                             uint32_t count,
+                                             uint32_t *pReceived,
+                                             uint32_t timeout)
+{
+    // Check pointers
+    if ((NULL == pmsgs) || (NULL == pReceived) || (0 == count)) {
+        return CANAL_ERROR_PARAMETER;
+    }
+
+    *pReceived = 0;
+
+    // Init must have succeded to do this call
+    if (m_hdll == nullptr) {
+        return CANAL_ERROR_INIT_MISSING;
+    }
+
+    // Must be open
+    if (0 == m_openHandle) {
+        return CANAL_ERROR_NOT_OPEN;
+    }
+
+    if (NULL != m_proc_CanalBlockingReceiveBatch) {
+        unsigned int cnt = 0;
+        int rv = m_proc_CanalBlockingReceiveBatch(m_openHandle, pmsgs, count, &cnt, timeout);
+        *pReceived = cnt;
+        return rv;
+    }
+
+    // Fall back to one call per message
+
+    int rv;
+    if (NULL != m_proc_CanalBlockingReceive) {
+        rv = m_proc_CanalBlockingReceive(m_openHandle, pmsgs, timeout);
+    }
+    else {
+        // No blocking receive, poll until something is queued or the
+        // timeout expires so callers looping on us do not spin
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        while (!m_proc_CanalDataAvailable(m_openHandle)) {
+            if ((CANAL_BLOCK_FOREVER != timeout) &&
+                (std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(timeout))) {
+                return CANAL_ERROR_TIMEOUT;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(CANAL_RECEIVE_POLL_INTERVAL));
+        }
+        rv = m_proc_CanalReceive(m_openHandle, pmsgs);
+    }
+
+    if (CANAL_ERROR_SUCCESS != rv) {
+        return rv;
+    }
+
+    (*pReceived)++;
+
+    // Take what else is already queued
+    while ((*pReceived < count) &&
+           m_proc_CanalDataAvailable(m_openHandle) &&
+           (CANAL_ERROR_SUCCESS == m_proc_CanalReceive(m_openHandle, pmsgs + *pReceived))) {
+        (*pReceived)++;
+    }
+
+    return CANAL_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// CanalSendBatch
+//
+
+int
+VscpCanalDeviceIf::CanalSendBatch(const PCANALMSG pmsgs,
+                                  uint32_t count,
+                                  uint32_t *pSent,
+                                  uint32_t timeout)
+{
+    // Check pointers
+    if ((NULL == pmsgs) || (NULL == pSent)) {
+        return CANAL_ERROR_PARAMETER;
+    }
+
+    *pSent = 0;
+
+    // Init must have succeded to do this call
+    if (m_hdll == nullptr) {
+        return CANAL_ERROR_INIT_MISSING;
+    }
+
+    // Must be open
+    if (0 == m_openHandle) {
+        return CANAL_ERROR_NOT_OPEN;
+    }
+
+    if (NULL != m_proc_CanalSendBatch) {
+        unsigned int cnt = 0;
+        int rv = m_proc_CanalSendBatch(m_openHandle, pmsgs, count, &cnt, timeout);
+        *pSent = (cnt < count) ? cnt : count;
+
+        // A driver that reports success without sending everything
+        // has still failed to send the rest
+        if ((CANAL_ERROR_SUCCESS == rv) && (*pSent < count)) {
+            return CANAL_ERROR_TIMEOUT;
+        }
+        return rv;
+    }
+
+    // Fall back to one call per message
+    while (*pSent < count) {
+
+        int rv;
+        if (NULL != m_proc_CanalBlockingSend) {
+            rv = m_proc_CanalBlockingSend(m_openHandle, pmsgs + *pSent, timeout);
+        }
+        else {
+            rv = m_proc_CanalSend(m_openHandle, pmsgs + *pSent);
+        }
+
+        if (CANAL_ERROR_SUCCESS != rv) {
+            return rv;
+        }
+
+        (*pSent)++;
+    }
+
+    return CANAL_ERROR_SUCCESS;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // CanalDataAvailable
 //
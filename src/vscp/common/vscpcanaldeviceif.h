@@ -258,6 +258,48 @@ class VscpCanalDeviceIf
                              uint32_t timeout = CANAL_BLOCK_FOREVER,
                              uint8_t nFormat  = CANAL_FORMAT_CAN_XML);
 
+    /*!
+        Receive several CANAL messages
+
+        Blocks until at least one message is received or the timeout
+        expires and then returns what is queued in the driver up to count
+        messages. Uses CanalBlockingReceiveBatch if the driver has it and
+        falls back to CanalBlockingReceive/CanalReceive otherwise. Drivers
+        without a blocking receive are polled until the timeout expires.
+
+        @param pCanMsgs Array that will get received messages.
+        @param count Number of messages pCanMsgs can hold.
+        @param pReceived Will get the number of received messages.
+        @param timeout timeout - Timeout in milliseconds. 0 (default) to wait
+       forever.
+        @return CANAL_ERROR_SUCCESS if at least one message was received,
+        CANAL error code on failure
+    */
+    int CanalBlockingReceiveBatch(PCANALMSG pCanMsgs,
+                                  uint32_t count,
+                                  uint32_t *pReceived,
+                                  uint32_t timeout = CANAL_BLOCK_FOREVER);
+
+    /*!
+        Send several CANAL messages
+
+        Uses CanalSendBatch if the driver has it and falls back to
+        CanalBlockingSend/CanalSend otherwise. Sending stops at the
+        first message that fails.
+
+        @param pCanMsgs Array with messages to send.
+        @param count Number of messages to send.
+        @param pSent Will get the number of sent messages.
+        @param timeout timeout - Timeout in milliseconds. 0 (default) to wait
+       forever.
+        @return CANAL_ERROR_SUCCESS if all messages was sent, CANAL error
+        code on failure
+    */
+    int CanalSendBatch(const PCANALMSG pCanMsgs,
+                       uint32_t count,
+                       uint32_t *pSent,
+                       uint32_t timeout = CANAL_BLOCK_FOREVER);
+
     /*!
         CanalDataAvailable
         @return number of messages in input queue
@@ -422,6 +464,13 @@ class VscpCanalDeviceIf
     */
     bool isGenerationOne(void) { return m_bGenerationOne; };
 
+    /*!
+        Return true if the driver exports the bulk transfer methods
+        @return True if CanalBlockingReceiveBatch/CanalSendBatch are available
+    */
+    bool hasBatchSupport(void) { return ((NULL != m_proc_CanalBlockingReceiveBatch) &&
+                                         (NULL != m_proc_CanalSendBatch)); };
+
   private:
     // Driver DLL/DL path
     std::string m_strPath;
@@ -468,6 +517,10 @@ class VscpCanalDeviceIf
     LPFNDLL_CANALBLOCKINGSEND m_proc_CanalBlockingSend;
     LPFNDLL_CANALBLOCKINGRECEIVE m_proc_CanalBlockingReceive;
     LPFNDLL_CANALGETDRIVERINFO m_proc_CanalGetdriverInfo;
+
+    // Generation 3 (optional)
+    LPFNDLL_CANALBLOCKINGRECEIVEBATCH m_proc_CanalBlockingReceiveBatch;
+    LPFNDLL_CANALSENDBATCH m_proc_CanalSendBatch;
 };
 
 
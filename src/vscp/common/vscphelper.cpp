@@ -112,6 +112,7 @@ clock_gettime(int, struct timespec *ts)
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 
 #define UNUSED(expr)                                                                                                   \
@@ -2152,73 +2153,174 @@ vscp_getMeasurementAsString(std::string &strValue, const vscpEvent *pEvent)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// vscp_getMeasurementAsDouble
+// vscp_decodeMeasurementAsDouble
 //
+// Works directly on the raw class/type/data view so that both vscpEvent and
+// vscpEventEx can be decoded without building strings or temporary events.
 //
 
 bool
-vscp_getMeasurementAsDouble(double *pvalue, const vscpEvent *pEvent)
+vscp_decodeMeasurementAsDouble(double *pvalue,
+                               uint16_t vscp_class,
+                               uint16_t vscp_type,
+                               const uint8_t *pdata,
+                               uint16_t sizeData)
 {
-  std::string str;
+  int offset = 0;
+
+  UNUSED(vscp_type);
 
   // Check pointers
-  if (nullptr == pEvent) {
+  if ((nullptr == pvalue) || (nullptr == pdata) || (0 == sizeData)) {
     return false;
   }
 
-  if (nullptr == pvalue) {
-    return false;
-  }
+  if ((VSCP_CLASS1_MEASUREMENT == vscp_class) || (VSCP_CLASS1_DATA == vscp_class) ||
+      (VSCP_CLASS1_MEASUREZONE == vscp_class) || (VSCP_CLASS1_SETVALUEZONE == vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT == vscp_class) || (VSCP_CLASS2_LEVEL1_DATA == vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREZONE == vscp_class) || (VSCP_CLASS2_LEVEL1_SETVALUEZONE == vscp_class)) {
 
-  if ((VSCP_CLASS1_MEASUREMENT == pEvent->vscp_class) || (VSCP_CLASS1_DATA == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS1_SETVALUEZONE == pEvent->vscp_class)) {
+    // If class >= 512 and class < 1024 we
+    // have GUID in front of data.
+    if (vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) {
+      offset = 16;
+    }
 
-    if (!vscp_getMeasurementAsString(str, pEvent)) {
-      return false;
+    // Point past index,zone,subzone
+    if ((VSCP_CLASS1_MEASUREZONE == vscp_class) || (VSCP_CLASS1_SETVALUEZONE == vscp_class) ||
+        (VSCP_CLASS2_LEVEL1_MEASUREZONE == vscp_class) || (VSCP_CLASS2_LEVEL1_SETVALUEZONE == vscp_class)) {
+      offset += 3;
     }
 
-    try {
-      *pvalue = std::stod(str);
+    // Must be at least a coding byte and one value byte
+    if ((sizeData - offset) < 2) {
+      return false;
     }
-    catch (...) {
+
+    const uint8_t *pCode = pdata + offset;
+    const uint8_t *pVal  = pCode + 1;
+    int length           = sizeData - offset - 1; // Value bytes
+
+    // Level I coding never has more than eight value bytes
+    if (length > 8) {
       return false;
     }
+
+    switch (VSCP_DATACODING_TYPE(*pCode)) {
+
+      case VSCP_DATACODING_BIT:
+      case VSCP_DATACODING_BYTE: {
+        // Bit and byte series are read as an unsigned MSB first number
+        uint64_t value = 0;
+        for (int i = 0; i < length; i++) {
+          value = (value << 8) | pVal[i];
+        }
+        *pvalue = (double) value;
+      } break;
+
+      case VSCP_DATACODING_STRING: {
+        char buf[9];
+        char *pEnd = nullptr;
+        memcpy(buf, pVal, length);
+        buf[length] = '\0';
+        *pvalue     = strtod(buf, &pEnd);
+        if (pEnd == buf) {
+          return false;
+        }
+      } break;
+
+      case VSCP_DATACODING_INTEGER:
+        *pvalue = (double) vscp_getDataCodingInteger(pCode, (uint8_t) (length + 1));
+        break;
+
+      case VSCP_DATACODING_NORMALIZED:
+        // Needs the decimal byte and at least one value byte
+        if (length < 2) {
+          return false;
+        }
+        *pvalue = vscp_getDataCodingNormalizedInteger(pCode, (uint8_t) (length + 1));
+        break;
+
+      case VSCP_DATACODING_SINGLE: {
+        // Single precision float stored MSB first
+        if (length < 4) {
+          return false;
+        }
+        uint32_t n = ((uint32_t) pVal[0] << 24) | ((uint32_t) pVal[1] << 16) | ((uint32_t) pVal[2] << 8) | pVal[3];
+        float f;
+        memcpy(&f, &n, sizeof(f));
+        *pvalue = f;
+      } break;
+
+      case VSCP_DATACODING_DOUBLE: {
+        // Double precision float stored MSB first
+        if (length < 8) {
+          return false;
+        }
+        uint64_t n = 0;
+        for (int i = 0; i < 8; i++) {
+          n = (n << 8) | pVal[i];
+        }
+        memcpy(pvalue, &n, sizeof(double));
+      } break;
+
+      default: // Reserved
+        return false;
+    }
   }
-  else if (VSCP_CLASS1_MEASUREMENT64 == pEvent->vscp_class) {
+  else if ((VSCP_CLASS1_MEASUREMENT32 == vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == vscp_class)) {
 
-    if (!vscp_getMeasurementFloat64AsString(str, pEvent)) {
+    float f;
+
+    if (vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) {
+      offset = 16;
+    }
+
+    if ((sizeData - offset) != 4) {
       return false;
     }
-    try {
-      *pvalue = stod(str);
+
+    memcpy(&f, pdata + offset, sizeof(f));
+    *pvalue = f;
+  }
+  else if ((VSCP_CLASS1_MEASUREMENT64 == vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == vscp_class)) {
+
+    if (vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) {
+      offset = 16;
     }
-    catch (...) {
+
+    if ((sizeData - offset) != 8) {
       return false;
     }
+
+    memcpy(pvalue, pdata + offset, sizeof(double));
   }
-  else if (VSCP_CLASS2_MEASUREMENT_STR == pEvent->vscp_class) {
+  else if (VSCP_CLASS2_MEASUREMENT_STR == vscp_class) {
 
-    char buf[512];
+    char buf[VSCP_LEVEL2_MAXDATA + 1];
+    char *pEnd = nullptr;
 
-    if (0 == pEvent->sizeData || nullptr == pEvent->pdata) {
+    if (sizeData <= 4 || sizeData > VSCP_LEVEL2_MAXDATA) {
       return false;
     }
-    memcpy(buf, pEvent->pdata + 4, pEvent->sizeData - 4);
 
-    try {
-      *pvalue = std::stod(std::string(buf));
-    }
-    catch (...) {
+    memcpy(buf, pdata + 4, sizeData - 4);
+    buf[sizeData - 4] = '\0';
+
+    *pvalue = strtod(buf, &pEnd);
+    if (pEnd == buf) {
       return false;
     }
   }
-  else if (VSCP_CLASS2_MEASUREMENT_FLOAT == pEvent->vscp_class) {
+  else if (VSCP_CLASS2_MEASUREMENT_FLOAT == vscp_class) {
 
-    char buf[8];
+    // Must be correct data
+    if (sizeData < 12) {
+      return false;
+    }
 
-    memcpy(buf, pEvent->pdata + 4, 8);
-    *pvalue = *(double *) (buf);
+    // Same layout as written by vscp_makeLevel2FloatMeasurementEvent
+    memcpy(pvalue, pdata + 4, sizeof(double));
   }
   else {
     return false;
@@ -2228,30 +2330,54 @@ vscp_getMeasurementAsDouble(double *pvalue, const vscpEvent *pEvent)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// vscp_getMeasurementAsDoubleEx
+// vscp_getMeasurementAsDouble
 //
 //
 
 bool
-vscp_getMeasurementAsDoubleEx(double *pvalue, const vscpEventEx *pEventEx)
+vscp_getMeasurementAsDouble(double *pvalue, const vscp_event_view &ev)
 {
-  vscpEvent *pev = new vscpEvent;
-  if (nullptr == pev) {
+  return vscp_decodeMeasurementAsDouble(pvalue, ev.vscp_class, ev.vscp_type, ev.pdata, ev.sizeData);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscp_getMeasurementAsDouble
+//
+//
+
+bool
+vscp_getMeasurementAsDouble(double *pvalue, const vscpEvent *pEvent)
+{
+  // Check pointers
+  if (nullptr == pEvent) {
     return false;
   }
 
-  pev->pdata    = nullptr;
-  pev->sizeData = 0;
+  return vscp_decodeMeasurementAsDouble(pvalue,
+                                        pEvent->vscp_class,
+                                        pEvent->vscp_type,
+                                        pEvent->pdata,
+                                        pEvent->sizeData);
+}
 
-  if (!vscp_convertEventExToEvent(pev, pEventEx)) {
-    vscp_deleteEvent(pev);
+///////////////////////////////////////////////////////////////////////////////
+// vscp_getMeasurementAsDoubleEx
+//
+//
+
+bool
+vscp_getMeasurementAsDoubleEx(double *pvalue, const vscpEventEx *pEventEx)
+{
+  // Check pointers
+  if (nullptr == pEventEx) {
     return false;
   }
 
-  int rv = vscp_getMeasurementAsDouble(pvalue, pev);
-  vscp_deleteEvent(pev);
-
-  return rv;
+  return vscp_decodeMeasurementAsDouble(pvalue,
+                                        pEventEx->vscp_class,
+                                        pEventEx->vscp_type,
+                                        pEventEx->data,
+                                        pEventEx->sizeData);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2319,81 +2445,85 @@ vscp_getMeasurementWithZoneAsString(const vscpEvent *pEvent, std::string & /*str
 //
 
 int
-vscp_getMeasurementUnit(const vscpEvent *pEvent)
+vscp_getMeasurementUnit(const vscp_event_view &ev)
 {
   int offset = 0;
 
   // If class >= 512 and class < 1024 we
   // have GUID in front of data.
-  if ((pEvent->vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) && (pEvent->vscp_class < VSCP_CLASS2_PROTOCOL)) {
+  if ((ev.vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) && (ev.vscp_class < VSCP_CLASS2_PROTOCOL)) {
     offset = 16;
   }
 
-  if ((VSCP_CLASS1_MEASUREMENT == pEvent->vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREMENT == pEvent->vscp_class) ||
-      (VSCP_CLASS1_DATA == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREZONE == pEvent->vscp_class) || (VSCP_CLASS1_SETVALUEZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_SETVALUEZONE == pEvent->vscp_class)) {
+  if ((VSCP_CLASS1_MEASUREMENT == ev.vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREMENT == ev.vscp_class) ||
+      (VSCP_CLASS1_DATA == ev.vscp_class) || (VSCP_CLASS1_MEASUREZONE == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREZONE == ev.vscp_class) || (VSCP_CLASS1_SETVALUEZONE == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_SETVALUEZONE == ev.vscp_class)) {
 
-    if ((nullptr == pEvent->pdata) || (pEvent->sizeData < (offset + 1))) {
+    if ((nullptr == ev.pdata) || (ev.sizeData < (offset + 1))) {
       return VSCP_ERROR_ERROR;
     }
 
-    return VSCP_DATACODING_UNIT(pEvent->pdata[offset + 0]);
+    return VSCP_DATACODING_UNIT(ev.pdata[offset + 0]);
   }
-  else if ((VSCP_CLASS1_MEASUREMENT32 == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREMENT32 == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == ev.vscp_class)) {
     return 0; // Always default unit
   }
-  else if ((VSCP_CLASS1_MEASUREMENT64 == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREMENT64 == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == ev.vscp_class)) {
     return 0; // Always default unit
   }
-  else if ((VSCP_CLASS2_MEASUREMENT_STR == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS2_MEASUREMENT_STR == ev.vscp_class)) {
 
     // Check if data length is valid
-    if ((nullptr == pEvent->pdata) || (pEvent->sizeData < 4)) {
+    if ((nullptr == ev.pdata) || (ev.sizeData < 4)) {
       return VSCP_ERROR_ERROR;
     }
 
-    return pEvent->pdata[3];
+    return ev.pdata[3];
   }
-  else if ((VSCP_CLASS2_MEASUREMENT_FLOAT == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS2_MEASUREMENT_FLOAT == ev.vscp_class)) {
 
     // Check if data length is valid
-    if ((nullptr == pEvent->pdata) || (12 != pEvent->sizeData)) {
+    if ((nullptr == ev.pdata) || (12 != ev.sizeData)) {
       return VSCP_ERROR_ERROR;
     }
 
-    return pEvent->pdata[3];
+    return ev.pdata[3];
   }
 
   return VSCP_ERROR_ERROR;
 }
 
 //////////////////////////////////////////////////////////////////////////////
-// vscp_getMeasurementUnitEx
+// vscp_getMeasurementUnit
 //
 
 int
-vscp_getMeasurementUnitEx(const vscpEventEx *pEventEx)
+vscp_getMeasurementUnit(const vscpEvent *pEvent)
 {
-  vscpEvent *pev = new vscpEvent;
-  if (nullptr == pev) {
-    return false;
+  // Check pointer
+  if (nullptr == pEvent) {
+    return VSCP_ERROR_ERROR;
   }
 
-  pev->pdata    = nullptr;
-  pev->sizeData = 0;
+  return vscp_getMeasurementUnit(vscp_event_view(*pEvent));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// vscp_getMeasurementUnitEx
+//
 
-  if (!vscp_convertEventExToEvent(pev, pEventEx)) {
-    vscp_deleteEvent(pev);
-    return false;
+int
+vscp_getMeasurementUnitEx(const vscpEventEx *pEventEx)
+{
+  // Check pointer
+  if (nullptr == pEventEx) {
+    return VSCP_ERROR_ERROR;
   }
 
-  int rv = vscp_getMeasurementUnit(pev);
-  vscp_deleteEvent(pev);
-
-  return rv;
+  return vscp_getMeasurementUnit(vscp_event_view(*pEventEx));
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2401,90 +2531,94 @@ vscp_getMeasurementUnitEx(const vscpEventEx *pEventEx)
 //
 
 int
-vscp_getMeasurementSensorIndex(const vscpEvent *pEvent)
+vscp_getMeasurementSensorIndex(const vscp_event_view &ev)
 {
   int offset = 0;
 
   // Must have valid event and data
-  if ((nullptr == pEvent) || (nullptr == pEvent->pdata) || !pEvent->sizeData) {
+  if ((nullptr == ev.pdata) || !ev.sizeData) {
     return -1;
   }
 
   // If class >= 512 and class < 1024 we
   // have GUID in front of data.
-  if ((pEvent->vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) && (pEvent->vscp_class < VSCP_CLASS2_PROTOCOL)) {
+  if ((ev.vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) && (ev.vscp_class < VSCP_CLASS2_PROTOCOL)) {
     offset = 16;
   }
 
-  if ((VSCP_CLASS1_MEASUREMENT == pEvent->vscp_class) || (VSCP_CLASS1_DATA == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT == pEvent->vscp_class)) {
+  if ((VSCP_CLASS1_MEASUREMENT == ev.vscp_class) || (VSCP_CLASS1_DATA == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT == ev.vscp_class)) {
 
-    return VSCP_DATACODING_INDEX(pEvent->pdata[offset + 0]);
+    return VSCP_DATACODING_INDEX(ev.pdata[offset + 0]);
   }
-  else if ((VSCP_CLASS1_MEASUREZONE == pEvent->vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREZONE == pEvent->vscp_class) ||
-           (VSCP_CLASS1_SETVALUEZONE == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_SETVALUEZONE == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREZONE == ev.vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREZONE == ev.vscp_class) ||
+           (VSCP_CLASS1_SETVALUEZONE == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_SETVALUEZONE == ev.vscp_class)) {
 
-    if ((nullptr == pEvent->pdata) || (pEvent->sizeData >= (offset + 3))) {
+    if ((nullptr == ev.pdata) || (ev.sizeData < (offset + 3))) {
       return -1;
     }
 
-    return pEvent->pdata[offset + 0];
+    return ev.pdata[offset + 0];
   }
-  else if ((VSCP_CLASS1_MEASUREMENT32 == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREMENT32 == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == ev.vscp_class)) {
     return 0; // Sensor index is always zero
   }
-  else if ((VSCP_CLASS1_MEASUREMENT64 == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREMENT64 == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == ev.vscp_class)) {
     return 0; // Sensor index is always zero
   }
-  else if ((VSCP_CLASS2_MEASUREMENT_STR == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS2_MEASUREMENT_STR == ev.vscp_class)) {
 
     // Check if data length is valid
-    if ((nullptr == pEvent->pdata) || (pEvent->sizeData < 4)) {
+    if ((nullptr == ev.pdata) || (ev.sizeData < 4)) {
       return VSCP_ERROR_ERROR;
     }
 
-    return pEvent->pdata[0];
+    return ev.pdata[0];
   }
-  else if ((VSCP_CLASS2_MEASUREMENT_FLOAT == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS2_MEASUREMENT_FLOAT == ev.vscp_class)) {
 
     // Check if data length is valid
-    if ((nullptr == pEvent->pdata) || (12 != pEvent->sizeData)) {
+    if ((nullptr == ev.pdata) || (12 != ev.sizeData)) {
       return VSCP_ERROR_ERROR;
     }
 
-    return pEvent->pdata[0];
+    return ev.pdata[0];
   }
 
   return VSCP_ERROR_ERROR;
 }
 
 //////////////////////////////////////////////////////////////////////////////
-// vscp_getMeasurementSensorIndexEx
+// vscp_getMeasurementSensorIndex
 //
 
 int
-vscp_getMeasurementSensorIndexEx(const vscpEventEx *pEventEx)
+vscp_getMeasurementSensorIndex(const vscpEvent *pEvent)
 {
-  vscpEvent *pev = new vscpEvent;
-  if (nullptr == pev) {
-    return false;
+  // Check pointer
+  if (nullptr == pEvent) {
+    return VSCP_ERROR_ERROR;
   }
 
-  pev->pdata    = nullptr;
-  pev->sizeData = 0;
+  return vscp_getMeasurementSensorIndex(vscp_event_view(*pEvent));
+}
 
-  if (!vscp_convertEventExToEvent(pev, pEventEx)) {
-    vscp_deleteEvent(pev);
-    return false;
-  }
+//////////////////////////////////////////////////////////////////////////////
+// vscp_getMeasurementSensorIndexEx
+//
 
-  int rv = vscp_getMeasurementSensorIndex(pev);
-  vscp_deleteEvent(pev);
+int
+vscp_getMeasurementSensorIndexEx(const vscpEventEx *pEventEx)
+{
+  // Check pointer
+  if (nullptr == pEventEx) {
+    return VSCP_ERROR_ERROR;
+  }
 
-  return rv;
+  return vscp_getMeasurementSensorIndex(vscp_event_view(*pEventEx));
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2492,89 +2626,94 @@ vscp_getMeasurementSensorIndexEx(const vscpEventEx *pEventEx)
 //
 
 int
-vscp_getMeasurementZone(const vscpEvent *pEvent)
+vscp_getMeasurementZone(const vscp_event_view &ev)
 {
   int offset = 0;
 
   // Must have valid event and data
-  if ((nullptr == pEvent) || (nullptr == pEvent->pdata) || !pEvent->sizeData) {
+  if ((nullptr == ev.pdata) || !ev.sizeData) {
     return -1;
   }
 
   // If class >= 512 and class < 1024 we
   // have GUID in front of data.
-  if ((pEvent->vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) && (pEvent->vscp_class < VSCP_CLASS2_PROTOCOL)) {
+  if ((ev.vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) && (ev.vscp_class < VSCP_CLASS2_PROTOCOL)) {
     offset = 16;
   }
 
-  if ((VSCP_CLASS1_MEASUREMENT == pEvent->vscp_class) || (VSCP_CLASS1_DATA == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT == pEvent->vscp_class)) {
+  if ((VSCP_CLASS1_MEASUREMENT == ev.vscp_class) || (VSCP_CLASS1_DATA == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT == ev.vscp_class)) {
 
     return 0; // Always zero
   }
-  else if ((VSCP_CLASS1_MEASUREZONE == pEvent->vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREZONE == pEvent->vscp_class) ||
-           (VSCP_CLASS1_SETVALUEZONE == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_SETVALUEZONE == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREZONE == ev.vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREZONE == ev.vscp_class) ||
+           (VSCP_CLASS1_SETVALUEZONE == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_SETVALUEZONE == ev.vscp_class)) {
 
-    if ((nullptr == pEvent->pdata) || (pEvent->sizeData >= (offset + 3))) {
+    if ((nullptr == ev.pdata) || (ev.sizeData < (offset + 3))) {
       return 0;
     }
 
-    return pEvent->pdata[offset + 1];
+    return ev.pdata[offset + 1];
   }
-  else if ((VSCP_CLASS1_MEASUREMENT32 == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREMENT32 == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == ev.vscp_class)) {
     return 0; // Sensor index is always zero
   }
-  else if ((VSCP_CLASS1_MEASUREMENT64 == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREMENT64 == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == ev.vscp_class)) {
     return 0; // Sensor index is always zero
   }
-  else if ((VSCP_CLASS2_MEASUREMENT_STR == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS2_MEASUREMENT_STR == ev.vscp_class)) {
 
     // Check if data length is valid
-    if ((nullptr == pEvent->pdata) || (pEvent->sizeData < 4)) {
+    if ((nullptr == ev.pdata) || (ev.sizeData < 4)) {
       return VSCP_ERROR_ERROR;
     }
 
-    return pEvent->pdata[2];
+    return ev.pdata[2];
   }
-  else if ((VSCP_CLASS2_MEASUREMENT_FLOAT == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS2_MEASUREMENT_FLOAT == ev.vscp_class)) {
 
     // Check if data length is valid
-    if ((nullptr == pEvent->pdata) || (12 != pEvent->sizeData)) {
+    if ((nullptr == ev.pdata) || (12 != ev.sizeData)) {
       return VSCP_ERROR_ERROR;
     }
 
-    return pEvent->pdata[2];
+    return ev.pdata[2];
   }
 
   return VSCP_ERROR_ERROR;
 }
 
 //////////////////////////////////////////////////////////////////////////////
-// vscp_getMeasurementZoneEx
+// vscp_getMeasurementZone
 //
 
 int
-vscp_getMeasurementZoneEx(const vscpEventEx *pEventEx)
+vscp_getMeasurementZone(const vscpEvent *pEvent)
 {
-  vscpEvent *pev = new vscpEvent;
-  if (nullptr == pev) {
-    return false;
+  // Check pointer
+  if (nullptr == pEvent) {
+    return VSCP_ERROR_ERROR;
   }
-  pev->pdata    = nullptr;
-  pev->sizeData = 0;
 
-  if (!vscp_convertEventExToEvent(pev, pEventEx)) {
-    vscp_deleteEvent(pev);
-    return false;
-  }
+  return vscp_getMeasurementZone(vscp_event_view(*pEvent));
+}
 
-  int rv = vscp_getMeasurementZone(pev);
-  vscp_deleteEvent(pev);
+//////////////////////////////////////////////////////////////////////////////
+// vscp_getMeasurementZoneEx
+//
 
-  return rv;
+int
+vscp_getMeasurementZoneEx(const vscpEventEx *pEventEx)
+{
+  // Check pointer
+  if (nullptr == pEventEx) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  return vscp_getMeasurementZone(vscp_event_view(*pEventEx));
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2582,62 +2721,81 @@ vscp_getMeasurementZoneEx(const vscpEventEx *pEventEx)
 //
 
 int
-vscp_getMeasurementSubZone(const vscpEvent *pEvent)
+vscp_getMeasurementSubZone(const vscp_event_view &ev)
 {
   int offset = 0;
 
   // Must have valid event and data
-  if ((nullptr == pEvent) || (nullptr == pEvent->pdata) || !pEvent->sizeData) {
+  if ((nullptr == ev.pdata) || !ev.sizeData) {
     return -1;
   }
 
   // If class >= 512 and class < 1024 we
   // have GUID in front of data.
-  if ((pEvent->vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) && (pEvent->vscp_class < VSCP_CLASS2_PROTOCOL)) {
+  if ((ev.vscp_class >= VSCP_CLASS2_LEVEL1_PROTOCOL) && (ev.vscp_class < VSCP_CLASS2_PROTOCOL)) {
     offset = 16;
   }
 
-  if ((VSCP_CLASS1_MEASUREMENT == pEvent->vscp_class) || (VSCP_CLASS1_DATA == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREZONE == pEvent->vscp_class) || (VSCP_CLASS1_SETVALUEZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_SETVALUEZONE == pEvent->vscp_class)) {
+  if ((VSCP_CLASS1_MEASUREMENT == ev.vscp_class) || (VSCP_CLASS1_DATA == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT == ev.vscp_class)) {
 
-    if ((nullptr == pEvent->pdata) || (pEvent->sizeData >= (offset + 1))) {
+    return 0; // Always zero
+  }
+  else if ((VSCP_CLASS1_MEASUREZONE == ev.vscp_class) || (VSCP_CLASS2_LEVEL1_MEASUREZONE == ev.vscp_class) ||
+           (VSCP_CLASS1_SETVALUEZONE == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_SETVALUEZONE == ev.vscp_class)) {
+
+    if ((nullptr == ev.pdata) || (ev.sizeData < (offset + 3))) {
       return 0;
     }
 
-    return 0; // Always zero
+    return ev.pdata[offset + 2];
   }
-  else if ((VSCP_CLASS1_MEASUREMENT32 == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREMENT32 == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == ev.vscp_class)) {
     return 0; // Sensor index is always zero
   }
-  else if ((VSCP_CLASS1_MEASUREMENT64 == pEvent->vscp_class) ||
-           (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS1_MEASUREMENT64 == ev.vscp_class) ||
+           (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == ev.vscp_class)) {
     return 0; // Sensor index is always zero
   }
-  else if ((VSCP_CLASS2_MEASUREMENT_STR == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS2_MEASUREMENT_STR == ev.vscp_class)) {
 
     // Check if data length is valid
-    if ((nullptr == pEvent->pdata) || (pEvent->sizeData < 4)) {
+    if ((nullptr == ev.pdata) || (ev.sizeData < 4)) {
       return VSCP_ERROR_ERROR;
     }
 
-    return pEvent->pdata[offset + 2];
+    return ev.pdata[offset + 2];
   }
-  else if ((VSCP_CLASS2_MEASUREMENT_FLOAT == pEvent->vscp_class)) {
+  else if ((VSCP_CLASS2_MEASUREMENT_FLOAT == ev.vscp_class)) {
 
     // Check if data length is valid
-    if ((nullptr == pEvent->pdata) || (12 != pEvent->sizeData)) {
+    if ((nullptr == ev.pdata) || (12 != ev.sizeData)) {
       return VSCP_ERROR_ERROR;
     }
 
-    return pEvent->pdata[2];
+    return ev.pdata[2];
   }
 
   return VSCP_ERROR_ERROR;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// vscp_getMeasurementSubZone
+//
+
+int
+vscp_getMeasurementSubZone(const vscpEvent *pEvent)
+{
+  // Check pointer
+  if (nullptr == pEvent) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  return vscp_getMeasurementSubZone(vscp_event_view(*pEvent));
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // vscp_getMeasurementSubZoneEx
 //
@@ -2645,22 +2803,62 @@ vscp_getMeasurementSubZone(const vscpEvent *pEvent)
 int
 vscp_getMeasurementSubZoneEx(const vscpEventEx *pEventEx)
 {
-  vscpEvent *pev = new vscpEvent;
-  if (nullptr == pev) {
-    return false;
+  // Check pointer
+  if (nullptr == pEventEx) {
+    return VSCP_ERROR_ERROR;
   }
-  pev->pdata    = nullptr;
-  pev->sizeData = 0;
 
-  if (!vscp_convertEventExToEvent(pev, pEventEx)) {
-    vscp_deleteEvent(pev);
-    return false;
-  }
+  return vscp_getMeasurementSubZone(vscp_event_view(*pEventEx));
+}
 
-  int rv = vscp_getMeasurementSubZone(pev);
-  vscp_deleteEvent(pev);
+//////////////////////////////////////////////////////////////////////////////
+// vscp_isMeasurement
+//
 
-  return rv;
+bool
+vscp_isMeasurement(const vscp_event_view &ev)
+{
+  if ((VSCP_CLASS1_MEASUREMENT == ev.vscp_class) || (VSCP_CLASS1_MEASUREMENTX1 == ev.vscp_class) ||
+      (VSCP_CLASS1_MEASUREMENTX2 == ev.vscp_class) || (VSCP_CLASS1_MEASUREMENTX3 == ev.vscp_class) ||
+      (VSCP_CLASS1_MEASUREMENTX4 == ev.vscp_class) || (VSCP_CLASS1_DATA == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENTX1 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENTX2 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENTX3 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENTX4 == ev.vscp_class) || (VSCP_CLASS1_MEASUREZONE == ev.vscp_class) ||
+      (VSCP_CLASS1_MEASUREZONEX1 == ev.vscp_class) || (VSCP_CLASS1_MEASUREZONEX2 == ev.vscp_class) ||
+      (VSCP_CLASS1_MEASUREZONEX3 == ev.vscp_class) || (VSCP_CLASS1_MEASUREZONEX4 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREZONE == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREZONEX1 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREZONEX2 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREZONEX3 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREZONEX4 == ev.vscp_class) || (VSCP_CLASS1_SETVALUEZONE == ev.vscp_class) ||
+      (VSCP_CLASS1_SETVALUEZONEX1 == ev.vscp_class) || (VSCP_CLASS1_SETVALUEZONEX2 == ev.vscp_class) ||
+      (VSCP_CLASS1_SETVALUEZONEX3 == ev.vscp_class) || (VSCP_CLASS1_SETVALUEZONEX4 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_SETVALUEZONE == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_SETVALUEZONEX1 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_SETVALUEZONEX2 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_SETVALUEZONEX3 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_SETVALUEZONEX4 == ev.vscp_class) || (VSCP_CLASS1_MEASUREMENT32 == ev.vscp_class) ||
+      (VSCP_CLASS1_MEASUREMENT32X1 == ev.vscp_class) || (VSCP_CLASS1_MEASUREMENT32X2 == ev.vscp_class) ||
+      (VSCP_CLASS1_MEASUREMENT32X3 == ev.vscp_class) || (VSCP_CLASS1_MEASUREMENT32X4 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT32X1 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT32X2 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT32X3 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT32X4 == ev.vscp_class) || (VSCP_CLASS1_MEASUREMENT64 == ev.vscp_class) ||
+      (VSCP_CLASS1_MEASUREMENT64X1 == ev.vscp_class) || (VSCP_CLASS1_MEASUREMENT64X2 == ev.vscp_class) ||
+      (VSCP_CLASS1_MEASUREMENT64X3 == ev.vscp_class) || (VSCP_CLASS1_MEASUREMENT64X4 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT64X1 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT64X2 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT64X3 == ev.vscp_class) ||
+      (VSCP_CLASS2_LEVEL1_MEASUREMENT64X4 == ev.vscp_class) ||
+      (VSCP_CLASS2_MEASUREMENT_STR == ev.vscp_class) || (VSCP_CLASS2_MEASUREMENT_FLOAT == ev.vscp_class)) {
+    return true;
+  }
+
+  return false;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2670,47 +2868,12 @@ vscp_getMeasurementSubZoneEx(const vscpEventEx *pEventEx)
 bool
 vscp_isMeasurement(const vscpEvent *pEvent)
 {
-  if ((VSCP_CLASS1_MEASUREMENT == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREMENTX1 == pEvent->vscp_class) ||
-      (VSCP_CLASS1_MEASUREMENTX2 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREMENTX3 == pEvent->vscp_class) ||
-      (VSCP_CLASS1_MEASUREMENTX4 == pEvent->vscp_class) || (VSCP_CLASS1_DATA == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENTX1 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENTX2 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENTX3 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENTX4 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS1_MEASUREZONEX1 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREZONEX2 == pEvent->vscp_class) ||
-      (VSCP_CLASS1_MEASUREZONEX3 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREZONEX4 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREZONEX1 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREZONEX2 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREZONEX3 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREZONEX4 == pEvent->vscp_class) || (VSCP_CLASS1_SETVALUEZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS1_SETVALUEZONEX1 == pEvent->vscp_class) || (VSCP_CLASS1_SETVALUEZONEX2 == pEvent->vscp_class) ||
-      (VSCP_CLASS1_SETVALUEZONEX3 == pEvent->vscp_class) || (VSCP_CLASS1_SETVALUEZONEX4 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_SETVALUEZONE == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_SETVALUEZONEX1 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_SETVALUEZONEX2 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_SETVALUEZONEX3 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_SETVALUEZONEX4 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREMENT32 == pEvent->vscp_class) ||
-      (VSCP_CLASS1_MEASUREMENT32X1 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREMENT32X2 == pEvent->vscp_class) ||
-      (VSCP_CLASS1_MEASUREMENT32X3 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREMENT32X4 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT32 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT32X1 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT32X2 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT32X3 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT32X4 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREMENT64 == pEvent->vscp_class) ||
-      (VSCP_CLASS1_MEASUREMENT64X1 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREMENT64X2 == pEvent->vscp_class) ||
-      (VSCP_CLASS1_MEASUREMENT64X3 == pEvent->vscp_class) || (VSCP_CLASS1_MEASUREMENT64X4 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT64 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT64X1 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT64X2 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT64X3 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_LEVEL1_MEASUREMENT64X4 == pEvent->vscp_class) ||
-      (VSCP_CLASS2_MEASUREMENT_STR == pEvent->vscp_class) || (VSCP_CLASS2_MEASUREMENT_FLOAT == pEvent->vscp_class)) {
-    return true;
+  // Check pointer
+  if (nullptr == pEvent) {
+    return false;
   }
 
-  return false;
+  return vscp_isMeasurement(vscp_event_view(*pEvent));
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2720,22 +2883,12 @@ vscp_isMeasurement(const vscpEvent *pEvent)
 bool
 vscp_isMeasurementEx(const vscpEventEx *pEventEx)
 {
-  vscpEvent *pev = new vscpEvent;
-  if (nullptr == pev) {
-    return false;
-  }
-  pev->pdata    = nullptr;
-  pev->sizeData = 0;
-
-  if (!vscp_convertEventExToEvent(pev, pEventEx)) {
-    vscp_deleteEvent(pev);
+  // Check pointer
+  if (nullptr == pEventEx) {
     return false;
   }
 
-  bool rv = vscp_isMeasurement(pev);
-  vscp_deleteEvent(pev);
-
-  return rv;
+  return vscp_isMeasurement(vscp_event_view(*pEventEx));
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -4320,24 +4473,9 @@ vscp_writeGuidToString(std::string &strGUID, const vscpEvent *pEvent, vscp_guid_
       }
       // No leading 0xFF bytes - use standard format
       if (ffCount == 0) {
-        strGUID = vscp_str_format("%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:"
-                                  "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                                  pEvent->GUID[0],
-                                  pEvent->GUID[1],
-                                  pEvent->GUID[2],
-                                  pEvent->GUID[3],
-                                  pEvent->GUID[4],
-                                  pEvent->GUID[5],
-                                  pEvent->GUID[6],
-                                  pEvent->GUID[7],
-                                  pEvent->GUID[8],
-                                  pEvent->GUID[9],
-                                  pEvent->GUID[10],
-                                  pEvent->GUID[11],
-                                  pEvent->GUID[12],
-                                  pEvent->GUID[13],
-                                  pEvent->GUID[14],
-                                  pEvent->GUID[15]);
+        char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+        cguid::writeString(buf, pEvent->GUID);
+        strGUID.assign(buf, VSCP_GUID_STRING_LENGTH);
         return true;
       }
       // Some leading 0xFF bytes - use :: notation
@@ -4374,24 +4512,9 @@ vscp_writeGuidToString(std::string &strGUID, const vscpEvent *pEvent, vscp_guid_
 
     case VSCP_GUID_STR_FORMAT_NORMAL:
     default:
-      strGUID = vscp_str_format("%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:"
-                                "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                                pEvent->GUID[0],
-                                pEvent->GUID[1],
-                                pEvent->GUID[2],
-                                pEvent->GUID[3],
-                                pEvent->GUID[4],
-                                pEvent->GUID[5],
-                                pEvent->GUID[6],
-                                pEvent->GUID[7],
-                                pEvent->GUID[8],
-                                pEvent->GUID[9],
-                                pEvent->GUID[10],
-                                pEvent->GUID[11],
-                                pEvent->GUID[12],
-                                pEvent->GUID[13],
-                                pEvent->GUID[14],
-                                pEvent->GUID[15]);
+      char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+      cguid::writeString(buf, pEvent->GUID);
+      strGUID.assign(buf, VSCP_GUID_STRING_LENGTH);
       return true;
   }
 }
@@ -4422,24 +4545,9 @@ vscp_writeGuidToStringEx(std::string &strGUID, const vscpEventEx *pEvent, vscp_g
       }
       // No leading 0xFF bytes - use standard format
       if (ffCount == 0) {
-        strGUID = vscp_str_format("%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:"
-                                  "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                                  pEvent->GUID[0],
-                                  pEvent->GUID[1],
-                                  pEvent->GUID[2],
-                                  pEvent->GUID[3],
-                                  pEvent->GUID[4],
-                                  pEvent->GUID[5],
-                                  pEvent->GUID[6],
-                                  pEvent->GUID[7],
-                                  pEvent->GUID[8],
-                                  pEvent->GUID[9],
-                                  pEvent->GUID[10],
-                                  pEvent->GUID[11],
-                                  pEvent->GUID[12],
-                                  pEvent->GUID[13],
-                                  pEvent->GUID[14],
-                                  pEvent->GUID[15]);
+        char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+        cguid::writeString(buf, pEvent->GUID);
+        strGUID.assign(buf, VSCP_GUID_STRING_LENGTH);
         return true;
       }
       // Some leading 0xFF bytes - use :: notation
@@ -4476,24 +4584,9 @@ vscp_writeGuidToStringEx(std::string &strGUID, const vscpEventEx *pEvent, vscp_g
 
     case VSCP_GUID_STR_FORMAT_NORMAL:
     default:
-      strGUID = vscp_str_format("%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:"
-                                "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                                pEvent->GUID[0],
-                                pEvent->GUID[1],
-                                pEvent->GUID[2],
-                                pEvent->GUID[3],
-                                pEvent->GUID[4],
-                                pEvent->GUID[5],
-                                pEvent->GUID[6],
-                                pEvent->GUID[7],
-                                pEvent->GUID[8],
-                                pEvent->GUID[9],
-                                pEvent->GUID[10],
-                                pEvent->GUID[11],
-                                pEvent->GUID[12],
-                                pEvent->GUID[13],
-                                pEvent->GUID[14],
-                                pEvent->GUID[15]);
+      char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+      cguid::writeString(buf, pEvent->GUID);
+      strGUID.assign(buf, VSCP_GUID_STRING_LENGTH);
       return true;
   }
 }
@@ -4595,24 +4688,9 @@ vscp_writeGuidArrayToString(std::string &strGUID,
       }
       // No leading 0xFF bytes - use standard format
       if (ffCount == 0) {
-        strGUID = vscp_str_format("%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:"
-                                  "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                                  pGUID[0],
-                                  pGUID[1],
-                                  pGUID[2],
-                                  pGUID[3],
-                                  pGUID[4],
-                                  pGUID[5],
-                                  pGUID[6],
-                                  pGUID[7],
-                                  pGUID[8],
-                                  pGUID[9],
-                                  pGUID[10],
-                                  pGUID[11],
-                                  pGUID[12],
-                                  pGUID[13],
-                                  pGUID[14],
-                                  pGUID[15]);
+        char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+        cguid::writeString(buf, pGUID);
+        strGUID.assign(buf, VSCP_GUID_STRING_LENGTH);
         return true;
       }
       // Some leading 0xFF bytes - use :: notation
@@ -4670,24 +4748,9 @@ vscp_writeGuidArrayToString(std::string &strGUID,
                                   pGUID[15]);
       }
       else {
-        strGUID = vscp_str_format("%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:"
-                                  "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                                  pGUID[0],
-                                  pGUID[1],
-                                  pGUID[2],
-                                  pGUID[3],
-                                  pGUID[4],
-                                  pGUID[5],
-                                  pGUID[6],
-                                  pGUID[7],
-                                  pGUID[8],
-                                  pGUID[9],
-                                  pGUID[10],
-                                  pGUID[11],
-                                  pGUID[12],
-                                  pGUID[13],
-                                  pGUID[14],
-                                  pGUID[15]);
+        char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+        cguid::writeString(buf, pGUID);
+        strGUID.assign(buf, VSCP_GUID_STRING_LENGTH);
       }
       return true;
   }
@@ -5127,24 +5190,19 @@ setFrameVersion(vscpEventEx *pEventEx, uint16_t version)
 //
 
 bool
-vscp_getDateStringFromEvent(std::string &dt, const vscpEvent *pEvent)
+vscp_getDateStringFromEvent(std::string &dt, const vscp_event_view &ev)
 {
-  // Check pointer
-  if (nullptr == pEvent) {
-    return false;
-  }
-
   // Return empty string if all date/time values is zero
   dt.clear();
 
   // Check frame version
-  uint16_t frameVersion = pEvent->head & VSCP_HEADER16_FRAME_VERSION_MASK;
+  uint16_t frameVersion = ev.head & VSCP_HEADER16_FRAME_VERSION_MASK;
 
   if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
     // UNIX_NS frame: convert nanoseconds since epoch to ISO 8601 string
-    if (pEvent->timestamp_ns > 0) {
-      time_t secs        = static_cast<time_t>(pEvent->timestamp_ns / 1000000000ULL);
-      uint32_t nanos     = static_cast<uint32_t>(pEvent->timestamp_ns % 1000000000ULL);
+    if (ev.timestamp_ns > 0) {
+      time_t secs        = static_cast<time_t>(ev.timestamp_ns / 1000000000ULL);
+      uint32_t nanos     = static_cast<uint32_t>(ev.timestamp_ns % 1000000000ULL);
       struct tm *tm_info = gmtime(&secs);
       if (tm_info != nullptr) {
         dt = vscp_str_format("%04d-%02d-%02dT%02d:%02d:%02d.%09uZ",
@@ -5160,14 +5218,14 @@ vscp_getDateStringFromEvent(std::string &dt, const vscpEvent *pEvent)
   }
   else {
     // ORIGINAL frame: use year/month/day/hour/minute/second fields
-    if (pEvent->year || pEvent->month || pEvent->day || pEvent->hour || pEvent->minute || pEvent->second) {
+    if (ev.year || ev.month || ev.day || ev.hour || ev.minute || ev.second) {
       dt = vscp_str_format("%04d-%02d-%02dT%02d:%02d:%02dZ",
-                           (int) pEvent->year,
-                           (int) pEvent->month,
-                           (int) pEvent->day,
-                           (int) pEvent->hour,
-                           (int) pEvent->minute,
-                           (int) pEvent->second);
+                           (int) ev.year,
+                           (int) ev.month,
+                           (int) ev.day,
+                           (int) ev.hour,
+                           (int) ev.minute,
+                           (int) ev.second);
     }
   }
 
@@ -5175,54 +5233,33 @@ vscp_getDateStringFromEvent(std::string &dt, const vscpEvent *pEvent)
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
-// vscp_getDateStringFromEventEx
+// vscp_getDateStringFromEvent
 //
 
 bool
-vscp_getDateStringFromEventEx(std::string &dt, const vscpEventEx *pEventEx)
+vscp_getDateStringFromEvent(std::string &dt, const vscpEvent *pEvent)
 {
   // Check pointer
-  if (nullptr == pEventEx) {
+  if (nullptr == pEvent) {
     return false;
   }
 
-  dt.clear();
+  return vscp_getDateStringFromEvent(dt, vscp_event_view(*pEvent));
+}
 
-  // Check frame version
-  uint16_t frameVersion = pEventEx->head & VSCP_HEADER16_FRAME_VERSION_MASK;
+////////////////////////////////////////////////////////////////////////////////////
+// vscp_getDateStringFromEventEx
+//
 
-  if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
-    // UNIX_NS frame: convert nanoseconds since epoch to ISO 8601 string
-    if (pEventEx->timestamp_ns > 0) {
-      time_t secs        = static_cast<time_t>(pEventEx->timestamp_ns / 1000000000ULL);
-      uint32_t nanos     = static_cast<uint32_t>(pEventEx->timestamp_ns % 1000000000ULL);
-      struct tm *tm_info = gmtime(&secs);
-      if (tm_info != nullptr) {
-        dt = vscp_str_format("%04d-%02d-%02dT%02d:%02d:%02d.%09uZ",
-                             tm_info->tm_year + 1900,
-                             tm_info->tm_mon + 1,
-                             tm_info->tm_mday,
-                             tm_info->tm_hour,
-                             tm_info->tm_min,
-                             tm_info->tm_sec,
-                             nanos);
-      }
-    }
-  }
-  else {
-    // ORIGINAL frame: use year/month/day/hour/minute/second fields
-    if (pEventEx->year || pEventEx->month || pEventEx->day || pEventEx->hour || pEventEx->minute || pEventEx->second) {
-      dt = vscp_str_format("%04d-%02d-%02dT%02d:%02d:%02dZ",
-                           (int) pEventEx->year,
-                           (int) pEventEx->month,
-                           (int) pEventEx->day,
-                           (int) pEventEx->hour,
-                           (int) pEventEx->minute,
-                           (int) pEventEx->second);
-    }
+bool
+vscp_getDateStringFromEventEx(std::string &dt, const vscpEventEx *pEventEx)
+{
+  // Check pointer
+  if (nullptr == pEventEx) {
+    return false;
   }
 
-  return true;
+  return vscp_getDateStringFromEvent(dt, vscp_event_view(*pEventEx));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -5233,47 +5270,42 @@ vscp_getDateStringFromEventEx(std::string &dt, const vscpEventEx *pEventEx)
 //
 
 bool
-vscp_convertEventToJSON(std::string &strJSON, const vscpEvent *pEvent)
+vscp_convertEventToJSON(std::string &strJSON, const vscp_event_view &ev)
 {
   std::string strguid;
   std::string strdata;
 
-  // Check pointer
-  if (nullptr == pEvent) {
-    return false;
-  }
-
-  vscp_writeGuidArrayToString(strguid, pEvent->GUID); // GUID to string
-  vscp_writeDataWithSizeToString(strdata, pEvent->pdata, pEvent->sizeData, false, false, true);
+  vscp_writeGuidArrayToString(strguid, ev.GUID); // GUID to string
+  vscp_writeDataWithSizeToString(strdata, ev.pdata, ev.sizeData, false, false, true);
 
   std::string dt;
-  vscp_getDateStringFromEvent(dt, pEvent);
+  vscp_getDateStringFromEvent(dt, ev);
 
   // Determine the nanosecond timestamp to use
   uint64_t timestamp_ns;
-  uint16_t frameVersion = pEvent->head & VSCP_HEADER16_FRAME_VERSION_MASK;
+  uint16_t frameVersion = ev.head & VSCP_HEADER16_FRAME_VERSION_MASK;
 
   if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
     // Already has nanosecond timestamp
-    timestamp_ns = pEvent->timestamp_ns;
+    timestamp_ns = ev.timestamp_ns;
   }
   else {
     // Original frame format - convert date/time fields to nanoseconds
     struct tm tm;
     memset(&tm, 0, sizeof(tm));
-    tm.tm_year = pEvent->year - 1900;
-    tm.tm_mon  = pEvent->month - 1;
-    tm.tm_mday = pEvent->day;
-    tm.tm_hour = pEvent->hour;
-    tm.tm_min  = pEvent->minute;
-    tm.tm_sec  = pEvent->second;
+    tm.tm_year = ev.year - 1900;
+    tm.tm_mon  = ev.month - 1;
+    tm.tm_mday = ev.day;
+    tm.tm_hour = ev.hour;
+    tm.tm_min  = ev.minute;
+    tm.tm_sec  = ev.second;
     time_t t   = timegm(&tm);
     // Convert to nanoseconds and add microsecond timestamp as microseconds
-    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) pEvent->timestamp * 1000ULL;
+    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) ev.timestamp * 1000ULL;
   }
 
   // Set head with UNIX_NS frame version
-  uint16_t head = (pEvent->head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  uint16_t head = (ev.head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
 
   // Always output with timestamp_ns as hex string
   strJSON = vscp_str_format("{\n"
@@ -5288,11 +5320,11 @@ vscp_convertEventToJSON(std::string &strJSON, const vscpEvent *pEvent)
                             "\"note\": \"%s\"\n"
                             "}",
                             (unsigned short int) head,
-                            (unsigned long) pEvent->obid,
+                            (unsigned long) ev.obid,
                             (const char *) dt.c_str(),
                             (unsigned long long) timestamp_ns,
-                            (unsigned short int) pEvent->vscp_class,
-                            (unsigned short int) pEvent->vscp_type,
+                            (unsigned short int) ev.vscp_class,
+                            (unsigned short int) ev.vscp_type,
                             (const char *) strguid.c_str(),
                             (const char *) strdata.c_str(),
                             "");
@@ -5300,6 +5332,24 @@ vscp_convertEventToJSON(std::string &strJSON, const vscpEvent *pEvent)
   return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////
+// vscp_convertEventToJSON
+//
+// Always outputs frame with timestamp_ns as hex string.
+// For original frame format, converts date/time fields to nanoseconds first.
+//
+
+bool
+vscp_convertEventToJSON(std::string &strJSON, const vscpEvent *pEvent)
+{
+  // Check pointer
+  if (nullptr == pEvent) {
+    return false;
+  }
+
+  return vscp_convertEventToJSON(strJSON, vscp_event_view(*pEvent));
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 // vscp_convertJSONToEvent
 //
@@ -5507,69 +5557,12 @@ vscp_convertJSONToEvent(vscpEvent *pEvent, std::string &strJSON)
 bool
 vscp_convertEventExToJSON(std::string &strJSON, const vscpEventEx *pEventEx)
 {
-  std::string strguid;
-  std::string strdata;
-
   // Check pointer
   if (nullptr == pEventEx) {
     return false;
   }
 
-  vscp_writeGuidArrayToString(strguid, pEventEx->GUID); // GUID to string
-  vscp_writeDataWithSizeToString(strdata, pEventEx->data, pEventEx->sizeData, false, false, true);
-
-  std::string dt;
-  vscp_getDateStringFromEventEx(dt, pEventEx);
-
-  // Determine the nanosecond timestamp to use
-  uint64_t timestamp_ns;
-  uint16_t frameVersion = pEventEx->head & VSCP_HEADER16_FRAME_VERSION_MASK;
-
-  if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
-    // Already has nanosecond timestamp
-    timestamp_ns = pEventEx->timestamp_ns;
-  }
-  else {
-    // Original frame format - convert date/time fields to nanoseconds
-    struct tm tm;
-    memset(&tm, 0, sizeof(tm));
-    tm.tm_year = pEventEx->year - 1900;
-    tm.tm_mon  = pEventEx->month - 1;
-    tm.tm_mday = pEventEx->day;
-    tm.tm_hour = pEventEx->hour;
-    tm.tm_min  = pEventEx->minute;
-    tm.tm_sec  = pEventEx->second;
-    time_t t   = timegm(&tm);
-    // Convert to nanoseconds and add microsecond timestamp as microseconds
-    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) pEventEx->timestamp * 1000ULL;
-  }
-
-  // Set head with UNIX_NS frame version
-  uint16_t head = (pEventEx->head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
-
-  // Always output with timestamp_ns as hex string
-  strJSON = vscp_str_format("{\n"
-                            "\"head\": %d,\n"
-                            "\"obid\": %lu,\n"
-                            "\"datetime\": \"%s\",\n"
-                            "\"timestamp_ns\": \"0x%016llx\",\n"
-                            "\"class\": %d,\n"
-                            "\"type\": %d,\n"
-                            "\"guid\": \"%s\",\n"
-                            "\"data\": [%s],\n"
-                            "\"note\": \"%s\"\n"
-                            "}",
-                            (unsigned short int) head,
-                            (unsigned long) pEventEx->obid,
-                            (const char *) dt.c_str(),
-                            (unsigned long long) timestamp_ns,
-                            (unsigned short int) pEventEx->vscp_class,
-                            (unsigned short int) pEventEx->vscp_type,
-                            (const char *) strguid.c_str(),
-                            (const char *) strdata.c_str(),
-                            "");
-
-  return true;
+  return vscp_convertEventToJSON(strJSON, vscp_event_view(*pEventEx));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -5767,48 +5760,43 @@ vscp_convertJSONToEventEx(vscpEventEx *pEventEx, std::string &strJSON)
 //
 
 bool
-vscp_convertEventToXML(std::string &strXML, vscpEvent *pEvent)
+vscp_convertEventToXML(std::string &strXML, const vscp_event_view &ev)
 {
   std::string strguid;
   std::string strdata;
 
-  // Check pointer
-  if (nullptr == pEvent) {
-    return false;
-  }
-
-  vscp_writeGuidArrayToString(strguid, pEvent->GUID); // GUID to string
-  vscp_writeDataWithSizeToString(strdata, pEvent->pdata, pEvent->sizeData, false,
+  vscp_writeGuidArrayToString(strguid, ev.GUID); // GUID to string
+  vscp_writeDataWithSizeToString(strdata, ev.pdata, ev.sizeData, false,
                                  false); // Event data to string
 
   std::string dt;
-  vscp_getDateStringFromEvent(dt, pEvent);
+  vscp_getDateStringFromEvent(dt, ev);
 
   // Determine the nanosecond timestamp to use
   uint64_t timestamp_ns;
-  uint16_t frameVersion = pEvent->head & VSCP_HEADER16_FRAME_VERSION_MASK;
+  uint16_t frameVersion = ev.head & VSCP_HEADER16_FRAME_VERSION_MASK;
 
   if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
     // Already has nanosecond timestamp
-    timestamp_ns = pEvent->timestamp_ns;
+    timestamp_ns = ev.timestamp_ns;
   }
   else {
     // Original frame format - convert date/time fields to nanoseconds
     struct tm tm;
     memset(&tm, 0, sizeof(tm));
-    tm.tm_year = pEvent->year - 1900;
-    tm.tm_mon  = pEvent->month - 1;
-    tm.tm_mday = pEvent->day;
-    tm.tm_hour = pEvent->hour;
-    tm.tm_min  = pEvent->minute;
-    tm.tm_sec  = pEvent->second;
+    tm.tm_year = ev.year - 1900;
+    tm.tm_mon  = ev.month - 1;
+    tm.tm_mday = ev.day;
+    tm.tm_hour = ev.hour;
+    tm.tm_min  = ev.minute;
+    tm.tm_sec  = ev.second;
     time_t t   = timegm(&tm);
     // Convert to nanoseconds and add microsecond timestamp as microseconds
-    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) pEvent->timestamp * 1000ULL;
+    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) ev.timestamp * 1000ULL;
   }
 
   // Set head with UNIX_NS frame version
-  uint16_t head = (pEvent->head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  uint16_t head = (ev.head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
 
   // Always output with nanosecond timestamp
   strXML = vscp_str_format("<event "
@@ -5822,17 +5810,35 @@ vscp_convertEventToXML(std::string &strXML, vscpEvent *pEvent)
                            "data=\"%s\" "
                            "/>",
                            (unsigned short int) head,
-                           (unsigned long) pEvent->obid,
+                           (unsigned long) ev.obid,
                            (const char *) dt.c_str(),
                            (unsigned long long) timestamp_ns,
-                           (unsigned short int) pEvent->vscp_class,
-                           (unsigned short int) pEvent->vscp_type,
+                           (unsigned short int) ev.vscp_class,
+                           (unsigned short int) ev.vscp_type,
                            (const char *) strguid.c_str(),
                            (const char *) strdata.c_str());
 
   return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////
+// vscp_convertEventToXML
+//
+// Always outputs frame version 1 (UNIX_NS) with nanosecond timestamp.
+// For original frame format, converts date/time fields to nanoseconds first.
+//
+
+bool
+vscp_convertEventToXML(std::string &strXML, vscpEvent *pEvent)
+{
+  // Check pointer
+  if (nullptr == pEvent) {
+    return false;
+  }
+
+  return vscp_convertEventToXML(strXML, vscp_event_view(*pEvent));
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 // vscp_convertXMLToEvent
 //
@@ -5985,78 +5991,22 @@ vscp_convertXMLToEvent(vscpEvent *pEvent, std::string &strXML)
   return true;
 }
 
-////////////////////////////////////////////////////////////////////////////////////
-// vscp_convertEventExToXML
-//
-// Always outputs frame version 1 (UNIX_NS) with nanosecond timestamp.
-// For original frame format, converts date/time fields to nanoseconds first.
-//
-
-bool
-vscp_convertEventExToXML(std::string &strXML, vscpEventEx *pEventEx)
-{
-  std::string strguid;
-  std::string strdata;
-
-  // Check pointer
-  if (nullptr == pEventEx) {
-    return false;
-  }
-
-  vscp_writeGuidArrayToString(strguid, pEventEx->GUID); // GUID to string
-  vscp_writeDataWithSizeToString(strdata, pEventEx->data, pEventEx->sizeData, false,
-                                 false); // Event data to string
-
-  std::string dt;
-  vscp_getDateStringFromEventEx(dt, pEventEx);
-
-  // Determine the nanosecond timestamp to use
-  uint64_t timestamp_ns;
-  uint16_t frameVersion = pEventEx->head & VSCP_HEADER16_FRAME_VERSION_MASK;
-
-  if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
-    // Already has nanosecond timestamp
-    timestamp_ns = pEventEx->timestamp_ns;
-  }
-  else {
-    // Original frame format - convert date/time fields to nanoseconds
-    struct tm tm;
-    memset(&tm, 0, sizeof(tm));
-    tm.tm_year = pEventEx->year - 1900;
-    tm.tm_mon  = pEventEx->month - 1;
-    tm.tm_mday = pEventEx->day;
-    tm.tm_hour = pEventEx->hour;
-    tm.tm_min  = pEventEx->minute;
-    tm.tm_sec  = pEventEx->second;
-    time_t t   = timegm(&tm);
-    // Convert to nanoseconds and add microsecond timestamp as microseconds
-    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) pEventEx->timestamp * 1000ULL;
-  }
-
-  // Set head with UNIX_NS frame version
-  uint16_t head = (pEventEx->head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
-
-  // Always output with nanosecond timestamp
-  strXML = vscp_str_format("<event "
-                           "head=\"%d\" "
-                           "obid=\"%lu\" "
-                           "datetime=\"%s\" "
-                           "timestamp=\"%llu\" "
-                           "class=\"%d\" "
-                           "type=\"%d\" "
-                           "guid=\"%s\" "
-                           "data=\"%s\" "
-                           "/>",
-                           (unsigned short int) head,
-                           (unsigned long) pEventEx->obid,
-                           (const char *) dt.c_str(),
-                           (unsigned long long) timestamp_ns,
-                           (unsigned short int) pEventEx->vscp_class,
-                           (unsigned short int) pEventEx->vscp_type,
-                           (const char *) strguid.c_str(),
-                           (const char *) strdata.c_str());
+////////////////////////////////////////////////////////////////////////////////////
+// vscp_convertEventExToXML
+//
+// Always outputs frame version 1 (UNIX_NS) with nanosecond timestamp.
+// For original frame format, converts date/time fields to nanoseconds first.
+//
 
-  return true;
+bool
+vscp_convertEventExToXML(std::string &strXML, vscpEventEx *pEventEx)
+{
+  // Check pointer
+  if (nullptr == pEventEx) {
+    return false;
+  }
+
+  return vscp_convertEventToXML(strXML, vscp_event_view(*pEventEx));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -6214,25 +6164,20 @@ vscp_convertXMLToEventEx(vscpEventEx *pEventEx, std::string &strXML)
 //
 
 bool
-vscp_convertEventToHTML(std::string &strHTML, vscpEvent *pEvent)
+vscp_convertEventToHTML(std::string &strHTML, const vscp_event_view &ev)
 {
   std::string strguid;
   std::string strdata;
 
-  // Check pointer
-  if (nullptr == pEvent) {
-    return false;
-  }
-
-  vscp_writeGuidArrayToString(strguid, pEvent->GUID); // GUID to string
-  vscp_writeDataWithSizeToString(strdata, pEvent->pdata, pEvent->sizeData, false,
+  vscp_writeGuidArrayToString(strguid, ev.GUID); // GUID to string
+  vscp_writeDataWithSizeToString(strdata, ev.pdata, ev.sizeData, false,
                                  false); // Event data to string
 
   std::string dt;
-  vscp_getDateStringFromEvent(dt, pEvent);
+  vscp_getDateStringFromEvent(dt, ev);
 
   // Check frame version for timestamp handling
-  uint16_t frameVersion = pEvent->head & VSCP_HEADER16_FRAME_VERSION_MASK;
+  uint16_t frameVersion = ev.head & VSCP_HEADER16_FRAME_VERSION_MASK;
 
   if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
     // UNIX_NS frame: use 64-bit nanosecond timestamp
@@ -6257,29 +6202,29 @@ vscp_convertEventToHTML(std::string &strHTML, vscpEvent *pEvent)
                               "obid: %lu <br>"
                               "note: %s <br>"
                               "</p>",
-                              (unsigned short int) pEvent->vscp_class,
-                              (unsigned short int) pEvent->vscp_type,
-                              (unsigned short int) pEvent->sizeData,
+                              (unsigned short int) ev.vscp_class,
+                              (unsigned short int) ev.vscp_type,
+                              (unsigned short int) ev.sizeData,
                               (const char *) strdata.c_str(),
                               (const char *) strguid.c_str(),
-                              (unsigned short int) pEvent->head,
+                              (unsigned short int) ev.head,
                               (const char *) dt.c_str(),
-                              (unsigned long long) pEvent->timestamp_ns,
-                              (unsigned long) pEvent->obid,
+                              (unsigned long long) ev.timestamp_ns,
+                              (unsigned long) ev.obid,
                               "");
   }
   else {
     // ORIGINAL frame: use 32-bit timestamp
     strHTML = vscp_str_format(VSCP_HTML_EVENT_TEMPLATE,
-                              (unsigned short int) pEvent->vscp_class,
-                              (unsigned short int) pEvent->vscp_type,
-                              (unsigned short int) pEvent->sizeData,
+                              (unsigned short int) ev.vscp_class,
+                              (unsigned short int) ev.vscp_type,
+                              (unsigned short int) ev.sizeData,
                               (const char *) strdata.c_str(),
                               (const char *) strguid.c_str(),
-                              (unsigned short int) pEvent->head,
+                              (unsigned short int) ev.head,
                               (const char *) dt.c_str(),
-                              (unsigned long) pEvent->timestamp,
-                              (unsigned long) pEvent->obid,
+                              (unsigned long) ev.timestamp,
+                              (unsigned long) ev.obid,
                               "");
   }
 
@@ -6287,80 +6232,33 @@ vscp_convertEventToHTML(std::string &strHTML, vscpEvent *pEvent)
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
-// vscp_convertEventExToHTML
+// vscp_convertEventToHTML
 //
 
 bool
-vscp_convertEventExToHTML(std::string &strHTML, vscpEventEx *pEventEx)
+vscp_convertEventToHTML(std::string &strHTML, vscpEvent *pEvent)
 {
-  std::string strguid;
-  std::string strdata;
-
   // Check pointer
-  if (nullptr == pEventEx) {
+  if (nullptr == pEvent) {
     return false;
   }
 
-  vscp_writeGuidArrayToString(strguid, pEventEx->GUID); // GUID to string
-  vscp_writeDataWithSizeToString(strdata, pEventEx->data, pEventEx->sizeData, false,
-                                 false); // Event data to string
-
-  std::string dt;
-  vscp_getDateStringFromEventEx(dt, pEventEx);
+  return vscp_convertEventToHTML(strHTML, vscp_event_view(*pEvent));
+}
 
-  // Check frame version for timestamp handling
-  uint16_t frameVersion = pEventEx->head & VSCP_HEADER16_FRAME_VERSION_MASK;
+////////////////////////////////////////////////////////////////////////////////////
+// vscp_convertEventExToHTML
+//
 
-  if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
-    // UNIX_NS frame: use 64-bit nanosecond timestamp
-    strHTML = vscp_str_format("<h2>VSCP Event</h2> "
-                              "<p>"
-                              "class: %d <br>"
-                              "type: %d <br>"
-                              "</p>"
-                              "<p>"
-                              "data size: %d<br>"
-                              "data: %s<br>"
-                              "</p>"
-                              "<p>"
-                              "guid: %s<br>"
-                              "</p>"
-                              "<p>"
-                              "head: %d <br>"
-                              "<p>"
-                              "datetime: %s <br>"
-                              "</p>"
-                              "timestamp: %llu <br>"
-                              "obid: %lu <br>"
-                              "note: %s <br>"
-                              "</p>",
-                              (unsigned short int) pEventEx->vscp_class,
-                              (unsigned short int) pEventEx->vscp_type,
-                              (unsigned short int) pEventEx->sizeData,
-                              (const char *) strdata.c_str(),
-                              (const char *) strguid.c_str(),
-                              (unsigned short int) pEventEx->head,
-                              (const char *) dt.c_str(),
-                              (unsigned long long) pEventEx->timestamp_ns,
-                              (unsigned long) pEventEx->obid,
-                              "");
-  }
-  else {
-    // ORIGINAL frame: use 32-bit timestamp
-    strHTML = vscp_str_format(VSCP_HTML_EVENT_TEMPLATE,
-                              (unsigned short int) pEventEx->vscp_class,
-                              (unsigned short int) pEventEx->vscp_type,
-                              (unsigned short int) pEventEx->sizeData,
-                              (const char *) strdata.c_str(),
-                              (const char *) strguid.c_str(),
-                              (unsigned short int) pEventEx->head,
-                              (const char *) dt.c_str(),
-                              (unsigned long) pEventEx->timestamp,
-                              (unsigned long) pEventEx->obid,
-                              "");
+bool
+vscp_convertEventExToHTML(std::string &strHTML, vscpEventEx *pEventEx)
+{
+  // Check pointer
+  if (nullptr == pEventEx) {
+    return false;
   }
 
-  return true;
+  return vscp_convertEventToHTML(strHTML, vscp_event_view(*pEventEx));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -6646,36 +6544,31 @@ vscp_setEventExToNow(vscpEventEx *pEventEx)
 //
 
 bool
-vscp_doLevel2Filter(const vscpEvent *pEvent, const vscpEventFilter *pFilter)
+vscp_doLevel2Filter(const vscp_event_view &ev, const vscpEventFilter *pFilter)
 {
   // A nullptr filter is wildcard
   if (nullptr == pFilter) {
     return true;
   }
 
-  // Must be a valid message
-  if (nullptr == pEvent) {
-    return false;
-  }
-
   // Test vscp_class
-  if (0xffff != (uint16_t) (~(pFilter->filter_class ^ pEvent->vscp_class) | ~pFilter->mask_class)) {
+  if (0xffff != (uint16_t) (~(pFilter->filter_class ^ ev.vscp_class) | ~pFilter->mask_class)) {
     return false;
   }
 
   // Test vscp_type
-  if (0xffff != (uint16_t) (~(pFilter->filter_type ^ pEvent->vscp_type) | ~pFilter->mask_type)) {
+  if (0xffff != (uint16_t) (~(pFilter->filter_type ^ ev.vscp_type) | ~pFilter->mask_type)) {
     return false;
   }
 
   // GUID
   for (int i = 0; i < 16; i++) {
-    if (0xff != (uint8_t) (~(pFilter->filter_GUID[i] ^ pEvent->GUID[i]) | ~pFilter->mask_GUID[i]))
+    if (0xff != (uint8_t) (~(pFilter->filter_GUID[i] ^ ev.GUID[i]) | ~pFilter->mask_GUID[i]))
       return false;
   }
 
   // Test priority
-  if (0xff != (uint8_t) (~(pFilter->filter_priority ^ vscp_getEventPriority(pEvent)) | ~pFilter->mask_priority)) {
+  if (0xff != (uint8_t) (~(pFilter->filter_priority ^ ((ev.head >> 5) & 0x07)) | ~pFilter->mask_priority)) {
     return false;
   }
 
@@ -6683,45 +6576,53 @@ vscp_doLevel2Filter(const vscpEvent *pEvent, const vscpEventFilter *pFilter)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// vscp_doLevel2FilterEx
+// doLevel2Filter
+//
+//  filter ^ bit    mask    out
+//  ============================
+//        0          0       1    filter == bit, mask=don't care result = true
+//        0          1       1    filter == bit, mask=valid, result = true
+//        1          0       1    filter != bit, makse=don't care, result = true
+//        1          1       0    filter != bit, mask=valid, result = false
+//
+// Mask tells *which* bits that are of interest means
+// it always returns true if bit set to zero (0=don't care).
+//
+// Filter tells the value for valid bits. If filter bit is == 1 the bits
+// must be equal to get a true filter return.
+//
+// So a nill mask will let everything through
 //
 
 bool
-vscp_doLevel2FilterEx(const vscpEventEx *pEventEx, const vscpEventFilter *pFilter)
+vscp_doLevel2Filter(const vscpEvent *pEvent, const vscpEventFilter *pFilter)
 {
-  // Must be a valid client
-  if (nullptr == pFilter) {
+  // Check pointer
+  if (nullptr == pEvent) {
     return false;
   }
 
-  // Must be a valid message
-  if (nullptr == pEventEx) {
-    return false;
-  }
+  return vscp_doLevel2Filter(vscp_event_view(*pEvent), pFilter);
+}
 
-  // Test vscp_class
-  if (0xffff != (uint16_t) (~(pFilter->filter_class ^ pEventEx->vscp_class) | ~pFilter->mask_class)) {
-    return false;
-  }
+///////////////////////////////////////////////////////////////////////////////
+// vscp_doLevel2FilterEx
+//
 
-  // Test vscp_type
-  if (0xffff != (uint16_t) (~(pFilter->filter_type ^ pEventEx->vscp_type) | ~pFilter->mask_type)) {
+bool
+vscp_doLevel2FilterEx(const vscpEventEx *pEventEx, const vscpEventFilter *pFilter)
+{
+  // Check pointer
+  if (nullptr == pEventEx) {
     return false;
   }
 
-  // GUID
-  for (int i = 0; i < 16; i++) {
-    if (0xff != (uint8_t) (~(pFilter->filter_GUID[i] ^ pEventEx->GUID[i]) | ~pFilter->mask_GUID[i])) {
-      return false;
-    }
-  }
-
-  // Test priority
-  if (0xff != (uint8_t) (~(pFilter->filter_priority ^ vscp_getEventExPriority(pEventEx)) | ~pFilter->mask_priority)) {
+  // Must be a valid client
+  if (nullptr == pFilter) {
     return false;
   }
 
-  return true;
+  return vscp_doLevel2Filter(vscp_event_view(*pEventEx), pFilter);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -7833,61 +7734,76 @@ vscp_setEventExDateTimeBlockToNow(vscpEventEx *pEventEx)
 //
 
 bool
-vscp_convertEventToString(std::string &str, const vscpEvent *pEvent)
+vscp_convertEventToString(std::string &str, const vscp_event_view &ev)
 {
-  // Check pointer
-  if (nullptr == pEvent) {
-    return false;
-  }
-
   // Determine the nanosecond timestamp to use
   uint64_t timestamp_ns;
-  uint16_t frameVersion = pEvent->head & VSCP_HEADER16_FRAME_VERSION_MASK;
+  uint16_t frameVersion = ev.head & VSCP_HEADER16_FRAME_VERSION_MASK;
 
   if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
     // Already has nanosecond timestamp
-    timestamp_ns = pEvent->timestamp_ns;
+    timestamp_ns = ev.timestamp_ns;
   }
   else {
     // Original frame format - convert date/time fields to nanoseconds
     struct tm tm;
     memset(&tm, 0, sizeof(tm));
-    tm.tm_year = pEvent->year - 1900;
-    tm.tm_mon  = pEvent->month - 1;
-    tm.tm_mday = pEvent->day;
-    tm.tm_hour = pEvent->hour;
-    tm.tm_min  = pEvent->minute;
-    tm.tm_sec  = pEvent->second;
+    tm.tm_year = ev.year - 1900;
+    tm.tm_mon  = ev.month - 1;
+    tm.tm_mday = ev.day;
+    tm.tm_hour = ev.hour;
+    tm.tm_min  = ev.minute;
+    tm.tm_sec  = ev.second;
     time_t t   = timegm(&tm);
     // Convert to nanoseconds and add microsecond timestamp as microseconds
-    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) pEvent->timestamp * 1000ULL;
+    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) ev.timestamp * 1000ULL;
   }
 
   // Set head with UNIX_NS frame version
-  uint16_t head = (pEvent->head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  uint16_t head = (ev.head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
 
   // Always output with nanosecond timestamp
   str = vscp_str_format("%hu,%hu,%hu,%lu,,%llu,",
                         (unsigned short) head,
-                        (unsigned short) pEvent->vscp_class,
-                        (unsigned short) pEvent->vscp_type,
-                        (unsigned long) pEvent->obid,
+                        (unsigned short) ev.vscp_class,
+                        (unsigned short) ev.vscp_type,
+                        (unsigned long) ev.obid,
                         (unsigned long long) timestamp_ns);
 
   std::string strGUID;
-  vscp_writeGuidToString(strGUID, pEvent);
+  vscp_writeGuidArrayToString(strGUID, ev.GUID);
   str += strGUID;
-  if (pEvent->sizeData) {
+  if (ev.sizeData) {
     str += ",";
 
     std::string strData;
-    vscp_writeDataToString(strData, pEvent);
+    vscp_writeDataWithSizeToString(strData, ev.pdata, ev.sizeData, false, false);
     str += strData;
   }
 
   return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// convertEventToString
+//
+// head,class,type,obid,timestamp_ns,GUID,data1,data2,data3....
+//
+// Always outputs frame version 1 (UNIX_NS) with nanosecond timestamp.
+// For original frame format, converts date/time fields to nanoseconds first.
+//
+
+bool
+vscp_convertEventToString(std::string &str, const vscpEvent *pEvent)
+{
+  // Check pointer
+  if (nullptr == pEvent) {
+    return false;
+  }
+
+  return vscp_convertEventToString(str, vscp_event_view(*pEvent));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // vscp_getEventAsString
 //
@@ -7909,21 +7825,12 @@ vscp_getEventAsString(const vscpEvent *pEvent)
 bool
 vscp_convertEventExToString(std::string &str, const vscpEventEx *pEventEx)
 {
-  vscpEvent event;
-  event.pdata = nullptr;
-
   // Check pointer
   if (nullptr == pEventEx) {
     return false;
   }
 
-  vscp_convertEventExToEvent(&event, pEventEx);
-  vscp_convertEventToString(str, &event);
-  if (nullptr != event.pdata) {
-    delete event.pdata;
-  }
-
-  return true;
+  return vscp_convertEventToString(str, vscp_event_view(*pEventEx));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8227,6 +8134,18 @@ vscp_getEncryptionTokenFromCode(uint8_t code, std::string &token)
 // vscp_getFrameSizeFromEvent
 //
 
+size_t
+vscp_getFrameSizeFromEvent(const vscp_event_view &ev)
+{
+  size_t size = 1 +                                                             // Packet type
+                VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + ev.sizeData + 2; // CRC
+  return size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscp_getFrameSizeFromEvent
+//
+
 size_t
 vscp_getFrameSizeFromEvent(vscpEvent *pEvent)
 {
@@ -8235,9 +8154,7 @@ vscp_getFrameSizeFromEvent(vscpEvent *pEvent)
     return false;
   }
 
-  size_t size = 1 +                                                             // Packet type
-                VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + pEvent->sizeData + 2; // CRC
-  return size;
+  return vscp_getFrameSizeFromEvent(vscp_event_view(*pEvent));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8252,9 +8169,7 @@ vscp_getFrameSizeFromEventEx(vscpEventEx *pEventEx)
     return false;
   }
 
-  size_t size = 1 +                                                               // Packet type
-                VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + pEventEx->sizeData + 2; // CRC
-  return size;
+  return vscp_getFrameSizeFromEvent(vscp_event_view(*pEventEx));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -8265,25 +8180,21 @@ vscp_getFrameSizeFromEventEx(vscpEventEx *pEventEx)
 //
 
 bool
-vscp_writeEventToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscpEvent *pEvent)
+vscp_writeEventToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscp_event_view &ev)
 {
   // Check pointers
   if (nullptr == frame) {
     return false;
   }
 
-  if (nullptr == pEvent) {
-    return false;
-  }
-
   // Can't have data size with invalid data pointer
-  if (pEvent->sizeData && (nullptr == pEvent->pdata)) {
+  if (ev.sizeData && (nullptr == ev.pdata)) {
     return false;
   }
 
   // Always write packet format 1 - UNIX_NS nanosecond timestamp
   size_t calcSize = 1 +                                                             // Packet type
-                    VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + pEvent->sizeData + 2; // CRC
+                    VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + ev.sizeData + 2; // CRC
 
   if (len < calcSize) {
     return false;
@@ -8291,32 +8202,32 @@ vscp_writeEventToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscpEv
 
   // Determine the nanosecond timestamp to use
   uint64_t timestamp_ns;
-  uint16_t frameVersion = pEvent->head & VSCP_HEADER16_FRAME_VERSION_MASK;
+  uint16_t frameVersion = ev.head & VSCP_HEADER16_FRAME_VERSION_MASK;
 
   if (VSCP_HEADER16_FRAME_VERSION_UNIX_NS == frameVersion) {
     // Already has nanosecond timestamp
-    timestamp_ns = pEvent->timestamp_ns;
+    timestamp_ns = ev.timestamp_ns;
   }
   else {
     // Original frame format - convert date/time fields to nanoseconds
     struct tm tm;
     memset(&tm, 0, sizeof(tm));
-    tm.tm_year = pEvent->year - 1900;
-    tm.tm_mon  = pEvent->month - 1;
-    tm.tm_mday = pEvent->day;
-    tm.tm_hour = pEvent->hour;
-    tm.tm_min  = pEvent->minute;
-    tm.tm_sec  = pEvent->second;
+    tm.tm_year = ev.year - 1900;
+    tm.tm_mon  = ev.month - 1;
+    tm.tm_mday = ev.day;
+    tm.tm_hour = ev.hour;
+    tm.tm_min  = ev.minute;
+    tm.tm_sec  = ev.second;
     time_t t   = timegm(&tm);
     // Convert to nanoseconds and add microsecond timestamp as microseconds
-    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) pEvent->timestamp * 1000ULL;
+    timestamp_ns = (uint64_t) t * 1000000000ULL + (uint64_t) ev.timestamp * 1000ULL;
   }
 
   // Frame type - set packet type 1 in upper nibble
   frame[VSCP_BINARY_PACKET_FRAME0_POS_PKTTYPE] = (pkttype & 0x0f) | (VSCP_MULTICAST_TYPE_EVENT1 << 4);
 
   // Header - set frame version bit to UNIX_NS
-  uint16_t head = (pEvent->head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  uint16_t head = (ev.head & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
   frame[VSCP_BINARY_PACKET_FRAME0_POS_HEAD_MSB] = (head >> 8) & 0xff;
   frame[VSCP_BINARY_PACKET_FRAME0_POS_HEAD_LSB] = head & 0xff;
 
@@ -8336,42 +8247,42 @@ vscp_writeEventToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscpEv
   frame[VSCP_BINARY_PACKET_FRAME1_POS_RESERVED3] = 0;
 
   // Class
-  frame[VSCP_BINARY_PACKET_FRAME0_POS_CLASS_MSB] = (pEvent->vscp_class >> 8) & 0xff;
-  frame[VSCP_BINARY_PACKET_FRAME0_POS_CLASS_LSB] = pEvent->vscp_class & 0xff;
+  frame[VSCP_BINARY_PACKET_FRAME0_POS_CLASS_MSB] = (ev.vscp_class >> 8) & 0xff;
+  frame[VSCP_BINARY_PACKET_FRAME0_POS_CLASS_LSB] = ev.vscp_class & 0xff;
 
   // Type
-  frame[VSCP_BINARY_PACKET_FRAME0_POS_TYPE_MSB] = (pEvent->vscp_type >> 8) & 0xff;
-  frame[VSCP_BINARY_PACKET_FRAME0_POS_TYPE_LSB] = pEvent->vscp_type & 0xff;
+  frame[VSCP_BINARY_PACKET_FRAME0_POS_TYPE_MSB] = (ev.vscp_type >> 8) & 0xff;
+  frame[VSCP_BINARY_PACKET_FRAME0_POS_TYPE_LSB] = ev.vscp_type & 0xff;
 
   // GUID
-  memcpy(frame + VSCP_BINARY_PACKET_FRAME0_POS_GUID, pEvent->GUID, 16);
+  memcpy(frame + VSCP_BINARY_PACKET_FRAME0_POS_GUID, ev.GUID, 16);
 
   // Size
-  frame[VSCP_BINARY_PACKET_FRAME0_POS_SIZE_MSB] = (pEvent->sizeData >> 8) & 0xff;
-  frame[VSCP_BINARY_PACKET_FRAME0_POS_SIZE_LSB] = pEvent->sizeData & 0xff;
+  frame[VSCP_BINARY_PACKET_FRAME0_POS_SIZE_MSB] = (ev.sizeData >> 8) & 0xff;
+  frame[VSCP_BINARY_PACKET_FRAME0_POS_SIZE_LSB] = ev.sizeData & 0xff;
 
   // Data
-  if (pEvent->sizeData) {
-    memcpy(frame + VSCP_BINARY_PACKET_FRAME0_POS_DATA, pEvent->pdata, pEvent->sizeData);
+  if (ev.sizeData) {
+    memcpy(frame + VSCP_BINARY_PACKET_FRAME0_POS_DATA, ev.pdata, ev.sizeData);
   }
 
   // Calculate CRC
-  crc framecrc = crcFast((unsigned char const *) frame + 1, VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + pEvent->sizeData);
+  crc framecrc = crcFast((unsigned char const *) frame + 1, VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + ev.sizeData);
 
   // CRC
-  frame[1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + pEvent->sizeData]     = (framecrc >> 8) & 0xff;
-  frame[1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + pEvent->sizeData + 1] = framecrc & 0xff;
+  frame[1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + ev.sizeData]     = (framecrc >> 8) & 0xff;
+  frame[1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + ev.sizeData + 1] = framecrc & 0xff;
 
 #if 0
     printf("CRC1 %02X %02X\n",
-                frame[ 1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + pEvent->sizeData ],
-                frame[ 1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + pEvent->sizeData + 1 ] );
+                frame[ 1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + ev.sizeData ],
+                frame[ 1 + VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH + ev.sizeData + 1 ] );
     printf("CRC2 %02X %02X\n",
                 ( framecrc >> 8 ) & 0xff,
                 framecrc & 0xff );
     crc nnnn = crcFast( frame+1,
                             VSCP_BINARY_PACKET_FRAME0_HEADER_LENGTH +
-                            pEvent->sizeData );
+                            ev.sizeData );
     printf("CRC3 %02X %02X\n",
                 ( nnnn >> 8 ) & 0xff,
                 nnnn & 0xff );
@@ -8382,37 +8293,36 @@ vscp_writeEventToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscpEv
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// vscp_writeEventExToFrame
+// vscp_writeEventToFrame
+//
+// Always writes packet format 1 (UNIX_NS frame version) with nanosecond timestamp.
+// If event has original frame format (version 0), converts date/time fields to nanoseconds first.
 //
 
 bool
-vscp_writeEventExToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscpEventEx *pEventEx)
+vscp_writeEventToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscpEvent *pEvent)
 {
-  vscpEvent *pEvent;
-
-  pEvent = new vscpEvent;
+  // Check pointer
   if (nullptr == pEvent) {
     return false;
   }
 
-  pEvent->pdata = nullptr;
-
-  // Check pointer (rest is checked in vscp_convertEventExToEvent)
-  if (nullptr == pEventEx) {
-    return false;
-  }
+  return vscp_writeEventToFrame(frame, len, pkttype, vscp_event_view(*pEvent));
+}
 
-  // Convert eventEx to event
-  if (!vscp_convertEventExToEvent(pEvent, pEventEx)) {
-    return false;
-  }
+////////////////////////////////////////////////////////////////////////////////
+// vscp_writeEventExToFrame
+//
 
-  if (!vscp_writeEventToFrame(frame, len, pkttype, pEvent)) {
+bool
+vscp_writeEventExToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscpEventEx *pEventEx)
+{
+  // Check pointer
+  if (nullptr == pEventEx) {
     return false;
   }
-  vscp_deleteEvent_v2(&pEvent);
 
-  return true;
+  return vscp_writeEventToFrame(frame, len, pkttype, vscp_event_view(*pEventEx));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -9242,6 +9152,91 @@ vscp_getSaltHex(std::string &strSalt, size_t len)
   return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// vscp_makePasswordHash
+//
+
+bool
+vscp_makePasswordHash(std::string &result, const std::string &password, const uint8_t *pSalt)
+{
+  uint8_t salt[VSCP_PASSWORD_SALT_SIZE];
+  uint8_t hash[VSCP_PASSWORD_HASH_SIZE];
+  char buf[2 * VSCP_PASSWORD_HASH_SIZE + 1];
+
+  if (nullptr == pSalt) {
+    if (VSCP_PASSWORD_SALT_SIZE != getRandomIV(salt, VSCP_PASSWORD_SALT_SIZE)) {
+      return false;
+    }
+  }
+  else {
+    memcpy(salt, pSalt, VSCP_PASSWORD_SALT_SIZE);
+  }
+
+  if (1 != PKCS5_PBKDF2_HMAC(password.c_str(),
+                             (int) password.length(),
+                             salt,
+                             VSCP_PASSWORD_SALT_SIZE,
+                             VSCP_PASSWORD_PBKDF2_ITERATIONS,
+                             EVP_sha256(),
+                             VSCP_PASSWORD_HASH_SIZE,
+                             hash)) {
+    return false;
+  }
+
+  result.clear();
+
+  memset(buf, 0, sizeof(buf));
+  vscp_byteArray2HexStr(buf, salt, VSCP_PASSWORD_SALT_SIZE);
+  result = buf;
+  vscp_makeUpper(result);
+
+  result += ";";
+
+  memset(buf, 0, sizeof(buf));
+  vscp_byteArray2HexStr(buf, hash, VSCP_PASSWORD_HASH_SIZE);
+  std::string strHash = buf;
+  vscp_makeUpper(strHash);
+  result += strHash;
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscp_isPasswordValid
+//
+
+bool
+vscp_isPasswordValid(const std::string &stored_pw, const std::string &password)
+{
+  uint8_t salt[VSCP_PASSWORD_SALT_SIZE];
+  uint8_t storedHash[VSCP_PASSWORD_HASH_SIZE];
+  uint8_t hash[VSCP_PASSWORD_HASH_SIZE];
+
+  // salt;hash
+  size_t pos = stored_pw.find(';');
+  if ((2 * VSCP_PASSWORD_SALT_SIZE != pos) ||
+      ((2 * VSCP_PASSWORD_SALT_SIZE + 1 + 2 * VSCP_PASSWORD_HASH_SIZE) != stored_pw.length())) {
+    return false;
+  }
+
+  if (!vscp_getHashPasswordComponents(salt, storedHash, stored_pw)) {
+    return false;
+  }
+
+  if (1 != PKCS5_PBKDF2_HMAC(password.c_str(),
+                             (int) password.length(),
+                             salt,
+                             VSCP_PASSWORD_SALT_SIZE,
+                             VSCP_PASSWORD_PBKDF2_ITERATIONS,
+                             EVP_sha256(),
+                             VSCP_PASSWORD_HASH_SIZE,
+                             hash)) {
+    return false;
+  }
+
+  return (0 == CRYPTO_memcmp(hash, storedHash, VSCP_PASSWORD_HASH_SIZE));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // vscp_getHostFromInterface
 //
@@ -224,6 +224,56 @@ union vscp_value {
   unsigned char byte_value;
 };
 
+/*!
+    \struct vscp_event_view
+    \brief Non-owning read only view of a vscpEvent or vscpEventEx
+
+    Holds a copy of the header fields and points at the GUID and
+    data of the event it was constructed from. Helpers that take
+    a view work the same for both event flavours so no conversion
+    copy between them is needed. The view must not outlive the
+    event it was made from.
+*/
+struct vscp_event_view {
+
+  vscp_event_view(const vscpEvent &ev)
+    : head(ev.head), obid(ev.obid), year(ev.year), month(ev.month), timestamp_ns(ev.timestamp_ns),
+      vscp_class(ev.vscp_class), vscp_type(ev.vscp_type), GUID(ev.GUID), sizeData(ev.sizeData), pdata(ev.pdata)
+  {
+    ;
+  }
+
+  vscp_event_view(const vscpEventEx &ex)
+    : head(ex.head), obid(ex.obid), year(ex.year), month(ex.month), timestamp_ns(ex.timestamp_ns),
+      vscp_class(ex.vscp_class), vscp_type(ex.vscp_type), GUID(ex.GUID), sizeData(ex.sizeData), pdata(ex.data)
+  {
+    ;
+  }
+
+  uint16_t head;
+  uint32_t obid;
+  uint16_t year;
+  uint8_t month;
+
+  // Same layout as the time block of vscpEvent/vscpEventEx
+  union {
+    uint64_t timestamp_ns;
+    struct {
+      uint8_t day;
+      uint8_t hour;
+      uint8_t minute;
+      uint8_t second;
+      uint32_t timestamp;
+    };
+  };
+
+  uint16_t vscp_class;
+  uint16_t vscp_type;
+  const uint8_t *GUID;  // 16 bytes owned by the viewed event
+  uint16_t sizeData;
+  const uint8_t *pdata; // Owned by the viewed event
+};
+
 // ***************************************************************************
 //                                General Helpers
 // ***************************************************************************
@@ -1110,6 +1160,35 @@ vscp_getDataCodingString(std::string &strResult, const unsigned char *pCode, uns
 bool
 vscp_getMeasurementAsString(std::string &str, const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_decodeMeasurementAsDouble
+  Decode a measurement value directly from raw event data without
+  building strings or temporary events. Shared by the event and the
+  event ex paths.
+
+  Handles all data codings (bit, byte, string, integer, normalized
+  integer, single and double precision float) for
+
+  CLASS1.MEASUREMENT, CLASS1.DATA, CLASS1.MEASUREZONE, CLASS1.SETVALUEZONE
+  and their CLASS2_LEVEL1 counterparts, CLASS1.MEASUREMENT32,
+  CLASS1.MEASUREMENT64, CLASS2_MEASUREMENT_FLOAT and CLASS2_MEASUREMENT_STR
+
+  Bit and byte codings are returned as an unsigned MSB first number.
+
+  @param pvalue Pointer to double that holds the result
+  @param vscp_class VSCP class of the event.
+  @param vscp_type VSCP type of the event.
+  @param pdata Pointer to event data.
+  @param sizeData Number of data bytes.
+  @return true on success, false on failure.
+*/
+bool
+vscp_decodeMeasurementAsDouble(double *pvalue,
+                               uint16_t vscp_class,
+                               uint16_t vscp_type,
+                               const uint8_t *pdata,
+                               uint16_t sizeData);
+
 /*!
   @fn vscp_getMeasurementAsStringEx
   Write data from event ex in the VSCP data coding format to a string.
@@ -1130,6 +1209,16 @@ vscp_getMeasurementAsString(std::string &str, const vscpEvent *pEvent);
 bool
 vscp_getMeasurementAsDouble(double *pvalue, const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_getMeasurementAsDouble
+  Get measurement value from an event view as a double.
+  @param pvalue Pointer to double that holds the result
+  @param ev View of event or event ex.
+  @return true on success, false on failure.
+*/
+bool
+vscp_getMeasurementAsDouble(double *pvalue, const vscp_event_view &ev);
+
 /*!
   @fn vscp_getMeasurementAsDoubleEx
   Write data from event ex in the VSCP data coding format as a double.
@@ -1160,6 +1249,15 @@ vscp_getMeasurementAsDoubleEx(double *pvalue, const vscpEventEx *pEventEx);
 int
 vscp_getMeasurementUnit(const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_getMeasurementUnit
+  Get measurement unit from an event view.
+  @param ev View of event or event ex.
+  @return Measurement unit or -1 for error.
+*/
+int
+vscp_getMeasurementUnit(const vscp_event_view &ev);
+
 /*!
   @fn vscp_getMeasurementUnitEx
   Get measurement unit for any of the valid measurement events.
@@ -1180,6 +1278,15 @@ vscp_getMeasurementUnitEx(const vscpEventEx *pEventEx);
 int
 vscp_getMeasurementSensorIndex(const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_getMeasurementSensorIndex
+  Get measurement sensor index from an event view.
+  @param ev View of event or event ex.
+  @return Sensor index or -1 for error.
+*/
+int
+vscp_getMeasurementSensorIndex(const vscp_event_view &ev);
+
 /*!
   @fn vscp_getMeasurementSensorIndexEx
   Get measurement sensor index for any of the valid measurement events.
@@ -1200,6 +1307,15 @@ vscp_getMeasurementSensorIndexEx(const vscpEventEx *pEventEx);
 int
 vscp_getMeasurementZone(const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_getMeasurementZone
+  Get measurement zone from an event view.
+  @param ev View of event or event ex.
+  @return Zone or -1 for error.
+*/
+int
+vscp_getMeasurementZone(const vscp_event_view &ev);
+
 /*!
   @fn vscp_getMeasurementZoneEx
   Get measurement zone for any of the valid measurement events.
@@ -1220,6 +1336,15 @@ vscp_getMeasurementZoneEx(const vscpEventEx *pEventEx);
 int
 vscp_getMeasurementSubZone(const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_getMeasurementSubZone
+  Get measurement sub zone from an event view.
+  @param ev View of event or event ex.
+  @return Sub zone or -1 for error.
+*/
+int
+vscp_getMeasurementSubZone(const vscp_event_view &ev);
+
 /*!
   @fn vscp_getMeasurementSubZoneEx
   Get measurement subzone for any of the valid measurement events.
@@ -1239,6 +1364,15 @@ vscp_getMeasurementSubZoneEx(const vscpEventEx *pEventEx);
 bool
 vscp_isMeasurement(const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_isMeasurement
+  Check if an event view is a measurement.
+  @param ev View of event or event ex.
+  @return true if a measurement event.
+*/
+bool
+vscp_isMeasurement(const vscp_event_view &ev);
+
 /*!
   @fn vscp_isMeasurementEx
   Check if event is a measurement
@@ -2055,6 +2189,16 @@ vscp_setEventExDateTimeBlockToNow(vscpEventEx *pEventEx);
 bool
 vscp_getDateStringFromEvent(std::string &dt, const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_getDateStringFromEvent
+  Get ISO date string from an event view.
+  @param dt String that will get the date
+  @param ev View of event or event ex.
+  @return true on success, false on failure.
+*/
+bool
+vscp_getDateStringFromEvent(std::string &dt, const vscp_event_view &ev);
+
 /*!
   @fn vscp_getDateStringFromEventEx
   Get datestring from VSCP EventEx.
@@ -2091,6 +2235,16 @@ vscp_getDateStringFromEventEx(std::string &dt, const vscpEventEx *pEventEx);
 bool
 vscp_convertEventToJSON(std::string &strJSON, const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_convertEventToJSON
+  Write an event view out in JSON format.
+  @param strJSON String that will get the JSON formatted event
+  @param ev View of event or event ex.
+  @return true on success, false on failure.
+*/
+bool
+vscp_convertEventToJSON(std::string &strJSON, const vscp_event_view &ev);
+
 /*!
     @fn vscp_convertEventExToJSON
     Convert VSCP EventEx to JSON formatted string.
@@ -2175,6 +2329,16 @@ vscp_convertJSONToEventEx(vscpEventEx *pEventEx, std::string &strJSONx);
 bool
 vscp_convertEventToXML(std::string &strXML, vscpEvent *pEvent);
 
+/*!
+  @fn vscp_convertEventToXML
+  Write an event view out in XML format.
+  @param strXML String that will get the XML formatted event
+  @param ev View of event or event ex.
+  @return true on success, false on failure.
+*/
+bool
+vscp_convertEventToXML(std::string &strXML, const vscp_event_view &ev);
+
 /*!
   @fn vscp_convertXMLToEvent
   Convert XML string to Event.
@@ -2243,6 +2407,16 @@ vscp_convertXMLToEventEx(vscpEventEx *pEventEx, std::string &strXML);
 bool
 vscp_convertEventToHTML(std::string &strHTML, vscpEvent *pEvent);
 
+/*!
+  @fn vscp_convertEventToHTML
+  Write an event view out in HTML format.
+  @param strHTML String that will get the HTML formatted event
+  @param ev View of event or event ex.
+  @return true on success, false on failure.
+*/
+bool
+vscp_convertEventToHTML(std::string &strHTML, const vscp_event_view &ev);
+
 /*!
   @fn vscp_convertEventExToHTML
   Convert VSCP EventEx to HTML formatted string.
@@ -2436,6 +2610,16 @@ vscp_copyVSCPFilter(vscpEventFilter *pToFilter, const vscpEventFilter *pFromFilt
 bool
 vscp_doLevel2Filter(const vscpEvent *pEvent, const vscpEventFilter *pFilter);
 
+/*!
+  @fn vscp_doLevel2Filter
+  Check an event view against a filter/mask.
+  @param pFilter Pointer to filter. A nullptr filter lets everything through
+  @param ev View of event or event ex.
+  @return true if the event should be accepted.
+*/
+bool
+vscp_doLevel2Filter(const vscp_event_view &ev, const vscpEventFilter *pFilter);
+
 /*!
   @fn vscp_doLevel2FilterEx
   Check filter/mask to check if filter should be delivered for eventex
@@ -2773,6 +2957,16 @@ vscp_setDataArrayFromString(uint8_t *pData, uint16_t *psizeData, const std::stri
 bool
 vscp_convertEventToString(std::string &str, const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_convertEventToString
+  Write an event view out in string format.
+  @param str String that will get the string formatted event
+  @param ev View of event or event ex.
+  @return true on success, false on failure.
+*/
+bool
+vscp_convertEventToString(std::string &str, const vscp_event_view &ev);
+
 /*!
   @fn vscp_getEventAsString
   Get Event as string
@@ -2899,6 +3093,15 @@ vscp_getEncryptionTokenFromCode(uint8_t code, std::string &token);
 size_t
 vscp_getFrameSizeFromEvent(vscpEvent *pEvent);
 
+/*!
+  @fn vscp_getFrameSizeFromEvent
+  Get the size of the binary frame needed for an event view.
+  @param ev View of event or event ex.
+  @return Frame size in bytes.
+*/
+size_t
+vscp_getFrameSizeFromEvent(const vscp_event_view &ev);
+
 /*!
   @fn vscp_getFrameSizeFromEventEx
   Get UDP frame size from event ex
@@ -2927,6 +3130,18 @@ vscp_getFrameSizeFromEventEx(vscpEventEx *pEventEx);
 bool
 vscp_writeEventToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscpEvent *pEvent);
 
+/*!
+  @fn vscp_writeEventToFrame
+  Write an event view to a binary frame.
+  @param frame Pointer to frame buffer
+  @param len Size of frame buffer
+  @param pkttype Packet type
+  @param ev View of event or event ex.
+  @return true on success, false on failure.
+*/
+bool
+vscp_writeEventToFrame(uint8_t *frame, size_t len, uint8_t pkttype, const vscp_event_view &ev);
+
 /*!
   @fn vscp_writeEventExToFrame
   Write event ex on binary frame format.
@@ -3199,6 +3414,41 @@ vscp_getSalt(uint8_t *buf, size_t len);
 bool
 vscp_getSaltHex(std::string &strSalt, size_t len);
 
+// PBKDF2-HMAC-SHA256 parameters for stored passwords (same as vscp-mkpasswd)
+#define VSCP_PASSWORD_SALT_SIZE         16
+#define VSCP_PASSWORD_HASH_SIZE         32
+#define VSCP_PASSWORD_PBKDF2_ITERATIONS 70000
+
+/*!
+  @fn vscp_makePasswordHash
+  Make a storable password hash
+
+  The password is hashed with PBKDF2-HMAC-SHA256 and the result is
+  written on the form "salt;hash" where both parts are hex strings.
+  This is the same format vscp-mkpasswd generates.
+
+  @param result String that will get the hash on the form salt;hash
+  @param password Clear text password to hash.
+  @param pSalt Pointer to a 16 byte salt to use. If NULL a random salt
+          is generated.
+  @return True on success, false on failure.
+ */
+bool
+vscp_makePasswordHash(std::string &result, const std::string &password, const uint8_t *pSalt = nullptr);
+
+/*!
+  @fn vscp_isPasswordValid
+  Check a clear text password against a stored PBKDF2 password hash
+
+  The hash is compared in constant time.
+
+  @param stored_pw Stored password on the form salt;hash
+  @param password Clear text password to check.
+  @return True if the password is valid, false otherwise.
+ */
+bool
+vscp_isPasswordValid(const std::string &stored_pw, const std::string &password);
+
 /*
 #ifdef __cplusplus
 }
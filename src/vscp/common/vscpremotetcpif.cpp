@@ -40,6 +40,7 @@
 #include <string>
 
 #include <math.h>
+#include <string.h>
 #include <semaphore.h>
 #include <stdlib.h>
 #ifndef WIN32
@@ -76,13 +77,212 @@ win_usleep(__int64 usec)
 }
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// vscpEventPool
+//
+
+vscpEventPool::vscpEventPool(size_t maxFree)
+{
+  m_maxFree = maxFree;
+  pthread_mutex_init(&m_mutex, NULL);
+}
+
+vscpEventPool::~vscpEventPool()
+{
+  for (size_t i = 0; i < m_free.size(); i++) {
+    delete m_free[i];
+  }
+  m_free.clear();
+  pthread_mutex_destroy(&m_mutex);
+}
+
+vscpEvent *
+vscpEventPool::get(void)
+{
+  poolEvent *p = NULL;
+
+  pthread_mutex_lock(&m_mutex);
+  if (m_free.size()) {
+    p = m_free.back();
+    m_free.pop_back();
+  }
+  pthread_mutex_unlock(&m_mutex);
+
+  if (NULL == p) {
+    p = new poolEvent;
+  }
+
+  memset(&p->ev, 0, sizeof(vscpEvent));
+  p->ev.pdata = p->data;
+  return &p->ev;
+}
+
+void
+vscpEventPool::put(vscpEvent *pEvent)
+{
+  if (NULL == pEvent) {
+    return;
+  }
+
+  // ev is the first member
+  poolEvent *p = reinterpret_cast<poolEvent *>(pEvent);
+
+  pthread_mutex_lock(&m_mutex);
+  if (m_free.size() < m_maxFree) {
+    m_free.push_back(p);
+    p = NULL;
+  }
+  pthread_mutex_unlock(&m_mutex);
+
+  delete p;
+}
+
+size_t
+vscpEventPool::getFreeCount(void)
+{
+  pthread_mutex_lock(&m_mutex);
+  size_t cnt = m_free.size();
+  pthread_mutex_unlock(&m_mutex);
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// vscpLineRing
+//
+
+vscpLineRing::vscpLineRing(size_t size)
+{
+  m_size = 64;
+  while (m_size < size) {
+    m_size <<= 1;
+  }
+  m_mask = m_size - 1;
+  m_buf.resize(m_size);
+  m_line.resize(m_size);
+  clear();
+}
+
+void
+vscpLineRing::clear(void)
+{
+  m_head     = 0;
+  m_tail     = 0;
+  m_scan     = 0;
+  m_bDiscard = false;
+  m_overruns = 0;
+}
+
+size_t
+vscpLineRing::getWriteSpace(char **pbuf)
+{
+  // Full without a line end, the line can never be completed
+  if ((m_head - m_tail) == m_size) {
+    m_tail = m_scan = m_head;
+    m_bDiscard      = true;
+    m_overruns++;
+  }
+
+  size_t pos  = m_head & m_mask;
+  size_t free = m_size - (m_head - m_tail);
+  if (free > (m_size - pos)) {
+    free = m_size - pos;
+  }
+
+  *pbuf = m_buf.data() + pos;
+  return free;
+}
+
+void
+vscpLineRing::commitWrite(size_t n)
+{
+  m_head += n;
+}
+
+size_t
+vscpLineRing::write(const char *pbuf, size_t len)
+{
+  size_t cnt = 0;
+  while (cnt < len) {
+    char *p;
+    size_t n = getWriteSpace(&p);
+    if (n > (len - cnt)) {
+      n = len - cnt;
+    }
+    memcpy(p, pbuf + cnt, n);
+    commitWrite(n);
+    cnt += n;
+  }
+  return cnt;
+}
+
+bool
+vscpLineRing::getLine(const char **pline, size_t *plen)
+{
+  while (m_scan < m_head) {
+
+    size_t pos = m_scan & m_mask;
+    size_t n   = m_head - m_scan;
+    if (n > (m_size - pos)) {
+      n = m_size - pos;
+    }
+
+    const char *p = (const char *) memchr(m_buf.data() + pos, '\n', n);
+    if (NULL == p) {
+      m_scan += n;
+      continue;
+    }
+
+    size_t start = m_tail;
+    size_t len   = (m_scan + (p - (m_buf.data() + pos))) - start;
+    m_tail = m_scan = start + len + 1;
+
+    if (m_bDiscard) {
+      m_bDiscard = false;
+      continue;
+    }
+
+    const char *line;
+    pos = start & m_mask;
+    if ((pos + len) <= m_size) {
+      line = m_buf.data() + pos;
+    }
+    else {
+      // Wraps, copy the two parts
+      size_t first = m_size - pos;
+      memcpy(m_line.data(), m_buf.data() + pos, first);
+      memcpy(m_line.data() + first, m_buf.data(), len - first);
+      line = m_line.data();
+    }
+
+    // Trim "\r" and blanks
+    while (len && ((' ' == line[len - 1]) || ('\t' == line[len - 1]) || ('\r' == line[len - 1]))) {
+      len--;
+    }
+    while (len && ((' ' == *line) || ('\t' == *line))) {
+      line++;
+      len--;
+    }
+
+    if (!len) {
+      continue;
+    }
+
+    *pline = line;
+    *plen  = len;
+    return true;
+  }
+
+  return false;
+}
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
 
 VscpRemoteTcpIf::VscpRemoteTcpIf()
 {
-  m_conn = NULL; // Not yet used
+  m_conn    = NULL; // Not yet used
+  m_prxRing = NULL;
 
   m_bTLS        = false;
   m_tlsMode     = tls_mode::auto_select;
@@ -92,6 +292,7 @@ VscpRemoteTcpIf::VscpRemoteTcpIf()
   m_connectionTimeOut    = TCPIP_DEFAULT_CONNECT_TIMEOUT_SECONDS;
   m_responseTimeOut      = TCPIP_DEFAULT_RESPONSE_TIMEOUT;
   m_innerResponseTimeout = TCPIP_DEFAULT_INNER_RESPONSE_TIMEOUT;
+  m_sendWindow           = TCPIP_DEFAULT_SEND_WINDOW;
 
   // Init. register read parameters
   m_registerOpErrorTimeout  = TCPIP_REGISTER_READ_ERROR_TIMEOUT;
@@ -117,7 +318,8 @@ VscpRemoteTcpIf::~VscpRemoteTcpIf()
 bool
 VscpRemoteTcpIf::checkReturnValue(bool bClear)
 {
-  bool rv = false;
+  bool rv  = false;
+  bool bOK = false;
   char buf[0x2000];
 
   if (bClear) {
@@ -127,11 +329,10 @@ VscpRemoteTcpIf::checkReturnValue(bool bClear)
   uint32_t start = vscp_getMsTimeStamp();
   while (((vscp_getMsTimeStamp() - start) < m_responseTimeOut)) {
 
-    memset(buf, 0, sizeof(buf));
     int nRead = stcp_read(m_conn, buf, sizeof(buf), m_innerResponseTimeout);
 #ifdef DEBUG_INNER_COMMUNICATION
-    if (nRead) {
-      std::cout << "[" << buf << "]" << std::endl;
+    if (nRead > 0) {
+      std::cout << "[" << std::string(buf, nRead) << "]" << std::endl;
     }
 #endif
     if (nRead < 0) {
@@ -147,30 +348,38 @@ VscpRemoteTcpIf::checkReturnValue(bool bClear)
       }
       break;
     }
-    else if (nRead > 0) {
-      m_lastResponseTime = vscp_getMsTimeStamp(); // Save last response time
-      m_strResponse += std::string(buf, nRead);
+    else if (0 == nRead) {
+      continue;
+    }
+
+    m_lastResponseTime = vscp_getMsTimeStamp(); // Save last response time
+
+    // Only search the new data, plus what is needed to find
+    // a token split between two reads
+    size_t from = m_strResponse.length();
+    from        = (from > 3) ? (from - 3) : 0;
+    m_strResponse.append(buf, nRead);
 #ifdef DEBUG_INNER_COMMUNICATION
-      std::cout << "[ [m_strResponse]=" << m_strResponse << "]" << std::endl;
+    std::cout << "[ [m_strResponse]=" << m_strResponse << "]" << std::endl;
 #endif
-    }
 
     // if err abort
-    if (NULL != strstr(buf, "+ERR")) {
+    if (m_strResponse.npos != m_strResponse.find("+ERR", from)) {
       break;
     }
 
     // Check if we are done
     // A line with "+OK bla bla bla bla bla bla bla bla \r\n"
     // It can be hacked up.
-    if (m_strResponse.npos != m_strResponse.find("+OK")) {
+    if (!bOK) {
+      bOK = (m_strResponse.npos != m_strResponse.find("+OK", from));
+    }
 
-      // We check only for "\n" as it also could have been
-      // broken up, even if rare
-      if (NULL != strstr(buf, "\n")) {
-        rv = true;
-        break;
-      }
+    // We check only for "\n" as it also could have been
+    // broken up, even if rare
+    if (bOK && (NULL != memchr(buf, '\n', nRead))) {
+      rv = true;
+      break;
     }
 
   } // while
@@ -224,13 +433,18 @@ VscpRemoteTcpIf::doCommand(const std::string &cmd)
 {
   bool ret = false;
 
-  doClrInputQueue();
-
   // Make sure we are connected
   if (nullptr == m_conn) {
     return VSCP_ERROR_CONNECTION;
   }
 
+  // Responses to pipelined sends come first
+  if (m_sendPending.size()) {
+    doCmdSendFlush();
+  }
+
+  doClrInputQueue();
+
   int n;
   if (0 == (n = stcp_write(m_conn, (const char *)cmd.c_str(), cmd.length())) || n != (int) cmd.length()) {
     return VSCP_ERROR_ERROR;
@@ -561,9 +775,14 @@ VscpRemoteTcpIf::doCmdClose(void)
     m_conn = NULL;
   }
 
+  failSendPending(VSCP_ERROR_CONNECTION);
+
   m_bModeReceiveLoop = false;
   m_inputStrArray.clear();
 
+  delete m_prxRing;
+  m_prxRing = NULL;
+
   return VSCP_ERROR_SUCCESS;
 }
 
@@ -684,6 +903,367 @@ VscpRemoteTcpIf::doCmdSendEx(const vscpEventEx *pEventEx)
   return doCommand(strBuf);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// doCmdSendAsync
+//
+
+int
+VscpRemoteTcpIf::doCmdSendAsync(const vscpEvent *pEvent, std::function<void(int rv)> cb)
+{
+  if (!isConnected()) {
+    return VSCP_ERROR_CONNECTION;
+  }
+
+  // Not in receive loop
+  if (m_bModeReceiveLoop) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  if (NULL == pEvent) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  // Must be a valid data pointer if data
+  if ((pEvent->sizeData > 0) && (NULL == pEvent->pdata)) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  // Validate datasize
+  if (pEvent->sizeData > VSCP_MAX_DATA) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  std::string strBuf;
+  if (!vscp_convertEventToString(strBuf, pEvent)) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  strBuf = "send " + strBuf;
+  strBuf += "\r\n";
+
+  return writeSendCommands(strBuf, 1, cb);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// doCmdSendAsyncEx
+//
+
+int
+VscpRemoteTcpIf::doCmdSendAsyncEx(const vscpEventEx *pEventEx, std::function<void(int rv)> cb)
+{
+  if (!isConnected()) {
+    return VSCP_ERROR_CONNECTION;
+  }
+
+  // Not in receive loop
+  if (m_bModeReceiveLoop) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  if (NULL == pEventEx) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  // Validate datasize
+  if (pEventEx->sizeData > VSCP_MAX_DATA) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  std::string strBuf;
+  if (!vscp_convertEventExToString(strBuf, pEventEx)) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  strBuf = "send " + strBuf;
+  strBuf += "\r\n";
+
+  return writeSendCommands(strBuf, 1, cb);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// doCmdSendFlush
+//
+
+int
+VscpRemoteTcpIf::doCmdSendFlush(void)
+{
+  if (m_sendPending.empty()) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  if (!isConnected()) {
+    failSendPending(VSCP_ERROR_CONNECTION);
+    return VSCP_ERROR_CONNECTION;
+  }
+
+  return waitSendResponses(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// doCmdSendBatch
+//
+
+int
+VscpRemoteTcpIf::doCmdSendBatch(const vscpEvent *const *ppEvents, size_t count, size_t *pcntFailed)
+{
+  if ((NULL == ppEvents) && count) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  return sendBatch(
+    count,
+    [ppEvents](size_t idx, std::string &strEvent) {
+      const vscpEvent *pEvent = ppEvents[idx];
+      if ((NULL == pEvent) || (pEvent->sizeData > VSCP_MAX_DATA) ||
+          ((pEvent->sizeData > 0) && (NULL == pEvent->pdata))) {
+        return false;
+      }
+      return vscp_convertEventToString(strEvent, pEvent);
+    },
+    pcntFailed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// doCmdSendBatchEx
+//
+
+int
+VscpRemoteTcpIf::doCmdSendBatchEx(const vscpEventEx *pEvents, size_t count, size_t *pcntFailed)
+{
+  if ((NULL == pEvents) && count) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  return sendBatch(
+    count,
+    [pEvents](size_t idx, std::string &strEvent) {
+      if (pEvents[idx].sizeData > VSCP_MAX_DATA) {
+        return false;
+      }
+      return vscp_convertEventExToString(strEvent, &pEvents[idx]);
+    },
+    pcntFailed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sendBatch
+//
+
+int
+VscpRemoteTcpIf::sendBatch(size_t count,
+                           std::function<bool(size_t idx, std::string &strEvent)> fmt,
+                           size_t *pcntFailed)
+{
+  int rv         = VSCP_ERROR_SUCCESS;
+  size_t nFailed = 0;
+
+  if (NULL != pcntFailed) {
+    *pcntFailed = 0;
+  }
+
+  if (!isConnected()) {
+    return VSCP_ERROR_CONNECTION;
+  }
+
+  // Not in receive loop
+  if (m_bModeReceiveLoop) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  // Every error path below fails all outstanding sends, so no
+  // callback is left referring to nFailed when we return
+  std::function<void(int rv)> cb = [&nFailed](int rv) {
+    if (VSCP_ERROR_SUCCESS != rv) {
+      nFailed++;
+    }
+  };
+
+  // Write half a window at a time so the next chunk is on its
+  // way while responses for the previous one are read
+  size_t chunk = (m_sendWindow > 1) ? (m_sendWindow / 2) : 1;
+
+  std::string strCmds;
+  std::string strEvent;
+  size_t nCmds = 0;
+
+  for (size_t i = 0; i < count; i++) {
+
+    if (!fmt(i, strEvent)) {
+      nFailed++;
+    }
+    else {
+      strCmds += "send ";
+      strCmds += strEvent;
+      strCmds += "\r\n";
+      nCmds++;
+    }
+
+    if (nCmds && ((nCmds >= chunk) || (i == (count - 1)))) {
+      if (VSCP_ERROR_SUCCESS != (rv = writeSendCommands(strCmds, nCmds, cb))) {
+        // This chunk and the events not yet formatted are not sent
+        nFailed += nCmds + (count - (i + 1));
+        break;
+      }
+      strCmds.clear();
+      nCmds = 0;
+    }
+  }
+
+  if (VSCP_ERROR_SUCCESS == rv) {
+    rv = doCmdSendFlush();
+  }
+
+  if (NULL != pcntFailed) {
+    *pcntFailed = nFailed;
+  }
+
+  if (VSCP_ERROR_SUCCESS != rv) {
+    return rv;
+  }
+
+  return nFailed ? VSCP_ERROR_ERROR : VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// writeSendCommands
+//
+
+int
+VscpRemoteTcpIf::writeSendCommands(const std::string &strCmds, size_t count, std::function<void(int rv)> cb)
+{
+  if (!count) {
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  // Start out clean, as doCommand does
+  if (m_sendPending.empty()) {
+    doClrInputQueue();
+  }
+
+  // Make room in the send window
+  if ((m_sendPending.size() + count) > m_sendWindow) {
+    int rv = waitSendResponses((count < m_sendWindow) ? (m_sendWindow - count) : 0);
+    if (VSCP_ERROR_SUCCESS != rv) {
+      return rv;
+    }
+  }
+
+  int n = stcp_write(m_conn, strCmds.c_str(), strCmds.length());
+  if (n != (int) strCmds.length()) {
+    // Part of a command may have been written, responses can
+    // no longer be matched
+    failSendPending(VSCP_ERROR_CONNECTION);
+    return VSCP_ERROR_CONNECTION;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    m_sendPending.push_back(cb);
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// waitSendResponses
+//
+
+int
+VscpRemoteTcpIf::waitSendResponses(size_t maxPending)
+{
+  char buf[0x2000];
+
+  // Responses already read
+  handleSendResponses();
+
+  // The timeout restarts every time a response arrives
+  uint32_t start = vscp_getMsTimeStamp();
+  while (m_sendPending.size() > maxPending) {
+
+    if ((vscp_getMsTimeStamp() - start) > m_responseTimeOut) {
+      failSendPending(VSCP_ERROR_TIMEOUT);
+      return VSCP_ERROR_TIMEOUT;
+    }
+
+    int nRead = stcp_read(m_conn, buf, sizeof(buf), m_innerResponseTimeout);
+    if (nRead < 0) {
+      if (STCP_ERROR_TIMEOUT == nRead) {
+        continue;
+      }
+      failSendPending(VSCP_ERROR_CONNECTION);
+      return VSCP_ERROR_CONNECTION;
+    }
+    else if (nRead > 0) {
+      m_lastResponseTime = vscp_getMsTimeStamp();
+      m_strResponse.append(buf, nRead);
+      if (handleSendResponses()) {
+        start = vscp_getMsTimeStamp();
+      }
+    }
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// handleSendResponses
+//
+
+size_t
+VscpRemoteTcpIf::handleSendResponses(void)
+{
+  std::deque<std::pair<std::function<void(int rv)>, int>> done;
+
+  size_t pos = 0;
+  size_t eol;
+  while ((done.size() < m_sendPending.size()) && (m_strResponse.npos != (eol = m_strResponse.find('\n', pos)))) {
+
+    const char *p = m_strResponse.c_str() + pos;
+    pos           = eol + 1;
+
+    int rv;
+    if (0 == strncmp(p, "+OK", 3)) {
+      rv = VSCP_ERROR_SUCCESS;
+    }
+    else if ((0 == strncmp(p, "-OK", 3)) || (0 == strncmp(p, "+ERR", 4)) || (0 == strncmp(p, "-ERR", 4))) {
+      rv = VSCP_ERROR_ERROR;
+    }
+    else {
+      continue; // Not a response line
+    }
+
+    done.push_back(std::make_pair(m_sendPending[done.size()], rv));
+  }
+
+  m_strResponse.erase(0, pos);
+  m_sendPending.erase(m_sendPending.begin(), m_sendPending.begin() + done.size());
+
+  // Callbacks last, they may send more
+  for (size_t i = 0; i < done.size(); i++) {
+    if (done[i].first) {
+      done[i].first(done[i].second);
+    }
+  }
+
+  return done.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// failSendPending
+//
+
+void
+VscpRemoteTcpIf::failSendPending(int rv)
+{
+  std::deque<std::function<void(int rv)>> pending;
+  pending.swap(m_sendPending);
+
+  for (size_t i = 0; i < pending.size(); i++) {
+    if (pending[i]) {
+      pending[i](rv);
+    }
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // doCmdSendLevel1
 //
@@ -742,6 +1322,228 @@ VscpRemoteTcpIf::getEventFromLine(vscpEvent *pEvent, const std::string &strLine)
   return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// parseEventLine
+//
+
+// Value of a hex digit or -1
+static inline int
+hexDigitValue(char c)
+{
+  if ((c >= '0') && (c <= '9')) {
+    return c - '0';
+  }
+  if ((c >= 'a') && (c <= 'f')) {
+    return c - 'a' + 10;
+  }
+  if ((c >= 'A') && (c <= 'F')) {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// Get next comma separated field. *pnext is set to NULL after the last
+// field. Returns false when there are no more fields.
+static inline bool
+nextField(const char **pnext, const char *end, const char **pfs, const char **pfe)
+{
+  if (NULL == *pnext) {
+    return false;
+  }
+
+  const char *p = (const char *) memchr(*pnext, ',', end - *pnext);
+  *pfs          = *pnext;
+  *pfe          = (NULL == p) ? end : p;
+  *pnext        = (NULL == p) ? NULL : p + 1;
+  return true;
+}
+
+// Remove blanks around a field
+static inline void
+trimField(const char **pfs, const char **pfe)
+{
+  while ((*pfs < *pfe) && ((' ' == **pfs) || ('\t' == **pfs))) {
+    (*pfs)++;
+  }
+  while ((*pfe > *pfs) && ((' ' == *(*pfe - 1)) || ('\t' == *(*pfe - 1)))) {
+    (*pfe)--;
+  }
+}
+
+// Parse a field holding a decimal number without leading zeros or a 0x
+// prefixed hex number. Everything else, also values that do not fit
+// in 64 bits, is left to the generic parser.
+static bool
+parseFieldNumber(const char *fs, const char *fe, uint64_t *pval)
+{
+  trimField(&fs, &fe);
+
+  uint64_t val = 0;
+  size_t n     = fe - fs;
+
+  if ((n > 2) && ('0' == fs[0]) && (('x' == fs[1]) || ('X' == fs[1]))) {
+    if (n > 2 + 16) {
+      return false;
+    }
+    for (fs += 2; fs < fe; fs++) {
+      int v = hexDigitValue(*fs);
+      if (v < 0) {
+        return false;
+      }
+      val = (val << 4) | (uint64_t) v;
+    }
+  }
+  else {
+    // A nanosecond timestamp has 19 digits, UINT64_MAX has 20
+    if ((0 == n) || (n > 20) || (('0' == fs[0]) && (n > 1))) {
+      return false;
+    }
+    for (; fs < fe; fs++) {
+      if ((*fs < '0') || (*fs > '9')) {
+        return false;
+      }
+      uint64_t digit = (uint64_t) (*fs - '0');
+      if (val > ((UINT64_MAX - digit) / 10)) {
+        return false;
+      }
+      val = val * 10 + digit;
+    }
+  }
+
+  *pval = val;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// parseEventLineFast
+//
+
+bool
+VscpRemoteTcpIf::parseEventLineFast(vscpEvent *pEvent, const char *pline, size_t len)
+{
+  // Check pointers
+  if ((NULL == pEvent) || (NULL == pEvent->pdata) || (NULL == pline)) {
+    return false;
+  }
+
+  uint8_t *pdata = pEvent->pdata;
+  memset(pEvent, 0, sizeof(vscpEvent));
+  pEvent->pdata = pdata;
+
+  const char *end  = pline + len;
+  const char *next = pline;
+  const char *fs, *fe;
+  uint64_t val[4];
+
+  // head, class, type, obid
+  for (int i = 0; i < 4; i++) {
+    if (!nextField(&next, end, &fs, &fe) || !parseFieldNumber(fs, fe, &val[i])) {
+      return false;
+    }
+  }
+
+  // datetime, only the empty form is handled here
+  if (!nextField(&next, end, &fs, &fe)) {
+    return false;
+  }
+  trimField(&fs, &fe);
+  if (fs != fe) {
+    return false;
+  }
+
+  // timestamp, can be empty
+  uint64_t timestamp = 0;
+  if (!nextField(&next, end, &fs, &fe)) {
+    return false;
+  }
+  trimField(&fs, &fe);
+  if ((fs != fe) && !parseFieldNumber(fs, fe, &timestamp)) {
+    return false;
+  }
+
+  // GUID
+  if (!nextField(&next, end, &fs, &fe)) {
+    return false;
+  }
+  trimField(&fs, &fe);
+  if (VSCP_GUID_STRING_LENGTH == (fe - fs)) {
+    char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+    memcpy(buf, fs, VSCP_GUID_STRING_LENGTH);
+    buf[VSCP_GUID_STRING_LENGTH] = '\0';
+    if (!cguid::parseString(pEvent->GUID, buf)) {
+      return false;
+    }
+  }
+  else if ((fs == fe) || ((1 == (fe - fs)) && ('-' == *fs))) {
+    memset(pEvent->GUID, 0, 16);
+  }
+  else {
+    return false;
+  }
+
+  // Data
+  uint16_t sizeData = 0;
+  while (nextField(&next, end, &fs, &fe)) {
+    uint64_t v;
+    if ((sizeData >= VSCP_MAX_DATA) || !parseFieldNumber(fs, fe, &v)) {
+      return false;
+    }
+    pEvent->pdata[sizeData++] = (uint8_t) v;
+  }
+
+  pEvent->head         = ((uint16_t) val[0] & ~VSCP_HEADER16_FRAME_VERSION_MASK) | VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  pEvent->vscp_class   = (uint16_t) val[1];
+  pEvent->vscp_type    = (uint16_t) val[2];
+  pEvent->obid         = (uint32_t) val[3];
+  pEvent->timestamp_ns = timestamp ? timestamp : vscp_makeTimeStampNs();
+  pEvent->year         = 0xffff;
+  pEvent->month        = 0xff;
+  pEvent->sizeData     = sizeData;
+
+  return true;
+}
+
+bool
+VscpRemoteTcpIf::parseEventLine(vscpEvent *pEvent, const char *pline, size_t len)
+{
+  // Check pointers
+  if ((NULL == pEvent) || (NULL == pEvent->pdata) || (NULL == pline)) {
+    return false;
+  }
+
+  if (parseEventLineFast(pEvent, pline, len)) {
+    return true;
+  }
+
+  uint8_t *pdata = pEvent->pdata;
+
+  // The generic parser has no bound on the number of data bytes
+  size_t cntFields = 1;
+  for (size_t i = 0; i < len; i++) {
+    if (',' == pline[i]) {
+      cntFields++;
+    }
+  }
+  if (cntFields > (7 + VSCP_MAX_DATA)) {
+    return false;
+  }
+
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  if (!vscp_convertStringToEvent(&ev, std::string(pline, len))) {
+    return false;
+  }
+
+  *pEvent       = ev;
+  pEvent->pdata = pdata;
+  if ((NULL != ev.pdata) && ev.sizeData) {
+    memcpy(pdata, ev.pdata, ev.sizeData);
+  }
+  delete[] ev.pdata;
+
+  return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // doCmdReceive
 //
@@ -1073,6 +1875,123 @@ VscpRemoteTcpIf::doCmdBlockingReceive(vscpEventEx *pEventEx, uint32_t timeout)
   return rv;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// doCmdReceiveLoopRead
+//
+
+int
+VscpRemoteTcpIf::doCmdReceiveLoopRead(vscpEventPool &pool,
+                                      std::function<void(vscpEvent *pEvent)> fn,
+                                      int timeout,
+                                      int wakefd)
+{
+  if (!fn) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  // Must be connected
+  if (!isConnected()) {
+    return VSCP_ERROR_CONNECTION;
+  }
+
+  // If **not** in receive loop terminate
+  if (!m_bModeReceiveLoop) {
+    return VSCP_ERROR_PARAMETER;
+  }
+
+  // Decode all complete lines in the ring
+  auto decodeLines = [this, &pool, &fn]() {
+    int cnt = 0;
+    const char *pline;
+    size_t len;
+    while (m_prxRing->getLine(&pline, &len)) {
+
+      // Command responses
+      if (('+' == *pline) || ('-' == *pline)) {
+        continue;
+      }
+
+      vscpEvent *pEvent = pool.get();
+      if (!parseEventLine(pEvent, pline, len)) {
+        pool.put(pEvent);
+        continue;
+      }
+
+      fn(pEvent);
+      cnt++;
+    }
+    return cnt;
+  };
+
+  // First call, take over what was read when the loop was entered
+  if (NULL == m_prxRing) {
+    m_prxRing = new vscpLineRing(TCPIP_RECEIVE_RING_SIZE);
+    while (m_inputStrArray.size()) {
+      std::string str = m_inputStrArray.front();
+      m_inputStrArray.pop_front();
+      m_prxRing->write(str.c_str(), str.length());
+      m_prxRing->write("\n", 1);
+    }
+    m_prxRing->write(m_strResponse.c_str(), m_strResponse.length());
+    m_strResponse.clear();
+
+    if (decodeLines()) {
+      return VSCP_ERROR_SUCCESS;
+    }
+  }
+
+  // Wait for data unless TLS already holds decrypted data
+  if ((NULL == m_conn->ssl) || (SSL_pending(m_conn->ssl) <= 0)) {
+
+    struct pollfd pfd[2];
+    pfd[0].fd      = m_conn->client.sock;
+    pfd[0].events  = POLLIN;
+    pfd[0].revents = 0;
+    pfd[1].fd      = wakefd;
+    pfd[1].events  = POLLIN;
+    pfd[1].revents = 0;
+
+    int n = stcp_poll(pfd, (wakefd >= 0) ? 2 : 1, timeout, &m_conn->stop_flag);
+    if (n < 0) {
+      if ((-1 == n) && (EINTR == errno)) {
+        return VSCP_ERROR_TIMEOUT;
+      }
+      stcp_close_connection(m_conn);
+      m_conn = NULL;
+      return VSCP_ERROR_STOPPED;
+    }
+
+    if (!(pfd[0].revents & (POLLIN | POLLHUP | POLLERR))) {
+      return VSCP_ERROR_TIMEOUT;
+    }
+  }
+
+  // stcp_read clears the whole buffer before reading
+  // so read in moderate chunks
+  char *pbuf;
+  size_t space = m_prxRing->getWriteSpace(&pbuf);
+  if (space > 0x4000) {
+    space = 0x4000;
+  }
+
+  int nRead = stcp_read(m_conn, pbuf, space, 0);
+  if (nRead < 0) {
+    stcp_close_connection(m_conn);
+    m_conn = NULL;
+    return VSCP_ERROR_STOPPED;
+  }
+
+  if (0 == nRead) {
+    return VSCP_ERROR_TIMEOUT; // Partial TLS record
+  }
+
+  m_prxRing->commitWrite(nRead);
+  m_lastResponseTime = vscp_getMsTimeStamp();
+
+  decodeLines();
+  return VSCP_ERROR_SUCCESS;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // doCmdDataAvailable
 //
@@ -1284,6 +2203,32 @@ VscpRemoteTcpIf::doCmdStatistics(canal_statistics_t *pStatistics)
   return VSCP_ERROR_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// doCmdMetrics
+//
+
+int
+VscpRemoteTcpIf::doCmdMetrics(std::deque<std::string> &strarray)
+{
+  if (!isConnected()) {
+    return VSCP_ERROR_CONNECTION;
+  }
+
+  std::string strCmd("METRICS\r\n");
+  if (VSCP_ERROR_SUCCESS != doCommand(strCmd)) {
+    return VSCP_ERROR_ERROR;
+  }
+
+  // One metric per line, the last line is +OK
+  for (unsigned int i = 0; i < getInputQueueCount(); i++) {
+    if (std::string::npos == m_inputStrArray[i].find("+OK")) {
+      strarray.push_back(m_inputStrArray[i]);
+    }
+  }
+
+  return VSCP_ERROR_SUCCESS;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // doCmdFilter
 //
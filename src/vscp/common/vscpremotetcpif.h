@@ -48,6 +48,7 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <pthread.h>
 #include <semaphore.h>
 #include <sys/poll.h>
 #include <sys/socket.h>
@@ -73,6 +74,11 @@
 #include <vscpdatetime.h>
 #include <vscphelper.h>
 
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
 //---------------------------------------------------------------------------
 
 /*!
@@ -96,6 +102,26 @@
 */
 #define TCPIP_DEFAULT_INNER_RESPONSE_TIMEOUT 10
 
+/*!
+    @def TCPIP_DEFAULT_SEND_WINDOW
+    Default max number of pipelined send commands waiting
+    for a response from the remote side.
+*/
+#define TCPIP_DEFAULT_SEND_WINDOW 64
+
+/*!
+    @def TCPIP_RECEIVE_RING_SIZE
+    Size of the receive ring used in receive loop mode. Must be
+    a power of two and larger than the longest event line.
+*/
+#define TCPIP_RECEIVE_RING_SIZE 0x10000
+
+/*!
+    @def TCPIP_EVENT_POOL_SIZE
+    Max number of free events kept in an event pool.
+*/
+#define TCPIP_EVENT_POOL_SIZE 256
+
 // Default values for read/write register functions
 // used in device config and scan.
 #define TCPIP_REGISTER_READ_RESEND_TIMEOUT 1000
@@ -122,6 +148,130 @@
 // Forward declarations
 class VscpRemoteTcpIf;
 
+/*!
+    @brief Pool of preallocated events
+
+    Events handed out have pdata pointing to a buffer of VSCP_MAX_DATA
+    bytes owned by the pool. They must be returned with put() and never
+    be freed with vscp_deleteEvent. get() and put() can be called from
+    different threads.
+ */
+class vscpEventPool {
+public:
+  vscpEventPool(size_t maxFree = TCPIP_EVENT_POOL_SIZE);
+  ~vscpEventPool();
+
+  /*!
+      Get an event from the pool. A new one is allocated if the
+      pool is empty.
+      @return Pointer to cleared event with sizeData = 0.
+   */
+  vscpEvent *get(void);
+
+  /*!
+      Return an event to the pool
+      @param pEvent Event previously returned from get()
+   */
+  void put(vscpEvent *pEvent);
+
+  /*!
+      Get number of free events in the pool
+      @return Number of free events
+   */
+  size_t getFreeCount(void);
+
+private:
+  // Event and its data in one allocation, ev must be first
+  struct poolEvent {
+    vscpEvent ev;
+    uint8_t data[VSCP_MAX_DATA];
+  };
+
+  pthread_mutex_t m_mutex;
+  std::vector<poolEvent *> m_free;
+  size_t m_maxFree;
+};
+
+/*!
+    @brief Receive ring that splits incoming data into lines
+
+    Data is read from the socket straight into the ring
+    (getWriteSpace/commitWrite) and complete lines are returned as
+    pointer/length pairs into the ring. A line is only copied when it
+    wraps around the end of the ring. Lines longer than the ring are
+    dropped and counted as overruns. Not thread safe, meant to be used
+    by the one thread reading the socket.
+ */
+class vscpLineRing {
+public:
+  /*!
+      @param size Ring size. Rounded up to a power of two.
+   */
+  vscpLineRing(size_t size = TCPIP_RECEIVE_RING_SIZE);
+
+  /*!
+      Get contiguous free space to read data into
+      @param pbuf Set to start of free space
+      @return Number of bytes that can be written
+   */
+  size_t getWriteSpace(char **pbuf);
+
+  /*!
+      Commit data written to the space from getWriteSpace
+      @param n Number of bytes written
+   */
+  void commitWrite(size_t n);
+
+  /*!
+      Append data to the ring
+      @param pbuf Data to append
+      @param len Number of bytes
+      @return Number of bytes appended
+   */
+  size_t write(const char *pbuf, size_t len);
+
+  /*!
+      Get and consume next complete line. Line endings and leading
+      and trailing blanks are removed and empty lines are skipped.
+      @param pline Set to start of line. Not null terminated. Valid
+              until next call to getWriteSpace or write.
+      @param plen Set to length of line
+      @return true if a line was returned, false if there is no
+              complete line in the ring.
+   */
+  bool getLine(const char **pline, size_t *plen);
+
+  /*!
+      Remove all data from the ring
+   */
+  void clear(void);
+
+  /// Get number of bytes in the ring
+  size_t getCount(void) const { return m_head - m_tail; };
+
+  /// Get ring size
+  size_t getSize(void) const { return m_size; };
+
+  /// Get number of overlong lines that has been dropped
+  uint32_t getOverruns(void) const { return m_overruns; };
+
+private:
+  std::vector<char> m_buf;
+  std::vector<char> m_line; // Used for lines that wrap
+  size_t m_size;
+  size_t m_mask;
+
+  // Free running positions
+  size_t m_head; // Write position
+  size_t m_tail; // Start of first unconsumed line
+  size_t m_scan; // Searched for line end up to here
+
+  // Discard data up to next line end (overlong line)
+  bool m_bDiscard;
+
+  uint32_t m_overruns;
+};
+
 /*!
     @brief Class for VSCP daemon tcp/ip interface
  */
@@ -348,6 +498,83 @@ public:
    */
   int doCmdSendLevel1(const canalMsg *pMsg);
 
+  // ------------------------------------------------------------------------
+  //                            Pipelined send
+  // ------------------------------------------------------------------------
+
+  /*!
+      Send an event without waiting for the response.
+
+      The command is written directly and the response is matched
+      later, in order, when it arrives. If the send window is full
+      this call first waits for the oldest outstanding response. All
+      other commands wait for outstanding sends before they are
+      issued.
+
+      @param pEvent VSCP Level II event to send.
+      @param cb Called with VSCP_ERROR_SUCCESS for "+OK",
+              VSCP_ERROR_ERROR for "-OK" and VSCP_ERROR_TIMEOUT or
+              VSCP_ERROR_CONNECTION if no response is received. Can
+              be empty.
+      @return VSCP_ERROR_SUCCESS if the command was written, error code
+              on failure. The callback is only called in the former case.
+   */
+  int doCmdSendAsync(const vscpEvent *pEvent, std::function<void(int rv)> cb = nullptr);
+
+  /*!
+      Send an ex event without waiting for the response,
+      see doCmdSendAsync.
+   */
+  int doCmdSendAsyncEx(const vscpEventEx *pEventEx, std::function<void(int rv)> cb = nullptr);
+
+  /*!
+      Wait for responses to all outstanding pipelined sends.
+      @return VSCP_ERROR_SUCCESS when no sends are outstanding,
+              VSCP_ERROR_TIMEOUT if no response arrived within the
+              response timeout, or VSCP_ERROR_CONNECTION. On failure the
+              callbacks of all outstanding sends are called with the
+              error.
+   */
+  int doCmdSendFlush(void);
+
+  /*!
+      Send a number of events pipelined and wait for all responses.
+      Commands are written back to back, up to the send window, and
+      coalesced into as few socket writes as possible.
+      @param ppEvents Array of pointers to events
+      @param count Number of events
+      @param pcntFailed If not NULL gets the number of events that
+              were rejected or not confirmed.
+      @return VSCP_ERROR_SUCCESS if all events were confirmed,
+              VSCP_ERROR_ERROR if one or more events were rejected,
+              or the communication error.
+   */
+  int doCmdSendBatch(const vscpEvent *const *ppEvents, size_t count, size_t *pcntFailed = NULL);
+
+  /*!
+      Send a number of ex events pipelined, see doCmdSendBatch.
+      @param pEvents Array of events
+   */
+  int doCmdSendBatchEx(const vscpEventEx *pEvents, size_t count, size_t *pcntFailed = NULL);
+
+  /*!
+      Set max number of pipelined sends waiting for a response
+      @param window Window size, one or more.
+   */
+  void setSendWindow(size_t window) { m_sendWindow = (0 == window) ? 1 : window; };
+
+  /*!
+      Get max number of pipelined sends waiting for a response
+      @return Window size
+   */
+  size_t getSendWindow(void) { return m_sendWindow; };
+
+  /*!
+      Get number of pipelined sends waiting for a response
+      @return Number of outstanding sends
+   */
+  size_t getSendOutstanding(void) { return m_sendPending.size(); };
+
   /*!
       Receive a VSCP event through the interface.
       @return CANAL_ERROR_SUCCESS on success and error code if failure.
@@ -403,6 +630,31 @@ public:
 
   int doCmdBlockingReceive(vscpEventEx *pEventEx, uint32_t timeout = 500);
 
+  /*!
+      Read and decode events in receive loop mode.
+      Waits on the socket until data arrives, the timeout expires or
+      wakefd gets readable. All data available is then read into the
+      receive ring and every complete event line is decoded into an
+      event from the pool and handed to fn. No line strings are built
+      and no usleep polling is done. "+OK"/"-ERR" lines are skipped.
+      The receive loop must have been entered.
+      @param pool Pool events are taken from.
+      @param fn Called for each decoded event. fn takes over the event
+              and must return it to the pool.
+      @param timeout Max time to wait for data in milliseconds.
+      @param wakefd Descriptor that ends the wait when readable. The
+              caller drains it. -1 for none.
+      @return VSCP_ERROR_SUCCESS if data was read, VSCP_ERROR_TIMEOUT
+              on timeout or wake up, VSCP_ERROR_PARAMETER if not in
+              receive loop, VSCP_ERROR_CONNECTION if not connected and
+              VSCP_ERROR_STOPPED if the connection was lost (it is
+              then closed).
+   */
+  int doCmdReceiveLoopRead(vscpEventPool &pool,
+                           std::function<void(vscpEvent *pEvent)> fn,
+                           int timeout = 500,
+                           int wakefd  = -1);
+
   /*!
     Get the number of events in the input queue of this interface
     @return the number of events available or if negative
@@ -433,6 +685,14 @@ public:
    */
   int doCmdStatistics(canal_statistics_t *pStatistics);
 
+  /*!
+      Receive runtime metrics through the interface.
+      @param strarray Gets one metric per line on the Prometheus
+              text format.
+      @return VSCP_ERROR_SUCCESS on success and error code if failure.
+   */
+  int doCmdMetrics(std::deque<std::string> &strarray);
+
   /*!
       Set/Reset a filter through the interface.
       @return CANAL_ERROR_SUCCESS on success and error code if failure.
@@ -569,6 +829,31 @@ public:
    */
   bool getEventFromLine(vscpEvent *pEvent, const std::string &strLine);
 
+  /*!
+      Decode an event line from the server without building strings.
+      The common format sent by the server (decimal or 0x numbers,
+      empty datetime, full GUID) is decoded directly, anything else
+      goes through vscp_convertStringToEvent so the result is the same.
+      @param pEvent Event to fill in. pdata must point to a buffer of
+              at least VSCP_MAX_DATA bytes (see vscpEventPool).
+      @param pline Start of line, does not need to be null terminated.
+      @param len Length of line
+      @return true on success, false if the line is not a valid event.
+   */
+  static bool parseEventLine(vscpEvent *pEvent, const char *pline, size_t len);
+
+  /*!
+      Decode an event line on the format the server sends
+      (vscp_convertEventToString) directly into an event.
+      @param pEvent Event to fill in. pdata must point to a buffer of
+              at least VSCP_MAX_DATA bytes.
+      @param pline Start of line, does not need to be null terminated.
+      @param len Length of line
+      @return true on success, false if the line is not on the server
+              format. Use parseEventLine for other forms.
+   */
+  static bool parseEventLineFast(vscpEvent *pEvent, const char *pline, size_t len);
+
   /*!
       Get server capabilities WCYD
       WCYD (What Can You Do)
@@ -673,9 +958,55 @@ protected:
   uint32_t m_lastResponseTime;
 
 private:
+  /*!
+      Write one or more pipelined send commands
+      @param strCmds Commands, each terminated with "\r\n"
+      @param count Number of commands in strCmds
+      @param cb Completion callback for each command
+      @return VSCP_ERROR_SUCCESS if written, error code on failure.
+   */
+  int writeSendCommands(const std::string &strCmds, size_t count, std::function<void(int rv)> cb);
+
+  /*!
+      Wait until at most maxPending sends are outstanding
+      @param maxPending Number of outstanding sends to wait for
+      @return VSCP_ERROR_SUCCESS, VSCP_ERROR_TIMEOUT or
+              VSCP_ERROR_CONNECTION
+   */
+  int waitSendResponses(size_t maxPending);
+
+  /*!
+      Complete the oldest outstanding sends for response lines
+      in the response buffer.
+      @return Number of sends completed
+   */
+  size_t handleSendResponses(void);
+
+  /*!
+      Pipeline events formatted by fmt, see doCmdSendBatch
+      @param count Number of events
+      @param fmt Formats event idx into strEvent, returns false if the
+              event is invalid.
+      @param pcntFailed If not NULL gets the number of failed events.
+      @return See doCmdSendBatch
+   */
+  int sendBatch(size_t count, std::function<bool(size_t idx, std::string &strEvent)> fmt, size_t *pcntFailed);
+
+  /*!
+      Fail all outstanding sends
+      @param rv Error code for the callbacks
+   */
+  void failSendPending(int rv);
+
   /// Flag for active receive loop
   bool m_bModeReceiveLoop;
 
+  /// Max number of pipelined sends waiting for a response
+  size_t m_sendWindow;
+
+  /// Callbacks of pipelined sends waiting for a response, oldest first
+  std::deque<std::function<void(int rv)>> m_sendPending;
+
   /// Server connection timeout in **seconds**
   uint16_t m_connectionTimeOut;
 
@@ -818,6 +1149,12 @@ public:
    * or -ERR if an error response was receved.
    */
   std::string m_strResponse;
+
+  /*!
+      Receive ring used by doCmdReceiveLoopRead. Created on first
+      use and deleted when the connection is closed.
+   */
+  vscpLineRing *m_prxRing;
 };
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
@@ -286,6 +286,24 @@ CControlObject::CControlObject()
 
   m_pathClassTypeDefinitionDb = "/var/lib/vscp/vscpd/vscp_events.sqlite3";
 
+  m_bReady              = false;
+  m_idDriverStartupTask = -1;
+  m_idDiscoveryBus      = -1;
+
+  // Shared memory channel defaults
+  m_idShmBus        = -1;
+  m_bShmEnable      = false;
+  m_shmPath         = VSCP_SHM_DEFAULT_PATH;
+  m_shmQueueSize    = VSCP_SHM_DEFAULT_QUEUE_SIZE;
+  m_shmMaxClients   = VSCP_SHM_DEFAULT_MAX_CLIENTS;
+  m_bShmMqttPublish = true;
+
+  // Driver startup defaults
+  m_driverStartupMaxParallel    = VSCP_DRIVER_STARTUP_MAX_PARALLEL;
+  m_driverStartupTimeoutLoad    = VSCP_DRIVER_STARTUP_TIMEOUT_LOAD;
+  m_driverStartupTimeoutOpen    = VSCP_DRIVER_STARTUP_TIMEOUT_OPEN;
+  m_driverStartupTimeoutConnect = VSCP_DRIVER_STARTUP_TIMEOUT_CONNECT;
+
   // Logging defaults
   m_fileLogLevel     = spdlog::level::info;
   m_fileLogPattern   = "[vscpd] [%^%l%$] %v";
@@ -327,6 +345,8 @@ CControlObject::CControlObject()
   m_topicDaemonBase = "vscp-daemon/{{srvguid}}/";
   m_topicDrivers    = m_topicDaemonBase + "drivers";
   m_topicDiscovery  = m_topicDaemonBase + "discovery";
+  m_topicMetrics    = "metrics";
+  m_metricsInterval = VSCP_DAEMON_METRICS_INTERVAL;
 
   // Initialize MQTT
   if (MOSQ_ERR_SUCCESS != mosquitto_lib_init()) {
@@ -481,13 +501,9 @@ CControlObject::init(std::string &strcfgfile, std::string &rootFolder)
         uint16_t vscp_class              = (uint16_t) sqlite3_column_int(ppStmt, 0);
         std::string name                 = (const char *) sqlite3_column_text(ppStmt, 1);
         std::string token                = (const char *) sqlite3_column_text(ppStmt, 2);
-        m_map_class_id2Token[vscp_class] = token;
-        if (gDebugLevel & VSCP_DEBUG_EVENT_DATABASE) {
-          spdlog::debug("Class = {} - ", m_map_class_id2Token[vscp_class]);
-        }
-        m_map_class_token2Id[token] = vscp_class;
+        m_tokenTable.addClassToken(vscp_class, token);
         if (gDebugLevel & VSCP_DEBUG_EVENT_DATABASE) {
-          spdlog::debug("Id = {}", m_map_class_token2Id[token]);
+          spdlog::debug("Class = {} - Id = {}", token, vscp_class);
         }
       }
       sqlite3_finalize(ppStmt);
@@ -503,13 +519,9 @@ CControlObject::init(std::string &strcfgfile, std::string &rootFolder)
         uint16_t vscp_type                                     = (uint16_t) sqlite3_column_int(ppStmt, 0);
         uint16_t link_to_class                                 = (uint16_t) sqlite3_column_int(ppStmt, 1);
         std::string token                                      = (const char *) sqlite3_column_text(ppStmt, 2);
-        m_map_type_id2Token[(link_to_class << 16) + vscp_type] = token;
+        m_tokenTable.addTypeToken(link_to_class, vscp_type, token);
         if (gDebugLevel & VSCP_DEBUG_EVENT_DATABASE) {
-          spdlog::debug("Token = {} ", m_map_type_id2Token[(link_to_class << 16) + vscp_type]);
-        }
-        m_map_type_token2Id[token] = (link_to_class << 16) + vscp_type;
-        if (gDebugLevel & VSCP_DEBUG_EVENT_DATABASE) {
-          spdlog::debug("Id = {}", m_map_type_token2Id[token]);
+          spdlog::debug("Token = {} Id = {}", token, (link_to_class << 16) + vscp_type);
         }
       }
       sqlite3_finalize(ppStmt);
@@ -653,6 +665,14 @@ CControlObject::cleanup(void)
     spdlog::error("ControlObject: Exception occurred when stoping device worker threads.");
   }
 
+  m_eventBus.unsubscribe(m_idDiscoveryBus);
+  m_idDiscoveryBus = -1;
+
+  // No more events from shared memory clients after this
+  m_shmServer.stop();
+  m_eventBus.unsubscribe(m_idShmBus);
+  m_idShmBus = -1;
+
   if (gDebugLevel & VSCP_DEBUG_EXTRA) {
     spdlog::debug("ControlObject: cleanup - Stopping VSCP Server worker thread...");
   }
@@ -695,7 +715,7 @@ CControlObject::init_mqtt()
   m_mqttClient.setUserEscape("server-debug-level", vscp_str_format("0x%" PRIx64, gDebugLevel));
 
   // Add class/type tokens
-  m_mqttClient.setTokenMaps(&m_map_class_id2Token, &m_map_type_id2Token);
+  m_mqttClient.setTokenTable(&m_tokenTable);
 
   // Connect to server
   if (VSCP_ERROR_SUCCESS != m_mqttClient.connect()) {
@@ -886,10 +906,6 @@ CControlObject::run(void)
   //   return false;
   // }
 
-#ifdef WITH_SYSTEMD
-  sd_notify(0, "READY=1");
-#endif
-
   if (gDebugLevel & VSCP_DEBUG_EXTRA) {
     spdlog::debug("Controlobject: run");
   }
@@ -906,6 +922,30 @@ CControlObject::run(void)
     return false;
   }
 
+  // Discovery sees all events from drivers and the daemon
+  m_idDiscoveryBus = m_eventBus.subscribe("discovery", NULL, [this](const vscpEvent &ev) {
+    discovery(&ev);
+  });
+
+  // Shared memory clients get all events on the bus. Events from a
+  // client go to the bus, the other clients and optionally MQTT.
+  if (m_bShmEnable) {
+    m_idShmBus = m_eventBus.subscribe("shm", NULL, [this](const vscpEvent &ev) {
+      m_shmServer.sendAll(ev);
+    });
+    m_shmServer.setOptions(m_shmQueueSize, m_shmMaxClients);
+    int rv = m_shmServer.start(m_shmPath, [this](uint32_t id, vscpEvent &ev) {
+      m_eventBus.publish(ev, m_idShmBus);
+      m_shmServer.sendAll(ev, id);
+      if (m_bShmMqttPublish) {
+        m_mqttClient.send(ev);
+      }
+    });
+    if (VSCP_ERROR_SUCCESS != rv) {
+      spdlog::error("controlobject: Failed to start shared memory server on {0}. rv={1}", m_shmPath, rv);
+    }
+  }
+
   // Load drivers
   try {
     if (!startDeviceWorkerThreads()) {
@@ -922,39 +962,67 @@ CControlObject::run(void)
   //                            MAIN - LOOP
   //-------------------------------------------------------------------------
 
-#ifdef WIN32
-  struct timeval now, old_now;
-#else
-  struct timespec now, old_now;
-#endif
-  clock_gettime(CLOCK_REALTIME, &old_now);
-  old_now.tv_sec -= 60; // Do first send right away
-
-  if (gDebugLevel & VSCP_DEBUG_EXTRA) {
-    spdlog::debug("controlobject: Main loop starting...");
+  // The loop sleeps until a task is due or the daemon is stopped
+  if (VSCP_ERROR_SUCCESS != m_scheduler.init()) {
+    spdlog::critical("controlobject: Failed to initialize main loop scheduler.");
+    return false;
   }
 
-  while (!m_bQuit) {
-
-    clock_gettime(CLOCK_REALTIME, &now);
+  // Heartbeats and other automation events, first send right away
+  m_scheduler.addTask("periodic-events", VSCP_DAEMON_PERIODIC_EVENTS_INTERVAL, [this]() {
+    if (!periodicEvents()) {
+      spdlog::error("Failed to send automation events.");
+    }
+  });
 
-    // We send heartbeat every minute
-    if ((now.tv_sec - old_now.tv_sec) > 60) {
+  // Drivers start in their own threads. Ready is reported when all
+  // required drivers are live, timing is logged when all are settled.
+  m_bReady              = false;
+  m_idDriverStartupTask = m_scheduler.addTask("driver-startup", VSCP_DAEMON_DRIVER_STARTUP_INTERVAL, [this]() {
+    checkDriverStartup();
+  });
 
-      // Save time
-      clock_gettime(CLOCK_REALTIME, &old_now);
+  // Runtime metrics
+  if (vscpMetrics::isEnabled() && m_metricsInterval) {
+    m_scheduler.addTask("metrics", m_metricsInterval, [this]() {
+      publishMetrics();
+    });
+  }
 
-      if (!periodicEvents()) {
-        spdlog::error("Failed to send automation events.");
-      }
+  // Rate limited measurements must go out even if no more events come
+  bool bCoalesce = m_mqttClient.m_coalesce.isEnabled();
+  for (std::deque<CDeviceItem *>::iterator it = m_deviceList.m_devItemList.begin();
+       it != m_deviceList.m_devItemList.end();
+       ++it) {
+    if ((NULL != *it) && (*it)->m_mqttClient.m_coalesce.isEnabled()) {
+      bCoalesce = true;
     }
+  }
 
-    usleep(5000);
+  if (bCoalesce) {
+    m_scheduler.addTask("mqtt-coalesce", VSCP_DAEMON_COALESCE_INTERVAL, [this]() {
+      flushCoalesced();
+    });
+  }
 
 #ifdef WITH_SYSTEMD
-    sd_notify(0, "WATCHDOG=1");
+  uint64_t watchdog_usec = 0;
+  if (sd_watchdog_enabled(0, &watchdog_usec) > 0) {
+    m_scheduler.addTask("watchdog", watchdog_usec / 2, []() {
+      sd_notify(0, "WATCHDOG=1");
+    });
+  }
 #endif
 
+  if (gDebugLevel & VSCP_DEBUG_EXTRA) {
+    spdlog::debug("controlobject: Main loop starting...");
+  }
+
+  while (!m_bQuit) {
+    if (VSCP_ERROR_ERROR == m_scheduler.runOnce()) {
+      spdlog::error("controlobject: Main loop wait failed. {}", strerror(errno));
+      usleep(10000);
+    }
   } // while
 
   if (gDebugLevel & VSCP_DEBUG_EXTRA) {
@@ -981,6 +1049,58 @@ CControlObject::run(void)
   return true;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// checkDriverStartup
+//
+
+void
+CControlObject::checkDriverStartup(void)
+{
+  bool bRequiredLive   = false;
+  bool bRequiredFailed = false;
+  bool bSettled        = m_deviceList.checkStartup(&bRequiredLive, &bRequiredFailed);
+
+  if (bRequiredFailed) {
+    spdlog::critical("controlobject: Required driver failed to start.");
+    m_deviceList.logStartupReport();
+#ifdef WITH_SYSTEMD
+    sd_notify(0, "STATUS=Required driver failed to start");
+#endif
+    m_scheduler.removeTask(m_idDriverStartupTask);
+    m_bQuit = true;
+    return;
+  }
+
+  if (!m_bReady && bRequiredLive) {
+    m_bReady = true;
+#ifdef WITH_SYSTEMD
+    sd_notify(0, "READY=1");
+#endif
+  }
+
+  if (bSettled) {
+    m_deviceList.logStartupReport();
+    m_scheduler.removeTask(m_idDriverStartupTask);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// flushCoalesced
+//
+
+void
+CControlObject::flushCoalesced(void)
+{
+  m_mqttClient.flushCoalesced();
+
+  std::deque<CDeviceItem *>::iterator it;
+  for (it = m_deviceList.m_devItemList.begin(); it != m_deviceList.m_devItemList.end(); ++it) {
+    if (NULL != *it) {
+      (*it)->m_mqttClient.flushCoalesced();
+    }
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // sendEvent
 //
@@ -998,6 +1118,9 @@ CControlObject::sendEvent(vscpEventEx *pex)
     return false;
   }
 
+  // Deliver to drivers and services in the daemon
+  m_eventBus.publish(*pex);
+
   // send the event
   if (VSCP_ERROR_SUCCESS != m_mqttClient.send(*pex)) {
     return false;
@@ -1006,6 +1129,37 @@ CControlObject::sendEvent(vscpEventEx *pex)
   return true;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// publishMetrics
+//
+
+bool
+CControlObject::publishMetrics(void)
+{
+  int rv;
+
+  mustache subtemplate{ m_topicDaemonBase + m_topicMetrics };
+  data data;
+  data.set("guid", m_guid.getAsString());
+  data.set("srvguid", m_guid.getAsString());
+  data.set("ifguid", m_guid.getAsString());
+  std::string strTopic   = subtemplate.render(data);
+  std::string strPayload = vscpMetrics::getInstance().getAsJSON();
+
+  if (MOSQ_ERR_SUCCESS != (rv = mosquitto_publish(m_mqttClient.getMqttHandle(),
+                                                  NULL,
+                                                  strTopic.c_str(),
+                                                  (int) strPayload.length(),
+                                                  strPayload.c_str(),
+                                                  0,
+                                                  false))) {
+    spdlog::error("Failed to publish VSCP daemon metrics. error={0} {1}", rv, mosquitto_strerror(rv));
+    return false;
+  }
+
+  return true;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // periodicEvents
 //
@@ -1147,7 +1301,7 @@ CControlObject::periodicEvents(void)
 //
 
 void
-CControlObject::discovery(vscpEvent *pev)
+CControlObject::discovery(const vscpEvent *pev)
 {
   int rv;
 
@@ -1242,6 +1396,11 @@ CControlObject::startDeviceWorkerThreads(void)
     spdlog::debug("controlobject: [Driver] - Starting drivers...");
   }
 
+  m_deviceList.setStartupConfig(m_driverStartupMaxParallel,
+                                m_driverStartupTimeoutLoad,
+                                m_driverStartupTimeoutOpen,
+                                m_driverStartupTimeoutConnect);
+
   std::deque<CDeviceItem *>::iterator it;
   for (it = m_deviceList.m_devItemList.begin(); it != m_deviceList.m_devItemList.end(); ++it) {
 
@@ -2086,6 +2245,77 @@ CControlObject::readJSON(const json &j)
     }
   }
 
+  // ********************************************************************************
+  //                                   Metrics
+  // ********************************************************************************
+
+  if (j.contains("metrics") && j["metrics"].is_object()) {
+
+    json jm = j["metrics"];
+
+    // Collection is off by default
+    if (jm.contains("enable") && jm["enable"].is_boolean()) {
+      vscpMetrics::enable(jm["enable"].get<bool>());
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: 'metrics enable' set to {}", vscpMetrics::isEnabled());
+      }
+    }
+
+    // Seconds between publishes on the metrics topic, zero for none
+    if (jm.contains("interval") && jm["interval"].is_number_unsigned()) {
+      m_metricsInterval = jm["interval"].get<uint64_t>() * 1000000;
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: 'metrics interval' set to {}", m_metricsInterval / 1000000);
+      }
+    }
+  }
+
+  // ********************************************************************************
+  //                              Shared memory channel
+  // ********************************************************************************
+
+  if (j.contains("shm") && j["shm"].is_object()) {
+
+    json js = j["shm"];
+
+    // Off by default
+    if (js.contains("enable") && js["enable"].is_boolean()) {
+      m_bShmEnable = js["enable"].get<bool>();
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: 'shm enable' set to {}", m_bShmEnable);
+      }
+    }
+
+    if (js.contains("path") && js["path"].is_string()) {
+      m_shmPath = js["path"].get<std::string>();
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: 'shm path' set to {}", m_shmPath);
+      }
+    }
+
+    // Events in each ring, rounded up to a power of two
+    if (js.contains("queue-size") && js["queue-size"].is_number_unsigned()) {
+      m_shmQueueSize = js["queue-size"].get<uint32_t>();
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: 'shm queue-size' set to {}", m_shmQueueSize);
+      }
+    }
+
+    if (js.contains("max-clients") && js["max-clients"].is_number_unsigned()) {
+      m_shmMaxClients = js["max-clients"].get<size_t>();
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: 'shm max-clients' set to {}", m_shmMaxClients);
+      }
+    }
+
+    if (js.contains("mqtt-publish") && js["mqtt-publish"].is_boolean()) {
+      m_bShmMqttPublish = js["mqtt-publish"].get<bool>();
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: 'shm mqtt-publish' set to {}", m_bShmMqttPublish);
+      }
+    }
+  }
+
   // ********************************************************************************
   //                                     Main MQTT
   // ********************************************************************************
@@ -2144,6 +2374,14 @@ CControlObject::readJSON(const json &j)
       }
     }
 
+    // MQTT topic-metrics, always under the daemon base
+    if (j["mqtt"].contains("topic-metrics") && j["mqtt"]["topic-metrics"].is_string()) {
+      m_topicMetrics = j["mqtt"]["topic-metrics"].get<std::string>();
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: MQTT 'topic-metrics' set to {}", m_topicMetrics);
+      }
+    }
+
     // Add base as prefix if defined
     if (m_topicDaemonBase.length()) {
       m_topicDrivers   = m_topicDaemonBase + m_topicDrivers;
@@ -2162,6 +2400,23 @@ CControlObject::readJSON(const json &j)
     }
   }
   else {
+
+    // Driver startup
+    if (j["drivers"].contains("startup") && j["drivers"]["startup"].is_object()) {
+      json startup                  = j["drivers"]["startup"];
+      m_driverStartupMaxParallel    = startup.value("max-parallel", m_driverStartupMaxParallel);
+      m_driverStartupTimeoutLoad    = startup.value("timeout-load", m_driverStartupTimeoutLoad);
+      m_driverStartupTimeoutOpen    = startup.value("timeout-open", m_driverStartupTimeoutOpen);
+      m_driverStartupTimeoutConnect = startup.value("timeout-connect", m_driverStartupTimeoutConnect);
+      if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+        spdlog::debug("ReadConfig: Driver startup max-parallel={} timeouts load={}s open={}s connect={}s",
+                      m_driverStartupMaxParallel,
+                      m_driverStartupTimeoutLoad,
+                      m_driverStartupTimeoutOpen,
+                      m_driverStartupTimeoutConnect);
+      }
+    }
+
     // Level I drivers
     if (!(j["drivers"].contains("level1") && j["drivers"]["level1"].is_object())) {
 
@@ -2194,6 +2449,26 @@ CControlObject::readJSON(const json &j)
                             (*it)["path"].get<std::string>());
             }
 
+            // Daemon is not ready until required drivers are live
+            if ((*it).value("required", false)) {
+              CDeviceItem *pDriver = m_deviceList.getDeviceItemFromName((*it)["name"]);
+              if (nullptr != pDriver) {
+                pDriver->m_bRequired = true;
+              }
+            }
+
+            // ********************************************************************************
+            //                               Level I driver bus
+            // ********************************************************************************
+
+            if ((*it).contains("bus") && (*it)["bus"].is_object()) {
+              CDeviceItem *pDriver = m_deviceList.getDeviceItemFromName((*it)["name"]);
+              if ((nullptr != pDriver) && !readDriverBusConfig(pDriver, (*it)["bus"])) {
+                spdlog::error("ReadConfig: Level I Driver: Invalid bus configuration.");
+                return false;
+              }
+            }
+
             // ********************************************************************************
             //                               Level I driver MQTT
             // ********************************************************************************
@@ -2256,6 +2531,26 @@ CControlObject::readJSON(const json &j)
                             (*it)["path-driver"].get<std::string>());
             }
 
+            // Daemon is not ready until required drivers are live
+            if ((*it).value("required", false)) {
+              CDeviceItem *pDriver = m_deviceList.getDeviceItemFromName((*it)["name"]);
+              if (nullptr != pDriver) {
+                pDriver->m_bRequired = true;
+              }
+            }
+
+            // ********************************************************************************
+            //                               Level II driver bus
+            // ********************************************************************************
+
+            if ((*it).contains("bus") && (*it)["bus"].is_object()) {
+              CDeviceItem *pDriver = m_deviceList.getDeviceItemFromName((*it)["name"]);
+              if ((nullptr != pDriver) && !readDriverBusConfig(pDriver, (*it)["bus"])) {
+                spdlog::error("ReadConfig: Level II Driver: Invalid bus configuration.");
+                return false;
+              }
+            }
+
             // ********************************************************************************
             //                               Level II driver MQTT
             // ********************************************************************************
@@ -2293,6 +2588,51 @@ CControlObject::readJSON(const json &j)
   return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// readDriverBusConfig
+//
+// "bus": {
+//   "subscribe": true,
+//   "filter": "0,10,6,00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:00",
+//   "mask": "0,0xffff,0xffff,00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:00",
+//   "mqtt-publish": true
+// }
+//
+
+bool
+CControlObject::readDriverBusConfig(CDeviceItem *pDriver, const json &j)
+{
+  if (nullptr == pDriver) {
+    return false;
+  }
+
+  pDriver->m_bBusSubscribe   = j.value("subscribe", pDriver->m_bBusSubscribe);
+  pDriver->m_bBusMqttPublish = j.value("mqtt-publish", pDriver->m_bBusMqttPublish);
+
+  if (j.contains("filter") && j["filter"].is_string()) {
+    if (!vscp_readFilterFromString(&pDriver->m_busFilter, j["filter"].get<std::string>())) {
+      spdlog::error("ReadConfig: Driver {}: Invalid bus filter.", pDriver->m_strName);
+      return false;
+    }
+  }
+
+  if (j.contains("mask") && j["mask"].is_string()) {
+    if (!vscp_readMaskFromString(&pDriver->m_busFilter, j["mask"].get<std::string>())) {
+      spdlog::error("ReadConfig: Driver {}: Invalid bus mask.", pDriver->m_strName);
+      return false;
+    }
+  }
+
+  if (gDebugLevel & VSCP_DEBUG_CONFIG) {
+    spdlog::debug("ReadConfig: Driver {} bus subscribe={} mqtt-publish={}",
+                  pDriver->m_strName,
+                  pDriver->m_bBusSubscribe ? "true" : "false",
+                  pDriver->m_bBusMqttPublish ? "true" : "false");
+  }
+
+  return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // readConfiguration
 //
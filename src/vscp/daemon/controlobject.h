@@ -34,6 +34,11 @@
 #include <devicelist.h>
 #include <mqtt.h>
 #include <vscp.h>
+#include <vscp-eventbus.h>
+#include <vscp-metrics.h>
+#include <vscp-scheduler.h>
+#include <vscp-shm.h>
+#include <vscp-token.h>
 #include <vscpmqtt.h>
 
 #include <map>
@@ -66,6 +71,12 @@ using namespace kainjow::mustache;
 
 #define VSCP_MAX_DEVICES 1024 // abs. max. is 0xffff
 
+// Main loop task intervals (microseconds)
+#define VSCP_DAEMON_PERIODIC_EVENTS_INTERVAL (60 * 1000000) // Heartbeats etc
+#define VSCP_DAEMON_DRIVER_STARTUP_INTERVAL  (10 * 1000)    // Driver startup checks
+#define VSCP_DAEMON_METRICS_INTERVAL         (10 * 1000000) // Metrics publish (default)
+#define VSCP_DAEMON_COALESCE_INTERVAL        (100 * 1000)   // Held back MQTT measurements
+
 /*!
     This is the class that does the main work in the daemon.
 */
@@ -127,12 +138,31 @@ public:
   */
   bool periodicEvents(void);
 
+  /*!
+      Publish runtime metrics as JSON on the metrics topic
+      @return true on success, false on failure
+  */
+  bool publishMetrics(void);
+
+  /*!
+      Publish measurements held back by MQTT coalescing that are
+      due, for the daemon and all drivers.
+  */
+  void flushCoalesced(void);
+
   /*!
       Start worker threads for devices
       @return true on success, false on failure
    */
   bool startDeviceWorkerThreads(void);
 
+  /*!
+      Check driver startup progress. Reports ready to systemd when
+      all required drivers are live. Runs as a main loop task until
+      all drivers are settled.
+   */
+  void checkDriverStartup(void);
+
   /*!
       Stop worker threads for devices
       @return true on success, false on failure
@@ -169,6 +199,14 @@ public:
   */
   bool readJSON(const json &j);
 
+  /*!
+      Read the event bus block of a driver configuration
+      @param pDriver Pointer to the driver
+      @param j JSON "bus" object of the driver
+      @return Returns true on success false on failure.
+  */
+  bool readDriverBusConfig(CDeviceItem *pDriver, const json &j);
+
   /*!
       Read the encryption key from a safe location
       @param path Path to file containing the 256 byte key as a
@@ -185,7 +223,7 @@ public:
 
       @param pev Pointer to VSCP event
   */
-  void discovery(vscpEvent *pev);
+  void discovery(const vscpEvent *pev);
 
   /*!
       Get VSCP class token from id
@@ -193,7 +231,7 @@ public:
       @param id VSCP class
       @return VSCP class token as string
   */
-  std::string getTokenFromClassId(uint16_t id) { return m_map_class_id2Token[id]; }
+  std::string getTokenFromClassId(uint16_t id) { return m_tokenTable.getClassToken(id); }
 
   /*!
       Get VSCP type token from class and type id
@@ -202,7 +240,7 @@ public:
       @param tid VSCP class
       @return VSCP class token as string
   */
-  std::string getTokenFromTypeId(uint16_t cid, uint16_t tid) { return m_map_type_id2Token[((cid << 16) + tid)]; }
+  std::string getTokenFromTypeId(uint16_t cid, uint16_t tid) { return m_tokenTable.getTypeToken(cid, tid); }
 
 public:
 
@@ -258,11 +296,12 @@ public:
   */
   std::string m_pathClassTypeDefinitionDb;
 
-  std::map<uint16_t, std::string> m_map_class_id2Token; // vscp_class -> class_token
-  std::map<std::string, uint16_t> m_map_class_token2Id; // class_token -> vscp_class
-
-  std::map<uint32_t, std::string> m_map_type_id2Token; // ((vscp_class << 16) + vscp_type) -> type_token
-  std::map<std::string, uint32_t> m_map_type_token2Id; // type_token -> ((vscp_class << 16) + vscp_type)
+  /*!
+      Class/type tokens. Built in tokens overridden by the tokens
+      in the class/type definition database. Filled in at startup,
+      read only after that.
+  */
+  vscpTokenTable m_tokenTable;
 
   /*!
       Path to discovery database
@@ -279,11 +318,75 @@ public:
 
   // The list with available devices.
   CDeviceList m_deviceList;
+
+  // True when ready has been reported
+  bool m_bReady;
+
+  // Main loop task checking driver startup
+  int m_idDriverStartupTask;
+
+  // Driver startup ("drivers/startup" in configuration)
+  uint16_t m_driverStartupMaxParallel;     // Drivers starting at the same time
+  uint32_t m_driverStartupTimeoutLoad;     // Load stage timeout (seconds)
+  uint32_t m_driverStartupTimeoutOpen;     // Open stage timeout (seconds)
+  uint32_t m_driverStartupTimeoutConnect;  // MQTT connect stage timeout (seconds)
   pthread_mutex_t m_mutex_DeviceList;
 
   // Mutex for device queue
   pthread_mutex_t m_mutex_deviceList;
 
+  //**************************************************************************
+  //                                MAIN LOOP
+  //**************************************************************************
+
+  // Runs the periodic main loop tasks
+  vscpScheduler m_scheduler;
+
+  //**************************************************************************
+  //                            EVENT BUS
+  //**************************************************************************
+
+  /*!
+    Events from drivers and the daemon are published here before
+    they go to the MQTT broker. Drivers with a "bus" subscription
+    and internal services (discovery) get them directly without a
+    round trip through the broker.
+  */
+  vscpEventBus m_eventBus;
+
+  // Discovery bus subscription
+  int m_idDiscoveryBus;
+
+  //**************************************************************************
+  //                          SHARED MEMORY CHANNEL
+  //**************************************************************************
+
+  /*!
+    Local clients (parsers, field bus drivers) exchange events with
+    the daemon through shared memory rings set up over this server.
+    Events from a client are published on the event bus and handed
+    to the other clients.
+  */
+  vscpShmServer m_shmServer;
+
+  // Shared memory bus subscription
+  int m_idShmBus;
+
+  // Start the shared memory server
+  bool m_bShmEnable;
+
+  // Path to the Unix socket clients connect to
+  std::string m_shmPath;
+
+  // Events in each ring
+  uint32_t m_shmQueueSize;
+
+  // Max number of connected clients
+  size_t m_shmMaxClients;
+
+  // Also publish events from shared memory clients to MQTT
+  bool m_bShmMqttPublish;
+
   //**************************************************************************
   //                            LOGGER (SPDLOG)
   //**************************************************************************
@@ -326,6 +429,15 @@ public:
   */
   std::string m_topicDiscovery;  
 
+  /*!
+    Topic under daemon base on which the daemon publish runtime metrics
+    Default is 'daemon-base'/metrics
+  */
+  std::string m_topicMetrics;
+
+  // Microseconds between metrics publishes
+  uint64_t m_metricsInterval;
+
 private:
   //struct mosquitto *m_mosq; // Handel for MQTT connection
 };
@@ -46,6 +46,9 @@
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <time.h>
+
+#include <algorithm>
 
 #include <canal.h>
 #include <controlobject.h>
@@ -90,6 +93,11 @@ CDeviceItem::CDeviceItem()
 
   bJsonMeasurementAdd = false;
 
+  m_busId           = -1;
+  m_bBusSubscribe   = false;
+  m_bBusMqttPublish = true;
+  vscp_clearVSCPFilter(&m_busFilter); // Receive all
+
   m_strName.clear();      // No Device Name
   m_strParameter.clear(); // No Parameters
   m_strPath.clear();      // No path
@@ -123,6 +131,9 @@ CDeviceItem::CDeviceItem()
   m_proc_CanalBlockingReceive = NULL;
   m_proc_CanalGetdriverInfo   = NULL;
 
+  // Generation 3
+  m_proc_CanalBlockingReceiveBatch = NULL;
+
   // VSCP Level II
   m_proc_VSCPOpen       = NULL;
   m_proc_VSCPClose      = NULL;
@@ -130,6 +141,15 @@ CDeviceItem::CDeviceItem()
   m_proc_VSCPRead       = NULL;
   m_proc_VSCPGetVersion = NULL;
   m_proc_VSCPGetVersion = NULL;
+  m_proc_VSCPReadBatch  = NULL;
+
+  // Startup
+  m_bRequired       = false;
+  m_startupStage    = VSCP_DRIVER_STARTUP_PENDING;
+  m_bStartupSlot    = false;
+  m_bStartupTimeout = false;
+  memset(m_startupStageTime, 0, sizeof(m_startupStageTime));
+  m_startupStageStart = std::chrono::steady_clock::now();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -212,12 +232,19 @@ CDeviceItem::startDriver(CControlObject *pCtrlObject)
     return true;
   }
 
+  m_startupStage      = VSCP_DRIVER_STARTUP_PENDING;
+  m_bStartupSlot      = false;
+  m_bStartupTimeout   = false;
+  m_startupStageStart = std::chrono::steady_clock::now();
+  memset(m_startupStageTime, 0, sizeof(m_startupStageTime));
+
   // *****************************************
   //  Create the worker thread for the device
   // *****************************************
 
   if (pthread_create(&m_deviceThreadHandle, NULL, deviceThread, this)) {
     spdlog::error("[Driver {}] - Unable to start the device thread.", m_strName.c_str());
+    m_startupStage = VSCP_DRIVER_STARTUP_FAILED;
     return false;
   }
 
@@ -292,11 +319,14 @@ CDeviceItem::sendEvent(vscpEvent *pev)
     return false;
   }
 
-  // Send the event to the discovery routine
-  m_pCtrlObj->discovery(pev);
+  // Deliver to drivers and services in the daemon (discovery is one
+  // of them). The driver does not get its own events back.
+  m_pCtrlObj->m_eventBus.publish(*pev, m_busId);
 
   // Send the event
-  m_mqttClient.send(*pev);
+  if (m_bBusMqttPublish) {
+    m_mqttClient.send(*pev);
+  }
 
   return (0 == rv);
 }
@@ -311,7 +341,17 @@ CDeviceItem::sendEvent(vscpEvent *pev)
 
 CDeviceList::CDeviceList(void)
 {
-  ;
+  pthread_mutex_init(&m_mutexStartup, NULL);
+
+  m_startupMaxParallel = VSCP_DRIVER_STARTUP_MAX_PARALLEL;
+  sem_init(&m_semStartupSlots, 0, m_startupMaxParallel);
+
+  m_startupTimeout[VSCP_DRIVER_STARTUP_PENDING] = 0; // Waiting for a slot is not timed
+  m_startupTimeout[VSCP_DRIVER_STARTUP_LOAD]    = VSCP_DRIVER_STARTUP_TIMEOUT_LOAD * 1000;
+  m_startupTimeout[VSCP_DRIVER_STARTUP_OPEN]    = VSCP_DRIVER_STARTUP_TIMEOUT_OPEN * 1000;
+  m_startupTimeout[VSCP_DRIVER_STARTUP_CONNECT] = VSCP_DRIVER_STARTUP_TIMEOUT_CONNECT * 1000;
+
+  m_startupBegin = std::chrono::steady_clock::now();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -327,6 +367,9 @@ CDeviceList::~CDeviceList(void)
   }
 
   m_devItemList.clear();
+
+  sem_destroy(&m_semStartupSlots);
+  pthread_mutex_destroy(&m_mutexStartup);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -541,4 +584,256 @@ CDeviceList::getCountDrivers(uint8_t type, bool bOnlyActive)
   }
 
   return count;
-}
\ No newline at end of file
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getStartupStageName
+//
+
+static const char *
+getStartupStageName(int stage)
+{
+  switch (stage) {
+    case VSCP_DRIVER_STARTUP_PENDING:
+      return "pending";
+    case VSCP_DRIVER_STARTUP_LOAD:
+      return "load";
+    case VSCP_DRIVER_STARTUP_OPEN:
+      return "open";
+    case VSCP_DRIVER_STARTUP_CONNECT:
+      return "connect";
+    case VSCP_DRIVER_STARTUP_READY:
+      return "ready";
+    case VSCP_DRIVER_STARTUP_FAILED:
+      return "failed";
+  }
+  return "unknown";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// setStartupConfig
+//
+
+void
+CDeviceList::setStartupConfig(uint16_t maxParallel,
+                              uint32_t timeoutLoad,
+                              uint32_t timeoutOpen,
+                              uint32_t timeoutConnect)
+{
+  sem_destroy(&m_semStartupSlots);
+  m_startupMaxParallel = maxParallel;
+  sem_init(&m_semStartupSlots, 0, m_startupMaxParallel);
+
+  m_startupBegin = std::chrono::steady_clock::now();
+
+  m_startupTimeout[VSCP_DRIVER_STARTUP_LOAD]    = timeoutLoad * 1000;
+  m_startupTimeout[VSCP_DRIVER_STARTUP_OPEN]    = timeoutOpen * 1000;
+  m_startupTimeout[VSCP_DRIVER_STARTUP_CONNECT] = timeoutConnect * 1000;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// acquireStartupSlot
+//
+
+bool
+CDeviceList::acquireStartupSlot(CDeviceItem *pItem)
+{
+  if (NULL == pItem) {
+    return false;
+  }
+
+  if (m_startupMaxParallel) {
+    while (true) {
+      struct timespec ts;
+      clock_gettime(CLOCK_REALTIME, &ts);
+      ts.tv_nsec += 100 * 1000000; // 100 ms
+      if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+      }
+
+      if (0 == sem_timedwait(&m_semStartupSlots, &ts)) {
+        break;
+      }
+
+      if (pItem->m_bQuit) {
+        setStartupStage(pItem, VSCP_DRIVER_STARTUP_FAILED);
+        return false;
+      }
+    }
+  }
+
+  pthread_mutex_lock(&m_mutexStartup);
+  pItem->m_bStartupSlot = (0 != m_startupMaxParallel);
+  pthread_mutex_unlock(&m_mutexStartup);
+
+  setStartupStage(pItem, VSCP_DRIVER_STARTUP_LOAD);
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// setStartupStage
+//
+
+void
+CDeviceList::setStartupStage(CDeviceItem *pItem, int stage)
+{
+  if (NULL == pItem) {
+    return;
+  }
+
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+  pthread_mutex_lock(&m_mutexStartup);
+
+  if (pItem->m_startupStage < VSCP_DRIVER_STARTUP_TIMED_STAGES) {
+    pItem->m_startupStageTime[pItem->m_startupStage] += (uint32_t) std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                          now - pItem->m_startupStageStart)
+                                                          .count();
+  }
+
+  pItem->m_startupStage      = stage;
+  pItem->m_startupStageStart = now;
+
+  if ((stage >= VSCP_DRIVER_STARTUP_READY) && pItem->m_bStartupSlot) {
+    pItem->m_bStartupSlot = false;
+    sem_post(&m_semStartupSlots);
+  }
+
+  pthread_mutex_unlock(&m_mutexStartup);
+
+  if ((VSCP_DRIVER_STARTUP_READY == stage) && pItem->m_bStartupTimeout) {
+    spdlog::warn("[Driver {}] - Driver is live after startup timeout.", pItem->m_strName);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// checkStartup
+//
+
+bool
+CDeviceList::checkStartup(bool *pbRequiredLive, bool *pbRequiredFailed)
+{
+  bool bSettled        = true;
+  bool bRequiredLive   = true;
+  bool bRequiredFailed = false;
+
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+  pthread_mutex_lock(&m_mutexStartup);
+
+  std::deque<CDeviceItem *>::iterator iter;
+  for (iter = m_devItemList.begin(); iter != m_devItemList.end(); ++iter) {
+    CDeviceItem *pItem = *iter;
+    if ((NULL == pItem) || !pItem->m_bEnable) {
+      continue;
+    }
+
+    int stage = pItem->m_startupStage;
+
+    // Give up on drivers stuck in a timed stage
+    if (!pItem->m_bStartupTimeout && (stage > VSCP_DRIVER_STARTUP_PENDING) &&
+        (stage < VSCP_DRIVER_STARTUP_TIMED_STAGES) &&
+        (std::chrono::duration_cast<std::chrono::milliseconds>(now - pItem->m_startupStageStart).count() >=
+         m_startupTimeout[stage])) {
+
+      pItem->m_bStartupTimeout = true;
+      spdlog::error("[Driver {}] - Startup timed out in stage '{}' after {} ms.",
+                    pItem->m_strName,
+                    getStartupStageName(stage),
+                    m_startupTimeout[stage]);
+
+      // Let the next driver start
+      if (pItem->m_bStartupSlot) {
+        pItem->m_bStartupSlot = false;
+        sem_post(&m_semStartupSlots);
+      }
+    }
+
+    bool bLive   = (VSCP_DRIVER_STARTUP_READY == stage);
+    bool bFailed = (VSCP_DRIVER_STARTUP_FAILED == stage) || (!bLive && pItem->m_bStartupTimeout);
+
+    if (!bLive && !bFailed) {
+      bSettled = false;
+    }
+
+    if (pItem->m_bRequired) {
+      if (!bLive) {
+        bRequiredLive = false;
+      }
+      if (bFailed) {
+        bRequiredFailed = true;
+      }
+    }
+  }
+
+  pthread_mutex_unlock(&m_mutexStartup);
+
+  if (NULL != pbRequiredLive) {
+    *pbRequiredLive = bRequiredLive;
+  }
+
+  if (NULL != pbRequiredFailed) {
+    *pbRequiredFailed = bRequiredFailed;
+  }
+
+  return bSettled;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// logStartupReport
+//
+
+void
+CDeviceList::logStartupReport(void)
+{
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::deque<CDeviceItem *> items;
+  uint16_t nLive   = 0;
+  uint16_t nFailed = 0;
+
+  pthread_mutex_lock(&m_mutexStartup);
+
+  std::deque<CDeviceItem *>::iterator iter;
+  for (iter = m_devItemList.begin(); iter != m_devItemList.end(); ++iter) {
+    CDeviceItem *pItem = *iter;
+    if ((NULL != pItem) && pItem->m_bEnable) {
+      items.push_back(pItem);
+      if (VSCP_DRIVER_STARTUP_READY == pItem->m_startupStage) {
+        nLive++;
+      }
+      else {
+        nFailed++;
+      }
+    }
+  }
+
+  // Slowest first (pending time is not counted)
+  std::sort(items.begin(), items.end(), [](const CDeviceItem *a, const CDeviceItem *b) {
+    return (a->m_startupStageTime[VSCP_DRIVER_STARTUP_LOAD] + a->m_startupStageTime[VSCP_DRIVER_STARTUP_OPEN] +
+            a->m_startupStageTime[VSCP_DRIVER_STARTUP_CONNECT]) >
+           (b->m_startupStageTime[VSCP_DRIVER_STARTUP_LOAD] + b->m_startupStageTime[VSCP_DRIVER_STARTUP_OPEN] +
+            b->m_startupStageTime[VSCP_DRIVER_STARTUP_CONNECT]);
+  });
+
+  spdlog::info("Driver startup: {} live, {} failed in {} ms (max {} in parallel).",
+               nLive,
+               nFailed,
+               std::chrono::duration_cast<std::chrono::milliseconds>(now - m_startupBegin).count(),
+               m_startupMaxParallel);
+
+  for (iter = items.begin(); iter != items.end(); ++iter) {
+    CDeviceItem *pItem = *iter;
+    bool bTimeout = pItem->m_bStartupTimeout && (VSCP_DRIVER_STARTUP_READY != pItem->m_startupStage);
+    spdlog::info("Driver startup: {:<24} {:<8}{} pending {} ms, load {} ms, open {} ms, connect {} ms",
+                 pItem->m_strName,
+                 bTimeout ? "timeout" : getStartupStageName(pItem->m_startupStage),
+                 pItem->m_bRequired ? " (required)" : "",
+                 pItem->m_startupStageTime[VSCP_DRIVER_STARTUP_PENDING],
+                 pItem->m_startupStageTime[VSCP_DRIVER_STARTUP_LOAD],
+                 pItem->m_startupStageTime[VSCP_DRIVER_STARTUP_OPEN],
+                 pItem->m_startupStageTime[VSCP_DRIVER_STARTUP_CONNECT]);
+  }
+
+  pthread_mutex_unlock(&m_mutexStartup);
+}
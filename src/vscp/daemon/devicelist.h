@@ -38,6 +38,7 @@
 #include <guid.h>
 #include <level2drvdef.h>
 
+#include <chrono>
 #include <deque>
 #include <list>
 #include <map>
@@ -54,6 +55,27 @@
 
 enum _driver_levels { VSCP_DRIVER_LEVEL1 = 1, VSCP_DRIVER_LEVEL2 };
 
+// Driver startup stages. Stages up to and including
+// VSCP_DRIVER_STARTUP_CONNECT are timed.
+enum _driver_startup_stages {
+  VSCP_DRIVER_STARTUP_PENDING = 0, // Waiting for a startup slot
+  VSCP_DRIVER_STARTUP_LOAD,        // Loading library and resolving entry points
+  VSCP_DRIVER_STARTUP_OPEN,        // Opening the driver
+  VSCP_DRIVER_STARTUP_CONNECT,     // Connecting to the MQTT broker
+  VSCP_DRIVER_STARTUP_READY,       // Driver is live
+  VSCP_DRIVER_STARTUP_FAILED       // Driver failed to start
+};
+
+#define VSCP_DRIVER_STARTUP_TIMED_STAGES (VSCP_DRIVER_STARTUP_CONNECT + 1)
+
+// Default number of drivers that are loaded/opened/connected at the same time
+#define VSCP_DRIVER_STARTUP_MAX_PARALLEL 8
+
+// Default timeout for the load, open and connect stages (seconds)
+#define VSCP_DRIVER_STARTUP_TIMEOUT_LOAD    10
+#define VSCP_DRIVER_STARTUP_TIMEOUT_OPEN    30
+#define VSCP_DRIVER_STARTUP_TIMEOUT_CONNECT 30
+
 class CClientItem;
 class cguid;
 class CControlObject;
@@ -190,9 +212,49 @@ public:
   */
   bool bJsonMeasurementAdd;
 
+  // ------------------------------------------------------------------------
+  //                         In-process event bus
+  //        ("bus" in driver configuration, see CControlObject::m_eventBus)
+  // ------------------------------------------------------------------------
+
+  // Bus subscription id, -1 when not subscribed
+  int m_busId;
+
+  // Receive events from other drivers and the daemon over the bus
+  bool m_bBusSubscribe;
+
+  // Filter for events received over the bus
+  vscpEventFilter m_busFilter;
+
+  // Publish events from the driver on the MQTT broker as well
+  bool m_bBusMqttPublish;
+
   // Handle for dll/dl driver interface
   long m_openHandle;
 
+  // ------------------------------------------------------------------------
+  //                               Startup
+  //        Guarded by CDeviceList::m_mutexStartup when drivers start
+  // ------------------------------------------------------------------------
+
+  // The daemon does not report ready until all required drivers are live
+  bool m_bRequired;
+
+  // Current startup stage (VSCP_DRIVER_STARTUP_xxx)
+  int m_startupStage;
+
+  // True if the driver holds one of the startup slots
+  bool m_bStartupSlot;
+
+  // True if the driver was given up on because a stage timed out
+  bool m_bStartupTimeout;
+
+  // Time the current stage was entered
+  std::chrono::steady_clock::time_point m_startupStageStart;
+
+  // Time spent in each timed stage (milliseconds)
+  uint32_t m_startupStageTime[VSCP_DRIVER_STARTUP_TIMED_STAGES];
+
   // ------------------------------------------------------------------------
   //                             input Queue
   // ------------------------------------------------------------------------
@@ -239,12 +301,16 @@ public:
   LPFNDLL_CANALBLOCKINGRECEIVE m_proc_CanalBlockingReceive;
   LPFNDLL_CANALGETDRIVERINFO m_proc_CanalGetdriverInfo;
 
+  // Generation 3 (optional, NULL if not exported by driver)
+  LPFNDLL_CANALBLOCKINGRECEIVEBATCH m_proc_CanalBlockingReceiveBatch;
+
   // Level II driver methods
   LPFNDLL_VSCPOPEN m_proc_VSCPOpen;
   LPFNDLL_VSCPCLOSE m_proc_VSCPClose;
   LPFNDLL_VSCPWRITE m_proc_VSCPWrite;
   LPFNDLL_VSCPREAD m_proc_VSCPRead;
   LPFNDLL_VSCPGETVERSION m_proc_VSCPGetVersion;
+  LPFNDLL_VSCPREADBATCH m_proc_VSCPReadBatch; // Optional
 
   // ------------------------------------------------------------------------
 };
@@ -318,11 +384,72 @@ public:
   */
   uint16_t getCountDrivers(uint8_t type = 0, bool bOnlyActive = false);
 
+  /*!
+      Set driver startup configuration and mark the start of
+      driver startup. Must be called before any driver is started.
+      @param maxParallel Max number of drivers that load/open/connect
+              at the same time. Zero means no limit.
+      @param timeoutLoad Timeout in seconds for the load stage.
+      @param timeoutOpen Timeout in seconds for the open stage.
+      @param timeoutConnect Timeout in seconds for the connect stage.
+  */
+  void setStartupConfig(uint16_t maxParallel, uint32_t timeoutLoad, uint32_t timeoutOpen, uint32_t timeoutConnect);
+
+  /*!
+      Wait for a startup slot. Called by the device thread before
+      the driver is loaded. Moves the driver to the load stage.
+      @param pItem Pointer to device item
+      @return true when a slot is held, false if the driver was
+              asked to quit while waiting.
+  */
+  bool acquireStartupSlot(CDeviceItem *pItem);
+
+  /*!
+      Move a driver to a new startup stage. The time spent in the
+      previous stage is recorded. The startup slot is released when
+      the driver is ready or has failed.
+      @param pItem Pointer to device item
+      @param stage New stage (VSCP_DRIVER_STARTUP_xxx)
+  */
+  void setStartupStage(CDeviceItem *pItem, int stage);
+
+  /*!
+      Check startup progress of all enabled drivers. Drivers that
+      have been in the load, open or connect stage for longer than
+      the configured timeout are given up on and their startup slot
+      is released. Non blocking, called periodically until all
+      drivers are settled.
+      @param pbRequiredLive Set to true if all required drivers are live.
+      @param pbRequiredFailed Set to true if a required driver failed
+              or timed out.
+      @return true if all drivers are settled (live, failed or timed out).
+  */
+  bool checkStartup(bool *pbRequiredLive, bool *pbRequiredFailed);
+
+  /*!
+      Log startup timing for all enabled drivers, slowest first.
+  */
+  void logStartupReport(void);
+
 public:
   /*!
       List with devices
   */
   std::deque<CDeviceItem *> m_devItemList;
+
+private:
+  // Protects the startup fields of the device items
+  pthread_mutex_t m_mutexStartup;
+
+  // Startup slots, bounds the number of drivers starting at once
+  sem_t m_semStartupSlots;
+  uint16_t m_startupMaxParallel;
+
+  // Timeouts for the timed startup stages (milliseconds)
+  uint32_t m_startupTimeout[VSCP_DRIVER_STARTUP_TIMED_STAGES];
+
+  // Time when the first driver was started
+  std::chrono::steady_clock::time_point m_startupBegin;
 };
 
 #endif // !defined(_DEVICELIST_H__0ED35EA7_E9E1_41CD_8A98_5EB3369B3194__INCLUDED_)
@@ -0,0 +1,433 @@
+// devicepipe.cpp
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifdef WIN32
+#include <pch.h>
+#endif
+
+#include <string.h>
+
+#include "devicepipe.h"
+
+#include <devicelist.h>
+#include <vscp-metrics.h>
+#include <vscphelper.h>
+
+#include <spdlog/spdlog.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// CDevicePipe
+//
+
+CDevicePipe::CDevicePipe(const std::string &name, std::function<bool(vscpEvent *pev)> publish, uint16_t nSlots)
+{
+  m_name        = name;
+  m_publish     = publish;
+  m_bRunning    = false;
+  m_bQuit       = false;
+  m_cntPublish  = 0;
+  m_cntError    = 0;
+
+  if (0 == nSlots) {
+    nSlots = 1;
+  }
+
+  m_slots.resize(nSlots);
+  m_slotData.resize((size_t) nSlots * VSCP_MAX_DATA);
+  m_batch.reserve(nSlots);
+
+  for (uint16_t i = 0; i < nSlots; i++) {
+    memset(&m_slots[i], 0, sizeof(vscpEvent));
+    m_slots[i].pdata = &m_slotData[(size_t) i * VSCP_MAX_DATA];
+    m_freeList.push_back(&m_slots[i]);
+  }
+
+  pthread_mutex_init(&m_mutex, NULL);
+  pthread_cond_init(&m_condReady, NULL);
+  pthread_cond_init(&m_condFree, NULL);
+}
+
+CDevicePipe::~CDevicePipe()
+{
+  stop();
+
+  pthread_cond_destroy(&m_condFree);
+  pthread_cond_destroy(&m_condReady);
+  pthread_mutex_destroy(&m_mutex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// start
+//
+
+bool
+CDevicePipe::start(void)
+{
+  if (m_bRunning) {
+    return true;
+  }
+
+  m_bQuit = false;
+  if (pthread_create(&m_publishThread, NULL, publishThread, this)) {
+    spdlog::error("{}: Unable to start publisher thread.", m_name);
+    return false;
+  }
+
+  m_bRunning = true;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// stop
+//
+
+void
+CDevicePipe::stop(void)
+{
+  if (!m_bRunning) {
+    return;
+  }
+
+  flush();
+
+  pthread_mutex_lock(&m_mutex);
+  m_bQuit = true;
+  pthread_cond_broadcast(&m_condReady);
+  pthread_cond_broadcast(&m_condFree);
+  pthread_mutex_unlock(&m_mutex);
+
+  pthread_join(m_publishThread, NULL);
+  m_bRunning = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getSlotBuffer
+//
+
+uint8_t *
+CDevicePipe::getSlotBuffer(vscpEvent *pev)
+{
+  size_t idx = (size_t) (pev - &m_slots[0]);
+  return &m_slotData[idx * VSCP_MAX_DATA];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// acquire
+//
+
+vscpEvent *
+CDevicePipe::acquire(void)
+{
+  vscpEvent *pev = nullptr;
+
+  pthread_mutex_lock(&m_mutex);
+
+  if (m_freeList.empty() && !m_batch.empty()) {
+    // Our own unflushed batch may be holding the last slots
+    for (std::vector<vscpEvent *>::iterator it = m_batch.begin(); it != m_batch.end(); ++it) {
+      m_readyList.push_back(*it);
+    }
+    m_batch.clear();
+    pthread_cond_signal(&m_condReady);
+  }
+
+  while (m_freeList.empty() && !m_bQuit) {
+    pthread_cond_wait(&m_condFree, &m_mutex);
+  }
+
+  if (!m_freeList.empty()) {
+    pev = m_freeList.front();
+    m_freeList.pop_front();
+  }
+
+  pthread_mutex_unlock(&m_mutex);
+
+  if (nullptr != pev) {
+    memset(pev, 0, sizeof(vscpEvent));
+    pev->pdata = getSlotBuffer(pev);
+  }
+
+  return pev;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// release
+//
+
+void
+CDevicePipe::release(vscpEvent *pev)
+{
+  if (nullptr == pev) {
+    return;
+  }
+
+  pthread_mutex_lock(&m_mutex);
+  m_freeList.push_back(pev);
+  pthread_cond_signal(&m_condFree);
+  pthread_mutex_unlock(&m_mutex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// commit
+//
+
+void
+CDevicePipe::commit(vscpEvent *pev)
+{
+  if (nullptr == pev) {
+    return;
+  }
+
+  m_batch.push_back(pev);
+  VSCP_METRIC_COUNT("vscpd_driver_read_total", "Events read from drivers");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// flush
+//
+
+void
+CDevicePipe::flush(void)
+{
+  if (m_batch.empty()) {
+    return;
+  }
+
+  pthread_mutex_lock(&m_mutex);
+  for (std::vector<vscpEvent *>::iterator it = m_batch.begin(); it != m_batch.end(); ++it) {
+    m_readyList.push_back(*it);
+  }
+  pthread_cond_signal(&m_condReady);
+  pthread_mutex_unlock(&m_mutex);
+
+  m_batch.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getPublishCount
+//
+
+uint64_t
+CDevicePipe::getPublishCount(void)
+{
+  uint64_t cnt;
+
+  pthread_mutex_lock(&m_mutex);
+  cnt = m_cntPublish;
+  pthread_mutex_unlock(&m_mutex);
+
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// getErrorCount
+//
+
+uint64_t
+CDevicePipe::getErrorCount(void)
+{
+  uint64_t cnt;
+
+  pthread_mutex_lock(&m_mutex);
+  cnt = m_cntError;
+  pthread_mutex_unlock(&m_mutex);
+
+  return cnt;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// publishThread
+//
+// Take everything that is ready in one go, publish it without holding
+// the lock and give the slots back.
+//
+
+void *
+CDevicePipe::publishThread(void *pData)
+{
+  CDevicePipe *pPipe = (CDevicePipe *) pData;
+  std::deque<vscpEvent *> work;
+
+  while (true) {
+
+    pthread_mutex_lock(&pPipe->m_mutex);
+    while (pPipe->m_readyList.empty() && !pPipe->m_bQuit) {
+      pthread_cond_wait(&pPipe->m_condReady, &pPipe->m_mutex);
+    }
+
+    if (pPipe->m_readyList.empty()) {
+      // Quit and nothing left to publish
+      pthread_mutex_unlock(&pPipe->m_mutex);
+      break;
+    }
+
+    work.swap(pPipe->m_readyList);
+    pthread_mutex_unlock(&pPipe->m_mutex);
+
+    uint64_t nPublish = 0;
+    uint64_t nError   = 0;
+    for (std::deque<vscpEvent *>::iterator it = work.begin(); it != work.end(); ++it) {
+      VSCP_METRIC_TIMER("vscpd_driver_publish_ns", "Time to publish an event read from a driver");
+      if (pPipe->m_publish(*it)) {
+        nPublish++;
+      }
+      else {
+        nError++;
+        spdlog::error("Driver: {} Failed to send event to broker.", pPipe->m_name);
+      }
+    }
+
+    pthread_mutex_lock(&pPipe->m_mutex);
+    for (std::deque<vscpEvent *>::iterator it = work.begin(); it != work.end(); ++it) {
+      pPipe->m_freeList.push_back(*it);
+    }
+    pPipe->m_cntPublish += nPublish;
+    pPipe->m_cntError += nError;
+    pthread_cond_broadcast(&pPipe->m_condFree);
+    pthread_mutex_unlock(&pPipe->m_mutex);
+
+    work.clear();
+  }
+
+  return NULL;
+}
+
+// ----------------------------------------------------------------------------
+
+///////////////////////////////////////////////////////////////////////////////
+// translateMeasurement
+//
+// The measurement helpers replace pdata with a heap buffer so they are run
+// on a scratch copy and the result is copied back into the slot.
+//
+
+static void
+translateMeasurement(vscpEvent *pev, bool (*translate)(vscpEvent *))
+{
+  if (!vscp_isMeasurement(pev)) {
+    return;
+  }
+
+  vscpEvent ev = *pev;
+  ev.pdata     = new uint8_t[pev->sizeData];
+  memcpy(ev.pdata, pev->pdata, pev->sizeData);
+
+  if (translate(&ev) && (ev.sizeData <= VSCP_MAX_DATA)) {
+    uint8_t *pbuf = pev->pdata;
+    *pev          = ev;
+    pev->pdata    = pbuf;
+    memcpy(pev->pdata, ev.pdata, ev.sizeData);
+  }
+
+  delete[] ev.pdata;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// level1ToSlot
+//
+// Convert a CANAL message into a pipe slot and run the outgoing
+// translations in place.
+//
+
+bool
+level1ToSlot(vscpEvent *pev, const canalMsg *pmsg, const uint8_t *pguid, uint32_t translation, bool bZeroNicknameMsb)
+{
+  if (pmsg->sizeData > 8) {
+    return false;
+  }
+
+  // Convert the header only (so no data buffer is allocated) and copy
+  // the data into the slot buffer
+  uint8_t *pbuf = pev->pdata;
+  canalMsg hdr  = *pmsg;
+  hdr.sizeData  = 0;
+  if (!vscp_convertCanalToEvent(pev, &hdr, (unsigned char *) pguid)) {
+    pev->pdata = pbuf;
+    return false;
+  }
+
+  pev->pdata    = pbuf;
+  pev->sizeData = pmsg->sizeData;
+  memcpy(pev->pdata, pmsg->data, pmsg->sizeData);
+
+  pev->obid = 0;
+  if (bZeroNicknameMsb) {
+    pev->GUID[14] = 0; // Make sure MSB of nickname is zero for Level I driver
+  }
+
+  // =========================================================
+  //                   Outgoing translations
+  // =========================================================
+
+  // Level I measurement events to Level II measurement float
+  if (translation & VSCP_DRIVER_OUT_TR_M1_M2F) {
+    translateMeasurement(pev, vscp_convertLevel1MeasurementToLevel2Double);
+  }
+
+  // Level I measurement events to Level II measurement string
+  if (translation & VSCP_DRIVER_OUT_TR_M1_M2S) {
+    translateMeasurement(pev, vscp_convertLevel1MeasurementToLevel2String);
+  }
+
+  // Level I events to Level I over Level II events
+  if ((translation & VSCP_DRIVER_OUT_TR_ALL_L2) && (pev->sizeData + 16 <= VSCP_MAX_DATA)) {
+    pev->vscp_class += 512;
+    memmove(pev->pdata + 16, pev->pdata, pev->sizeData);
+    memset(pev->pdata, 0, 16);
+    pev->sizeData += 16;
+  }
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// level2ToSlot
+//
+
+bool
+level2ToSlot(vscpEvent *pev, const vscpEvent *pdrv)
+{
+  if (pdrv->sizeData > VSCP_MAX_DATA) {
+    return false;
+  }
+
+  uint8_t *pbuf = pev->pdata;
+  *pev          = *pdrv;
+  pev->pdata    = pbuf;
+  if (pdrv->sizeData && (nullptr != pdrv->pdata)) {
+    memcpy(pev->pdata, pdrv->pdata, pdrv->sizeData);
+  }
+
+  // If timestamp is zero we set it here
+  if (0 == pev->timestamp) {
+    pev->timestamp = vscp_makeTimeStamp();
+  }
+
+  return true;
+}
+
@@ -0,0 +1,186 @@
+// devicepipe.h
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#if !defined(DEVICEPIPE_H__INCLUDED_)
+#define DEVICEPIPE_H__INCLUDED_
+
+#include <pthread.h>
+
+#include <canal.h>
+#include <vscp.h>
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Number of preallocated event slots between a driver and the broker
+#define DEVICE_PIPE_SLOTS 256
+
+// Max number of events fetched from a driver in one go
+#define DEVICE_PIPE_BATCH 32
+
+// Idle back-off for non blocking drivers (microseconds)
+#define DEVICE_IDLE_MIN_US 500
+#define DEVICE_IDLE_MAX_US 20000
+
+///////////////////////////////////////////////////////////////////////////////
+// CDevicePipe
+//
+// Receive -> translate -> publish pipeline for one driver. The device thread
+// fills preallocated event slots (pdata points into a fixed VSCP_MAX_DATA
+// buffer owned by the slot) and hands them over in batches to a publisher
+// thread that sends them to the broker. A slow broker therefore never stalls
+// the driver read loop until all slots are in use.
+//
+
+class CDevicePipe {
+
+public:
+  /*!
+    @param name Name of the driver, used in log messages
+    @param publish Called by the publisher thread for each event. Returns
+      false if the event could not be sent.
+    @param nSlots Number of preallocated event slots
+  */
+  CDevicePipe(const std::string &name,
+              std::function<bool(vscpEvent *pev)> publish,
+              uint16_t nSlots = DEVICE_PIPE_SLOTS);
+  ~CDevicePipe();
+
+  /*!
+    Start the publisher thread
+    @return true on success, false on failure
+  */
+  bool start(void);
+
+  /*!
+    Publish everything that is queued and stop the publisher thread
+  */
+  void stop(void);
+
+  /*!
+    Get a free event slot. The event header is cleared and pdata points
+    to a buffer that can hold VSCP_MAX_DATA bytes. Events committed but
+    not yet flushed are flushed if no slot is free, then the call blocks
+    until the publisher returns one.
+    @return Pointer to event slot or nullptr if the pipe is stopping.
+  */
+  vscpEvent *acquire(void);
+
+  /*!
+    Return a slot that was acquired but should not be published
+    @param pev Slot returned by acquire
+  */
+  void release(vscpEvent *pev);
+
+  /*!
+    Add a filled in slot to the current batch. The batch is handed
+    to the publisher on flush.
+    @param pev Slot returned by acquire
+  */
+  void commit(vscpEvent *pev);
+
+  /*!
+    Hand the current batch over to the publisher
+  */
+  void flush(void);
+
+  /*!
+    Number of slots committed since the last flush
+  */
+  size_t getBatchSize(void) { return m_batch.size(); };
+
+  /*!
+    Number of events successfully sent to the broker
+  */
+  uint64_t getPublishCount(void);
+
+  /*!
+    Number of events the broker refused
+  */
+  uint64_t getErrorCount(void);
+
+private:
+  // Publisher worker
+  static void *publishThread(void *pData);
+
+  // Slot buffer for event
+  uint8_t *getSlotBuffer(vscpEvent *pev);
+
+private:
+  std::string m_name;
+  std::function<bool(vscpEvent *pev)> m_publish;
+
+  // Event slots and their data buffers
+  std::vector<vscpEvent> m_slots;
+  std::vector<uint8_t> m_slotData;
+
+  // Slots owned by the device thread not yet flushed
+  std::vector<vscpEvent *> m_batch;
+
+  // Free slots and slots waiting to be published
+  std::deque<vscpEvent *> m_freeList;
+  std::deque<vscpEvent *> m_readyList;
+
+  pthread_mutex_t m_mutex;
+  pthread_cond_t m_condReady;
+  pthread_cond_t m_condFree;
+
+  pthread_t m_publishThread;
+  bool m_bRunning;
+  bool m_bQuit;
+
+  uint64_t m_cntPublish;
+  uint64_t m_cntError;
+};
+
+/*!
+  Convert a CANAL message from a Level I driver into a pipe slot and run
+  the outgoing translations in place.
+  @param pev Slot returned by CDevicePipe::acquire
+  @param pmsg CANAL message from the driver
+  @param pguid GUID of the driver
+  @param translation Outgoing translation bits (VSCP_DRIVER_OUT_TR_*)
+  @param bZeroNicknameMsb Set to clear GUID[14], the MSB of the nickname
+  @return true on success, false if the message could not be converted
+*/
+bool
+level1ToSlot(vscpEvent *pev, const canalMsg *pmsg, const uint8_t *pguid, uint32_t translation, bool bZeroNicknameMsb);
+
+/*!
+  Copy an event from a Level II driver into a pipe slot. The data of the
+  driver event is copied, it is not taken over.
+  @param pev Slot returned by CDevicePipe::acquire
+  @param pdrv Event from the driver
+  @return true on success, false if the event data does not fit a slot
+*/
+bool
+level2ToSlot(vscpEvent *pev, const vscpEvent *pdrv);
+
+#endif
@@ -57,8 +57,11 @@
 #include <level2drvdef.h>
 #include <vscp.h>
 #include <vscp-debug.h>
+#include <vscp-metrics.h>
 #include <vscphelper.h>
 
+#include <algorithm>
+
 #include <mustache.hpp>
 using namespace kainjow::mustache;
 
@@ -75,22 +78,16 @@ extern uint64_t gDebugLevel;
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
-// receive_event_callback
+// writeEventToDriver
 //
-// Event received from MQTT client
+// Event received from MQTT client or the event bus
 //
 
 static void
-receive_event_callback(vscpEvent &ev, void *pobj)
+writeEventToDriver(CDeviceItem *pDeviceItem, const vscpEvent &ev)
 {
   int rv;
-
-  // Check pointers
-  if (nullptr == pobj) {
-    return;
-  }
-
-  CDeviceItem *pDeviceItem = (CDeviceItem *) pobj;
+  VSCP_METRIC_TIMER("vscpd_driver_write_ns", "Time to write an event to a driver");
 
   spdlog::trace("VSCP Event received. class={0} type={1}", ev.vscp_class, ev.vscp_type);
 
@@ -99,18 +96,19 @@ receive_event_callback(vscpEvent &ev, void *pobj)
     canalMsg msg;
     vscp_convertEventToCanal(&msg, &ev);
 
-    // Use blocking method if available
+    // Events arrive one at a time so there is nothing to batch.
+    // Use the blocking method if available
     if (nullptr != pDeviceItem->m_proc_CanalBlockingSend) {
-      if (CANAL_ERROR_SUCCESS == (rv = pDeviceItem->m_proc_CanalBlockingSend(pDeviceItem->m_openHandle, &msg, 300))) {
+      if (CANAL_ERROR_SUCCESS != (rv = pDeviceItem->m_proc_CanalBlockingSend(pDeviceItem->m_openHandle, &msg, 300))) {
         spdlog::error(
-          "driver: {}: mqtt_on_message - Failed to send event (m_proc_CanalBlockingSend) rv={1}",
+          "driver: {}: mqtt_on_message - Failed to send event (m_proc_CanalBlockingSend) rv={}",
           pDeviceItem->m_strName.c_str(),
           rv);
       }
     }
     else {
       if (CANAL_ERROR_SUCCESS != (rv = pDeviceItem->m_proc_CanalSend(pDeviceItem->m_openHandle, &msg))) {
-        spdlog::error("driver: {}: mqtt_on_message - Failed to send event (m_proc_CanalSend) rv={1}",
+        spdlog::error("driver: {}: mqtt_on_message - Failed to send event (m_proc_CanalSend) rv={}",
                                      pDeviceItem->m_strName.c_str(),
                                      rv);
       }
@@ -126,6 +124,64 @@ receive_event_callback(vscpEvent &ev, void *pobj)
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+// receive_event_callback
+//
+// Event received from MQTT client
+//
+
+static void
+receive_event_callback(vscpEvent &ev, void *pobj)
+{
+  // Check pointers
+  if (nullptr == pobj) {
+    return;
+  }
+
+  writeEventToDriver((CDeviceItem *) pobj, ev);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+// busSubscribe
+//
+// Let the driver receive events from other drivers and the daemon
+// over the in-process bus
+//
+
+static void
+busSubscribe(CDeviceItem *pDeviceItem)
+{
+  if (!pDeviceItem->m_bBusSubscribe) {
+    return;
+  }
+
+  pDeviceItem->m_busId =
+    pDeviceItem->m_pCtrlObj->m_eventBus.subscribe(pDeviceItem->m_strName,
+                                                  &pDeviceItem->m_busFilter,
+                                                  [pDeviceItem](const vscpEvent &ev) {
+                                                    writeEventToDriver(pDeviceItem, ev);
+                                                  });
+  if (-1 == pDeviceItem->m_busId) {
+    spdlog::error("{}: Failed to subscribe to event bus.", pDeviceItem->m_strName);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+// busUnsubscribe
+//
+// Must be called before the driver is closed
+//
+
+static void
+busUnsubscribe(CDeviceItem *pDeviceItem)
+{
+  if (-1 != pDeviceItem->m_busId) {
+    pDeviceItem->m_pCtrlObj->m_eventBus.unsubscribe(pDeviceItem->m_busId);
+    pDeviceItem->m_busId = -1;
+  }
+}
+
+
 
 
 // ----------------------------------------------------------------------------
@@ -148,6 +204,29 @@ usleep(__int64 usec)
 }
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// CDriverStartupGuard
+//
+// Marks the driver as failed if the device thread ends before the driver
+// is live, so the startup slot is released on every error path.
+//
+
+class CDriverStartupGuard {
+
+public:
+  CDriverStartupGuard(CDeviceItem *pDeviceItem) { m_pDeviceItem = pDeviceItem; }
+  ~CDriverStartupGuard()
+  {
+    // Only this thread moves the driver between stages
+    if (m_pDeviceItem->m_startupStage < VSCP_DRIVER_STARTUP_READY) {
+      m_pDeviceItem->m_pCtrlObj->m_deviceList.setStartupStage(m_pDeviceItem, VSCP_DRIVER_STARTUP_FAILED);
+    }
+  }
+
+private:
+  CDeviceItem *m_pDeviceItem;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // deviceThread
 //
@@ -166,6 +245,14 @@ deviceThread(void *pData)
     return NULL;
   }
 
+  CDeviceList *pDeviceList = &pDeviceItem->m_pCtrlObj->m_deviceList;
+  CDriverStartupGuard startupGuard(pDeviceItem);
+
+  // Wait for our turn to start
+  if (!pDeviceList->acquireStartupSlot(pDeviceItem)) {
+    return NULL;
+  }
+
   void *hdll;
 
   // Load dynamic library
@@ -356,7 +443,27 @@ deviceThread(void *pData)
       pDeviceItem->m_proc_CanalGetdriverInfo = NULL;
     }
 
+    // ******************************
+    //     Generation 3 Methods
+    // ******************************
+
+    // Optional, the single message calls are used if not exported
+
+    // * * * * CANAL BLOCKING RECEIVE BATCH * * * *
+    pDeviceItem->m_proc_CanalBlockingReceiveBatch =
+      (LPFNDLL_CANALBLOCKINGRECEIVEBATCH) dlsym(hdll, "CanalBlockingReceiveBatch");
+    if (dlerror()) {
+      pDeviceItem->m_proc_CanalBlockingReceiveBatch = NULL;
+    }
+
+    if (gDebugLevel & VSCP_DEBUG_DRIVERL1) {
+      spdlog::debug("{}: Bulk receive {}.",
+                    pDeviceItem->m_strName,
+                    (NULL != pDeviceItem->m_proc_CanalBlockingReceiveBatch) ? "yes" : "no");
+    }
+
     // Open the device
+    pDeviceList->setStartupStage(pDeviceItem, VSCP_DRIVER_STARTUP_OPEN);
     pDeviceItem->m_openHandle =
       pDeviceItem->m_proc_CanalOpen((const char *) pDeviceItem->m_strParameter.c_str(), pDeviceItem->m_DeviceFlags);
 
@@ -398,13 +505,13 @@ deviceThread(void *pData)
                                             (VSCP_DRIVER_LEVEL1 == pDeviceItem->m_driverLevel) ? "level1" : "level2");
 
     // Add class/type tokens
-    pDeviceItem->m_mqttClient.setTokenMaps(&pDeviceItem->m_pCtrlObj->m_map_class_id2Token,
-                                           &pDeviceItem->m_pCtrlObj->m_map_type_id2Token);
+    pDeviceItem->m_mqttClient.setTokenTable(&pDeviceItem->m_pCtrlObj->m_tokenTable);
 
     // Set event callback - level I
     pDeviceItem->m_mqttClient.setCallbackEv(receive_event_callback, pDeviceItem);
 
     // Connect to server
+    pDeviceList->setStartupStage(pDeviceItem, VSCP_DRIVER_STARTUP_CONNECT);
     if (VSCP_ERROR_SUCCESS != pDeviceItem->m_mqttClient.connect()) {
       spdlog::error("Failed to connect to MQTT client level I driver.");
       dlclose(hdll);
@@ -413,15 +520,73 @@ deviceThread(void *pData)
 
     // -------------------------------------------------------------
 
-    bool bActivity;
-
     // Get Driver Level
     pDeviceItem->m_driverLevel = (uint8_t) pDeviceItem->m_proc_CanalGetLevel(pDeviceItem->m_openHandle);
 
+    // Receive -> translate -> publish
+    CDevicePipe pipe(pDeviceItem->m_strName, [pDeviceItem](vscpEvent *pev) { return pDeviceItem->sendEvent(pev); });
+    if (!pipe.start()) {
+      pDeviceItem->m_proc_CanalClose(pDeviceItem->m_openHandle);
+      pDeviceItem->m_mqttClient.disconnect();
+      dlclose(hdll);
+      return NULL;
+    }
+
+    busSubscribe(pDeviceItem);
+
+    pDeviceList->setStartupStage(pDeviceItem, VSCP_DRIVER_STARTUP_READY);
+
     //  * * * Level I Driver * * *
 
+    // Check if bulk receive is available
+    if (NULL != pDeviceItem->m_proc_CanalBlockingReceiveBatch) {
+
+      // * * * * Bulk version * * * *
+
+      if (gDebugLevel & VSCP_DEBUG_DRIVERL1) {
+        spdlog::debug("{}: [Device tread] Level I bulk version.", pDeviceItem->m_strName);
+      }
+
+      canalMsg msgs[DEVICE_PIPE_BATCH];
+
+      while (!pDeviceItem->m_bQuit) {
+
+        unsigned int cnt = 0;
+        if (CANAL_ERROR_SUCCESS != pDeviceItem->m_proc_CanalBlockingReceiveBatch(pDeviceItem->m_openHandle,
+                                                                                 msgs,
+                                                                                 DEVICE_PIPE_BATCH,
+                                                                                 &cnt,
+                                                                                 50)) {
+          continue;
+        }
+
+        for (unsigned int i = 0; (i < cnt) && (i < DEVICE_PIPE_BATCH); i++) {
+
+          vscpEvent *pev = pipe.acquire();
+          if (nullptr == pev) {
+            break;
+          }
+
+          if (!level1ToSlot(pev, &msgs[i], pDeviceItem->m_guid.getGUID(), pDeviceItem->m_translation, true)) {
+            spdlog::error("Driver L1: {} Failed to convert CANAL to event.", pDeviceItem->m_strName);
+            pipe.release(pev);
+            continue;
+          }
+
+          pipe.commit(pev);
+        }
+
+        // Hand the batch over to the publisher
+        pipe.flush();
+
+      } // while
+
+      if (gDebugLevel & VSCP_DEBUG_DRIVERL1) {
+        spdlog::info("{}: [Device tread] Level I work loop ended.", pDeviceItem->m_strName);
+      }
+    }
     // Check if blocking driver is available
-    if (NULL != pDeviceItem->m_proc_CanalBlockingReceive) {
+    else if (NULL != pDeviceItem->m_proc_CanalBlockingReceive) {
 
       // * * * * Blocking version * * * *
 
@@ -437,58 +602,35 @@ deviceThread(void *pData)
       while (!pDeviceItem->m_bQuit) {
 
         canalMsg msg;
-        vscpEvent ev;
 
         // Get an CANAL event - blocking
-        if (CANAL_ERROR_SUCCESS == pDeviceItem->m_proc_CanalBlockingReceive(pDeviceItem->m_openHandle, &msg, 50)) {
-
-          // Publish to MQTT broker
-
-          memset(&ev, 0, sizeof(vscpEvent));
+        if (CANAL_ERROR_SUCCESS != pDeviceItem->m_proc_CanalBlockingReceive(pDeviceItem->m_openHandle, &msg, 50)) {
+          continue;
+        }
 
-          // Set driver GUID
-          pDeviceItem->m_guid.writeGUID(ev.GUID);
+        // Take the first message and whatever else the driver has queued
+        do {
 
-          // Convert CANAL message to VSCP event
-          if (!vscp_convertCanalToEvent(&ev, &msg, (unsigned char *) pDeviceItem->m_guid.getGUID())) {
-            spdlog::error("Driver L1: {} Failed to convert CANAL to event.", pDeviceItem->m_strName);
+          vscpEvent *pev = pipe.acquire();
+          if (nullptr == pev) {
             break;
           }
-          ev.obid     = 0;
-          ev.GUID[14] = 0; // Make sure MSB of nickname is zero for Level I driver
-
-          // =========================================================
-          //                   Outgoing translations
-          // =========================================================
 
-          // Level I measurement events to Level II measurement float
-          if (pDeviceItem->m_translation & VSCP_DRIVER_OUT_TR_M1_M2F) {
-            vscp_convertLevel1MeasurementToLevel2Double(&ev);
+          if (!level1ToSlot(pev, &msg, pDeviceItem->m_guid.getGUID(), pDeviceItem->m_translation, true)) {
+            spdlog::error("Driver L1: {} Failed to convert CANAL to event.", pDeviceItem->m_strName);
+            pipe.release(pev);
+            continue;
           }
 
-          // Level I measurement events to Level II measurement string
-          if (pDeviceItem->m_translation & VSCP_DRIVER_OUT_TR_M1_M2S) {
-            vscp_convertLevel1MeasurementToLevel2String(&ev);
-          }
+          pipe.commit(pev);
 
-          // Level I events to Level I over Level II events
-          if (pDeviceItem->m_translation & VSCP_DRIVER_OUT_TR_ALL_L2) {
-            ev.vscp_class += 512;
-            uint8_t *p = new uint8_t[16 + ev.sizeData];
-            if (NULL != p) {
-              memset(p, 0, 16 + ev.sizeData);
-              memcpy(p + 16, ev.pdata, ev.sizeData);
-              ev.sizeData += 16;
-              delete[] ev.pdata;
-              ev.pdata = p;
-            }
-          }
+        } while ((pipe.getBatchSize() < DEVICE_PIPE_BATCH) &&
+                 pDeviceItem->m_proc_CanalDataAvailable(pDeviceItem->m_openHandle) &&
+                 (CANAL_ERROR_SUCCESS == pDeviceItem->m_proc_CanalReceive(pDeviceItem->m_openHandle, &msg)));
+
+        // Hand the batch over to the publisher
+        pipe.flush();
 
-          if (!pDeviceItem->sendEvent(&ev)) {
-            spdlog::error("Driver L1: {} Failed to send event to broker.", pDeviceItem->m_strName);
-            continue;
-          }
-        }
       } // while
 
       // Signal worker threads to quit
@@ -506,91 +648,51 @@ deviceThread(void *pData)
         spdlog::info("{}: [Device tread] Level I NON Blocking version.", pDeviceItem->m_strName);
       }
 
-      while (!pDeviceItem->m_bQuit) {
+      // Idle wait grows while the bus is quiet and is reset by traffic
+      uint32_t idleWait = DEVICE_IDLE_MIN_US;
 
-        bActivity = false;
+      while (!pDeviceItem->m_bQuit) {
 
         /////////////////////////////////////////////////////////////////////////////
         //                           Receive from device
         /////////////////////////////////////////////////////////////////////////////
         canalMsg msg;
-        if (pDeviceItem->m_proc_CanalDataAvailable(pDeviceItem->m_openHandle)) {
-
-          if (CANAL_ERROR_SUCCESS == pDeviceItem->m_proc_CanalReceive(pDeviceItem->m_openHandle, &msg)) {
-
-            bActivity = true;
-
-            // Publish to MQTT broker
-
-            vscpEvent *pev = new vscpEvent;
-            if (NULL != pev) {
-
-              memset(pev, 0, sizeof(vscpEvent));
-
-              // Convert CANAL message to VSCP event
-              if (!vscp_convertCanalToEvent(pev, &msg, (unsigned char *) pDeviceItem->m_guid.getGUID())) {
-                spdlog::error("Driver L1: {} Failed to convet CANAL to event.", pDeviceItem->m_strName);
-                break;
-              }
-              pev->obid = 0;
-              // pev->GUID[14] = 0;   // Make sure high byte of nickname is zero for Level I driver
-
-              // =========================================================
-              //                   Outgoing translations
-              // =========================================================
-
-              // Level I measurement events to Level II measurement float
-              if (pDeviceItem->m_translation & VSCP_DRIVER_OUT_TR_M1_M2F) {
-                vscp_convertLevel1MeasurementToLevel2Double(pev);
-              }
-
-              // Level I measurement events to Level II measurement string
-              if (pDeviceItem->m_translation & VSCP_DRIVER_OUT_TR_M1_M2S) {
-                vscp_convertLevel1MeasurementToLevel2String(pev);
-              }
-
-              // Level I events to Level I over Level II events
-              if (pDeviceItem->m_translation & VSCP_DRIVER_OUT_TR_ALL_L2) {
-                pev->vscp_class += 512;
-                uint8_t *p = new uint8_t[16 + pev->sizeData];
-                if (NULL != p) {
-                  memset(p, 0, 16 + pev->sizeData);
-                  memcpy(p + 16, pev->pdata, pev->sizeData);
-                  pev->sizeData += 16;
-                  delete[] pev->pdata;
-                  pev->pdata = p;
-                }
-              }
-
-              if (!pDeviceItem->sendEvent(pev)) {
-                spdlog::error("Driver L1: {} Failed to send event to broker.", pDeviceItem->m_strName);
-                if (nullptr == pev) {
-                  vscp_deleteEvent_v2(&pev);
-                }
-                continue;
-              }
-
-              if (nullptr == pev) {
-                vscp_deleteEvent_v2(&pev);
-              }
-            }
-            else {
-              spdlog::error("Driver L1: {} Memory problem.\n", pDeviceItem->m_strName);
-              break;
-            }
+        while ((pipe.getBatchSize() < DEVICE_PIPE_BATCH) &&
+               pDeviceItem->m_proc_CanalDataAvailable(pDeviceItem->m_openHandle) &&
+               (CANAL_ERROR_SUCCESS == pDeviceItem->m_proc_CanalReceive(pDeviceItem->m_openHandle, &msg))) {
+
+          vscpEvent *pev = pipe.acquire();
+          if (nullptr == pev) {
+            break;
           }
+
+          // The non blocking loop has always left the nickname MSB as is
+          if (!level1ToSlot(pev, &msg, pDeviceItem->m_guid.getGUID(), pDeviceItem->m_translation, false)) {
+            spdlog::error("Driver L1: {} Failed to convert CANAL to event.", pDeviceItem->m_strName);
+            pipe.release(pev);
+            continue;
+          }
+
+          pipe.commit(pev);
         } // data available
 
-        if (!bActivity) {
-          usleep(100000); // 100 ms
+        if (pipe.getBatchSize()) {
+          pipe.flush();
+          idleWait = DEVICE_IDLE_MIN_US;
+        }
+        else {
+          usleep(idleWait);
+          idleWait = std::min<uint32_t>(2 * idleWait, DEVICE_IDLE_MAX_US);
         }
-
-        bActivity = false;
 
       } // while working - non blocking
 
     } // if blocking/non blocking
 
+    // Publish what is left
+    pipe.stop();
+    busUnsubscribe(pDeviceItem);
+
     if (gDebugLevel & VSCP_DEBUG_DRIVERL1) {
       spdlog::info("{}: [Device tread] Level I Work loop ended.", pDeviceItem->m_strName);
     }
@@ -651,8 +753,18 @@ deviceThread(void *pData)
       return NULL;
     }
 
+    // * * * * VSCP READ BATCH * * * *
+    // Optional, VSCPRead is used if not exported
+    dlerror();
+    pDeviceItem->m_proc_VSCPReadBatch = (LPFNDLL_VSCPREADBATCH) dlsym(hdll, "VSCPReadBatch");
+    if (dlerror()) {
+      pDeviceItem->m_proc_VSCPReadBatch = nullptr;
+    }
+
     if (gDebugLevel & VSCP_DEBUG_DRIVERL2) {
-      spdlog::debug("{}: Discovered all methods\n", pDeviceItem->m_strName);
+      spdlog::debug("{}: Discovered all methods (bulk read {})\n",
+                    pDeviceItem->m_strName,
+                    (nullptr != pDeviceItem->m_proc_VSCPReadBatch) ? "yes" : "no");
     }
 
     //--------------------------------------------------------------
@@ -680,14 +792,14 @@ deviceThread(void *pData)
                                             (VSCP_DRIVER_LEVEL1 == pDeviceItem->m_driverLevel) ? "level1" : "level2");
 
     // Add class/type tokens
-    pDeviceItem->m_mqttClient.setTokenMaps(&pDeviceItem->m_pCtrlObj->m_map_class_id2Token,
-                                           &pDeviceItem->m_pCtrlObj->m_map_type_id2Token);
+    pDeviceItem->m_mqttClient.setTokenTable(&pDeviceItem->m_pCtrlObj->m_tokenTable);
 
     // Set event callback - level II
     void *pParent = (void *) pDeviceItem;
     pDeviceItem->m_mqttClient.setCallbackEv(receive_event_callback, pParent);
 
     // Connect to server
+    pDeviceList->setStartupStage(pDeviceItem, VSCP_DRIVER_STARTUP_CONNECT);
     if (VSCP_ERROR_SUCCESS != pDeviceItem->m_mqttClient.connect()) {
       spdlog::error("Failed to connect to MQTT client for level II driver.");
       dlclose(hdll);
@@ -697,6 +809,7 @@ deviceThread(void *pData)
     // -------------------------------------------------------------
 
     // Open up the L2 driver
+    pDeviceList->setStartupStage(pDeviceItem, VSCP_DRIVER_STARTUP_OPEN);
     pDeviceItem->m_openHandle =
       pDeviceItem->m_proc_VSCPOpen(pDeviceItem->m_strParameter.c_str(), pDeviceItem->m_guid.getGUID());
 
@@ -718,29 +831,70 @@ deviceThread(void *pData)
     //        Work loop L2 - receive from device - send to MQTT broker
     // --------------------------------------------------------------------
 
+    // Receive -> publish
+    CDevicePipe pipe(pDeviceItem->m_strName, [pDeviceItem](vscpEvent *pev) { return pDeviceItem->sendEvent(pev); });
+    if (!pipe.start()) {
+      pDeviceItem->m_proc_VSCPClose(pDeviceItem->m_openHandle);
+      pDeviceItem->m_mqttClient.disconnect();
+      dlclose(hdll);
+      return NULL;
+    }
+
+    busSubscribe(pDeviceItem);
+
+    pDeviceList->setStartupStage(pDeviceItem, VSCP_DRIVER_STARTUP_READY);
+
+    // Events are read one at a time unless the driver has VSCPReadBatch
+    vscpEvent evs[DEVICE_PIPE_BATCH];
+
     // Just sit and wait until the end of the world as we know it...
     while (!pDeviceItem->m_bQuit) {
 
-      vscpEvent ev;
-      memset(&ev, 0, sizeof(vscpEvent));
+      unsigned int cnt = 0;
+      memset(evs, 0, sizeof(evs));
 
-      if (CANAL_ERROR_SUCCESS != pDeviceItem->m_proc_VSCPRead(pDeviceItem->m_openHandle, &ev, 50)) {
-        continue;
+      if (nullptr != pDeviceItem->m_proc_VSCPReadBatch) {
+        if (CANAL_ERROR_SUCCESS !=
+            pDeviceItem->m_proc_VSCPReadBatch(pDeviceItem->m_openHandle, evs, DEVICE_PIPE_BATCH, &cnt, 50)) {
+          continue;
+        }
       }
-
-      // If timestamp is zero we set it here
-      if (0 == ev.timestamp) {
-        ev.timestamp = vscp_makeTimeStamp();
+      else {
+        if (CANAL_ERROR_SUCCESS != pDeviceItem->m_proc_VSCPRead(pDeviceItem->m_openHandle, evs, 50)) {
+          continue;
+        }
+        cnt = 1;
       }
 
-      // Publish to MQTT broker
+      for (unsigned int i = 0; (i < cnt) && (i < DEVICE_PIPE_BATCH); i++) {
+
+        vscpEvent *pev = pipe.acquire();
+        if (nullptr == pev) {
+          // Stopping, just free the rest
+        }
+        else if (level2ToSlot(pev, &evs[i])) {
+          pipe.commit(pev);
+        }
+        else {
+          spdlog::error("Driver L2: {} Event data too large ({}).", pDeviceItem->m_strName, evs[i].sizeData);
+          pipe.release(pev);
+        }
 
-      if (!pDeviceItem->sendEvent(&ev)) {
-        spdlog::error("Driver L2: {} Failed to send event to broker.", pDeviceItem->m_strName.c_str());
-        continue;
+        // VSCPReadBatch hands the event data over to us. What VSCPRead
+        // returns is left to the driver as it always has been.
+        if (nullptr != pDeviceItem->m_proc_VSCPReadBatch) {
+          delete[] evs[i].pdata;
+        }
       }
+
+      // Publish to MQTT broker
+      pipe.flush();
     }
 
+    // Publish what is left
+    pipe.stop();
+    busUnsubscribe(pDeviceItem);
+
     if (gDebugLevel & VSCP_DEBUG_DRIVERL2) {
       spdlog::debug("{}: [Device tread] Level II Closing.", pDeviceItem->m_strName);
     }
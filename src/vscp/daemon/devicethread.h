@@ -29,6 +29,8 @@
 #if !defined(DEVICETHREAD_H__7D80016B_5EFD_40D5_94E3_6FD9C324CC7B__INCLUDED_)
 #define DEVICETHREAD_H__7D80016B_5EFD_40D5_94E3_6FD9C324CC7B__INCLUDED_
 
+#include "devicepipe.h"
+
 void *
 deviceThread(void *pData);
 
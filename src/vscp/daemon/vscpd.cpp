@@ -68,6 +68,7 @@
 #include <version.h>
 #include <vscphelper.h>
 
+#include <algorithm>
 #include <deque>
 #include <string>
 
@@ -104,6 +105,7 @@ _sighandlerStop(int sig)
   fprintf(stderr, "vscpd: signal received, forced to stop.\n");
   gpobj->m_bQuit = true;
   gbStopDaemon   = true;
+  gpobj->m_scheduler.wakeup();
 }
 
 void
@@ -112,6 +114,7 @@ _sighandlerRestart(int sig)
   fprintf(stderr, "vscpd: signal received, restart. %s\n", strerror(errno));
   gpobj->m_bQuit = true;
   gbStopDaemon   = false;
+  gpobj->m_scheduler.wakeup();
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -351,9 +354,11 @@ main(int argc, char **argv)
                                                          sinks.begin(),
                                                          sinks.end(),
                                                          spdlog::thread_pool(),
-                                                         spdlog::async_overflow_policy::block);
-    // The separate sub loggers will handle trace levels
-    logger->set_level(spdlog::level::trace);
+                                                         spdlog::async_overflow_policy::overrun_oldest);
+    // Messages no sink wants are rejected in the calling thread before
+    // they are formatted and queued. A full queue drops the oldest
+    // message instead of blocking the caller.
+    logger->set_level(std::min(console_sink->level(), rotating_file_sink->level()));
     spdlog::register_logger(logger);
     spdlog::set_default_logger(logger);
   }
@@ -50,6 +50,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <sys/msg.h>
 #include <sys/socket.h>
@@ -89,6 +90,8 @@
 #include <remotevariablecodes.h>
 #include <version.h>
 #include <vscp.h>
+#include <vscp-metrics.h>
+#include <vscp-syslog.h>
 #include <vscp_debug.h>
 #include <vscpd_caps.h>
 #include <vscpdb.h>
@@ -105,6 +108,30 @@ foo(const int i)
     UNUSED(i);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// metricsHandler
+//
+// Serve runtime metrics on /metrics in Prometheus text format
+//
+
+static int
+metricsHandler(struct mg_connection* conn, void* cbdata)
+{
+    UNUSED(cbdata);
+
+    std::string str = vscpMetrics::getInstance().getAsPrometheus();
+
+    mg_printf(conn,
+              "HTTP/1.1 200 OK\r\n"
+              "Content-Type: text/plain; version=0.0.4\r\n"
+              "Content-Length: %lu\r\n"
+              "Connection: close\r\n\r\n",
+              (unsigned long)str.length());
+    mg_write(conn, str.c_str(), str.length());
+
+    return 200;
+}
+
 #ifndef _CRT_SECURE_NO_WARNINGS
 #define _CRT_SECURE_NO_WARNINGS
 #endif
@@ -139,13 +166,15 @@ CControlObject::CControlObject()
     m_bQuit_clientMsgWorkerThread =
       false; // true for clientWorkerThread termination
 
+    m_evfdSentToAllClients = -1;
+
     if (-1 == sem_init(&m_semClientOutputQueue, 0, 0)) {
         syslog(LOG_ERR, "Unable to init m_semClientOutputQueue");
         return;
     }
 
-    if (-1 == sem_init(&m_semSentToAllClients, 0, 0)) {
-        syslog(LOG_ERR, "Unable to init m_semSentToAllClients");
+    if (-1 == (m_evfdSentToAllClients = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))) {
+        syslog(LOG_ERR, "Unable to init m_evfdSentToAllClients");
         return;
     }
 
@@ -337,8 +366,8 @@ CControlObject::~CControlObject()
         syslog(LOG_ERR, "Unable to destroy m_semClientOutputQueue");
     }
 
-    if (0 != sem_destroy(&m_semSentToAllClients)) {
-        syslog(LOG_ERR, "Unable to destroy m_semSentToAllClients");
+    if ((-1 != m_evfdSentToAllClients) && (0 != close(m_evfdSentToAllClients))) {
+        syslog(LOG_ERR, "Unable to close m_evfdSentToAllClients");
     }
 
     if (0 != pthread_mutex_destroy(&m_mutex_ClientOutputQueue)) {
@@ -528,6 +557,12 @@ CControlObject::init(std::string& strcfgfile, std::string& rootFolder)
     str += VSCPD_COPYRIGHT;
     syslog(LOG_INFO, "%s", str.c_str());
 
+    // Server threads log through a bounded queue so a slow
+    // syslog never stalls them
+    if (VSCP_ERROR_SUCCESS != vscpSyslog::getInstance().start()) {
+        syslog(LOG_ERR, "Failed to start syslog writer thread.");
+    }
+
     // Start daemon internal client worker thread
     try {
         startClientMsgWorkerThread();
@@ -549,6 +584,11 @@ CControlObject::init(std::string& strcfgfile, std::string& rootFolder)
         return FALSE;
     }
 
+    // Runtime metrics in Prometheus text format
+    if (vscpMetrics::isEnabled() && m_web_bEnable && (NULL != m_web_ctx)) {
+        mg_set_request_handler(m_web_ctx, "/metrics", metricsHandler, this);
+    }
+
     // Start TCP/IP interface
     try {
         startTcpipSrvThread();
@@ -595,16 +635,16 @@ CControlObject::run(void)
     pClientItem->m_strDeviceName += vscpdatetime::Now().getISODateTime();
 
     // Add the client to the Client List
-    pthread_mutex_lock(&m_clientList.m_mutexItemList);
+    pthread_rwlock_wrlock(&m_clientList.m_rwlockItemList);
     if (!addClient(pClientItem, CLIENT_ID_INTERNAL)) {
         // Failed to add client
         delete pClientItem;
         syslog(LOG_ERR, "ControlObject: Failed to add internal client.");
-        pthread_mutex_unlock(&m_clientList.m_mutexItemList);
+        pthread_rwlock_unlock(&m_clientList.m_rwlockItemList);
         delete pClientItem;
         return false;
     }
-    pthread_mutex_unlock(&m_clientList.m_mutexItemList);
+    pthread_rwlock_unlock(&m_clientList.m_rwlockItemList);
 
     if (__VSCP_DEBUG_EXTRA) {
         syslog(LOG_DEBUG, "Mainloop starting");
@@ -618,29 +658,27 @@ CControlObject::run(void)
     //                            MAIN - LOOP
     //-------------------------------------------------------------------------
 
-    struct timespec now, old_now;
-    clock_gettime(CLOCK_REALTIME, &old_now);
-    old_now.tv_sec -= 60;  // Do firts send right away
-
-    while (!m_bQuit) {
-
-        clock_gettime(CLOCK_REALTIME, &now);
-
-        // We send heartbeat every minute
-        if ((now.tv_sec-old_now.tv_sec) > 60) {
-
-            // Save time
-            clock_gettime(CLOCK_REALTIME, &old_now);
+    // The loop sleeps until a task is due, an event has been
+    // sent to all clients or the daemon is stopped
+    if (VSCP_ERROR_SUCCESS != m_scheduler.init()) {
+        syslog(LOG_ERR, "ControlObject: Failed to init main loop scheduler.");
+        pthread_rwlock_wrlock(&m_clientList.m_rwlockItemList);
+        removeClient(pClientItem);
+        pthread_rwlock_unlock(&m_clientList.m_rwlockItemList);
+        return false;
+    }
 
-            if (!automation(pClientItem)) {
-                syslog(LOG_ERR, "Failed to send automation events!");
-            }
+    // We send heartbeat every minute, first send right away
+    int idAutomation = m_scheduler.addTask("automation", VSCPHUBD_AUTOMATION_INTERVAL, [this, pClientItem]() {
+        if (!automation(pClientItem)) {
+            syslog(LOG_ERR, "Failed to send automation events!");
         }
+    });
 
-        // Wait for event
-        if ((-1 == vscp_sem_wait(&m_semSentToAllClients, 10)) &&
-            errno == ETIMEDOUT) {
-            continue;
+    m_scheduler.addFd(m_evfdSentToAllClients, [this, pClientItem]() {
+        eventfd_t cnt;
+        if (0 != eventfd_read(m_evfdSentToAllClients, &cnt)) {
+            return;
         }
 
         // Send events to websocket clients
@@ -651,7 +689,7 @@ CControlObject::run(void)
         //                   from one of the incoming source
         //----------------------------------------------------------------------
 
-        if (pClientItem->m_clientInputQueue.size()) {
+        while (pClientItem->m_clientInputQueue.size()) {
 
             vscpEvent* pEvent;
 
@@ -666,13 +704,23 @@ CControlObject::run(void)
             vscp_deleteEvent_v2(&pEvent);
 
         } // Event in queue
+    });
 
+    while (!m_bQuit) {
+        if (VSCP_ERROR_ERROR == m_scheduler.runOnce()) {
+            syslog(LOG_ERR, "ControlObject: Main loop wait failed. %m");
+            usleep(10000);
+        }
     } // while
 
+    // The handlers use the internal client
+    m_scheduler.removeTask(idAutomation);
+    m_scheduler.removeFd(m_evfdSentToAllClients);
+
     // Remove messages in the client queues
-    pthread_mutex_lock(&m_clientList.m_mutexItemList);
+    pthread_rwlock_wrlock(&m_clientList.m_rwlockItemList);
     removeClient(pClientItem);
-    pthread_mutex_unlock(&m_clientList.m_mutexItemList);
+    pthread_rwlock_unlock(&m_clientList.m_rwlockItemList);
 
     // Clean up is called in main file
 
@@ -874,6 +922,9 @@ CControlObject::cleanup(void)
         syslog(LOG_ERR, "REST: Exception occurred when stoping tcp/ip server");
     }
 
+    // Write what is left in the log queue
+    vscpSyslog::getInstance().stop();
+
     if (__VSCP_DEBUG_EXTRA) {
         syslog(LOG_DEBUG, "Controlobject: ControlObject: Cleanup done.");
     }
@@ -1260,7 +1311,7 @@ CControlObject::sendEventAllClients(vscpEvent* pEvent, uint32_t excludeID)
         return false;
     }
 
-    pthread_mutex_lock(&m_clientList.m_mutexItemList);
+    pthread_rwlock_rdlock(&m_clientList.m_rwlockItemList);
     for (it = m_clientList.m_itemList.begin();
          it != m_clientList.m_itemList.end();
          ++it) {
@@ -1278,7 +1329,7 @@ CControlObject::sendEventAllClients(vscpEvent* pEvent, uint32_t excludeID)
         }
     }
 
-    pthread_mutex_unlock(&m_clientList.m_mutexItemList);
+    pthread_rwlock_unlock(&m_clientList.m_rwlockItemList);
 
     return true;
 }
@@ -1380,51 +1431,18 @@ CControlObject::sendEvent(CClientItem* pClientItem, vscpEvent* peventToSend)
         }
 
         // Find client
-        pthread_mutex_lock(&m_clientList.m_mutexItemList);
+        pthread_rwlock_rdlock(&m_clientList.m_rwlockItemList);
 
-        std::deque<CClientItem*>::iterator it;
-        for (it = m_clientList.m_itemList.begin();
-             it != m_clientList.m_itemList.end();
-             ++it) {
-
-            CClientItem* pItem = *it;
-            if (__VSCP_DEBUG_EXTRA) {
-                syslog(LOG_DEBUG,
-                       "Test if = "
-                       "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:  - %s",
-                       pItem->m_guid.getAt(0),
-                       pItem->m_guid.getAt(1),
-                       pItem->m_guid.getAt(2),
-                       pItem->m_guid.getAt(3),
-                       pItem->m_guid.getAt(4),
-                       pItem->m_guid.getAt(5),
-                       pItem->m_guid.getAt(6),
-                       pItem->m_guid.getAt(7),
-                       pItem->m_guid.getAt(8),
-                       pItem->m_guid.getAt(9),
-                       pItem->m_guid.getAt(10),
-                       pItem->m_guid.getAt(11),
-                       pItem->m_guid.getAt(12),
-                       pItem->m_guid.getAt(13),
-                       pItem->m_guid.getAt(14),
-                       pItem->m_guid.getAt(15),
-                       pItem->m_strDeviceName.c_str());
-                syslog(LOG_DEBUG,"Match = %s",
-                        (pItem->m_guid == destguid) ? "true" : "false" );       
-            }
-
-            if (pItem->m_guid == destguid) {
-                // Found
-                // pDestClientItem = pItem;
-                bSent = true;
-                if (!sendEventToClient(pItem, pEvent)) {
-                    syslog(LOG_DEBUG,"sendEventToClient: Failed!");
-                }
-                break;
+        CClientItem* pItem = m_clientList.getClientFromGUID(destguid);
+        if (NULL != pItem) {
+            // Found
+            bSent = true;
+            if (!sendEventToClient(pItem, pEvent)) {
+                syslog(LOG_DEBUG,"sendEventToClient: Failed!");
             }
         }
 
-        pthread_mutex_unlock(&m_clientList.m_mutexItemList);
+        pthread_rwlock_unlock(&m_clientList.m_rwlockItemList);
     }
 
     if (!bSent) {
@@ -1498,13 +1516,13 @@ CControlObject::addClient(CClientItem* pClientItem, uint32_t id)
     }
 
     // Set GUID for interface
-    pClientItem->m_guid = m_guid;
+    cguid guid = m_guid;
 
     // Fill in client id
-    pClientItem->m_guid.setNicknameID(0);
-    pClientItem->m_guid.setClientID(pClientItem->m_clientID);
+    guid.setNicknameID(0);
+    guid.setClientID(pClientItem->m_clientID);
 
-    return true;
+    return m_clientList.setClientGUID(pClientItem, guid);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -1818,6 +1836,20 @@ startFullConfigParser(void* data, const char* name, const char** attr)
             else if (0 == vscp_strcasecmp(attr[i], "servername")) {
                 pObj->m_strServerName = attribute;
             }
+            else if (0 == vscp_strcasecmp(attr[i], "loglevel")) {
+                if (0 == vscp_strcasecmp(attribute.c_str(), "debug")) {
+                    vscpSyslog::setLevel(VSCP_LOG_LEVEL_DEBUG);
+                }
+                else if (0 == vscp_strcasecmp(attribute.c_str(), "info")) {
+                    vscpSyslog::setLevel(VSCP_LOG_LEVEL_INFO);
+                }
+                else if (0 == vscp_strcasecmp(attribute.c_str(), "warning")) {
+                    vscpSyslog::setLevel(VSCP_LOG_LEVEL_WARN);
+                }
+                else if (0 == vscp_strcasecmp(attribute.c_str(), "error")) {
+                    vscpSyslog::setLevel(VSCP_LOG_LEVEL_ERROR);
+                }
+            }
             else if (0 == vscp_strcasecmp(attr[i], "webadminif")) {
                 if (0 == vscp_strcasecmp(attribute.c_str(), "true")) {
                     pObj->m_enableWebAdminIf = true;
@@ -1981,6 +2013,20 @@ startFullConfigParser(void* data, const char* name, const char** attr)
         }
     }
 
+    else if (bVscpConfigFound && (1 == depth_full_config_parser) &&
+             (0 == vscp_strcasecmp(name, "metrics"))) {
+
+        for (int i = 0; attr[i]; i += 2) {
+
+            std::string attribute = attr[i + 1];
+            vscp_trim(attribute);
+
+            if (0 == vscp_strcasecmp(attr[i], "enable")) {
+                vscpMetrics::enable(0 == vscp_strcasecmp(attribute.c_str(), "true"));
+            }
+        }
+    }
+
     else if (bVscpConfigFound && (1 == depth_full_config_parser) &&
              (0 == vscp_strcasecmp(name, "webserver"))) {
 
@@ -2768,7 +2814,7 @@ clientMsgWorkerThread(void* userdata)
 
                 pObj->sendEventAllClients(pvscpEvent, pvscpEvent->obid);
                 // Tell main thread that there are work to do
-                sem_post(&pObj->m_semSentToAllClients);
+                eventfd_write(pObj->m_evfdSentToAllClients, 1);
 
             } // Valid event
 
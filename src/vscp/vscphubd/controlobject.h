@@ -38,6 +38,7 @@
 #include <tcpipsrv.h>
 #include <userlist.h>
 #include <vscp.h>
+#include <vscp-scheduler.h>
 #include <websocket.h>
 #include <websrv.h>
 
@@ -76,6 +77,9 @@ class TCPListenThread;
 #define VSCP_MAX_CLIENTS 4096 // abs. max. is 0xffff
 #define VSCP_MAX_DEVICES 1024 // abs. max. is 0xffff
 
+// Heartbeat/automation interval for the main loop (microseconds)
+#define VSCPHUBD_AUTOMATION_INTERVAL (60 * 1000000)
+
 /*!
     This is the class that does the main work in the daemon.
 */
@@ -592,10 +596,13 @@ class CControlObject {
     pthread_mutex_t m_mutex_ClientOutputQueue;
 
     /*!
-        Semaphore that is signaled when workerthread
+        eventfd that is signaled when workerthread
         have send an incoming event to all clients
     */
-    sem_t m_semSentToAllClients;
+    int m_evfdSentToAllClients;
+
+    // Runs the main loop tasks and event handling
+    vscpScheduler m_scheduler;
 
     // *************************************************************************
 
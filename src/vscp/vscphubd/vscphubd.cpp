@@ -92,6 +92,7 @@ _sighandlerStop(int sig)
     gpobj->m_bQuit = true;
     gbStopDaemon   = true;
     gbRestart      = false;
+    gpobj->m_scheduler.wakeup();
 }
 
 void
@@ -102,6 +103,7 @@ _sighandlerRestart(int sig)
     gpobj->m_bQuit = true;
     gbStopDaemon   = false;
     gbRestart      = true;
+    gpobj->m_scheduler.wakeup();
 }
 
 void
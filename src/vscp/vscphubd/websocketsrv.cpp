@@ -77,6 +77,7 @@
 #include <version.h>
 #include <vscp.h>
 #include <vscp-aes.h>
+#include <vscp-syslog.h>
 #include <vscp_debug.h>
 #include <vscphelper.h>
 #include <websrv.h>
@@ -380,17 +381,17 @@ websock_new_session(const struct mg_connection* conn)
     pSession->m_pClientItem->m_strDeviceName = ("Internal websocket client.");
 
     // Add the client to the Client List
-    pthread_mutex_lock(&gpobj->m_clientList.m_mutexItemList);
+    pthread_rwlock_wrlock(&gpobj->m_clientList.m_rwlockItemList);
     if (!gpobj->addClient(pSession->m_pClientItem)) {
         // Failed to add client
         delete pSession->m_pClientItem;
         pSession->m_pClientItem = NULL;
-        pthread_mutex_unlock(&gpobj->m_clientList.m_mutexItemList);
+        pthread_rwlock_unlock(&gpobj->m_clientList.m_rwlockItemList);
         syslog(LOG_ERR,
                ("Websocket server: Failed to add client. Terminating thread."));
         return NULL;
     }
-    pthread_mutex_unlock(&gpobj->m_clientList.m_mutexItemList);
+    pthread_rwlock_unlock(&gpobj->m_clientList.m_rwlockItemList);
 
     pthread_mutex_lock(&gpobj->m_mutex_websocketSession);
     gpobj->m_websocketSessions.push_back(pSession);
@@ -489,9 +490,9 @@ websock_post_incomingEvents(void)
                     if (vscp_convertEventToString(str, pEvent)) {
 
                         if (__VSCP_DEBUG_WEBSOCKET_RX) {
-                            syslog(LOG_DEBUG,
-                                   "Received ws event %s",
-                                   str.c_str());
+                            VSCP_SYSLOG(LOG_DEBUG,
+                                        "Received ws event %s",
+                                        str.c_str());
                         }
 
                         // Write it out
@@ -591,7 +592,9 @@ ws1_closeHandler(const struct mg_connection* conn, void* cbdata)
 
     pSession->m_conn_state = WEBSOCK_CONN_STATE_NULL;
     pSession->m_conn       = NULL;
+    pthread_rwlock_wrlock(&gpobj->m_clientList.m_rwlockItemList);
     gpobj->m_clientList.removeClient(pSession->m_pClientItem);
+    pthread_rwlock_unlock(&gpobj->m_clientList.m_rwlockItemList);
     pSession->m_pClientItem = NULL;
 
     pthread_mutex_lock(&gpobj->m_mutex_websocketSession);
@@ -952,9 +955,9 @@ ws1_message(struct mg_connection* conn,
                     }
 
                     // Check if this user is allowed to send this event
-                    if (!pSession->m_pClientItem->m_pUserItem
-                           ->isUserAllowedToSendEvent(ex.vscp_class,
-                                                      ex.vscp_type)) {
+                    if (!pSession->m_pClientItem->isAllowedToSendEvent(
+                          ex.vscp_class,
+                          ex.vscp_type)) {
 
                         str = vscp_str_format(
                           ("-;%d;%s"),
@@ -1468,7 +1471,9 @@ ws2_closeHandler(const struct mg_connection* conn, void* cbdata)
 
     pSession->m_conn_state = WEBSOCK_CONN_STATE_NULL;
     pSession->m_conn       = NULL;
+    pthread_rwlock_wrlock(&gpobj->m_clientList.m_rwlockItemList);
     gpobj->m_clientList.removeClient(pSession->m_pClientItem);
+    pthread_rwlock_unlock(&gpobj->m_clientList.m_rwlockItemList);
     pSession->m_pClientItem = NULL;
 
     pthread_mutex_lock(&gpobj->m_mutex_websocketSession);
@@ -1891,8 +1896,8 @@ ws2_message(struct mg_connection* conn,
 
                                 // Check if this user is allowed to send this
                                 // event
-                                if (!pSession->m_pClientItem->m_pUserItem
-                                       ->isUserAllowedToSendEvent(
+                                if (!pSession->m_pClientItem
+                                       ->isAllowedToSendEvent(
                                          ex.vscp_class,
                                          ex.vscp_type)) {
 
@@ -0,0 +1,586 @@
+// bench.cpp
+//
+// Performance benchmarks for the VSCP protocol core
+//
+// Runs offline, nothing is sent on the network. Google Benchmark
+// options work as usual, for example
+//
+//   vscp_bench --benchmark_filter=Guid
+//   vscp_bench --benchmark_out=bench.json --benchmark_out_format=json
+//
+// Compare with a result file from an earlier run
+//
+//   vscp_bench --baseline=bench.json [--threshold=10]
+//
+// Benchmarks that are more than threshold percent (default 10) slower
+// than the baseline are reported and the exit code is 1.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <clientlist.h>
+#include <crc.h>
+#include <guid.h>
+#include <vscp-token.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include <fstream>
+#include <map>
+#include <vector>
+#include <string>
+
+#include <mustache.hpp>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+using namespace kainjow::mustache;
+
+static const char *benchGuid = "FF:FF:FF:FF:FF:FF:FF:FE:00:16:3E:4A:7C:01:00:02";
+
+// Temperature 24.5 degrees C, normalized integer, sensor 1
+static void
+makeMeasurement(vscpEventEx &ex)
+{
+  memset(&ex, 0, sizeof(ex));
+  ex.head       = VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  ex.timestamp  = 123456;
+  ex.vscp_class = VSCP_CLASS1_MEASUREMENT;
+  ex.vscp_type  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+  cguid::parseString(ex.GUID, benchGuid);
+  ex.sizeData = 4;
+  ex.data[0]  = 0x89; // Normalized integer, unit 1 (Celsius), sensor 1
+  ex.data[1]  = 0x81; // One decimal
+  ex.data[2]  = 0x00;
+  ex.data[3]  = 0xf5; // 245
+}
+
+static void
+makeMeasurement(vscpEvent &ev, uint8_t *pdata)
+{
+  vscpEventEx ex;
+  makeMeasurement(ex);
+  memset(&ev, 0, sizeof(ev));
+  ev.head       = ex.head;
+  ev.timestamp  = ex.timestamp;
+  ev.vscp_class = ex.vscp_class;
+  ev.vscp_type  = ex.vscp_type;
+  memcpy(ev.GUID, ex.GUID, 16);
+  ev.sizeData = ex.sizeData;
+  ev.pdata    = pdata;
+  memcpy(ev.pdata, ex.data, ex.sizeData);
+}
+
+// ---------------------------------------------------------------------------
+//                             Event encode/decode
+// ---------------------------------------------------------------------------
+
+static void
+BM_EventToString(benchmark::State &state)
+{
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  makeMeasurement(ev, data);
+  std::string str;
+  for (auto _ : state) {
+    vscp_convertEventToString(str, &ev);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(BM_EventToString);
+
+static void
+BM_StringToEvent(benchmark::State &state)
+{
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  makeMeasurement(ev, data);
+  std::string str;
+  vscp_convertEventToString(str, &ev);
+  for (auto _ : state) {
+    vscpEvent evout;
+    memset(&evout, 0, sizeof(evout));
+    vscp_convertStringToEvent(&evout, str);
+    delete[] evout.pdata;
+  }
+}
+BENCHMARK(BM_StringToEvent);
+
+static void
+BM_EventToJSON(benchmark::State &state)
+{
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  makeMeasurement(ev, data);
+  std::string str;
+  for (auto _ : state) {
+    vscp_convertEventToJSON(str, &ev);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(BM_EventToJSON);
+
+static void
+BM_JSONToEvent(benchmark::State &state)
+{
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  makeMeasurement(ev, data);
+  std::string str;
+  vscp_convertEventToJSON(str, &ev);
+  for (auto _ : state) {
+    vscpEvent evout;
+    memset(&evout, 0, sizeof(evout));
+    vscp_convertJSONToEvent(&evout, str);
+    delete[] evout.pdata;
+  }
+}
+BENCHMARK(BM_JSONToEvent);
+
+static void
+BM_EventToXML(benchmark::State &state)
+{
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  makeMeasurement(ev, data);
+  std::string str;
+  for (auto _ : state) {
+    vscp_convertEventToXML(str, &ev);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(BM_EventToXML);
+
+static void
+BM_XMLToEvent(benchmark::State &state)
+{
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  makeMeasurement(ev, data);
+  std::string str;
+  vscp_convertEventToXML(str, &ev);
+  for (auto _ : state) {
+    vscpEvent evout;
+    memset(&evout, 0, sizeof(evout));
+    vscp_convertXMLToEvent(&evout, str);
+    delete[] evout.pdata;
+  }
+}
+BENCHMARK(BM_XMLToEvent);
+
+static void
+BM_EventToFrame(benchmark::State &state)
+{
+  vscpEventEx ex;
+  makeMeasurement(ex);
+  uint8_t frame[VSCP_MAX_DATA + 64];
+  for (auto _ : state) {
+    vscp_writeEventExToFrame(frame, sizeof(frame), VSCP_ENCRYPTION_NONE, &ex);
+    benchmark::DoNotOptimize(frame);
+  }
+}
+BENCHMARK(BM_EventToFrame);
+
+static void
+BM_FrameToEvent(benchmark::State &state)
+{
+  vscpEventEx ex;
+  makeMeasurement(ex);
+  uint8_t frame[VSCP_MAX_DATA + 64];
+  vscp_writeEventExToFrame(frame, sizeof(frame), VSCP_ENCRYPTION_NONE, &ex);
+  size_t len = vscp_getFrameSizeFromEventEx(&ex);
+  for (auto _ : state) {
+    vscpEventEx exout;
+    vscp_getEventExFromFrame(&exout, frame, len);
+    benchmark::DoNotOptimize(exout);
+  }
+}
+BENCHMARK(BM_FrameToEvent);
+
+// ---------------------------------------------------------------------------
+//                             Filter / measurement
+// ---------------------------------------------------------------------------
+
+static void
+BM_Level2Filter(benchmark::State &state)
+{
+  vscpEventEx ex;
+  makeMeasurement(ex);
+
+  // Arg 0: accepting filter on class/type/GUID, 1: rejected on GUID
+  vscpEventFilter filter;
+  vscp_clearVSCPFilter(&filter);
+  filter.filter_class = VSCP_CLASS1_MEASUREMENT;
+  filter.mask_class   = 0xffff;
+  filter.filter_type  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+  filter.mask_type    = 0xffff;
+  memcpy(filter.filter_GUID, ex.GUID, 16);
+  memset(filter.mask_GUID, 0xff, 16);
+  if (state.range(0)) {
+    filter.filter_GUID[15] ^= 0xff;
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vscp_doLevel2FilterEx(&ex, &filter));
+  }
+}
+BENCHMARK(BM_Level2Filter)->Arg(0)->Arg(1);
+
+static void
+BM_MeasurementAsDouble(benchmark::State &state)
+{
+  vscpEventEx ex;
+  makeMeasurement(ex);
+  double value;
+  for (auto _ : state) {
+    vscp_getMeasurementAsDoubleEx(&value, &ex);
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_MeasurementAsDouble);
+
+static void
+BM_MeasurementFloatAsDouble(benchmark::State &state)
+{
+  vscpEventEx ex;
+  makeMeasurement(ex);
+  ex.vscp_class = VSCP_CLASS2_MEASUREMENT_FLOAT;
+  ex.sizeData   = 12;
+  ex.data[0]    = 1; // Sensor index
+  ex.data[1]    = 0; // Zone
+  ex.data[2]    = 0; // Subzone
+  ex.data[3]    = 1; // Unit
+  double d      = 24.5;
+  uint8_t *p    = (uint8_t *) &d;
+  for (int i = 0; i < 8; i++) {
+    ex.data[4 + i] = p[7 - i]; // MSB first
+  }
+  double value;
+  for (auto _ : state) {
+    vscp_getMeasurementAsDoubleEx(&value, &ex);
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_MeasurementFloatAsDouble);
+
+// ---------------------------------------------------------------------------
+//                                    GUID
+// ---------------------------------------------------------------------------
+
+static void
+BM_GuidParse(benchmark::State &state)
+{
+  cguid guid;
+  for (auto _ : state) {
+    guid.getFromString(benchGuid);
+    benchmark::DoNotOptimize(guid.getGUID());
+  }
+}
+BENCHMARK(BM_GuidParse);
+
+static void
+BM_GuidParseToArray(benchmark::State &state)
+{
+  uint8_t guid[16];
+  std::string str(benchGuid);
+  for (auto _ : state) {
+    vscp_getGuidFromStringToArray(guid, str);
+    benchmark::DoNotOptimize(guid);
+  }
+}
+BENCHMARK(BM_GuidParseToArray);
+
+static void
+BM_GuidFormat(benchmark::State &state)
+{
+  cguid guid{ std::string(benchGuid) };
+  char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(guid.toString(buf));
+  }
+}
+BENCHMARK(BM_GuidFormat);
+
+static void
+BM_GuidFormatString(benchmark::State &state)
+{
+  cguid guid{ std::string(benchGuid) };
+  for (auto _ : state) {
+    std::string str = guid.getAsString();
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(BM_GuidFormatString);
+
+// ---------------------------------------------------------------------------
+//                                 CRC / AES
+// ---------------------------------------------------------------------------
+
+static void
+BM_FrameCrc(benchmark::State &state)
+{
+  std::vector<uint8_t> buf(state.range(0));
+  for (size_t i = 0; i < buf.size(); i++) {
+    buf[i] = (uint8_t) i;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crcFast(buf.data(), (int) buf.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FrameCrc)->Arg(40)->Arg(512);
+
+static void
+BM_FrameEncrypt(benchmark::State &state)
+{
+  vscpEventEx ex;
+  makeMeasurement(ex);
+  uint8_t frame[VSCP_MAX_DATA + 64];
+  uint8_t out[VSCP_MAX_DATA + 128];
+  vscp_writeEventExToFrame(frame, sizeof(frame), VSCP_ENCRYPTION_AES128, &ex);
+  size_t len = vscp_getFrameSizeFromEventEx(&ex);
+
+  uint8_t key[32], iv[16];
+  for (int i = 0; i < 32; i++) {
+    key[i] = (uint8_t) (i * 7);
+  }
+  memset(iv, 0x5a, sizeof(iv));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vscp_encryptFrame(out, frame, len, key, iv, VSCP_ENCRYPTION_AES128));
+  }
+}
+BENCHMARK(BM_FrameEncrypt);
+
+static void
+BM_FrameDecrypt(benchmark::State &state)
+{
+  vscpEventEx ex;
+  makeMeasurement(ex);
+  uint8_t frame[VSCP_MAX_DATA + 64];
+  uint8_t enc[VSCP_MAX_DATA + 128];
+  uint8_t out[VSCP_MAX_DATA + 128];
+  vscp_writeEventExToFrame(frame, sizeof(frame), VSCP_ENCRYPTION_AES128, &ex);
+  size_t len = vscp_getFrameSizeFromEventEx(&ex);
+
+  uint8_t key[32], iv[16];
+  for (int i = 0; i < 32; i++) {
+    key[i] = (uint8_t) (i * 7);
+  }
+  memset(iv, 0x5a, sizeof(iv));
+  size_t lenEnc = vscp_encryptFrame(enc, frame, len, key, iv, VSCP_ENCRYPTION_AES128);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vscp_decryptFrame(out, enc, lenEnc, key, NULL, VSCP_ENCRYPTION_AES128));
+  }
+}
+BENCHMARK(BM_FrameDecrypt);
+
+// ---------------------------------------------------------------------------
+//                               Client fan out
+// ---------------------------------------------------------------------------
+
+static void
+BM_SendEventAllClients(benchmark::State &state)
+{
+  CClientList list;
+  for (int i = 0; i < state.range(0); i++) {
+    list.addClient(new CClientItem);
+  }
+
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  makeMeasurement(ev, data);
+
+  size_t cnt = 0;
+  for (auto _ : state) {
+    list.sendEventAllClients(&ev);
+
+    // Keep the client queues short, as a client thread would
+    if (0 == (++cnt % 1024)) {
+      state.PauseTiming();
+      for (uint16_t i = 0; i < list.getClientCount(); i++) {
+        CClientItem *pItem = list.getClientFromOrdinal(i);
+        pthread_mutex_lock(&pItem->m_mutexClientInputQueue);
+        for (size_t j = 0; j < pItem->m_clientInputQueue.size(); j++) {
+          vscp_deleteEvent_v2(&pItem->m_clientInputQueue[j]);
+          sem_trywait(&pItem->m_semClientInputQueue);
+        }
+        pItem->m_clientInputQueue.clear();
+        pthread_mutex_unlock(&pItem->m_mutexClientInputQueue);
+      }
+      state.ResumeTiming();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  list.removeAllClients();
+}
+BENCHMARK(BM_SendEventAllClients)->RangeMultiplier(4)->Range(1, 256);
+
+// ---------------------------------------------------------------------------
+//                            MQTT topic rendering
+// ---------------------------------------------------------------------------
+
+// Same template data as vscpClientMqtt::send sets up for the
+// common topic escapes
+static void
+BM_MqttTopicRender(benchmark::State &state)
+{
+  uint8_t evdata[VSCP_MAX_DATA];
+  vscpEvent ev;
+  makeMeasurement(ev, evdata);
+  cguid srvguid{ std::string(benchGuid) };
+
+  std::string topic = "vscp/{{srvguid}}/{{guid}}/{{class}}/{{type}}/{{nickname}}";
+  for (auto _ : state) {
+    mustache subtemplate{ topic };
+    data data;
+    cguid evguid(ev.GUID);
+    data.set("guid", evguid.getAsString());
+    data.set("srvguid", srvguid.getAsString());
+    data.set("nickname", vscp_str_format("%d", evguid.getNicknameID()));
+    data.set("class", vscp_str_format("%d", ev.vscp_class));
+    data.set("type", vscp_str_format("%d", ev.vscp_type));
+    const char *pClassToken = vscp_getBuiltinClassToken(ev.vscp_class);
+    const char *pTypeToken  = vscp_getBuiltinTypeToken(ev.vscp_class, ev.vscp_type);
+    data.set("class-token", (nullptr != pClassToken) ? pClassToken : "");
+    data.set("type-token", (nullptr != pTypeToken) ? pTypeToken : "");
+    std::string str = subtemplate.render(data);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+BENCHMARK(BM_MqttTopicRender);
+
+// ---------------------------------------------------------------------------
+//                              Baseline compare
+// ---------------------------------------------------------------------------
+
+// Collects real time per iteration (ns) while showing the normal output
+class baselineReporter : public benchmark::ConsoleReporter {
+
+public:
+  void ReportRuns(const std::vector<Run> &reports) override
+  {
+    for (size_t i = 0; i < reports.size(); i++) {
+      const Run &run = reports[i];
+      if ((Run::RT_Iteration == run.run_type) || ("mean" == run.aggregate_name)) {
+        m_results[run.benchmark_name()] =
+          run.GetAdjustedRealTime() / benchmark::GetTimeUnitMultiplier(run.time_unit) * 1e9;
+      }
+    }
+    ConsoleReporter::ReportRuns(reports);
+  }
+
+  std::map<std::string, double> m_results;
+};
+
+// Time of a benchmark in a Google Benchmark JSON result in ns
+static double
+baselineTime(const json &j)
+{
+  std::string unit = j.value("time_unit", "ns");
+  double t         = j.value("real_time", 0.0);
+  if ("us" == unit) {
+    return t * 1e3;
+  }
+  else if ("ms" == unit) {
+    return t * 1e6;
+  }
+  else if ("s" == unit) {
+    return t * 1e9;
+  }
+  return t;
+}
+
+static int
+compareBaseline(const std::map<std::string, double> &results, const std::string &path, double threshold)
+{
+  json j;
+  try {
+    std::ifstream in(path);
+    in >> j;
+  }
+  catch (...) {
+    fprintf(stderr, "Unable to read baseline %s\n", path.c_str());
+    return 2;
+  }
+
+  std::map<std::string, double> baseline;
+  if (j.contains("benchmarks") && j["benchmarks"].is_array()) {
+    for (auto &b : j["benchmarks"]) {
+      std::string type = b.value("run_type", "iteration");
+      if (("iteration" == type) || ("mean" == b.value("aggregate_name", ""))) {
+        baseline[b.value("run_name", b.value("name", ""))] = baselineTime(b);
+      }
+    }
+  }
+
+  int cntRegressions = 0;
+  printf("\n%-44s %12s %12s %9s\n", "Benchmark", "Baseline ns", "Current ns", "Change");
+  for (auto it = results.begin(); it != results.end(); ++it) {
+    auto itb = baseline.find(it->first);
+    if ((itb == baseline.end()) || (itb->second <= 0)) {
+      printf("%-44s %12s %12.1f %9s\n", it->first.c_str(), "-", it->second, "new");
+      continue;
+    }
+
+    double change = (it->second - itb->second) / itb->second * 100;
+    bool bRegression = (change > threshold);
+    if (bRegression) {
+      cntRegressions++;
+    }
+    printf("%-44s %12.1f %12.1f %+8.1f%%%s\n",
+           it->first.c_str(),
+           itb->second,
+           it->second,
+           change,
+           bRegression ? " REGRESSION" : "");
+  }
+
+  printf("\n%d benchmark(s) more than %.1f%% slower than baseline\n", cntRegressions, threshold);
+  return cntRegressions ? 1 : 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  std::string baseline;
+  double threshold = 10;
+
+  // Take out our own options before Google Benchmark sees them
+  int n = 1;
+  for (int i = 1; i < argc; i++) {
+    if (0 == strncmp(argv[i], "--baseline=", 11)) {
+      baseline = argv[i] + 11;
+    }
+    else if (0 == strncmp(argv[i], "--threshold=", 12)) {
+      threshold = atof(argv[i] + 12);
+    }
+    else {
+      argv[n++] = argv[i];
+    }
+  }
+  argc = n;
+
+  crcInit();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  baselineReporter reporter;
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+  benchmark::Shutdown();
+
+  if (!baseline.empty()) {
+    return compareBaseline(reporter.m_results, baseline, threshold);
+  }
+
+  return 0;
+}
@@ -15,7 +15,7 @@ TEST(ClientList, getter_setters)
     CClientItem item;
 
     item.setDeviceName("testDevice");
-    ASSERT_EQ("testDevice", item.getDeviceName());
+    ASSERT_EQ(0, item.getDeviceName().find("testDevice|Started at "));
     
     // uint8_t iv4[5] = {0xae,0xC6,0xA7,0xE2,0xA4};
     // ASSERT_EQ(-21489.320312f, vscp_getMeasurementAsFloat(iv4, 5));
@@ -24,6 +24,131 @@ TEST(ClientList, getter_setters)
     // ASSERT_NE(0, vscp_getMeasurementAsFloat(iv4, 5));
 }
 
+//-----------------------------------------------------------------------------
+TEST(ClientList, addClient_ids)
+{
+    CClientList list;
+
+    CClientItem *pItem1 = new CClientItem;
+    CClientItem *pItem2 = new CClientItem;
+    CClientItem *pItem3 = new CClientItem;
+
+    ASSERT_TRUE(list.addClient(pItem1));
+    ASSERT_TRUE(list.addClient(pItem2));
+    ASSERT_EQ(1, pItem1->m_clientID);
+    ASSERT_EQ(2, pItem2->m_clientID);
+    ASSERT_EQ(2, list.getClientCount());
+
+    ASSERT_EQ(pItem1, list.getClientFromId(1));
+    ASSERT_EQ(pItem2, list.getClientFromId(2));
+    ASSERT_EQ(NULL, list.getClientFromId(3));
+
+    // Freed id is reused
+    ASSERT_TRUE(list.removeClient(pItem1));
+    ASSERT_EQ(NULL, list.getClientFromId(1));
+    ASSERT_TRUE(list.addClient(pItem3));
+    ASSERT_EQ(1, pItem3->m_clientID);
+
+    // Requested id already in use
+    CClientItem *pItem4 = new CClientItem;
+    ASSERT_FALSE(list.addClient(pItem4, 2));
+    ASSERT_TRUE(list.addClient(pItem4, CLIENT_ID_INTERNAL));
+    ASSERT_EQ(pItem4, list.getClientFromId(CLIENT_ID_INTERNAL));
+    ASSERT_EQ(3, list.getClientCount());
+}
+
+//-----------------------------------------------------------------------------
+TEST(ClientList, findFreeId_full)
+{
+    CClientList list;
+    uint16_t id;
+
+    for (uint32_t i = 1; i <= CLIENT_LIST_MAX_ID; i++) {
+        ASSERT_TRUE(list.addClient(new CClientItem));
+    }
+
+    id = 1;
+    ASSERT_FALSE(list.findFreeId(&id));
+
+    CClientItem *pItem = list.getClientFromId(1000);
+    ASSERT_NE((CClientItem *)NULL, pItem);
+    ASSERT_TRUE(list.removeClient(pItem));
+
+    id = 1;
+    ASSERT_TRUE(list.findFreeId(&id));
+    ASSERT_EQ(1000, id);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ClientList, getClientFromGUID)
+{
+    CClientList list;
+    cguid guid1("FF:FF:FF:FF:FF:FF:FF:FE:00:00:00:00:00:00:00:00");
+    cguid guid2("FF:FF:FF:FF:FF:FF:FF:FE:00:00:00:00:00:00:01:00");
+
+    CClientItem *pItem1 = new CClientItem;
+    CClientItem *pItem2 = new CClientItem;
+
+    ASSERT_TRUE(list.addClient(pItem1, guid1));
+    ASSERT_TRUE(list.addClient(pItem2));
+    ASSERT_EQ(pItem1, list.getClientFromGUID(guid1));
+    ASSERT_EQ(NULL, list.getClientFromGUID(guid2));
+
+    // Changed GUID is re-indexed
+    ASSERT_TRUE(list.setClientGUID(pItem2, guid2));
+    ASSERT_EQ(pItem2, list.getClientFromGUID(guid2));
+    ASSERT_TRUE(list.setClientGUID(pItem1, guid2));
+    ASSERT_EQ(NULL, list.getClientFromGUID(guid1));
+
+    // Shared GUID gives the client first in the list
+    ASSERT_EQ(pItem1, list.getClientFromGUID(guid2));
+
+    ASSERT_TRUE(list.removeClient(pItem1));
+    ASSERT_EQ(pItem2, list.getClientFromGUID(guid2));
+    ASSERT_TRUE(list.removeClient(pItem2));
+    ASSERT_EQ(NULL, list.getClientFromGUID(guid2));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ClientList, getClientFromGUID_listOrder)
+{
+    CClientList list;
+    cguid guid("FF:FF:FF:FF:FF:FF:FF:FE:00:00:00:00:00:02:00:00");
+    cguid other("FF:FF:FF:FF:FF:FF:FF:FE:00:00:00:00:00:03:00:00");
+
+    CClientItem *pItems[4];
+    for (int i = 0; i < 4; i++) {
+        pItems[i] = new CClientItem;
+        ASSERT_TRUE(list.addClient(pItems[i], guid));
+    }
+
+    // Same answer as a scan of the list, whatever the GUID history
+    ASSERT_EQ(pItems[0], list.getClientFromGUID(guid));
+
+    ASSERT_TRUE(list.setClientGUID(pItems[0], other));
+    ASSERT_EQ(pItems[1], list.getClientFromGUID(guid));
+
+    ASSERT_TRUE(list.setClientGUID(pItems[2], other));
+    ASSERT_EQ(pItems[0], list.getClientFromGUID(other));
+
+    // Back to the shared GUID, earlier in the list than the others
+    ASSERT_TRUE(list.setClientGUID(pItems[0], guid));
+    ASSERT_EQ(pItems[0], list.getClientFromGUID(guid));
+    ASSERT_EQ(pItems[2], list.getClientFromGUID(other));
+
+    ASSERT_TRUE(list.removeClient(pItems[0]));
+    ASSERT_EQ(pItems[1], list.getClientFromGUID(guid));
+    ASSERT_TRUE(list.removeClient(pItems[1]));
+    ASSERT_EQ(pItems[3], list.getClientFromGUID(guid));
+
+    // Added later goes last
+    CClientItem *pItem = new CClientItem;
+    ASSERT_TRUE(list.addClient(pItem, guid));
+    ASSERT_EQ(pItems[3], list.getClientFromGUID(guid));
+    ASSERT_TRUE(list.removeClient(pItems[3]));
+    ASSERT_EQ(pItem, list.getClientFromGUID(guid));
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,432 @@
+// unittest.cpp
+//
+// Unit tests for the driver receive -> publish pipe of the daemon
+//
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <devicelist.h>
+#include <devicepipe.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Interface GUID used for Level I conversions
+static const uint8_t ifguid[16] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+                                    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00 };
+
+// Collects what the publisher thread hands over
+class Sink {
+public:
+  Sink()
+    : m_bFail(false)
+    , m_bBlock(false)
+  {
+  }
+
+  bool publish(vscpEvent *pev)
+  {
+    while (m_bBlock) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_types.push_back(pev->vscp_type);
+    return !m_bFail;
+  }
+
+  size_t count(void)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_types.size();
+  }
+
+  std::mutex m_mutex;
+  std::vector<uint16_t> m_types;
+  std::atomic<bool> m_bFail;
+  std::atomic<bool> m_bBlock;
+};
+
+static bool
+waitFor(Sink &sink, size_t cnt)
+{
+  for (int i = 0; i < 2000; i++) {
+    if (sink.count() >= cnt) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+// Level I CANAL message class/type from nickname
+static void
+makeCanalMsg(canalMsg &msg, uint16_t vscp_class, uint8_t vscp_type, uint8_t nickname, uint8_t size)
+{
+  memset(&msg, 0, sizeof(msg));
+  msg.flags    = CANAL_IDFLAG_EXTENDED;
+  msg.id       = ((uint32_t) vscp_class << 16) | ((uint32_t) vscp_type << 8) | nickname;
+  msg.sizeData = size;
+  for (uint8_t i = 0; i < size && i < 8; i++) {
+    msg.data[i] = i + 1;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, PublishInOrder)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 8);
+  ASSERT_TRUE(pipe.start());
+
+  for (uint16_t i = 0; i < 20; i++) {
+    vscpEvent *pev = pipe.acquire();
+    ASSERT_NE(nullptr, pev);
+    ASSERT_NE(nullptr, pev->pdata);
+    pev->vscp_type = i;
+    pipe.commit(pev);
+    if (3 == (i % 4)) {
+      pipe.flush();
+    }
+  }
+
+  ASSERT_TRUE(waitFor(sink, 20));
+  pipe.stop();
+
+  ASSERT_EQ(20, sink.m_types.size());
+  for (uint16_t i = 0; i < 20; i++) {
+    ASSERT_EQ(i, sink.m_types[i]);
+  }
+  ASSERT_EQ(20, pipe.getPublishCount());
+  ASSERT_EQ(0, pipe.getErrorCount());
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, StopPublishesQueued)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 8);
+  ASSERT_TRUE(pipe.start());
+
+  for (uint16_t i = 0; i < 5; i++) {
+    vscpEvent *pev = pipe.acquire();
+    ASSERT_NE(nullptr, pev);
+    pipe.commit(pev);
+  }
+  ASSERT_EQ(5, pipe.getBatchSize());
+  pipe.flush();
+  ASSERT_EQ(0, pipe.getBatchSize());
+
+  pipe.stop();
+  ASSERT_EQ(5, sink.count());
+  ASSERT_EQ(5, pipe.getPublishCount());
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, CountsErrors)
+{
+  Sink sink;
+  sink.m_bFail = true;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 4);
+  ASSERT_TRUE(pipe.start());
+
+  for (uint16_t i = 0; i < 3; i++) {
+    pipe.commit(pipe.acquire());
+  }
+  pipe.flush();
+  pipe.stop();
+
+  ASSERT_EQ(0, pipe.getPublishCount());
+  ASSERT_EQ(3, pipe.getErrorCount());
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, ReleasedSlotIsNotPublished)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 1);
+  ASSERT_TRUE(pipe.start());
+
+  // With a single slot a release must give it back or the next acquire hangs
+  for (int i = 0; i < 3; i++) {
+    vscpEvent *pev = pipe.acquire();
+    ASSERT_NE(nullptr, pev);
+    pipe.release(pev);
+  }
+
+  pipe.stop();
+  ASSERT_EQ(0, sink.count());
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, AcquireFlushesBatchWhenOutOfSlots)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 4);
+  ASSERT_TRUE(pipe.start());
+
+  // More events than slots without a flush in between. The pipe must hand
+  // its own unflushed batch to the publisher instead of waiting forever.
+  for (uint16_t i = 0; i < 10; i++) {
+    vscpEvent *pev = pipe.acquire();
+    ASSERT_NE(nullptr, pev);
+    pev->vscp_type = i;
+    pipe.commit(pev);
+  }
+  pipe.flush();
+
+  ASSERT_TRUE(waitFor(sink, 10));
+  pipe.stop();
+  for (uint16_t i = 0; i < 10; i++) {
+    ASSERT_EQ(i, sink.m_types[i]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, AcquireWaitsForSlowPublisher)
+{
+  Sink sink;
+  sink.m_bBlock = true;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 2);
+  ASSERT_TRUE(pipe.start());
+
+  pipe.commit(pipe.acquire());
+  pipe.commit(pipe.acquire());
+  pipe.flush();
+
+  std::atomic<bool> bGot(false);
+  std::thread t([&pipe, &bGot]() {
+    vscpEvent *pev = pipe.acquire();
+    bGot           = (nullptr != pev);
+    pipe.release(pev);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(bGot);
+
+  sink.m_bBlock = false;
+  t.join();
+  ASSERT_TRUE(bGot);
+
+  pipe.stop();
+  ASSERT_EQ(2, sink.count());
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, AcquireReturnsNullWhenStopping)
+{
+  Sink sink;
+  sink.m_bBlock = true;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 1);
+  ASSERT_TRUE(pipe.start());
+
+  pipe.commit(pipe.acquire());
+  pipe.flush();
+
+  std::atomic<bool> bDone(false);
+  vscpEvent *pev = (vscpEvent *) 1;
+  std::thread t([&pipe, &pev, &bDone]() {
+    pev   = pipe.acquire();
+    bDone = true;
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  std::thread s([&pipe]() { pipe.stop(); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  sink.m_bBlock = false;
+
+  s.join();
+  t.join();
+  ASSERT_TRUE(bDone);
+  // Either stop woke it up or the publisher returned the slot first
+  if (nullptr != pev) {
+    pipe.release(pev);
+  }
+  ASSERT_EQ(1, sink.count());
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, Level1ToSlot)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 2);
+
+  canalMsg msg;
+  makeCanalMsg(msg, VSCP_CLASS1_INFORMATION, VSCP_TYPE_INFORMATION_ON, 0x12, 3);
+
+  vscpEvent *pev = pipe.acquire();
+  uint8_t *pbuf  = pev->pdata;
+
+  ASSERT_TRUE(level1ToSlot(pev, &msg, ifguid, 0, false));
+  ASSERT_EQ(pbuf, pev->pdata);
+  ASSERT_EQ(VSCP_CLASS1_INFORMATION, pev->vscp_class);
+  ASSERT_EQ(VSCP_TYPE_INFORMATION_ON, pev->vscp_type);
+  ASSERT_EQ(3, pev->sizeData);
+  ASSERT_EQ(1, pev->pdata[0]);
+  ASSERT_EQ(3, pev->pdata[2]);
+  ASSERT_EQ(0, pev->obid);
+  ASSERT_EQ(0x06, pev->GUID[13]);
+  ASSERT_EQ(0x07, pev->GUID[14]);
+  ASSERT_EQ(0x12, pev->GUID[15]);
+
+  pipe.release(pev);
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, Level1ToSlotNicknameMsb)
+{
+  uint8_t guid[16];
+  memcpy(guid, ifguid, 16);
+  guid[14] = 0xaa;
+
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 2);
+
+  canalMsg msg;
+  makeCanalMsg(msg, VSCP_CLASS1_INFORMATION, VSCP_TYPE_INFORMATION_ON, 0x12, 0);
+
+  vscpEvent *pev = pipe.acquire();
+
+  // Left as is
+  ASSERT_TRUE(level1ToSlot(pev, &msg, guid, 0, false));
+  ASSERT_EQ(0xaa, pev->GUID[14]);
+  ASSERT_EQ(0x12, pev->GUID[15]);
+
+  // Cleared
+  ASSERT_TRUE(level1ToSlot(pev, &msg, guid, 0, true));
+  ASSERT_EQ(0, pev->GUID[14]);
+  ASSERT_EQ(0x12, pev->GUID[15]);
+
+  pipe.release(pev);
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, Level1ToSlotOversize)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 2);
+
+  canalMsg msg;
+  makeCanalMsg(msg, VSCP_CLASS1_INFORMATION, VSCP_TYPE_INFORMATION_ON, 0x12, 8);
+  msg.sizeData = 9;
+
+  vscpEvent *pev = pipe.acquire();
+  uint8_t *pbuf  = pev->pdata;
+  ASSERT_FALSE(level1ToSlot(pev, &msg, ifguid, 0, true));
+  ASSERT_EQ(pbuf, pev->pdata);
+  pipe.release(pev);
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, Level1ToSlotAllToLevel2)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 2);
+
+  canalMsg msg;
+  makeCanalMsg(msg, VSCP_CLASS1_INFORMATION, VSCP_TYPE_INFORMATION_ON, 0x12, 3);
+
+  vscpEvent *pev = pipe.acquire();
+  ASSERT_TRUE(level1ToSlot(pev, &msg, ifguid, VSCP_DRIVER_OUT_TR_ALL_L2, true));
+  ASSERT_EQ(VSCP_CLASS1_INFORMATION + 512, pev->vscp_class);
+  ASSERT_EQ(VSCP_TYPE_INFORMATION_ON, pev->vscp_type);
+  ASSERT_EQ(16 + 3, pev->sizeData);
+  for (int i = 0; i < 16; i++) {
+    ASSERT_EQ(0, pev->pdata[i]);
+  }
+  ASSERT_EQ(1, pev->pdata[16]);
+  ASSERT_EQ(3, pev->pdata[18]);
+  pipe.release(pev);
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, Level1ToSlotMeasurementToFloat)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 2);
+
+  // 25 degrees Celsius, integer coding
+  canalMsg msg;
+  makeCanalMsg(msg, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 0x12, 2);
+  msg.data[0] = VSCP_DATACODING_INTEGER | (1 << 3);
+  msg.data[1] = 25;
+
+  vscpEvent *pev = pipe.acquire();
+  uint8_t *pbuf  = pev->pdata;
+  ASSERT_TRUE(level1ToSlot(pev, &msg, ifguid, VSCP_DRIVER_OUT_TR_M1_M2F, true));
+  ASSERT_EQ(pbuf, pev->pdata);
+  ASSERT_EQ(VSCP_CLASS2_MEASUREMENT_FLOAT, pev->vscp_class);
+  ASSERT_EQ(VSCP_TYPE_MEASUREMENT_TEMPERATURE, pev->vscp_type);
+  ASSERT_EQ(4 + 8, pev->sizeData);
+  ASSERT_EQ(0, pev->pdata[0]); // Sensor index
+  ASSERT_EQ(1, pev->pdata[3]); // Unit
+  pipe.release(pev);
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, Level2ToSlot)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 2);
+
+  uint8_t data[] = { 0x11, 0x22, 0x33, 0x44 };
+  vscpEvent drv;
+  memset(&drv, 0, sizeof(drv));
+  drv.vscp_class = VSCP_CLASS2_INFORMATION;
+  drv.vscp_type  = 7;
+  drv.GUID[0]    = 0x55;
+  drv.pdata      = data;
+  drv.sizeData   = sizeof(data);
+
+  vscpEvent *pev = pipe.acquire();
+  uint8_t *pbuf  = pev->pdata;
+  ASSERT_TRUE(level2ToSlot(pev, &drv));
+
+  // Data is copied into the slot, the driver buffer is not taken over
+  ASSERT_EQ(pbuf, pev->pdata);
+  ASSERT_EQ(0, memcmp(data, pev->pdata, sizeof(data)));
+  ASSERT_EQ(VSCP_CLASS2_INFORMATION, pev->vscp_class);
+  ASSERT_EQ(7, pev->vscp_type);
+  ASSERT_EQ(0x55, pev->GUID[0]);
+  ASSERT_EQ(sizeof(data), pev->sizeData);
+
+  // Zero timestamp is set
+  ASSERT_NE(0, pev->timestamp);
+
+  // Given timestamp is kept
+  drv.timestamp = 42;
+  ASSERT_TRUE(level2ToSlot(pev, &drv));
+  ASSERT_EQ(42, pev->timestamp);
+
+  // No data
+  drv.pdata    = nullptr;
+  drv.sizeData = 0;
+  ASSERT_TRUE(level2ToSlot(pev, &drv));
+  ASSERT_EQ(pbuf, pev->pdata);
+  ASSERT_EQ(0, pev->sizeData);
+
+  pipe.release(pev);
+}
+
+//-----------------------------------------------------------------------------
+TEST(DevicePipe, Level2ToSlotOversize)
+{
+  Sink sink;
+  CDevicePipe pipe("test", [&sink](vscpEvent *pev) { return sink.publish(pev); }, 2);
+
+  std::vector<uint8_t> data(VSCP_MAX_DATA + 1, 0xaa);
+  vscpEvent drv;
+  memset(&drv, 0, sizeof(drv));
+  drv.pdata    = data.data();
+  drv.sizeData = (uint16_t) data.size();
+
+  vscpEvent *pev = pipe.acquire();
+  ASSERT_FALSE(level2ToSlot(pev, &drv));
+  pipe.release(pev);
+}
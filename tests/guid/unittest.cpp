@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 #include <string>
 #include <cstring>
+#include <random>
 
 #include "guid.h"
 
@@ -757,6 +758,395 @@ TEST(Cguid, MultiByteHexValues)
     EXPECT_EQ(0x0C, guid.getAt(15));
 }
 
+//-----------------------------------------------------------------------------
+// Fast path equivalence
+//-----------------------------------------------------------------------------
+
+// The parser as it was before the fast path was added. Every input must
+// give the same GUID from getFromString as from this one.
+
+static bool ref_isHexDigit(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+static uint8_t ref_hexToVal(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return 0;
+}
+
+static int ref_countHexDigits(const char *p) {
+    int count = 0;
+    while (ref_isHexDigit(*p)) {
+        count++;
+        p++;
+    }
+    return count;
+}
+
+static uint32_t ref_parseHexValue(const char **pp, int maxDigits) {
+    uint32_t value = 0;
+    int count = 0;
+    const char *p = *pp;
+    while (ref_isHexDigit(*p) && count < maxDigits) {
+        value = (value << 4) | ref_hexToVal(*p);
+        p++;
+        count++;
+    }
+    *pp = p;
+    return value;
+}
+
+static bool ref_isUuidFormat(const char *p) {
+    int hexCount = ref_countHexDigits(p);
+    if (hexCount >= 8) {
+        const char *sep = p + hexCount;
+        if (*sep == '-' || *sep == ':') {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void
+ref_getFromString(uint8_t *guid, const char *psz)
+{
+    const char *p = psz;
+    int guidIdx = 0;
+
+    // Initialize GUID to zeros
+    memset(guid, 0, 16);
+
+    // Skip leading whitespace
+    while (*p && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+
+    // Check for opening brace
+    if (*p == '{') {
+        p++;
+        while (*p && (*p == ' ' || *p == '\t')) {
+            p++;
+        }
+    }
+
+    // Empty string
+    if (!*p) {
+        return;
+    }
+
+    // Special case: "-" means all zeros, "-:" means leading zeros with trailing values
+    if (*p == '-') {
+        if (*(p + 1) == ':') {
+            p += 2;
+            uint8_t tempBytes[16];
+            int tempCount = 0;
+
+            while (*p && tempCount < 16) {
+                if (!ref_isHexDigit(*p)) break;
+                int hexLen = ref_countHexDigits(p);
+
+                if (hexLen <= 2) {
+                    tempBytes[tempCount++] = (uint8_t)ref_parseHexValue(&p, 2);
+                } else if (hexLen <= 4) {
+                    uint16_t val = (uint16_t)ref_parseHexValue(&p, 4);
+                    if (tempCount + 2 <= 16) {
+                        tempBytes[tempCount++] = (val >> 8) & 0xFF;
+                        tempBytes[tempCount++] = val & 0xFF;
+                    } else {
+                        tempBytes[tempCount++] = val & 0xFF;
+                    }
+                } else {
+                    int bytesToParse = (hexLen + 1) / 2;
+                    if (bytesToParse > 4) bytesToParse = 4;
+                    uint32_t val = (uint32_t)ref_parseHexValue(&p, bytesToParse * 2);
+                    for (int i = bytesToParse - 1; i >= 0 && tempCount + 1 <= 16; i--) {
+                        tempBytes[tempCount++] = (val >> (i * 8)) & 0xFF;
+                    }
+                }
+                if (*p == ':' || *p == '-' || *p == ',') p++;
+            }
+            int zeroCount = 16 - tempCount;
+            memcpy(guid + zeroCount, tempBytes, tempCount);
+            return;
+        }
+        if (!*(p + 1) || !ref_isHexDigit(*(p + 1))) {
+            return; // "-" alone means all zeros (already zeroed)
+        }
+    }
+
+    // Special case: "::" at start
+    if (p[0] == ':' && p[1] == ':') {
+        if (!p[2] || !ref_isHexDigit(p[2])) {
+            memset(guid, 0xFF, 16);
+            return;
+        }
+        p += 2;
+        uint8_t tempBytes[16];
+        int tempCount = 0;
+
+        while (*p && tempCount < 16) {
+            if (!ref_isHexDigit(*p)) break;
+            int hexLen = ref_countHexDigits(p);
+
+            if (hexLen <= 2) {
+                tempBytes[tempCount++] = (uint8_t)ref_parseHexValue(&p, 2);
+            } else if (hexLen <= 4) {
+                uint16_t val = (uint16_t)ref_parseHexValue(&p, 4);
+                if (tempCount + 2 <= 16) {
+                    tempBytes[tempCount++] = (val >> 8) & 0xFF;
+                    tempBytes[tempCount++] = val & 0xFF;
+                } else {
+                    tempBytes[tempCount++] = val & 0xFF;
+                }
+            } else {
+                int bytesToParse = (hexLen + 1) / 2;
+                if (bytesToParse > 4) bytesToParse = 4;
+                uint32_t val = (uint32_t)ref_parseHexValue(&p, bytesToParse * 2);
+                for (int i = bytesToParse - 1; i >= 0 && tempCount + 1 <= 16; i--) {
+                    tempBytes[tempCount++] = (val >> (i * 8)) & 0xFF;
+                }
+            }
+            if (*p == ':' || *p == '-' || *p == ',') p++;
+        }
+        int ffCount = 16 - tempCount;
+        if (ffCount > 0) memset(guid, 0xFF, ffCount);
+        memcpy(guid + ffCount, tempBytes, tempCount);
+        return;
+    }
+
+    // Check for UUID format
+    if (ref_isUuidFormat(p)) {
+        int segments[] = {8, 4, 4, 4, 12};
+        int bytePos = 0;
+        for (int seg = 0; seg < 5 && bytePos < 16; seg++) {
+            int expectedHex = segments[seg];
+            int hexCount = ref_countHexDigits(p);
+            if (hexCount < expectedHex) return;
+            int bytesInSegment = expectedHex / 2;
+            for (int i = 0; i < bytesInSegment && bytePos < 16; i++) {
+                uint8_t hi = ref_hexToVal(*p++);
+                uint8_t lo = ref_hexToVal(*p++);
+                guid[bytePos++] = (hi << 4) | lo;
+            }
+            if (*p == '-' || *p == ':' || *p == ',') p++;
+        }
+        return;
+    }
+
+    // Standard colon-separated format
+    while (*p && guidIdx < 16) {
+        if (!ref_isHexDigit(*p)) break;
+        int hexLen = ref_countHexDigits(p);
+
+        if (hexLen <= 2) {
+            guid[guidIdx++] = (uint8_t)ref_parseHexValue(&p, 2);
+        } else if (hexLen <= 4) {
+            uint16_t val = (uint16_t)ref_parseHexValue(&p, 4);
+            if (guidIdx + 1 < 16) {
+                guid[guidIdx++] = (val >> 8) & 0xFF;
+                guid[guidIdx++] = val & 0xFF;
+            } else {
+                guid[guidIdx++] = val & 0xFF;
+            }
+        } else {
+            int bytesToParse = (hexLen + 1) / 2;
+            if (bytesToParse > (16 - guidIdx)) bytesToParse = 16 - guidIdx;
+            for (int i = 0; i < bytesToParse && guidIdx < 16; i++) {
+                uint8_t hi = ref_hexToVal(*p++);
+                uint8_t lo = ref_isHexDigit(*p) ? ref_hexToVal(*p++) : 0;
+                guid[guidIdx++] = (hi << 4) | lo;
+            }
+        }
+        if (guidIdx < 16 && (*p == ':' || *p == '-' || *p == ',')) p++;
+    }
+}
+
+static const char fuzzChars[] = "0123456789ABCDEFabcdefgG:-,{} \t";
+
+// Random GUID on standard form, with random case and sometimes
+// decorated with braces, white space or trailing characters
+static std::string
+randomGuidString(std::mt19937 &rng)
+{
+    uint8_t guid[16];
+    for (int i = 0; i < 16; i++) {
+        guid[i] = (uint8_t)rng();
+    }
+
+    char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+    cguid::writeString(buf, guid);
+    std::string str(buf);
+
+    for (size_t i = 0; i < str.length(); i++) {
+        if ((rng() & 1) && isupper((unsigned char)str[i])) {
+            str[i] = (char)tolower((unsigned char)str[i]);
+        }
+    }
+
+    switch (rng() % 8) {
+        case 0:
+            str = "{" + str + "}";
+            break;
+        case 1:
+            str = " \t" + str;
+            break;
+        case 2:
+            str += fuzzChars[rng() % (sizeof(fuzzChars) - 1)];
+            break;
+        case 3:
+            str = str.substr(0, rng() % str.length());
+            break;
+        default:
+            break;
+    }
+
+    return str;
+}
+
+// Random GUID on one of the other accepted forms
+static std::string
+randomOtherString(std::mt19937 &rng)
+{
+    static const char *prefix[] = { "-", "-:", "::", "{", " ", "" };
+    std::string str = prefix[rng() % 6];
+
+    int cnt = rng() % 20;
+    for (int i = 0; i < cnt; i++) {
+        int digits = 1 + rng() % 9;
+        for (int j = 0; j < digits; j++) {
+            str += "0123456789abcdefABCDEF"[rng() % 22];
+        }
+        str += ":-,"[rng() % 3];
+    }
+
+    return str;
+}
+
+// Random change of a few characters
+static void
+mutate(std::mt19937 &rng, std::string &str)
+{
+    int cnt = 1 + rng() % 3;
+    for (int i = 0; i < cnt; i++) {
+        char c = (rng() % 8) ? fuzzChars[rng() % (sizeof(fuzzChars) - 1)] : (char)rng();
+        if (str.empty() || (0 == rng() % 4)) {
+            str.insert(str.begin() + (str.empty() ? 0 : rng() % str.length()), c);
+        }
+        else if (0 == rng() % 4) {
+            str.erase(rng() % str.length(), 1);
+        }
+        else {
+            str[rng() % str.length()] = c;
+        }
+    }
+}
+
+static void
+expectSameAsReference(const std::string &str)
+{
+    uint8_t ref[16];
+    ref_getFromString(ref, str.c_str());
+
+    // Start from garbage so bytes that are not written show up
+    cguid guid("FF:FF:FF:FF:FF:FF:FF:FF:FF:FF:FF:FF:FF:FF:FF:FF");
+    guid.getFromString(str);
+    ASSERT_EQ(0, memcmp(ref, guid.getGUID(), 16)) << "Input: '" << str << "'";
+
+    guid.getFromString(str.c_str());
+    ASSERT_EQ(0, memcmp(ref, guid.getGUID(), 16)) << "Input: '" << str << "'";
+}
+
+TEST(Cguid, FastPathParse)
+{
+    uint8_t guid[16];
+    memset(guid, 0x55, sizeof(guid));
+
+    EXPECT_TRUE(cguid::parseString(guid, "FF:ee:DD:cc:BB:aa:99:88:77:66:55:44:33:22:11:00"));
+    EXPECT_EQ(0xFF, guid[0]);
+    EXPECT_EQ(0xEE, guid[1]);
+    EXPECT_EQ(0x00, guid[15]);
+
+    // Not on standard form, left to the full parser
+    memset(guid, 0x55, sizeof(guid));
+    EXPECT_FALSE(cguid::parseString(guid, "FF:EE:DD:CC:BB:AA:99:88:77:66:55:44:33:22:11:0"));
+    EXPECT_FALSE(cguid::parseString(guid, "FF:EE:DD:CC:BB:AA:99:88:77:66:55:44:33:22:11:001"));
+    EXPECT_FALSE(cguid::parseString(guid, "FF-EE:DD:CC:BB:AA:99:88:77:66:55:44:33:22:11:00"));
+    EXPECT_FALSE(cguid::parseString(guid, "{FF:EE:DD:CC:BB:AA:99:88:77:66:55:44:33:22:11:00}"));
+    EXPECT_FALSE(cguid::parseString(guid, "FFEEDDCC-BBAA-9988-7766-554433221100"));
+    EXPECT_FALSE(cguid::parseString(guid, "Fg:EE:DD:CC:BB:AA:99:88:77:66:55:44:33:22:11:00"));
+    EXPECT_FALSE(cguid::parseString(guid, ""));
+    EXPECT_FALSE(cguid::parseString(guid, NULL));
+    EXPECT_EQ(0x55, guid[0]);
+
+    // Trailing characters that are not hex digits are fine
+    EXPECT_TRUE(cguid::parseString(guid, "FF:EE:DD:CC:BB:AA:99:88:77:66:55:44:33:22:11:00}"));
+}
+
+TEST(Cguid, FastPathFormat)
+{
+    uint8_t data[16] = { 0x00, 0x01, 0x0A, 0x10, 0x5F, 0x99, 0xA0, 0xAF,
+                         0xB7, 0xC3, 0xD4, 0xE5, 0xF0, 0xFE, 0xFF, 0x7E };
+    cguid guid(data);
+
+    char buf[VSCP_GUID_STRING_BUFFER_SIZE];
+    memset(buf, 'x', sizeof(buf));
+    EXPECT_STREQ("00:01:0A:10:5F:99:A0:AF:B7:C3:D4:E5:F0:FE:FF:7E", guid.toString(buf));
+    EXPECT_EQ(VSCP_GUID_STRING_LENGTH, (int)strlen(buf));
+
+    std::string str;
+    guid.toString(str);
+    EXPECT_EQ(std::string(buf), str);
+
+    // Round trip random GUIDs
+    std::mt19937 rng(4711);
+    for (int i = 0; i < 10000; i++) {
+        uint8_t in[16], out[16];
+        for (int j = 0; j < 16; j++) {
+            in[j] = (uint8_t)rng();
+        }
+        cguid::writeString(buf, in);
+        ASSERT_TRUE(cguid::parseString(out, buf));
+        ASSERT_EQ(0, memcmp(in, out, 16));
+    }
+}
+
+TEST(Cguid, ShortFormsStopAtSixteenBytes)
+{
+    // Four digits when only one byte is left
+    cguid guid("-:01:02:03:04:05:06:07:08:09:0A:0B:0C:0D:0E:0F:ABCD");
+    EXPECT_EQ(0x01, guid.getAt(0));
+    EXPECT_EQ(0x0F, guid.getAt(14));
+    EXPECT_EQ(0xCD, guid.getAt(15));
+    expectSameAsReference("-:01:02:03:04:05:06:07:08:09:0A:0B:0C:0D:0E:0F:ABCD");
+
+    guid.getFromString("::01:02:03:04:05:06:07:08:09:0A:0B:0C:0D:0E:0F:ABCD");
+    EXPECT_EQ(0x01, guid.getAt(0));
+    EXPECT_EQ(0xCD, guid.getAt(15));
+    expectSameAsReference("::01:02:03:04:05:06:07:08:09:0A:0B:0C:0D:0E:0F:ABCD");
+
+    // Wider values are cut at the last byte
+    expectSameAsReference("-:0102:0304:0506:0708:090A:0B0C:0D0E:0F:ABCDEF12");
+    expectSameAsReference("::0102:0304:0506:0708:090A:0B0C:0D0E:0F:ABCDEF12");
+}
+
+TEST(Cguid, FastPathMatchesReference)
+{
+    std::mt19937 rng(1234);
+
+    for (int i = 0; i < 100000; i++) {
+        std::string str = (rng() & 1) ? randomGuidString(rng) : randomOtherString(rng);
+        if (0 == rng() % 3) {
+            mutate(rng, str);
+        }
+        expectSameAsReference(str);
+        if (HasFatalFailure()) {
+            return;
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Main
 //-----------------------------------------------------------------------------
@@ -0,0 +1,81 @@
+#!/bin/bash
+#
+# Set up a local test bench and run vscp-loadgen against it
+#
+#   - virtual CAN interface (vcan0), needs root or CAP_NET_ADMIN
+#   - local mosquitto broker on 127.0.0.1:18830
+#   - vscpd or vscphubd started with the given configuration
+#
+# Usage: run-loadgen.sh -d <daemon> -c <daemon config> [-l loadgen.json] [-- loadgen options]
+#
+#   run-loadgen.sh -d /usr/sbin/vscpd -c vscpd-loadgen.json -- -t 30 -r 5000 -o result.json
+#
+
+DAEMON=""
+DAEMONCFG=""
+LOADGENCFG="$(dirname "$0")/loadgen.json"
+LOADGEN="${LOADGEN:-./vscp-loadgen}"
+VCAN="${VCAN:-vcan0}"
+MQTTPORT="${MQTTPORT:-18830}"
+
+while getopts "d:c:l:h" opt; do
+  case $opt in
+    d) DAEMON="$OPTARG" ;;
+    c) DAEMONCFG="$OPTARG" ;;
+    l) LOADGENCFG="$OPTARG" ;;
+    *) sed -n '2,13p' "$0"; exit 1 ;;
+  esac
+done
+shift $((OPTIND - 1))
+[ "$1" = "--" ] && shift
+
+WORKDIR=$(mktemp -d /tmp/vscp-loadgen.XXXXXX)
+PIDS=""
+
+cleanup() {
+  for pid in $PIDS; do
+    kill "$pid" 2>/dev/null
+  done
+  wait 2>/dev/null
+  rm -rf "$WORKDIR"
+}
+trap cleanup EXIT
+
+# Virtual CAN
+if ! ip link show "$VCAN" >/dev/null 2>&1; then
+  modprobe vcan 2>/dev/null
+  ip link add dev "$VCAN" type vcan || echo "Unable to create $VCAN, CAN senders will fail"
+fi
+ip link set up "$VCAN" 2>/dev/null
+
+# Local broker
+cat > "$WORKDIR/mosquitto.conf" <<MQTTCFG
+listener $MQTTPORT 127.0.0.1
+allow_anonymous true
+persistence false
+MQTTCFG
+mosquitto -c "$WORKDIR/mosquitto.conf" >"$WORKDIR/mosquitto.log" 2>&1 &
+PIDS="$PIDS $!"
+MQTTPID=$!
+
+# Daemon under test
+PIDOPTS="-p $MQTTPID"
+if [ -n "$DAEMON" ]; then
+  "$DAEMON" -s -c "$DAEMONCFG" >"$WORKDIR/daemon.log" 2>&1 &
+  DAEMONPID=$!
+  PIDS="$PIDS $DAEMONPID"
+  PIDOPTS="$PIDOPTS -p $DAEMONPID"
+fi
+
+# Give broker and daemon time to open their ports
+sleep 2
+
+"$LOADGEN" -c "$LOADGENCFG" $PIDOPTS "$@"
+RV=$?
+
+if [ -n "$DAEMON" ] && ! kill -0 "$DAEMONPID" 2>/dev/null; then
+  echo "Daemon exited during the run, log follows"
+  cat "$WORKDIR/daemon.log"
+fi
+
+exit $RV
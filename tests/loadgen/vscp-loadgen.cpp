@@ -0,0 +1,611 @@
+// vscp-loadgen.cpp
+//
+// End-to-end load generator and latency harness for vscpd/vscphubd
+//
+// Sends events through one set of clients (tcp, udp, ws1, ws2, mqtt,
+// socketcan, shm) and receives them on another. Each load event carries
+// its send time so the latency from send to receive can be measured
+// over any path through the daemon, for example CAN frame in on vcan
+// to MQTT publish out, or tcp/ip send to another tcp/ip client.
+//
+//   vscp-loadgen -c loadgen.json [-t seconds] [-r rate] [-o result.json] [-p pid]
+//
+// See README.md in this folder.
+//
+
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <vscp-client-base.h>
+#include <vscp-client-mqtt.h>
+#include <vscp-client-shm.h>
+#include <vscp-client-socketcan.h>
+#include <vscp-client-tcp.h>
+#include <vscp-client-udp.h>
+#include <vscp-client-ws1.h>
+#include <vscp-client-ws2.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+// Marks a load event in data[0], the low bits hold the sender id
+#define LOADGEN_MARKER      0x80
+#define LOADGEN_MAX_SENDERS 127
+
+static volatile bool gbStop = false;
+
+// Monotonic time at start of run, all payload times are relative to this
+static uint64_t gStartTime;
+
+// Options
+static uint16_t gClass  = VSCP_CLASS1_INFORMATION;
+static uint16_t gType   = VSCP_TYPE_INFORMATION_GENERAL;
+static double gDuration = 10;   // seconds
+static double gWarmup   = 1;    // seconds, not measured
+static double gDrain    = 1;    // seconds to wait for events in flight
+static double gRate     = 1000; // events/second per sender, zero is as fast as possible
+
+// A sender or receiver
+struct loadClient {
+  std::string m_name;
+  std::string m_type;
+  bool m_bSender;
+  uint8_t m_id;
+  CVscpClient *m_pClient;
+  std::thread *m_pthread;
+
+  // Sender statistics
+  std::atomic<uint64_t> m_cntSent;
+  std::atomic<uint64_t> m_cntSendError;
+
+  // Receiver statistics, latencies in ns
+  std::mutex m_mutex;
+  std::vector<uint64_t> m_latency;
+  uint64_t m_cntReceived;
+  uint64_t m_cntForeign;
+
+  loadClient()
+  {
+    m_bSender      = false;
+    m_id           = 0;
+    m_pClient      = NULL;
+    m_pthread      = NULL;
+    m_cntSent      = 0;
+    m_cntSendError = 0;
+    m_cntReceived  = 0;
+    m_cntForeign   = 0;
+  }
+};
+
+// CPU and memory use of a process
+struct procStat {
+  pid_t m_pid;
+  std::string m_name;
+  uint64_t m_ticksStart;
+  uint64_t m_ticksEnd;
+  uint64_t m_rssKb;
+  uint64_t m_hwmKb;
+
+  procStat(pid_t pid = 0)
+  {
+    m_pid        = pid;
+    m_ticksStart = 0;
+    m_ticksEnd   = 0;
+    m_rssKb      = 0;
+    m_hwmKb      = 0;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// nowNs
+//
+
+static uint64_t
+nowNs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void
+sighandler(int sig)
+{
+  gbStop = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// createClient
+//
+
+static CVscpClient *
+createClient(const std::string &type)
+{
+  if ("tcp" == type) {
+    return new vscpClientTcp;
+  }
+  else if ("udp" == type) {
+    return new vscpClientUdp;
+  }
+  else if ("ws1" == type) {
+    return new vscpClientWs1;
+  }
+  else if ("ws2" == type) {
+    return new vscpClientWs2;
+  }
+  else if ("mqtt" == type) {
+    return new vscpClientMqtt;
+  }
+  else if ("socketcan" == type) {
+    return new vscpClientSocketCan;
+  }
+  else if ("shm" == type) {
+    return new vscpClientShm;
+  }
+  return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// receiveCallback
+//
+// Load events are level I sized so they fit a CAN frame
+//
+//   data[0]    LOADGEN_MARKER | sender id
+//   data[1..7] send time, ns since start of run, MSB first
+//
+// The send time is also in timestamp_ns (wall clock) but the daemon and
+// CAN restamp that on the way, so latency is taken from the payload.
+//
+
+static void
+receiveCallback(vscpEventEx &ex, void *pobj)
+{
+  uint64_t now      = nowNs() - gStartTime;
+  loadClient *pload = (loadClient *) pobj;
+
+  if ((gClass != ex.vscp_class) || (gType != ex.vscp_type) || (8 != ex.sizeData) ||
+      !(ex.data[0] & LOADGEN_MARKER)) {
+    std::lock_guard<std::mutex> lock(pload->m_mutex);
+    pload->m_cntForeign++;
+    return;
+  }
+
+  uint64_t sent = 0;
+  for (int i = 1; i < 8; i++) {
+    sent = (sent << 8) | ex.data[i];
+  }
+
+  // Events sent during warm up are not measured
+  if (sent < (uint64_t) (gWarmup * 1e9)) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(pload->m_mutex);
+  pload->m_cntReceived++;
+  pload->m_latency.push_back((now > sent) ? (now - sent) : 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// senderThread
+//
+
+static void
+senderThread(loadClient *pload)
+{
+  vscpEventEx ex;
+  memset(&ex, 0, sizeof(ex));
+  ex.head       = VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  ex.vscp_class = gClass;
+  ex.vscp_type  = gType;
+  ex.GUID[15]   = pload->m_id;
+  ex.sizeData   = 8;
+  ex.data[0]    = LOADGEN_MARKER | pload->m_id;
+
+  uint64_t interval = (gRate > 0) ? (uint64_t) (1e9 / gRate) : 0;
+  uint64_t end      = (uint64_t) ((gWarmup + gDuration) * 1e9);
+  uint64_t next     = 0;
+
+  while (!gbStop) {
+
+    uint64_t now = nowNs() - gStartTime;
+    if (now >= end) {
+      break;
+    }
+
+    if (interval && (now < next)) {
+      uint64_t wakeup = gStartTime + next;
+      struct timespec ts;
+      ts.tv_sec  = wakeup / 1000000000ULL;
+      ts.tv_nsec = wakeup % 1000000000ULL;
+      clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+      now = nowNs() - gStartTime;
+    }
+    next += interval;
+
+    for (int i = 7; i > 0; i--) {
+      ex.data[i] = now & 0xff;
+      now >>= 8;
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ex.timestamp_ns = (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+
+    if (VSCP_ERROR_SUCCESS == pload->m_pClient->send(ex)) {
+      pload->m_cntSent++;
+    }
+    else {
+      pload->m_cntSendError++;
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// readProcStat
+//
+
+static bool
+readProcStat(pid_t pid, uint64_t &ticks, uint64_t &rssKb, uint64_t &hwmKb)
+{
+  char path[64];
+  snprintf(path, sizeof(path), "/proc/%d/stat", (int) pid);
+  FILE *fp = fopen(path, "r");
+  if (NULL == fp) {
+    return false;
+  }
+
+  // Skip past the command name, it may contain spaces
+  char buf[1024];
+  size_t n = fread(buf, 1, sizeof(buf) - 1, fp);
+  fclose(fp);
+  buf[n]  = 0;
+  char *p = strrchr(buf, ')');
+  if (NULL == p) {
+    return false;
+  }
+
+  // Fields after the name start with state (field 3), utime and stime are 14 and 15
+  unsigned long utime = 0, stime = 0;
+  if (2 != sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &utime, &stime)) {
+    return false;
+  }
+  ticks = utime + stime;
+
+  snprintf(path, sizeof(path), "/proc/%d/status", (int) pid);
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (0 == line.find("VmRSS:")) {
+      rssKb = strtoull(line.c_str() + 6, NULL, 10);
+    }
+    else if (0 == line.find("VmHWM:")) {
+      hwmKb = strtoull(line.c_str() + 6, NULL, 10);
+    }
+  }
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// percentile
+//
+
+static double
+percentile(const std::vector<uint64_t> &sorted, double p)
+{
+  if (sorted.empty()) {
+    return 0;
+  }
+  size_t idx = (size_t) (p * sorted.size());
+  if (idx >= sorted.size()) {
+    idx = sorted.size() - 1;
+  }
+  return sorted[idx] / 1000.0; // us
+}
+
+static void
+help(void)
+{
+  fprintf(stderr, "Usage: vscp-loadgen -c config.json [options]\n");
+  fprintf(stderr, "  -c  JSON configuration file with senders and receivers\n");
+  fprintf(stderr, "  -t  Measured duration in seconds (default 10)\n");
+  fprintf(stderr, "  -r  Events per second per sender, 0 is as fast as possible (default 1000)\n");
+  fprintf(stderr, "  -o  Write the result as JSON to this file\n");
+  fprintf(stderr, "  -p  Report CPU and memory use of this process, may be repeated\n");
+  fprintf(stderr, "  -h  This help\n");
+}
+
+int
+main(int argc, char **argv)
+{
+  int opt;
+  std::string strcfgfile;
+  std::string stroutfile;
+  std::vector<procStat> procs;
+
+  double duration = -1;
+  double rate     = -1;
+
+  while ((opt = getopt(argc, argv, "c:t:r:o:p:h")) != -1) {
+
+    switch (opt) {
+
+      case 'c':
+        strcfgfile = optarg;
+        break;
+
+      case 't':
+        duration = atof(optarg);
+        break;
+
+      case 'r':
+        rate = atof(optarg);
+        break;
+
+      case 'o':
+        stroutfile = optarg;
+        break;
+
+      case 'p':
+        procs.push_back(procStat(atoi(optarg)));
+        break;
+
+      case 'h':
+      default:
+        help();
+        return (('h' == opt) ? 0 : 1);
+    }
+  }
+
+  if (strcfgfile.empty()) {
+    help();
+    return 1;
+  }
+
+  json j;
+  try {
+    std::ifstream in(strcfgfile);
+    in >> j;
+  }
+  catch (...) {
+    fprintf(stderr, "Unable to parse configuration file %s\n", strcfgfile.c_str());
+    return 1;
+  }
+
+  gClass    = j.value("class", gClass);
+  gType     = j.value("type", gType);
+  gDuration = j.value("duration", gDuration);
+  gWarmup   = j.value("warmup", gWarmup);
+  gDrain    = j.value("drain", gDrain);
+  gRate     = j.value("rate", gRate);
+  if (duration >= 0) {
+    gDuration = duration;
+  }
+  if (rate >= 0) {
+    gRate = rate;
+  }
+
+  // Set up senders and receivers, "count" gives that many clients of
+  // the same configuration
+  std::vector<loadClient *> clients;
+  uint8_t idSender = 1;
+  for (const char *role : { "receivers", "senders" }) {
+
+    if (!j.contains(role) || !j[role].is_array()) {
+      continue;
+    }
+
+    for (auto &jc : j[role]) {
+
+      std::string type = jc.value("type", "");
+      std::string name = jc.value("name", type);
+      int count        = jc.value("count", 1);
+      std::string cfg  = jc.contains("config") ? jc["config"].dump() : "{}";
+
+      for (int i = 0; i < count; i++) {
+
+        loadClient *pload = new loadClient;
+        pload->m_type     = type;
+        pload->m_name     = (count > 1) ? vscp_str_format("%s-%d", name.c_str(), i) : name;
+        pload->m_bSender  = (0 == strcmp(role, "senders"));
+        pload->m_pClient  = createClient(type);
+
+        if (NULL == pload->m_pClient) {
+          fprintf(stderr, "Unknown client type '%s' for %s\n", type.c_str(), pload->m_name.c_str());
+          return 1;
+        }
+
+        if (!pload->m_pClient->initFromJson(cfg)) {
+          fprintf(stderr, "Invalid configuration for %s\n", pload->m_name.c_str());
+          return 1;
+        }
+
+        if (pload->m_bSender) {
+          if (idSender > LOADGEN_MAX_SENDERS) {
+            fprintf(stderr, "At most %d senders\n", LOADGEN_MAX_SENDERS);
+            return 1;
+          }
+          pload->m_id = idSender++;
+        }
+        else {
+          pload->m_pClient->setCallbackEx(receiveCallback, pload);
+        }
+
+        clients.push_back(pload);
+      }
+    }
+  }
+
+  if (1 == idSender) {
+    fprintf(stderr, "No senders configured\n");
+    return 1;
+  }
+
+  signal(SIGINT, sighandler);
+  signal(SIGTERM, sighandler);
+  signal(SIGPIPE, SIG_IGN);
+
+  // Receivers are connected first so nothing is missed
+  for (size_t i = 0; i < clients.size(); i++) {
+    if (VSCP_ERROR_SUCCESS != clients[i]->m_pClient->connect()) {
+      fprintf(stderr, "Failed to connect %s\n", clients[i]->m_name.c_str());
+      return 1;
+    }
+  }
+
+  procs.push_back(procStat(getpid()));
+
+  long ticksPerSec = sysconf(_SC_CLK_TCK);
+  for (size_t i = 0; i < procs.size(); i++) {
+    procs[i].m_name = vscp_str_format("%d", (int) procs[i].m_pid);
+    readProcStat(procs[i].m_pid, procs[i].m_ticksStart, procs[i].m_rssKb, procs[i].m_hwmKb);
+  }
+  procs.back().m_name = "vscp-loadgen";
+
+  fprintf(stderr,
+          "Running %.1fs (+%.1fs warm up) at %.0f events/s per sender\n",
+          gDuration,
+          gWarmup,
+          gRate);
+
+  gStartTime = nowNs();
+  for (size_t i = 0; i < clients.size(); i++) {
+    if (clients[i]->m_bSender) {
+      clients[i]->m_pthread = new std::thread(senderThread, clients[i]);
+    }
+  }
+
+  for (size_t i = 0; i < clients.size(); i++) {
+    if (NULL != clients[i]->m_pthread) {
+      clients[i]->m_pthread->join();
+      delete clients[i]->m_pthread;
+      clients[i]->m_pthread = NULL;
+    }
+  }
+
+  double elapsed = (nowNs() - gStartTime) / 1e9 - gWarmup;
+  if (elapsed <= 0) {
+    elapsed = 1e-9;
+  }
+
+  // Let events in flight arrive, CPU use is measured over the send period
+  for (size_t i = 0; i < procs.size(); i++) {
+    readProcStat(procs[i].m_pid, procs[i].m_ticksEnd, procs[i].m_rssKb, procs[i].m_hwmKb);
+  }
+  usleep((useconds_t) (gDrain * 1e6));
+
+  for (size_t i = 0; i < clients.size(); i++) {
+    clients[i]->m_pClient->disconnect();
+  }
+
+  // Report
+  json jr;
+  jr["duration"] = elapsed;
+  jr["rate"]     = gRate;
+
+  uint64_t totalSent = 0;
+  printf("\n%-24s %10s %10s %12s\n", "Sender", "Sent", "Errors", "Events/s");
+  for (size_t i = 0; i < clients.size(); i++) {
+    loadClient *pload = clients[i];
+    if (!pload->m_bSender) {
+      continue;
+    }
+    totalSent += pload->m_cntSent;
+    printf("%-24s %10llu %10llu %12.0f\n",
+           pload->m_name.c_str(),
+           (unsigned long long) pload->m_cntSent,
+           (unsigned long long) pload->m_cntSendError,
+           pload->m_cntSent / (elapsed + gWarmup));
+
+    json js;
+    js["name"]   = pload->m_name;
+    js["type"]   = pload->m_type;
+    js["sent"]   = pload->m_cntSent.load();
+    js["errors"] = pload->m_cntSendError.load();
+    jr["senders"].push_back(js);
+  }
+
+  printf("\n%-24s %10s %10s %10s %10s %10s %10s\n", "Receiver", "Received", "Events/s", "p50 us", "p99 us", "p999 us", "max us");
+  for (size_t i = 0; i < clients.size(); i++) {
+    loadClient *pload = clients[i];
+    if (pload->m_bSender) {
+      continue;
+    }
+
+    std::lock_guard<std::mutex> lock(pload->m_mutex);
+    std::sort(pload->m_latency.begin(), pload->m_latency.end());
+    double p50  = percentile(pload->m_latency, 0.5);
+    double p99  = percentile(pload->m_latency, 0.99);
+    double p999 = percentile(pload->m_latency, 0.999);
+    double max  = pload->m_latency.empty() ? 0 : pload->m_latency.back() / 1000.0;
+    printf("%-24s %10llu %10.0f %10.1f %10.1f %10.1f %10.1f\n",
+           pload->m_name.c_str(),
+           (unsigned long long) pload->m_cntReceived,
+           pload->m_cntReceived / elapsed,
+           p50,
+           p99,
+           p999,
+           max);
+
+    json js;
+    js["name"]     = pload->m_name;
+    js["type"]     = pload->m_type;
+    js["received"] = pload->m_cntReceived;
+    js["foreign"]  = pload->m_cntForeign;
+    js["rate"]     = pload->m_cntReceived / elapsed;
+    js["p50_us"]   = p50;
+    js["p99_us"]   = p99;
+    js["p999_us"]  = p999;
+    js["max_us"]   = max;
+    jr["receivers"].push_back(js);
+  }
+
+  printf("\n%-24s %10s %10s %10s\n", "Process", "CPU %", "RSS kB", "Peak kB");
+  for (size_t i = 0; i < procs.size(); i++) {
+    procStat &ps = procs[i];
+    double cpu   = 100.0 * (ps.m_ticksEnd - ps.m_ticksStart) / ticksPerSec / (elapsed + gWarmup);
+    printf("%-24s %10.1f %10llu %10llu\n",
+           ps.m_name.c_str(),
+           cpu,
+           (unsigned long long) ps.m_rssKb,
+           (unsigned long long) ps.m_hwmKb);
+
+    json js;
+    js["name"]    = ps.m_name;
+    js["pid"]     = ps.m_pid;
+    js["cpu"]     = cpu;
+    js["rss_kb"]  = ps.m_rssKb;
+    js["peak_kb"] = ps.m_hwmKb;
+    jr["processes"].push_back(js);
+  }
+
+  printf("\nTotal sent %llu\n", (unsigned long long) totalSent);
+
+  if (!stroutfile.empty()) {
+    std::ofstream out(stroutfile);
+    out << jr.dump(2) << std::endl;
+  }
+
+  for (size_t i = 0; i < clients.size(); i++) {
+    delete clients[i]->m_pClient;
+    delete clients[i];
+  }
+
+  return 0;
+}
@@ -268,25 +268,11 @@ TEST(ClientList, setPassword)
     CUserItem item;
 
     item.setUserName("MrKoll");
-    item.setPassword("Very secret this password is");
-
-    if (0) {
-        char buf[1024];
-        uint8_t salt[256];
-        uint8_t hash[256];
-        std::string calcHash;
-        printf("getPassword: %s\n", item.getPassword().c_str());
-
-        // Use same salt gives same hash.
-        vscp_makePasswordHash(calcHash,
-                              "MrKoll:Very secret this password is",
-                              salt);
-        printf("calcHash: %s\n", calcHash.c_str());
-    }
+    item.setPasswordFromClearText("Very secret this password is");
 
     ASSERT_EQ(true,
-              vscp_isPasswordValid(item.getPassword(),
-                                   "MrKoll:Very secret this password is"));
+              vscp_isPasswordValid(item.getPasswordHash(),
+                                   "Very secret this password is"));
 }
 
 //-----------------------------------------------------------------------------
@@ -408,6 +394,177 @@ TEST(ClientList, isUserAllowedToSendEvent_level1_protocol)
     ASSERT_EQ(true, item.isUserAllowedToSendEvent(0,20));
 }
 
+//-----------------------------------------------------------------------------
+TEST(ClientList, isUserAllowedToSendEvent_wildcard_all)
+{
+    CUserItem item;
+
+    item.setUserRightsFromString("user");
+
+    // Empty list allows everything
+    ASSERT_EQ(true, item.isUserAllowedToSendEvent(1040,7));
+
+    ASSERT_EQ(true, item.addAllowedEvent("10:*"));
+    ASSERT_EQ(false, item.isUserAllowedToSendEvent(1040,7));
+
+    ASSERT_EQ(true, item.addAllowedEvent("*:*"));
+    ASSERT_EQ(true, item.isUserAllowedToSendEvent(1040,7));
+
+    // Class/type outside of the 16-bit range never matches a list entry
+    item.setAllowedEventsFromString("10:*");
+    ASSERT_EQ(false, item.isUserAllowedToSendEvent(0x1000a,6));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ClientList, isUserAllowedToSendEvent_recompiled_on_change)
+{
+    CUserItem item;
+    std::string str;
+
+    item.setUserRightsFromString("user");
+
+    item.setAllowedEventsFromString("10:*,1040:6");
+    ASSERT_EQ(2, item.getAllowedEventsCount());
+    ASSERT_EQ(true, item.isUserAllowedToSendEvent(10,1));
+    ASSERT_EQ(true, item.isUserAllowedToSendEvent(1040,6));
+
+    uint32_t generation = item.getPermissionGeneration();
+
+    // Replace "1040:6" with "1040:7"
+    ASSERT_EQ(true, item.setAllowedEvent(1, "1040:7"));
+    ASSERT_NE(generation, item.getPermissionGeneration());
+    ASSERT_EQ(false, item.isUserAllowedToSendEvent(1040,6));
+    ASSERT_EQ(true, item.isUserAllowedToSendEvent(1040,7));
+
+    // Replace the list
+    item.setAllowedEventsFromString("20:*");
+    ASSERT_EQ(false, item.isUserAllowedToSendEvent(10,1));
+    ASSERT_EQ(false, item.isUserAllowedToSendEvent(1040,7));
+    ASSERT_EQ(true, item.isUserAllowedToSendEvent(20,3));
+
+    // Cleared list allows everything again
+    item.clearAllowedEventList();
+    ASSERT_EQ(true, item.isUserAllowedToSendEvent(10,1));
+
+    // Rights changes also change the generation
+    generation = item.getPermissionGeneration();
+    item.setUserRights(0);
+    ASSERT_NE(generation, item.getPermissionGeneration());
+    ASSERT_EQ(false, item.isUserAllowedToSendEvent(10,1));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ClientList, isAllowedToSendEvent_cache)
+{
+    CUserItem user1;
+    CUserItem user2;
+    CClientItem client;
+
+    user1.setUserRightsFromString("user");
+    user1.setAllowedEventsFromString("10:*");
+    user2.setUserRightsFromString("user");
+
+    // No user, nothing allowed
+    ASSERT_EQ(false, client.isAllowedToSendEvent(10,1));
+
+    client.m_pUserItem = &user1;
+    ASSERT_EQ(true, client.isAllowedToSendEvent(10,1));
+    ASSERT_EQ(false, client.isAllowedToSendEvent(20,1));
+
+    // Same cache slot, different class/type
+    ASSERT_EQ(false, client.isAllowedToSendEvent(11,0));
+    ASSERT_EQ(true, client.isAllowedToSendEvent(10,1));
+    ASSERT_EQ(false, client.isAllowedToSendEvent(11,0));
+
+    // Cached decisions follow changes to the user
+    user1.setAllowedEventsFromString("20:*");
+    ASSERT_EQ(false, client.isAllowedToSendEvent(10,1));
+    ASSERT_EQ(true, client.isAllowedToSendEvent(20,1));
+
+    user1.setUserRights(0);
+    ASSERT_EQ(false, client.isAllowedToSendEvent(20,1));
+
+    // and to a new user on the connection
+    client.m_pUserItem = &user2;
+    ASSERT_EQ(true, client.isAllowedToSendEvent(10,1));
+    ASSERT_EQ(true, client.isAllowedToSendEvent(20,1));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ClientList, validateUser_pbkdf2)
+{
+    CUserItem item;
+
+    // Same hash as in the sample users.json (password 'secret')
+    item.setUserName("admin");
+    item.setPasswordHash("D35967DEE4CFFB214124DFEEA7778BB0;"
+                         "582BCA078604C925852CDDEE0A8475556DEAA6DC6EFB004A353094900C97D3DE");
+    ASSERT_EQ(VSCP_PASSWORD_HASH_TYPE_PBKDF2, item.getPasswordHashType());
+    ASSERT_EQ(true, item.validateUser("secret"));
+    ASSERT_EQ(false, item.validateUser("Secret"));
+    ASSERT_EQ(false, item.validateUser(""));
+
+    item.setPasswordFromClearText("Very secret this password is");
+    ASSERT_EQ(VSCP_PASSWORD_HASH_TYPE_PBKDF2, item.getPasswordHashType());
+    ASSERT_EQ(true, item.validateUser("Very secret this password is"));
+    ASSERT_EQ(false, item.validateUser("secret"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ClientList, validateUser_legacy_md5)
+{
+    CUserItem item;
+    char pw[33];
+
+    item.setUserName("MrKoll");
+
+    memset(pw, 0, sizeof(pw));
+    std::string combined = "MrKoll:secret";
+    vscp_md5(pw, (const unsigned char *)combined.c_str(), combined.length());
+
+    // Stored hash case should not matter
+    std::string hash = pw;
+    vscp_makeUpper(hash);
+    item.setPasswordHash(hash);
+
+    ASSERT_EQ(VSCP_PASSWORD_HASH_TYPE_MD5, item.getPasswordHashType());
+    ASSERT_EQ(true, item.validateUser("secret"));
+    ASSERT_EQ(false, item.validateUser("secret2"));
+
+    item.setPasswordHash("not a hash");
+    ASSERT_EQ(VSCP_PASSWORD_HASH_TYPE_UNKNOWN, item.getPasswordHashType());
+    ASSERT_EQ(false, item.validateUser("not a hash"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ClientList, validateUser_credential_cache)
+{
+    CUserList list;
+    std::string hash;
+
+    ASSERT_EQ(true, vscp_makePasswordHash(hash, "secret"));
+    ASSERT_EQ(true, list.addUser("user1", hash, "User One", "", NULL, "user"));
+
+    ASSERT_EQ(NULL, list.validateUser("nobody", "secret"));
+    ASSERT_EQ(NULL, list.validateUser("user1", "wrong"));
+
+    CUserItem *pUser = list.validateUser("user1", "secret");
+    ASSERT_NE((CUserItem *)NULL, pUser);
+
+    // Cached
+    ASSERT_EQ(pUser, list.validateUser("user1", "secret"));
+    ASSERT_EQ(NULL, list.validateUser("user1", "wrong"));
+
+    // Changed password invalidates the cached entry
+    pUser->setPasswordFromClearText("other");
+    ASSERT_EQ(NULL, list.validateUser("user1", "secret"));
+    ASSERT_EQ(pUser, list.validateUser("user1", "other"));
+
+    // Disabled cache still validates
+    list.setCredentialCache(0, 0);
+    ASSERT_EQ(pUser, list.validateUser("user1", "other"));
+}
+
 //-----------------------------------------------------------------------------
 int
 main(int argc, char** argv)
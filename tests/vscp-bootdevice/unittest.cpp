@@ -0,0 +1,451 @@
+///////////////////////////////////////////////////////////////////////////////
+// unittest.cpp
+//
+// Unit tests for the VSCP bootloader (CBootDevice_VSCP)
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+
+#ifdef WIN32
+#include <pch.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <crc.h>
+#include <guid.h>
+#include <vscp-bootdevice-vscp.h>
+#include <vscp-client-base.h>
+#include <vscphelper.h>
+
+// ============================================================================
+//  Simulated Level I nodes running the VSCP bootloader
+// ============================================================================
+
+// One simulated node. Block data is collected until a full block has
+// arrived and is written to memory on PROGRAM_BLOCK_DATA.
+struct BootNode {
+  uint8_t nickname    = 0;
+  uint32_t blockSize  = 64;
+  uint32_t numBlocks  = 16;
+  uint32_t nackBlock  = 0;  // Block and chunk index (from block start)
+  uint32_t nackChunk  = 0;  // that is NACK'ed
+  int nackCount       = 0;  // Number of times to NACK it
+  bool bDiscard       = false;
+  uint32_t block      = 0;
+  uint32_t chunkIndex = 0;
+  std::vector<uint8_t> buf;
+  std::vector<uint8_t> memory;
+  int nStartBlocks = 0;
+  bool bBootMode   = false;
+};
+
+// Client that the simulated nodes sit behind. Responses are queued
+// for receive()/receiveBlocking(). BLOCK_DATA, START_BLOCK and
+// PROGRAM_BLOCK_DATA carry no node address, so as on a real bus they
+// are taken by every node that is in boot mode.
+class BootBusClient : public CVscpClient {
+public:
+  BootBusClient() : CVscpClient() { m_type = CVscpClient::connType::NONE; }
+
+  void addNode(uint8_t nickname, uint32_t blockSize, uint32_t numBlocks)
+  {
+    BootNode node;
+    node.nickname  = nickname;
+    node.blockSize = blockSize;
+    node.numBlocks = numBlocks;
+    node.memory.assign(blockSize * numBlocks, 0xff);
+    m_nodes[nickname] = node;
+  }
+
+  BootNode &getNode(uint8_t nickname) { return m_nodes[nickname]; }
+
+  int send(vscpEventEx &ex) override
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (VSCP_CLASS1_PROTOCOL != ex.vscp_class) {
+      return VSCP_ERROR_SUCCESS;
+    }
+
+    switch (ex.vscp_type) {
+
+      case VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_READ: {
+        BootNode &node = m_nodes[ex.data[0]];
+        for (uint8_t idx = 0; idx < ex.data[4] / 4; idx++) {
+          uint8_t data[8] = { idx, ex.data[1], ex.data[2], (uint8_t) (ex.data[3] + idx * 4), 0, 0, 0, 0 };
+          for (int i = 0; i < 4; i++) {
+            // GUID of the node ends with its nickname
+            if ((data[3] + i) == 0xdf) {
+              data[4 + i] = node.nickname;
+            }
+          }
+          respond(node, VSCP_TYPE_PROTOCOL_EXTENDED_PAGE_RESPONSE, data, 8);
+        }
+      } break;
+
+      case VSCP_TYPE_PROTOCOL_ENTER_BOOT_LOADER: {
+        BootNode &node  = m_nodes[ex.data[0]];
+        uint8_t data[8] = { (uint8_t) (node.blockSize >> 24), (uint8_t) (node.blockSize >> 16),
+                            (uint8_t) (node.blockSize >> 8),  (uint8_t) node.blockSize,
+                            (uint8_t) (node.numBlocks >> 24), (uint8_t) (node.numBlocks >> 16),
+                            (uint8_t) (node.numBlocks >> 8),  (uint8_t) node.numBlocks };
+        node.bBootMode = true;
+        respond(node, VSCP_TYPE_PROTOCOL_ACK_BOOT_LOADER, data, 8);
+      } break;
+
+      case VSCP_TYPE_PROTOCOL_START_BLOCK:
+        for (auto &item : m_nodes) {
+          BootNode &node = item.second;
+          if (!node.bBootMode) {
+            continue;
+          }
+          node.block = construct_unsigned32(ex.data[0], ex.data[1], ex.data[2], ex.data[3]);
+          node.buf.clear();
+          node.chunkIndex = 0;
+          node.bDiscard   = false;
+          node.nStartBlocks++;
+          respond(node, VSCP_TYPE_PROTOCOL_START_BLOCK_ACK, ex.data, 4);
+        }
+        break;
+
+      case VSCP_TYPE_PROTOCOL_BLOCK_DATA:
+        m_burst++;
+        m_maxBurst = std::max(m_maxBurst, m_burst);
+
+        for (auto &item : m_nodes) {
+          BootNode &node = item.second;
+          if (!node.bBootMode) {
+            continue;
+          }
+
+          if (node.nackCount && (node.chunkIndex == node.nackChunk) && (node.block == node.nackBlock)) {
+            node.nackCount--;
+            node.bDiscard = true;
+          }
+          node.chunkIndex++;
+
+          if (node.bDiscard) {
+            respond(node, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_NACK, nullptr, 0);
+            continue;
+          }
+
+          node.buf.insert(node.buf.end(), ex.data, ex.data + ex.sizeData);
+          respond(node, VSCP_TYPE_PROTOCOL_BLOCK_CHUNK_ACK, nullptr, 0);
+
+          if (node.buf.size() >= node.blockSize) {
+            uint16_t crc16  = crcFast(node.buf.data(), node.blockSize);
+            uint8_t data[6] = { (uint8_t) (crc16 >> 8),         (uint8_t) crc16,
+                                (uint8_t) (node.block >> 24),   (uint8_t) (node.block >> 16),
+                                (uint8_t) (node.block >> 8),    (uint8_t) node.block };
+            respond(node, VSCP_TYPE_PROTOCOL_BLOCK_DATA_ACK, data, 6);
+          }
+        }
+        break;
+
+      case VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA:
+        for (auto &item : m_nodes) {
+          BootNode &node = item.second;
+          if (!node.bBootMode) {
+            continue;
+          }
+          memcpy(node.memory.data() + node.block * node.blockSize, node.buf.data(), node.blockSize);
+          respond(node, VSCP_TYPE_PROTOCOL_PROGRAM_BLOCK_DATA_ACK, ex.data, 4);
+        }
+        break;
+    }
+
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  int receive(vscpEventEx &ex) override
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_queue.empty()) {
+      return VSCP_ERROR_RCV_EMPTY;
+    }
+    ex = m_queue.front();
+    m_queue.pop_front();
+    m_burst = 0;
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  int receiveBlocking(vscpEventEx &ex, long timeout = 100) override
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_cv.wait_for(lock, std::chrono::milliseconds(timeout), [this] { return !m_queue.empty(); })) {
+      return VSCP_ERROR_TIMEOUT;
+    }
+    ex = m_queue.front();
+    m_queue.pop_front();
+    m_burst = 0;
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  int getcount(uint16_t *pcount) override
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    *pcount = (uint16_t) m_queue.size();
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  int clear(void) override
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.clear();
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  int connect(void) override { return VSCP_ERROR_SUCCESS; }
+  int disconnect(void) override { return VSCP_ERROR_SUCCESS; }
+  bool isConnected(void) override { return true; }
+  int send(vscpEvent &ev) override { return VSCP_ERROR_SUCCESS; }
+  int send(canalMsg &msg) override { return VSCP_ERROR_SUCCESS; }
+  int receive(vscpEvent &ev) override { return VSCP_ERROR_RCV_EMPTY; }
+  int receive(canalMsg &msg) override { return VSCP_ERROR_RCV_EMPTY; }
+  int receiveBlocking(vscpEvent &ev, long timeout = 100) override { return VSCP_ERROR_TIMEOUT; }
+  int receiveBlocking(canalMsg &msg, long timeout = 100) override { return VSCP_ERROR_TIMEOUT; }
+  int setfilter(vscpEventFilter &filter) override { return VSCP_ERROR_SUCCESS; }
+  int getversion(uint8_t *pmajor, uint8_t *pminor, uint8_t *prelease, uint8_t *pbuild) override
+  {
+    return VSCP_ERROR_SUCCESS;
+  }
+  int getinterfaces(std::deque<std::string> &iflist) override { return VSCP_ERROR_SUCCESS; }
+  int getwcyd(uint64_t &wcyd) override { return VSCP_ERROR_SUCCESS; }
+  void setConnectionTimeout(uint32_t timeout) override {}
+  uint32_t getConnectionTimeout(void) override { return 0; }
+  void setResponseTimeout(uint32_t timeout) override {}
+  uint32_t getResponseTimeout(void) override { return 0; }
+  std::string getConfigAsJson(void) override { return "{}"; }
+  bool initFromJson(const std::string &config) override { return true; }
+
+  // Most chunks seen back to back without the host reading a response
+  int m_maxBurst = 0;
+
+private:
+  void respond(BootNode &node, uint16_t type, const uint8_t *pdata, uint16_t size)
+  {
+    vscpEventEx ex;
+    memset(&ex, 0, sizeof(ex));
+    ex.vscp_class = VSCP_CLASS1_PROTOCOL;
+    ex.vscp_type  = type;
+    ex.GUID[15]   = node.nickname;
+    ex.sizeData   = size;
+    if (size) {
+      memcpy(ex.data, pdata, size);
+    }
+    m_queue.push_back(ex);
+    m_cv.notify_all();
+  }
+
+  int m_burst = 0;
+  std::map<uint8_t, BootNode> m_nodes;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<vscpEventEx> m_queue;
+};
+
+// Boot device with a firmware image set up in memory instead of from
+// an Intel hex file
+class TestBootDevice : public CBootDevice_VSCP {
+public:
+  TestBootDevice(BootBusClient *pclient, uint8_t nodeid)
+    : CBootDevice_VSCP(pclient, nodeid, [](int, const char *) {})
+  {
+  }
+
+  // Flash image of size bytes where each byte is derived from its address
+  void setImage(uint32_t size, uint8_t seed)
+  {
+    for (uint32_t addr = 0; addr < size; addr += 16) {
+      uint8_t data[16];
+      for (int i = 0; i < 16; i++) {
+        data[i] = (uint8_t) (seed + addr + i);
+      }
+      m_memSegList.push_back(new CBootMemSegment(addr, 16, data));
+      m_image.insert(m_image.end(), data, data + 16);
+    }
+  }
+
+  std::vector<uint8_t> m_image;
+};
+
+// True if the image has been programmed into the start of node memory
+static bool
+isProgrammed(BootBusClient &bus, uint8_t nickname, const std::vector<uint8_t> &image)
+{
+  BootNode &node = bus.getNode(nickname);
+  return std::equal(image.begin(), image.end(), node.memory.begin());
+}
+
+// ============================================================================
+//                          Windowed chunk transfer
+// ============================================================================
+
+TEST(CBootDevice_VSCP, StopAndWaitIsDefault)
+{
+  BootBusClient bus;
+  bus.addNode(1, 64, 16);
+  cguid ourguid;
+
+  TestBootDevice dev(&bus, 1);
+  dev.setImage(256, 0x10);
+  EXPECT_EQ((uint16_t) CBootDevice_VSCP::BOOT_DEFAULT_CHUNK_WINDOW, dev.getChunkWindow());
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, dev.deviceInit(ourguid, 0));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, dev.deviceLoad());
+
+  EXPECT_TRUE(isProgrammed(bus, 1, dev.m_image));
+  EXPECT_EQ(1, bus.m_maxBurst);
+}
+
+TEST(CBootDevice_VSCP, WindowedLoad)
+{
+  BootBusClient bus;
+  bus.addNode(1, 64, 16);
+  cguid ourguid;
+
+  TestBootDevice dev(&bus, 1);
+  dev.setImage(256, 0x20);
+  dev.setChunkWindow(4);
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, dev.deviceInit(ourguid, 0));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, dev.deviceLoad());
+
+  // Eight chunks per block are sent four at a time
+  EXPECT_TRUE(isProgrammed(bus, 1, dev.m_image));
+  EXPECT_EQ(4, bus.m_maxBurst);
+  EXPECT_EQ(4, bus.getNode(1).nStartBlocks);
+}
+
+TEST(CBootDevice_VSCP, ChunkWindowIsLimited)
+{
+  BootBusClient bus;
+  TestBootDevice dev(&bus, 1);
+
+  dev.setChunkWindow(0);
+  EXPECT_EQ(1, dev.getChunkWindow());
+
+  dev.setChunkWindow(1000);
+  EXPECT_EQ((uint16_t) CBootDevice_VSCP::BOOT_MAX_CHUNK_WINDOW, dev.getChunkWindow());
+}
+
+TEST(CBootDevice_VSCP, WindowedLoadResendsBlockAfterChunkNack)
+{
+  BootBusClient bus;
+  bus.addNode(1, 64, 16);
+  bus.getNode(1).nackBlock = 2;
+  bus.getNode(1).nackChunk = 1;
+  bus.getNode(1).nackCount = 1;
+  cguid ourguid;
+
+  TestBootDevice dev(&bus, 1);
+  dev.setImage(256, 0x30);
+  dev.setChunkWindow(4);
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, dev.deviceInit(ourguid, 0));
+
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, dev.deviceLoad());
+
+  // Block 2 is resent from its start after the NACK. The responses to
+  // the chunks in transit are drained without waiting for a timeout.
+  EXPECT_TRUE(isProgrammed(bus, 1, dev.m_image));
+  EXPECT_EQ(5, bus.getNode(1).nStartBlocks);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+// ============================================================================
+//                              Parallel load
+// ============================================================================
+
+TEST(CBootDevice_VSCP, ParallelLoad)
+{
+  cguid ourguid;
+  std::list<BootBusClient *> buses;
+  std::list<TestBootDevice *> devs;
+  std::list<CBootDevice_VSCP *> devices;
+
+  // One segment with its own client per node
+  for (uint8_t nickname = 1; nickname <= 3; nickname++) {
+    BootBusClient *pbus = new BootBusClient;
+    pbus->addNode(nickname, 64, 16);
+    TestBootDevice *pdev = new TestBootDevice(pbus, nickname);
+    pdev->setImage(128 * nickname, 0x40 * nickname);
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, pdev->deviceInit(ourguid, 0));
+    buses.push_back(pbus);
+    devs.push_back(pdev);
+    devices.push_back(pdev);
+  }
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, CBootDevice_VSCP::deviceLoadParallel(devices, 4));
+
+  auto itbus = buses.begin();
+  for (auto pdev : devs) {
+    uint8_t nickname = (uint8_t) (pdev->m_image.size() / 128);
+    EXPECT_TRUE(isProgrammed(**itbus, nickname, pdev->m_image)) << "node " << (int) nickname;
+    EXPECT_EQ(4, pdev->getChunkWindow());
+    delete pdev;
+    delete *itbus++;
+  }
+}
+
+TEST(CBootDevice_VSCP, ParallelLoadReportsFailure)
+{
+  BootBusClient bus1;
+  BootBusClient bus2;
+  cguid ourguid;
+  std::list<CBootDevice_VSCP *> devices;
+
+  bus1.addNode(1, 64, 16);
+  bus2.addNode(2, 64, 16);
+  TestBootDevice dev1(&bus1, 1);
+  TestBootDevice dev2(&bus2, 2);
+  dev1.setImage(128, 0x50);
+  dev2.setImage(128, 0x60);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, dev1.deviceInit(ourguid, 0));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, dev2.deviceInit(ourguid, 0));
+
+  // Node 2 NACKs every try of its first block
+  bus2.getNode(2).nackBlock = 0;
+  bus2.getNode(2).nackChunk = 0;
+  bus2.getNode(2).nackCount = 1000;
+  devices.push_back(&dev1);
+  devices.push_back(&dev2);
+
+  EXPECT_EQ(VSCP_ERROR_NACK, CBootDevice_VSCP::deviceLoadParallel(devices, 2));
+
+  EXPECT_TRUE(isProgrammed(bus1, 1, dev1.m_image));
+}
+
+TEST(CBootDevice_VSCP, ParallelLoadNeedsOwnClient)
+{
+  BootBusClient bus;
+  bus.addNode(1, 64, 16);
+  bus.addNode(2, 64, 16);
+  TestBootDevice dev1(&bus, 1);
+  TestBootDevice dev2(&bus, 2);
+  std::list<CBootDevice_VSCP *> devices = { &dev1, &dev2 };
+
+  // Both nodes would take the blocks of the other
+  EXPECT_EQ(VSCP_ERROR_PARAMETER, CBootDevice_VSCP::deviceLoadParallel(devices, 4));
+  EXPECT_EQ(0, bus.getNode(1).nStartBlocks);
+  EXPECT_EQ(0, bus.getNode(2).nStartBlocks);
+}
@@ -0,0 +1,166 @@
+// unittest.cpp
+//
+// Unit tests for the bounded queue used by the journal and syslog writers
+//
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+
+#include <vscp-bounded-queue.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+struct item {
+  uint32_t producer;
+  uint32_t value;
+};
+
+TEST(VscpBoundedQueue, InitRoundsUpSize)
+{
+  vscpBoundedQueue queue;
+  EXPECT_FALSE(queue.isInit());
+
+  ASSERT_TRUE(queue.init(5, sizeof(item)));
+  EXPECT_TRUE(queue.isInit());
+  EXPECT_EQ(8u, queue.getSize());
+
+  // Kept until released, only with the same size
+  EXPECT_TRUE(queue.init(8, sizeof(item)));
+  EXPECT_FALSE(queue.init(16, sizeof(item)));
+  EXPECT_FALSE(queue.init(8, 2 * sizeof(item)));
+
+  queue.release();
+  EXPECT_FALSE(queue.isInit());
+  EXPECT_TRUE(queue.init(16, sizeof(item)));
+  EXPECT_EQ(16u, queue.getSize());
+}
+
+TEST(VscpBoundedQueue, FullAndInOrder)
+{
+  vscpBoundedQueue queue;
+  ASSERT_TRUE(queue.init(4, sizeof(item)));
+  EXPECT_EQ(nullptr, queue.front());
+
+  // Several laps around the slots
+  uint32_t next = 0;
+  for (int lap = 0; lap < 3; lap++) {
+
+    for (uint32_t i = 0; i < 4; i++) {
+      size_t pos;
+      item *pitem = (item *) queue.reserve(&pos);
+      ASSERT_NE(nullptr, pitem);
+      pitem->value = next + i;
+      queue.commit(pos);
+    }
+
+    size_t pos;
+    EXPECT_EQ(nullptr, queue.reserve(&pos));
+
+    item *pitem;
+    for (uint32_t i = 0; i < 4; i++) {
+      ASSERT_NE(nullptr, pitem = (item *) queue.front());
+      EXPECT_EQ(next++, pitem->value);
+      queue.pop();
+    }
+    EXPECT_EQ(nullptr, queue.front());
+  }
+
+  EXPECT_EQ(12u, queue.getEnqueuePos());
+  EXPECT_EQ(12u, queue.getDequeuePos());
+}
+
+TEST(VscpBoundedQueue, ReservedItemIsNotVisible)
+{
+  vscpBoundedQueue queue;
+  ASSERT_TRUE(queue.init(4, sizeof(item)));
+
+  size_t pos;
+  ASSERT_NE(nullptr, queue.reserve(&pos));
+  EXPECT_EQ(nullptr, queue.front());
+  queue.commit(pos);
+  EXPECT_NE(nullptr, queue.front());
+}
+
+TEST(VscpBoundedQueue, WaitReturnsOnCommit)
+{
+  vscpBoundedQueue queue;
+  ASSERT_TRUE(queue.init(4, sizeof(item)));
+
+  // Times out when nothing comes
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  queue.wait(50);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+
+  std::thread producer([&queue]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    size_t pos;
+    item *pitem  = (item *) queue.reserve(&pos);
+    pitem->value = 1;
+    queue.commit(pos);
+  });
+
+  start = std::chrono::steady_clock::now();
+  while (nullptr == queue.front()) {
+    queue.wait(10000);
+  }
+  EXPECT_GT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  producer.join();
+
+  // Returns at once when something is waiting
+  start = std::chrono::steady_clock::now();
+  queue.wait(10000);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST(VscpBoundedQueue, ManyProducers)
+{
+  vscpBoundedQueue queue;
+  ASSERT_TRUE(queue.init(64, sizeof(item)));
+
+  const uint32_t cntProducers = 4;
+  const uint32_t cntItems     = 20000;
+  std::atomic<int> cntDone(0);
+
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < cntProducers; t++) {
+    threads.push_back(std::thread([&queue, &cntDone, t, cntItems]() {
+      for (uint32_t i = 0; i < cntItems; i++) {
+        size_t pos;
+        item *pitem;
+        while (nullptr == (pitem = (item *) queue.reserve(&pos))) {
+          std::this_thread::yield();
+        }
+        pitem->producer = t;
+        pitem->value    = i;
+        queue.commit(pos);
+      }
+      cntDone++;
+    }));
+  }
+
+  // Each producer's items arrive in the order they were put
+  std::vector<uint32_t> next(cntProducers, 0);
+  uint32_t cnt = 0;
+  while (cnt < cntProducers * cntItems) {
+    item *pitem = (item *) queue.front();
+    if (nullptr == pitem) {
+      queue.wait(100);
+      continue;
+    }
+    ASSERT_LT(pitem->producer, cntProducers);
+    ASSERT_EQ(next[pitem->producer]++, pitem->value);
+    queue.pop();
+    cnt++;
+  }
+
+  for (size_t t = 0; t < threads.size(); t++) {
+    threads[t].join();
+  }
+  EXPECT_EQ((int) cntProducers, cntDone.load());
+  EXPECT_EQ(nullptr, queue.front());
+}
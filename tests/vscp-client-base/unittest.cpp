@@ -384,3 +384,279 @@ TEST(CVscpClientBase, SetCallbackOverwritesCallbackObject)
     [](vscpEventEx &ex, void *pobj) {}, &objB);
   EXPECT_EQ(&objB, client.getCallbackObj());
 }
+
+// ============================================================================
+//                    Node scanner over a simulated bus
+// ============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <guid.h>
+#include <register.h>
+
+// Answers WHO_IS_THERE and READ_REGISTER for a set of nodes. Events are
+// queued for receiveBlocking or handed to the installed callback.
+class BusClient : public TestClient {
+public:
+  BusClient(std::set<uint16_t> nodes) : m_nodes(nodes) {}
+
+  int send(vscpEventEx &ex) override
+  {
+    m_sent++;
+    if (VSCP_TYPE_PROTOCOL_WHO_IS_THERE == ex.vscp_type) {
+      for (auto node : m_nodes) {
+        respond(node, VSCP_TYPE_PROTOCOL_WHO_IS_THERE_RESPONSE);
+      }
+    }
+    else if (VSCP_TYPE_PROTOCOL_READ_REGISTER == ex.vscp_type) {
+      if (m_nodes.count(ex.data[0])) {
+        respond(ex.data[0], VSCP_TYPE_PROTOCOL_RW_RESPONSE);
+      }
+    }
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  int receiveBlocking(vscpEventEx &ex, long timeout = 100) override
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_blockingWaits++;
+    if (!m_cv.wait_for(lock, std::chrono::milliseconds(timeout), [this] { return !m_queue.empty(); })) {
+      return VSCP_ERROR_TIMEOUT;
+    }
+    ex = m_queue.front();
+    m_queue.pop_front();
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  int clear(void) override
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.clear();
+    return VSCP_ERROR_SUCCESS;
+  }
+
+  int m_sent          = 0;
+  int m_blockingWaits = 0;
+
+private:
+  void respond(uint16_t node, uint16_t type)
+  {
+    vscpEventEx ex;
+    memset(&ex, 0, sizeof(ex));
+    ex.vscp_class = VSCP_CLASS1_PROTOCOL;
+    ex.vscp_type  = type;
+    ex.GUID[15]   = node & 0xff;
+    ex.sizeData   = 2;
+    ex.data[0]    = 0xd0;
+
+    std::function<void(vscpEvent &ev, void *pobj)> callbackev;
+    std::function<void(vscpEventEx &ex, void *pobj)> callbackex;
+    void *pobj;
+    getCallbacks(callbackev, callbackex, &pobj);
+    if (callbackex) {
+      callbackex(ex, pobj);
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.push_back(ex);
+    m_cv.notify_one();
+  }
+
+  std::set<uint16_t> m_nodes;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<vscpEventEx> m_queue;
+};
+
+TEST(CVscpNodeScanner, FastScanFindsAllNodes)
+{
+  BusClient client({ 1, 2, 5, 200 });
+  cguid guidIf;
+  std::set<uint16_t> found;
+  std::set<uint16_t> reported;
+
+  CVscpNodeScanner scanner(client, guidIf);
+  scanner.setFoundCallback([&reported](uint16_t nodeid, uint32_t rtt) { reported.insert(nodeid); });
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, scanner.scanFast(found, 2000));
+  EXPECT_EQ(std::set<uint16_t>({ 1, 2, 5, 200 }), found);
+  EXPECT_EQ(found, reported);
+}
+
+TEST(CVscpNodeScanner, AdaptiveFastScanEndsEarly)
+{
+  BusClient client({ 3, 4 });
+  cguid guidIf;
+  std::set<uint16_t> found;
+
+  CVscpNodeScanner scanner(client, guidIf);
+  scanner.setMinProbeTimeout(10);
+
+  uint32_t start = vscp_getMsTimeStamp();
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, scanner.scanFast(found, 5000));
+
+  // Quiet bus after the answers should end the scan long before the timeout
+  EXPECT_LT(vscp_getMsTimeStamp() - start, (uint32_t) 2000);
+  EXPECT_EQ(2, found.size());
+}
+
+TEST(CVscpNodeScanner, WindowedSlowScan)
+{
+  BusClient client({ 1, 7, 9 });
+  cguid guidIf;
+  std::set<uint16_t> search;
+  std::set<uint16_t> found;
+
+  for (int i = 1; i <= 20; i++) {
+    search.insert(i);
+  }
+
+  CVscpNodeScanner scanner(client, guidIf);
+  scanner.setWindow(4);
+  scanner.setRetries(1);
+  scanner.setMinProbeTimeout(10);
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, scanner.scanSlow(search, found, 0, 200));
+  EXPECT_EQ(std::set<uint16_t>({ 1, 7, 9 }), found);
+
+  // Every silent node is probed once and retried once
+  EXPECT_EQ(3 + 17 * 2, client.m_sent);
+}
+
+TEST(CVscpNodeScanner, SlowScanInCallbackModeChainsCallback)
+{
+  BusClient client({ 2, 4 });
+  cguid guidIf;
+  std::set<uint16_t> search = { 1, 2, 3, 4 };
+  std::set<uint16_t> found;
+  int appEvents = 0;
+  int userData  = 0;
+
+  client.setCallbackEx([&appEvents](vscpEventEx &ex, void *pobj) { appEvents++; }, &userData);
+
+  CVscpNodeScanner scanner(client, guidIf);
+  scanner.setRetries(0);
+  scanner.setMinProbeTimeout(10);
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, scanner.scanSlow(search, found, 0, 100));
+  EXPECT_EQ(std::set<uint16_t>({ 2, 4 }), found);
+
+  // Application callback still sees the traffic and is restored afterwards
+  EXPECT_EQ(2, appEvents);
+  EXPECT_EQ(0, client.m_blockingWaits);
+  EXPECT_TRUE(client.isCallbackExActive());
+  EXPECT_EQ(&userData, client.getCallbackObj());
+}
+
+// Refuses new callbacks once connected, as several real clients do, and
+// delivers unrelated traffic from its own receive thread
+class LiveBusClient : public BusClient {
+public:
+  LiveBusClient(std::set<uint16_t> nodes) : BusClient(nodes) {}
+
+  int setCallbackEx(std::function<void(vscpEventEx &ex, void *pobj)> callback, void *pData = nullptr) override
+  {
+    if (m_bConnected) {
+      return VSCP_ERROR_ERROR;
+    }
+    return CVscpClient::setCallbackEx(callback, pData);
+  }
+
+  void deliverNoise(void)
+  {
+    vscpEventEx ex;
+    memset(&ex, 0, sizeof(ex));
+    ex.vscp_class = VSCP_CLASS1_MEASUREMENT;
+    ex.vscp_type  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+
+    std::function<void(vscpEvent &ev, void *pobj)> callbackev;
+    std::function<void(vscpEventEx &ex, void *pobj)> callbackex;
+    void *pobj;
+    getCallbacks(callbackev, callbackex, &pobj);
+    if (callbackex) {
+      callbackex(ex, pobj);
+    }
+  }
+
+  bool m_bConnected = false;
+};
+
+TEST(CVscpNodeScanner, CallbackSwapWhileReceiving)
+{
+  LiveBusClient client({ 3, 5 });
+  cguid guidIf;
+  std::set<uint16_t> search = { 1, 2, 3, 4, 5, 6 };
+  std::atomic<int> appEvents(0);
+  int userData = 0;
+
+  client.setCallbackEx([&appEvents](vscpEventEx &ex, void *pobj) { appEvents++; }, &userData);
+  client.m_bConnected = true;
+
+  std::atomic<bool> bStop(false);
+  std::thread rx([&client, &bStop] {
+    while (!bStop) {
+      client.deliverNoise();
+    }
+  });
+
+  for (int i = 0; i < 20; i++) {
+    std::set<uint16_t> found;
+    CVscpNodeScanner scanner(client, guidIf);
+    scanner.setRetries(0);
+    scanner.setMinProbeTimeout(10);
+    EXPECT_EQ(VSCP_ERROR_SUCCESS, scanner.scanSlow(search, found, 0, 100));
+    EXPECT_EQ(std::set<uint16_t>({ 3, 5 }), found);
+  }
+
+  bStop = true;
+  rx.join();
+
+  // The scanner hooked in although the client refuses new callbacks
+  // and the application callback is back in place
+  EXPECT_EQ(0, client.m_blockingWaits);
+  EXPECT_TRUE(client.isCallbackExActive());
+  EXPECT_EQ(&userData, client.getCallbackObj());
+
+  int before = appEvents;
+  client.deliverNoise();
+  EXPECT_EQ(before + 1, appEvents);
+}
+
+TEST(CVscpNodeScanner, CallbackWaitsForThreadThatReplacesIt)
+{
+  LiveBusClient client({});
+  int calls = 0;
+
+  // A callback that waits for another thread touching the callbacks
+  // must not deadlock with the receive path
+  client.setCallbackEx([&client, &calls](vscpEventEx &ex, void *pobj) {
+    calls++;
+    std::thread other([&client, &calls] {
+      client.CVscpClient::setCallbackEx([&calls](vscpEventEx &ex, void *pobj) { calls += 10; });
+    });
+    other.join();
+  });
+
+  client.deliverNoise();
+  EXPECT_EQ(1, calls);
+
+  client.deliverNoise();
+  EXPECT_EQ(11, calls);
+}
+
+TEST(CVscpNodeScanner, LegacySlowScanWrapper)
+{
+  BusClient client({ 10, 11 });
+  cguid guidIf;
+  std::set<uint16_t> found;
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, vscp_scanSlowForDevices(client, guidIf, 8, 12, found, nullptr, 0, 100));
+  EXPECT_EQ(std::set<uint16_t>({ 10, 11 }), found);
+}
@@ -0,0 +1,244 @@
+///////////////////////////////////////////////////////////////////////////////
+// canalstub.cpp
+//
+// Minimal in-memory CANAL driver used by the unit tests. Built twice,
+// with CANAL_STUB_BATCH it also exports the bulk entry points and without
+// it it only has the generation 1 calls (no blocking receive).
+//
+// The test pushes messages with StubPush and looks at what the client did
+// with the Stub* counters. The test and vscpClientCanal dlopen the same
+// file so they share the state below.
+//
+// This file is part of the VSCP (https://www.vscp.org)
+//
+// The MIT License (MIT)
+//
+// Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+// <info@vscp.org>
+//
+
+#include <string.h>
+
+#include <canal.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+static std::mutex gMutex;
+static std::condition_variable gCond;
+static std::deque<canalMsg> gRxQueue;
+static std::deque<canalMsg> gTxQueue;
+
+static unsigned long gCntDataAvailable;
+static unsigned long gCntReceiveBatch;
+static unsigned long gCntSendBatch;
+static unsigned int gSendLimit = ~0U;
+
+extern "C" {
+
+// ----------------------------------------------------------------------------
+//                              Test helpers
+// ----------------------------------------------------------------------------
+
+void
+StubReset(void)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  gRxQueue.clear();
+  gTxQueue.clear();
+  gCntDataAvailable = 0;
+  gCntReceiveBatch  = 0;
+  gCntSendBatch     = 0;
+  gSendLimit        = ~0U;
+}
+
+// CanalSendBatch sends at most limit messages and still reports success
+void
+StubSetSendLimit(unsigned int limit)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  gSendLimit = limit;
+}
+
+void
+StubPush(const canalMsg *pmsg)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  gRxQueue.push_back(*pmsg);
+  gCond.notify_all();
+}
+
+int
+StubPopSent(canalMsg *pmsg)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  if (gTxQueue.empty()) {
+    return 0;
+  }
+  *pmsg = gTxQueue.front();
+  gTxQueue.pop_front();
+  return 1;
+}
+
+unsigned long
+StubDataAvailableCount(void)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  return gCntDataAvailable;
+}
+
+unsigned long
+StubReceiveBatchCount(void)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  return gCntReceiveBatch;
+}
+
+unsigned long
+StubSendBatchCount(void)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  return gCntSendBatch;
+}
+
+// ----------------------------------------------------------------------------
+//                               CANAL API
+// ----------------------------------------------------------------------------
+
+long
+CanalOpen(const char * /*pDevice*/, unsigned long /*flags*/)
+{
+  return 1;
+}
+
+int
+CanalClose(long /*handle*/)
+{
+  return CANAL_ERROR_SUCCESS;
+}
+
+unsigned long
+CanalGetLevel(long /*handle*/)
+{
+  return CANAL_LEVEL_STANDARD;
+}
+
+int
+CanalSend(long /*handle*/, const PCANALMSG pCanalMsg)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  gTxQueue.push_back(*pCanalMsg);
+  return CANAL_ERROR_SUCCESS;
+}
+
+int
+CanalReceive(long /*handle*/, PCANALMSG pCanalMsg)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  if (gRxQueue.empty()) {
+    return CANAL_ERROR_FIFO_EMPTY;
+  }
+  *pCanalMsg = gRxQueue.front();
+  gRxQueue.pop_front();
+  return CANAL_ERROR_SUCCESS;
+}
+
+int
+CanalDataAvailable(long /*handle*/)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  gCntDataAvailable++;
+  return (int) gRxQueue.size();
+}
+
+int
+CanalGetStatus(long /*handle*/, PCANALSTATUS pCanalStatus)
+{
+  memset(pCanalStatus, 0, sizeof(canalStatus));
+  return CANAL_ERROR_SUCCESS;
+}
+
+int
+CanalGetStatistics(long /*handle*/, PCANALSTATISTICS pCanalStatistics)
+{
+  memset(pCanalStatistics, 0, sizeof(canalStatistics));
+  return CANAL_ERROR_SUCCESS;
+}
+
+int
+CanalSetFilter(long /*handle*/, unsigned long /*filter*/)
+{
+  return CANAL_ERROR_SUCCESS;
+}
+
+int
+CanalSetMask(long /*handle*/, unsigned long /*mask*/)
+{
+  return CANAL_ERROR_SUCCESS;
+}
+
+unsigned long
+CanalGetVersion(void)
+{
+  return 1;
+}
+
+unsigned long
+CanalGetDllVersion(void)
+{
+  return 1;
+}
+
+const char *
+CanalGetVendorString(void)
+{
+  return "VSCP unit test stub";
+}
+
+#ifdef CANAL_STUB_BATCH
+
+int
+CanalBlockingReceiveBatch(long /*handle*/,
+                          PCANALMSG pCanalMsgs,
+                          unsigned int count,
+                          unsigned int *pReceived,
+                          unsigned long timeout)
+{
+  std::unique_lock<std::mutex> lock(gMutex);
+  gCntReceiveBatch++;
+
+  *pReceived = 0;
+  if (!gCond.wait_for(lock, std::chrono::milliseconds(timeout), [] { return !gRxQueue.empty(); })) {
+    return CANAL_ERROR_TIMEOUT;
+  }
+
+  while ((*pReceived < count) && !gRxQueue.empty()) {
+    pCanalMsgs[(*pReceived)++] = gRxQueue.front();
+    gRxQueue.pop_front();
+  }
+
+  return CANAL_ERROR_SUCCESS;
+}
+
+int
+CanalSendBatch(long /*handle*/,
+               const PCANALMSG pCanalMsgs,
+               unsigned int count,
+               unsigned int *pSent,
+               unsigned long /*timeout*/)
+{
+  std::lock_guard<std::mutex> lock(gMutex);
+  gCntSendBatch++;
+
+  for (*pSent = 0; (*pSent < count) && (*pSent < gSendLimit); (*pSent)++) {
+    gTxQueue.push_back(pCanalMsgs[*pSent]);
+  }
+
+  return CANAL_ERROR_SUCCESS;
+}
+
+#endif
+
+} // extern "C"
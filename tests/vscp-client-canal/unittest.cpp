@@ -18,6 +18,15 @@
 #include <string>
 #include <cstring>
 
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <spdlog/spdlog.h>
 
@@ -317,3 +326,223 @@ TEST(VscpClientCanal, DefaultFilterAcceptsAll)
   EXPECT_EQ(0, client.m_filterIn.mask_class);
   EXPECT_EQ(0, client.m_filterIn.mask_type);
 }
+
+// ============================================================================
+//               Bulk receive/send against the stub drivers
+// ============================================================================
+
+#ifndef WIN32
+
+// Test side of the stub driver (see canalstub.cpp)
+class CanalStub {
+public:
+  CanalStub(const char *path)
+  {
+    m_hdll             = dlopen(path, RTLD_NOW);
+    reset              = (void (*)(void)) dlsym(m_hdll, "StubReset");
+    push               = (void (*)(const canalMsg *)) dlsym(m_hdll, "StubPush");
+    popSent            = (int (*)(canalMsg *)) dlsym(m_hdll, "StubPopSent");
+    dataAvailableCount = (unsigned long (*)(void)) dlsym(m_hdll, "StubDataAvailableCount");
+    receiveBatchCount  = (unsigned long (*)(void)) dlsym(m_hdll, "StubReceiveBatchCount");
+    sendBatchCount     = (unsigned long (*)(void)) dlsym(m_hdll, "StubSendBatchCount");
+    setSendLimit       = (void (*)(unsigned int)) dlsym(m_hdll, "StubSetSendLimit");
+    reset();
+  }
+
+  ~CanalStub() { dlclose(m_hdll); }
+
+  void pushMsg(uint8_t type)
+  {
+    canalMsg msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.flags = CANAL_IDFLAG_EXTENDED;
+    msg.id    = ((uint32_t) VSCP_CLASS1_INFORMATION << 16) | ((uint32_t) type << 8) | 0x01;
+    push(&msg);
+  }
+
+  void *m_hdll;
+  void (*reset)(void);
+  void (*push)(const canalMsg *);
+  int (*popSent)(canalMsg *);
+  unsigned long (*dataAvailableCount)(void);
+  unsigned long (*receiveBatchCount)(void);
+  unsigned long (*sendBatchCount)(void);
+  void (*setSendLimit)(unsigned int);
+};
+
+// Collects events delivered to the ev callback
+class Received {
+public:
+  void add(vscpEvent &ev)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_types.push_back(ev.vscp_type);
+  }
+
+  bool waitFor(size_t cnt)
+  {
+    for (int i = 0; i < 2000; i++) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_types.size() >= cnt) {
+          return true;
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+  }
+
+  std::mutex m_mutex;
+  std::vector<uint16_t> m_types;
+};
+
+static void
+receiveThroughClient(const char *path, CanalStub &stub)
+{
+  vscpClientCanal client;
+  Received rcv;
+
+  ASSERT_TRUE(client.init(path));
+  client.setCallbackEv([&rcv](vscpEvent &ev, void *pobj) { rcv.add(ev); }, nullptr);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+
+  for (uint8_t i = 0; i < 50; i++) {
+    stub.pushMsg(i);
+  }
+
+  ASSERT_TRUE(rcv.waitFor(50));
+  client.disconnect();
+
+  ASSERT_EQ(50, rcv.m_types.size());
+  for (uint8_t i = 0; i < 50; i++) {
+    ASSERT_EQ(i, rcv.m_types[i]);
+  }
+}
+
+TEST(VscpClientCanal, BatchReceive)
+{
+  CanalStub stub(CANAL_STUB_BATCH_PATH);
+  receiveThroughClient(CANAL_STUB_BATCH_PATH, stub);
+
+  // Everything came through the bulk entry point
+  EXPECT_LT(0, stub.receiveBatchCount());
+  EXPECT_EQ(0, stub.dataAvailableCount());
+}
+
+TEST(VscpClientCanal, FallbackReceive)
+{
+  CanalStub stub(CANAL_STUB_PATH);
+  receiveThroughClient(CANAL_STUB_PATH, stub);
+  EXPECT_EQ(0, stub.receiveBatchCount());
+}
+
+TEST(VscpClientCanal, FallbackReceiveHonoursTimeout)
+{
+  CanalStub stub(CANAL_STUB_PATH);
+  VscpCanalDeviceIf canalif;
+  canalMsg msgs[8];
+  uint32_t cnt = 99;
+
+  ASSERT_EQ(CANAL_ERROR_SUCCESS, canalif.init(CANAL_STUB_PATH, "", 0));
+  ASSERT_EQ(CANAL_ERROR_SUCCESS, canalif.CanalOpen());
+  ASSERT_FALSE(canalif.hasBatchSupport());
+
+  // Nothing queued, the driver has no blocking receive so it is polled
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  EXPECT_EQ(CANAL_ERROR_TIMEOUT, canalif.CanalBlockingReceiveBatch(msgs, 8, &cnt, 50));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+  EXPECT_EQ(0, cnt);
+  EXPECT_GT(50, stub.dataAvailableCount());
+
+  // Queued messages are returned at once
+  stub.pushMsg(1);
+  stub.pushMsg(2);
+  stub.pushMsg(3);
+  EXPECT_EQ(CANAL_ERROR_SUCCESS, canalif.CanalBlockingReceiveBatch(msgs, 8, &cnt, 50));
+  EXPECT_EQ(3, cnt);
+  EXPECT_EQ(3, vscp_getVscpTypeFromCANALid(msgs[2].id));
+
+  canalif.CanalClose();
+}
+
+TEST(VscpClientCanal, FallbackIdleDoesNotSpin)
+{
+  CanalStub stub(CANAL_STUB_PATH);
+  vscpClientCanal client;
+  Received rcv;
+
+  ASSERT_TRUE(client.init(CANAL_STUB_PATH));
+  client.setCallbackEv([&rcv](vscpEvent &ev, void *pobj) { rcv.add(ev); }, nullptr);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  unsigned long cnt = stub.dataAvailableCount();
+  client.disconnect();
+
+  // About one poll per CANAL_RECEIVE_POLL_INTERVAL, a spinning worker
+  // makes millions of calls in the same time
+  EXPECT_GT(1000, cnt);
+}
+
+static void
+sendThroughClient(const char *path, CanalStub &stub)
+{
+  vscpClientCanal client;
+  canalMsg msgs[5];
+  uint32_t sent = 0;
+
+  ASSERT_TRUE(client.init(path));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+
+  for (uint8_t i = 0; i < 5; i++) {
+    memset(&msgs[i], 0, sizeof(canalMsg));
+    msgs[i].id = i;
+  }
+  ASSERT_EQ(CANAL_ERROR_SUCCESS, client.send(msgs, 5, &sent));
+  ASSERT_EQ(5, sent);
+
+  canalMsg msg;
+  for (uint8_t i = 0; i < 5; i++) {
+    ASSERT_EQ(1, stub.popSent(&msg));
+    ASSERT_EQ(i, msg.id);
+  }
+  ASSERT_EQ(0, stub.popSent(&msg));
+
+  client.disconnect();
+}
+
+TEST(VscpClientCanal, BatchSend)
+{
+  CanalStub stub(CANAL_STUB_BATCH_PATH);
+  sendThroughClient(CANAL_STUB_BATCH_PATH, stub);
+  EXPECT_EQ(1, stub.sendBatchCount());
+}
+
+TEST(VscpClientCanal, FallbackSend)
+{
+  CanalStub stub(CANAL_STUB_PATH);
+  sendThroughClient(CANAL_STUB_PATH, stub);
+  EXPECT_EQ(0, stub.sendBatchCount());
+}
+
+TEST(VscpClientCanal, BatchSendShortCountFails)
+{
+  CanalStub stub(CANAL_STUB_BATCH_PATH);
+  vscpClientCanal client;
+  canalMsg msgs[5];
+  uint32_t sent = 0;
+
+  ASSERT_TRUE(client.init(CANAL_STUB_BATCH_PATH));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+
+  // The driver reports success after sending only part of the batch
+  memset(msgs, 0, sizeof(msgs));
+  stub.setSendLimit(3);
+  EXPECT_NE(CANAL_ERROR_SUCCESS, client.send(msgs, 5, &sent));
+  EXPECT_EQ(3, sent);
+
+  client.disconnect();
+}
+
+#endif
@@ -434,14 +434,41 @@ TEST(VscpClientMqtt, SetUserEscape)
   // No crash = success; escapes are used internally during publish
 }
 
+TEST(VscpClientMqtt, SetTokenTable)
+{
+  vscpClientMqtt client;
+  vscpTokenTable tokens;
+  tokens.addClassToken(10, "CLASS_MEASUREMENT");
+  tokens.addTypeToken(10, 6, "TYPE_MEASUREMENT_TEMPERATURE");
+  client.setTokenTable(&tokens);
+  EXPECT_EQ(&tokens, client.getTokenTable());
+  client.setTokenTable(nullptr);
+  EXPECT_EQ(nullptr, client.getTokenTable());
+}
+
 TEST(VscpClientMqtt, SetTokenMaps)
 {
   vscpClientMqtt client;
-  std::map<uint16_t, std::string> classMap;
-  std::map<uint32_t, std::string> typeMap;
-  classMap[10]   = "CLASS_MEASUREMENT";
-  typeMap[10 << 16 | 6] = "TYPE_MEASUREMENT_TEMPERATURE";
-  client.setTokenMaps(&classMap, &typeMap);
+  std::map<uint16_t, std::string> mapClass;
+  std::map<uint32_t, std::string> mapType;
+  mapClass[10]             = "MY_CLASS";
+  mapType[(10 << 16) + 6]  = "MY_TYPE";
+
+  client.setTokenMaps(&mapClass, &mapType);
+  const vscpTokenTable *ptokens = client.getTokenTable();
+  ASSERT_NE(nullptr, ptokens);
+  EXPECT_EQ("MY_CLASS", ptokens->getClassToken(10));
+  EXPECT_EQ("MY_TYPE", ptokens->getTypeToken(10, 6));
+
+  // Ids not in the maps still get the built in tokens
+  EXPECT_EQ("VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT", ptokens->getTypeToken(10, 5));
+
+  // The maps are copied
+  mapClass[10] = "CHANGED";
+  EXPECT_EQ("MY_CLASS", ptokens->getClassToken(10));
+
+  client.setTokenMaps(nullptr, nullptr);
+  EXPECT_EQ(nullptr, client.getTokenTable());
 }
 
 // ---------------------------------------------------------------------------
@@ -756,3 +783,81 @@ TEST(VscpClientMqtt, InitFromJsonUseTopicForEventDefaults)
   EXPECT_TRUE(client.initFromJson(j.dump()));
   EXPECT_TRUE(client.isUseTopicForEventDefaults());
 }
+
+// ---------------------------------------------------------------------------
+//       initFromJson - coalesce
+// ---------------------------------------------------------------------------
+
+TEST(VscpClientMqtt, InitFromJsonCoalesce)
+{
+  vscpClientMqtt client;
+  EXPECT_FALSE(client.m_coalesce.isEnabled());
+
+  json j;
+  j["coalesce"]["enable"]       = true;
+  j["coalesce"]["deadband"]     = 1.5;
+  j["coalesce"]["window"]       = 1000;
+  j["coalesce"]["min-interval"] = 100;
+  j["coalesce"]["max-keys"]     = 8;
+  EXPECT_TRUE(client.initFromJson(j.dump()));
+  EXPECT_TRUE(client.m_coalesce.isEnabled());
+
+  uint8_t data[2] = { VSCP_DATACODING_INTEGER | (1 << 3), 20 };
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.vscp_class = VSCP_CLASS1_MEASUREMENT;
+  ev.vscp_type  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+  ev.sizeData   = sizeof(data);
+  ev.pdata      = data;
+
+  EXPECT_TRUE(client.m_coalesce.check(vscp_event_view(ev), 0));
+
+  // Within deadband
+  data[1] = 21;
+  EXPECT_FALSE(client.m_coalesce.check(vscp_event_view(ev), 500));
+
+  // Changed but held back by the minimum interval
+  data[1] = 25;
+  EXPECT_FALSE(client.m_coalesce.check(vscp_event_view(ev), 50));
+  EXPECT_EQ(1u, client.m_coalesce.getPendingCount());
+  EXPECT_EQ(1u, client.m_coalesce.flush(nullptr, 100));
+
+  // Window has passed
+  EXPECT_TRUE(client.m_coalesce.check(vscp_event_view(ev), 1100));
+}
+
+TEST(VscpClientMqtt, ReconnectPublishesHeldBack)
+{
+  vscpClientMqtt client;
+
+  json j;
+  j["coalesce"]["enable"]       = true;
+  j["coalesce"]["min-interval"] = 60000;
+  EXPECT_TRUE(client.initFromJson(j.dump()));
+
+  uint8_t data[2] = { VSCP_DATACODING_INTEGER | (1 << 3), 20 };
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.vscp_class = VSCP_CLASS1_MEASUREMENT;
+  ev.vscp_type  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+  ev.sizeData   = sizeof(data);
+  ev.pdata      = data;
+
+  uint64_t now = vscpCoalesce::getTime();
+  EXPECT_TRUE(client.m_coalesce.check(vscp_event_view(ev), now));
+
+  // Held back by the minimum interval, not due for a minute
+  data[1] = 25;
+  EXPECT_FALSE(client.m_coalesce.check(vscp_event_view(ev), now));
+  EXPECT_EQ(1u, client.m_coalesce.getPendingCount());
+  EXPECT_EQ(0u, client.flushCoalesced());
+
+  // Connect publishes it anyway instead of dropping it
+  EXPECT_EQ(1u, client.restartCoalesce());
+  EXPECT_EQ(0u, client.m_coalesce.getPendingCount());
+  EXPECT_EQ(1u, client.m_coalesce.getFlushCount());
+
+  // and forgets the published values
+  EXPECT_EQ(0u, client.m_coalesce.getKeyCount());
+  EXPECT_TRUE(client.m_coalesce.check(vscp_event_view(ev), now));
+}
@@ -0,0 +1,543 @@
+// unittest.cpp
+//
+// Unit tests for vscpShmChannel, vscpShmServer and vscpClientShm
+//
+
+#include <gtest/gtest.h>
+
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <vscp-client-shm.h>
+#include <vscp-shm.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Socket path unique for the test run
+static std::string
+socketPath(void)
+{
+  return "/tmp/vscp-shm-test-" + std::to_string(getpid()) + ".sock";
+}
+
+// Wait for a condition, false on timeout
+template<typename F>
+static bool
+waitFor(F cond, int ms = 2000)
+{
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+  while (!cond()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+// Fill in a test event
+static void
+makeEvent(vscpEvent &ev, uint8_t *pdata, uint16_t vscp_class, uint16_t vscp_type, uint8_t tag)
+{
+  memset(&ev, 0, sizeof(vscpEvent));
+  ev.head       = VSCP_PRIORITY_NORMAL;
+  ev.vscp_class = vscp_class;
+  ev.vscp_type  = vscp_type;
+  ev.GUID[15]   = tag;
+  ev.sizeData   = 3;
+  pdata[0]      = tag;
+  pdata[1]      = 0x55;
+  pdata[2]      = 0xaa;
+  ev.pdata      = pdata;
+}
+
+// Client end of a channel created in this process
+static int
+attachClient(vscpShmChannel &srv, vscpShmChannel &cli)
+{
+  return cli.attach(dup(srv.getSegment()), dup(srv.getDoorbellToServer()), dup(srv.getDoorbellToClient()), srv.getSize());
+}
+
+//-----------------------------------------------------------------------------
+// Channel
+//-----------------------------------------------------------------------------
+
+TEST(vscpShmChannel, RoundTrip)
+{
+  vscpShmChannel srv, cli;
+  vscpEvent ev, evRead;
+  uint8_t data[3];
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, srv.create(8));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, attachClient(srv, cli));
+  EXPECT_EQ(8u, cli.getQueueSize());
+
+  // Client -> server
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, cli.put(ev));
+  EXPECT_EQ(1u, srv.getCount());
+  EXPECT_EQ(0u, cli.getCount());
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, srv.get(evRead));
+  EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, evRead.vscp_class);
+  EXPECT_EQ(VSCP_TYPE_MEASUREMENT_TEMPERATURE, evRead.vscp_type);
+  EXPECT_EQ(1, evRead.GUID[15]);
+  ASSERT_EQ(3, evRead.sizeData);
+  EXPECT_EQ(0, memcmp(data, evRead.pdata, 3));
+  delete[] evRead.pdata;
+  EXPECT_EQ(VSCP_ERROR_FIFO_EMPTY, srv.get(evRead));
+
+  // Server -> client, event ex
+  vscpEventEx ex;
+  memset(&ex, 0, sizeof(ex));
+  ex.vscp_class = VSCP_CLASS1_INFORMATION;
+  ex.vscp_type  = VSCP_TYPE_INFORMATION_ON;
+  ex.sizeData   = 1;
+  ex.data[0]    = 7;
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, srv.put(ex));
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, cli.get(evRead));
+  EXPECT_EQ(VSCP_CLASS1_INFORMATION, evRead.vscp_class);
+  ASSERT_EQ(1, evRead.sizeData);
+  EXPECT_EQ(7, evRead.pdata[0]);
+  delete[] evRead.pdata;
+}
+
+TEST(vscpShmChannel, Full)
+{
+  vscpShmChannel srv, cli;
+  vscpEvent ev;
+  uint8_t data[3];
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, srv.create(4));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, attachClient(srv, cli));
+
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(VSCP_ERROR_SUCCESS, srv.put(ev));
+  }
+  EXPECT_EQ(VSCP_ERROR_FIFO_FULL, srv.put(ev));
+
+  // Room again after the client has read one
+  vscpEvent evRead;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, cli.get(evRead));
+  delete[] evRead.pdata;
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, srv.put(ev));
+
+  cli.flush();
+  EXPECT_EQ(0u, cli.getCount());
+}
+
+TEST(vscpShmChannel, InvalidEvent)
+{
+  vscpShmChannel srv;
+  vscpEvent ev;
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, srv.create(4));
+
+  memset(&ev, 0, sizeof(ev));
+  ev.sizeData = VSCP_MAX_DATA + 1;
+  EXPECT_EQ(VSCP_ERROR_PARAMETER, srv.put(ev));
+
+  ev.sizeData = 2;
+  ev.pdata    = nullptr;
+  EXPECT_EQ(VSCP_ERROR_PARAMETER, srv.put(ev));
+}
+
+TEST(vscpShmChannel, Doorbell)
+{
+  vscpShmChannel srv, cli;
+  vscpEvent ev;
+  uint8_t data[3];
+  struct pollfd pfd;
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, srv.create(4));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, attachClient(srv, cli));
+
+  pfd.fd     = srv.getDoorbell();
+  pfd.events = POLLIN;
+
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+
+  // Not waiting, no doorbell
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, cli.put(ev));
+  EXPECT_EQ(0, poll(&pfd, 1, 0));
+
+  // Events waiting, not safe to sleep
+  EXPECT_FALSE(srv.arm());
+  srv.flush();
+
+  // Waiting, the next event rings
+  EXPECT_TRUE(srv.arm());
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, cli.put(ev));
+  EXPECT_EQ(1, poll(&pfd, 1, 0));
+  srv.clearDoorbell();
+  EXPECT_EQ(0, poll(&pfd, 1, 0));
+
+  // Only once per arm
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, cli.put(ev));
+  EXPECT_EQ(0, poll(&pfd, 1, 0));
+}
+
+TEST(vscpShmChannel, CorruptRing)
+{
+  vscpShmChannel srv, cli;
+  vscpEvent ev, evRead;
+  uint8_t data[3];
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, srv.create(4));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, attachClient(srv, cli));
+
+  // The client scribbles over the segment through its own mapping
+  uint8_t *pmap = (uint8_t *) mmap(NULL, srv.getSize(), PROT_READ | PROT_WRITE, MAP_SHARED, srv.getSegment(), 0);
+  ASSERT_NE(MAP_FAILED, (void *) pmap);
+  vscp_shm_header *phdr = (vscp_shm_header *) pmap;
+  vscp_shm_ring *pring  = (vscp_shm_ring *) (pmap + phdr->offsetRing[vscpShmChannel::RING_TO_SERVER]);
+  uint8_t *pslots       = pmap + phdr->offsetSlots[vscpShmChannel::RING_TO_SERVER];
+
+  // Frame size out of range
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, cli.put(ev));
+  uint32_t size = 0xffffff;
+  memcpy(pslots, &size, sizeof(size));
+  EXPECT_EQ(VSCP_ERROR_INVALID_FRAME, srv.get(evRead));
+
+  // Bad frame
+  memset(pslots, 0, VSCP_SHM_SLOT_SIZE);
+  size = 60;
+  memcpy(pslots, &size, sizeof(size));
+  memset(pslots + 8, 0xff, size);
+  EXPECT_EQ(VSCP_ERROR_INVALID_FRAME, srv.get(evRead));
+
+  // Head moved past what fits in the ring
+  pring->head.store(pring->head.load() + 100);
+  EXPECT_EQ(VSCP_ERROR_INVALID_FRAME, srv.get(evRead));
+
+  munmap(pmap, srv.getSize());
+}
+
+TEST(vscpShmChannel, AttachRejectsInvalid)
+{
+  vscpShmChannel srv, cli;
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, srv.create(4));
+
+  // Wrong size
+  EXPECT_NE(VSCP_ERROR_SUCCESS,
+            cli.attach(dup(srv.getSegment()),
+                       dup(srv.getDoorbellToServer()),
+                       dup(srv.getDoorbellToClient()),
+                       srv.getSize() + 64));
+  EXPECT_FALSE(cli.isOpen());
+
+  // Missing descriptor
+  EXPECT_EQ(VSCP_ERROR_PARAMETER, cli.attach(dup(srv.getSegment()), -1, -1, srv.getSize()));
+  EXPECT_FALSE(cli.isOpen());
+}
+
+//-----------------------------------------------------------------------------
+// Server and client
+//-----------------------------------------------------------------------------
+
+class ShmServerTest : public ::testing::Test {
+protected:
+  void SetUp() override
+  {
+    m_path = socketPath();
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, m_server.start(m_path, [this](uint32_t id, vscpEvent &ev) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_ids.push_back(id);
+      m_classes.push_back(ev.vscp_class);
+    }));
+  }
+
+  void TearDown() override { m_server.stop(); }
+
+  size_t receivedCount(void)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_classes.size();
+  }
+
+  std::string m_path;
+  vscpShmServer m_server;
+  std::mutex m_mutex;
+  std::vector<uint32_t> m_ids;
+  std::vector<uint16_t> m_classes;
+};
+
+TEST_F(ShmServerTest, ConnectAndSend)
+{
+  vscpClientShm client;
+  vscpEvent ev;
+  uint8_t data[3];
+
+  EXPECT_EQ(CVscpClient::connType::SHM, client.getType());
+
+  client.init(m_path, 64);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+  EXPECT_TRUE(client.isConnected());
+  EXPECT_TRUE(waitFor([this]() { return 1 == m_server.getClientCount(); }));
+
+  // More than fits in the ring, the client waits for room
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, client.send(ev));
+  }
+
+  EXPECT_TRUE(waitFor([this]() { return 1000 == receivedCount(); }));
+  EXPECT_EQ(1000u, m_server.getReceiveCount());
+  EXPECT_EQ(0u, client.getSendFailCount());
+
+  client.disconnect();
+  EXPECT_FALSE(client.isConnected());
+}
+
+TEST_F(ShmServerTest, ReceiveFromServer)
+{
+  vscpClientShm client;
+  vscpEvent ev, evRead;
+  vscpEventEx ex;
+  uint8_t data[3];
+  uint16_t cnt;
+
+  client.init(m_path);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+  ASSERT_TRUE(waitFor([this]() { return 1 == m_server.getClientCount(); }));
+
+  EXPECT_EQ(VSCP_ERROR_TIMEOUT, client.receiveBlocking(evRead, 10));
+
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 2);
+  EXPECT_EQ(1u, m_server.sendAll(ev));
+  EXPECT_EQ(1u, m_server.sendAll(ev));
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, client.getcount(&cnt));
+  EXPECT_EQ(2, cnt);
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.receiveBlocking(evRead, 1000));
+  EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, evRead.vscp_class);
+  EXPECT_EQ(2, evRead.GUID[15]);
+  delete[] evRead.pdata;
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.receive(ex));
+  EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, ex.vscp_class);
+  EXPECT_EQ(3, ex.sizeData);
+
+  // Wakes up a blocked receiver
+  std::thread t([this, &ev]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    m_server.sendAll(ev);
+  });
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, client.receiveBlocking(evRead, 2000));
+  delete[] evRead.pdata;
+  t.join();
+}
+
+TEST_F(ShmServerTest, Filter)
+{
+  vscpClientShm client;
+  vscpEventFilter filter;
+  vscpEvent ev, evRead;
+  uint8_t data[3];
+
+  memset(&filter, 0, sizeof(filter));
+  filter.filter_class = VSCP_CLASS1_INFORMATION;
+  filter.mask_class   = 0xffff;
+  client.setfilter(filter);
+
+  client.init(m_path);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+  ASSERT_TRUE(waitFor([this]() { return 1 == m_server.getClientCount(); }));
+
+  // The filter follows the hello, wait until the server has it
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+  EXPECT_TRUE(waitFor([this, &ev]() { return 0 == m_server.sendAll(ev); }));
+
+  client.clear();
+
+  makeEvent(ev, data, VSCP_CLASS1_INFORMATION, VSCP_TYPE_INFORMATION_ON, 2);
+  EXPECT_EQ(1u, m_server.sendAll(ev));
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.receiveBlocking(evRead, 1000));
+  EXPECT_EQ(VSCP_CLASS1_INFORMATION, evRead.vscp_class);
+  delete[] evRead.pdata;
+  EXPECT_EQ(VSCP_ERROR_FIFO_EMPTY, client.receive(evRead));
+}
+
+TEST_F(ShmServerTest, Callback)
+{
+  vscpClientShm client;
+  vscpEvent ev;
+  uint8_t data[3];
+  std::atomic<int> cnt(0);
+
+  client.setCallbackEv([&cnt](vscpEvent &ev, void *) {
+    if (VSCP_CLASS1_MEASUREMENT == ev.vscp_class) {
+      cnt++;
+    }
+  });
+
+  client.init(m_path);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+  ASSERT_TRUE(waitFor([this]() { return 1 == m_server.getClientCount(); }));
+
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+  for (int i = 0; i < 100; i++) {
+    if (0 == m_server.sendAll(ev)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      i--;
+    }
+  }
+
+  EXPECT_TRUE(waitFor([&cnt]() { return 100 == cnt; }));
+}
+
+TEST_F(ShmServerTest, ClientToClient)
+{
+  vscpClientShm client1, client2;
+  vscpEvent ev, evRead;
+  uint8_t data[3];
+
+  // Forward events from one client to the others
+  m_server.stop();
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, m_server.start(m_path, [this](uint32_t id, vscpEvent &ev) {
+    m_server.sendAll(ev, id);
+  }));
+
+  client1.init(m_path);
+  client2.init(m_path);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client1.connect());
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client2.connect());
+  ASSERT_TRUE(waitFor([this]() { return 2 == m_server.getClientCount(); }));
+
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 3);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client1.send(ev));
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client2.receiveBlocking(evRead, 1000));
+  EXPECT_EQ(3, evRead.GUID[15]);
+  delete[] evRead.pdata;
+
+  // Not back to the sender
+  EXPECT_EQ(VSCP_ERROR_TIMEOUT, client1.receiveBlocking(evRead, 50));
+}
+
+TEST_F(ShmServerTest, ClientGoesAway)
+{
+  vscpEvent ev;
+  uint8_t data[3];
+
+  {
+    vscpClientShm client;
+    client.init(m_path);
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+    ASSERT_TRUE(waitFor([this]() { return 1 == m_server.getClientCount(); }));
+
+    // Sent right before going away, still delivered
+    makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, client.send(ev));
+  }
+
+  EXPECT_TRUE(waitFor([this]() { return 0 == m_server.getClientCount(); }));
+  EXPECT_EQ(1u, receivedCount());
+  EXPECT_EQ(0u, m_server.sendAll(ev));
+}
+
+TEST_F(ShmServerTest, ClientProcessKilled)
+{
+  pid_t pid = fork();
+  ASSERT_NE(-1, pid);
+
+  if (0 == pid) {
+    vscpClientShm client;
+    client.init(m_path);
+    if (VSCP_ERROR_SUCCESS != client.connect()) {
+      _exit(1);
+    }
+    pause();
+    _exit(0);
+  }
+
+  EXPECT_TRUE(waitFor([this]() { return 1 == m_server.getClientCount(); }));
+  kill(pid, SIGKILL);
+  waitpid(pid, NULL, 0);
+  EXPECT_TRUE(waitFor([this]() { return 0 == m_server.getClientCount(); }));
+}
+
+TEST_F(ShmServerTest, ServerGoesAway)
+{
+  vscpClientShm client;
+  vscpEvent ev;
+  uint8_t data[3];
+
+  client.init(m_path);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.connect());
+  ASSERT_TRUE(waitFor([this]() { return 1 == m_server.getClientCount(); }));
+
+  m_server.stop();
+  EXPECT_TRUE(waitFor([&client]() { return !client.isConnected(); }));
+
+  makeEvent(ev, data, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, 1);
+  EXPECT_EQ(VSCP_ERROR_NOT_CONNECTED, client.send(ev));
+  EXPECT_EQ(VSCP_ERROR_CONNECTION, client.connect());
+}
+
+TEST_F(ShmServerTest, SocketInUse)
+{
+  vscpShmServer server;
+  EXPECT_EQ(VSCP_ERROR_ALREADY_DEFINED, server.start(m_path, nullptr));
+}
+
+TEST_F(ShmServerTest, MaxClients)
+{
+  vscpClientShm client1, client2;
+
+  m_server.stop();
+  m_server.setOptions(VSCP_SHM_DEFAULT_QUEUE_SIZE, 1);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, m_server.start(m_path, nullptr));
+
+  client1.init(m_path);
+  client2.init(m_path);
+  client2.setConnectionTimeout(500);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client1.connect());
+  EXPECT_NE(VSCP_ERROR_SUCCESS, client2.connect());
+  EXPECT_FALSE(client2.isConnected());
+}
+
+TEST(vscpClientShm, Config)
+{
+  vscpClientShm client;
+
+  EXPECT_TRUE(client.initFromJson("{\"path\": \"/tmp/x.sock\", \"queue-size\": 256, \"response-timeout\": 50, "
+                                  "\"filter\": {\"in-filter\": \"0,10,6,00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:00\","
+                                  "\"in-mask\": \"0,65535,255,00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:00\"}}"));
+  EXPECT_EQ(50u, client.getResponseTimeout());
+
+  json j = json::parse(client.getConfigAsJson());
+  EXPECT_EQ("/tmp/x.sock", j["path"].get<std::string>());
+  EXPECT_EQ(256u, j["queue-size"].get<uint32_t>());
+  EXPECT_TRUE(j["filter"]["in-filter"].get<std::string>().find("10,6") != std::string::npos);
+
+  EXPECT_FALSE(client.initFromJson("{ not json"));
+}
+
+TEST(vscpClientShm, NoServer)
+{
+  vscpClientShm client;
+  vscpEvent ev;
+
+  client.init("/tmp/vscp-shm-test-none.sock");
+  EXPECT_EQ(VSCP_ERROR_CONNECTION, client.connect());
+  EXPECT_FALSE(client.isConnected());
+  EXPECT_EQ(VSCP_ERROR_NOT_CONNECTED, client.receive(ev));
+}
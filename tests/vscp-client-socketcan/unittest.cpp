@@ -44,7 +44,7 @@ TEST(VscpClientSocketCan, ConstructorNotConnected)
 TEST(VscpClientSocketCan, ReceiveQueueInitiallyEmpty)
 {
   vscpClientSocketCan client;
-  EXPECT_TRUE(client.m_receiveList.empty());
+  EXPECT_TRUE(client.m_receiveRing.empty());
 }
 
 TEST(VscpClientSocketCan, DefaultGuidAllZeros)
@@ -540,3 +540,343 @@ TEST(VscpClientSocketCan, DisconnectWhenNotRunning)
   int rv        = client.disconnect();
   EXPECT_EQ(VSCP_ERROR_SUCCESS, rv);
 }
+
+// ---------------------------------------------------------------------------
+//                          Receive ring
+// ---------------------------------------------------------------------------
+
+TEST(VscpClientSocketCan, RingSizeIsRoundedToPowerOfTwo)
+{
+  CSocketCanEventRing ring(5);
+  int n = 0;
+  while (nullptr != ring.reserve()) {
+    ring.commit();
+    n++;
+  }
+  EXPECT_EQ(8, n);
+  EXPECT_EQ(8u, ring.size());
+  EXPECT_EQ(1u, ring.getOverruns());
+}
+
+TEST(VscpClientSocketCan, RingIsFifo)
+{
+  CSocketCanEventRing ring(4);
+  for (int i = 0; i < 3; i++) {
+    vscpEvent *pev = ring.reserve();
+    ASSERT_NE(nullptr, pev);
+    ASSERT_NE(nullptr, pev->pdata);
+    pev->vscp_type = i;
+    ring.commit();
+  }
+
+  for (int i = 0; i < 3; i++) {
+    vscpEvent *pev = ring.front();
+    ASSERT_NE(nullptr, pev);
+    EXPECT_EQ(i, pev->vscp_type);
+    ring.pop();
+  }
+
+  EXPECT_TRUE(ring.empty());
+  EXPECT_EQ(nullptr, ring.front());
+}
+
+TEST(VscpClientSocketCan, RingReserveWithoutCommitIsInvisible)
+{
+  CSocketCanEventRing ring(4);
+  ASSERT_NE(nullptr, ring.reserve());
+  EXPECT_TRUE(ring.empty());
+  EXPECT_EQ(nullptr, ring.front());
+}
+
+TEST(VscpClientSocketCan, RingWrapsAround)
+{
+  CSocketCanEventRing ring(4);
+  for (int i = 0; i < 100; i++) {
+    vscpEvent *pev = ring.reserve();
+    ASSERT_NE(nullptr, pev);
+    pev->vscp_class = i;
+    ring.commit();
+    ASSERT_EQ(i, ring.front()->vscp_class);
+    ring.pop();
+  }
+  EXPECT_TRUE(ring.empty());
+  EXPECT_EQ(0u, ring.getOverruns());
+}
+
+TEST(VscpClientSocketCan, ReceiveFromRing)
+{
+  vscpClientSocketCan client;
+
+  vscpEvent *pev = client.m_receiveRing.reserve();
+  ASSERT_NE(nullptr, pev);
+  pev->vscp_class = VSCP_CLASS1_MEASUREMENT;
+  pev->vscp_type  = 6;
+  pev->sizeData   = 2;
+  pev->pdata[0]   = 0x11;
+  pev->pdata[1]   = 0x22;
+  client.m_receiveRing.commit();
+
+  uint16_t cnt = 0;
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, client.getcount(&cnt));
+  EXPECT_EQ(1, cnt);
+
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.receive(ev));
+  EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, ev.vscp_class);
+  EXPECT_EQ(6, ev.vscp_type);
+  ASSERT_EQ(2, ev.sizeData);
+  EXPECT_EQ(0x22, ev.pdata[1]);
+  delete[] ev.pdata;
+
+  EXPECT_TRUE(client.m_receiveRing.empty());
+}
+
+TEST(VscpClientSocketCan, ReceiveExFromRing)
+{
+  vscpClientSocketCan client;
+
+  vscpEvent *pev = client.m_receiveRing.reserve();
+  ASSERT_NE(nullptr, pev);
+  pev->vscp_class = VSCP_CLASS1_MEASUREMENT;
+  pev->vscp_type  = 6;
+  pev->GUID[15]   = 0x42;
+  pev->sizeData   = 2;
+  pev->pdata[0]   = 0x11;
+  pev->pdata[1]   = 0x22;
+  client.m_receiveRing.commit();
+
+  vscpEventEx ex;
+  memset(&ex, 0, sizeof(ex));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, client.receive(ex));
+  EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, ex.vscp_class);
+  EXPECT_EQ(6, ex.vscp_type);
+  EXPECT_EQ(0x42, ex.GUID[15]);
+  ASSERT_EQ(2, ex.sizeData);
+  EXPECT_EQ(0x11, ex.data[0]);
+  EXPECT_EQ(0x22, ex.data[1]);
+
+  EXPECT_TRUE(client.m_receiveRing.empty());
+  EXPECT_EQ(VSCP_ERROR_FIFO_EMPTY, client.receive(ex));
+}
+
+TEST(VscpClientSocketCan, ClearEmptiesRing)
+{
+  vscpClientSocketCan client;
+  for (int i = 0; i < 3; i++) {
+    ASSERT_NE(nullptr, client.m_receiveRing.reserve());
+    client.m_receiveRing.commit();
+  }
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, client.clear());
+  EXPECT_TRUE(client.m_receiveRing.empty());
+}
+
+// ---------------------------------------------------------------------------
+//                       Frame conversion
+// ---------------------------------------------------------------------------
+
+TEST(VscpClientSocketCan, FrameToEventClassic)
+{
+  struct canfd_frame frame;
+  memset(&frame, 0, sizeof(frame));
+  frame.can_id = CAN_EFF_FLAG | (3 << 26) | (VSCP_CLASS1_MEASUREMENT << 16) | (6 << 8) | 0x42;
+  frame.len    = 3;
+  frame.data[0] = 1;
+  frame.data[2] = 3;
+
+  uint8_t data[SOCKETCAN_MAX_DATA];
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.pdata = data;
+
+  ASSERT_TRUE(vscpClientSocketCan::frameToEvent(&ev, &frame, CAN_MTU, 1234));
+  EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, ev.vscp_class);
+  EXPECT_EQ(6, ev.vscp_type);
+  EXPECT_EQ(0x42, ev.GUID[VSCP_GUID_LSB]);
+  EXPECT_EQ(3, vscp_getEventPriority(&ev));
+  EXPECT_EQ(1234u, ev.timestamp);
+  ASSERT_EQ(3, ev.sizeData);
+  EXPECT_EQ(3, ev.pdata[2]);
+  EXPECT_EQ(data, ev.pdata);
+}
+
+TEST(VscpClientSocketCan, FrameToEventFD)
+{
+  struct canfd_frame frame;
+  memset(&frame, 0, sizeof(frame));
+  frame.can_id = CAN_EFF_FLAG | (VSCP_CLASS1_MEASUREMENT << 16) | (6 << 8) | 1;
+  frame.len    = 64;
+  for (int i = 0; i < 64; i++) {
+    frame.data[i] = i;
+  }
+
+  uint8_t data[SOCKETCAN_MAX_DATA];
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.pdata = data;
+
+  ASSERT_TRUE(vscpClientSocketCan::frameToEvent(&ev, &frame, CANFD_MTU, 0));
+  ASSERT_EQ(64, ev.sizeData);
+  EXPECT_EQ(63, ev.pdata[63]);
+
+  // Classic frame can never carry more than eight bytes
+  ASSERT_TRUE(vscpClientSocketCan::frameToEvent(&ev, &frame, CAN_MTU, 0));
+  EXPECT_EQ(8, ev.sizeData);
+}
+
+TEST(VscpClientSocketCan, FrameToEventRejectsStandardAndShortFrames)
+{
+  struct canfd_frame frame;
+  memset(&frame, 0, sizeof(frame));
+  frame.can_id = 0x123; // Standard id
+
+  uint8_t data[SOCKETCAN_MAX_DATA];
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.pdata = data;
+
+  EXPECT_FALSE(vscpClientSocketCan::frameToEvent(&ev, &frame, CAN_MTU, 0));
+
+  frame.can_id |= CAN_EFF_FLAG;
+  EXPECT_FALSE(vscpClientSocketCan::frameToEvent(&ev, &frame, 4, 0));
+}
+
+TEST(VscpClientSocketCan, CanalToFrame)
+{
+  canalMsg msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.id       = 0x0a0b0c0d;
+  msg.sizeData = 5;
+  msg.data[4]  = 0x55;
+
+  struct canfd_frame frame;
+  EXPECT_EQ((size_t) CAN_MTU, vscpClientSocketCan::canalToFrame(&frame, &msg, false));
+  EXPECT_EQ(0x0a0b0c0du | CAN_EFF_FLAG, frame.can_id);
+  EXPECT_EQ(5, frame.len);
+  EXPECT_EQ(0x55, frame.data[4]);
+
+  EXPECT_EQ((size_t) CANFD_MTU, vscpClientSocketCan::canalToFrame(&frame, &msg, true));
+  EXPECT_EQ(5, frame.len);
+}
+
+TEST(VscpClientSocketCan, SendBatchNotConnected)
+{
+  vscpClientSocketCan client;
+  canalMsg msgs[4];
+  memset(msgs, 0, sizeof(msgs));
+  uint32_t sent = 99;
+  EXPECT_EQ(VSCP_ERROR_WRITE_ERROR, client.send(msgs, 4, &sent));
+  EXPECT_EQ(0u, sent);
+  EXPECT_EQ(VSCP_ERROR_INVALID_POINTER, client.send(nullptr, 4, &sent));
+}
+
+TEST(VscpClientSocketCan, InitFDFlagSelectsFDMode)
+{
+  vscpClientSocketCan client;
+  client.init("can0", "00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:00", vscpClientSocketCan::FLAG_FD_MODE);
+  EXPECT_EQ(CANFD_MTU, client.m_mode);
+}
+
+// ---------------------------------------------------------------------------
+//                         Kernel filter translation
+// ---------------------------------------------------------------------------
+
+// Same match rule as the CAN_RAW filter in the kernel
+static bool
+canFilterMatch(const struct can_filter &cf, canid_t id)
+{
+  return (id & cf.can_mask) == (cf.can_id & cf.can_mask);
+}
+
+TEST(VscpClientSocketCan, FilterToCanFilterAcceptAll)
+{
+  vscpEventFilter filter;
+  vscp_clearVSCPFilter(&filter);
+
+  struct can_filter cf;
+  vscpClientSocketCan::filterToCanFilter(&cf, filter);
+
+  EXPECT_TRUE(canFilterMatch(cf, CAN_EFF_FLAG | (VSCP_CLASS1_MEASUREMENT << 16) | (6 << 8) | 1));
+  EXPECT_TRUE(canFilterMatch(cf, CAN_EFF_FLAG | (7 << 26) | (VSCP_CLASS1_PROTOCOL << 16) | 0xff));
+
+  // Standard frames are never VSCP
+  EXPECT_FALSE(canFilterMatch(cf, 0x123));
+}
+
+TEST(VscpClientSocketCan, FilterToCanFilterClassAndType)
+{
+  vscpEventFilter filter;
+  memset(&filter, 0, sizeof(filter));
+  filter.filter_class = VSCP_CLASS1_MEASUREMENT;
+  filter.mask_class   = 0xffff;
+  filter.filter_type  = 6;
+  filter.mask_type    = 0xff;
+
+  struct can_filter cf;
+  vscpClientSocketCan::filterToCanFilter(&cf, filter);
+
+  // Priority and nickname are don't care
+  EXPECT_TRUE(canFilterMatch(cf, CAN_EFF_FLAG | (VSCP_CLASS1_MEASUREMENT << 16) | (6 << 8) | 1));
+  EXPECT_TRUE(canFilterMatch(cf, CAN_EFF_FLAG | (5 << 26) | (VSCP_CLASS1_MEASUREMENT << 16) | (6 << 8) | 0x80));
+  EXPECT_FALSE(canFilterMatch(cf, CAN_EFF_FLAG | (VSCP_CLASS1_MEASUREMENT << 16) | (7 << 8) | 1));
+  EXPECT_FALSE(canFilterMatch(cf, CAN_EFF_FLAG | (VSCP_CLASS1_INFORMATION << 16) | (6 << 8) | 1));
+}
+
+TEST(VscpClientSocketCan, FilterToCanFilterPriorityAndNickname)
+{
+  vscpEventFilter filter;
+  memset(&filter, 0, sizeof(filter));
+  filter.filter_priority            = 2;
+  filter.mask_priority              = 0x07;
+  filter.filter_GUID[VSCP_GUID_LSB] = 0x42;
+  filter.mask_GUID[VSCP_GUID_LSB]   = 0xff;
+
+  struct can_filter cf;
+  vscpClientSocketCan::filterToCanFilter(&cf, filter);
+
+  EXPECT_TRUE(canFilterMatch(cf, CAN_EFF_FLAG | (2 << 26) | (VSCP_CLASS1_CONTROL << 16) | (3 << 8) | 0x42));
+  EXPECT_FALSE(canFilterMatch(cf, CAN_EFF_FLAG | (3 << 26) | (VSCP_CLASS1_CONTROL << 16) | (3 << 8) | 0x42));
+  EXPECT_FALSE(canFilterMatch(cf, CAN_EFF_FLAG | (2 << 26) | (VSCP_CLASS1_CONTROL << 16) | (3 << 8) | 0x43));
+}
+
+TEST(VscpClientSocketCan, KernelFilterAgreesWithUserSpaceFilter)
+{
+  vscpEventFilter filter;
+  memset(&filter, 0, sizeof(filter));
+  filter.filter_class    = VSCP_CLASS1_MEASUREMENT;
+  filter.mask_class      = 0xffff;
+  filter.filter_priority = 3;
+  filter.mask_priority   = 0x07;
+
+  struct can_filter cf;
+  vscpClientSocketCan::filterToCanFilter(&cf, filter);
+
+  uint8_t data[SOCKETCAN_MAX_DATA];
+  for (uint32_t prio = 0; prio < 8; prio++) {
+    for (uint16_t vscp_class : { VSCP_CLASS1_PROTOCOL, VSCP_CLASS1_MEASUREMENT, VSCP_CLASS1_INFORMATION }) {
+      struct canfd_frame frame;
+      memset(&frame, 0, sizeof(frame));
+      frame.can_id = CAN_EFF_FLAG | (prio << 26) | ((uint32_t) vscp_class << 16) | (6 << 8) | 1;
+
+      vscpEvent ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.pdata = data;
+      ASSERT_TRUE(vscpClientSocketCan::frameToEvent(&ev, &frame, CAN_MTU, 0));
+      EXPECT_EQ(vscp_doLevel2Filter(&ev, &filter), canFilterMatch(cf, frame.can_id));
+    }
+  }
+}
+
+TEST(VscpClientSocketCan, SetFilterStoresFilterWithoutSocket)
+{
+  vscpClientSocketCan client;
+  vscpEventFilter filter;
+  memset(&filter, 0, sizeof(filter));
+  filter.filter_class = VSCP_CLASS1_MEASUREMENT;
+  filter.mask_class   = 0xffff;
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, client.setfilter(filter));
+  EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, client.m_filterIn.filter_class);
+  EXPECT_EQ(0xffff, client.m_filterIn.mask_class);
+}
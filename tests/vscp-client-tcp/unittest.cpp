@@ -1,11 +1,23 @@
 /////////////////////////////////////////////////////////////////////////////////
 // unittest.cpp
 //
-// Unit tests for selectable TLS behavior in VscpRemoteTcpIf and vscpClientTcp.
+// Unit tests for selectable TLS behavior and pipelined send in
+// VscpRemoteTcpIf and vscpClientTcp.
 //
 
 #include <gtest/gtest.h>
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <nlohmann/json.hpp>
 #include <vscp-client-tcp.h>
 #include <vscpremotetcpif.h>
@@ -134,3 +146,475 @@ TEST(VscpClientTcpTlsSelect, InitFromJsonTlsModeParsing)
   EXPECT_EQ("force-plain", j2["tls-mode"].get<std::string>());
   EXPECT_FALSE(j2["btls"].get<bool>());
 }
+
+// ============================================================================
+//                       VscpRemoteTcpIf pipelined send
+// ============================================================================
+
+// Minimal tcp/ip interface server. Answers "+OK" to everything except
+// send commands for class 999 that get "-OK". Responses are held until
+// the client has been quiet for a while, so the number of commands
+// received before answering shows how deep the client pipelines.
+// rcvloopData is sent right after the response to RCVLOOP.
+class fakeTcpServer {
+public:
+  fakeTcpServer(const std::string &rcvloopData = "")
+  {
+    m_rcvloopData = rcvloopData;
+    m_maxBurst = 0;
+    m_nSend    = 0;
+    m_sock     = socket(AF_INET, SOCK_STREAM, 0);
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;
+    bind(m_sock, (struct sockaddr *) &addr, sizeof(addr));
+    listen(m_sock, 1);
+
+    socklen_t len = sizeof(addr);
+    getsockname(m_sock, (struct sockaddr *) &addr, &len);
+    m_port = ntohs(addr.sin_port);
+
+    m_thread = std::thread(&fakeTcpServer::run, this);
+  }
+
+  ~fakeTcpServer()
+  {
+    m_thread.join();
+    close(m_sock);
+  }
+
+  std::string getInterface(void) { return "tcp://127.0.0.1:" + std::to_string(m_port); }
+
+  std::atomic<int> m_maxBurst; // Most send commands received before answering
+  std::atomic<int> m_nSend;    // Total number of send commands
+
+private:
+  void run(void)
+  {
+    int conn = accept(m_sock, NULL, NULL);
+    if (conn < 0) {
+      return;
+    }
+
+    std::string greeting = "+OK - Welcome\r\n";
+    write(conn, greeting.c_str(), greeting.length());
+
+    std::string strIn;
+    std::string strOut;
+    int burst = 0;
+    bool bQuit = false;
+
+    while (!bQuit) {
+      struct pollfd fd;
+      fd.fd     = conn;
+      fd.events = POLLIN;
+
+      if (0 == poll(&fd, 1, 20)) {
+        // Quiet, answer what we have
+        if (strOut.length()) {
+          write(conn, strOut.c_str(), strOut.length());
+          strOut.clear();
+          if (burst > m_maxBurst) {
+            m_maxBurst = burst;
+          }
+          burst = 0;
+        }
+        continue;
+      }
+
+      char buf[4096];
+      ssize_t n = read(conn, buf, sizeof(buf));
+      if (n <= 0) {
+        break;
+      }
+      strIn.append(buf, n);
+
+      size_t pos;
+      while (std::string::npos != (pos = strIn.find('\n'))) {
+        std::string line = strIn.substr(0, pos);
+        strIn.erase(0, pos + 1);
+
+        if (0 == line.find("send ")) {
+          // send head,class,...
+          size_t comma = line.find(',');
+          int vscp_class = atoi(line.c_str() + comma + 1);
+          strOut += (999 == vscp_class) ? "-OK - Error\r\n" : "+OK - Success.\r\n";
+          burst++;
+          m_nSend++;
+        }
+        else if (0 == line.find("RCVLOOP")) {
+          strOut += "+OK - Receive loop entered.\r\n" + m_rcvloopData;
+        }
+        else if (0 == line.find("QUIT")) {
+          strOut += "+OK - Connection closed by client.\r\n";
+          bQuit = true;
+        }
+        else {
+          strOut += "+OK - Success.\r\n";
+        }
+      }
+    }
+
+    if (strOut.length()) {
+      write(conn, strOut.c_str(), strOut.length());
+    }
+    close(conn);
+  }
+
+  int m_sock;
+  unsigned short m_port;
+  std::thread m_thread;
+  std::string m_rcvloopData;
+};
+
+static void
+makeEvents(std::vector<vscpEventEx> &events, size_t count)
+{
+  events.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    memset(&events[i], 0, sizeof(vscpEventEx));
+    events[i].vscp_class = VSCP_CLASS1_MEASUREMENT;
+    events[i].vscp_type  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+    events[i].sizeData   = 3;
+    events[i].data[0]    = 0x8a;
+    events[i].data[1]    = (uint8_t) (i >> 8);
+    events[i].data[2]    = (uint8_t) i;
+  }
+}
+
+TEST(VscpRemoteTcpIfPipeline, NotConnected)
+{
+  VscpRemoteTcpIf tcpif;
+  std::vector<vscpEventEx> events;
+  makeEvents(events, 1);
+
+  EXPECT_EQ(VSCP_ERROR_CONNECTION, tcpif.doCmdSendBatchEx(events.data(), events.size()));
+  EXPECT_EQ(VSCP_ERROR_CONNECTION, tcpif.doCmdSendAsyncEx(&events[0]));
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdSendFlush());
+}
+
+TEST(VscpRemoteTcpIfPipeline, BatchIsPipelinedWithinWindow)
+{
+  fakeTcpServer server;
+  VscpRemoteTcpIf tcpif;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdOpen(server.getInterface(), "admin", "secret"));
+
+  tcpif.setSendWindow(16);
+
+  std::vector<vscpEventEx> events;
+  makeEvents(events, 200);
+  events[17].vscp_class = 999;
+  events[150].vscp_class = 999;
+
+  size_t nFailed = 0;
+  EXPECT_EQ(VSCP_ERROR_ERROR, tcpif.doCmdSendBatchEx(events.data(), events.size(), &nFailed));
+  EXPECT_EQ(2u, nFailed);
+  EXPECT_EQ(0u, tcpif.getSendOutstanding());
+  EXPECT_EQ(200, server.m_nSend);
+
+  // More than one in flight, but never more than the window
+  EXPECT_GT(server.m_maxBurst, 1);
+  EXPECT_LE(server.m_maxBurst, 16);
+
+  // Ordinary commands still work afterwards
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdNOOP());
+  tcpif.doCmdClose();
+}
+
+TEST(VscpRemoteTcpIfPipeline, AsyncCallbacksInOrder)
+{
+  fakeTcpServer server;
+  VscpRemoteTcpIf tcpif;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdOpen(server.getInterface(), "admin", "secret"));
+
+  tcpif.setSendWindow(4);
+
+  std::vector<vscpEventEx> events;
+  makeEvents(events, 10);
+  events[3].vscp_class = 999;
+
+  std::vector<std::pair<int, int>> results;
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdSendAsyncEx(&events[i], [&results, i](int rv) {
+      results.push_back(std::make_pair(i, rv));
+    }));
+    EXPECT_LE(tcpif.getSendOutstanding(), 4u);
+  }
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdSendFlush());
+  ASSERT_EQ(10u, results.size());
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(i, results[i].first);
+    EXPECT_EQ((3 == i) ? VSCP_ERROR_ERROR : VSCP_ERROR_SUCCESS, results[i].second);
+  }
+
+  // Outstanding sends are answered before the next command
+  int rv = -1;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdSendAsyncEx(&events[0], [&rv](int r) { rv = r; }));
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdNOOP());
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, rv);
+  tcpif.doCmdClose();
+}
+
+// ============================================================================
+//                       Receive loop line ring / decoder
+// ============================================================================
+
+static std::vector<std::string>
+getLines(vscpLineRing &ring)
+{
+  std::vector<std::string> lines;
+  const char *pline;
+  size_t len;
+  while (ring.getLine(&pline, &len)) {
+    lines.push_back(std::string(pline, len));
+  }
+  return lines;
+}
+
+TEST(VscpLineRing, PartialLinesAndWrap)
+{
+  vscpLineRing ring(64);
+  EXPECT_EQ(64u, ring.getSize());
+
+  // Lines split at every possible position, wrapping many times
+  std::string data;
+  for (int i = 0; i < 40; i++) {
+    data += "  line " + std::to_string(i) + " \r\n";
+  }
+
+  std::vector<std::string> lines;
+  for (size_t pos = 0; pos < data.length(); pos += 7) {
+    ring.write(data.c_str() + pos, std::min((size_t) 7, data.length() - pos));
+    std::vector<std::string> got = getLines(ring);
+    lines.insert(lines.end(), got.begin(), got.end());
+  }
+
+  ASSERT_EQ(40u, lines.size());
+  for (int i = 0; i < 40; i++) {
+    EXPECT_EQ("line " + std::to_string(i), lines[i]);
+  }
+  EXPECT_EQ(0u, ring.getCount());
+  EXPECT_EQ(0u, ring.getOverruns());
+}
+
+TEST(VscpLineRing, OverlongLineIsDropped)
+{
+  vscpLineRing ring(64);
+
+  ring.write("first\r\n", 7);
+  EXPECT_EQ(1u, getLines(ring).size());
+
+  std::string longLine(200, 'x');
+  ring.write(longLine.c_str(), longLine.length());
+  EXPECT_EQ(0u, getLines(ring).size());
+  ring.write("\r\nnext\r\n", 8);
+
+  std::vector<std::string> lines = getLines(ring);
+  ASSERT_EQ(1u, lines.size());
+  EXPECT_EQ("next", lines[0]);
+  EXPECT_GT(ring.getOverruns(), 0u);
+}
+
+TEST(VscpEventPool, Reuse)
+{
+  vscpEventPool pool(1);
+
+  vscpEvent *pev1 = pool.get();
+  ASSERT_NE(nullptr, pev1);
+  ASSERT_NE(nullptr, pev1->pdata);
+  EXPECT_EQ(0, pev1->sizeData);
+  pev1->sizeData = 8;
+  vscpEvent *pev2 = pool.get();
+  EXPECT_NE(pev1, pev2);
+
+  pool.put(pev1);
+  pool.put(pev2); // Above max free, deleted
+  EXPECT_EQ(1u, pool.getFreeCount());
+
+  vscpEvent *pev3 = pool.get();
+  EXPECT_EQ(pev1, pev3);
+  EXPECT_EQ(0, pev3->sizeData);
+  pool.put(pev3);
+}
+
+// Decode line with both the direct decoder and the generic parser.
+// bTimestamp is false for lines where the timestamp is generated.
+static void
+expectSameAsGeneric(const std::string &line, bool bTimestamp = true)
+{
+  SCOPED_TRACE(line);
+
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.pdata = data;
+
+  vscpEvent ref;
+  memset(&ref, 0, sizeof(ref));
+  bool bRef = vscp_convertStringToEvent(&ref, line);
+
+  ASSERT_EQ(bRef, VscpRemoteTcpIf::parseEventLine(&ev, line.c_str(), line.length()));
+  if (!bRef) {
+    return;
+  }
+
+  EXPECT_EQ(ref.head, ev.head);
+  EXPECT_EQ(ref.vscp_class, ev.vscp_class);
+  EXPECT_EQ(ref.vscp_type, ev.vscp_type);
+  EXPECT_EQ(ref.obid, ev.obid);
+  EXPECT_EQ(ref.year, ev.year);
+  EXPECT_EQ(ref.month, ev.month);
+  EXPECT_EQ(0, memcmp(ref.GUID, ev.GUID, 16));
+  ASSERT_EQ(ref.sizeData, ev.sizeData);
+  if (ref.sizeData) {
+    EXPECT_EQ(0, memcmp(ref.pdata, ev.pdata, ref.sizeData));
+  }
+
+  if (bTimestamp) {
+    EXPECT_EQ(ref.timestamp_ns, ev.timestamp_ns);
+  }
+
+  delete[] ref.pdata;
+}
+
+TEST(VscpRemoteTcpIfParse, MatchesGenericParser)
+{
+  // As written by the server
+  for (int i = 0; i < 100; i++) {
+    vscpEventEx ex;
+    memset(&ex, 0, sizeof(ex));
+    ex.head         = VSCP_HEADER16_FRAME_VERSION_UNIX_NS | (uint16_t) (i * 7);
+    ex.vscp_class   = (uint16_t) (i * 131);
+    ex.vscp_type    = (uint16_t) (i * 17);
+    ex.obid         = (uint32_t) i * 100003;
+    ex.timestamp_ns = 1700000000000000000ULL + i;
+    ex.sizeData     = (uint16_t) (i * 5);
+    for (int j = 0; j < 16; j++) {
+      ex.GUID[j] = (uint8_t) (i + j * 31);
+    }
+    for (int j = 0; j < ex.sizeData; j++) {
+      ex.data[j] = (uint8_t) (i ^ j);
+    }
+    std::string str;
+    ASSERT_TRUE(vscp_convertEventExToString(str, &ex));
+    expectSameAsGeneric(str);
+  }
+
+  // Forms handled by the generic parser
+  expectSameAsGeneric("0,10,6,0,,0,-,1,2,3", false);
+  expectSameAsGeneric("0,10,6,0,,,-", false);
+  expectSameAsGeneric(" 0x10 , 010 , 0b11 ,0o7,,0100,FF:EE:DD:CC:BB:AA:99:88:77:66:55:44:33:22:11:00,0x1,2");
+  expectSameAsGeneric("0,10,6,0,2024-01-02T03:04:05Z,12,-,1");
+  expectSameAsGeneric("0,10,6,0,,5,1:2:3,0xff");
+  expectSameAsGeneric("0,10,6,0,,5,-,");
+  expectSameAsGeneric("0,10,6,0,,5,-,x");
+  expectSameAsGeneric("0,10,6,0,,5,-,99999999999999999999");
+  expectSameAsGeneric("0,10,6");
+  expectSameAsGeneric("+OK - Success.");
+
+  // More data than an event can hold
+  std::string str = "0,10,6,0,,5,-";
+  for (int i = 0; i < VSCP_MAX_DATA + 1; i++) {
+    str += ",1";
+  }
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  ev.pdata = data;
+  EXPECT_FALSE(VscpRemoteTcpIf::parseEventLine(&ev, str.c_str(), str.length()));
+}
+
+TEST(VscpRemoteTcpIfParse, ServerLineTakesFastPath)
+{
+  vscpEventEx ex;
+  memset(&ex, 0, sizeof(ex));
+  ex.head         = VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  ex.vscp_class   = VSCP_CLASS1_MEASUREMENT;
+  ex.vscp_type    = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+  ex.obid         = 4711;
+  ex.timestamp_ns = vscp_makeTimeStampNs();
+  ex.sizeData     = 3;
+  ex.data[0]      = 0x8a;
+  ex.data[1]      = 0x00;
+  ex.data[2]      = 0xff;
+  for (int j = 0; j < 16; j++) {
+    ex.GUID[j] = (uint8_t) (0xf0 + j);
+  }
+
+  std::string str;
+  ASSERT_TRUE(vscp_convertEventExToString(str, &ex));
+
+  uint8_t data[VSCP_MAX_DATA];
+  vscpEvent ev;
+  ev.pdata = data;
+  ASSERT_TRUE(VscpRemoteTcpIf::parseEventLineFast(&ev, str.c_str(), str.length())) << str;
+  EXPECT_EQ(ex.timestamp_ns, ev.timestamp_ns);
+  EXPECT_EQ(ex.obid, ev.obid);
+  EXPECT_EQ(0, memcmp(ex.GUID, ev.GUID, 16));
+  ASSERT_EQ(3, ev.sizeData);
+  EXPECT_EQ(0, memcmp(ex.data, ev.pdata, 3));
+
+  // Largest and one past the largest timestamp
+  str = "0,10,6,0,,18446744073709551615,-";
+  EXPECT_TRUE(VscpRemoteTcpIf::parseEventLineFast(&ev, str.c_str(), str.length()));
+  EXPECT_EQ(UINT64_MAX, ev.timestamp_ns);
+  str = "0,10,6,0,,18446744073709551616,-";
+  EXPECT_FALSE(VscpRemoteTcpIf::parseEventLineFast(&ev, str.c_str(), str.length()));
+}
+
+TEST(VscpRemoteTcpIfReceiveLoop, EventsAndWakeup)
+{
+  std::vector<vscpEventEx> events;
+  makeEvents(events, 300);
+
+  std::string data;
+  for (size_t i = 0; i < events.size(); i++) {
+    std::string str;
+    vscp_convertEventExToString(str, &events[i]);
+    data += str + "\r\n";
+  }
+
+  fakeTcpServer server(data);
+  VscpRemoteTcpIf tcpif;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdOpen(server.getInterface(), "admin", "secret"));
+
+  vscpEventPool pool;
+  EXPECT_EQ(VSCP_ERROR_PARAMETER, tcpif.doCmdReceiveLoopRead(pool, [](vscpEvent *) {}));
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, tcpif.doCmdEnterReceiveLoop());
+
+  std::vector<vscpEvent *> received;
+  auto handler = [&received](vscpEvent *pev) { received.push_back(pev); };
+  for (int i = 0; (i < 100) && (received.size() < events.size()); i++) {
+    int rv = tcpif.doCmdReceiveLoopRead(pool, handler, 100);
+    ASSERT_TRUE((VSCP_ERROR_SUCCESS == rv) || (VSCP_ERROR_TIMEOUT == rv));
+  }
+
+  ASSERT_EQ(events.size(), received.size());
+  for (size_t i = 0; i < events.size(); i++) {
+    EXPECT_EQ(events[i].vscp_class, received[i]->vscp_class);
+    ASSERT_EQ(3, received[i]->sizeData);
+    EXPECT_EQ(events[i].data[2], received[i]->pdata[2]);
+    pool.put(received[i]);
+  }
+
+  // Wake up ends a long wait
+  int fds[2];
+  ASSERT_EQ(0, pipe(fds));
+  std::thread t([&fds]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    char c = 0;
+    write(fds[1], &c, 1);
+  });
+  uint32_t start = vscp_getMsTimeStamp();
+  EXPECT_EQ(VSCP_ERROR_TIMEOUT, tcpif.doCmdReceiveLoopRead(pool, handler, 1500, fds[0]));
+  EXPECT_LT(vscp_getMsTimeStamp() - start, 1000u);
+  t.join();
+  close(fds[0]);
+  close(fds[1]);
+
+  tcpif.doCmdClose();
+}
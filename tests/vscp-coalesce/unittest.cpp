@@ -0,0 +1,412 @@
+// unittest.cpp
+//
+// Unit tests for vscpCoalesce
+//
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vscp-coalesce.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Level I temperature with an integer value
+static void
+makeMeasurement(vscpEvent &ev,
+                uint8_t *pdata,
+                int8_t value,
+                uint8_t unit        = 1,
+                uint8_t sensorindex = 0,
+                uint8_t nickname    = 1)
+{
+  memset(&ev, 0, sizeof(ev));
+  ev.vscp_class = VSCP_CLASS1_MEASUREMENT;
+  ev.vscp_type  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+  ev.GUID[15]   = nickname;
+  pdata[0]      = VSCP_DATACODING_INTEGER | ((unit & 3) << 3) | (sensorindex & 7);
+  pdata[1]      = (uint8_t) value;
+  ev.pdata      = pdata;
+  ev.sizeData   = 2;
+}
+
+static bool
+check(vscpCoalesce &co, int8_t value, uint64_t now, uint8_t unit = 1, uint8_t sensorindex = 0, uint8_t nickname = 1)
+{
+  vscpEvent ev;
+  uint8_t data[2];
+  makeMeasurement(ev, data, value, unit, sensorindex, nickname);
+  return co.check(vscp_event_view(ev), now);
+}
+
+static double
+valueOf(const vscpEvent &ev)
+{
+  double value = -1;
+  vscp_getMeasurementAsDouble(&value, &ev);
+  return value;
+}
+
+// ---------------------------------------------------------------------------
+//                               Deduplication
+// ---------------------------------------------------------------------------
+
+TEST(VscpCoalesce, DisabledPassesAll)
+{
+  vscpCoalesce co;
+  EXPECT_FALSE(co.isEnabled());
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_TRUE(check(co, 20, 1));
+  EXPECT_EQ(0u, co.getKeyCount());
+}
+
+TEST(VscpCoalesce, NonMeasurementPasses)
+{
+  vscpCoalesce co;
+  co.enable();
+
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.vscp_class = VSCP_CLASS1_INFORMATION;
+  ev.vscp_type  = VSCP_TYPE_INFORMATION_ON;
+
+  EXPECT_TRUE(co.check(vscp_event_view(ev), 0));
+  EXPECT_TRUE(co.check(vscp_event_view(ev), 1));
+  EXPECT_EQ(0u, co.getKeyCount());
+}
+
+TEST(VscpCoalesce, UnchangedSuppressed)
+{
+  vscpCoalesce co;
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 20, 10));
+  EXPECT_FALSE(check(co, 20, 20));
+  EXPECT_TRUE(check(co, 21, 30));
+  EXPECT_FALSE(check(co, 21, 40));
+
+  EXPECT_EQ(1u, co.getKeyCount());
+  EXPECT_EQ(2u, co.getPublishCount());
+  EXPECT_EQ(3u, co.getUnchangedCount());
+}
+
+TEST(VscpCoalesce, Deadband)
+{
+  vscpCoalesce co;
+  co.setOptions(2.0);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 21, 10));
+  EXPECT_FALSE(check(co, 22, 20));
+
+  // Compared with the last published value so a slow drift is seen
+  EXPECT_TRUE(check(co, 23, 30));
+  EXPECT_FALSE(check(co, 21, 40));
+  EXPECT_TRUE(check(co, 20, 50));
+}
+
+TEST(VscpCoalesce, WindowRepublishes)
+{
+  vscpCoalesce co;
+  co.setOptions(0, 1000);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 20, 999));
+  EXPECT_TRUE(check(co, 20, 1000));
+  EXPECT_FALSE(check(co, 20, 1500));
+  EXPECT_TRUE(check(co, 20, 2000));
+}
+
+TEST(VscpCoalesce, NoWindowSuppressesForEver)
+{
+  vscpCoalesce co;
+  co.setOptions(0, 0);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 20, 1000000));
+}
+
+TEST(VscpCoalesce, UnitChangeIsChange)
+{
+  vscpCoalesce co;
+  co.setOptions(10.0);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0, 1));
+  EXPECT_FALSE(check(co, 20, 10, 1));
+  EXPECT_TRUE(check(co, 20, 20, 2));
+}
+
+TEST(VscpCoalesce, SeparateKeys)
+{
+  vscpCoalesce co;
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0, 1, 0, 1));
+  EXPECT_TRUE(check(co, 20, 0, 1, 1, 1)); // Other sensor index
+  EXPECT_TRUE(check(co, 20, 0, 1, 0, 2)); // Other node
+  EXPECT_FALSE(check(co, 20, 10, 1, 0, 1));
+  EXPECT_FALSE(check(co, 20, 10, 1, 1, 1));
+  EXPECT_FALSE(check(co, 20, 10, 1, 0, 2));
+  EXPECT_EQ(3u, co.getKeyCount());
+}
+
+TEST(VscpCoalesce, ZoneIsPartOfKey)
+{
+  vscpCoalesce co;
+  co.enable();
+
+  // Measurement with zone, index/zone/subzone/coding/value
+  uint8_t data[5] = { 0, 1, 0, VSCP_DATACODING_INTEGER | (1 << 3), 20 };
+  vscpEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.vscp_class = VSCP_CLASS1_MEASUREZONE;
+  ev.vscp_type  = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+  ev.pdata      = data;
+  ev.sizeData   = sizeof(data);
+
+  EXPECT_TRUE(co.check(vscp_event_view(ev), 0));
+  EXPECT_FALSE(co.check(vscp_event_view(ev), 10));
+  data[1] = 2;
+  EXPECT_TRUE(co.check(vscp_event_view(ev), 20));
+  data[2] = 3;
+  EXPECT_TRUE(co.check(vscp_event_view(ev), 30));
+  EXPECT_EQ(3u, co.getKeyCount());
+}
+
+TEST(VscpCoalesce, EventEx)
+{
+  vscpCoalesce co;
+  co.enable();
+
+  vscpEvent ev;
+  uint8_t data[2];
+  makeMeasurement(ev, data, 20);
+
+  vscpEventEx ex;
+  memset(&ex, 0, sizeof(ex));
+  ASSERT_TRUE(vscp_convertEventToEventEx(&ex, &ev));
+
+  EXPECT_TRUE(co.check(vscp_event_view(ev), 0));
+  EXPECT_FALSE(co.check(vscp_event_view(ex), 10));
+}
+
+TEST(VscpCoalesce, MaxKeys)
+{
+  vscpCoalesce co;
+  co.setOptions(0, VSCP_COALESCE_DEFAULT_WINDOW, 0, 2);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0, 1, 0));
+  EXPECT_TRUE(check(co, 20, 0, 1, 1));
+  EXPECT_TRUE(check(co, 20, 0, 1, 2));
+  EXPECT_TRUE(check(co, 20, 10, 1, 2));
+  EXPECT_FALSE(check(co, 20, 10, 1, 0));
+
+  EXPECT_EQ(2u, co.getKeyCount());
+  EXPECT_EQ(2u, co.getUntrackedCount());
+}
+
+TEST(VscpCoalesce, Clear)
+{
+  vscpCoalesce co;
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 20, 10));
+  co.clear();
+  EXPECT_EQ(0u, co.getKeyCount());
+  EXPECT_TRUE(check(co, 20, 20));
+}
+
+// ---------------------------------------------------------------------------
+//                               Rate limiting
+// ---------------------------------------------------------------------------
+
+TEST(VscpCoalesce, RateLimitHoldsLatest)
+{
+  vscpCoalesce co;
+  co.setOptions(0, VSCP_COALESCE_DEFAULT_WINDOW, 100);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 21, 10));
+  EXPECT_FALSE(check(co, 22, 20));
+  EXPECT_EQ(1u, co.getPendingCount());
+  EXPECT_EQ(2u, co.getRateLimitCount());
+
+  EXPECT_FALSE(co.isDue(99));
+  EXPECT_TRUE(co.isDue(100));
+
+  std::vector<double> values;
+  auto fn = [&values](vscpEvent &ev) {
+    values.push_back(valueOf(ev));
+  };
+
+  EXPECT_EQ(0u, co.flush(fn, 50));
+  EXPECT_EQ(1u, co.flush(fn, 100));
+  ASSERT_EQ(1u, values.size());
+  EXPECT_EQ(22, values[0]);
+  EXPECT_EQ(0u, co.getPendingCount());
+  EXPECT_EQ(1u, co.getFlushCount());
+  EXPECT_FALSE(co.isDue(1000));
+
+  // The flushed value is now the published value
+  EXPECT_FALSE(check(co, 22, 150));
+  EXPECT_FALSE(check(co, 23, 150));
+  EXPECT_EQ(1u, co.getPendingCount());
+  EXPECT_TRUE(check(co, 23, 200));
+  EXPECT_EQ(0u, co.getPendingCount());
+}
+
+TEST(VscpCoalesce, RateLimitPassesAfterInterval)
+{
+  vscpCoalesce co;
+  co.setOptions(0, VSCP_COALESCE_DEFAULT_WINDOW, 100);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 21, 50));
+
+  // A newer change after the interval goes out and replaces the held one
+  EXPECT_TRUE(check(co, 22, 100));
+  EXPECT_EQ(0u, co.getPendingCount());
+  EXPECT_EQ(0u, co.flush(nullptr, 1000));
+}
+
+TEST(VscpCoalesce, RateLimitCancelledByReturn)
+{
+  vscpCoalesce co;
+  co.setOptions(0, VSCP_COALESCE_DEFAULT_WINDOW, 100);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 21, 10));
+  EXPECT_EQ(1u, co.getPendingCount());
+
+  // Back at the published value, nothing to publish
+  EXPECT_FALSE(check(co, 20, 20));
+  EXPECT_EQ(0u, co.getPendingCount());
+  EXPECT_EQ(0u, co.flush(nullptr, 1000));
+}
+
+TEST(VscpCoalesce, FlushManyKeys)
+{
+  vscpCoalesce co;
+  co.setOptions(0, VSCP_COALESCE_DEFAULT_WINDOW, 100);
+  co.enable();
+
+  for (uint8_t idx = 0; idx < 8; idx++) {
+    EXPECT_TRUE(check(co, 20, idx * 10, 1, idx));
+    EXPECT_FALSE(check(co, 30, idx * 10 + 5, 1, idx));
+  }
+  EXPECT_EQ(8u, co.getPendingCount());
+
+  // Due at 100, 110, ... 170
+  size_t cnt = 0;
+  auto fn    = [&cnt](vscpEvent &ev) {
+    EXPECT_EQ(30, valueOf(ev));
+    cnt++;
+  };
+  EXPECT_EQ(4u, co.flush(fn, 130));
+  EXPECT_FALSE(co.isDue(139));
+  EXPECT_TRUE(co.isDue(140));
+  EXPECT_EQ(4u, co.flush(fn, 200));
+  EXPECT_EQ(8u, cnt);
+  EXPECT_EQ(0u, co.getPendingCount());
+}
+
+TEST(VscpCoalesce, FlushAllIgnoresInterval)
+{
+  vscpCoalesce co;
+  co.setOptions(0, VSCP_COALESCE_DEFAULT_WINDOW, 100);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0, 1, 0));
+  EXPECT_FALSE(check(co, 21, 10, 1, 0));
+  EXPECT_TRUE(check(co, 30, 0, 1, 1));
+  EXPECT_FALSE(check(co, 31, 10, 1, 1));
+  EXPECT_EQ(2u, co.getPendingCount());
+
+  std::vector<double> values;
+  auto fn = [&values](vscpEvent &ev) {
+    values.push_back(valueOf(ev));
+  };
+
+  EXPECT_EQ(0u, co.flush(fn, 20));
+  EXPECT_EQ(2u, co.flush(fn, 20, true));
+  ASSERT_EQ(2u, values.size());
+  EXPECT_EQ(52, values[0] + values[1]);
+  EXPECT_EQ(0u, co.getPendingCount());
+  EXPECT_EQ(2u, co.getFlushCount());
+  EXPECT_FALSE(co.isDue(1000));
+
+  // Nothing left for the interval flush
+  EXPECT_EQ(0u, co.flushAll(fn));
+}
+
+TEST(VscpCoalesce, ClearDropsPending)
+{
+  vscpCoalesce co;
+  co.setOptions(0, VSCP_COALESCE_DEFAULT_WINDOW, 100);
+  co.enable();
+
+  EXPECT_TRUE(check(co, 20, 0));
+  EXPECT_FALSE(check(co, 21, 10));
+  co.clear();
+  EXPECT_EQ(0u, co.getPendingCount());
+  EXPECT_EQ(0u, co.flush(nullptr, 1000));
+}
+
+// ---------------------------------------------------------------------------
+//                                  Threads
+// ---------------------------------------------------------------------------
+
+TEST(VscpCoalesce, ConcurrentCheck)
+{
+  vscpCoalesce co;
+  co.setOptions(0, 0, 1);
+  co.enable();
+
+  const int nThreads = 4;
+  const int nEvents  = 20000;
+  std::atomic<uint64_t> passed(0);
+  std::atomic<uint64_t> flushed(0);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nThreads; t++) {
+    threads.push_back(std::thread([&co, &passed, t]() {
+      for (int i = 0; i < nEvents; i++) {
+        if (check(co, (int8_t) (i % 7), (uint64_t) i, 1, (uint8_t) (i % 4), (uint8_t) t)) {
+          passed++;
+        }
+      }
+    }));
+  }
+  threads.push_back(std::thread([&co, &flushed]() {
+    for (int i = 0; i < 1000; i++) {
+      flushed += co.flush([](vscpEvent &) {}, (uint64_t) i * 20);
+    }
+  }));
+
+  for (size_t i = 0; i < threads.size(); i++) {
+    threads[i].join();
+  }
+
+  flushed += co.flush(nullptr, UINT64_MAX / 2);
+
+  EXPECT_EQ(16u, co.getKeyCount());
+  EXPECT_EQ(passed.load(), co.getPublishCount());
+  EXPECT_EQ(flushed.load(), co.getFlushCount());
+  EXPECT_EQ((uint64_t) (nThreads * nEvents),
+            co.getPublishCount() + co.getUnchangedCount() + co.getRateLimitCount());
+  EXPECT_EQ(0u, co.getPendingCount());
+}
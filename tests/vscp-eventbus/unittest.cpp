@@ -0,0 +1,166 @@
+// unittest.cpp
+//
+// Unit tests for vscpEventBus
+//
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vscp-eventbus.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include <thread>
+#include <vector>
+
+static void
+makeEvent(vscpEvent &ev, uint16_t vscp_class, uint16_t vscp_type, uint8_t *pdata = NULL, uint16_t size = 0)
+{
+  memset(&ev, 0, sizeof(ev));
+  ev.vscp_class = vscp_class;
+  ev.vscp_type  = vscp_type;
+  ev.pdata      = pdata;
+  ev.sizeData   = size;
+}
+
+static vscpEventFilter
+classFilter(uint16_t vscp_class)
+{
+  vscpEventFilter filter;
+  vscp_clearVSCPFilter(&filter);
+  filter.filter_class = vscp_class;
+  filter.mask_class   = 0xffff;
+  return filter;
+}
+
+// ---------------------------------------------------------------------------
+//                                 Routing
+// ---------------------------------------------------------------------------
+
+TEST(VscpEventBus, SubscribeUnsubscribe)
+{
+  vscpEventBus bus;
+  EXPECT_EQ(-1, bus.subscribe("none", NULL, nullptr));
+
+  int id = bus.subscribe("all", NULL, [](const vscpEvent &) {});
+  EXPECT_GT(id, 0);
+  EXPECT_EQ(1u, bus.getSubscriberCount());
+  EXPECT_TRUE(bus.unsubscribe(id));
+  EXPECT_FALSE(bus.unsubscribe(id));
+  EXPECT_EQ(0u, bus.getSubscriberCount());
+}
+
+TEST(VscpEventBus, FilterRouting)
+{
+  vscpEventBus bus;
+
+  int cntAll = 0, cntMeasurement = 0, cntType = 0;
+  bus.subscribe("all", NULL, [&cntAll](const vscpEvent &) { cntAll++; });
+
+  vscpEventFilter filter = classFilter(VSCP_CLASS1_MEASUREMENT);
+  bus.subscribe("measurement", &filter, [&cntMeasurement](const vscpEvent &) { cntMeasurement++; });
+
+  // Type only, class is don't care
+  vscp_clearVSCPFilter(&filter);
+  filter.filter_type = VSCP_TYPE_MEASUREMENT_TEMPERATURE;
+  filter.mask_type   = 0xffff;
+  bus.subscribe("type", &filter, [&cntType](const vscpEvent &) { cntType++; });
+
+  vscpEvent ev;
+  makeEvent(ev, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE);
+  EXPECT_EQ(3u, bus.publish(ev));
+
+  makeEvent(ev, VSCP_CLASS1_INFORMATION, VSCP_TYPE_INFORMATION_NODE_HEARTBEAT);
+  EXPECT_EQ(1u, bus.publish(ev));
+
+  makeEvent(ev, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_ELECTRIC_CURRENT);
+  EXPECT_EQ(2u, bus.publish(ev));
+
+  EXPECT_EQ(3, cntAll);
+  EXPECT_EQ(2, cntMeasurement);
+  EXPECT_EQ(1, cntType);
+  EXPECT_EQ(3u, bus.getPublishCount());
+  EXPECT_EQ(6u, bus.getDeliveryCount());
+}
+
+TEST(VscpEventBus, NoEchoToSource)
+{
+  vscpEventBus bus;
+
+  int cntA = 0, cntB = 0;
+  int idA = bus.subscribe("a", NULL, [&cntA](const vscpEvent &) { cntA++; });
+  int idB = bus.subscribe("b", NULL, [&cntB](const vscpEvent &) { cntB++; });
+
+  vscpEvent ev;
+  makeEvent(ev, VSCP_CLASS1_INFORMATION, VSCP_TYPE_INFORMATION_ON);
+  EXPECT_EQ(1u, bus.publish(ev, idA));
+  EXPECT_EQ(1u, bus.publish(ev, idB));
+  EXPECT_EQ(2u, bus.publish(ev));
+
+  EXPECT_EQ(2, cntA);
+  EXPECT_EQ(2, cntB);
+}
+
+TEST(VscpEventBus, EventIsNotCopied)
+{
+  vscpEventBus bus;
+
+  uint8_t data[3] = { 0x8a, 0x01, 0x02 };
+  const uint8_t *pseen = NULL;
+  bus.subscribe("all", NULL, [&pseen](const vscpEvent &ev) { pseen = ev.pdata; });
+
+  vscpEvent ev;
+  makeEvent(ev, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE, data, sizeof(data));
+  bus.publish(ev);
+  EXPECT_EQ(data, pseen);
+
+  // Event ex data is passed as is too
+  vscpEventEx ex;
+  memset(&ex, 0, sizeof(ex));
+  ex.vscp_class = VSCP_CLASS1_MEASUREMENT;
+  ex.sizeData   = 3;
+  ex.GUID[15]   = 0x55;
+  uint8_t guid  = 0;
+  bus.subscribe("guid", NULL, [&guid](const vscpEvent &ev) { guid = ev.GUID[15]; });
+  bus.publish(ex);
+  EXPECT_EQ(ex.data, pseen);
+  EXPECT_EQ(0x55, guid);
+}
+
+// ---------------------------------------------------------------------------
+//                                 Threads
+// ---------------------------------------------------------------------------
+
+TEST(VscpEventBus, ConcurrentPublish)
+{
+  vscpEventBus bus;
+
+  std::atomic<int> cnt(0);
+  vscpEventFilter filter = classFilter(VSCP_CLASS1_MEASUREMENT);
+  bus.subscribe("measurement", &filter, [&cnt](const vscpEvent &) { cnt++; });
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.push_back(std::thread([&bus]() {
+      vscpEvent ev;
+      makeEvent(ev, VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE);
+      for (int i = 0; i < 10000; i++) {
+        bus.publish(ev);
+      }
+    }));
+  }
+
+  // Subscribers come and go while publishing
+  for (int i = 0; i < 100; i++) {
+    int id = bus.subscribe("tmp", &filter, [](const vscpEvent &) {});
+    bus.unsubscribe(id);
+  }
+
+  for (size_t t = 0; t < threads.size(); t++) {
+    threads[t].join();
+  }
+
+  EXPECT_EQ(40000, cnt);
+  EXPECT_EQ(40000u, bus.getPublishCount());
+}
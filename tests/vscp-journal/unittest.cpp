@@ -0,0 +1,329 @@
+// unittest.cpp
+//
+// Unit tests for vscpJournalWriter and vscpJournalReader
+//
+
+#include <gtest/gtest.h>
+
+#include <dirent.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <vscp-client-base.h>
+#include <vscp-journal.h>
+#include <vscp.h>
+#include <vscphelper.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Temporary journal folder, removed with its content
+class JournalDir {
+public:
+  JournalDir()
+  {
+    char tmpl[] = "/tmp/vscp-journal-XXXXXX";
+    m_path      = mkdtemp(tmpl);
+  }
+
+  ~JournalDir()
+  {
+    DIR *pdir = opendir(m_path.c_str());
+    if (NULL != pdir) {
+      struct dirent *pent;
+      while (NULL != (pent = readdir(pdir))) {
+        if ('.' != pent->d_name[0]) {
+          unlink((m_path + "/" + pent->d_name).c_str());
+        }
+      }
+      closedir(pdir);
+    }
+    rmdir(m_path.c_str());
+  }
+
+  std::string m_path;
+};
+
+// Client that collects what is sent to it
+class CollectClient : public CVscpClient {
+public:
+  int connect(void) override { return VSCP_ERROR_SUCCESS; }
+  int disconnect(void) override { return VSCP_ERROR_SUCCESS; }
+  bool isConnected(void) override { return true; }
+
+  int send(vscpEvent &ev) override
+  {
+    m_types.push_back(ev.vscp_type);
+    m_times.push_back(std::chrono::steady_clock::now());
+    return VSCP_ERROR_SUCCESS;
+  }
+  int send(canalMsg &msg) override { return VSCP_ERROR_NOT_SUPPORTED; }
+  int send(vscpEventEx &ex) override { return VSCP_ERROR_NOT_SUPPORTED; }
+
+  int receive(vscpEvent &ev) override { return VSCP_ERROR_FIFO_EMPTY; }
+  int receive(vscpEventEx &ex) override { return VSCP_ERROR_FIFO_EMPTY; }
+  int receive(canalMsg &msg) override { return VSCP_ERROR_FIFO_EMPTY; }
+  int receiveBlocking(vscpEvent &ev, long timeout = 100) override { return VSCP_ERROR_TIMEOUT; }
+  int receiveBlocking(vscpEventEx &ex, long timeout = 100) override { return VSCP_ERROR_TIMEOUT; }
+  int receiveBlocking(canalMsg &msg, long timeout = 100) override { return VSCP_ERROR_TIMEOUT; }
+
+  int setfilter(vscpEventFilter &filter) override { return VSCP_ERROR_SUCCESS; }
+  int getcount(uint16_t *pcount) override { return VSCP_ERROR_SUCCESS; }
+  int clear(void) override { return VSCP_ERROR_SUCCESS; }
+  int getversion(uint8_t *pmajor, uint8_t *pminor, uint8_t *prelease, uint8_t *pbuild) override
+  {
+    return VSCP_ERROR_SUCCESS;
+  }
+  int getinterfaces(std::deque<std::string> &iflist) override { return VSCP_ERROR_SUCCESS; }
+  int getwcyd(uint64_t &wcyd) override { return VSCP_ERROR_SUCCESS; }
+
+  void setConnectionTimeout(uint32_t timeout) override { ; }
+  uint32_t getConnectionTimeout(void) override { return 0; }
+  void setResponseTimeout(uint32_t timeout) override { ; }
+  uint32_t getResponseTimeout(void) override { return 0; }
+
+  std::string getConfigAsJson(void) override { return "{}"; }
+  bool initFromJson(const std::string &config) override { return true; }
+
+  std::vector<uint16_t> m_types;
+  std::vector<std::chrono::steady_clock::time_point> m_times;
+};
+
+static void
+makeEvent(vscpEventEx &ex, uint16_t vscp_type, uint16_t sizeData)
+{
+  memset(&ex, 0, sizeof(ex));
+  ex.head       = VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+  ex.vscp_class = VSCP_CLASS2_LEVEL1_PROTOCOL;
+  ex.vscp_type  = vscp_type;
+  ex.GUID[15]   = 0x42;
+  ex.sizeData   = sizeData;
+  for (uint16_t i = 0; i < sizeData; i++) {
+    ex.data[i] = (uint8_t) i;
+  }
+}
+
+// ---------------------------------------------------------------------------
+//                                 Writer
+// ---------------------------------------------------------------------------
+
+TEST(VscpJournal, NotOpen)
+{
+  vscpJournalWriter writer;
+  vscpEventEx ex;
+  makeEvent(ex, 1, 0);
+  EXPECT_EQ(VSCP_ERROR_NOT_OPEN, writer.write(ex));
+
+  vscpJournalReader reader;
+  EXPECT_EQ(VSCP_ERROR_INVALID_PATH, reader.open("/nonexistent-vscp-journal", "test"));
+
+  JournalDir dir;
+  EXPECT_EQ(VSCP_ERROR_MISSING, reader.open(dir.m_path, "test"));
+}
+
+TEST(VscpJournal, WriteAndRead)
+{
+  JournalDir dir;
+
+  vscpJournalWriter writer;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, writer.open(dir.m_path, "test"));
+
+  vscpEventEx ex;
+  for (uint16_t i = 0; i < 100; i++) {
+    makeEvent(ex, i, i % 20);
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, writer.write(ex));
+  }
+
+  // Readable before the journal is closed
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, writer.sync());
+
+  vscpJournalReader reader;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.open(dir.m_path, "test"));
+
+  vscpEvent ev;
+  uint64_t time, last = 0;
+  for (uint16_t i = 0; i < 100; i++) {
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.read(ev, &time));
+    EXPECT_EQ(VSCP_CLASS2_LEVEL1_PROTOCOL, ev.vscp_class);
+    EXPECT_EQ(i, ev.vscp_type);
+    EXPECT_EQ(0x42, ev.GUID[15]);
+    ASSERT_EQ(i % 20, ev.sizeData);
+    for (uint16_t j = 0; j < ev.sizeData; j++) {
+      EXPECT_EQ(j, ev.pdata[j]);
+    }
+    EXPECT_GE(time, last);
+    last = time;
+    delete[] ev.pdata;
+  }
+  EXPECT_EQ(VSCP_ERROR_FIFO_EMPTY, reader.read(ev));
+
+  writer.close();
+  EXPECT_EQ(100u, writer.getWriteCount());
+  EXPECT_EQ(0u, writer.getDropCount());
+
+  // A second recording continues in a new segment
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, writer.open(dir.m_path, "test"));
+  makeEvent(ex, 100, 0);
+  writer.write(ex);
+  writer.close();
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.open(dir.m_path, "test"));
+  EXPECT_EQ(2u, reader.getSegmentCount());
+  int cnt = 0;
+  while (VSCP_ERROR_SUCCESS == reader.read(ev)) {
+    delete[] ev.pdata;
+    cnt++;
+  }
+  EXPECT_EQ(101, cnt);
+}
+
+TEST(VscpJournal, SegmentRotationAndSeek)
+{
+  JournalDir dir;
+
+  // Small segments and dense index
+  vscpJournalWriter writer;
+  writer.setOptions(16 * 1024, 1024, 0, 1024);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, writer.open(dir.m_path, "rot"));
+
+  vscpEventEx ex;
+  std::vector<uint64_t> times;
+  vscpJournalReader reader;
+  for (uint16_t i = 0; i < 1000; i++) {
+    makeEvent(ex, i, 64);
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, writer.write(ex));
+    if (0 == (i % 100)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+  }
+  writer.close();
+  EXPECT_GT(writer.getSegmentCount(), 4u);
+
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.open(dir.m_path, "rot"));
+  EXPECT_EQ(writer.getSegmentCount(), reader.getSegmentCount());
+
+  vscpEvent ev;
+  uint64_t time;
+  while (VSCP_ERROR_SUCCESS == reader.read(ev, &time)) {
+    EXPECT_EQ(times.size(), ev.vscp_type);
+    times.push_back(time);
+    delete[] ev.pdata;
+  }
+  ASSERT_EQ(1000u, times.size());
+
+  // Seek lands on the first event at or after the time
+  const size_t targets[] = { 0, 1, 333, 500, 999 };
+  for (size_t k = 0; k < sizeof(targets) / sizeof(targets[0]); k++) {
+    size_t i = targets[k];
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.seek(times[i]));
+    ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.read(ev, &time));
+    EXPECT_EQ(times[i], time);
+    EXPECT_LE(ev.vscp_type, i);
+    EXPECT_EQ(times[ev.vscp_type], times[i]);
+    delete[] ev.pdata;
+  }
+
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, reader.seek(0));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.read(ev));
+  EXPECT_EQ(0, ev.vscp_type);
+  delete[] ev.pdata;
+
+  EXPECT_EQ(VSCP_ERROR_MISSING, reader.seek(times.back() + 1));
+}
+
+TEST(VscpJournal, ConcurrentWriters)
+{
+  JournalDir dir;
+
+  vscpJournalWriter writer;
+  writer.setOptions(VSCP_JOURNAL_DEFAULT_SEGMENT_SIZE, 65536);
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, writer.open(dir.m_path, "mt"));
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.push_back(std::thread([&writer, t]() {
+      vscpEventEx ex;
+      for (int i = 0; i < 5000; i++) {
+        makeEvent(ex, (uint16_t) t, 8);
+        while (VSCP_ERROR_FIFO_FULL == writer.write(ex)) {
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+  for (size_t t = 0; t < threads.size(); t++) {
+    threads[t].join();
+  }
+  writer.close();
+
+  vscpJournalReader reader;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.open(dir.m_path, "mt"));
+
+  int cnt[4] = { 0, 0, 0, 0 };
+  vscpEvent ev;
+  while (VSCP_ERROR_SUCCESS == reader.read(ev)) {
+    ASSERT_LT(ev.vscp_type, 4);
+    cnt[ev.vscp_type]++;
+    delete[] ev.pdata;
+  }
+
+  for (int t = 0; t < 4; t++) {
+    EXPECT_EQ(5000, cnt[t]);
+  }
+}
+
+// ---------------------------------------------------------------------------
+//                                 Replay
+// ---------------------------------------------------------------------------
+
+TEST(VscpJournal, Replay)
+{
+  JournalDir dir;
+
+  vscpJournalWriter writer;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, writer.open(dir.m_path, "replay"));
+
+  vscpEventEx ex;
+  makeEvent(ex, 1, 0);
+  writer.write(ex);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  makeEvent(ex, 2, 0);
+  writer.write(ex);
+  writer.close();
+
+  vscpJournalReader reader;
+  CollectClient client;
+
+  // Original timing
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.open(dir.m_path, "replay"));
+  EXPECT_EQ(2, reader.replay(client, 1.0));
+  ASSERT_EQ(2u, client.m_types.size());
+  EXPECT_EQ(1, client.m_types[0]);
+  EXPECT_EQ(2, client.m_types[1]);
+  long ms = (long) std::chrono::duration_cast<std::chrono::milliseconds>(client.m_times[1] - client.m_times[0])
+              .count();
+  EXPECT_GE(ms, 180);
+  EXPECT_LT(ms, 1000);
+
+  // Ten times faster
+  client.m_types.clear();
+  client.m_times.clear();
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.seek(0));
+  EXPECT_EQ(2, reader.replay(client, 10.0));
+  ms = (long) std::chrono::duration_cast<std::chrono::milliseconds>(client.m_times[1] - client.m_times[0]).count();
+  EXPECT_GE(ms, 15);
+  EXPECT_LT(ms, 150);
+
+  // As fast as possible, stopped by end time
+  client.m_types.clear();
+  client.m_times.clear();
+  uint64_t first;
+  vscpEvent ev;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.seek(0));
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.read(ev, &first));
+  delete[] ev.pdata;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, reader.seek(0));
+  EXPECT_EQ(1, reader.replay(client, 0, first));
+  EXPECT_EQ(1u, client.m_types.size());
+}
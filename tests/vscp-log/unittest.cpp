@@ -0,0 +1,132 @@
+// unittest.cpp
+//
+// Unit tests for the log macros and the asynchronous syslog writer
+//
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+
+#include <vscp-log.h>
+#include <vscp-syslog.h>
+#include <vscp.h>
+
+#include <spdlog/sinks/ostream_sink.h>
+#include <spdlog/spdlog.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+static int gcntEvaluated = 0;
+
+static int
+evaluated(void)
+{
+  return ++gcntEvaluated;
+}
+
+// ---------------------------------------------------------------------------
+//                                 Levels
+// ---------------------------------------------------------------------------
+
+TEST(VscpLog, LevelFromPriority)
+{
+  static_assert(VSCP_LOG_LEVEL_DEBUG == vscpSyslog::getLevelFromPriority(LOG_DEBUG), "compile time level");
+
+  EXPECT_EQ(VSCP_LOG_LEVEL_DEBUG, vscpSyslog::getLevelFromPriority(LOG_DEBUG));
+  EXPECT_EQ(VSCP_LOG_LEVEL_INFO, vscpSyslog::getLevelFromPriority(LOG_INFO));
+  EXPECT_EQ(VSCP_LOG_LEVEL_INFO, vscpSyslog::getLevelFromPriority(LOG_NOTICE));
+  EXPECT_EQ(VSCP_LOG_LEVEL_WARN, vscpSyslog::getLevelFromPriority(LOG_WARNING));
+  EXPECT_EQ(VSCP_LOG_LEVEL_ERROR, vscpSyslog::getLevelFromPriority(LOG_ERR));
+  EXPECT_EQ(VSCP_LOG_LEVEL_CRITICAL, vscpSyslog::getLevelFromPriority(LOG_CRIT));
+  EXPECT_EQ(VSCP_LOG_LEVEL_CRITICAL, vscpSyslog::getLevelFromPriority(LOG_EMERG));
+
+  // Facility is ignored
+  EXPECT_EQ(VSCP_LOG_LEVEL_ERROR, vscpSyslog::getLevelFromPriority(LOG_DAEMON | LOG_ERR));
+}
+
+// ---------------------------------------------------------------------------
+//                                 Macros
+// ---------------------------------------------------------------------------
+
+TEST(VscpLog, SpdlogMacroSkipsArguments)
+{
+  std::ostringstream oss;
+  auto sink   = std::make_shared<spdlog::sinks::ostream_sink_mt>(oss);
+  auto logger = std::make_shared<spdlog::logger>("test", sink);
+  logger->set_pattern("%l %v");
+  logger->set_level(spdlog::level::info);
+  auto previous = spdlog::default_logger();
+  spdlog::set_default_logger(logger);
+
+  gcntEvaluated = 0;
+  VSCP_LOG_TRACE("trace {}", evaluated());
+  VSCP_LOG_DEBUG("debug {}", evaluated());
+  EXPECT_EQ(0, gcntEvaluated);
+  EXPECT_TRUE(oss.str().empty());
+
+#if VSCP_LOG_ACTIVE_LEVEL <= VSCP_LOG_LEVEL_INFO
+  VSCP_LOG_INFO("info {}", evaluated());
+  VSCP_LOG_ERROR("error {}", evaluated());
+  EXPECT_EQ(2, gcntEvaluated);
+  EXPECT_EQ("info info 1\nerror error 2\n", oss.str());
+#endif
+
+  spdlog::set_default_logger(previous);
+}
+
+TEST(VscpLog, SyslogMacroSkipsArguments)
+{
+  vscpSyslog::setLevel(VSCP_LOG_LEVEL_WARN);
+
+  gcntEvaluated = 0;
+  VSCP_SYSLOG(LOG_DEBUG, "vscp-log unittest %d", evaluated());
+  VSCP_SYSLOG(LOG_INFO, "vscp-log unittest %d", evaluated());
+  EXPECT_EQ(0, gcntEvaluated);
+
+#if VSCP_LOG_ACTIVE_LEVEL <= VSCP_LOG_LEVEL_ERROR
+  VSCP_SYSLOG(LOG_ERR, "vscp-log unittest %d", evaluated());
+  EXPECT_EQ(1, gcntEvaluated);
+#endif
+
+  vscpSyslog::setLevel(VSCP_LOG_LEVEL_TRACE);
+}
+
+// ---------------------------------------------------------------------------
+//                                 Writer
+// ---------------------------------------------------------------------------
+
+TEST(VscpLog, WriterFromThreads)
+{
+  vscpSyslog &log = vscpSyslog::getInstance();
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, log.start(64));
+  EXPECT_TRUE(log.isRunning());
+
+  uint64_t cntWrite = log.getWriteCount();
+  uint64_t cntDrop  = log.getDropCount();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.push_back(std::thread([&log, t]() {
+      for (int i = 0; i < 1000; i++) {
+        log.write(LOG_DEBUG, "vscp-log unittest thread %d message %d", t, i);
+      }
+    }));
+  }
+
+  for (size_t t = 0; t < threads.size(); t++) {
+    threads[t].join();
+  }
+
+  log.stop();
+  EXPECT_FALSE(log.isRunning());
+
+  // Every message is either written or dropped, never lost
+  EXPECT_EQ(4000u, (log.getWriteCount() - cntWrite) + (log.getDropCount() - cntDrop));
+
+  // Goes straight to syslog when stopped
+  cntWrite = log.getWriteCount();
+  EXPECT_TRUE(log.write(LOG_DEBUG, "vscp-log unittest stopped"));
+  EXPECT_EQ(cntWrite + 1, log.getWriteCount());
+}
@@ -0,0 +1,159 @@
+// unittest.cpp
+//
+// Unit tests for the metrics registry
+//
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+
+#include <vscp-metrics.h>
+
+#include <nlohmann/json.hpp>
+
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+
+// ---------------------------------------------------------------------------
+//                                 Counters
+// ---------------------------------------------------------------------------
+
+TEST(VscpMetrics, CounterFromThreads)
+{
+  vscpMetricCounter &cnt = vscpMetrics::getInstance().getCounter("test_threads_total", "Test");
+  cnt.reset();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; t++) {
+    threads.push_back(std::thread([&cnt]() {
+      for (int i = 0; i < 100000; i++) {
+        cnt.add();
+      }
+    }));
+  }
+
+  for (size_t t = 0; t < threads.size(); t++) {
+    threads[t].join();
+  }
+
+  EXPECT_EQ(800000u, cnt.get());
+  cnt.reset();
+  EXPECT_EQ(0u, cnt.get());
+}
+
+TEST(VscpMetrics, Registry)
+{
+  vscpMetrics &metrics    = vscpMetrics::getInstance();
+  vscpMetricCounter &cnt1 = metrics.getCounter("test_registry_total", "Test");
+  vscpMetricCounter &cnt2 = metrics.getCounter("test_registry_total");
+  EXPECT_EQ(&cnt1, &cnt2);
+
+  vscpMetricHistogram &h1 = metrics.getHistogram("test_registry_ns", "Test");
+  vscpMetricHistogram &h2 = metrics.getHistogram("test_registry_ns");
+  EXPECT_EQ(&h1, &h2);
+
+  // Shards are cache line aligned
+  EXPECT_EQ(0u, (uintptr_t) &cnt1 % alignof(vscpMetricCounter));
+  EXPECT_EQ(0u, (uintptr_t) &h1 % alignof(vscpMetricHistogram));
+}
+
+TEST(VscpMetrics, Macros)
+{
+  vscpMetricCounter &cnt = vscpMetrics::getInstance().getCounter("test_macro_total");
+  vscpMetricHistogram &h = vscpMetrics::getInstance().getHistogram("test_macro_ns");
+
+  // Nothing is collected when disabled
+  vscpMetrics::enable(false);
+  for (int i = 0; i < 3; i++) {
+    VSCP_METRIC_COUNT("test_macro_total", "");
+    VSCP_METRIC_RECORD("test_macro_ns", "", 100);
+    VSCP_METRIC_TIMER("test_macro_ns", "");
+  }
+  EXPECT_EQ(0u, cnt.get());
+  EXPECT_EQ(0u, h.getCount());
+
+  vscpMetrics::enable(true);
+  for (int i = 0; i < 3; i++) {
+    VSCP_METRIC_ADD("test_macro_total", "", 2);
+    VSCP_METRIC_RECORD("test_macro_ns", "", 100);
+    VSCP_METRIC_TIMER("test_macro_ns", "");
+  }
+  vscpMetrics::enable(false);
+
+  EXPECT_EQ(6u, cnt.get());
+  EXPECT_EQ(6u, h.getCount());
+}
+
+// ---------------------------------------------------------------------------
+//                                Histograms
+// ---------------------------------------------------------------------------
+
+TEST(VscpMetrics, HistogramBuckets)
+{
+  uint64_t values[] = { 0, 1, 7, 8, 9, 15, 16, 17, 100, 1000, 123456, 1000000007ULL, UINT64_MAX };
+  for (uint64_t v : values) {
+    size_t idx = vscpMetricHistogram::getBucket(v);
+    ASSERT_LT(idx, (size_t) VSCP_METRICS_BUCKETS);
+    uint64_t max = vscpMetricHistogram::getBucketMax(idx);
+    EXPECT_GE(max, v);
+    EXPECT_LE((double) (max - v), v / 8.0 + 1) << v;
+    if (idx) {
+      EXPECT_LT(vscpMetricHistogram::getBucketMax(idx - 1), v) << v;
+    }
+  }
+
+  // Buckets are ordered
+  for (size_t i = 1; i < VSCP_METRICS_BUCKETS; i++) {
+    EXPECT_GT(vscpMetricHistogram::getBucketMax(i), vscpMetricHistogram::getBucketMax(i - 1));
+  }
+}
+
+TEST(VscpMetrics, HistogramPercentiles)
+{
+  vscpMetricHistogram h("test_percentile_ns", "");
+  EXPECT_EQ(0u, h.getPercentile(0.5));
+
+  for (uint64_t i = 1; i <= 10000; i++) {
+    h.record(i);
+  }
+
+  EXPECT_EQ(10000u, h.getCount());
+  EXPECT_EQ(50005000u, h.getSum());
+  EXPECT_EQ(10000u, h.getMax());
+  EXPECT_NEAR(5000, (double) h.getPercentile(0.5), 5000 / 8.0);
+  EXPECT_NEAR(9900, (double) h.getPercentile(0.99), 9900 / 8.0);
+  EXPECT_EQ(10000u, h.getPercentile(1.0));
+
+  h.reset();
+  EXPECT_EQ(0u, h.getCount());
+  EXPECT_EQ(0u, h.getMax());
+}
+
+// ---------------------------------------------------------------------------
+//                                  Export
+// ---------------------------------------------------------------------------
+
+TEST(VscpMetrics, Export)
+{
+  vscpMetrics &metrics = vscpMetrics::getInstance();
+  metrics.getCounter("test_export_total", "Exported counter").add(42);
+  metrics.getHistogram("test_export_ns", "Exported histogram").record(1000);
+
+  std::string str = metrics.getAsPrometheus();
+  EXPECT_NE(std::string::npos, str.find("# HELP test_export_total Exported counter\n"));
+  EXPECT_NE(std::string::npos, str.find("# TYPE test_export_total counter\ntest_export_total 42\n"));
+  EXPECT_NE(std::string::npos, str.find("# TYPE test_export_ns summary\n"));
+  EXPECT_NE(std::string::npos, str.find("test_export_ns{quantile=\"0.99\"} 1000\n"));
+  EXPECT_NE(std::string::npos, str.find("test_export_ns_count 1\n"));
+
+  json j = json::parse(metrics.getAsJSON());
+  EXPECT_EQ(42u, j["counters"]["test_export_total"].get<uint64_t>());
+  EXPECT_EQ(1u, j["histograms"]["test_export_ns"]["count"].get<uint64_t>());
+  EXPECT_EQ(1000u, j["histograms"]["test_export_ns"]["p50"].get<uint64_t>());
+
+  metrics.reset();
+  j = json::parse(metrics.getAsJSON());
+  EXPECT_EQ(0u, j["counters"]["test_export_total"].get<uint64_t>());
+}
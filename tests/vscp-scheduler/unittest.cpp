@@ -0,0 +1,178 @@
+// unittest.cpp
+//
+// Unit tests for vscpScheduler
+//
+// Timing is checked with generous margins so the tests also pass on
+// loaded build machines.
+//
+
+#include <gtest/gtest.h>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <vscp-scheduler.h>
+#include <vscp.h>
+
+#include <chrono>
+#include <thread>
+
+// Run the scheduler until fn returns true or the time is up
+static bool
+runUntil(vscpScheduler &sched, std::function<bool(void)> fn, int ms = 2000)
+{
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+  while (!fn()) {
+    if (std::chrono::steady_clock::now() > end) {
+      return false;
+    }
+    sched.runOnce(10);
+  }
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+//                                  Tasks
+// ---------------------------------------------------------------------------
+
+TEST(VscpScheduler, NotInitialized)
+{
+  vscpScheduler sched;
+  EXPECT_EQ(VSCP_ERROR_ERROR, sched.runOnce(0));
+  EXPECT_EQ(VSCP_ERROR_ERROR, sched.addFd(0, []() {}));
+}
+
+TEST(VscpScheduler, IdleWaitTimesOut)
+{
+  vscpScheduler sched;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, sched.init());
+  EXPECT_EQ(VSCP_ERROR_TIMEOUT, sched.runOnce(0));
+}
+
+TEST(VscpScheduler, OneShotTask)
+{
+  vscpScheduler sched;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, sched.init());
+
+  int cnt = 0;
+  EXPECT_GT(sched.addTask("once", 0, [&cnt]() { cnt++; }, 1000), 0);
+  EXPECT_EQ(1u, sched.getTaskCount());
+
+  EXPECT_TRUE(runUntil(sched, [&cnt]() { return cnt > 0; }));
+  EXPECT_EQ(1, cnt);
+  EXPECT_EQ(0u, sched.getTaskCount());
+
+  // Nothing more to run
+  EXPECT_EQ(VSCP_ERROR_TIMEOUT, sched.runOnce(20));
+  EXPECT_EQ(1, cnt);
+}
+
+TEST(VscpScheduler, PeriodicTaskAndOrder)
+{
+  vscpScheduler sched;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, sched.init());
+
+  std::string order;
+  int fast = 0;
+  sched.addTask("slow", 0, [&order]() { order += "s"; }, 30000);
+  sched.addTask("fast", 2000, [&order, &fast]() {
+    if (0 == fast++) {
+      order += "f";
+    }
+  });
+
+  EXPECT_TRUE(runUntil(sched, [&order]() { return order.length() >= 2; }));
+  EXPECT_EQ("fs", order);
+  EXPECT_TRUE(runUntil(sched, [&fast]() { return fast >= 20; }));
+}
+
+TEST(VscpScheduler, BlockingWaitSleepsUntilDeadline)
+{
+  vscpScheduler sched;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, sched.init());
+
+  int cnt = 0;
+  sched.addTask("tick", 0, [&cnt]() { cnt++; }, 20000);
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  EXPECT_EQ(VSCP_ERROR_SUCCESS, sched.runOnce(-1));
+  long ms = (long) std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)
+              .count();
+
+  EXPECT_EQ(1, cnt);
+  EXPECT_GE(ms, 15);
+  EXPECT_LT(ms, 1000);
+}
+
+TEST(VscpScheduler, RemoveTask)
+{
+  vscpScheduler sched;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, sched.init());
+
+  int cnt = 0;
+  int id  = sched.addTask("removed", 1000, [&cnt]() { cnt++; });
+  EXPECT_TRUE(sched.removeTask(id));
+  EXPECT_FALSE(sched.removeTask(id));
+  EXPECT_EQ(VSCP_ERROR_TIMEOUT, sched.runOnce(20));
+  EXPECT_EQ(0, cnt);
+
+  // Task removing itself
+  int self = -1;
+  self     = sched.addTask("self", 1000, [&]() {
+    cnt++;
+    sched.removeTask(self);
+  });
+  EXPECT_TRUE(runUntil(sched, [&cnt]() { return cnt > 0; }));
+  EXPECT_EQ(0u, sched.getTaskCount());
+  EXPECT_EQ(VSCP_ERROR_TIMEOUT, sched.runOnce(20));
+  EXPECT_EQ(1, cnt);
+}
+
+// ---------------------------------------------------------------------------
+//                          Descriptors / wake up
+// ---------------------------------------------------------------------------
+
+TEST(VscpScheduler, FdHandler)
+{
+  vscpScheduler sched;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, sched.init());
+
+  int efd = eventfd(0, EFD_NONBLOCK);
+  ASSERT_GE(efd, 0);
+
+  uint64_t total = 0;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, sched.addFd(efd, [efd, &total]() {
+    uint64_t cnt;
+    if (sizeof(cnt) == read(efd, &cnt, sizeof(cnt))) {
+      total += cnt;
+    }
+  }));
+
+  std::thread t([efd]() {
+    eventfd_write(efd, 2);
+    eventfd_write(efd, 3);
+  });
+  t.join();
+
+  EXPECT_TRUE(runUntil(sched, [&total]() { return total >= 5; }));
+  EXPECT_EQ(5u, total);
+
+  EXPECT_TRUE(sched.removeFd(efd));
+  EXPECT_FALSE(sched.removeFd(efd));
+  close(efd);
+}
+
+TEST(VscpScheduler, Wakeup)
+{
+  vscpScheduler sched;
+  ASSERT_EQ(VSCP_ERROR_SUCCESS, sched.init());
+
+  std::thread t([&sched]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    sched.wakeup();
+  });
+
+  // Would block forever without the wake up
+  EXPECT_EQ(VSCP_ERROR_TIMEOUT, sched.runOnce(-1));
+  t.join();
+}
@@ -31,6 +31,7 @@
 #include <cstdint>
 
 #include "vscphelper.h"
+#include "vscp-token.h"
 #include "vscp.h"
 #include "guid.h"
 #include "canal.h"
@@ -4067,6 +4068,341 @@ TEST(VscpHelper, frameCryptoBackendSwitch_Aes128RoundtripAndParity)
     vscp_setFrameEncryptionUseOpenSSL(false);
 }
 
+// =============================================================================
+//                        Direct Measurement Decoding
+// =============================================================================
+
+TEST(VscpHelper, decodeMeasurementAsDouble_integer)
+{
+    double value = 0;
+    uint8_t data[] = { VSCP_DATACODING_INTEGER, 0xff, 0x38 }; // -200
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, data, sizeof(data)));
+    EXPECT_DOUBLE_EQ(-200.0, value);
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_normalized)
+{
+    double value = 0;
+    uint8_t data[] = { VSCP_DATACODING_NORMALIZED, 0x82, 0x09, 0x29 }; // 2345 * 10^-2
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, data, sizeof(data)));
+    EXPECT_NEAR(23.45, value, 1e-9);
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_string)
+{
+    double value = 0;
+    uint8_t data[] = { VSCP_DATACODING_STRING, '-', '1', '2', '.', '5' };
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, data, sizeof(data)));
+    EXPECT_DOUBLE_EQ(-12.5, value);
+
+    uint8_t bad[] = { VSCP_DATACODING_STRING, 'x', 'y' };
+    EXPECT_FALSE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, bad, sizeof(bad)));
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_bitAndByte)
+{
+    double value = 0;
+    uint8_t bits[] = { VSCP_DATACODING_BIT, 0x01, 0x02 };
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, bits, sizeof(bits)));
+    EXPECT_DOUBLE_EQ(258.0, value);
+
+    uint8_t bytes[] = { VSCP_DATACODING_BYTE, 0xfe };
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, bytes, sizeof(bytes)));
+    EXPECT_DOUBLE_EQ(254.0, value);
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_singleFloat)
+{
+    double value = 0;
+    uint8_t data[] = { VSCP_DATACODING_SINGLE, 0x41, 0xac, 0x00, 0x00 }; // 21.5f MSB first
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, data, sizeof(data)));
+    EXPECT_DOUBLE_EQ(21.5, value);
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_doubleCodingWithGuid)
+{
+    double value = 0;
+    double in    = -1234.0625;
+    uint64_t n;
+    uint8_t data[16 + 1 + 8];
+    memset(data, 0, sizeof(data));
+    data[16] = VSCP_DATACODING_DOUBLE;
+    memcpy(&n, &in, sizeof(n));
+    for (int i = 0; i < 8; i++) {
+        data[17 + i] = (n >> (56 - 8 * i)) & 0xff;
+    }
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS2_LEVEL1_MEASUREMENT, 6, data, sizeof(data)));
+    EXPECT_DOUBLE_EQ(in, value);
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_zoneOffset)
+{
+    double value = 0;
+    uint8_t data[] = { 0x01, 0x02, 0x03, VSCP_DATACODING_INTEGER, 0x10 };
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREZONE, 6, data, sizeof(data)));
+    EXPECT_DOUBLE_EQ(16.0, value);
+}
+
+TEST(VscpHelper, getMeasurementZone)
+{
+    uint8_t data[] = { 0x01, 0x02, 0x03, VSCP_DATACODING_INTEGER, 0x10 };
+    vscpEvent ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.vscp_class = VSCP_CLASS1_MEASUREZONE;
+    ev.vscp_type  = 6;
+    ev.sizeData   = sizeof(data);
+    ev.pdata      = data;
+
+    EXPECT_EQ(1, vscp_getMeasurementSensorIndex(&ev));
+    EXPECT_EQ(2, vscp_getMeasurementZone(&ev));
+    EXPECT_EQ(3, vscp_getMeasurementSubZone(&ev));
+
+    // Too short for index, zone and subzone
+    ev.sizeData = 2;
+    EXPECT_EQ(-1, vscp_getMeasurementSensorIndex(&ev));
+    EXPECT_EQ(0, vscp_getMeasurementZone(&ev));
+    EXPECT_EQ(0, vscp_getMeasurementSubZone(&ev));
+
+    // No zone for plain measurements
+    uint8_t plain[] = { VSCP_DATACODING_INTEGER | 0x05, 0x10 };
+    ev.vscp_class = VSCP_CLASS1_MEASUREMENT;
+    ev.sizeData   = sizeof(plain);
+    ev.pdata      = plain;
+    EXPECT_EQ(5, vscp_getMeasurementSensorIndex(&ev));
+    EXPECT_EQ(0, vscp_getMeasurementZone(&ev));
+    EXPECT_EQ(0, vscp_getMeasurementSubZone(&ev));
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_level2)
+{
+    double value = 0;
+    vscpEvent ev;
+    memset(&ev, 0, sizeof(ev));
+    ASSERT_TRUE(vscp_makeLevel2FloatMeasurementEvent(&ev, 6, 3.25, 1, 0, 0, 0));
+    ASSERT_TRUE(vscp_getMeasurementAsDouble(&value, &ev));
+    EXPECT_DOUBLE_EQ(3.25, value);
+    delete[] ev.pdata;
+
+    uint8_t str[] = { 0, 0, 0, 1, '4', '2', '.', '7', '5' };
+    ASSERT_TRUE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS2_MEASUREMENT_STR, 6, str, sizeof(str)));
+    EXPECT_DOUBLE_EQ(42.75, value);
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_eventAndEventExAgree)
+{
+    double v1 = 0, v2 = 0;
+    vscpEventEx ex;
+    memset(&ex, 0, sizeof(ex));
+    ex.vscp_class = VSCP_CLASS1_MEASUREMENT;
+    ex.vscp_type  = 6;
+    ex.sizeData   = 4;
+    ex.data[0]    = VSCP_DATACODING_NORMALIZED;
+    ex.data[1]    = 0x81;
+    ex.data[2]    = 0xff;
+    ex.data[3]    = 0x9c; // -100 * 10^-1
+
+    vscpEvent ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.vscp_class = ex.vscp_class;
+    ev.vscp_type  = ex.vscp_type;
+    ev.sizeData   = ex.sizeData;
+    ev.pdata      = ex.data;
+
+    ASSERT_TRUE(vscp_getMeasurementAsDouble(&v1, &ev));
+    ASSERT_TRUE(vscp_getMeasurementAsDoubleEx(&v2, &ex));
+    EXPECT_DOUBLE_EQ(-10.0, v1);
+    EXPECT_DOUBLE_EQ(v1, v2);
+}
+
+TEST(VscpHelper, decodeMeasurementAsDouble_invalid)
+{
+    double value = 0;
+    uint8_t data[] = { VSCP_DATACODING_INTEGER };
+    EXPECT_FALSE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, data, sizeof(data)));
+    EXPECT_FALSE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, nullptr, 3));
+    EXPECT_FALSE(vscp_decodeMeasurementAsDouble(nullptr, VSCP_CLASS1_MEASUREMENT, 6, data, sizeof(data)));
+    EXPECT_FALSE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_INFORMATION, 6, data, sizeof(data)));
+    uint8_t reserved[] = { VSCP_DATACODING_RESERVED2, 0x01 };
+    EXPECT_FALSE(vscp_decodeMeasurementAsDouble(&value, VSCP_CLASS1_MEASUREMENT, 6, reserved, sizeof(reserved)));
+}
+
+// =============================================================================
+//                              Event View
+// =============================================================================
+
+static void
+fillViewTestEventEx(vscpEventEx &ex)
+{
+    memset(&ex, 0, sizeof(ex));
+    ex.head         = VSCP_HEADER16_FRAME_VERSION_UNIX_NS;
+    ex.obid         = 77;
+    ex.year         = 0xffff;
+    ex.month        = 0xff;
+    ex.timestamp_ns = 1700000000123456789ULL;
+    ex.vscp_class   = VSCP_CLASS1_MEASUREMENT;
+    ex.vscp_type    = 6;
+    for (int i = 0; i < 16; i++) {
+        ex.GUID[i] = i;
+    }
+    ex.sizeData = 3;
+    ex.data[0]  = VSCP_DATACODING_INTEGER | 0x0a; // unit 1, sensor index 2
+    ex.data[1]  = 0x01;
+    ex.data[2]  = 0x02;
+}
+
+TEST(VscpHelper, eventView_fromEventAndEventEx)
+{
+    vscpEventEx ex;
+    fillViewTestEventEx(ex);
+
+    vscpEvent ev;
+    memset(&ev, 0, sizeof(ev));
+    ASSERT_TRUE(vscp_convertEventExToEvent(&ev, &ex));
+
+    vscp_event_view vex(ex);
+    vscp_event_view vev(ev);
+
+    EXPECT_EQ(vex.head, vev.head);
+    EXPECT_EQ(vex.obid, vev.obid);
+    EXPECT_EQ(vex.timestamp_ns, vev.timestamp_ns);
+    EXPECT_EQ(vex.vscp_class, vev.vscp_class);
+    EXPECT_EQ(vex.vscp_type, vev.vscp_type);
+    EXPECT_EQ(vex.sizeData, vev.sizeData);
+    EXPECT_EQ(ex.data, vex.pdata);  // No copy of data
+    EXPECT_EQ(ev.pdata, vev.pdata);
+    EXPECT_EQ(0, memcmp(vex.GUID, vev.GUID, 16));
+
+    vscp_deleteEvent(&ev);
+}
+
+TEST(VscpHelper, eventView_encodingsMatch)
+{
+    vscpEventEx ex;
+    fillViewTestEventEx(ex);
+
+    vscpEvent ev;
+    memset(&ev, 0, sizeof(ev));
+    ASSERT_TRUE(vscp_convertEventExToEvent(&ev, &ex));
+
+    std::string s1, s2;
+    ASSERT_TRUE(vscp_convertEventToJSON(s1, &ev));
+    ASSERT_TRUE(vscp_convertEventExToJSON(s2, &ex));
+    EXPECT_EQ(s1, s2);
+
+    ASSERT_TRUE(vscp_convertEventToXML(s1, &ev));
+    ASSERT_TRUE(vscp_convertEventExToXML(s2, &ex));
+    EXPECT_EQ(s1, s2);
+
+    ASSERT_TRUE(vscp_convertEventToString(s1, &ev));
+    ASSERT_TRUE(vscp_convertEventExToString(s2, &ex));
+    EXPECT_EQ(s1, s2);
+
+    uint8_t f1[128], f2[128];
+    memset(f1, 0, sizeof(f1));
+    memset(f2, 0, sizeof(f2));
+    ASSERT_EQ(vscp_getFrameSizeFromEvent(&ev), vscp_getFrameSizeFromEventEx(&ex));
+    ASSERT_TRUE(vscp_writeEventToFrame(f1, sizeof(f1), 0, &ev));
+    ASSERT_TRUE(vscp_writeEventExToFrame(f2, sizeof(f2), 0, &ex));
+    EXPECT_EQ(0, memcmp(f1, f2, vscp_getFrameSizeFromEvent(&ev)));
+
+    vscp_deleteEvent(&ev);
+}
+
+TEST(VscpHelper, eventView_measurementAndFilter)
+{
+    vscpEventEx ex;
+    fillViewTestEventEx(ex);
+    vscp_event_view view(ex);
+
+    EXPECT_TRUE(vscp_isMeasurement(view));
+    EXPECT_EQ(1, vscp_getMeasurementUnit(view));
+    EXPECT_EQ(2, vscp_getMeasurementSensorIndex(view));
+    EXPECT_EQ(vscp_getMeasurementUnit(view), vscp_getMeasurementUnitEx(&ex));
+
+    double value = 0;
+    ASSERT_TRUE(vscp_getMeasurementAsDouble(&value, view));
+    EXPECT_DOUBLE_EQ(258.0, value);
+
+    vscpEventFilter filter;
+    memset(&filter, 0, sizeof(filter));
+    filter.mask_class   = 0xffff;
+    filter.filter_class = VSCP_CLASS1_MEASUREMENT;
+    EXPECT_TRUE(vscp_doLevel2Filter(view, &filter));
+    EXPECT_TRUE(vscp_doLevel2FilterEx(&ex, &filter));
+
+    filter.filter_class = VSCP_CLASS1_INFORMATION;
+    EXPECT_FALSE(vscp_doLevel2Filter(view, &filter));
+    EXPECT_FALSE(vscp_doLevel2FilterEx(&ex, &filter));
+
+    // Ex variant keeps rejecting a missing filter
+    EXPECT_TRUE(vscp_doLevel2Filter(view, nullptr));
+    EXPECT_FALSE(vscp_doLevel2FilterEx(&ex, nullptr));
+}
+
+// =============================================================================
+//                           Class/type tokens
+// =============================================================================
+
+TEST(VscpHelper, tokens_builtin)
+{
+    EXPECT_STREQ("CLASS1.MEASUREMENT", vscp_getBuiltinClassToken(VSCP_CLASS1_MEASUREMENT));
+    EXPECT_STREQ("VSCP_TYPE_MEASUREMENT_TEMPERATURE",
+                 vscp_getBuiltinTypeToken(VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE));
+    EXPECT_EQ(nullptr, vscp_getBuiltinClassToken(1000));
+    EXPECT_EQ(nullptr, vscp_getBuiltinTypeToken(VSCP_CLASS1_MEASUREMENT, 0xfff0));
+
+    uint16_t vscp_class = 0;
+    EXPECT_TRUE(vscp_getBuiltinClassFromToken(&vscp_class, "CLASS1.INFORMATION"));
+    EXPECT_EQ(VSCP_CLASS1_INFORMATION, vscp_class);
+    EXPECT_FALSE(vscp_getBuiltinClassFromToken(&vscp_class, "CLASS1.NO_SUCH_CLASS"));
+
+    // Type token shared by several classes
+    uint16_t vscp_type = 0;
+    vscp_class         = 0xffff;
+    EXPECT_TRUE(vscp_getBuiltinTypeFromToken(&vscp_class, &vscp_type, "VSCP_TYPE_MEASUREMENT_TEMPERATURE"));
+    EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, vscp_class);
+    EXPECT_EQ(VSCP_TYPE_MEASUREMENT_TEMPERATURE, vscp_type);
+
+    vscp_class = 60;
+    vscp_type  = 0;
+    EXPECT_TRUE(vscp_getBuiltinTypeFromToken(&vscp_class, &vscp_type, "VSCP_TYPE_MEASUREMENT_TEMPERATURE"));
+    EXPECT_EQ(60, vscp_class);
+    EXPECT_EQ(VSCP_TYPE_MEASUREMENT_TEMPERATURE, vscp_type);
+
+    vscp_class = VSCP_CLASS1_INFORMATION;
+    EXPECT_FALSE(vscp_getBuiltinTypeFromToken(&vscp_class, &vscp_type, "VSCP_TYPE_MEASUREMENT_TEMPERATURE"));
+}
+
+TEST(VscpHelper, tokens_tableOverride)
+{
+    vscpTokenTable table;
+    EXPECT_EQ(0u, table.getOverrideCount());
+    EXPECT_EQ("CLASS1.MEASUREMENT", table.getClassToken(VSCP_CLASS1_MEASUREMENT));
+    EXPECT_EQ("", table.getClassToken(1000));
+
+    table.addClassToken(VSCP_CLASS1_MEASUREMENT, "MY.MEASUREMENT");
+    table.addClassToken(VSCP_CLASS1_MEASUREMENT, "MY.MEASUREMENT2");
+    table.addTypeToken(VSCP_CLASS1_MEASUREMENT, 0xfff0, "MY_TYPE");
+    EXPECT_EQ(2u, table.getOverrideCount());
+
+    EXPECT_EQ("MY.MEASUREMENT2", table.getClassToken(VSCP_CLASS1_MEASUREMENT));
+    EXPECT_EQ("CLASS1.INFORMATION", table.getClassToken(VSCP_CLASS1_INFORMATION));
+    EXPECT_EQ("MY_TYPE", table.getTypeToken(VSCP_CLASS1_MEASUREMENT, 0xfff0));
+    EXPECT_EQ("VSCP_TYPE_MEASUREMENT_TEMPERATURE",
+              table.getTypeToken(VSCP_CLASS1_MEASUREMENT, VSCP_TYPE_MEASUREMENT_TEMPERATURE));
+
+    uint16_t vscp_class = 0;
+    EXPECT_TRUE(table.getClassFromToken(&vscp_class, "MY.MEASUREMENT2"));
+    EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, vscp_class);
+    EXPECT_FALSE(table.getClassFromToken(&vscp_class, "MY.MEASUREMENT"));
+
+    uint16_t vscp_type = 0;
+    vscp_class         = 0xffff;
+    EXPECT_TRUE(table.getTypeFromToken(&vscp_class, &vscp_type, "MY_TYPE"));
+    EXPECT_EQ(VSCP_CLASS1_MEASUREMENT, vscp_class);
+    EXPECT_EQ(0xfff0, vscp_type);
+}
+
 // Entry point for Google Test
 int main(int argc, char **argv)
 {
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+#
+# gen-token-table.py
+#
+# Generate src/vscp/common/vscp-token-data.h from the VSCP class & type
+# definition database (resources/database/vscp_events.sqlite3).
+#
+# The header holds VSCP class and type tokens as constant arrays sorted
+# on id, plus index arrays sorted on token, so both id -> token and
+# token -> id lookups can be done with a binary search without any
+# locking. Run it again when the database is updated
+#
+#   tools/gen-token-table.py [path-to-db] [path-to-header]
+#
+# This file is part of the VSCP (https://www.vscp.org)
+#
+# The MIT License (MIT)
+#
+# Copyright (C) 2000-2026 Ake Hedman, the VSCP project
+# <info@vscp.org>
+#
+
+import os
+import sqlite3
+import sys
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+db_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, "resources/database/vscp_events.sqlite3")
+out_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "src/vscp/common/vscp-token-data.h")
+
+db = sqlite3.connect(db_path)
+classes = sorted(db.execute("SELECT class, token FROM vscp_class").fetchall())
+types = sorted(
+    ((cls << 16) | typ, token.strip())
+    for typ, cls, token in db.execute("SELECT type, link_to_class, token FROM vscp_type").fetchall()
+)
+db.close()
+
+# Byte wise compare, same order as strcmp
+class_index = sorted(range(len(classes)), key=lambda i: (classes[i][1].encode(), classes[i][0]))
+type_index = sorted(range(len(types)), key=lambda i: (types[i][1].encode(), types[i][0]))
+
+
+def chunks(values, n):
+    for i in range(0, len(values), n):
+        yield values[i:i + n]
+
+
+lines = []
+lines.append("/*")
+lines.append("            !!!!!!!!!!!!!!!!!!!!  W A R N I N G  !!!!!!!!!!!!!!!!!!!!")
+lines.append("                           This file is auto-generated")
+lines.append("                   by tools/gen-token-table.py from vscp_events.sqlite3")
+lines.append("*/")
+lines.append("")
+lines.append("#ifndef VSCP_TOKEN_DATA_H")
+lines.append("#define VSCP_TOKEN_DATA_H")
+lines.append("")
+lines.append("// Sorted on vscp_class")
+lines.append("static constexpr vscp_class_token_entry vscp_class_tokens[] = {")
+for cls, token in classes:
+    lines.append('  { %d, "%s" },' % (cls, token))
+lines.append("};")
+lines.append("")
+lines.append("// Index into vscp_class_tokens sorted on token")
+lines.append("static constexpr uint16_t vscp_class_token_index[] = {")
+for c in chunks(class_index, 12):
+    lines.append("  " + ", ".join(str(i) for i in c) + ",")
+lines.append("};")
+lines.append("")
+lines.append("// Sorted on (vscp_class << 16) | vscp_type")
+lines.append("static constexpr vscp_type_token_entry vscp_type_tokens[] = {")
+for id, token in types:
+    lines.append('  { 0x%08X, "%s" },' % (id, token))
+lines.append("};")
+lines.append("")
+lines.append("// Index into vscp_type_tokens sorted on token (and id for equal tokens)")
+lines.append("static constexpr uint16_t vscp_type_token_index[] = {")
+for c in chunks(type_index, 12):
+    lines.append("  " + ", ".join(str(i) for i in c) + ",")
+lines.append("};")
+lines.append("")
+lines.append("#endif // VSCP_TOKEN_DATA_H")
+lines.append("")
+
+with open(out_path, "w") as f:
+    f.write("\n".join(lines))